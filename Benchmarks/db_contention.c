@@ -0,0 +1,888 @@
+//
+//  db_contention.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+//  Multi-process contention benchmark for the database layer. The app, its extensions and helpers all share one
+//  SQLite file (see RBDatabase), so this forks writer and reader processes against a single database and replays the
+//  statements RBDatabase issues: allowlist upserts, bulk removals, stat increments, point lookups, ordered
+//  enumerations and change sequence polling.
+//
+//  The schema is RBDatabase's own (rb_sqlite_create_tables()) and connections come from rb_sqlite_open(), with the
+//  busy timeout swapped for an equivalent handler which counts waits. The retry policy mirrors RBDatabase.m.
+//
+//      ./db_contention -w 4 -r 8 -t 10
+//
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <sqlite3.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rb_sqlite.h"
+
+/*** Configuration ***/
+
+// Matches RBDatabase
+#define BUSY_TIMEOUT_MS 1500
+#define UPSERT_MAX_TRIES 10
+#define STAT_MAX_TRIES 2
+
+typedef enum {
+    OP_UPSERT,
+    OP_BULK_REMOVE,
+    OP_STAT_INCREMENT,
+    OP_LOOKUP,
+    OP_ENUMERATE,
+    OP_STATS_RANGE,
+    OP_CHANGE_SEQUENCE,
+    OP_COUNT
+} op_t;
+
+static const char *op_names[OP_COUNT] = {
+    "upsert",
+    "bulk-remove",
+    "stat-increment",
+    "lookup",
+    "enumerate",
+    "stats-range",
+    "change-seq",
+};
+
+typedef struct {
+    int writers;
+    int readers;
+    double duration;
+    int domains;
+    int bulk_size;
+    double sample_interval;
+    const char *path;
+    bool keep;
+    bool json;
+    unsigned seed;
+} config_t;
+
+/*** Latency histogram ***/
+
+// Log-linear buckets: 2^SUB_BITS linear buckets per power of two (of nanoseconds), ~3% relative error
+#define SUB_BITS 5
+#define SUB_COUNT (1 << SUB_BITS)
+#define HIST_SIZE ((64 - SUB_BITS) * SUB_COUNT)
+
+typedef struct {
+    _Atomic uint64_t count;
+    _Atomic uint64_t errors;
+    _Atomic uint64_t busy_retries;
+    _Atomic uint64_t total_ns;
+    _Atomic uint64_t max_ns;
+    _Atomic uint64_t buckets[HIST_SIZE];
+} op_stats_t;
+
+// Lives in a shared anonymous mapping so that children report directly to the parent
+typedef struct {
+    _Atomic int start;
+    _Atomic int stop;
+    _Atomic uint64_t busy_handler_calls;
+    op_stats_t ops[OP_COUNT];
+} shared_t;
+
+static inline unsigned hist_index(uint64_t ns) {
+    if (ns < SUB_COUNT) {
+        return (unsigned)ns;
+    }
+    unsigned msb = 63 - (unsigned)__builtin_clzll(ns);
+    unsigned shift = msb - SUB_BITS;
+    return ((shift + 1) << SUB_BITS) + (unsigned)((ns >> shift) & (SUB_COUNT - 1));
+}
+
+static inline uint64_t hist_value(unsigned index) {
+    if (index < SUB_COUNT) {
+        return index;
+    }
+    unsigned shift = (index >> SUB_BITS) - 1;
+    uint64_t sub = index & (SUB_COUNT - 1);
+    // Midpoint of the bucket
+    return ((SUB_COUNT | sub) << shift) + ((1ULL << shift) >> 1);
+}
+
+static void op_record(op_stats_t *stats, uint64_t ns, bool ok) {
+    atomic_fetch_add_explicit(&stats->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stats->total_ns, ns, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stats->buckets[hist_index(ns)], 1, memory_order_relaxed);
+    
+    if (!ok) {
+        atomic_fetch_add_explicit(&stats->errors, 1, memory_order_relaxed);
+    }
+    
+    uint64_t max = atomic_load_explicit(&stats->max_ns, memory_order_relaxed);
+    while (ns > max && !atomic_compare_exchange_weak(&stats->max_ns, &max, ns)) {
+    }
+}
+
+static uint64_t op_percentile(const op_stats_t *stats, double percentile) {
+    uint64_t count = atomic_load(&stats->count);
+    if (count == 0) {
+        return 0;
+    }
+    
+    uint64_t target = (uint64_t)(percentile * (double)count);
+    if (target >= count) {
+        target = count - 1;
+    }
+    
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < HIST_SIZE; i++) {
+        seen += atomic_load(&stats->buckets[i]);
+        if (seen > target) {
+            uint64_t value = hist_value(i);
+            uint64_t max = atomic_load(&stats->max_ns);
+            return value < max ? value : max;
+        }
+    }
+    
+    return atomic_load(&stats->max_ns);
+}
+
+/*** Utilities ***/
+
+static inline uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint32_t rand_next(uint64_t *state) {
+    // xorshift64*
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return (uint32_t)((x * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static inline void domain_for_index(char *buf, size_t size, uint32_t index) {
+    // Spread entries over a handful of root domains so that enumeration ordering and in_domain() do real work
+    snprintf(buf, size, "host-%u.site-%u.example%u.com", index, index % 97, index % 7);
+}
+
+static off_t file_size(const char *path) {
+    struct stat st;
+    return stat(path, &st) == 0 ? st.st_size : 0;
+}
+
+/*** Connections ***/
+
+static shared_t *shared = NULL;
+
+// Behaves like sqlite3_busy_timeout() but lets us count how often we had to wait for a lock
+static int busy_handler(void *context, int count) {
+    (void)context;
+    
+    static const int delays[] = { 1, 2, 5, 10, 15, 20, 25, 25, 25, 50, 50, 100 };
+    static const int numDelays = sizeof(delays) / sizeof(delays[0]);
+    
+    int delay, prior;
+    if (count < numDelays) {
+        delay = delays[count];
+        prior = 0;
+        for (int i = 0; i < count; i++) {
+            prior += delays[i];
+        }
+    } else {
+        delay = delays[numDelays - 1];
+        prior = 328 + (count - numDelays) * delay;
+    }
+    
+    if (prior + delay > BUSY_TIMEOUT_MS) {
+        delay = BUSY_TIMEOUT_MS - prior;
+        if (delay <= 0) {
+            return 0;
+        }
+    }
+    
+    atomic_fetch_add_explicit(&shared->busy_handler_calls, 1, memory_order_relaxed);
+    usleep((useconds_t)delay * 1000);
+    
+    return 1;
+}
+
+static int exec(sqlite3 *db, const char *sql) {
+    int status = sqlite3_exec(db, sql, NULL, NULL, NULL);
+    return status == SQLITE_OK ? SQLITE_DONE : status;
+}
+
+static sqlite3 *open_connection(const char *path) {
+    sqlite3 *db = NULL;
+    int status = rb_sqlite_open(path, SQLITE_OPEN_CREATE | SQLITE_OPEN_READWRITE | SQLITE_OPEN_FULLMUTEX, &db);
+    
+    if (status == SQLITE_OK) {
+        status = sqlite3_busy_handler(db, busy_handler, NULL);
+    }
+    if (status == SQLITE_OK) {
+        status = exec(db, "PRAGMA foreign_keys = on") == SQLITE_DONE ? SQLITE_OK : SQLITE_ERROR;
+    }
+    
+    if (status != SQLITE_OK) {
+        fprintf(stderr, "Could not open %s: %s\n", path, sqlite3_errstr(status));
+        exit(EXIT_FAILURE);
+    }
+    
+    return db;
+}
+
+/*** Statements ***/
+
+typedef struct {
+    sqlite3 *db;
+    uint64_t rand;
+    const config_t *config;
+    
+    sqlite3_stmt *lookup;
+    sqlite3_stmt *upsert;
+    sqlite3_stmt *deleteGroups;
+    sqlite3_stmt *insertGroup;
+    sqlite3_stmt *logChange;
+    sqlite3_stmt *remove;
+    sqlite3_stmt *statUpdate;
+    sqlite3_stmt *statInsert;
+    sqlite3_stmt *enumerate;
+    sqlite3_stmt *statsRange;
+    sqlite3_stmt *dataVersion;
+    sqlite3_stmt *maxSeq;
+    
+    int64_t lastDataVersion;
+} worker_t;
+
+static void prepare(worker_t *worker, sqlite3_stmt **stmt, const char *sql) {
+    int status = sqlite3_prepare_v2(worker->db, sql, -1, stmt, NULL);
+    if (status != SQLITE_OK) {
+        fprintf(stderr, "Could not prepare \"%s\": %s\n", sql, sqlite3_errmsg(worker->db));
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void worker_init(worker_t *worker, const config_t *config, unsigned seed) {
+    memset(worker, 0, sizeof(*worker));
+    
+    worker->db = open_connection(config->path);
+    worker->rand = ((uint64_t)seed << 32) ^ 0x9E3779B97F4A7C15ULL;
+    worker->config = config;
+    worker->lastDataVersion = -1;
+    
+    prepare(worker, &worker->lookup,
+            "SELECT domain, group_concat(exception_group.name), create_date, modify_date, enabled "
+            "FROM exception, exception_group "
+            "WHERE domain = $1 AND exception_group.exception_domain = domain "
+            "GROUP BY domain "
+            "ORDER BY length(domain) DESC, domain, exception_group.name");
+    prepare(worker, &worker->upsert,
+            "INSERT INTO exception(domain, create_date, modify_date, enabled) VALUES ($1, $2, $3, $4) "
+            "ON CONFLICT(domain) DO UPDATE SET modify_date = $3, enabled = $4");
+    prepare(worker, &worker->deleteGroups, "DELETE FROM exception_group WHERE exception_domain = $1");
+    prepare(worker, &worker->insertGroup, "INSERT INTO exception_group(exception_domain, name) VALUES (?, ?)");
+    prepare(worker, &worker->logChange, "INSERT INTO exception_change(domain, type, date) VALUES ($1, $2, $3)");
+    prepare(worker, &worker->remove, "DELETE FROM exception WHERE domain = ?");
+    prepare(worker, &worker->statUpdate,
+            "UPDATE stat SET value = value + $3 "
+            "WHERE date = date(datetime($1, 'unixepoch')) AND name = $2");
+    prepare(worker, &worker->statInsert,
+            "INSERT OR IGNORE INTO stat (date, name, value) VALUES (date(datetime($1, 'unixepoch')), $2, 0)");
+    prepare(worker, &worker->enumerate,
+            "WITH _group AS ("
+            "    SELECT DISTINCT exception_domain FROM exception_group "
+            "    WHERE $1 IS NULL OR name = $1 OR name = '*'"
+            ") "
+            "SELECT domain, group_concat(exception_group.name), create_date, modify_date, enabled "
+            "FROM exception, _group, exception_group "
+            "WHERE domain = _group.exception_domain "
+            "AND ($2 IS NULL OR domain = $2 OR in_domain($2, domain)) "
+            "AND exception_group.exception_domain = domain "
+            "GROUP BY domain "
+            "ORDER BY root_domain(exception.domain), length(exception.domain), exception.domain");
+    prepare(worker, &worker->statsRange,
+            "SELECT name, SUM(value) FROM stat "
+            "WHERE date > date(datetime($1, 'unixepoch')) AND date <= date(datetime($2, 'unixepoch')) "
+            "GROUP BY name ORDER BY name");
+    prepare(worker, &worker->dataVersion, "PRAGMA data_version");
+    prepare(worker, &worker->maxSeq, "SELECT IFNULL(MAX(seq), 0) FROM exception_change");
+}
+
+static void worker_free(worker_t *worker) {
+    sqlite3_stmt **stmts[] = {
+        &worker->lookup, &worker->upsert, &worker->deleteGroups, &worker->insertGroup, &worker->logChange,
+        &worker->remove, &worker->statUpdate, &worker->statInsert, &worker->enumerate, &worker->statsRange,
+        &worker->dataVersion, &worker->maxSeq
+    };
+    
+    for (size_t i = 0; i < sizeof(stmts) / sizeof(stmts[0]); i++) {
+        sqlite3_finalize(*stmts[i]);
+    }
+    
+    sqlite3_close(worker->db);
+}
+
+// Steps a statement to completion and resets it (returns SQLITE_DONE on success)
+static int step_all(sqlite3_stmt *stmt, int *rows) {
+    int status;
+    int count = 0;
+    
+    while ((status = sqlite3_step(stmt)) == SQLITE_ROW) {
+        count++;
+    }
+    
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    
+    if (rows != NULL) {
+        *rows = count;
+    }
+    
+    return status;
+}
+
+/*** Operations ***/
+
+static int do_lookup(worker_t *worker, const char *domain, bool *exists) {
+    sqlite3_bind_text(worker->lookup, 1, domain, -1, SQLITE_STATIC);
+    
+    int rows = 0;
+    int status = step_all(worker->lookup, &rows);
+    
+    if (exists != NULL) {
+        *exists = rows > 0;
+    }
+    
+    return status;
+}
+
+static int do_upsert_once(worker_t *worker, const char *domain) {
+    static const char *groups[] = { "ads", "privacy", "annoyance", "regional" };
+    
+    int status = exec(worker->db, "BEGIN TRANSACTION");
+    bool existed = false;
+    int64_t now = (int64_t)time(NULL);
+    
+    if (status == SQLITE_DONE) {
+        status = do_lookup(worker, domain, &existed);
+    }
+    
+    if (status == SQLITE_DONE) {
+        sqlite3_bind_text(worker->upsert, 1, domain, -1, SQLITE_STATIC);
+        sqlite3_bind_int64(worker->upsert, 2, now);
+        sqlite3_bind_int64(worker->upsert, 3, now);
+        sqlite3_bind_int(worker->upsert, 4, rand_next(&worker->rand) % 8 != 0);
+        status = step_all(worker->upsert, NULL);
+    }
+    
+    if (status == SQLITE_DONE) {
+        sqlite3_bind_text(worker->deleteGroups, 1, domain, -1, SQLITE_STATIC);
+        status = step_all(worker->deleteGroups, NULL);
+    }
+    
+    if (status == SQLITE_DONE) {
+        uint32_t numGroups = rand_next(&worker->rand) % 3;
+        
+        if (numGroups == 0) {
+            sqlite3_bind_text(worker->insertGroup, 1, domain, -1, SQLITE_STATIC);
+            sqlite3_bind_text(worker->insertGroup, 2, "*", -1, SQLITE_STATIC);
+            status = step_all(worker->insertGroup, NULL);
+        }
+        
+        for (uint32_t i = 0; i < numGroups && status == SQLITE_DONE; i++) {
+            sqlite3_bind_text(worker->insertGroup, 1, domain, -1, SQLITE_STATIC);
+            sqlite3_bind_text(worker->insertGroup, 2, groups[(rand_next(&worker->rand) + i) % 4], -1, SQLITE_STATIC);
+            status = step_all(worker->insertGroup, NULL);
+        }
+    }
+    
+    if (status == SQLITE_DONE) {
+        sqlite3_bind_text(worker->logChange, 1, domain, -1, SQLITE_STATIC);
+        sqlite3_bind_int(worker->logChange, 2, existed ? 2 : 1);
+        sqlite3_bind_int64(worker->logChange, 3, now);
+        status = step_all(worker->logChange, NULL);
+    }
+    
+    if (status == SQLITE_DONE) {
+        status = do_lookup(worker, domain, NULL);
+    }
+    
+    if (status == SQLITE_DONE) {
+        status = exec(worker->db, "COMMIT TRANSACTION");
+    } else {
+        exec(worker->db, "ROLLBACK TRANSACTION");
+    }
+    
+    return status;
+}
+
+static int do_upsert(worker_t *worker, op_stats_t *stats) {
+    char domain[128];
+    domain_for_index(domain, sizeof(domain), rand_next(&worker->rand) % (uint32_t)worker->config->domains);
+    
+    int status = SQLITE_OK;
+    
+    // Same retry policy as -[RBDatabase _upsertAllowlistEntryForDomain:usingBlock:conn:error:]
+    for (int curTry = 0; curTry < UPSERT_MAX_TRIES; curTry++) {
+        status = do_upsert_once(worker, domain);
+        
+        if (status != SQLITE_BUSY) {
+            break;
+        }
+        
+        atomic_fetch_add_explicit(&stats->busy_retries, 1, memory_order_relaxed);
+        if (curTry > 0) {
+            usleep((rand_next(&worker->rand) % (uint32_t)(curTry * 100)) * 100);
+        }
+    }
+    
+    return status;
+}
+
+static int do_bulk_remove(worker_t *worker, op_stats_t *stats) {
+    int status = exec(worker->db, "BEGIN TRANSACTION");
+    int64_t now = (int64_t)time(NULL);
+    
+    for (int i = 0; i < worker->config->bulk_size && status == SQLITE_DONE; i++) {
+        char domain[128];
+        domain_for_index(domain, sizeof(domain), rand_next(&worker->rand) % (uint32_t)worker->config->domains);
+        
+        sqlite3_bind_text(worker->remove, 1, domain, -1, SQLITE_STATIC);
+        status = step_all(worker->remove, NULL);
+        
+        if (status == SQLITE_DONE && sqlite3_changes(worker->db) > 0) {
+            sqlite3_bind_text(worker->logChange, 1, domain, -1, SQLITE_TRANSIENT);
+            sqlite3_bind_int(worker->logChange, 2, 3);
+            sqlite3_bind_int64(worker->logChange, 3, now);
+            status = step_all(worker->logChange, NULL);
+        }
+    }
+    
+    if (status == SQLITE_DONE) {
+        status = exec(worker->db, "COMMIT TRANSACTION");
+    } else {
+        exec(worker->db, "ROLLBACK TRANSACTION");
+    }
+    
+    if (status == SQLITE_BUSY) {
+        atomic_fetch_add_explicit(&stats->busy_retries, 1, memory_order_relaxed);
+    }
+    
+    return status;
+}
+
+static int do_stat_increment(worker_t *worker, op_stats_t *stats) {
+    static const char *names[] = { "ads", "privacy", "trackers", "cosmetic" };
+    const char *name = names[rand_next(&worker->rand) % 4];
+    int64_t now = (int64_t)time(NULL);
+    int status = SQLITE_DONE;
+    
+    // Same as -[RBDatabase incrementStatWithName:by:completionHandler:]
+    for (int curTry = 0; curTry < STAT_MAX_TRIES; curTry++) {
+        sqlite3_bind_int64(worker->statUpdate, 1, now);
+        sqlite3_bind_text(worker->statUpdate, 2, name, -1, SQLITE_STATIC);
+        sqlite3_bind_int(worker->statUpdate, 3, 1 + (int)(rand_next(&worker->rand) % 10));
+        status = step_all(worker->statUpdate, NULL);
+        
+        if (status == SQLITE_DONE && sqlite3_changes(worker->db) == 0) {
+            sqlite3_bind_int64(worker->statInsert, 1, now);
+            sqlite3_bind_text(worker->statInsert, 2, name, -1, SQLITE_STATIC);
+            status = step_all(worker->statInsert, NULL);
+            
+            if (status == SQLITE_DONE) {
+                continue;
+            }
+        }
+        
+        break;
+    }
+    
+    if (status == SQLITE_BUSY) {
+        atomic_fetch_add_explicit(&stats->busy_retries, 1, memory_order_relaxed);
+    }
+    
+    return status;
+}
+
+static int do_enumerate(worker_t *worker) {
+    static const char *groups[] = { NULL, "ads", "privacy" };
+    uint32_t r = rand_next(&worker->rand);
+    
+    if (groups[r % 3] != NULL) {
+        sqlite3_bind_text(worker->enumerate, 1, groups[r % 3], -1, SQLITE_STATIC);
+    }
+    
+    // Occasionally filter by domain (i.e. the allowlist UI's search)
+    char domain[32];
+    if ((r >> 8) % 4 == 0) {
+        snprintf(domain, sizeof(domain), "example%u.com", (r >> 16) % 7);
+        sqlite3_bind_text(worker->enumerate, 2, domain, -1, SQLITE_STATIC);
+    }
+    
+    return step_all(worker->enumerate, NULL);
+}
+
+static int do_stats_range(worker_t *worker) {
+    int64_t now = (int64_t)time(NULL);
+    
+    sqlite3_bind_int64(worker->statsRange, 1, now - 7 * 86400);
+    sqlite3_bind_int64(worker->statsRange, 2, now);
+    
+    return step_all(worker->statsRange, NULL);
+}
+
+static int do_change_sequence(worker_t *worker) {
+    // Same as -[RBDatabase _changeSequenceNumberWithConnection:error:]
+    int status = sqlite3_step(worker->dataVersion);
+    int64_t dataVersion = status == SQLITE_ROW ? sqlite3_column_int64(worker->dataVersion, 0) : -1;
+    sqlite3_reset(worker->dataVersion);
+    
+    if (status != SQLITE_ROW) {
+        return status;
+    } else if (dataVersion == worker->lastDataVersion) {
+        return SQLITE_DONE;
+    }
+    
+    worker->lastDataVersion = dataVersion;
+    return step_all(worker->maxSeq, NULL);
+}
+
+/*** Processes ***/
+
+static void run_worker(const config_t *config, bool isWriter, unsigned seed) {
+    worker_t worker;
+    worker_init(&worker, config, seed);
+    
+    while (!atomic_load(&shared->start)) {
+        usleep(1000);
+    }
+    
+    while (!atomic_load_explicit(&shared->stop, memory_order_relaxed)) {
+        uint32_t r = rand_next(&worker.rand) % 100;
+        op_t op;
+        
+        if (isWriter) {
+            op = r < 50 ? OP_UPSERT : (r < 60 ? OP_BULK_REMOVE : OP_STAT_INCREMENT);
+        } else {
+            op = r < 60 ? OP_LOOKUP : (r < 75 ? OP_ENUMERATE : (r < 85 ? OP_STATS_RANGE : OP_CHANGE_SEQUENCE));
+        }
+        
+        op_stats_t *stats = &shared->ops[op];
+        uint64_t startTime = now_ns();
+        int status = SQLITE_DONE;
+        
+        switch (op) {
+            case OP_UPSERT:
+                status = do_upsert(&worker, stats);
+                break;
+            case OP_BULK_REMOVE:
+                status = do_bulk_remove(&worker, stats);
+                break;
+            case OP_STAT_INCREMENT:
+                status = do_stat_increment(&worker, stats);
+                break;
+            case OP_LOOKUP: {
+                char domain[128];
+                domain_for_index(domain, sizeof(domain), rand_next(&worker.rand) % (uint32_t)config->domains);
+                status = do_lookup(&worker, domain, NULL);
+                break;
+            }
+            case OP_ENUMERATE:
+                status = do_enumerate(&worker);
+                break;
+            case OP_STATS_RANGE:
+                status = do_stats_range(&worker);
+                break;
+            case OP_CHANGE_SEQUENCE:
+                status = do_change_sequence(&worker);
+                break;
+            default:
+                break;
+        }
+        
+        op_record(stats, now_ns() - startTime, status == SQLITE_DONE);
+    }
+    
+    worker_free(&worker);
+}
+
+static void seed_database(const config_t *config) {
+    sqlite3 *db = open_connection(config->path);
+    
+    if (rb_sqlite_create_tables(db) != SQLITE_DONE) {
+        fprintf(stderr, "Could not create tables: %s\n", sqlite3_errmsg(db));
+        exit(EXIT_FAILURE);
+    }
+    
+    sqlite3_close(db);
+    
+    // Start with half of the domain space populated so that upserts are a mix of inserts and updates
+    worker_t worker;
+    worker_init(&worker, config, config->seed);
+    
+    for (int i = 0; i < config->domains; i += 2) {
+        char domain[128];
+        domain_for_index(domain, sizeof(domain), (uint32_t)i);
+        
+        if (do_upsert_once(&worker, domain) != SQLITE_DONE) {
+            fprintf(stderr, "Could not seed database: %s\n", sqlite3_errmsg(worker.db));
+            exit(EXIT_FAILURE);
+        }
+    }
+    
+    worker_free(&worker);
+}
+
+/*** Reporting ***/
+
+static void print_report(const config_t *config, double elapsed, off_t walMax, off_t walLast) {
+    uint64_t busyRetries = 0;
+    
+    if (config->json) {
+        printf("{\n  \"writers\": %d,\n  \"readers\": %d,\n  \"duration\": %.3f,\n  \"ops\": {\n", config->writers, config->readers, elapsed);
+    } else {
+        printf("\n%-15s %10s %10s %10s %10s %10s %8s %8s\n", "op", "count", "ops/s", "p50(us)", "p99(us)", "max(us)", "busy", "errors");
+    }
+    
+    bool first = true;
+    for (int i = 0; i < OP_COUNT; i++) {
+        const op_stats_t *stats = &shared->ops[i];
+        uint64_t count = atomic_load(&stats->count);
+        
+        busyRetries += atomic_load(&stats->busy_retries);
+        
+        if (count == 0) {
+            continue;
+        }
+        
+        double p50 = op_percentile(stats, 0.50) / 1e3;
+        double p99 = op_percentile(stats, 0.99) / 1e3;
+        double max = atomic_load(&stats->max_ns) / 1e3;
+        
+        if (config->json) {
+            printf("%s    \"%s\": { \"count\": %" PRIu64 ", \"throughput\": %.1f, \"p50_us\": %.1f, \"p99_us\": %.1f, \"max_us\": %.1f, \"busy_retries\": %" PRIu64 ", \"errors\": %" PRIu64 " }",
+                   first ? "" : ",\n", op_names[i], count, count / elapsed, p50, p99, max, atomic_load(&stats->busy_retries), atomic_load(&stats->errors));
+        } else {
+            printf("%-15s %10" PRIu64 " %10.1f %10.1f %10.1f %10.1f %8" PRIu64 " %8" PRIu64 "\n",
+                   op_names[i], count, count / elapsed, p50, p99, max, atomic_load(&stats->busy_retries), atomic_load(&stats->errors));
+        }
+        
+        first = false;
+    }
+    
+    if (config->json) {
+        printf("\n  },\n  \"busy_retries\": %" PRIu64 ",\n  \"busy_handler_calls\": %" PRIu64 ",\n  \"wal_max_bytes\": %lld,\n  \"wal_last_bytes\": %lld\n}\n",
+               busyRetries, atomic_load(&shared->busy_handler_calls), (long long)walMax, (long long)walLast);
+    } else {
+        printf("\nBUSY retries: %" PRIu64 " (busy handler waits: %" PRIu64 ")\n", busyRetries, atomic_load(&shared->busy_handler_calls));
+        printf("WAL size: max %.1f KiB, last sample %.1f KiB\n", walMax / 1024.0, walLast / 1024.0);
+    }
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  -w, --writers N      writer processes (default 2)\n"
+            "  -r, --readers N      reader processes (default 4)\n"
+            "  -t, --duration SECS  run time (default 5)\n"
+            "  -n, --domains N      size of the allowlist domain space (default 5000)\n"
+            "  -b, --bulk N         domains per bulk removal (default 20)\n"
+            "  -i, --interval SECS  WAL/throughput sampling interval (default 0.5)\n"
+            "  -f, --file PATH      database path (default: temporary file)\n"
+            "  -k, --keep           keep the database afterwards\n"
+            "  -s, --seed N         random seed\n"
+            "  -j, --json           print the summary as JSON\n",
+            argv0);
+}
+
+int main(int argc, char **argv) {
+    config_t config = {
+        .writers = 2,
+        .readers = 4,
+        .duration = 5,
+        .domains = 5000,
+        .bulk_size = 20,
+        .sample_interval = 0.5,
+        .path = NULL,
+        .keep = false,
+        .json = false,
+        .seed = (unsigned)time(NULL),
+    };
+    
+    static const struct option options[] = {
+        { "writers", required_argument, NULL, 'w' },
+        { "readers", required_argument, NULL, 'r' },
+        { "duration", required_argument, NULL, 't' },
+        { "domains", required_argument, NULL, 'n' },
+        { "bulk", required_argument, NULL, 'b' },
+        { "interval", required_argument, NULL, 'i' },
+        { "file", required_argument, NULL, 'f' },
+        { "keep", no_argument, NULL, 'k' },
+        { "seed", required_argument, NULL, 's' },
+        { "json", no_argument, NULL, 'j' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+    
+    int opt;
+    while ((opt = getopt_long(argc, argv, "w:r:t:n:b:i:f:ks:jh", options, NULL)) != -1) {
+        switch (opt) {
+            case 'w': config.writers = atoi(optarg); break;
+            case 'r': config.readers = atoi(optarg); break;
+            case 't': config.duration = atof(optarg); break;
+            case 'n': config.domains = atoi(optarg); break;
+            case 'b': config.bulk_size = atoi(optarg); break;
+            case 'i': config.sample_interval = atof(optarg); break;
+            case 'f': config.path = optarg; break;
+            case 'k': config.keep = true; break;
+            case 's': config.seed = (unsigned)strtoul(optarg, NULL, 10); break;
+            case 'j': config.json = true; break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    
+    if (config.writers < 0 || config.readers < 0 || config.writers + config.readers == 0 || config.domains <= 0 || config.duration <= 0 || config.sample_interval <= 0) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    char tempPath[] = "/tmp/rb-db-contention-XXXXXX";
+    char pathBuf[sizeof(tempPath) + 16];
+    
+    if (config.path == NULL) {
+        if (mkdtemp(tempPath) == NULL) {
+            perror("mkdtemp");
+            return EXIT_FAILURE;
+        }
+        snprintf(pathBuf, sizeof(pathBuf), "%s/radblock.db", tempPath);
+        config.path = pathBuf;
+    }
+    
+    char walPath[4096];
+    snprintf(walPath, sizeof(walPath), "%s-wal", config.path);
+    
+    shared = mmap(NULL, sizeof(shared_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return EXIT_FAILURE;
+    }
+    memset(shared, 0, sizeof(shared_t));
+    
+    seed_database(&config);
+    
+    int numWorkers = config.writers + config.readers;
+    pid_t *pids = calloc((size_t)numWorkers, sizeof(pid_t));
+    
+    for (int i = 0; i < numWorkers; i++) {
+        pid_t pid = fork();
+        
+        if (pid < 0) {
+            perror("fork");
+            atomic_store(&shared->stop, 1);
+            break;
+        } else if (pid == 0) {
+            run_worker(&config, i < config.writers, config.seed + (unsigned)i + 1);
+            _exit(EXIT_SUCCESS);
+        }
+        
+        pids[i] = pid;
+    }
+    
+    if (!config.json) {
+        printf("%d writers, %d readers, %d domains, %.1fs against %s\n\n", config.writers, config.readers, config.domains, config.duration, config.path);
+        printf("%8s %12s %12s %12s\n", "time(s)", "writes/s", "reads/s", "wal(KiB)");
+    }
+    
+    uint64_t startTime = now_ns();
+    uint64_t lastSampleTime = startTime;
+    uint64_t lastWrites = 0, lastReads = 0;
+    off_t walMax = 0;
+    off_t walSize = 0;
+    
+    atomic_store(&shared->start, 1);
+    
+    while (true) {
+        usleep((useconds_t)(config.sample_interval * 1e6));
+        
+        uint64_t sampleTime = now_ns();
+        double elapsed = (sampleTime - startTime) / 1e9;
+        uint64_t writes = 0, reads = 0;
+        
+        for (int i = 0; i < OP_COUNT; i++) {
+            uint64_t count = atomic_load(&shared->ops[i].count);
+            if (i <= OP_STAT_INCREMENT) {
+                writes += count;
+            } else {
+                reads += count;
+            }
+        }
+        
+        walSize = file_size(walPath);
+        walMax = walSize > walMax ? walSize : walMax;
+        
+        if (!config.json) {
+            double interval = (sampleTime - lastSampleTime) / 1e9;
+            printf("%8.2f %12.1f %12.1f %12.1f\n", elapsed, (writes - lastWrites) / interval, (reads - lastReads) / interval, walSize / 1024.0);
+            fflush(stdout);
+        }
+        
+        lastSampleTime = sampleTime;
+        lastWrites = writes;
+        lastReads = reads;
+        
+        if (elapsed >= config.duration) {
+            break;
+        }
+    }
+    
+    atomic_store(&shared->stop, 1);
+    
+    int failures = 0;
+    for (int i = 0; i < numWorkers; i++) {
+        int status = 0;
+        if (pids[i] > 0 && (waitpid(pids[i], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)) {
+            failures++;
+        }
+    }
+    
+    double elapsed = (now_ns() - startTime) / 1e9;
+    print_report(&config, elapsed, walMax, walSize);
+    
+    if (!config.keep) {
+        char path[4096];
+        unlink(config.path);
+        snprintf(path, sizeof(path), "%s-wal", config.path);
+        unlink(path);
+        snprintf(path, sizeof(path), "%s-shm", config.path);
+        unlink(path);
+        if (config.path == pathBuf) {
+            rmdir(tempPath);
+        }
+    }
+    
+    free(pids);
+    
+    if (failures > 0) {
+        fprintf(stderr, "%d worker(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+}
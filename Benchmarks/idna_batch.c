@@ -0,0 +1,149 @@
+//
+//  idna_batch.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+//  Throughput benchmark for the batch IDNA encoder (see idna.h). Allowlist domains are encoded on every content
+//  blocker rebuild, so this generates domains shaped like allowlist entries (mostly ASCII, some internationalized,
+//  some mixed case), packs them into one buffer and reports ns/domain for each mix.
+//
+//  -[NSString idnaEncodedString] needs Foundation, so the comparison against it lives in NSString+IDNATests
+//  (testBatchEncodingPerformance).
+//
+//      ./idna_batch -n 100000 -i 10
+//
+
+#define _GNU_SOURCE
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "idna.h"
+
+/*** Configuration ***/
+
+typedef struct {
+    size_t numberOfDomains;
+    int iterations;
+    unsigned int seed;
+} Config;
+
+/*** Domains ***/
+
+static const char *const kWords[] = {
+    "news", "shop", "Video", "mail", "cdn", "static", "login", "Weather", "maps", "blog", "forum", "docs", "api",
+};
+
+static const char *const kUnicodeWords[] = {
+    "mañana", "bücher", "café", "例子", "пример", "δοκιμή", "💩", "日本語", "إختبار", "テスト",
+};
+
+static const char *const kSuffixes[] = {
+    "com", "net", "org", "co.uk", "de", "jp", "io", "COM",
+};
+
+#define COUNT(array) (sizeof(array) / sizeof(array[0]))
+
+typedef struct {
+    char *bytes;
+    size_t *offsets;
+    size_t count;
+} Domains;
+
+// Percentage of domains which have a non-ASCII label
+static Domains generateDomains(size_t count, int unicodePercentage, unsigned int seed) {
+    Domains domains = {.count = count};
+    size_t capacity = count * 64;
+    size_t length = 0;
+
+    domains.bytes = malloc(capacity);
+    domains.offsets = malloc((count + 1) * sizeof(size_t));
+    srand(seed);
+
+    for (size_t i = 0; i < count; i++) {
+        const char *word = (rand() % 100 < unicodePercentage) ? kUnicodeWords[rand() % COUNT(kUnicodeWords)] : kWords[rand() % COUNT(kWords)];
+        const char *host = kWords[rand() % COUNT(kWords)];
+        const char *suffix = kSuffixes[rand() % COUNT(kSuffixes)];
+
+        domains.offsets[i] = length;
+        if (rand() % 2) {
+            length += (size_t)snprintf(domains.bytes + length, capacity - length, "%s.%s%u.%s", host, word, (unsigned)(rand() % 1000), suffix);
+        } else {
+            length += (size_t)snprintf(domains.bytes + length, capacity - length, "%s%u.%s", word, (unsigned)(rand() % 1000), suffix);
+        }
+    }
+
+    domains.offsets[count] = length;
+    return domains;
+}
+
+/*** Benchmark ***/
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void runBenchmark(const Config *config, const char *name, int unicodePercentage) {
+    Domains domains = generateDomains(config->numberOfDomains, unicodePercentage, config->seed);
+    idna_batch batch;
+    double best = 0;
+
+    idna_batch_init(&batch);
+
+    for (int i = 0; i < config->iterations; i++) {
+        idna_batch_reset(&batch);
+
+        double start = now();
+        enum idna_status status = idna_batch_append_all(&batch, domains.bytes, domains.offsets, domains.count);
+        double elapsed = now() - start;
+
+        if (status != idna_success) {
+            fprintf(stderr, "Could not encode domains (%d)\n", status);
+            exit(1);
+        }
+
+        if (i == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    printf("%-8s %8zu domains %10zu -> %10zu bytes %8.1f ns/domain\n", name, domains.count, domains.offsets[domains.count], batch.output_length, best * 1e9 / domains.count);
+
+    idna_batch_destroy(&batch);
+    free(domains.bytes);
+    free(domains.offsets);
+}
+
+int main(int argc, char *argv[]) {
+    Config config = {.numberOfDomains = 100000, .iterations = 10, .seed = 1};
+    int option;
+
+    while ((option = getopt(argc, argv, "n:i:s:")) != -1) {
+        switch (option) {
+            case 'n': config.numberOfDomains = strtoul(optarg, NULL, 10); break;
+            case 'i': config.iterations = atoi(optarg); break;
+            case 's': config.seed = (unsigned int)strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "Usage: %s [-n domains] [-i iterations] [-s seed]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    if (config.numberOfDomains == 0 || config.iterations < 1) {
+        fprintf(stderr, "Expected at least one domain and iteration\n");
+        return 1;
+    }
+
+    runBenchmark(&config, "ascii", 0);
+    runBenchmark(&config, "mixed", 5);
+    runBenchmark(&config, "unicode", 100);
+
+    return 0;
+}
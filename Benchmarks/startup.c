@@ -0,0 +1,303 @@
+//
+//  startup.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+//  Startup benchmark for the framework's shared state (see RBUtils.m and RBDatabase). Every process which links the
+//  framework used to resolve and create its data directories, load the shared user defaults and set up the database
+//  from a load-time constructor; now each of them is initialized on first use.
+//
+//  This doesn't run the framework, which needs Foundation. The directory and defaults steps are C stand-ins for
+//  RBUtils.m, while the database is opened and set up by the Core (rb_sqlite_open() and rb_sqlite_create_tables(),
+//  which creates RBDatabase's schema). So the numbers show what eager initialization costs a process compared to lazy
+//  initialization, rather than the framework's absolute startup time.
+//
+//  It re-executes itself for every sample and reports the time from exec until the process is ready, both for
+//  processes which exit without touching filters ("idle") and for those which perform a single allowlist lookup
+//  ("lookup").
+//
+//      ./startup -n 200
+//
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sqlite3.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rb_sqlite.h"
+
+/*** Configuration ***/
+
+#define MODE_ENV "RB_STARTUP_MODE"
+#define DIRECTORY_ENV "RB_STARTUP_DIRECTORY"
+#define START_ENV "RB_STARTUP_START"
+
+typedef struct {
+    int samples;
+    int numberOfEntries;
+} Config;
+
+/*** Shared state (child) ***/
+
+typedef struct {
+    char dataPath[4096];
+    char *defaults;
+    sqlite3 *db;
+} SharedState;
+
+static SharedState sharedState;
+static pthread_once_t sharedDirectoryOnce = PTHREAD_ONCE_INIT;
+static pthread_once_t sharedDefaultsOnce = PTHREAD_ONCE_INIT;
+static pthread_once_t sharedDatabaseOnce = PTHREAD_ONCE_INIT;
+
+static void fail(const char *message) {
+    fprintf(stderr, "%s: %s\n", message, strerror(errno));
+    exit(1);
+}
+
+// Equivalent to RBSharedApplicationDataURL()
+static void initDirectory(void) {
+    snprintf(sharedState.dataPath, sizeof(sharedState.dataPath), "%s/data", getenv(DIRECTORY_ENV));
+    if (mkdir(sharedState.dataPath, 0700) != 0 && errno != EEXIST) {
+        fail("Could not create data directory");
+    }
+}
+
+// Equivalent to RBSharedUserDefaults(), which reads the suite's plist
+static void initDefaults(void) {
+    pthread_once(&sharedDirectoryOnce, initDirectory);
+
+    char path[4200];
+    snprintf(path, sizeof(path), "%s/defaults.plist", sharedState.dataPath);
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        sharedState.defaults = calloc(1, 1);
+        return;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long length = ftell(f);
+    rewind(f);
+
+    sharedState.defaults = calloc(1, (size_t)length + 1);
+    if (fread(sharedState.defaults, 1, (size_t)length, f) != (size_t)length) {
+        fail("Could not read defaults");
+    }
+    fclose(f);
+}
+
+static void execute(const char *sql) {
+    char *message = NULL;
+    if (sqlite3_exec(sharedState.db, sql, NULL, NULL, &message) != SQLITE_OK) {
+        fprintf(stderr, "Could not execute %s: %s\n", sql, message);
+        exit(1);
+    }
+}
+
+// Equivalent to the first -[RBDatabase _accessConnectionUsingBlock:] (pool creation and schema setup)
+static void initDatabase(void) {
+    pthread_once(&sharedDirectoryOnce, initDirectory);
+
+    char path[4200];
+    snprintf(path, sizeof(path), "%s/radblock.db", sharedState.dataPath);
+
+    if (rb_sqlite_open(path, SQLITE_OPEN_CREATE | SQLITE_OPEN_READWRITE | SQLITE_OPEN_FULLMUTEX, &sharedState.db) != SQLITE_OK ||
+        rb_sqlite_create_tables(sharedState.db) != SQLITE_DONE) {
+        fprintf(stderr, "Could not open database\n");
+        exit(1);
+    }
+}
+
+// The old load-time constructor from RBUtils.m, plus the database setup which followed on first access
+__attribute__((constructor)) static void eagerInit(void) {
+    const char *mode = getenv(MODE_ENV);
+    if (mode == NULL || strcmp(mode, "eager") != 0) {
+        return;
+    }
+
+    pthread_once(&sharedDirectoryOnce, initDirectory);
+    pthread_once(&sharedDefaultsOnce, initDefaults);
+    pthread_once(&sharedDatabaseOnce, initDatabase);
+}
+
+static int lookup(const char *domain) {
+    pthread_once(&sharedDatabaseOnce, initDatabase);
+
+    sqlite3_stmt *stmt = NULL;
+    int found = 0;
+
+    sqlite3_prepare_v2(sharedState.db,
+                       "SELECT domain, group_concat(exception_group.name), create_date, modify_date, enabled "
+                       "FROM exception, exception_group "
+                       "WHERE domain = $1 AND exception_group.exception_domain = domain "
+                       "GROUP BY domain", -1, &stmt, NULL);
+    sqlite3_bind_text(stmt, 1, domain, -1, SQLITE_STATIC);
+
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        found = 1;
+    }
+
+    sqlite3_finalize(stmt);
+    return found;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Prints the time since the parent exec'd us, once the process is ready
+static int runChild(int shouldLookup) {
+    if (shouldLookup && !lookup("domain-0.com")) {
+        fprintf(stderr, "Expected allowlist entry\n");
+        return 1;
+    }
+
+    printf("%.9f\n", now() - strtod(getenv(START_ENV), NULL));
+    return 0;
+}
+
+/*** Benchmark (parent) ***/
+
+static void populate(const char *directory, int numberOfEntries) {
+    setenv(DIRECTORY_ENV, directory, 1);
+
+    pthread_once(&sharedDatabaseOnce, initDatabase);
+    execute("BEGIN");
+
+    for (int i = 0; i < numberOfEntries; i++) {
+        char sql[256];
+        snprintf(sql, sizeof(sql), "INSERT INTO exception VALUES ('domain-%d.com', 1, 0, 0)", i);
+        execute(sql);
+        snprintf(sql, sizeof(sql), "INSERT INTO exception_group VALUES ('domain-%d.com', 'ads')", i);
+        execute(sql);
+    }
+
+    execute("COMMIT");
+    sqlite3_close(sharedState.db);
+}
+
+static double sample(const char *mode, int shouldLookup) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        fail("Could not create pipe");
+    }
+
+    char start[64];
+    snprintf(start, sizeof(start), "%.9f", now());
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        fail("Could not fork");
+    } else if (pid == 0) {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+
+        setenv(MODE_ENV, mode, 1);
+        setenv(START_ENV, start, 1);
+        execl("/proc/self/exe", "startup", shouldLookup ? "--child-lookup" : "--child-idle", (char *)NULL);
+        fail("Could not exec");
+    }
+
+    close(fds[1]);
+
+    char output[64] = {0};
+    ssize_t length = read(fds[0], output, sizeof(output) - 1);
+    close(fds[0]);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    if (length <= 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "Child failed\n");
+        exit(1);
+    }
+
+    return strtod(output, NULL);
+}
+
+static int compareDoubles(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void runBenchmark(const Config *config, const char *mode, int shouldLookup) {
+    double *samples = malloc(sizeof(double) * (size_t)config->samples);
+
+    for (int i = 0; i < config->samples; i++) {
+        samples[i] = sample(mode, shouldLookup);
+    }
+
+    qsort(samples, (size_t)config->samples, sizeof(double), compareDoubles);
+
+    printf("%-6s %-7s p50 %8.1f us   p90 %8.1f us   min %8.1f us\n",
+           mode, shouldLookup ? "lookup" : "idle",
+           samples[config->samples / 2] * 1e6,
+           samples[config->samples * 9 / 10] * 1e6,
+           samples[0] * 1e6);
+
+    free(samples);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc == 2 && strcmp(argv[1], "--child-idle") == 0) {
+        return runChild(0);
+    } else if (argc == 2 && strcmp(argv[1], "--child-lookup") == 0) {
+        return runChild(1);
+    }
+
+    Config config = {.samples = 200, .numberOfEntries = 1000};
+    int option;
+
+    while ((option = getopt(argc, argv, "n:e:")) != -1) {
+        switch (option) {
+            case 'n': config.samples = atoi(optarg); break;
+            case 'e': config.numberOfEntries = atoi(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-n samples] [-e allowlist entries]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    if (config.samples < 1 || config.numberOfEntries < 1) {
+        fprintf(stderr, "Expected at least one sample and allowlist entry\n");
+        return 1;
+    }
+
+    char directory[] = "/tmp/rb-startup-XXXXXX";
+    if (mkdtemp(directory) == NULL) {
+        fail("Could not create temporary directory");
+    }
+
+    populate(directory, config.numberOfEntries);
+
+    // Warm up the page cache before sampling
+    sample("eager", 1);
+
+    runBenchmark(&config, "eager", 0);
+    runBenchmark(&config, "lazy", 0);
+    runBenchmark(&config, "eager", 1);
+    runBenchmark(&config, "lazy", 1);
+
+    char command[128];
+    snprintf(command, sizeof(command), "rm -rf %s", directory);
+    if (system(command) != 0) {
+        fprintf(stderr, "Could not remove %s\n", directory);
+    }
+
+    return 0;
+}
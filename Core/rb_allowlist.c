@@ -0,0 +1,316 @@
+//
+//  rb_allowlist.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#include "rb_allowlist.h"
+#include "idna.h"
+
+#include <strings.h>
+
+/* Same as -[RBDatabase allowlistEntryEnumeratorForGroup:domain:sortOrder:] with RBAllowlistEntrySortOrderDomain */
+#define ENTRY_QUERY \
+  "WITH _group AS (" \
+  "  SELECT DISTINCT exception_domain " \
+  "  FROM exception_group " \
+  "  WHERE $1 IS NULL OR name = $1 OR name = '*' " \
+  ") " \
+  "SELECT domain, enabled " \
+  "FROM exception, _group " \
+  "WHERE domain = _group.exception_domain " \
+  "ORDER BY root_domain(exception.domain), length(exception.domain), exception.domain"
+
+#define RULE_PREFIX "{\"action\":{\"type\":\"ignore-previous-rules\"},\"trigger\":{"
+
+typedef struct {
+  size_t offset, length;
+  int enabled;
+} entry;
+
+typedef struct {
+  rb_rule_callback callback;
+  void *context;
+  size_t group_size;
+  int stopped, no_memory;
+
+  idna_batch batch;
+
+  /* Entries which share a root domain, with their domains back to back */
+  entry *entries;
+  size_t number_of_entries, entries_capacity;
+  rb_buffer domains;
+
+  /* Rule for enabled entries which is still being filled */
+  rb_buffer uniform_rule;
+  size_t number_of_uniform_domains;
+
+  rb_buffer rule;
+} generator;
+
+/*** Serialization ***/
+
+/* Appends the contents of a JSON string, without quotes. */
+
+static int append_json_characters(rb_buffer *buffer, const char *string, size_t length)
+{
+  static const char hex[] = "0123456789abcdef";
+  size_t i, start = 0;
+
+  for (i = 0; i < length; i++) {
+    unsigned char c = (unsigned char)string[i];
+    char escaped[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf]};
+    size_t escaped_length = 6;
+
+    if (c == '"' || c == '\\') {
+      escaped[1] = (char)c;
+      escaped_length = 2;
+    } else if (c >= 0x20) {
+      continue;
+    }
+
+    if (!rb_buffer_append(buffer, string + start, i - start) || !rb_buffer_append(buffer, escaped, escaped_length)) return 0;
+    start = i + 1;
+  }
+
+  return rb_buffer_append(buffer, string + start, length - start);
+}
+
+static int append_json_string(rb_buffer *buffer, const char *string, size_t length)
+{
+  return rb_buffer_append(buffer, "\"", 1) && append_json_characters(buffer, string, length) && rb_buffer_append(buffer, "\"", 1);
+}
+
+/* Same as +[NSRegularExpression escapedPatternForString:] */
+
+static int append_escaped_pattern(rb_buffer *buffer, const char *string, size_t length)
+{
+  size_t i;
+
+  for (i = 0; i < length; i++) {
+    if (strchr("\\*?+[(){}^$|./", string[i]) != NULL && !rb_buffer_append(buffer, "\\", 1)) return 0;
+    if (!rb_buffer_append(buffer, string + i, 1)) return 0;
+  }
+
+  return 1;
+}
+
+/* Encodes a domain, falling back to the domain itself if it can't be (like -[NSString idnaEncodedString]). */
+
+static const char *encode_domain(generator *gen, const char *domain, size_t length, size_t *encoded_length)
+{
+  idna_batch_reset(&gen->batch);
+
+  if (idna_batch_append(&gen->batch, domain, length) != idna_success) {
+    *encoded_length = length;
+    return domain;
+  }
+
+  return idna_batch_domain(&gen->batch, 0, encoded_length);
+}
+
+/*** Rules ***/
+
+static void emit_rule(generator *gen, rb_buffer *rule)
+{
+  if (gen->callback(gen->context, rule->bytes, rule->length)) gen->stopped = 1;
+  rule->length = 0;
+}
+
+static int append_uniform_domain(generator *gen, const char *domain, size_t length)
+{
+  rb_buffer *rule = &gen->uniform_rule;
+  const char *encoded;
+  size_t encoded_length;
+
+  if (gen->number_of_uniform_domains == 0) {
+    if (!rb_buffer_append_string(rule, RULE_PREFIX "\"url-filter\":\".*\",\"if-domain\":[")) return 0;
+  } else if (!rb_buffer_append(rule, ",", 1)) {
+    return 0;
+  }
+
+  encoded = encode_domain(gen, domain, length, &encoded_length);
+  if (!rb_buffer_append(rule, "\"*", 2) || !append_json_characters(rule, encoded, encoded_length) || !rb_buffer_append(rule, "\"", 1)) {
+    return 0;
+  }
+
+  gen->number_of_uniform_domains++;
+  return 1;
+}
+
+static int flush_uniform_rule(generator *gen)
+{
+  if (gen->number_of_uniform_domains == 0) return 1;
+  if (!rb_buffer_append_string(&gen->uniform_rule, "]}}")) return 0;
+
+  gen->number_of_uniform_domains = 0;
+  emit_rule(gen, &gen->uniform_rule);
+  return 1;
+}
+
+static int entries_are_disjointed(generator *gen)
+{
+  const entry *first = &gen->entries[0];
+  const char *encoded, *root;
+  size_t i, encoded_length, root_length;
+
+  if (!first->enabled) return 0;
+
+  encoded = encode_domain(gen, gen->domains.bytes + first->offset, first->length, &encoded_length);
+  root = rb_root_domain(encoded, encoded_length, &root_length);
+  if (root != encoded) return 0;
+
+  for (i = 1; i < gen->number_of_entries; i++) {
+    if (!gen->entries[i].enabled) return 1;
+  }
+
+  return 0;
+}
+
+static int write_disjointed_rule(generator *gen)
+{
+  const entry *first = &gen->entries[0];
+  const char *root, *encoded;
+  size_t i, root_length, encoded_length, number_of_domains = 0;
+  rb_buffer *rule = &gen->rule;
+  rb_buffer filter;
+  int success;
+
+  rb_buffer_init(&filter);
+
+  root = rb_root_domain(gen->domains.bytes + first->offset, first->length, &root_length);
+  encoded = encode_domain(gen, root, root_length, &encoded_length);
+
+  success = rb_buffer_append_string(&filter, "^[htpsw]+:\\/\\/([a-z0-9-]+\\.)*") &&
+            append_escaped_pattern(&filter, encoded, encoded_length) &&
+            rb_buffer_append_string(&filter, "[/:&?]?") &&
+            rb_buffer_append_string(rule, RULE_PREFIX "\"url-filter\":") &&
+            append_json_string(rule, filter.bytes, filter.length) &&
+            rb_buffer_append_string(rule, ",\"unless-domain\":[");
+
+  for (i = 0; i < gen->number_of_entries && success; i++) {
+    const entry *disabled = &gen->entries[i];
+    if (disabled->enabled) continue;
+
+    encoded = encode_domain(gen, gen->domains.bytes + disabled->offset, disabled->length, &encoded_length);
+    success = (number_of_domains++ == 0 || rb_buffer_append(rule, ",", 1)) && append_json_string(rule, encoded, encoded_length);
+  }
+
+  rb_buffer_destroy(&filter);
+  if (!success || !rb_buffer_append_string(rule, "]}}")) return 0;
+
+  emit_rule(gen, rule);
+  return 1;
+}
+
+static int flush_entries(generator *gen)
+{
+  size_t i;
+
+  if (gen->number_of_entries == 0) return 1;
+
+  if (entries_are_disjointed(gen)) {
+    if (!write_disjointed_rule(gen)) return 0;
+  } else {
+    for (i = 0; i < gen->number_of_entries && !gen->stopped; i++) {
+      const entry *enabled = &gen->entries[i];
+      if (!enabled->enabled) continue;
+
+      if (!append_uniform_domain(gen, gen->domains.bytes + enabled->offset, enabled->length)) return 0;
+      if (gen->number_of_uniform_domains >= gen->group_size && !flush_uniform_rule(gen)) return 0;
+    }
+  }
+
+  gen->number_of_entries = 0;
+  gen->domains.length = 0;
+  return 1;
+}
+
+static int add_entry(generator *gen, const char *domain, size_t length, int enabled)
+{
+  entry *added;
+
+  if (gen->number_of_entries == gen->entries_capacity) {
+    size_t capacity = gen->entries_capacity ? gen->entries_capacity * 2 : 16;
+    entry *entries = realloc(gen->entries, capacity * sizeof(entry));
+
+    if (entries == NULL) return 0;
+
+    gen->entries = entries;
+    gen->entries_capacity = capacity;
+  }
+
+  added = &gen->entries[gen->number_of_entries];
+  added->offset = gen->domains.length;
+  added->length = length;
+  added->enabled = enabled;
+
+  if (!rb_buffer_append(&gen->domains, domain, length)) return 0;
+
+  gen->number_of_entries++;
+  return 1;
+}
+
+/* Entries are grouped with those before them when they share a root domain (ignoring case) */
+
+static int shares_root_domain(const generator *gen, const char *domain, size_t length)
+{
+  const entry *first = &gen->entries[0];
+  const char *root, *other_root;
+  size_t root_length, other_root_length;
+
+  root = rb_root_domain(gen->domains.bytes + first->offset, first->length, &root_length);
+  other_root = rb_root_domain(domain, length, &other_root_length);
+
+  return root_length == other_root_length && strncasecmp(root, other_root, root_length) == 0;
+}
+
+int rb_allowlist_enumerate_rules(sqlite3 *db, const char *group, size_t group_size, rb_rule_callback callback, void *context)
+{
+  const char *values[1] = {group};
+  sqlite3_stmt *stmt = NULL;
+  generator gen;
+  int status;
+
+  status = rb_sqlite_prepare(db, &stmt, ENTRY_QUERY, 1, values);
+  if (status != SQLITE_OK) return status;
+
+  memset(&gen, 0, sizeof(gen));
+  gen.callback = callback;
+  gen.context = context;
+  gen.group_size = group_size > 0 ? group_size : RB_ALLOWLIST_GROUP_SIZE;
+  idna_batch_init(&gen.batch);
+
+  while (!gen.stopped && !gen.no_memory && (status = sqlite3_step(stmt)) == SQLITE_ROW) {
+    const char *domain = (const char *)sqlite3_column_text(stmt, 0);
+    size_t length = (size_t)sqlite3_column_bytes(stmt, 0);
+
+    if (domain == NULL || length == 0) continue;
+
+    if (gen.number_of_entries > 0 && !shares_root_domain(&gen, domain, length) && !flush_entries(&gen)) {
+      gen.no_memory = 1;
+    } else if (!gen.stopped && !add_entry(&gen, domain, length, sqlite3_column_int(stmt, 1) != 0)) {
+      gen.no_memory = 1;
+    }
+  }
+
+  if (status == SQLITE_DONE) status = SQLITE_OK;
+  if (status == SQLITE_ROW) status = SQLITE_OK; /* stopped early */
+
+  if (status == SQLITE_OK && !gen.stopped && !gen.no_memory && (!flush_entries(&gen) || (!gen.stopped && !flush_uniform_rule(&gen)))) {
+    gen.no_memory = 1;
+  }
+
+  if (gen.no_memory) status = SQLITE_NOMEM;
+
+  sqlite3_finalize(stmt);
+  idna_batch_destroy(&gen.batch);
+  free(gen.entries);
+  rb_buffer_destroy(&gen.domains);
+  rb_buffer_destroy(&gen.uniform_rule);
+  rb_buffer_destroy(&gen.rule);
+
+  return status;
+}
@@ -0,0 +1,33 @@
+//
+//  rb_allowlist.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+// Allowlist rules without Foundation, mirroring RBContentBlocker. Entries are read from an RBDatabase file and grouped
+// by root domain:
+//
+// - Groups whose root domain is allowlisted but some of its subdomains aren't ("disjointed") get a rule of their own,
+//   which ignores previous rules for the root domain unless the page is on one of the disabled subdomains.
+// - Other enabled entries are packed into rules of up to `group_size` domains, which ignore previous rules for the
+//   domains and their subdomains.
+//
+// Domains are IDNA encoded (see idna.h) and rules are serialized as JSON, ready to be appended to a rule file.
+
+#ifndef rb_allowlist_h
+#define rb_allowlist_h
+
+#include <stddef.h>
+
+#include "rb_filter_builder.h"
+#include "rb_sqlite.h"
+
+#define RB_ALLOWLIST_GROUP_SIZE 200
+
+/* Passes each rule for the filter group (or every group, if NULL) to the callback, which returns nonzero to stop
+   without taking the rule. Returns SQLITE_OK, or the status of the query which failed. */
+int rb_allowlist_enumerate_rules(sqlite3 *db, const char *group, size_t group_size, rb_rule_callback callback, void *context);
+
+#endif /* rb_allowlist_h */
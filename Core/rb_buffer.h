@@ -0,0 +1,66 @@
+//
+//  rb_buffer.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+// Growable byte buffer used while building rules. Appending returns 0 when the buffer couldn't be grown, in which
+// case its contents are left unchanged.
+
+#ifndef rb_buffer_h
+#define rb_buffer_h
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct rb_buffer {
+  char *bytes;
+  size_t length, capacity;
+} rb_buffer;
+
+static inline void rb_buffer_init(rb_buffer *buffer)
+{
+  memset(buffer, 0, sizeof(*buffer));
+}
+
+static inline void rb_buffer_destroy(rb_buffer *buffer)
+{
+  free(buffer->bytes);
+  memset(buffer, 0, sizeof(*buffer));
+}
+
+static inline int rb_buffer_reserve(rb_buffer *buffer, size_t length)
+{
+  size_t capacity = buffer->capacity ? buffer->capacity : 256;
+  char *bytes;
+
+  if (buffer->capacity - buffer->length >= length) return 1;
+
+  while (capacity - buffer->length < length) capacity *= 2;
+
+  bytes = realloc(buffer->bytes, capacity);
+  if (bytes == NULL) return 0;
+
+  buffer->bytes = bytes;
+  buffer->capacity = capacity;
+  return 1;
+}
+
+static inline int rb_buffer_append(rb_buffer *buffer, const void *bytes, size_t length)
+{
+  if (length == 0) return 1;
+  if (!rb_buffer_reserve(buffer, length)) return 0;
+
+  memcpy(buffer->bytes + buffer->length, bytes, length);
+  buffer->length += length;
+  return 1;
+}
+
+static inline int rb_buffer_append_string(rb_buffer *buffer, const char *string)
+{
+  return rb_buffer_append(buffer, string, strlen(string));
+}
+
+#endif /* rb_buffer_h */
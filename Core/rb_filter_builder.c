@@ -0,0 +1,410 @@
+//
+//  rb_filter_builder.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#define _FILE_OFFSET_BITS 64
+
+#include "rb_filter_builder.h"
+#include "rb_zip.h"
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <zlib.h>
+
+static enum rb_rules_status status_for_zip_status(int status)
+{
+  switch (status) {
+  case Z_OK:
+    return rb_rules_success;
+  case Z_MEM_ERROR:
+    return rb_rules_no_memory;
+  case Z_ERRNO:
+    return rb_rules_io_error;
+  default:
+    return rb_rules_corrupt;
+  }
+}
+
+/*** Enumerating ***/
+
+void rb_rule_splitter_init(rb_rule_splitter *splitter)
+{
+  memset(splitter, 0, sizeof(*splitter));
+  rb_buffer_init(&splitter->rule);
+}
+
+void rb_rule_splitter_destroy(rb_rule_splitter *splitter)
+{
+  rb_buffer_destroy(&splitter->rule);
+}
+
+static void emit_rule(rb_rule_splitter *splitter, rb_rule_callback callback, void *context)
+{
+  const char *bytes = splitter->rule.bytes;
+  size_t start = 0, end = splitter->rule.length;
+
+  while (start < end && isspace((unsigned char)bytes[start])) start++;
+  while (end > start && isspace((unsigned char)bytes[end - 1])) end--;
+
+  /* Empty arrays (and trailing commas) don't have a rule */
+  if (end > start && callback(context, bytes + start, end - start)) splitter->stopped = 1;
+
+  splitter->rule.length = 0;
+}
+
+int rb_rule_splitter_feed(rb_rule_splitter *splitter, const uint8_t *bytes, size_t length, rb_rule_callback callback, void *context)
+{
+  size_t i, rule_start = 0;
+
+  for (i = 0; i < length && !splitter->stopped && !splitter->corrupt; i++) {
+    uint8_t c = bytes[i];
+
+    if (splitter->in_string) {
+      if (splitter->escaped) {
+        splitter->escaped = 0;
+      } else if (c == '\\') {
+        splitter->escaped = 1;
+      } else if (c == '"') {
+        splitter->in_string = 0;
+      }
+      continue;
+    }
+
+    if (splitter->depth == 0) {
+      if (c == '[' && !splitter->closed) {
+        splitter->depth = 1;
+        rule_start = i + 1;
+      } else if (!isspace(c)) {
+        splitter->corrupt = 1;
+      }
+      continue;
+    }
+
+    if (c == '"') {
+      splitter->in_string = 1;
+    } else if (c == '[' || c == '{') {
+      splitter->depth++;
+    } else if (c == ']' || c == '}') {
+      splitter->depth--;
+    }
+
+    if (splitter->depth == 0 || (splitter->depth == 1 && c == ',')) {
+      if (!rb_buffer_append(&splitter->rule, bytes + rule_start, i - rule_start)) {
+        splitter->no_memory = splitter->corrupt = 1;
+        break;
+      }
+
+      emit_rule(splitter, callback, context);
+
+      rule_start = i + 1;
+      splitter->closed = (splitter->depth == 0);
+    }
+  }
+
+  /* Rules which span chunks are buffered until they end */
+  if (splitter->depth > 0 && rule_start < length && !splitter->stopped && !splitter->corrupt) {
+    if (!rb_buffer_append(&splitter->rule, bytes + rule_start, length - rule_start)) {
+      splitter->no_memory = splitter->corrupt = 1;
+    }
+  }
+
+  return !splitter->stopped && !splitter->corrupt;
+}
+
+enum rb_rules_status rb_rule_splitter_finish(const rb_rule_splitter *splitter)
+{
+  if (splitter->no_memory) return rb_rules_no_memory;
+  if (!splitter->stopped && (splitter->corrupt || !splitter->closed)) return rb_rules_corrupt;
+  return rb_rules_success;
+}
+
+typedef struct {
+  rb_rule_splitter splitter;
+  rb_rule_callback callback;
+  void *context;
+} enumerate_context;
+
+static int enumerate_output(void *context, const uint8_t *bytes, size_t length)
+{
+  enumerate_context *enumeration = context;
+  return rb_rule_splitter_feed(&enumeration->splitter, bytes, length, enumeration->callback, enumeration->context) ? Z_OK : Z_STREAM_END;
+}
+
+enum rb_rules_status rb_enumerate_rules(const char *path, rb_rule_callback callback, void *context)
+{
+  enumerate_context enumeration;
+  enum rb_rules_status status;
+
+  rb_rule_splitter_init(&enumeration.splitter);
+  enumeration.callback = callback;
+  enumeration.context = context;
+
+  status = status_for_zip_status(rb_zip_enumerate_file(path, enumerate_output, &enumeration));
+  if (status == rb_rules_success) status = rb_rule_splitter_finish(&enumeration.splitter);
+
+  rb_rule_splitter_destroy(&enumeration.splitter);
+  return status;
+}
+
+/*** Building ***/
+
+static int write_bytes(rb_filter_builder *builder, const void *bytes, size_t length)
+{
+  return length == 0 || fwrite(bytes, 1, length, builder->file) == length;
+}
+
+/* Returns the character at the offset, or EOF. */
+
+static int character_at_offset(FILE *file, off_t offset)
+{
+  if (fseeko(file, offset, SEEK_SET) != 0) return EOF;
+  return fgetc(file);
+}
+
+enum rb_rules_status rb_filter_builder_open(rb_filter_builder *builder, const char *path)
+{
+  off_t length, first, last, previous;
+  int c;
+
+  memset(builder, 0, sizeof(*builder));
+
+  builder->file = fopen(path, "r+b");
+  if (builder->file == NULL) return rb_rules_io_error;
+
+  if (fseeko(builder->file, 0, SEEK_END) != 0 || (length = ftello(builder->file)) < 0) goto io_error;
+
+  if (length == 0) {
+    if (!write_bytes(builder, "[]", 2)) goto io_error;
+    return rb_rules_success;
+  }
+
+  /* Make sure the file represents an array */
+  for (first = 0; first < length && isspace(c = character_at_offset(builder->file, first)); first++);
+  if (first == length || c != '[') goto corrupt;
+
+  for (last = length - 1; last > first && isspace(c = character_at_offset(builder->file, last)); last--);
+  if (last == first || c != ']') goto corrupt;
+
+  for (previous = last - 1; previous > first && isspace(c = character_at_offset(builder->file, previous)); previous--);
+  builder->needs_comma = (previous != first);
+
+  /* Appending always starts at the closing bracket, so it has to be the last character */
+  if (last + 1 < length) {
+    if (fflush(builder->file) != 0 || ftruncate(fileno(builder->file), last + 1) != 0) goto io_error;
+  }
+
+  return rb_rules_success;
+
+io_error:
+  fclose(builder->file);
+  builder->file = NULL;
+  return rb_rules_io_error;
+
+corrupt:
+  fclose(builder->file);
+  builder->file = NULL;
+  return rb_rules_corrupt;
+}
+
+static int is_compressed_file(const char *path)
+{
+  uint8_t header[2];
+  size_t length;
+  FILE *file = fopen(path, "rb");
+
+  if (file == NULL) return 0;
+
+  length = fread(header, 1, sizeof(header), file);
+  fclose(file);
+
+  return rb_zip_is_compressed(header, length);
+}
+
+static enum rb_rules_status copy_file(const char *source_path, const char *destination_path)
+{
+  char *buffer = malloc(RB_ZIP_BUFFER_SIZE);
+  int source, destination;
+  ssize_t n;
+  int saved_errno;
+
+  if (buffer == NULL) return rb_rules_no_memory;
+
+  source = open(source_path, O_RDONLY);
+  destination = (source < 0) ? -1 : open(destination_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+  while (destination >= 0 && (n = read(source, buffer, RB_ZIP_BUFFER_SIZE)) > 0) {
+    if (write(destination, buffer, (size_t)n) != n) {
+      n = -1;
+      break;
+    }
+  }
+
+  saved_errno = errno;
+  free(buffer);
+  if (source >= 0) close(source);
+  if (destination >= 0 && close(destination) != 0) n = -1;
+  errno = saved_errno;
+
+  return (destination < 0 || n < 0) ? rb_rules_io_error : rb_rules_success;
+}
+
+enum rb_rules_status rb_filter_builder_create(rb_filter_builder *builder, const char *path, const char *const paths[], size_t count)
+{
+  enum rb_rules_status status;
+  size_t i = 0;
+
+  memset(builder, 0, sizeof(*builder));
+
+  /* Copy the first file to edit it in-place; compressed files need to be appended */
+  if (count > 0 && !is_compressed_file(paths[0])) {
+    status = copy_file(paths[0], path);
+    i = 1;
+  } else {
+    FILE *file = fopen(path, "wb");
+    status = (file != NULL && fclose(file) == 0) ? rb_rules_success : rb_rules_io_error;
+  }
+
+  if (status == rb_rules_success) status = rb_filter_builder_open(builder, path);
+
+  for (; i < count && status == rb_rules_success; i++) {
+    status = rb_filter_builder_append_file(builder, paths[i]);
+  }
+
+  if (status != rb_rules_success && builder->file != NULL) {
+    fclose(builder->file);
+    builder->file = NULL;
+  }
+
+  return status;
+}
+
+/* Appending overwrites the closing bracket */
+
+static int begin_appending(rb_filter_builder *builder)
+{
+  return fseeko(builder->file, -1, SEEK_END) == 0;
+}
+
+enum rb_rules_status rb_filter_builder_append_rule(rb_filter_builder *builder, const char *rule, size_t length)
+{
+  if (!begin_appending(builder)) return rb_rules_io_error;
+  if (builder->needs_comma && !write_bytes(builder, ",", 1)) return rb_rules_io_error;
+  if (!write_bytes(builder, rule, length) || !write_bytes(builder, "]", 1)) return rb_rules_io_error;
+
+  builder->needs_comma = 1;
+  builder->number_of_rules++;
+  return rb_rules_success;
+}
+
+typedef struct {
+  rb_filter_builder *builder;
+  enum { splice_leading, splice_opened, splice_writing, splice_empty } state;
+
+  /* Whitespace is held back until something follows it, so the output never ends with any */
+  rb_buffer whitespace;
+  char last_character;
+
+  enum rb_rules_status status;
+} splice_context;
+
+static int splice_output(void *context, const uint8_t *bytes, size_t length)
+{
+  splice_context *splice = context;
+  size_t i = 0, last;
+
+  if (splice->state == splice_leading) {
+    while (i < length && isspace(bytes[i])) i++;
+    if (i == length) return Z_OK;
+
+    if (bytes[i] != '[') {
+      splice->status = rb_rules_corrupt;
+      return Z_STREAM_END;
+    }
+
+    splice->state = splice_opened;
+    i++;
+  }
+
+  if (splice->state == splice_opened) {
+    while (i < length && isspace(bytes[i])) i++;
+    if (i == length) return Z_OK;
+
+    /* Empty arrays don't need a comma */
+    if (bytes[i] == ']') {
+      splice->state = splice_empty;
+      return Z_STREAM_END;
+    }
+
+    if (splice->builder->needs_comma && !write_bytes(splice->builder, ",", 1)) return Z_ERRNO;
+    splice->builder->needs_comma = 0;
+    splice->state = splice_writing;
+  }
+
+  for (last = length; last > i && isspace(bytes[last - 1]); last--);
+
+  if (last == i) {
+    if (!rb_buffer_append(&splice->whitespace, bytes + i, length - i)) return Z_MEM_ERROR;
+    return Z_OK;
+  }
+
+  if (!write_bytes(splice->builder, splice->whitespace.bytes, splice->whitespace.length) ||
+      !write_bytes(splice->builder, bytes + i, last - i)) {
+    return Z_ERRNO;
+  }
+
+  splice->whitespace.length = 0;
+  splice->last_character = (char)bytes[last - 1];
+
+  if (!rb_buffer_append(&splice->whitespace, bytes + last, length - last)) return Z_MEM_ERROR;
+  return Z_OK;
+}
+
+enum rb_rules_status rb_filter_builder_append_file(rb_filter_builder *builder, const char *path)
+{
+  splice_context splice;
+  enum rb_rules_status status;
+
+  if (!begin_appending(builder)) return rb_rules_io_error;
+
+  memset(&splice, 0, sizeof(splice));
+  splice.builder = builder;
+  rb_buffer_init(&splice.whitespace);
+
+  status = status_for_zip_status(rb_zip_enumerate_file(path, splice_output, &splice));
+  if (status == rb_rules_success) status = splice.status;
+  if (status == rb_rules_success && splice.state == splice_opened) status = rb_rules_corrupt;
+
+  rb_buffer_destroy(&splice.whitespace);
+
+  if (splice.state == splice_writing) {
+    builder->needs_comma = 1;
+
+    /* Truncated files (or failures) still leave an array behind */
+    if (splice.last_character != ']' && !write_bytes(builder, "]", 1) && status == rb_rules_success) {
+      status = rb_rules_io_error;
+    }
+  }
+
+  return status;
+}
+
+enum rb_rules_status rb_filter_builder_flush(rb_filter_builder *builder)
+{
+  if (fflush(builder->file) != 0 || fsync(fileno(builder->file)) != 0) return rb_rules_io_error;
+  return rb_rules_success;
+}
+
+enum rb_rules_status rb_filter_builder_close(rb_filter_builder *builder)
+{
+  int status = fclose(builder->file);
+
+  builder->file = NULL;
+  return status == 0 ? rb_rules_success : rb_rules_io_error;
+}
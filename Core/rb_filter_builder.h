@@ -0,0 +1,80 @@
+//
+//  rb_filter_builder.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+// Content blocker rules without Foundation, mirroring RBFilterBuilder: rule files (which may be compressed) are spliced
+// into one JSON array without parsing them, and rules are streamed out of a file one at a time.
+//
+// Splicing never rewrites what's already in the output: the closing bracket is overwritten by the next rules, so
+// building a group costs about as much as copying its files.
+
+#ifndef rb_filter_builder_h
+#define rb_filter_builder_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "rb_buffer.h"
+
+enum rb_rules_status {
+  rb_rules_success,
+  rb_rules_io_error,  /* A file couldn't be read or written (see errno).  */
+  rb_rules_corrupt,   /* Input isn't a JSON array or can't be inflated.   */
+  rb_rules_no_memory
+};
+
+/* Receives the JSON of a rule, without surrounding whitespace. Returns nonzero to stop. */
+typedef int (*rb_rule_callback)(void *context, const char *rule, size_t length);
+
+/*** Enumerating ***/
+
+/* Splits a JSON array into rules on the commas of the outer array, ignoring those within strings and nested values.
+   Input can be fed in chunks of any size. */
+typedef struct rb_rule_splitter {
+  rb_buffer rule;
+  size_t depth;
+  int in_string, escaped, closed, stopped, corrupt, no_memory;
+} rb_rule_splitter;
+
+void rb_rule_splitter_init(rb_rule_splitter *splitter);
+void rb_rule_splitter_destroy(rb_rule_splitter *splitter);
+
+/* Returns 0 once the callback has stopped the splitter or the input turned out to be corrupt. */
+int rb_rule_splitter_feed(rb_rule_splitter *splitter, const uint8_t *bytes, size_t length, rb_rule_callback callback, void *context);
+
+/* Whether the input was a complete array (or the callback stopped before the end). */
+enum rb_rules_status rb_rule_splitter_finish(const rb_rule_splitter *splitter);
+
+/* Streams the rules of a (possibly compressed) JSON array file. */
+enum rb_rules_status rb_enumerate_rules(const char *path, rb_rule_callback callback, void *context);
+
+/*** Building ***/
+
+typedef struct rb_filter_builder {
+  FILE *file;
+  int needs_comma;
+  uint64_t number_of_rules;  /* Rules appended one at a time (spliced files aren't counted). */
+} rb_filter_builder;
+
+/* Opens an existing file for appending, which is either empty or a JSON array. */
+enum rb_rules_status rb_filter_builder_open(rb_filter_builder *builder, const char *path);
+
+/* Creates (or replaces) the file with the rules of the given files. The first file is copied when it isn't compressed,
+   which is cheaper than appending it. */
+enum rb_rules_status rb_filter_builder_create(rb_filter_builder *builder, const char *path, const char *const paths[], size_t count);
+
+/* Splices in the rules of a (possibly compressed) JSON array file. */
+enum rb_rules_status rb_filter_builder_append_file(rb_filter_builder *builder, const char *path);
+
+/* Appends a rule which is already serialized as JSON. */
+enum rb_rules_status rb_filter_builder_append_rule(rb_filter_builder *builder, const char *rule, size_t length);
+
+enum rb_rules_status rb_filter_builder_flush(rb_filter_builder *builder);
+enum rb_rules_status rb_filter_builder_close(rb_filter_builder *builder);
+
+#endif /* rb_filter_builder_h */
@@ -0,0 +1,182 @@
+//
+//  rb_sqlite.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#include "rb_sqlite.h"
+
+#include <string.h>
+#include <strings.h>
+
+#define RB_SQLITE_BUSY_TIMEOUT 1500
+
+/*** Functions ***/
+
+const char *rb_root_domain(const char *domain, size_t length, size_t *root_length)
+{
+  size_t i = length, dots = 0;
+
+  while (i > 0) {
+    if (domain[i - 1] == '.' && ++dots == 2) break;
+    i--;
+  }
+
+  *root_length = length - i;
+  return domain + i;
+}
+
+static void root_domain(sqlite3_context *ctx, int num_values, sqlite3_value **values)
+{
+  const char *input, *output;
+  size_t length;
+
+  (void)num_values;
+  if (sqlite3_value_type(values[0]) != SQLITE_TEXT) {
+    sqlite3_result_error(ctx, "root_domain(): wrong parameter type", -1);
+    return;
+  }
+
+  input = (const char *)sqlite3_value_text(values[0]);
+  output = rb_root_domain(input, (size_t)sqlite3_value_bytes(values[0]), &length);
+
+  sqlite3_result_text(ctx, output, (int)length, SQLITE_TRANSIENT);
+}
+
+static void in_domain(sqlite3_context *ctx, int num_values, sqlite3_value **values)
+{
+  size_t inner_length, outer_length;
+  const char *inner, *outer;
+
+  (void)num_values;
+  if (sqlite3_value_type(values[0]) != SQLITE_TEXT || sqlite3_value_type(values[1]) != SQLITE_TEXT) {
+    sqlite3_result_error(ctx, "in_domain(): wrong parameter type", -1);
+    return;
+  }
+
+  inner = (const char *)sqlite3_value_text(values[0]);
+  inner_length = (size_t)sqlite3_value_bytes(values[0]);
+  outer = (const char *)sqlite3_value_text(values[1]);
+  outer_length = (size_t)sqlite3_value_bytes(values[1]);
+
+  if (inner_length > outer_length) {
+    sqlite3_result_int(ctx, 0);
+    return;
+  }
+
+  sqlite3_result_int(ctx, strncasecmp(outer + outer_length - inner_length, inner, inner_length) == 0);
+}
+
+/*** Connections ***/
+
+int rb_sqlite_open(const char *path, int flags, sqlite3 **db)
+{
+  int status = sqlite3_open_v2(path, db, flags, NULL);
+
+  if (status == SQLITE_OK) status = sqlite3_busy_timeout(*db, RB_SQLITE_BUSY_TIMEOUT);
+  if (status == SQLITE_OK) status = sqlite3_create_function(*db, "root_domain", 1, SQLITE_UTF8, NULL, root_domain, NULL, NULL);
+  if (status == SQLITE_OK) status = sqlite3_create_function(*db, "in_domain", 2, SQLITE_UTF8, NULL, in_domain, NULL, NULL);
+
+  if (status != SQLITE_OK) {
+    sqlite3_close(*db);
+    *db = NULL;
+  }
+
+  return status;
+}
+
+int rb_sqlite_create_tables(sqlite3 *db)
+{
+  static const char *const statements[] = {
+    "PRAGMA journal_mode = 'WAL'",
+    "PRAGMA foreign_keys = on",
+    "CREATE TABLE IF NOT EXISTS exception ("
+    "  domain text PRIMARY KEY NOT NULL COLLATE NOCASE CHECK(length(domain) > 0),"
+    "  enabled boolean NOT NULL DEFAULT true,"
+    "  create_date date NOT NULL,"
+    "  modify_date date NOT NULL"
+    ")",
+    "CREATE TABLE IF NOT EXISTS exception_group ("
+    "  exception_domain text REFERENCES exception(domain) ON DELETE CASCADE,"
+    "  name text NOT NULL COLLATE NOCASE CHECK(length(name) > 0)"
+    ")",
+    "CREATE TABLE IF NOT EXISTS stat ("
+    "  date date NOT NULL,"
+    "  name text NOT NULL COLLATE NOCASE CHECK(length(name) > 0),"
+    "  value int NOT NULL DEFAULT 0,"
+    "  PRIMARY KEY (date, name)"
+    ")",
+    "CREATE TABLE IF NOT EXISTS exception_change ("
+    "  seq integer PRIMARY KEY AUTOINCREMENT,"
+    "  domain text NOT NULL COLLATE NOCASE,"
+    "  type int NOT NULL,"
+    "  date date NOT NULL"
+    ")",
+    "CREATE TABLE IF NOT EXISTS stat_sketch ("
+    "  date date NOT NULL,"
+    "  name text NOT NULL COLLATE NOCASE CHECK(length(name) > 0),"
+    "  sketch blob NOT NULL,"
+    "  PRIMARY KEY (date, name)"
+    ")",
+    "CREATE TABLE IF NOT EXISTS metadata ("
+    "  key text PRIMARY KEY NOT NULL,"
+    "  value"
+    ")",
+    /* Identifies this database (rather than its path), so copies of its data can tell when it was recreated */
+    "INSERT OR IGNORE INTO metadata (key, value) VALUES ('identifier', randomblob(16))",
+  };
+  size_t i;
+  int status = SQLITE_DONE;
+
+  for (i = 0; i < sizeof(statements) / sizeof(statements[0]) && status == SQLITE_DONE; i++) {
+    status = rb_sqlite_execute(db, statements[i], 0, NULL);
+    if (status == SQLITE_ROW) status = SQLITE_DONE; /* the pragmas' results are ignored */
+  }
+
+  return status;
+}
+
+int rb_sqlite_prepare(sqlite3 *db, sqlite3_stmt **stmt, const char *query, int count, const char *const values[])
+{
+  int i, status = sqlite3_prepare_v2(db, query, -1, stmt, NULL);
+
+  for (i = 0; i < count && status == SQLITE_OK; i++) {
+    status = (values[i] == NULL) ? sqlite3_bind_null(*stmt, i + 1) : sqlite3_bind_text(*stmt, i + 1, values[i], -1, SQLITE_TRANSIENT);
+  }
+
+  if (status != SQLITE_OK) {
+    sqlite3_finalize(*stmt);
+    *stmt = NULL;
+  }
+
+  return status;
+}
+
+int rb_sqlite_execute(sqlite3 *db, const char *query, int count, const char *const values[])
+{
+  sqlite3_stmt *stmt = NULL;
+  int status = rb_sqlite_prepare(db, &stmt, query, count, values);
+
+  if (status == SQLITE_OK) status = sqlite3_step(stmt);
+
+  sqlite3_finalize(stmt);
+  return status;
+}
+
+int rb_sqlite_transaction(sqlite3 *db, int (*block)(sqlite3 *db, void *context), void *context)
+{
+  int status = rb_sqlite_execute(db, "BEGIN TRANSACTION", 0, NULL);
+
+  if (status == SQLITE_DONE) status = block(db, context);
+
+  switch (status) {
+  case SQLITE_DONE:
+  case SQLITE_OK:
+    return rb_sqlite_execute(db, "COMMIT TRANSACTION", 0, NULL);
+  default:
+    rb_sqlite_execute(db, "ROLLBACK TRANSACTION", 0, NULL);
+    return status;
+  }
+}
@@ -0,0 +1,38 @@
+//
+//  rb_sqlite.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+// SQLite helpers without Foundation, mirroring RBSQLite and RBDatabase's connection setup. Statuses are SQLite's.
+
+#ifndef rb_sqlite_h
+#define rb_sqlite_h
+
+#include <sqlite3.h>
+#include <stddef.h>
+
+/* Opens a connection like RBDatabase does: with the same busy timeout, and root_domain() / in_domain() registered. */
+int rb_sqlite_open(const char *path, int flags, sqlite3 **db);
+
+/* Creates RBDatabase's tables if they don't exist yet, switching the database to WAL and enabling foreign keys on
+   the connection first. This is the one copy of the schema (RBDatabase, the tests and the benchmarks all use it).
+   Returns SQLITE_DONE on success. */
+int rb_sqlite_create_tables(sqlite3 *db);
+
+/* Prepares a statement, binding each of `count` strings to parameters 1, 2... (NULL strings are bound as NULL). */
+int rb_sqlite_prepare(sqlite3 *db, sqlite3_stmt **stmt, const char *query, int count, const char *const values[]);
+
+/* Prepares and steps a statement, returning the result of the step (SQLITE_DONE or SQLITE_ROW on success). */
+int rb_sqlite_execute(sqlite3 *db, const char *query, int count, const char *const values[]);
+
+/* Runs the block in a transaction, which is committed if it returns SQLITE_OK or SQLITE_DONE and reverted otherwise.
+   The block's status is returned when reverted, otherwise the result of the commit. */
+int rb_sqlite_transaction(sqlite3 *db, int (*block)(sqlite3 *db, void *context), void *context);
+
+/* The last two labels of a domain (or the domain itself), as used by root_domain(). */
+const char *rb_root_domain(const char *domain, size_t length, size_t *root_length);
+
+#endif /* rb_sqlite_h */
@@ -0,0 +1,340 @@
+//
+//  rb_zip.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#include "rb_zip.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/*** Detection ***/
+
+int rb_zip_is_compressed(const uint8_t *bytes, size_t length)
+{
+  if (length < 2) return 0;
+
+  /* gzip magic, or a zlib header for deflate (its check bits make it a multiple of 31) */
+  return (bytes[0] == 0x1f && bytes[1] == 0x8b) || ((bytes[0] & 0x0f) == Z_DEFLATED && ((bytes[0] << 8) | bytes[1]) % 31 == 0);
+}
+
+/*** Inflate ***/
+
+int rb_zip_inflate(const uint8_t *bytes, size_t length, rb_zip_output output, void *context)
+{
+  z_stream strm;
+  uint8_t *out;
+  size_t remaining = length;
+  int ret;
+
+  memset(&strm, 0, sizeof(strm));
+
+  /* Detect zlib / gzip headers */
+  ret = inflateInit2(&strm, MAX_WBITS + 32);
+  if (ret != Z_OK) return ret;
+
+  out = malloc(RB_ZIP_BUFFER_SIZE);
+  if (out == NULL) {
+    (void)inflateEnd(&strm);
+    return Z_MEM_ERROR;
+  }
+
+  strm.next_in = (Bytef *)bytes;
+
+  do {
+    size_t have;
+
+    if (strm.avail_in == 0) {
+      strm.avail_in = (uInt)MIN(remaining, UINT_MAX);
+      remaining -= strm.avail_in;
+    }
+
+    strm.next_out = out;
+    strm.avail_out = RB_ZIP_BUFFER_SIZE;
+    ret = inflate(&strm, Z_NO_FLUSH);
+
+    /* There's always room for output, so a buffer error means we ran out of input */
+    if (ret == Z_NEED_DICT || ret == Z_BUF_ERROR) ret = Z_DATA_ERROR;
+    if (ret != Z_OK && ret != Z_STREAM_END) break;
+
+    have = RB_ZIP_BUFFER_SIZE - strm.avail_out;
+    if (have > 0) {
+      int output_status = output(context, out, have);
+
+      if (output_status != Z_OK) {
+        ret = output_status;
+        break;
+      }
+    }
+
+    /* Keep going if another gzip member follows */
+    if (ret == Z_STREAM_END && strm.avail_in + remaining >= 2 && strm.next_in[0] == 0x1f && strm.next_in[1] == 0x8b) {
+      ret = inflateReset(&strm);
+    }
+  } while (ret == Z_OK);
+
+  free(out);
+  (void)inflateEnd(&strm);
+
+  return ret == Z_STREAM_END ? Z_OK : ret;
+}
+
+/*** Deflate ***/
+
+int rb_zip_deflate_block(const uint8_t *bytes, size_t length, size_t dictionary_length, int last,
+                         enum rb_zip_format format, rb_zip_block *block)
+{
+  z_stream strm;
+  size_t capacity;
+  int ret;
+
+  memset(&strm, 0, sizeof(strm));
+  block->bytes = NULL;
+  block->length = 0;
+  block->input_length = length;
+  block->check = (format == rb_zip_gzip) ? crc32(0, bytes, (uInt)length) : adler32(1, bytes, (uInt)length);
+
+  ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+  if (ret != Z_OK) return block->status = ret;
+
+  if (dictionary_length > 0 && (ret = deflateSetDictionary(&strm, bytes - dictionary_length, (uInt)dictionary_length)) != Z_OK) {
+    (void)deflateEnd(&strm);
+    return block->status = ret;
+  }
+
+  capacity = deflateBound(&strm, length) + 16; /* room for the sync marker */
+  block->bytes = malloc(capacity);
+
+  strm.next_in = (Bytef *)bytes;
+  strm.avail_in = (uInt)length;
+
+  do {
+    if (block->length == capacity) {
+      uint8_t *grown = realloc(block->bytes, capacity * 2);
+
+      if (grown == NULL) {
+        ret = Z_MEM_ERROR;
+        break;
+      }
+
+      block->bytes = grown;
+      capacity *= 2;
+    }
+
+    if (block->bytes == NULL) {
+      ret = Z_MEM_ERROR;
+      break;
+    }
+
+    strm.next_out = block->bytes + block->length;
+    strm.avail_out = (uInt)(capacity - block->length);
+    ret = deflate(&strm, last ? Z_FINISH : Z_SYNC_FLUSH);
+    block->length = capacity - strm.avail_out;
+  } while (ret == Z_OK && strm.avail_out == 0);
+
+  (void)deflateEnd(&strm);
+  return block->status = (ret == Z_OK || ret == Z_STREAM_END) ? Z_OK : ret;
+}
+
+typedef struct {
+  const uint8_t *bytes;
+  size_t length;
+  enum rb_zip_format format;
+  rb_zip_block *blocks;
+  size_t number_of_blocks, next_block;
+  pthread_mutex_t lock;
+} deflate_job;
+
+static void *deflate_worker(void *argument)
+{
+  deflate_job *job = argument;
+
+  for (;;) {
+    size_t i, offset;
+
+    pthread_mutex_lock(&job->lock);
+    i = job->next_block++;
+    pthread_mutex_unlock(&job->lock);
+
+    if (i >= job->number_of_blocks) return NULL;
+
+    offset = i * RB_ZIP_BLOCK_SIZE;
+    rb_zip_deflate_block(job->bytes + offset, MIN(RB_ZIP_BLOCK_SIZE, job->length - offset), MIN(offset, RB_ZIP_WINDOW_SIZE),
+                         i == job->number_of_blocks - 1, job->format, &job->blocks[i]);
+  }
+}
+
+int rb_zip_deflate(const uint8_t *bytes, size_t length, enum rb_zip_format format, unsigned threads,
+                   rb_zip_output output, void *context)
+{
+  deflate_job job;
+  pthread_t *workers;
+  unsigned long check = (format == rb_zip_gzip) ? crc32(0, NULL, 0) : adler32(0, NULL, 0);
+  unsigned i, number_of_workers = 0;
+  size_t j;
+  int status = Z_OK;
+
+  memset(&job, 0, sizeof(job));
+  job.bytes = bytes;
+  job.length = length;
+  job.format = format;
+  job.number_of_blocks = (length + RB_ZIP_BLOCK_SIZE - 1) / RB_ZIP_BLOCK_SIZE;
+  if (job.number_of_blocks == 0) job.number_of_blocks = 1;
+
+  if (threads == 0) {
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = processors > 0 ? (unsigned)processors : 1;
+  }
+  if (threads > job.number_of_blocks) threads = (unsigned)job.number_of_blocks;
+
+  job.blocks = calloc(job.number_of_blocks, sizeof(rb_zip_block));
+  workers = calloc(threads, sizeof(pthread_t));
+  if (job.blocks == NULL || workers == NULL) {
+    free(job.blocks);
+    free(workers);
+    return Z_MEM_ERROR;
+  }
+
+  /* Blocks don't depend on each other's output; the calling thread works through them too */
+  pthread_mutex_init(&job.lock, NULL);
+  for (i = 1; i < threads; i++) {
+    if (pthread_create(&workers[number_of_workers], NULL, deflate_worker, &job) == 0) number_of_workers++;
+  }
+  deflate_worker(&job);
+  for (i = 0; i < number_of_workers; i++) pthread_join(workers[i], NULL);
+  pthread_mutex_destroy(&job.lock);
+  free(workers);
+
+  if (format == rb_zip_gzip) {
+    static const uint8_t header[10] = {0x1f, 0x8b, Z_DEFLATED, 0, 0, 0, 0, 0, 0, 3};
+    status = output(context, header, sizeof(header));
+  } else {
+    static const uint8_t header[2] = {0x78, 0x9c}; /* 32K window, default compression */
+    status = output(context, header, sizeof(header));
+  }
+
+  for (j = 0; j < job.number_of_blocks; j++) {
+    if (status == Z_OK && (status = job.blocks[j].status) == Z_OK) {
+      status = output(context, job.blocks[j].bytes, job.blocks[j].length);
+
+      if (format == rb_zip_gzip) {
+        check = crc32_combine(check, job.blocks[j].check, (z_off_t)job.blocks[j].input_length);
+      } else {
+        check = adler32_combine(check, job.blocks[j].check, (z_off_t)job.blocks[j].input_length);
+      }
+    }
+
+    free(job.blocks[j].bytes);
+  }
+
+  free(job.blocks);
+  if (status != Z_OK) return status;
+
+  if (format == rb_zip_gzip) {
+    const uint8_t trailer[8] = {
+      (uint8_t)check, (uint8_t)(check >> 8), (uint8_t)(check >> 16), (uint8_t)(check >> 24),
+      (uint8_t)length, (uint8_t)(length >> 8), (uint8_t)(length >> 16), (uint8_t)(length >> 24)
+    };
+    return output(context, trailer, sizeof(trailer));
+  } else {
+    const uint8_t trailer[4] = {(uint8_t)(check >> 24), (uint8_t)(check >> 16), (uint8_t)(check >> 8), (uint8_t)check};
+    return output(context, trailer, sizeof(trailer));
+  }
+}
+
+/*** Files ***/
+
+static int enumerate_bytes(const uint8_t *bytes, size_t length, rb_zip_output output, void *context)
+{
+  size_t offset;
+
+  if (rb_zip_is_compressed(bytes, length)) return rb_zip_inflate(bytes, length, output, context);
+
+  for (offset = 0; offset < length; offset += RB_ZIP_BUFFER_SIZE) {
+    int status = output(context, bytes + offset, MIN(RB_ZIP_BUFFER_SIZE, length - offset));
+    if (status != Z_OK) return status == Z_STREAM_END ? Z_OK : status;
+  }
+
+  return Z_OK;
+}
+
+/* Fallback for files which can't be mapped (e.g. pipes) */
+
+static int enumerate_unmapped_file(int fd, rb_zip_output output, void *context)
+{
+  uint8_t *bytes = NULL;
+  size_t length = 0, capacity = 0;
+  ssize_t n;
+  int status;
+
+  do {
+    if (capacity - length < RB_ZIP_BUFFER_SIZE) {
+      uint8_t *grown = realloc(bytes, capacity + RB_ZIP_BUFFER_SIZE * 4);
+
+      if (grown == NULL) {
+        free(bytes);
+        return Z_MEM_ERROR;
+      }
+
+      bytes = grown;
+      capacity += RB_ZIP_BUFFER_SIZE * 4;
+    }
+
+    n = read(fd, bytes + length, capacity - length);
+    if (n > 0) length += (size_t)n;
+  } while (n > 0);
+
+  status = (n < 0) ? Z_ERRNO : enumerate_bytes(bytes, length, output, context);
+  free(bytes);
+
+  return status;
+}
+
+int rb_zip_enumerate_file(const char *path, rb_zip_output output, void *context)
+{
+  struct stat st;
+  void *map;
+  int fd, status;
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0) return Z_ERRNO;
+
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return Z_ERRNO;
+  } else if (!S_ISREG(st.st_mode)) {
+    status = enumerate_unmapped_file(fd, output, context);
+    close(fd);
+    return status;
+  } else if (st.st_size == 0) {
+    close(fd);
+    return Z_OK;
+  }
+
+  map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (map == MAP_FAILED) {
+    status = enumerate_unmapped_file(fd, output, context);
+    close(fd);
+    return status;
+  }
+
+  close(fd);
+  madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+  status = enumerate_bytes(map, (size_t)st.st_size, output, context);
+  munmap(map, (size_t)st.st_size);
+
+  return status;
+}
@@ -0,0 +1,62 @@
+//
+//  rb_zip.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+// zlib / gzip streams without Foundation, shared by RBZip and the headless rule compiler. Statuses are zlib's (Z_OK,
+// Z_DATA_ERROR, ...), plus Z_ERRNO when a file can't be read or output can't be written.
+//
+// Input is deflated in independent blocks, each primed with the window preceding it, so blocks can be compressed in
+// parallel and stitched into one stream with little loss of ratio.
+
+#ifndef rb_zip_h
+#define rb_zip_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define RB_ZIP_BLOCK_SIZE (128 * 1024)
+#define RB_ZIP_WINDOW_SIZE 32768
+#define RB_ZIP_BUFFER_SIZE (256 * 1024)
+
+enum rb_zip_format {
+  rb_zip_zlib,
+  rb_zip_gzip
+};
+
+/* Receives output as it's produced. Returns Z_OK to keep going, Z_STREAM_END to stop early or an error. */
+typedef int (*rb_zip_output)(void *context, const uint8_t *bytes, size_t length);
+
+typedef struct rb_zip_block {
+  uint8_t *bytes;         /* Raw deflate data, which the caller frees.  */
+  size_t length;
+  size_t input_length;
+  unsigned long check;    /* crc32 or adler32 of the block's input.     */
+  int status;
+} rb_zip_block;
+
+/* Whether the bytes start with a gzip or zlib header. */
+int rb_zip_is_compressed(const uint8_t *bytes, size_t length);
+
+/* Inflates zlib or gzip data (including concatenated gzip members) in chunks of up to RB_ZIP_BUFFER_SIZE. */
+int rb_zip_inflate(const uint8_t *bytes, size_t length, rb_zip_output output, void *context);
+
+/* Deflates a block as raw data (without header or trailer), using the `dictionary_length` bytes which precede it as
+   the dictionary. All but the last block end on a byte boundary, so the blocks can be concatenated into a single
+   stream. */
+int rb_zip_deflate_block(const uint8_t *bytes, size_t length, size_t dictionary_length, int last,
+                         enum rb_zip_format format, rb_zip_block *block);
+
+/* Deflates data as a complete zlib or gzip stream, compressing blocks on up to `threads` threads (0 for one per
+   processor). */
+int rb_zip_deflate(const uint8_t *bytes, size_t length, enum rb_zip_format format, unsigned threads,
+                   rb_zip_output output, void *context);
+
+/* Reads a file which may or may not be compressed (it's memory-mapped where possible), passing its inflated contents
+   to `output`. */
+int rb_zip_enumerate_file(const char *path, rb_zip_output output, void *context);
+
+#endif /* rb_zip_h */
@@ -0,0 +1,20 @@
+//
+//  RBAllowlistChange-Private.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import "RBAllowlistChange.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface RBAllowlistChange()
+@property(nonatomic,setter=_setSequenceNumber:) int64_t sequenceNumber;
+@property(nonatomic,setter=_setType:) RBAllowlistChangeType type;
+@property(nonatomic,setter=_setDomain:) NSString *domain;
+@property(nonatomic,setter=_setDate:) NSDate *date;
+@end
+
+NS_ASSUME_NONNULL_END
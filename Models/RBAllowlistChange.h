@@ -0,0 +1,27 @@
+//
+//  RBAllowlistChange.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(short, RBAllowlistChangeType) {
+    RBAllowlistChangeTypeAdd = 1,
+    RBAllowlistChangeTypeUpdate = 2,
+    RBAllowlistChangeTypeRemove = 3
+};
+
+NS_SWIFT_NAME(RBAllowlistChange)
+@interface RBAllowlistChange : NSObject
+@property(nonatomic,readonly) int64_t sequenceNumber;
+@property(nonatomic,readonly) RBAllowlistChangeType type;
+@property(nonatomic,readonly) NSString *domain;
+@property(nonatomic,readonly) NSDate *date;
+@end
+
+NS_ASSUME_NONNULL_END
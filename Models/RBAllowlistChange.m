@@ -0,0 +1,17 @@
+//
+//  RBAllowlistChange.m
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import "RBAllowlistChange-Private.h"
+
+@implementation RBAllowlistChange
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"%lld %d %@", _sequenceNumber, _type, _domain];
+}
+
+@end
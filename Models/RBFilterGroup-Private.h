@@ -10,12 +10,45 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// The filters which belong to a group, compiled from its settings. Filters are matched by group, language and
+/// selector, which lets them be bucketed once and looked up for every group (see RBFilterGroupIndex).
+@interface _RBFilterGroupMembership : NSObject
+- (instancetype)initWithGroup:(nullable NSString *)group languages:(NSSet<NSString*> *)languages selectors:(nullable NSSet<NSString*> *)selectors;
+
+@property(nonatomic,readonly,nullable) NSString *group; // nil matches any group
+@property(nonatomic,readonly) NSSet<NSString*> *languages;
+@property(nonatomic,readonly,nullable) NSSet<NSString*> *selectors; // nil matches any selector
+
+- (BOOL)containsFilterWithGroup:(NSString *)group language:(NSString *)language selector:(NSString *)selector;
+@end
+
+
+/// Buckets filters by (group, language, selector) in a single pass, so reducing them for a group only needs to look at
+/// the matching buckets. Results are cached for as long as the group's membership is unchanged.
+@interface RBFilterGroupIndex : NSObject
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Indexes of immutable arrays are attached to the array and shared for its lifetime (without retaining it).
++ (instancetype)indexForFilters:(NSArray<RBFilter*> *)filters;
+
+@property(nonatomic,readonly) NSArray<RBFilter*> *filters;
+
+/// Filters which belong to the group, in their original order.
+- (NSArray<RBFilter*> *)filtersForGroup:(RBFilterGroup *)group;
+@end
+
+
 @interface RBFilterGroup()
 - (instancetype)_initWithFileURL:(NSURL *)fileURL NS_DESIGNATED_INITIALIZER;
 
 - (void)_reloadWithPropertyList:(NSDictionary<NSString *,id> *)plist;
+
+/// Used for CloudKit queries; local filters are matched using the group's membership.
 @property(nonatomic,readonly) NSPredicate *_filterPredicate;
 
+/// Compiled lazily and discarded whenever the group's settings change.
+@property(nonatomic,readonly) _RBFilterGroupMembership *_membership;
+
 @property(nonatomic,nullable,setter=_setLastBuildDate:) NSDate *lastBuildDate;
 @property(nonatomic,nullable,setter=_setLastModificationDate:) NSDate *lastModificationDate;
 @property(nonatomic,setter=_setNumberOfRules:) NSUInteger numberOfRules;
@@ -6,12 +6,16 @@
 //  Copyright © 2019 Young Dynasty. All rights reserved.
 //
 
+#import <objc/runtime.h>
+
 #import "RBFilterGroup.h"
 #import "RBFilterGroup-Private.h"
 #import "RBUtils.h"
 #import "RBFilter.h"
 
-@implementation RBFilterGroup
+@implementation RBFilterGroup {
+    _RBFilterGroupMembership *_membership;
+}
 
 - (instancetype)_initWithFileURL:(NSURL *)fileURL {
     self = [super init];
@@ -50,6 +54,26 @@
     return nil;
 }
 
+- (_RBFilterGroupMembership *)_compileMembership {
+    [NSException raise:NSInternalInconsistencyException format:@"%@ must be overridden by subclasses", NSStringFromSelector(_cmd)];
+    return nil;
+}
+
+- (_RBFilterGroupMembership *)_membership {
+    @synchronized (self) {
+        if (_membership == nil) {
+            _membership = [self _compileMembership];
+        }
+        return _membership;
+    }
+}
+
+- (void)_invalidateMembership {
+    @synchronized (self) {
+        _membership = nil;
+    }
+}
+
 - (BOOL)isEqualToGroup:(RBFilterGroup *)other {
     NSDate *placeholderDate = [NSDate date];
     
@@ -69,7 +93,7 @@
 }
 
 - (NSArray<RBFilter*>*)reduceFilters:(NSArray<RBFilter*>*)rules {
-    return [rules filteredArrayUsingPredicate:self._filterPredicate];
+    return [[RBFilterGroupIndex indexForFilters:rules] filtersForGroup:self];
 }
 
 @end
@@ -81,6 +105,10 @@
     return [NSPredicate predicateWithFormat:@"group = 'ads' AND language = ''"];
 }
 
+- (_RBFilterGroupMembership *)_compileMembership {
+    return [[_RBFilterGroupMembership alloc] initWithGroup:@"ads" languages:[NSSet setWithObject:@""] selectors:nil];
+}
+
 @end
 
 
@@ -135,6 +163,15 @@
     return [NSPredicate predicateWithFormat:@"%@ CONTAINS language", languageCodes];
 }
 
+- (void)setLanguageCodes:(NSArray *)languageCodes {
+    _languageCodes = [languageCodes copy];
+    [self _invalidateMembership];
+}
+
+- (_RBFilterGroupMembership *)_compileMembership {
+    return [[_RBFilterGroupMembership alloc] initWithGroup:nil languages:[NSSet setWithArray:_languageCodes ?: @[]] selectors:nil];
+}
+
 - (BOOL)isEqualToGroup:(RBRegionalFilterGroup *)other {
     return [super isEqualToGroup:other] && [_languageCodes ?: @[] isEqualToArray:other.languageCodes ?: @[]];
 }
@@ -171,6 +208,16 @@
     return [NSPredicate predicateWithFormat:@"group = 'privacy' AND language = '' AND selector IN %@", selectors];
 }
 
+- (void)setSocialMediaFilterEnabled:(BOOL)socialMediaFilterEnabled {
+    _socialMediaFilterEnabled = socialMediaFilterEnabled;
+    [self _invalidateMembership];
+}
+
+- (_RBFilterGroupMembership *)_compileMembership {
+    NSSet *selectors = _socialMediaFilterEnabled ? [NSSet setWithObjects:@"", @"social", nil] : [NSSet setWithObject:@""];
+    return [[_RBFilterGroupMembership alloc] initWithGroup:@"privacy" languages:[NSSet setWithObject:@""] selectors:selectors];
+}
+
 - (BOOL)isEqualToGroup:(RBPrivacyFilterGroup *)other {
     return [super isEqualToGroup:other]
         && _socialMediaFilterEnabled == other.isSocialMediaFilterEnabled
@@ -209,6 +256,16 @@
     return [NSPredicate predicateWithFormat:@"group = 'annoyance' AND language = '' AND selector IN %@", selectors];
 }
 
+- (void)setCookiesFilterEnabled:(BOOL)cookiesFilterEnabled {
+    _cookiesFilterEnabled = cookiesFilterEnabled;
+    [self _invalidateMembership];
+}
+
+- (_RBFilterGroupMembership *)_compileMembership {
+    NSSet *selectors = _cookiesFilterEnabled ? [NSSet setWithObjects:@"", @"cookies", nil] : [NSSet setWithObject:@""];
+    return [[_RBFilterGroupMembership alloc] initWithGroup:@"annoyance" languages:[NSSet setWithObject:@""] selectors:selectors];
+}
+
 - (BOOL)isEqualToGroup:(RBAnnoyanceFilterGroup *)other {
     return [super isEqualToGroup:other]
         && _cookiesFilterEnabled == other.isCookiesFilterEnabled
@@ -219,6 +276,147 @@
 
 #pragma mark -
 
+@implementation _RBFilterGroupMembership
+
+- (instancetype)initWithGroup:(NSString *)group languages:(NSSet<NSString *> *)languages selectors:(NSSet<NSString *> *)selectors {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    _group = [group copy];
+    _languages = [languages copy];
+    _selectors = [selectors copy];
+    
+    return self;
+}
+
+- (BOOL)containsFilterWithGroup:(NSString *)group language:(NSString *)language selector:(NSString *)selector {
+    return (_group == nil || [_group isEqualToString:group])
+        && [_languages containsObject:language]
+        && (_selectors == nil || [_selectors containsObject:selector])
+    ;
+}
+
+- (BOOL)isEqual:(id)object {
+    if (![object isKindOfClass:[_RBFilterGroupMembership class]]) {
+        return NO;
+    }
+    
+    _RBFilterGroupMembership *other = object;
+    
+    return (_group == other.group || [_group isEqualToString:other.group])
+        && [_languages isEqualToSet:other.languages]
+        && (_selectors == other.selectors || [_selectors isEqualToSet:other.selectors])
+    ;
+}
+
+- (NSUInteger)hash {
+    return _group.hash ^ _languages.hash ^ _selectors.hash;
+}
+
+@end
+
+
+@implementation RBFilterGroupIndex {
+    // Shared indexes are attached to their array, so they can't retain it
+    NSArray<RBFilter*> *_ownedFilters;
+    __weak NSArray<RBFilter*> *_attachedFilters;
+    
+    NSArray<NSArray<NSString*>*> *_bucketKeys; // (group, language, selector)
+    NSArray<NSIndexSet*> *_buckets;
+    NSMapTable<_RBFilterGroupMembership*, NSArray<RBFilter*>*> *_cache;
+}
+
++ (instancetype)indexForFilters:(NSArray<RBFilter *> *)filters {
+    // Mutable arrays can change underneath us, so they're indexed every time
+    if ([filters isKindOfClass:[NSMutableArray class]]) {
+        return [[self alloc] _initWithFilters:[filters copy] attached:NO];
+    }
+    
+    @synchronized (self) {
+        RBFilterGroupIndex *index = objc_getAssociatedObject(filters, _cmd);
+        if (index == nil) {
+            index = [[self alloc] _initWithFilters:filters attached:YES];
+            objc_setAssociatedObject(filters, _cmd, index, OBJC_ASSOCIATION_RETAIN);
+        }
+        return index;
+    }
+}
+
+- (instancetype)_initWithFilters:(NSArray<RBFilter *> *)filters attached:(BOOL)attached {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    if (attached) {
+        _attachedFilters = filters;
+    } else {
+        _ownedFilters = filters;
+    }
+    
+    _cache = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+    
+    NSMutableDictionary<NSString*, NSMutableIndexSet*> *bucketsByKey = [NSMutableDictionary dictionary];
+    NSMutableArray *bucketKeys = [NSMutableArray array];
+    NSMutableArray *buckets = [NSMutableArray array];
+    
+    [filters enumerateObjectsUsingBlock:^(RBFilter *filter, NSUInteger idx, BOOL *stop) {
+        NSString *key = [NSString stringWithFormat:@"%@\x1f%@\x1f%@", filter.group, filter.language, filter.selector];
+        NSMutableIndexSet *bucket = bucketsByKey[key];
+        
+        if (bucket == nil) {
+            bucket = bucketsByKey[key] = [NSMutableIndexSet indexSet];
+            [bucketKeys addObject:@[filter.group, filter.language, filter.selector]];
+            [buckets addObject:bucket];
+        }
+        
+        [bucket addIndex:idx];
+    }];
+    
+    _bucketKeys = [bucketKeys copy];
+    _buckets = [buckets copy];
+    
+    return self;
+}
+
+- (NSArray<RBFilter *> *)filters {
+    return _ownedFilters ?: _attachedFilters ?: @[];
+}
+
+- (NSArray<RBFilter *> *)filtersForGroup:(RBFilterGroup *)group {
+    _RBFilterGroupMembership *membership = group._membership;
+    
+    @synchronized (self) {
+        NSArray *filters = [_cache objectForKey:membership];
+        if (filters != nil) {
+            return filters;
+        }
+    }
+    
+    NSMutableIndexSet *indexes = [NSMutableIndexSet indexSet];
+    
+    for (NSUInteger i = 0; i < _bucketKeys.count; i++) {
+        NSArray<NSString*> *key = _bucketKeys[i];
+        
+        if ([membership containsFilterWithGroup:key[0] language:key[1] selector:key[2]]) {
+            [indexes addIndexes:_buckets[i]];
+        }
+    }
+    
+    // Index sets are ordered, so filters keep their original order
+    NSArray *filters = [self.filters objectsAtIndexes:indexes];
+    
+    @synchronized (self) {
+        [_cache setObject:filters forKey:membership];
+    }
+    
+    return filters;
+}
+
+@end
+
+#pragma mark -
+
 NSUInteger RBFilterGroupRulesCount(RBFilterGroupRules *rules) {
     NSUInteger numberOfRules = 0;
     for (RBFilter *filter in rules.allKeys) {
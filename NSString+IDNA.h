@@ -12,12 +12,17 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface NSString(IDNA)
 
+/// Encoded as per UTS #46 (nontransitional, without STD3 rules), so equivalent domains are encoded the same way.
 @property(nonatomic,readonly) NSString *idnaEncodedString;
 @property(nonatomic,readonly) NSString *idnaDecodedString;
 
 @property(nonatomic,readonly) NSString *punyEncodedString;
 @property(nonatomic,readonly) NSString *punyDecodedString;
 
+/// Equivalent to mapping `idnaEncodedString` over the strings, but ASCII domains are only checked and lowercased, and
+/// all of the strings are encoded into a single buffer.
++ (NSArray<NSString *> *)idnaEncodedStringsForStrings:(NSArray<NSString *> *)strings;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -8,6 +8,7 @@
 
 #import "NSString+IDNA.h"
 #import "punycode.h"
+#import "idna.h"
 
 
 #if BYTE_ORDER == LITTLE_ENDIAN
@@ -55,6 +56,12 @@
 }
 
 - (NSString *)idnaEncodedString {
+    return [NSString idnaEncodedStringsForStrings:@[self]].firstObject;
+}
+
+// Strings which UTS #46 disallows (or which aren't valid UTF-16) can't be hosts anyway, so compatibility mapping is
+// good enough for them
+- (NSString *)_fallbackIDNAEncodedString {
     NSRange atRange = [self rangeOfString:@"@"];
     if (atRange.location != NSNotFound) {
         NSString *address = [self substringToIndex:NSMaxRange(atRange)];
@@ -117,6 +124,62 @@
     }
 }
 
++ (NSArray<NSString *> *)idnaEncodedStringsForStrings:(NSArray<NSString *> *)strings {
+    NSMutableIndexSet *fallbackIndexes = [NSMutableIndexSet indexSet];
+    NSMutableData *utf8Data = [NSMutableData data];
+    NSUInteger idx = 0;
+    
+    idna_batch batch;
+    idna_batch_init(&batch);
+    
+    // Domains which can't be encoded leave the batch unchanged, so they're skipped when reading it back
+    for (NSString *string in strings) {
+        NSUInteger length = 0;
+        
+        if (!_RBGetUTF8Bytes(string, utf8Data, &length) || idna_batch_append(&batch, utf8Data.bytes, length) != idna_success) {
+            [fallbackIndexes addIndex:idx];
+        }
+        
+        idx++;
+    }
+    
+    NSMutableArray *encodedStrings = [NSMutableArray arrayWithCapacity:strings.count];
+    size_t batchIndex = 0;
+    idx = 0;
+    
+    for (NSString *string in strings) {
+        if ([fallbackIndexes containsIndex:idx++]) {
+            [encodedStrings addObject:[string _fallbackIDNAEncodedString]];
+        } else {
+            size_t encodedLength = 0;
+            const char *encodedBytes = idna_batch_domain(&batch, batchIndex++, &encodedLength);
+            [encodedStrings addObject:[[NSString alloc] initWithBytes:encodedBytes length:encodedLength encoding:NSUTF8StringEncoding]];
+        }
+    }
+    
+    idna_batch_destroy(&batch);
+    
+    return encodedStrings;
+}
+
+static BOOL _RBGetUTF8Bytes(NSString *string, NSMutableData *data, NSUInteger *outLength) {
+    NSUInteger maxLength = [string maximumLengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    if (data.length < maxLength) {
+        data.length = maxLength;
+    }
+    
+    if (string.length == 0) {
+        *outLength = 0;
+        return YES;
+    }
+    
+    // Unpaired surrogates can't be converted, which leaves part of the string behind
+    NSRange remainingRange = NSMakeRange(0, 0);
+    BOOL converted = [string getBytes:data.mutableBytes maxLength:maxLength usedLength:outLength encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, string.length) remainingRange:&remainingRange];
+    
+    return converted && remainingRange.length == 0;
+}
+
 - (NSString *)idnaDecodedString {
     NSRange atRange = [self rangeOfString:@"@"];
     if (atRange.location != NSNotFound) {
@@ -0,0 +1,43 @@
+//
+//  RBAllowlistSnapshot.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class RBAllowlistEntry;
+@class RBDatabase;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// An in-memory, read-optimized copy of the allowlist for lookups which can't afford a trip to the database queue.
+/// Lookups are synchronous and thread-safe. Most domains aren't allowlisted, so negative lookups are answered by a
+/// Bloom filter without allocating. The snapshot is patched from the database's change log whenever
+/// \c RBDatabaseDidAdvanceChangeSequenceNotification is posted.
+@interface RBAllowlistSnapshot : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithDatabase:(RBDatabase *)database NS_DESIGNATED_INITIALIZER;
+
+@property(nonatomic,readonly) RBDatabase *database;
+
+@property(nonatomic,readonly,getter=isLoaded) BOOL loaded;
+@property(nonatomic,readonly) int64_t sequenceNumber;
+@property(nonatomic,readonly) NSUInteger count;
+
+/// Loads the snapshot (or applies changes since the last update) and invokes the completion handler once it reflects
+/// the database at the time of the call.
+- (void)updateWithCompletionHandler:(nullable void(^)(NSError *__nullable))completionHandler;
+
+/// Returns the entry for the domain (if any), as \c -[RBDatabase allowlistEntryForDomain:completionHandler:] would.
+- (nullable RBAllowlistEntry *)entryForDomain:(NSString *)domain;
+
+/// Returns the entry for the domain or its closest parent domain (i.e. "www.example.com" matches "example.com").
+- (nullable RBAllowlistEntry *)entryMatchingDomain:(NSString *)domain;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,473 @@
+//
+//  RBAllowlistSnapshot.m
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import "RBAllowlistSnapshot.h"
+#import "RBAllowlistChange.h"
+#import "RBAllowlistEntry.h"
+#import "RBDatabase.h"
+
+// Domains are limited to 253 characters; anything longer can't be in the allowlist
+#define RBAllowlistSnapshotMaxDomainLength 256
+#define RBAllowlistSnapshotMaxLabels (RBAllowlistSnapshotMaxDomainLength / 2 + 1)
+
+// The filter is sized for twice the number of entries at 16 bits per entry so that it can absorb additions between
+// rebuilds; with 4 probes this keeps the false positive rate well under 1%
+#define RBBloomBitsPerEntry 16
+#define RBBloomProbes 4
+#define RBBloomMinBits 1024
+
+// Patches with more changes than this (relative to the number of entries) trigger a full rebuild
+#define RBAllowlistSnapshotRebuildRatio 4
+
+
+#pragma mark - Hashing
+
+// Keys are hashed from right to left so that the hash of every parent domain is produced along the way
+#define RBBloomHashSeed 0xcbf29ce484222325ULL
+#define RBBloomHashPrime 0x100000001b3ULL
+
+static inline uint64_t _RBBloomHashFinalize(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static inline uint64_t _RBBloomHash(const unsigned char *bytes, size_t length) {
+    uint64_t h = RBBloomHashSeed;
+    for (size_t i = length; i > 0; i--) {
+        h = (h ^ bytes[i - 1]) * RBBloomHashPrime;
+    }
+    return _RBBloomHashFinalize(h);
+}
+
+static inline void _RBBloomInsert(uint64_t *bits, uint64_t mask, uint64_t hash) {
+    uint64_t h2 = (hash >> 32) | 1;
+    for (uint64_t i = 0; i < RBBloomProbes; i++) {
+        uint64_t bit = (hash + i * h2) & mask;
+        bits[bit >> 6] |= (1ULL << (bit & 63));
+    }
+}
+
+static inline BOOL _RBBloomContains(const uint64_t *bits, uint64_t mask, uint64_t hash) {
+    uint64_t h2 = (hash >> 32) | 1;
+    for (uint64_t i = 0; i < RBBloomProbes; i++) {
+        uint64_t bit = (hash + i * h2) & mask;
+        if ((bits[bit >> 6] & (1ULL << (bit & 63))) == 0) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+/// Copies the domain into the buffer, trimmed and lowercased (ASCII only, to match the database's NOCASE collation).
+/// Returns 0 if the domain is empty or too long to be allowlisted.
+static size_t _RBAllowlistSnapshotCopyKey(NSString *domain, unsigned char buf[RBAllowlistSnapshotMaxDomainLength]) {
+    size_t length = 0;
+    const char *cString = CFStringGetCStringPtr((__bridge CFStringRef)domain, kCFStringEncodingUTF8);
+    
+    if (cString != NULL) {
+        length = strlen(cString);
+        if (length > RBAllowlistSnapshotMaxDomainLength) {
+            return 0;
+        }
+        memcpy(buf, cString, length);
+    } else {
+        NSUInteger usedLength = 0;
+        NSRange remainingRange = NSMakeRange(0, 0);
+        
+        [domain getBytes:buf maxLength:RBAllowlistSnapshotMaxDomainLength usedLength:&usedLength encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, domain.length) remainingRange:&remainingRange];
+        
+        if (remainingRange.length > 0) {
+            return 0;
+        }
+        length = usedLength;
+    }
+    
+    size_t start = 0;
+    while (start < length && isspace(buf[start])) {
+        start++;
+    }
+    while (length > start && isspace(buf[length - 1])) {
+        length--;
+    }
+    
+    if (start > 0) {
+        memmove(buf, buf + start, length - start);
+        length -= start;
+    }
+    
+    for (size_t i = 0; i < length; i++) {
+        if (buf[i] >= 'A' && buf[i] <= 'Z') {
+            buf[i] |= 0x20;
+        }
+    }
+    
+    return length;
+}
+
+static NSString *_RBAllowlistSnapshotKey(NSString *domain) {
+    unsigned char buf[RBAllowlistSnapshotMaxDomainLength];
+    size_t length = _RBAllowlistSnapshotCopyKey(domain, buf);
+    return length == 0 ? nil : [[NSString alloc] initWithBytes:buf length:length encoding:NSUTF8StringEncoding];
+}
+
+
+#pragma mark - Storage
+
+/// Immutable; a new instance replaces the old one on every update so that readers never need to lock.
+@interface _RBAllowlistSnapshotStorage : NSObject {
+@public
+    int64_t _sequenceNumber;
+    NSDictionary<NSString*,RBAllowlistEntry*> *_entries;
+    uint64_t *_bits;
+    uint64_t _mask;
+    NSUInteger _capacity;
+    NSUInteger _staleCount;
+}
+
+- (instancetype)initWithEntries:(NSDictionary<NSString*,RBAllowlistEntry*> *)entries sequenceNumber:(int64_t)sequenceNumber;
+
+/// Returns nil if the changes can't be applied without rebuilding the filter.
+- (nullable instancetype)storageByApplyingEntries:(NSDictionary<NSString*,id> *)entries sequenceNumber:(int64_t)sequenceNumber;
+
+@end
+
+@implementation _RBAllowlistSnapshotStorage
+
+- (instancetype)initWithEntries:(NSDictionary<NSString*,RBAllowlistEntry*> *)entries sequenceNumber:(int64_t)sequenceNumber {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    uint64_t bitCount = RBBloomMinBits;
+    while (bitCount < (uint64_t)entries.count * 2 * RBBloomBitsPerEntry) {
+        bitCount <<= 1;
+    }
+    
+    _bits = calloc(bitCount / 64, sizeof(uint64_t));
+    if (_bits == NULL)
+        return nil;
+    
+    _mask = bitCount - 1;
+    _capacity = (NSUInteger)(bitCount / RBBloomBitsPerEntry);
+    _entries = [entries copy];
+    _sequenceNumber = sequenceNumber;
+    
+    for (NSString *key in _entries) {
+        const char *bytes = key.UTF8String;
+        _RBBloomInsert(_bits, _mask, _RBBloomHash((const unsigned char *)bytes, strlen(bytes)));
+    }
+    
+    return self;
+}
+
+- (void)dealloc {
+    free(_bits);
+}
+
+- (instancetype)storageByApplyingEntries:(NSDictionary<NSString*,id> *)changedEntries sequenceNumber:(int64_t)sequenceNumber {
+    NSMutableDictionary *entries = [_entries mutableCopy];
+    NSUInteger staleCount = _staleCount;
+    
+    for (NSString *key in changedEntries) {
+        RBAllowlistEntry *entry = changedEntries[key];
+        
+        if ([entry isKindOfClass:[RBAllowlistEntry class]]) {
+            entries[key] = entry;
+        } else if (entries[key] != nil) {
+            // Bits can't be cleared; stale keys only cost false positives until the next rebuild
+            [entries removeObjectForKey:key];
+            staleCount++;
+        }
+    }
+    
+    if (entries.count + staleCount > _capacity || staleCount * RBAllowlistSnapshotRebuildRatio > entries.count + 1) {
+        return nil;
+    }
+    
+    _RBAllowlistSnapshotStorage *storage = [_RBAllowlistSnapshotStorage new];
+    
+    storage->_bits = malloc((_mask + 1) / 8);
+    if (storage->_bits == NULL)
+        return nil;
+    
+    memcpy(storage->_bits, _bits, (_mask + 1) / 8);
+    storage->_mask = _mask;
+    storage->_capacity = _capacity;
+    storage->_staleCount = staleCount;
+    storage->_entries = [entries copy];
+    storage->_sequenceNumber = sequenceNumber;
+    
+    for (NSString *key in changedEntries) {
+        if ([changedEntries[key] isKindOfClass:[RBAllowlistEntry class]]) {
+            const char *bytes = key.UTF8String;
+            _RBBloomInsert(storage->_bits, storage->_mask, _RBBloomHash((const unsigned char *)bytes, strlen(bytes)));
+        }
+    }
+    
+    return storage;
+}
+
+@end
+
+
+#pragma mark -
+
+@interface RBAllowlistSnapshot()
+@property(atomic,strong,nullable) _RBAllowlistSnapshotStorage *_storage;
+@end
+
+@implementation RBAllowlistSnapshot {
+    dispatch_queue_t _q;
+    
+    // Only accessed from _q
+    BOOL _isUpdating;
+    BOOL _needsUpdate;
+    NSMutableArray *_pendingCompletionHandlers;
+}
+
+- (instancetype)initWithDatabase:(RBDatabase *)database {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    _database = database;
+    _q = dispatch_queue_create("net.youngdynasty.radblock.allowlist-snapshot", DISPATCH_QUEUE_SERIAL_WITH_AUTORELEASE_POOL);
+    _pendingCompletionHandlers = [NSMutableArray array];
+    
+    [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(_databaseDidAdvanceChangeSequence:) name:RBDatabaseDidAdvanceChangeSequenceNotification object:database];
+    
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (BOOL)isLoaded {
+    return self._storage != nil;
+}
+
+- (int64_t)sequenceNumber {
+    _RBAllowlistSnapshotStorage *storage = self._storage;
+    return storage != nil ? storage->_sequenceNumber : -1;
+}
+
+- (NSUInteger)count {
+    _RBAllowlistSnapshotStorage *storage = self._storage;
+    return storage != nil ? storage->_entries.count : 0;
+}
+
+#pragma mark - Lookups
+
+- (RBAllowlistEntry *)entryForDomain:(NSString *)domain {
+    _RBAllowlistSnapshotStorage *storage = self._storage;
+    if (storage == nil) {
+        return nil;
+    }
+    
+    unsigned char key[RBAllowlistSnapshotMaxDomainLength];
+    size_t length = _RBAllowlistSnapshotCopyKey(domain, key);
+    
+    if (length == 0 || !_RBBloomContains(storage->_bits, storage->_mask, _RBBloomHash(key, length))) {
+        return nil;
+    }
+    
+    return storage->_entries[[[NSString alloc] initWithBytes:key length:length encoding:NSUTF8StringEncoding]];
+}
+
+- (RBAllowlistEntry *)entryMatchingDomain:(NSString *)domain {
+    _RBAllowlistSnapshotStorage *storage = self._storage;
+    if (storage == nil) {
+        return nil;
+    }
+    
+    unsigned char key[RBAllowlistSnapshotMaxDomainLength];
+    size_t length = _RBAllowlistSnapshotCopyKey(domain, key);
+    
+    if (length == 0) {
+        return nil;
+    }
+    
+    // Hash each parent domain in a single (right to left) pass
+    size_t offsets[RBAllowlistSnapshotMaxLabels];
+    uint64_t hashes[RBAllowlistSnapshotMaxLabels];
+    int numLabels = 0;
+    
+    uint64_t h = RBBloomHashSeed;
+    for (size_t i = length; i > 0; i--) {
+        h = (h ^ key[i - 1]) * RBBloomHashPrime;
+        
+        if ((i == 1 || key[i - 2] == '.') && key[i - 1] != '.') {
+            offsets[numLabels] = i - 1;
+            hashes[numLabels] = _RBBloomHashFinalize(h);
+            numLabels++;
+        }
+    }
+    
+    // Prefer the most specific match
+    for (int i = numLabels - 1; i >= 0; i--) {
+        if (!_RBBloomContains(storage->_bits, storage->_mask, hashes[i])) {
+            continue;
+        }
+        
+        NSString *candidate = [[NSString alloc] initWithBytes:key + offsets[i] length:length - offsets[i] encoding:NSUTF8StringEncoding];
+        RBAllowlistEntry *entry = storage->_entries[candidate];
+        
+        if (entry != nil) {
+            return entry;
+        }
+    }
+    
+    return nil;
+}
+
+#pragma mark - Updates
+
+- (void)_databaseDidAdvanceChangeSequence:(NSNotification *)note {
+    // Ignore changes until someone asks for the snapshot to be loaded
+    if (self._storage != nil) {
+        [self updateWithCompletionHandler:nil];
+    }
+}
+
+- (void)updateWithCompletionHandler:(void(^)(NSError *))completionHandler {
+    dispatch_async(_q, ^{
+        if (completionHandler != nil) {
+            [self->_pendingCompletionHandlers addObject:[completionHandler copy]];
+        }
+        
+        self->_needsUpdate = YES;
+        [self _updateIfNeeded];
+    });
+}
+
+- (void)_updateIfNeeded {
+    dispatch_assert_queue(_q);
+    
+    if (_isUpdating || !_needsUpdate) {
+        return;
+    }
+    
+    _isUpdating = YES;
+    _needsUpdate = NO;
+    
+    NSArray *completionHandlers = [_pendingCompletionHandlers copy];
+    [_pendingCompletionHandlers removeAllObjects];
+    
+    void (^finish)(_RBAllowlistSnapshotStorage *, NSError *) = ^(_RBAllowlistSnapshotStorage *storage, NSError *error) {
+        dispatch_async(self->_q, ^{
+            if (storage != nil) {
+                self._storage = storage;
+            } else {
+                NSLog(@"Warning: could not update allowlist snapshot: %@", error);
+            }
+            
+            for (void(^completionHandler)(NSError *) in completionHandlers) {
+                completionHandler(error);
+            }
+            
+            self->_isUpdating = NO;
+            [self _updateIfNeeded];
+        });
+    };
+    
+    _RBAllowlistSnapshotStorage *storage = self._storage;
+    
+    if (storage == nil) {
+        [self _loadStorageWithCompletionHandler:finish];
+    } else {
+        [self _patchStorage:storage completionHandler:finish];
+    }
+}
+
+- (void)_loadStorageWithCompletionHandler:(void(^)(_RBAllowlistSnapshotStorage *, NSError *))completionHandler {
+    RBDatabase *database = _database;
+    
+    // Read the sequence number first; anything which changes during enumeration is re-applied by the next patch
+    [database getAllowlistChangeSequenceNumberWithCompletionHandler:^(int64_t sequenceNumber, NSError *error) {
+        if (error != nil) {
+            return completionHandler(nil, error);
+        }
+        
+        [database allowlistEntryEnumeratorForGroup:nil domain:nil sortOrder:RBAllowlistEntrySortOrderCreateDate completionHandler:^(NSEnumerator<RBAllowlistEntry *> *enumerator, NSError *error) {
+            if (enumerator == nil) {
+                return completionHandler(nil, error);
+            }
+            
+            NSMutableDictionary *entries = [NSMutableDictionary dictionary];
+            
+            for (RBAllowlistEntry *entry in enumerator) {
+                NSString *key = _RBAllowlistSnapshotKey(entry.domain);
+                if (key != nil) {
+                    entries[key] = entry;
+                }
+            }
+            
+            completionHandler([[_RBAllowlistSnapshotStorage alloc] initWithEntries:entries sequenceNumber:sequenceNumber], nil);
+        }];
+    }];
+}
+
+- (void)_patchStorage:(_RBAllowlistSnapshotStorage *)storage completionHandler:(void(^)(_RBAllowlistSnapshotStorage *, NSError *))completionHandler {
+    RBDatabase *database = _database;
+    
+    [database allowlistChangesSinceSequenceNumber:storage->_sequenceNumber completionHandler:^(NSArray<RBAllowlistChange *> *changes, int64_t sequenceNumber, NSError *error) {
+        if (changes == nil && [error.domain isEqualToString:RBDatabaseErrorDomain] && error.code == RBDatabaseErrorChangesUnavailable) {
+            return [self _loadStorageWithCompletionHandler:completionHandler];
+        } else if (changes == nil) {
+            return completionHandler(nil, error);
+        } else if (sequenceNumber == storage->_sequenceNumber) {
+            return completionHandler(storage, nil);
+        }
+        
+        NSMutableSet<NSString *> *domains = [NSMutableSet set];
+        for (RBAllowlistChange *change in changes) {
+            [domains addObject:change.domain];
+        }
+        
+        // The log went backwards (i.e. the database was replaced) or too much has changed to be worth patching
+        if (sequenceNumber < storage->_sequenceNumber || domains.count * RBAllowlistSnapshotRebuildRatio > storage->_entries.count + 64) {
+            return [self _loadStorageWithCompletionHandler:completionHandler];
+        }
+        
+        // Changes only tell us which domains were touched; look up their current state
+        NSMutableDictionary *changedEntries = [NSMutableDictionary dictionary];
+        dispatch_group_t group = dispatch_group_create();
+        
+        for (NSString *domain in domains) {
+            NSString *key = _RBAllowlistSnapshotKey(domain);
+            if (key == nil) {
+                continue;
+            }
+            
+            dispatch_group_enter(group);
+            [database allowlistEntryForDomain:domain completionHandler:^(RBAllowlistEntry *entry, NSError *error) {
+                @synchronized (changedEntries) {
+                    changedEntries[key] = entry ?: [NSNull null];
+                }
+                dispatch_group_leave(group);
+            }];
+        }
+        
+        dispatch_group_notify(group, self->_q, ^{
+            _RBAllowlistSnapshotStorage *nextStorage = [storage storageByApplyingEntries:changedEntries sequenceNumber:sequenceNumber];
+            
+            if (nextStorage != nil) {
+                completionHandler(nextStorage, nil);
+            } else {
+                [self _loadStorageWithCompletionHandler:completionHandler];
+            }
+        });
+    }];
+}
+
+@end
@@ -16,6 +16,13 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property(nonatomic,nullable,readonly,copy) NSURLSessionConfiguration *_sessionConfiguration;
 
+/// Holds the last response and its validators (ETag / Last-Modified) for each fetched path, as well as the manifest
+/// each output directory was last synced against. A 304 for an unchanged manifest skips downloading entirely.
+@property(nonatomic,readonly) NSURL *_cacheDirectoryURL;
+
+/// Base delay before a failed download is retried; doubled (and jittered) with each attempt.
+@property(nonatomic,readonly) NSTimeInterval _downloadRetryInterval;
+
 - (NSProgress *)_performQuery:(CKQuery *)query completionHandler:(void (^)(NSArray<CKRecord *> * _Nullable, NSError * _Nullable))completionHandler;
 
 @end
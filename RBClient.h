@@ -22,8 +22,23 @@ NS_SWIFT_NAME(Client)
 
 @property(nonatomic,readonly) NSURL *url;
 
+/// Number of filters downloaded at once (largest lists are started first). Defaults to 4.
+@property(nonatomic) NSUInteger maximumConcurrentDownloads;
+
+/// Number of times a filter is requested before its download fails. Failed downloads are retried with exponential
+/// backoff; successful downloads are kept regardless. Defaults to 3.
+@property(nonatomic) NSUInteger maximumDownloadAttempts;
+
+/// Filter rules are deflated (zlib) as they're written to an output directory and inflated by RBFilterBuilder as groups
+/// are built. MD5 hashes always refer to the inflated rules. Defaults to NO.
+@property(nonatomic) BOOL compressesFilterRules;
+
 - (NSProgress *)fetchFilterRulesForGroup:(RBFilterGroup *)group outputDirectory:(NSURL *)outputDirectoryURL completionHandler:(void(^)(RBFilterGroupRules* __nullable, NSError* __nullable))completionHandler;
 
+/// Fetches the rules, deflating them (or not) regardless of compressesFilterRules. They're compressed in the same pass
+/// that writes and hashes them.
+- (NSProgress *)fetchFilterRulesForGroup:(RBFilterGroup *)group outputDirectory:(NSURL *)outputDirectoryURL compressed:(BOOL)compressed completionHandler:(void(^)(RBFilterGroupRules* __nullable, NSError* __nullable))completionHandler;
+
 @end
 
 NS_ASSUME_NONNULL_END
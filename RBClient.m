@@ -7,21 +7,76 @@
 //
 
 #import "RBClient-Private.h"
+#import "RBDelta.h"
 #import "RBDigest.h"
+#import "RBDigestCache.h"
+#import "RBFileWriter.h"
+#import "RBTrace.h"
+#import "RBZip.h"
 #import "RBUtils.h"
 #import "RBFilterGroup-Private.h"
-#import "RBZip.h"
 #import "RBCodeSignature.h"
 
 
-@interface RBClient()<NSURLSessionTaskDelegate>
+@interface RBClient()<NSURLSessionDataDelegate>
+@end
+
+
+/// A data task whose body is written (and hashed) as it arrives
+@interface _RBStreamingDownload : NSObject
+@property(nonatomic,copy) NSURL *fileURL;
+@property(nonatomic) RBFileWriterOptions writerOptions;
+@property(nonatomic) uint64_t resumeOffset;
+@property(nonatomic,nullable,copy) NSString *validator;
+@property(nonatomic,nullable) RBFileWriter *writer;
+@property(nonatomic,nullable) NSError *error;
+@property(nonatomic,copy) void (^completionHandler)(NSString *__nullable md5, NSString *__nullable validator, NSError *__nullable error);
+@end
+
+@implementation _RBStreamingDownload
+@end
+
+
+/// NSURLSession retains its delegate until it's invalidated, so the client is only referenced weakly
+@interface _RBSessionDelegate : NSObject<NSURLSessionDataDelegate>
+@property(nonatomic,weak) RBClient *client;
 @end
 
+@implementation _RBSessionDelegate
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveResponse:(NSURLResponse *)response completionHandler:(void (^)(NSURLSessionResponseDisposition))completionHandler {
+    RBClient *client = self.client;
+    if (client == nil) {
+        return completionHandler(NSURLSessionResponseCancel);
+    }
+
+    [client URLSession:session dataTask:dataTask didReceiveResponse:response completionHandler:completionHandler];
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data {
+    [self.client URLSession:session dataTask:dataTask didReceiveData:data];
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error {
+    [self.client URLSession:session task:task didCompleteWithError:error];
+}
+
+@end
+
+
+static NSString *const _RBHTTPStatusCodeErrorKey = @"RBHTTPStatusCode";
+
 
 @implementation RBClient {
     CKDatabase *_database;
     NSURLSession *_session;
     dispatch_queue_t _downloadQueue;
+
+    dispatch_queue_t _cacheQueue;
+    NSMutableDictionary *_cache;
+
+    NSMapTable<NSURLSessionTask*, _RBStreamingDownload*> *_streamingDownloads;
+    RBDigestCache *_digestCache;
 }
 
 + (instancetype)defaultClient {
@@ -39,18 +94,29 @@
         return nil;
 
     _cloudKitEnabled = NO;
+    _maximumConcurrentDownloads = 4;
+    _maximumDownloadAttempts = 3;
 
     NSString *apiUrlString = NSProcessInfo.processInfo.environment[@"RADBLOCK_API_URL"];
     _url = apiUrlString != nil ? [NSURL URLWithString:apiUrlString] : [NSURL URLWithString:@"https://radblock.beamapp.co"];
-    _session = [NSURLSession sessionWithConfiguration:self._sessionConfiguration ?: NSURLSessionConfiguration.ephemeralSessionConfiguration delegate:self delegateQueue:nil];
+
+    _RBSessionDelegate *sessionDelegate = [_RBSessionDelegate new];
+    sessionDelegate.client = self;
+    _session = [NSURLSession sessionWithConfiguration:self._sessionConfiguration ?: NSURLSessionConfiguration.ephemeralSessionConfiguration delegate:sessionDelegate delegateQueue:nil];
 
 //    [self setupCloudKit];
 
     _downloadQueue = dispatch_queue_create("net.youngdynasty.radblock.filter.download", DISPATCH_QUEUE_SERIAL_WITH_AUTORELEASE_POOL);
+    _cacheQueue = dispatch_queue_create("net.youngdynasty.radblock.client.cache", DISPATCH_QUEUE_SERIAL_WITH_AUTORELEASE_POOL);
+    _streamingDownloads = [NSMapTable strongToStrongObjectsMapTable];
 
     return self;
 }
 
+- (void)dealloc {
+    // Releases the session's delegate and queue along with it
+    [_session invalidateAndCancel];
+}
 
 - (void)setupCloudKit {
     _cloudKitEnabled = YES;
@@ -71,28 +137,48 @@
 #pragma mark -
 
 - (NSProgress *)fetchFilterRulesForGroup:(RBFilterGroup *)group outputDirectory:(NSURL *)outputDirectoryURL completionHandler:(void(^)(RBFilterGroupRules*, NSError *))completionHandler {
+    return [self fetchFilterRulesForGroup:group outputDirectory:outputDirectoryURL compressed:self.compressesFilterRules completionHandler:completionHandler];
+}
+
+- (NSProgress *)fetchFilterRulesForGroup:(RBFilterGroup *)group outputDirectory:(NSURL *)outputDirectoryURL compressed:(BOOL)compressed completionHandler:(void(^)(RBFilterGroupRules*, NSError *))completionHandler {
     NSProgress *progress = [NSProgress progressWithTotalUnitCount:30];
 
     if (self.isCloudKitEnabled) {
         CKQuery *query = [[CKQuery alloc] initWithRecordType:@"Filter" predicate:group._filterPredicate];
+        RBTraceSpan span = RBTraceBegin("query-records");
 
         [progress addChild:[self _performQuery:query completionHandler:^(NSArray<CKRecord *> *records, NSError *error) {
+            RBTraceEnd(span, (RBTraceMetrics){0});
+
             if (error != nil) {
                 completionHandler(nil, error);
             } else {
-                [progress addChild:[self _decompressRecords:records outputDirectory:outputDirectoryURL completionHandler:completionHandler] withPendingUnitCount:10];
+                [progress addChild:[self _decompressRecords:records outputDirectory:outputDirectoryURL compressed:compressed completionHandler:completionHandler] withPendingUnitCount:10];
             }
         }] withPendingUnitCount:20];
     } else {
-        // Assume our caching layer will be smart about this...
-        [progress addChild:[self _fetchFiltersWithCompletionHandler:^(NSArray<RBFilter *> *filters, NSError * _Nullable error) {
+        [progress addChild:[self _fetchFiltersWithCompletionHandler:^(NSArray<RBFilter *> *filters, NSString *manifestValidator, NSError * _Nullable error) {
             if (error != nil) {
                 completionHandler(nil, error);
-            } else {
-                [progress addChild:[self _downloadFilters:[group reduceFilters:filters]
-                                          outputDirectory:outputDirectoryURL
-                                        completionHandler:completionHandler] withPendingUnitCount:20];
+                return;
             }
+
+            NSArray *groupFilters = [group reduceFilters:filters];
+            RBFilterGroupRules *syncedRules = [self _syncedRulesForFilters:groupFilters manifestValidator:manifestValidator outputDirectory:outputDirectoryURL];
+
+            // The manifest hasn't changed since our last successful sync, so there's nothing to download (or hash)
+            if (syncedRules != nil) {
+                progress.completedUnitCount += 20;
+                completionHandler(syncedRules, nil);
+                return;
+            }
+
+            [progress addChild:[self _downloadFilters:groupFilters outputDirectory:outputDirectoryURL compressed:compressed completionHandler:^(RBFilterGroupRules *rules, NSError *downloadError) {
+                if (rules != nil) {
+                    [self _setSyncedRules:rules manifestValidator:manifestValidator outputDirectory:outputDirectoryURL];
+                }
+                completionHandler(rules, downloadError);
+            }] withPendingUnitCount:20];
         }] withPendingUnitCount:10];
     }
 
@@ -102,72 +188,117 @@
 
 #pragma mark - HTTP
 
-- (NSProgress *)_downloadFilters:(NSArray<RBFilter *> *)filters outputDirectory:(NSURL *)outputDirectoryURL completionHandler:(void(^)(RBFilterGroupRules*, NSError *))completionHandler {
+- (NSProgress *)_downloadFilters:(NSArray<RBFilter *> *)filters outputDirectory:(NSURL *)outputDirectoryURL compressed:(BOOL)compressed completionHandler:(void(^)(RBFilterGroupRules*, NSError *))completionHandler {
     NSProgress *progress = [NSProgress progressWithTotalUnitCount:filters.count + 1];
     dispatch_group_t downloadGroup = dispatch_group_create();
 
     __block NSMutableDictionary *results = [NSMutableDictionary dictionaryWithCapacity:filters.count];
     __block NSError *error = nil;
 
-    // Use MD5 hashes to determine which filters need downloaded
+    // Use MD5 hashes to determine which filters need downloaded (and which local versions we can patch). Files we wrote
+    // ourselves are usually unchanged, so their hashes come from the digest cache.
+    RBDigestCache *digestCache = [self _digestCache];
     NSMutableArray *outOfSyncFilters = [NSMutableArray arrayWithCapacity:filters.count];
+    NSMutableDictionary *baseHashes = [NSMutableDictionary dictionaryWithCapacity:filters.count];
+    RBTraceSpan digestSpan = RBTraceBegin("check-digests");
 
     for (RBFilter *filter in filters) {
         NSURL *destURL = [outputDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier];
-        NSString *md5 = [RBDigest MD5HashOfFileURL:destURL error:NULL];
+        NSString *md5 = [digestCache MD5HashOfFileURL:destURL error:NULL];
 
         if (md5 == nil || ![md5 isEqualToString:filter.md5]) {
             [outOfSyncFilters addObject:filter];
+            baseHashes[filter] = md5;
         } else {
             results[filter] = destURL;
             progress.totalUnitCount -= 1;
         }
     }
 
+    RBTraceEnd(digestSpan, (RBTraceMetrics){.cacheHits = results.count});
+
     // Use a temporary directory so we can work atomically (we may otherwise produce corrupt output if canceled/errored while running)
-    NSURL *tempDirectoryURL = nil;
+    NSURL *tempDirectoryURL = outOfSyncFilters.count > 0 ? RBCreateTemporaryDirectory(&error) : nil;
+    if (error != nil) {
+        [outOfSyncFilters removeAllObjects];
+    }
 
-    for (RBFilter *filter in outOfSyncFilters) {
-        tempDirectoryURL = tempDirectoryURL ?: RBCreateTemporaryDirectory(&error);
-        if (error != nil) {
-            break;
-        }
+    // Start the largest lists first so they don't end up as the tail of the sync
+    [outOfSyncFilters sortWithOptions:NSSortStable usingComparator:^NSComparisonResult(RBFilter *a, RBFilter *b) {
+        return a.numberOfRules == b.numberOfRules ? NSOrderedSame : (a.numberOfRules > b.numberOfRules ? NSOrderedAscending : NSOrderedDescending);
+    }];
 
-        NSURL *outputURL = [tempDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier];
+    NSUInteger maxConcurrentDownloads = MAX(1, self.maximumConcurrentDownloads);
+    __block NSUInteger numberOfDownloads = 0;
+    __block void (^startDownloads)(void) = nil;
 
-        dispatch_group_enter(downloadGroup);
-        [progress addChild:[self _downloadFilter:filter toURL:outputURL completionHandler:^(NSError *downloadError) {
-            if (downloadError == nil) {
-                results[filter] = outputURL;
-            } else if (progress.isCancelled) {
+    // All state is accessed on the download queue
+    startDownloads = ^{
+        while (numberOfDownloads < maxConcurrentDownloads && outOfSyncFilters.count > 0) {
+            RBFilter *filter = outOfSyncFilters.firstObject;
+            [outOfSyncFilters removeObjectAtIndex:0];
+
+            if (progress.isCancelled) {
                 error = [NSError errorWithDomain:CKErrorDomain code:CKErrorOperationCancelled userInfo:nil];
-            } else {
-                error = error ?: downloadError;
+                continue;
             }
 
-            dispatch_group_leave(downloadGroup);
-        }] withPendingUnitCount:1];
-    }
+            NSURL *outputURL = [tempDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier];
+            NSURL *baseURL = baseHashes[filter] != nil ? [outputDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier] : nil;
+
+            numberOfDownloads++;
+            dispatch_group_enter(downloadGroup);
+
+            [progress addChild:[self _downloadFilter:filter outputDirectory:outputDirectoryURL baseURL:baseURL baseMD5:baseHashes[filter] toURL:outputURL compressed:compressed completionHandler:^(NSError *downloadError) {
+                dispatch_async(self->_downloadQueue, ^{
+                    if (downloadError == nil) {
+                        results[filter] = outputURL;
+                    } else if (progress.isCancelled) {
+                        error = [NSError errorWithDomain:CKErrorDomain code:CKErrorOperationCancelled userInfo:nil];
+                    } else {
+                        error = error ?: downloadError;
+                    }
+
+                    numberOfDownloads--;
+                    startDownloads();
+
+                    dispatch_group_leave(downloadGroup);
+                });
+            }] withPendingUnitCount:1];
+        }
+    };
+
+    dispatch_group_async(downloadGroup, _downloadQueue, startDownloads);
 
     dispatch_group_notify(downloadGroup, self->_downloadQueue, ^{
         progress.completedUnitCount++;
+        startDownloads = nil;
 
-        // Move / normalize results
-        if (error == nil) {
-            NSMutableDictionary *normalizedResults = [results mutableCopy];
+        // Move / normalize results. Successful downloads are kept even if others failed, so the next sync only needs to
+        // fetch what's missing.
+        NSMutableDictionary *normalizedResults = [results mutableCopy];
+        RBTraceSpan moveSpan = RBTraceBegin("move-files");
 
-            for (RBFilter *filter in results) {
-                NSURL *outputURL = [outputDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier];
-                if ([results[filter] isEqual:outputURL]) {
-                    continue;
-                } else if (RBMoveFileURL(results[filter], outputURL, &error)) {
-                    normalizedResults[filter] = outputURL;
-                } else {
-                    break;
-                }
+        for (RBFilter *filter in results) {
+            NSURL *outputURL = [outputDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier];
+            NSError *moveError = nil;
+
+            if ([results[filter] isEqual:outputURL]) {
+                continue;
+            } else if (RBMoveFileURL(results[filter], outputURL, &moveError)) {
+                normalizedResults[filter] = outputURL;
+                [digestCache setMD5Hash:filter.md5 forFileURL:outputURL];
+            } else {
+                error = error ?: moveError;
             }
+        }
 
-            results = normalizedResults;
+        results = normalizedResults;
+        RBTraceEnd(moveSpan, (RBTraceMetrics){0});
+
+        NSError *digestCacheError = nil;
+        if (![digestCache synchronizeWithError:&digestCacheError]) {
+            NSLog(@"Warning: Could not write digest cache: %@", digestCacheError);
         }
 
         // Remove temporary directory
@@ -181,35 +312,153 @@
     return progress;
 }
 
-- (NSProgress *)_downloadFilter:(RBFilter *)filter toURL:(NSURL *)destURL completionHandler:(void (^)(NSError *))completionHandler {
-    return [self _downloadJSONDataAtPath:[@"/filter/" stringByAppendingString:filter.uniqueIdentifier] completionHandler:^(NSURL *tempURL, NSError *error) {
+- (NSProgress *)_downloadFilter:(RBFilter *)filter outputDirectory:(NSURL *)outputDirectoryURL baseURL:(NSURL *)baseURL baseMD5:(NSString *)baseMD5 toURL:(NSURL *)destURL compressed:(BOOL)compressed completionHandler:(void (^)(NSError *))completionHandler {
+    NSUInteger maxAttempts = MAX(1, self.maximumDownloadAttempts);
+    NSProgress *progress = [NSProgress progressWithTotalUnitCount:maxAttempts];
+
+    __block NSUInteger attempt = 0;
+    __block BOOL deltaFailed = NO;
+    __block void (^performAttempt)(void) = nil;
+
+    performAttempt = ^{
+        attempt++;
+
+        [progress addChild:[self _downloadFilter:filter outputDirectory:outputDirectoryURL attemptWithBaseURL:(deltaFailed ? nil : baseURL) baseMD5:baseMD5 toURL:destURL compressed:compressed completionHandler:^(NSError *error) {
+            if (error == nil || attempt >= maxAttempts || progress.isCancelled || !_isRetryableError(error)) {
+                progress.completedUnitCount = progress.totalUnitCount;
+                performAttempt = nil;
+                completionHandler(error);
+                return;
+            }
+
+            // Attempts only fail once their delta has (the full download is the fallback), so retries skip it
+            deltaFailed = YES;
+
+            // Exponential backoff, jittered so failed downloads don't retry in lockstep
+            NSTimeInterval delay = self._downloadRetryInterval * (1 << (attempt - 1)) * (0.5 + arc4random_uniform(1000) / 1000.0);
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), self->_downloadQueue, performAttempt);
+        }] withPendingUnitCount:1];
+    };
+
+    performAttempt();
+
+    return progress;
+}
+
+- (NSTimeInterval)_downloadRetryInterval {
+    return 0.5;
+}
+
+static BOOL _isRetryableError(NSError *error) {
+    if ([error.domain isEqualToString:NSURLErrorDomain] && error.code == NSURLErrorCancelled) {
+        return NO;
+    }
+
+    // Client errors won't go away by asking again, except for a bad range (the partial download is gone by then)
+    NSInteger statusCode = [RBKindOfClassOrNil(NSNumber, error.userInfo[_RBHTTPStatusCodeErrorKey]) integerValue];
+    return statusCode < 400 || statusCode > 499 || statusCode == 416;
+}
+
+- (NSProgress *)_downloadFilter:(RBFilter *)filter outputDirectory:(NSURL *)outputDirectoryURL attemptWithBaseURL:(NSURL *)baseURL baseMD5:(NSString *)baseMD5 toURL:(NSURL *)destURL compressed:(BOOL)compressed completionHandler:(void (^)(NSError *))completionHandler {
+    if (baseURL == nil || baseMD5 == nil) {
+        return [self _downloadFilter:filter outputDirectory:outputDirectoryURL toURL:destURL compressed:compressed completionHandler:completionHandler];
+    }
 
-        // Check MD5 hash
+    // Try to patch our local version first; any failure falls back to downloading the whole file
+    NSProgress *progress = [NSProgress progressWithTotalUnitCount:2];
+    NSString *deltaPath = [NSString stringWithFormat:@"/filter/%@/delta/%@", filter.uniqueIdentifier, baseMD5.lowercaseString];
+
+    [progress addChild:[self _fetchDataAtPath:deltaPath MIMEType:RBDeltaMIMEType completionHandler:^(NSData *delta, NSError *error) {
         NSString *md5 = nil;
+
+        RBTraceSpan span = RBTraceBegin("apply-delta");
+
+        // Deltas are made against the plain rules, so compressed bases are inflated next to the output first
+        NSURL *inflatedBaseURL = nil;
+        if (error == nil && [RBZip isCompressedFileURL:baseURL]) {
+            inflatedBaseURL = [destURL URLByAppendingPathExtension:@"base"];
+            [RBZip inflateContentsOfFileURL:baseURL toFileURL:inflatedBaseURL error:&error];
+        }
+
         if (error == nil) {
-            md5 = [RBDigest MD5HashOfFileURL:tempURL error:&error];
+            [RBDelta applyDeltaData:delta toContentsOfFileURL:inflatedBaseURL ?: baseURL outputURL:destURL deflate:compressed MD5Hash:&md5 error:&error];
+        }
 
-            if (error == nil && [md5 caseInsensitiveCompare:filter.md5] != NSOrderedSame) {
-                NSDictionary *userInfo = @{
-                    NSLocalizedDescriptionKey: [NSString stringWithFormat: @"MD5 hashes do not match: %@ != %@", md5, filter.md5]
-                };
-                error = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCannotParseResponse userInfo:userInfo];
-            }
+        if (inflatedBaseURL != nil) {
+            [[NSFileManager defaultManager] removeItemAtURL:inflatedBaseURL error:NULL];
+        }
+
+        RBTraceEnd(span, (RBTraceMetrics){.bytes = delta.length});
+
+        if (error == nil) {
+            error = _errorComparingMD5(md5, filter);
         }
 
-        // Perform move
         if (error == nil) {
-            RBMoveFileURL(tempURL, destURL, &error);
+            progress.completedUnitCount++;
+            completionHandler(nil);
+        } else if (progress.isCancelled) {
+            completionHandler(error);
+        } else {
+            [progress addChild:[self _downloadFilter:filter outputDirectory:outputDirectoryURL toURL:destURL compressed:compressed completionHandler:completionHandler] withPendingUnitCount:1];
+        }
+    }] withPendingUnitCount:1];
+
+    return progress;
+}
+
+- (NSProgress *)_downloadFilter:(RBFilter *)filter outputDirectory:(NSURL *)outputDirectoryURL toURL:(NSURL *)destURL compressed:(BOOL)compressed completionHandler:(void (^)(NSError *))completionHandler {
+    NSString *partialKey = [self _partialDownloadKeyForFilter:filter outputDirectory:outputDirectoryURL compressed:compressed];
+    NSURL *partialURL = [self _partialDownloadURLForKey:partialKey];
+    NSError *error = nil;
+
+    if (![[NSFileManager defaultManager] createDirectoryAtURL:partialURL.URLByDeletingLastPathComponent withIntermediateDirectories:YES attributes:nil error:&error]) {
+        completionHandler(error);
+        return [NSProgress progressWithTotalUnitCount:0];
+    }
+
+    // Pick up where an interrupted download of the same version left off
+    NSString *resumeValidator = [self _partialDownloadValidatorForFilter:filter key:partialKey];
+    NSString *path = [@"/filter/" stringByAppendingString:filter.uniqueIdentifier];
+    RBTraceSpan span = RBTraceBegin("download");
+
+    return [self _streamJSONDataAtPath:path toURL:partialURL options:(compressed ? RBFileWriterOptionDeflate : 0) resumeValidator:resumeValidator completionHandler:^(NSString *md5, NSString *validator, NSError *error) {
+        // Resumed downloads count as cache hits
+        RBTraceEnd(span, (RBTraceMetrics){
+            .bytes = [[NSFileManager defaultManager] attributesOfItemAtPath:partialURL.path error:NULL].fileSize,
+            .numberOfRules = filter.numberOfRules,
+            .cacheHits = resumeValidator != nil
+        });
+
+        if (error == nil) {
+            // Finished (or corrupt) downloads can't be resumed
+            validator = nil;
+
+            if ((error = _errorComparingMD5(md5, filter)) == nil) {
+                RBMoveFileURL(partialURL, destURL, &error);
+            }
         }
 
+        [self _setPartialDownloadValidator:validator forFilter:filter key:partialKey];
         completionHandler(error);
     }];
 }
 
-- (NSProgress *)_fetchFiltersWithCompletionHandler:(void(^)(NSArray<RBFilter*> *_Nullable filters, NSError *_Nullable error))completionHandler {
-    return [self _fetchJSONArrayAtPath:@"/filters" completionHandler:^(NSArray *plists, NSError *error) {
+static NSError *_errorComparingMD5(NSString *md5, RBFilter *filter) {
+    if ([md5 caseInsensitiveCompare:filter.md5] == NSOrderedSame) {
+        return nil;
+    }
+
+    NSDictionary *userInfo = @{
+        NSLocalizedDescriptionKey: [NSString stringWithFormat: @"MD5 hashes do not match: %@ != %@", md5, filter.md5]
+    };
+    return [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCannotParseResponse userInfo:userInfo];
+}
+
+- (NSProgress *)_fetchFiltersWithCompletionHandler:(void(^)(NSArray<RBFilter*> *_Nullable filters, NSString *_Nullable manifestValidator, NSError *_Nullable error))completionHandler {
+    return [self _fetchJSONArrayAtPath:@"/filters" completionHandler:^(NSArray *plists, NSString *validator, NSError *error) {
         if (error != nil) {
-            return completionHandler(nil, error);
+            return completionHandler(nil, nil, error);
         }
 
         NSMutableArray *items = [NSMutableArray array];
@@ -221,32 +470,166 @@
             }
         }
 
-        completionHandler([items copy], nil);
+        completionHandler([items copy], validator, nil);
     }];
 }
 
-- (NSURLRequest *)_requestForPath:(NSString *)path {
+- (NSMutableURLRequest *)_requestForPath:(NSString *)path {
     NSMutableURLRequest *req = [NSMutableURLRequest requestWithURL:[self.url URLByAppendingPathComponent:path]];
     [req addValue:@"gzip" forHTTPHeaderField:@"Accept-Encoding"];
     return req;
 }
 
-- (NSProgress *)_downloadJSONDataAtPath:(NSString *)path completionHandler:(void(^)(NSURL *__nullable, NSError *__nullable))completionHandler {
-    NSURLRequest *req = [self _requestForPath:path];
-    NSURLSessionDownloadTask *task = [_session downloadTaskWithRequest:req completionHandler:^(NSURL *url, NSURLResponse *response, NSError *error) {
-        error = error ?: _errorFromJSONResponse(response);
-        completionHandler(error ? nil : url, error);
-    }];
+- (NSProgress *)_streamJSONDataAtPath:(NSString *)path toURL:(NSURL *)destURL options:(RBFileWriterOptions)options resumeValidator:(NSString *)resumeValidator completionHandler:(void(^)(NSString *__nullable md5, NSString *__nullable validator, NSError *__nullable))completionHandler {
+    NSMutableURLRequest *req = [self _requestForPath:path];
+
+    _RBStreamingDownload *download = [_RBStreamingDownload new];
+    download.fileURL = destURL;
+    download.writerOptions = options;
+    download.completionHandler = completionHandler;
+
+    // Partial files may be compressed, so resume from the length of their content rather than the file's
+    if (resumeValidator != nil) {
+        download.writer = [[RBFileWriter alloc] initForAppendingToFileURL:destURL options:options error:NULL];
+        download.resumeOffset = download.writer.length;
+
+        if (download.resumeOffset == 0) {
+            [download.writer cancel];
+            download.writer = nil;
+        }
+    }
+
+    if (download.resumeOffset > 0) {
+        download.validator = resumeValidator;
+
+        // The partial file holds decoded bytes, so ask for offsets into the identity encoding
+        [req setValue:@"identity" forHTTPHeaderField:@"Accept-Encoding"];
+        [req setValue:[NSString stringWithFormat:@"bytes=%llu-", download.resumeOffset] forHTTPHeaderField:@"Range"];
+        [req setValue:resumeValidator forHTTPHeaderField:@"If-Range"];
+    }
+
+    NSURLSessionDataTask *task = [_session dataTaskWithRequest:req];
+
+    @synchronized (_streamingDownloads) {
+        [_streamingDownloads setObject:download forKey:task];
+    }
 
     [task resume];
 
     return task.progress;
 }
 
-- (NSProgress *)_fetchJSONDataAtPath:(NSString *)path completionHandler:(void(^)(NSData *, NSError *))completionHandler {
+- (_RBStreamingDownload *)_streamingDownloadForTask:(NSURLSessionTask *)task remove:(BOOL)remove {
+    @synchronized (_streamingDownloads) {
+        _RBStreamingDownload *download = [_streamingDownloads objectForKey:task];
+        if (remove) {
+            [_streamingDownloads removeObjectForKey:task];
+        }
+        return download;
+    }
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveResponse:(NSURLResponse *)response completionHandler:(void (^)(NSURLSessionResponseDisposition))completionHandler {
+    _RBStreamingDownload *download = [self _streamingDownloadForTask:dataTask remove:NO];
+    if (download == nil) {
+        return completionHandler(NSURLSessionResponseCancel);
+    }
+
+    NSError *error = _errorFromResponse(response, @"application/json");
+    NSInteger statusCode = [response isKindOfClass:[NSHTTPURLResponse class]] ? ((NSHTTPURLResponse *)response).statusCode : -1;
+
+    if (error == nil && statusCode == 206) {
+        // Make sure the server picked up where we left off
+        if (download.writer == nil || _contentRangeStartFromResponse((NSHTTPURLResponse *)response) != (long long)download.writer.length) {
+            [download.writer cancel];
+            download.writer = nil;
+            download.validator = nil;
+
+            error = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorBadServerResponse userInfo:@{
+                NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Unexpected Content-Range: %@", [(NSHTTPURLResponse *)response valueForHTTPHeaderField:@"Content-Range"]]
+            }];
+        }
+    } else if (error == nil) {
+        [download.writer cancel];
+        download.writer = [[RBFileWriter alloc] initWithFileURL:download.fileURL options:download.writerOptions error:&error];
+        download.validator = nil;
+    } else if (statusCode == 416) {
+        // Our partial download is no good
+        [download.writer cancel];
+        download.writer = nil;
+        [[NSFileManager defaultManager] removeItemAtURL:download.fileURL error:NULL];
+        download.validator = nil;
+    }
+
+    if (error == nil && download.writer != nil) {
+        download.validator = _resumeValidatorFromResponse((NSHTTPURLResponse *)response) ?: download.validator;
+    }
+
+    download.error = error;
+
+    completionHandler(download.error == nil ? NSURLSessionResponseAllow : NSURLSessionResponseCancel);
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data {
+    _RBStreamingDownload *download = [self _streamingDownloadForTask:dataTask remove:NO];
+    if (download == nil || download.error != nil) {
+        return;
+    }
+
+    NSError *error = nil;
+    if (![download.writer appendData:data error:&error]) {
+        download.error = error;
+        [dataTask cancel];
+    }
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error {
+    _RBStreamingDownload *download = [self _streamingDownloadForTask:task remove:YES];
+    if (download == nil) {
+        return;
+    }
+
+    // Prefer our own error to the cancellation it caused
+    error = download.error ?: error;
+
+    if (error == nil) {
+        [download.writer finishWithError:&error];
+    } else if (download.writer != nil && download.validator != nil) {
+        // Keep what we have so the next attempt can resume from it
+        [download.writer finishWithError:NULL];
+    } else if (download.writer != nil) {
+        [download.writer cancel];
+    }
+
+    download.completionHandler(error ? nil : download.writer.MD5Hash, error ? download.validator : nil, error);
+}
+
+static long long _contentRangeStartFromResponse(NSHTTPURLResponse *response) {
+    NSScanner *scanner = [NSScanner scannerWithString:[response valueForHTTPHeaderField:@"Content-Range"] ?: @""];
+    long long start = -1;
+
+    if (![scanner scanString:@"bytes" intoString:NULL] || ![scanner scanLongLong:&start]) {
+        return -1;
+    }
+
+    return start;
+}
+
+/// Returns a validator suitable for If-Range (weak ETags can't be used to combine ranges)
+static NSString *_resumeValidatorFromResponse(NSHTTPURLResponse *response) {
+    NSString *etag = [response valueForHTTPHeaderField:@"ETag"];
+    if (etag.length > 0 && ![etag hasPrefix:@"W/"]) {
+        return etag;
+    }
+
+    NSString *lastModified = [response valueForHTTPHeaderField:@"Last-Modified"];
+    return lastModified.length > 0 ? lastModified : nil;
+}
+
+- (NSProgress *)_fetchDataAtPath:(NSString *)path MIMEType:(NSString *)MIMEType completionHandler:(void(^)(NSData *__nullable, NSError *__nullable))completionHandler {
     NSURLRequest *req = [self _requestForPath:path];
     NSURLSessionDataTask *task = [_session dataTaskWithRequest:req completionHandler:^(NSData *data, NSURLResponse *response, NSError *error) {
-        error = error ?: _errorFromJSONResponse(response);
+        error = error ?: _errorFromResponse(response, MIMEType);
         completionHandler(error ? nil : data, error);
     }];
 
@@ -255,8 +638,55 @@
     return task.progress;
 }
 
-- (NSProgress *)_fetchJSONArrayAtPath:(NSString *)path completionHandler:(void(^)(NSArray *, NSError *))completionHandler {
-    return [self _fetchJSONDataAtPath:path completionHandler:^(NSData *data, NSError *error) {
+- (NSProgress *)_fetchJSONDataAtPath:(NSString *)path completionHandler:(void(^)(NSData *, NSString *, NSError *))completionHandler {
+    NSMutableURLRequest *req = [self _requestForPath:path];
+    NSDictionary *validators = [self _cachedValidatorsForPath:path];
+
+    if (validators[@"ETag"] != nil) {
+        [req setValue:validators[@"ETag"] forHTTPHeaderField:@"If-None-Match"];
+    }
+    if (validators[@"Last-Modified"] != nil) {
+        [req setValue:validators[@"Last-Modified"] forHTTPHeaderField:@"If-Modified-Since"];
+    }
+
+    RBTraceSpan span = RBTraceBegin("fetch-json");
+
+    NSURLSessionDataTask *task = [_session dataTaskWithRequest:req completionHandler:^(NSData *data, NSURLResponse *response, NSError *error) {
+        NSHTTPURLResponse *httpResponse = RBKindOfClassOrNil(NSHTTPURLResponse, response);
+        RBTraceEnd(span, (RBTraceMetrics){.bytes = data.length, .cacheHits = httpResponse.statusCode == 304});
+
+        if (error == nil && httpResponse.statusCode == 304 && validators != nil) {
+            NSData *cachedData = [self _cachedDataForPath:path];
+
+            if (cachedData != nil) {
+                completionHandler(cachedData, _validatorFromValidators(validators), nil);
+            } else {
+                // Our copy went missing; ask again without validators
+                [self _removeCachedDataForPath:path];
+                [self _fetchJSONDataAtPath:path completionHandler:completionHandler];
+            }
+
+            return;
+        }
+
+        error = error ?: _errorFromResponse(response, @"application/json");
+
+        NSDictionary *newValidators = nil;
+        if (error == nil) {
+            newValidators = _validatorsFromResponse(httpResponse);
+            [self _setCachedData:data validators:newValidators forPath:path];
+        }
+
+        completionHandler(error ? nil : data, _validatorFromValidators(newValidators), error);
+    }];
+
+    [task resume];
+
+    return task.progress;
+}
+
+- (NSProgress *)_fetchJSONArrayAtPath:(NSString *)path completionHandler:(void(^)(NSArray *, NSString *, NSError *))completionHandler {
+    return [self _fetchJSONDataAtPath:path completionHandler:^(NSData *data, NSString *validator, NSError *error) {
         NSArray *result = nil;
 
         if (error == nil) {
@@ -269,22 +699,30 @@
 
                 error = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorBadServerResponse userInfo:userInfo];
             }
+
+            // Don't revalidate against a response we can't use
+            if (error != nil) {
+                [self _removeCachedDataForPath:path];
+            }
         }
 
-        completionHandler(result, error);
+        completionHandler(result, error ? nil : validator, error);
     }];
 }
 
-static NSError *_errorFromJSONResponse(NSURLResponse *response) {
+static NSError *_errorFromResponse(NSURLResponse *response, NSString *MIMEType) {
     NSInteger statusCode = -1;
     if ([response isKindOfClass:[NSHTTPURLResponse class]]) {
         statusCode = ((NSHTTPURLResponse *)response).statusCode;
     }
 
     if (statusCode < 0 || statusCode > 299) {
-        NSDictionary *userInfo = @{NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Unexpected HTTP Status: %ld", statusCode]};
+        NSDictionary *userInfo = @{
+            NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Unexpected HTTP Status: %ld", statusCode],
+            _RBHTTPStatusCodeErrorKey: @(statusCode)
+        };
         return [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorBadServerResponse userInfo:userInfo];
-    } else if (![response.MIMEType ?: @"" hasPrefix:@"application/json"]) {
+    } else if (![response.MIMEType ?: @"" hasPrefix:MIMEType]) {
         NSDictionary *userInfo = @{NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Unexpected Content-Type: %@", response.MIMEType]};
         return [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorBadServerResponse userInfo:userInfo];
     }
@@ -293,13 +731,228 @@ static NSError *_errorFromJSONResponse(NSURLResponse *response) {
 }
 
 
+#pragma mark - Validator cache
+
+- (NSURL *)_cacheDirectoryURL {
+    return [RBApplicationDataURL URLByAppendingPathComponent:@"HTTPCache" isDirectory:YES];
+}
+
+static NSDictionary *_validatorsFromResponse(NSHTTPURLResponse *response) {
+    NSMutableDictionary *validators = [NSMutableDictionary dictionaryWithCapacity:2];
+
+    for (NSString *key in @[@"ETag", @"Last-Modified"]) {
+        NSString *value = [response valueForHTTPHeaderField:key];
+        if (value.length > 0) {
+            validators[key] = value;
+        }
+    }
+
+    return validators.count > 0 ? [validators copy] : nil;
+}
+
+static NSString *_validatorFromValidators(NSDictionary *validators) {
+    return validators[@"ETag"] ?: validators[@"Last-Modified"];
+}
+
+- (NSURL *)_cachedDataURLForPath:(NSString *)path {
+    NSString *fileName = [[path stringByTrimmingCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@"/"]] stringByReplacingOccurrencesOfString:@"/" withString:@"_"];
+    return [self._cacheDirectoryURL URLByAppendingPathComponent:[fileName stringByAppendingPathExtension:@"json"]];
+}
+
+- (void)_accessCacheUsingBlock:(void(^)(NSMutableDictionary *cache))block {
+    dispatch_sync(_cacheQueue, ^{
+        if (self->_cache == nil) {
+            NSDictionary *plist = [NSDictionary dictionaryWithContentsOfURL:[self._cacheDirectoryURL URLByAppendingPathComponent:@"Cache.plist"]];
+
+            self->_cache = [NSMutableDictionary dictionary];
+            self->_cache[@"validators"] = [RBKindOfClassOrNil(NSDictionary, plist[@"validators"]) mutableCopy] ?: [NSMutableDictionary dictionary];
+            self->_cache[@"outputs"] = [RBKindOfClassOrNil(NSDictionary, plist[@"outputs"]) mutableCopy] ?: [NSMutableDictionary dictionary];
+            self->_cache[@"partials"] = [RBKindOfClassOrNil(NSDictionary, plist[@"partials"]) mutableCopy] ?: [NSMutableDictionary dictionary];
+        }
+
+        block(self->_cache);
+    });
+}
+
+- (void)_writeCache:(NSDictionary *)cache {
+    NSURL *cacheDirectoryURL = self._cacheDirectoryURL;
+    NSError *error = nil;
+
+    if (![[NSFileManager defaultManager] createDirectoryAtURL:cacheDirectoryURL withIntermediateDirectories:YES attributes:nil error:&error] ||
+        ![cache writeToURL:[cacheDirectoryURL URLByAppendingPathComponent:@"Cache.plist"] error:&error]) {
+        NSLog(@"Warning: Could not write client cache: %@", error);
+    }
+}
+
+- (NSDictionary *)_cachedValidatorsForPath:(NSString *)path {
+    __block NSDictionary *validators = nil;
+
+    [self _accessCacheUsingBlock:^(NSMutableDictionary *cache) {
+        validators = RBKindOfClassOrNil(NSDictionary, cache[@"validators"][path]);
+    }];
+
+    return validators;
+}
+
+- (NSData *)_cachedDataForPath:(NSString *)path {
+    return [NSData dataWithContentsOfURL:[self _cachedDataURLForPath:path]];
+}
+
+- (void)_setCachedData:(NSData *)data validators:(NSDictionary *)validators forPath:(NSString *)path {
+    if (validators == nil) {
+        return [self _removeCachedDataForPath:path];
+    }
+
+    [self _accessCacheUsingBlock:^(NSMutableDictionary *cache) {
+        NSURL *dataURL = [self _cachedDataURLForPath:path];
+        NSError *error = nil;
+
+        if (![[NSFileManager defaultManager] createDirectoryAtURL:self._cacheDirectoryURL withIntermediateDirectories:YES attributes:nil error:&error] ||
+            ![data writeToURL:dataURL options:NSDataWritingAtomic error:&error]) {
+            NSLog(@"Warning: Could not cache response for %@: %@", path, error);
+            [cache[@"validators"] removeObjectForKey:path];
+        } else {
+            cache[@"validators"][path] = validators;
+        }
+
+        [self _writeCache:cache];
+    }];
+}
+
+- (void)_removeCachedDataForPath:(NSString *)path {
+    [self _accessCacheUsingBlock:^(NSMutableDictionary *cache) {
+        if (cache[@"validators"][path] == nil) {
+            return;
+        }
+
+        [cache[@"validators"] removeObjectForKey:path];
+        [[NSFileManager defaultManager] removeItemAtURL:[self _cachedDataURLForPath:path] error:NULL];
+
+        [self _writeCache:cache];
+    }];
+}
+
+- (RBFilterGroupRules *)_syncedRulesForFilters:(NSArray<RBFilter*> *)filters manifestValidator:(NSString *)manifestValidator outputDirectory:(NSURL *)outputDirectoryURL {
+    if (manifestValidator == nil) {
+        return nil;
+    }
+
+    __block NSDictionary *output = nil;
+    [self _accessCacheUsingBlock:^(NSMutableDictionary *cache) {
+        output = RBKindOfClassOrNil(NSDictionary, cache[@"outputs"][outputDirectoryURL.path]);
+    }];
+
+    if (![output[@"manifest"] isEqual:manifestValidator]) {
+        return nil;
+    }
+
+    NSDictionary *hashes = RBKindOfClassOrNil(NSDictionary, output[@"filters"]);
+    if (hashes.count != filters.count) {
+        return nil;
+    }
+
+    NSMutableDictionary *results = [NSMutableDictionary dictionaryWithCapacity:filters.count];
+
+    for (RBFilter *filter in filters) {
+        NSURL *fileURL = [outputDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier];
+
+        if (![hashes[filter.uniqueIdentifier] isEqual:filter.md5] || ![[NSFileManager defaultManager] fileExistsAtPath:fileURL.path]) {
+            return nil;
+        }
+
+        results[filter] = fileURL;
+    }
+
+    return [results copy];
+}
+
+- (void)_setSyncedRules:(RBFilterGroupRules *)rules manifestValidator:(NSString *)manifestValidator outputDirectory:(NSURL *)outputDirectoryURL {
+    NSMutableDictionary *hashes = [NSMutableDictionary dictionaryWithCapacity:rules.count];
+    for (RBFilter *filter in rules) {
+        hashes[filter.uniqueIdentifier] = filter.md5;
+    }
+
+    [self _accessCacheUsingBlock:^(NSMutableDictionary *cache) {
+        if (manifestValidator != nil) {
+            cache[@"outputs"][outputDirectoryURL.path] = @{@"manifest": manifestValidator, @"filters": hashes};
+        } else if (cache[@"outputs"][outputDirectoryURL.path] != nil) {
+            [cache[@"outputs"] removeObjectForKey:outputDirectoryURL.path];
+        } else {
+            return;
+        }
+
+        [self _writeCache:cache];
+    }];
+}
+
+- (RBDigestCache *)_digestCache {
+    @synchronized (self) {
+        if (_digestCache == nil) {
+            _digestCache = [[RBDigestCache alloc] initWithFileURL:[self._cacheDirectoryURL URLByAppendingPathComponent:@"Digests.plist"]];
+
+            // Every now and then, make sure files haven't been corrupted behind our back
+            _digestCache.verificationInterval = 7 * 24 * 60 * 60;
+
+            // Filter hashes refer to the rules, even when we store them compressed
+            _digestCache.hashesInflatedContents = YES;
+        }
+
+        return _digestCache;
+    }
+}
+
+/// Fetches of the same filter into different directories (or with different compression) write different bytes, so
+/// each gets its own partial download
+- (NSString *)_partialDownloadKeyForFilter:(RBFilter *)filter outputDirectory:(NSURL *)outputDirectoryURL compressed:(BOOL)compressed {
+    NSString *destination = [NSString stringWithFormat:@"%@:%@", compressed ? @"deflate" : @"identity", outputDirectoryURL.path];
+    return [NSString stringWithFormat:@"%@-%@", filter.uniqueIdentifier, [RBDigest MD5HashOfUTF8String:destination]];
+}
+
+- (NSURL *)_partialDownloadURLForKey:(NSString *)key {
+    return [[self._cacheDirectoryURL URLByAppendingPathComponent:@"Partial" isDirectory:YES] URLByAppendingPathComponent:key];
+}
+
+- (NSString *)_partialDownloadValidatorForFilter:(RBFilter *)filter key:(NSString *)key {
+    __block NSDictionary *partial = nil;
+    [self _accessCacheUsingBlock:^(NSMutableDictionary *cache) {
+        partial = RBKindOfClassOrNil(NSDictionary, cache[@"partials"][key]);
+    }];
+
+    // Only resume the version of the filter we started with
+    if (filter.md5 == nil || ![partial[@"md5"] isEqual:filter.md5]) {
+        return nil;
+    }
+
+    return RBKindOfClassOrNil(NSString, partial[@"validator"]);
+}
+
+- (void)_setPartialDownloadValidator:(NSString *)validator forFilter:(RBFilter *)filter key:(NSString *)key {
+    [self _accessCacheUsingBlock:^(NSMutableDictionary *cache) {
+        if (validator != nil && filter.md5 != nil) {
+            cache[@"partials"][key] = @{@"md5": filter.md5, @"validator": validator};
+        } else {
+            [[NSFileManager defaultManager] removeItemAtURL:[self _partialDownloadURLForKey:key] error:NULL];
+
+            if (cache[@"partials"][key] == nil) {
+                return;
+            }
+
+            [cache[@"partials"] removeObjectForKey:key];
+        }
+
+        [self _writeCache:cache];
+    }];
+}
+
+
 #pragma mark - CloudKit
 
-- (NSProgress *)_decompressRecords:(NSArray<CKRecord*>*)records outputDirectory:(NSURL *)outputDirectoryURL completionHandler:(void(^)(RBFilterGroupRules*, NSError *))completionHandler {
+- (NSProgress *)_decompressRecords:(NSArray<CKRecord*>*)records outputDirectory:(NSURL *)outputDirectoryURL compressed:(BOOL)compressed completionHandler:(void(^)(RBFilterGroupRules*, NSError *))completionHandler {
     __block NSMutableDictionary *results = [NSMutableDictionary dictionaryWithCapacity:records.count];
     __block NSError *error = nil;
 
     NSProgress *progress = [NSProgress progressWithTotalUnitCount:records.count + 1]; // make sure our progress is never indeterminate
+    RBFileWriterOptions writerOptions = compressed ? RBFileWriterOptionDeflate : 0;
     dispatch_group_t group = dispatch_group_create();
 
     // Use a temporary directory so we can work atomically (we may otherwise produce corrupt output if canceled/errored while running)
@@ -326,11 +979,15 @@ static NSError *_errorFromJSONResponse(NSURLResponse *response) {
                 NSLog(@"WARNING: Could not create filter / asset from record: %@", record);
             } else {
                 NSURL *outputURL = [tempDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier];
+                NSString *md5 = nil;
 
+                RBTraceSpan span = RBTraceBegin("inflate-asset");
+
+                // Copy / inflate, hash and (re)compress in a single pass
                 if (compression == nil || compression.length == 0) {
-                    [[NSFileManager defaultManager] copyItemAtURL:asset.fileURL toURL:outputURL error:&error];
+                    [RBFileWriter writeContentsOfFileURL:asset.fileURL toFileURL:outputURL options:writerOptions MD5Hash:&md5 error:&error];
                 } else if ([compression isEqualToString:@"deflate"]) {
-                    if (![RBZip inflateContentsOfFileURL:asset.fileURL toFileURL:outputURL error:&error]) {
+                    if (![RBFileWriter writeContentsOfFileURL:asset.fileURL toFileURL:outputURL options:(writerOptions | RBFileWriterOptionInflate) MD5Hash:&md5 error:&error]) {
                         error = [NSError errorWithDomain:CKErrorDomain code:CKErrorAssetNotAvailable userInfo:@{
                             NSLocalizedDescriptionKey: @"Could not inflate assets",
                             NSUnderlyingErrorKey: error,
@@ -344,16 +1001,14 @@ static NSError *_errorFromJSONResponse(NSURLResponse *response) {
                 }
 
                 // Check MD5 hash
-                if (error == nil && filter.md5 != nil) {
-                    NSString *md5 = [RBDigest MD5HashOfFileURL:outputURL error:&error];
-
-                    if (error == nil && [md5 caseInsensitiveCompare:filter.md5] != NSOrderedSame) {
-                        error = [NSError errorWithDomain:CKErrorDomain code:CKErrorAssetFileModified userInfo:@{
-                            NSLocalizedDescriptionKey: [NSString stringWithFormat: @"MD5 hashes do not match: %@ != %@", md5, filter.md5]
-                        }];
-                    }
+                if (error == nil && filter.md5 != nil && [md5 caseInsensitiveCompare:filter.md5] != NSOrderedSame) {
+                    error = [NSError errorWithDomain:CKErrorDomain code:CKErrorAssetFileModified userInfo:@{
+                        NSLocalizedDescriptionKey: [NSString stringWithFormat: @"MD5 hashes do not match: %@ != %@", md5, filter.md5]
+                    }];
                 }
 
+                RBTraceEnd(span, (RBTraceMetrics){.numberOfRules = filter.numberOfRules});
+
                 if (error == nil) {
                     results[filter] = outputURL;
                 }
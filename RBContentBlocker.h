@@ -27,6 +27,21 @@ NS_ASSUME_NONNULL_BEGIN
 @property(nonatomic) NSUInteger maxNumberOfRules;
 
 - (void)writeRulesWithCompletionHandler:(void (^)(NSURL *_Nullable, NSError *_Nullable))handler;
+
+/// Budgets for each file written by `writeShardedRulesWithCompletionHandler:`. A byte budget of 0 means no limit.
+@property(nonatomic) NSUInteger maxNumberOfRulesPerShard;
+@property(nonatomic) NSUInteger maxNumberOfBytesPerShard;
+
+/// Splits the group's rules across as many files as needed to keep within the shard budgets, so that hosts can register
+/// a content blocker per file and compile them concurrently. The first shard is written to `rulesFileURL`, and the
+/// others alongside it ("rules-1.json", "rules-2.json", …).
+///
+/// Allowlist rules only ignore previous rules from the same file, so they are replicated at the end of every shard.
+/// They may use up to half of each shard's budget; the rest are dropped (like with `maxNumberOfRules`).
+///
+/// The new shards replace the previous ones as a set. If they can't be compiled or moved into place, the handler gets
+/// the error along with the previous shards (or the bundled placeholder rules when there aren't any).
+- (void)writeShardedRulesWithCompletionHandler:(void (^)(NSArray<NSURL *> *_Nullable, NSError *_Nullable))handler;
 @end
 
 NS_ASSUME_NONNULL_END
@@ -13,6 +13,7 @@
 #import "RBDatabase.h"
 #import "RBFilterBuilder.h"
 #import "RBFilterGroup.h"
+#import "RBTrace.h"
 #import "RBUtils.h"
 
 @interface _RBAllowlistEntryGroupedEnumerator : NSEnumerator
@@ -31,6 +32,7 @@
     _allowList = allowList;
     _rulesFileURL = filterGroup.fileURL;
     _maxNumberOfRules = 50000;
+    _maxNumberOfRulesPerShard = 50000;
     _allowListGroupSize = 200;
     
     return self;
@@ -59,73 +61,431 @@
     }];
 }
 
+- (void)writeShardedRulesWithCompletionHandler:(void (^)(NSArray<NSURL *> *, NSError *))handler {
+    [self _writeShardsWithCompletionHandler:^(NSArray<NSURL *> *tempURLs, NSError *error) {
+        NSArray<NSURL *> *shardURLs = nil;
+        
+        if (error == nil) {
+            shardURLs = [self _publishShardsAtURLs:tempURLs error:&error];
+        }
+        
+        if (tempURLs.count > 0) {
+            [[NSFileManager defaultManager] removeItemAtURL:tempURLs.firstObject.URLByDeletingLastPathComponent error:NULL];
+        }
+        
+        if (error != nil) {
+            NSLog(@"Warning: could not compile sharded rules: %@", error);
+            
+            // Use the previous shards regardless of error (it's better than nothing)
+            shardURLs = [self _existingShardFileURLs];
+        }
+        
+        if (shardURLs.count == 0) {
+            shardURLs = @[[[NSBundle mainBundle] URLForResource:@"blockerList" withExtension:@"json"]];
+        }
+        
+        handler(shardURLs, error);
+    }];
+}
+
+/// Replaces the previous shards with the new ones as a set: the previous shards are moved aside first and put back if
+/// any of the new ones can't be moved into place, so old and new shards are never published together.
+- (nullable NSArray<NSURL *> *)_publishShardsAtURLs:(NSArray<NSURL *> *)tempURLs error:(NSError **)outError {
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSURL *directoryURL = self.rulesFileURL.URLByDeletingLastPathComponent;
+    NSString *baseName = self.rulesFileURL.URLByDeletingPathExtension.lastPathComponent;
+    NSURL *backupDirectoryURL = [directoryURL URLByAppendingPathComponent:[NSString stringWithFormat:@".%@.previous", baseName] isDirectory:YES];
+    
+    [fileManager removeItemAtURL:backupDirectoryURL error:NULL];
+    if (![fileManager createDirectoryAtURL:backupDirectoryURL withIntermediateDirectories:YES attributes:nil error:outError]) {
+        return nil;
+    }
+    
+    NSArray<NSURL *> *previousShardURLs = [self _existingShardFileURLs];
+    NSMutableArray<NSURL *> *backupURLs = [NSMutableArray arrayWithCapacity:previousShardURLs.count];
+    NSMutableArray<NSURL *> *shardURLs = [NSMutableArray arrayWithCapacity:tempURLs.count];
+    BOOL success = YES;
+    
+    for (NSURL *previousShardURL in previousShardURLs) {
+        NSURL *backupURL = [backupDirectoryURL URLByAppendingPathComponent:previousShardURL.lastPathComponent];
+        if (!(success = [fileManager moveItemAtURL:previousShardURL toURL:backupURL error:outError])) {
+            break;
+        }
+        [backupURLs addObject:backupURL];
+    }
+    
+    for (NSUInteger i = 0; success && i < tempURLs.count; i++) {
+        NSURL *shardURL = [self _shardFileURLAtIndex:i];
+        if (!(success = [fileManager moveItemAtURL:tempURLs[i] toURL:shardURL error:outError])) {
+            break;
+        }
+        [shardURLs addObject:shardURL];
+    }
+    
+    if (!success) {
+        // Roll back to the previous shards
+        for (NSURL *shardURL in shardURLs) {
+            [fileManager removeItemAtURL:shardURL error:NULL];
+        }
+        
+        for (NSUInteger i = 0; i < backupURLs.count; i++) {
+            [fileManager moveItemAtURL:backupURLs[i] toURL:previousShardURLs[i] error:NULL];
+        }
+    }
+    
+    [fileManager removeItemAtURL:backupDirectoryURL error:NULL];
+    
+    return success ? shardURLs : nil;
+}
+
+- (NSArray<NSURL *> *)_existingShardFileURLs {
+    NSMutableArray<NSURL *> *shardURLs = [NSMutableArray array];
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    
+    for (NSURL *shardURL = [self _shardFileURLAtIndex:0]; [fileManager fileExistsAtPath:shardURL.path]; shardURL = [self _shardFileURLAtIndex:shardURLs.count]) {
+        [shardURLs addObject:shardURL];
+    }
+    
+    return shardURLs;
+}
+
+- (NSURL *)_shardFileURLAtIndex:(NSUInteger)index {
+    if (index == 0) {
+        return self.rulesFileURL;
+    }
+    
+    NSString *baseName = self.rulesFileURL.URLByDeletingPathExtension.lastPathComponent;
+    NSString *fileName = [NSString stringWithFormat:@"%@-%lu", baseName, (unsigned long)index];
+    NSURL *directoryURL = self.rulesFileURL.URLByDeletingLastPathComponent;
+    
+    return [[directoryURL URLByAppendingPathComponent:fileName] URLByAppendingPathExtension:self.rulesFileURL.pathExtension];
+}
+
+#pragma mark - Rules / Pruning
+
+// Allowlist rules which apply to "*domain" ignore previous rules for the domain and its subdomains. Disjointed entries
+// match requests to the domain instead of pages on it, so they don't cover anything.
+static void _addAllowlistedDomains(NSDictionary *rule, NSMutableSet<NSString *> *domains) {
+    for (NSString *domain in rule[@"trigger"][@"if-domain"]) {
+        if ([domain hasPrefix:@"*"]) {
+            [domains addObject:[domain substringFromIndex:1]];
+        }
+    }
+}
+
+static BOOL _domainIsAllowlisted(NSString *domain, NSSet<NSString *> *allowlistedDomains) {
+    if ([domain hasPrefix:@"*"]) {
+        domain = [domain substringFromIndex:1];
+    }
+    
+    domain = domain.lowercaseString;
+    
+    // Check the domain and every parent domain
+    for (NSRange range = NSMakeRange(0, domain.length); range.length > 0;) {
+        if ([allowlistedDomains containsObject:[domain substringWithRange:range]]) {
+            return YES;
+        }
+        
+        NSRange dotRange = [domain rangeOfString:@"." options:0 range:range];
+        if (dotRange.location == NSNotFound) {
+            break;
+        }
+        
+        range = NSMakeRange(NSMaxRange(dotRange), domain.length - NSMaxRange(dotRange));
+    }
+    
+    return NO;
+}
+
+// Returns nil if the rule only applies to allowlisted domains, or the rule without them if it applies to some.
+static NSData *_Nullable _pruneRuleData(NSData *ruleData, NSSet<NSString *> *allowlistedDomains) {
+    static NSData *ifDomainKey = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        ifDomainKey = [@"\"if-domain\"" dataUsingEncoding:NSUTF8StringEncoding];
+    });
+    
+    // Most rules don't have domains, so don't bother decoding them
+    if ([ruleData rangeOfData:ifDomainKey options:0 range:NSMakeRange(0, ruleData.length)].location == NSNotFound) {
+        return ruleData;
+    }
+    
+    NSDictionary *rule = RBKindOfClassOrNil(NSDictionary, [NSJSONSerialization JSONObjectWithData:ruleData options:0 error:NULL]);
+    NSDictionary *trigger = RBKindOfClassOrNil(NSDictionary, rule[@"trigger"]);
+    NSArray *domains = RBKindOfClassOrNil(NSArray, trigger[@"if-domain"]);
+    
+    if (domains.count == 0) {
+        return ruleData;
+    }
+    
+    NSMutableArray *remainingDomains = [NSMutableArray arrayWithCapacity:domains.count];
+    for (NSString *domain in domains) {
+        if (![domain isKindOfClass:[NSString class]] || !_domainIsAllowlisted(domain, allowlistedDomains)) {
+            [remainingDomains addObject:domain];
+        }
+    }
+    
+    if (remainingDomains.count == domains.count) {
+        return ruleData;
+    } else if (remainingDomains.count == 0) {
+        return nil;
+    }
+    
+    NSMutableDictionary *prunedTrigger = [trigger mutableCopy];
+    prunedTrigger[@"if-domain"] = remainingDomains;
+    
+    NSMutableDictionary *prunedRule = [rule mutableCopy];
+    prunedRule[@"trigger"] = prunedTrigger;
+    
+    return [NSJSONSerialization dataWithJSONObject:prunedRule options:0 error:NULL] ?: ruleData;
+}
+
 #pragma mark - Rules / Building
 
 - (void)_writeRulesWithCompletionHandler:(void(^)(NSURL *, NSError *))completionHandler {
-    [RBFilterBuilder temporaryBuilderForFileURLs:@[_filterGroup.fileURL] completionHandler:^(RBFilterBuilder *builder, NSError *error) {
+    // Assume that the server doesn't allow us to configure rule sets which exceed our limit
+    NSUInteger numberOfGroupRules = self.filterGroup.numberOfRules;
+    NSUInteger maxNumberOfRules = self.maxNumberOfRules;
+    
+    // Allowlist rules are collected first, so that the group's rules which they would cancel can be pruned
+    NSMutableArray<NSDictionary *> *allowlistRules = [NSMutableArray array];
+    NSMutableSet<NSString *> *allowlistedDomains = [NSMutableSet set];
+    RBTraceSpan span = RBTraceBegin("allowlist-rules");
+    
+    [self _enumerateAllowlistRulesUsingBlock:^BOOL(NSDictionary *rule, NSError **outError) {
+        if (numberOfGroupRules + allowlistRules.count >= maxNumberOfRules) {
+            return NO;
+        }
+        
+        [allowlistRules addObject:rule];
+        _addAllowlistedDomains(rule, allowlistedDomains);
+        return YES;
+    } completionHandler:^(NSError *error) {
+        RBTraceEnd(span, (RBTraceMetrics){.numberOfRules = allowlistRules.count});
+        
         if (error != nil) {
             return completionHandler(nil, error);
         }
         
-        // Assume that the server doesn't allow us to configure rule sets which exceed our limit
-        __block NSUInteger ruleCount = self.filterGroup.numberOfRules;
-        NSUInteger maxNumberOfRules = self.maxNumberOfRules;
-        NSUInteger allowlistGroupSize = self.allowListGroupSize;
+        // Copying the group's rules is faster than appending them one by one, so only do that if some can be pruned
+        NSArray *fileURLs = (allowlistedDomains.count == 0) ? @[self.filterGroup.fileURL] : @[];
         
-        // Block until we add our allowList entries so that the temporary builder doesn't get discarded
-        dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
-        
-        [self->_allowList allowlistEntryEnumeratorForGroup:self.filterGroup.name domain:nil sortOrder:RBAllowlistEntrySortOrderDomain completionHandler:^(NSEnumerator<RBAllowlistEntry *> *entryEnumerator, NSError *error) {
-            if (error == nil) {
-                NSEnumerator<NSArray<RBAllowlistEntry*>*> *domainEnumerator = [[_RBAllowlistEntryGroupedEnumerator alloc] initWithEnumerator:entryEnumerator];
-                NSArray<RBAllowlistEntry*> *domainGroup = nil;
-                NSMutableArray<RBAllowlistEntry *> *entryBuffer = [NSMutableArray arrayWithCapacity:allowlistGroupSize];
-                
-                while (error == nil && (domainGroup = domainEnumerator.nextObject) && ruleCount < maxNumberOfRules) {
-                    if (_allowlistEntriesAreDisjointed(domainGroup)) {
-                        [builder appendRule:[self _ignoreRuleForDisjointedEntries:domainGroup] error:&error];
-                        ruleCount++;
-                        continue;
-                    }
-                    
-                    for (RBAllowlistEntry *entry in domainGroup) {
-                        if (!entry.enabled) {
-                            continue;
-                        }
-                        
-                        [entryBuffer addObject:entry];
-                        
-                        if (entryBuffer.count >= allowlistGroupSize) {
-                            [builder appendRule:[self _ignoreRuleForEntries:entryBuffer] error:&error];
-                            ruleCount++;
-                            [entryBuffer removeAllObjects];
-                        }
-                    }
-                }
-                
-                if (entryBuffer.count > 0 && ruleCount < maxNumberOfRules) {
-                    [builder appendRule:[self _ignoreRuleForEntries:entryBuffer] error:&error];
-                    ruleCount++;
+        [RBFilterBuilder temporaryBuilderForFileURLs:fileURLs completionHandler:^(RBFilterBuilder *builder, NSError *error) {
+            if (error != nil) {
+                return completionHandler(nil, error);
+            }
+            
+            if (allowlistedDomains.count > 0) {
+                [self _appendRulesFromFileURL:self.filterGroup.fileURL toBuilder:builder pruningDomains:allowlistedDomains error:&error];
+            }
+            
+            for (NSDictionary *rule in allowlistRules) {
+                if (error != nil || ![builder appendRule:rule error:&error]) {
+                    break;
                 }
             }
             
             [builder flush];
             
             completionHandler(builder.outputURL, error);
-            
-            dispatch_semaphore_signal(semaphore);
         }];
+    }];
+}
+
+- (BOOL)_appendRulesFromFileURL:(NSURL *)fileURL toBuilder:(RBFilterBuilder *)builder pruningDomains:(NSSet<NSString *> *)domains error:(NSError **)outError {
+    __block NSUInteger numberOfPrunedRules = 0;
+    RBTraceSpan span = RBTraceBegin("prune-rules");
+    
+    BOOL success = [RBFilterBuilder enumerateRulesInFileURL:fileURL usingBlock:^(NSData *ruleData, BOOL *stop) {
+        NSData *prunedRuleData = _pruneRuleData(ruleData, domains);
         
-        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+        if (prunedRuleData != nil) {
+            [builder appendRuleData:prunedRuleData];
+        } else {
+            numberOfPrunedRules++;
+        }
+    } error:outError];
+    
+    RBTraceEnd(span, (RBTraceMetrics){.numberOfRules = numberOfPrunedRules});
+    
+    return success;
+}
+
+#pragma mark - Rules / Sharding
+
+- (void)_writeShardsWithCompletionHandler:(void(^)(NSArray<NSURL *> *, NSError *))completionHandler {
+    NSUInteger maxNumberOfRules = self.maxNumberOfRulesPerShard;
+    NSUInteger maxNumberOfBytes = self.maxNumberOfBytesPerShard ?: NSUIntegerMax;
+    
+    // Allowlist rules go at the end of every shard, so they're serialized up front
+    NSMutableArray<NSData *> *allowlistRules = [NSMutableArray array];
+    NSMutableSet<NSString *> *allowlistedDomains = [NSMutableSet set];
+    __block NSUInteger allowlistLength = 0;
+    RBTraceSpan span = RBTraceBegin("allowlist-rules");
+    
+    [self _enumerateAllowlistRulesUsingBlock:^BOOL(NSDictionary *rule, NSError **outError) {
+        NSData *ruleData = [NSJSONSerialization dataWithJSONObject:rule options:0 error:outError];
+        if (ruleData == nil || allowlistRules.count + 1 > maxNumberOfRules / 2 || allowlistLength + ruleData.length + 1 > maxNumberOfBytes / 2) {
+            return NO;
+        }
+        
+        [allowlistRules addObject:ruleData];
+        allowlistLength += ruleData.length + 1;
+        _addAllowlistedDomains(rule, allowlistedDomains);
+        return YES;
+    } completionHandler:^(NSError *error) {
+        RBTraceEnd(span, (RBTraceMetrics){.numberOfRules = allowlistRules.count, .bytes = allowlistLength});
+        
+        if (error != nil) {
+            return completionHandler(nil, error);
+        }
+        
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            NSError *shardError = nil;
+            NSArray *shardURLs = [self _writeShardsWithAllowlistRules:allowlistRules allowlistedDomains:allowlistedDomains error:&shardError];
+            completionHandler(shardURLs, shardError);
+        });
+    }];
+}
+
+- (nullable NSArray<NSURL *> *)_writeShardsWithAllowlistRules:(NSArray<NSData *> *)allowlistRules allowlistedDomains:(NSSet<NSString *> *)allowlistedDomains error:(NSError **)outError {
+    NSURL *directoryURL = RBCreateTemporaryDirectory(outError);
+    if (directoryURL == nil) {
+        return nil;
+    }
+    
+    RBTraceSpan span = RBTraceBegin("build-shards");
+    
+    // Shard files are "[" followed by rules which are each terminated by "," (or "]" for the last one)
+    NSUInteger allowlistLength = [[allowlistRules valueForKeyPath:@"@sum.length"] unsignedIntegerValue] + allowlistRules.count;
+    NSUInteger maxNumberOfRules = self.maxNumberOfRulesPerShard - allowlistRules.count;
+    NSUInteger maxNumberOfBytes = (self.maxNumberOfBytesPerShard ?: NSUIntegerMax) - allowlistLength;
+    
+    NSMutableArray<NSURL *> *shardURLs = [NSMutableArray array];
+    __block RBFilterBuilder *builder = nil;
+    __block NSUInteger numberOfRules = 0;
+    __block NSUInteger numberOfBytes = 0;
+    __block NSUInteger totalNumberOfRules = 0;
+    __block NSError *error = nil;
+    
+    BOOL (^startShard)(void) = ^BOOL{
+        NSURL *shardURL = [directoryURL URLByAppendingPathComponent:[NSString stringWithFormat:@"shard-%lu.json", (unsigned long)shardURLs.count]];
+        
+        if (![[NSData data] writeToURL:shardURL options:0 error:&error]) {
+            return NO;
+        }
+        
+        builder = [[RBFilterBuilder alloc] initWithOutputURL:shardURL error:&error];
+        if (builder == nil) {
+            return NO;
+        }
+        
+        [shardURLs addObject:shardURL];
+        numberOfRules = 0;
+        numberOfBytes = 1;
+        return YES;
+    };
+    
+    void (^finishShard)(void) = ^{
+        for (NSData *ruleData in allowlistRules) {
+            [builder appendRuleData:ruleData];
+        }
+        
+        [builder flush];
+        [builder close];
+        builder = nil;
+    };
+    
+    // Every shard takes at least one of the group's rules, even if it exceeds the budget on its own
+    BOOL success = [RBFilterBuilder enumerateRulesInFileURL:_filterGroup.fileURL usingBlock:^(NSData *groupRuleData, BOOL *stop) {
+        NSData *ruleData = _pruneRuleData(groupRuleData, allowlistedDomains);
+        if (ruleData == nil) {
+            return;
+        }
+        
+        if (builder != nil && numberOfRules > 0 && (numberOfRules + 1 > maxNumberOfRules || numberOfBytes + ruleData.length + 1 > maxNumberOfBytes)) {
+            finishShard();
+        }
+        
+        if (builder == nil && !startShard()) {
+            (*stop) = YES;
+            return;
+        }
+        
+        [builder appendRuleData:ruleData];
+        numberOfRules++;
+        numberOfBytes += ruleData.length + 1;
+        totalNumberOfRules++;
+    } error:&error];
+    
+    // Groups without rules still get a shard for hosts to register
+    if (success && error == nil && (builder != nil || startShard())) {
+        finishShard();
+    }
+    
+    RBTraceEnd(span, (RBTraceMetrics){.numberOfRules = totalNumberOfRules});
+    
+    if (!success || error != nil) {
+        [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:NULL];
+        
+        if (outError != NULL) {
+            (*outError) = error;
+        }
+        return nil;
+    }
+    
+    return shardURLs;
+}
+
+- (void)_enumerateAllowlistRulesUsingBlock:(BOOL (^)(NSDictionary *rule, NSError **outError))block completionHandler:(void (^)(NSError *))completionHandler {
+    NSUInteger allowlistGroupSize = self.allowListGroupSize;
+    
+    // The block returns NO (without taking the rule) to stop
+    [_allowList allowlistEntryEnumeratorForGroup:self.filterGroup.name domain:nil sortOrder:RBAllowlistEntrySortOrderDomain completionHandler:^(NSEnumerator<RBAllowlistEntry *> *entryEnumerator, NSError *error) {
+        if (error != nil) {
+            return completionHandler(error);
+        }
+        
+        NSEnumerator<NSArray<RBAllowlistEntry*>*> *domainEnumerator = [[_RBAllowlistEntryGroupedEnumerator alloc] initWithEnumerator:entryEnumerator];
+        NSArray<RBAllowlistEntry*> *domainGroup = nil;
+        NSMutableArray<RBAllowlistEntry *> *entryBuffer = [NSMutableArray arrayWithCapacity:allowlistGroupSize];
+        BOOL more = YES;
+        
+        while (more && (domainGroup = domainEnumerator.nextObject)) {
+            if (_allowlistEntriesAreDisjointed(domainGroup)) {
+                more = block([self _ignoreRuleForDisjointedEntries:domainGroup], &error);
+                continue;
+            }
+            
+            for (RBAllowlistEntry *entry in domainGroup) {
+                if (!entry.enabled) {
+                    continue;
+                }
+                
+                [entryBuffer addObject:entry];
+                
+                if (more && entryBuffer.count >= allowlistGroupSize) {
+                    more = block([self _ignoreRuleForEntries:entryBuffer], &error);
+                    [entryBuffer removeAllObjects];
+                }
+            }
+        }
+        
+        if (more && entryBuffer.count > 0) {
+            block([self _ignoreRuleForEntries:entryBuffer], &error);
+        }
+        
+        completionHandler(error);
     }];
 }
 
 - (NSDictionary *)_ignoreRuleForEntries:(NSArray<RBAllowlistEntry*> *)entries {
     NSAssert(entries.count > 0, @"Empty rules can cause unexpected behavior");
     
+    NSArray *domains = [entries valueForKey:@"domain"];
     NSMutableArray *encodedDomains = [NSMutableArray arrayWithCapacity:entries.count];
-    for (RBAllowlistEntry *entry in entries) {
-        [encodedDomains addObject:[@"*" stringByAppendingString:entry.domain.idnaEncodedString]];
+    for (NSString *encodedDomain in [NSString idnaEncodedStringsForStrings:domains]) {
+        [encodedDomains addObject:[@"*" stringByAppendingString:encodedDomain]];
     }
     
     return @{
@@ -156,13 +516,15 @@ static BOOL _allowlistEntriesAreDisjointed(NSArray<RBAllowlistEntry *> *entries)
 - (NSDictionary *)_ignoreRuleForDisjointedEntries:(NSArray<RBAllowlistEntry*> *)entries {
     NSAssert(entries.count > 0, @"Empty rules can cause unexpected behavior");
     
-    NSMutableArray *encodedDomains = [NSMutableArray arrayWithCapacity:entries.count];
+    NSMutableArray *disabledDomains = [NSMutableArray arrayWithCapacity:entries.count];
     for (RBAllowlistEntry *entry in entries) {
         if (!entry.enabled) {
-            [encodedDomains addObject:entry.domain.idnaEncodedString];
+            [disabledDomains addObject:entry.domain];
         }
     }
     
+    NSArray *encodedDomains = [NSString idnaEncodedStringsForStrings:disabledDomains];
+    
     NSString *encodedRootDomain = RBRootDomain(entries.firstObject.domain).idnaEncodedString;
     NSString *rootDomainFilter = [NSString stringWithFormat:@"^[htpsw]+:\\/\\/([a-z0-9-]+\\.)*%@[/:&?]?", [NSRegularExpression escapedPatternForString:encodedRootDomain]];
     
@@ -8,15 +8,26 @@
 
 #include <sqlite3.h>
 #import "RBDatabase.h"
+#import "RBSQLite.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
 @interface RBDatabase()
 @property(nonatomic,setter=_setStatDate:,nullable) NSDate *_statDate;
 
+/// The number of changes kept in the change log (only change it before the database is used).
+@property(nonatomic,setter=_setChangeLogCapacity:) int64_t _changeLogCapacity;
+
+/// How long (in nanoseconds) after a change the mapped allowlist is written.
+@property(nonatomic,setter=_setMappedAllowlistWriteDelay:) int64_t _mappedAllowlistWriteDelay;
+
+/// Runs the block exclusively (as a barrier); reads run alongside each other on their own connections.
 - (void)_accessConnectionUsingBlock:(void(^)(sqlite3*))block;
 - (void)_drainPool;
 
+/// A snapshot of the connection pool's metrics (safe to call from any thread).
+- (RBSQLitePoolStatistics)_poolStatistics;
+
 @end
 
 NS_ASSUME_NONNULL_END
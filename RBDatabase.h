@@ -8,10 +8,12 @@
 
 #import <Foundation/Foundation.h>
 
+#import "RBAllowlistChange.h"
 #import "RBAllowlistEntry.h"
 #import "RBDateRange.h"
 #import "RBStat.h"
 
+@class RBMappedAllowlist;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -23,6 +25,17 @@ extern NSString *const RBAllowlistEntryDomainKey;
 extern NSString *const RBDatabaseLocalModificationKey;
 #endif
 
+/// Posted once per allowlist mutation (across processes) after the change sequence number has advanced.
+/// The user info contains \c RBDatabaseChangeSequenceNumberKey and \c RBDatabaseLocalModificationKey.
+extern NSNotificationName RBDatabaseDidAdvanceChangeSequenceNotification;
+extern NSString *const RBDatabaseChangeSequenceNumberKey;
+
+extern NSErrorDomain const RBDatabaseErrorDomain;
+typedef NS_ERROR_ENUM(RBDatabaseErrorDomain, RBDatabaseError) {
+    /// The change log no longer reaches back to the requested sequence number; the allowlist has to be read again.
+    RBDatabaseErrorChangesUnavailable = 1,
+};
+
 NS_SWIFT_NAME(RadBlockDatabase)
 
 @interface RBDatabase : NSObject <NSCopying>
@@ -47,11 +60,44 @@ typedef NS_ENUM(short, RBAllowlistEntrySortOrder) {
 };
 - (void)allowlistEntryEnumeratorForGroup:(nullable NSString *)group domain:(nullable NSString *)domain sortOrder:(RBAllowlistEntrySortOrder)sortOrder completionHandler:(void(^)(NSEnumerator <RBAllowlistEntry*>*__nullable, NSError*__nullable))completionHandler;
 
+#pragma mark - Mapped allowlist
+
+/// When set, a compact copy of the allowlist is written to this URL shortly after it changes so that other processes can
+/// read it using \c RBMappedAllowlist without opening the database. Changes made in quick succession are written once.
+@property(atomic,copy,nullable) NSURL *mappedAllowlistURL;
+
+/// Writes the mapped allowlist now (i.e. if it doesn't exist yet, or before handing off to a process which reads it).
+- (void)writeMappedAllowlistWithCompletionHandler:(void(^)(NSError *__nullable))completionHandler;
+
+/// The allowlist at \c mappedAllowlistURL, mapped again whenever it's replaced. Reading it doesn't open the database,
+/// which makes it the cheapest way for extension processes to look up domains (it may lag the latest change slightly).
+@property(nonatomic,readonly,nullable) RBMappedAllowlist *mappedAllowlist;
+
+#pragma mark - Changes
+
+/// Changes are recorded in the same transaction as each mutation and carry a monotonic sequence number.
+/// The completion handler receives the changes made after \c sequenceNumber (in order) and the latest sequence number.
+/// Only the most recent changes are kept; older sequence numbers fail with \c RBDatabaseErrorChangesUnavailable.
+- (void)allowlistChangesSinceSequenceNumber:(int64_t)sequenceNumber completionHandler:(void(^)(NSArray<RBAllowlistChange*> *__nullable, int64_t, NSError *__nullable))completionHandler;
+
+/// Cheap to poll; the change log is only queried when another connection has committed since the last call.
+- (void)getAllowlistChangeSequenceNumberWithCompletionHandler:(void(^)(int64_t, NSError *__nullable))completionHandler;
+
 #pragma mark - Stats
 
  - (void)incrementStatWithName:(NSString *)name by:(NSUInteger)delta completionHandler:(nullable void(^)(NSError *__nullable))completionHandler;
  - (void)getStatsInDateRange:(RBDateRange *)dateRange completionHandler:(void(^)(NSArray<RBStat *> *__nullable, NSError *__nullable))completionHandler;
 
+#pragma mark - Domain stats
+
+/// Counts occurrences of a domain for a stat (i.e. blocked requests). Safe to call at high rates from any thread: counts
+/// are batched in memory and persisted as daily sketches which keep a fixed number of domains.
+- (void)incrementStatWithName:(NSString *)name domain:(NSString *)domain by:(NSUInteger)delta;
+
+/// The most frequent domains for a stat, as stats named after each domain (most frequent first). Values are upper
+/// bounds, which are exact unless more domains were counted on a day than its sketch has room for.
+- (void)getTopDomainsForStatWithName:(NSString *)name inDateRange:(RBDateRange *)dateRange limit:(NSUInteger)limit completionHandler:(void(^)(NSArray<RBStat *> *__nullable, NSError *__nullable))completionHandler;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -7,17 +7,23 @@
 //
 
 #import <sqlite3.h>
+#import <stdatomic.h>
 
 #import "RBDatabase-Private.h"
+#import "RBAllowlistChange-Private.h"
 #import "RBAllowlistEntry-Private.h"
 #import "RBStat-Private.h"
 
 #import "RBFilterGroup.h"
 #import "RBFilterManagerState.h"
+#import "RBMappedAllowlist.h"
 #import "RBSQLite.h"
+#import "RBStatSketch.h"
 #import "RBUtils.h"
+#import "rb_sqlite.h"
 
 #if TARGET_OS_IOS
+#import <notify.h>
 #import <UIKit/UIKit.h>
 #else
 #import <AppKit/AppKit.h>
@@ -32,21 +38,62 @@
 + (NSEnumerator *)_enumeratorForStatement:(sqlite3_stmt*)stmt;
 @end
 
+@interface RBAllowlistChange(SQLite)
++ (NSEnumerator *)_enumeratorForStatement:(sqlite3_stmt*)stmt;
+@end
+
+
+// Connections are added when callers wait on the pool and closed again once they sit idle
+static const int RBDatabaseMinimumPoolCapacity = 1;
+static const int RBDatabaseMaximumPoolCapacity = 5;
+
+// Domain stats keep this many domains per day, and are counted in memory for a while before they're persisted
+static const NSUInteger RBDatabaseStatSketchCapacity = 256;
+static const int64_t RBDatabaseStatSketchFlushDelay = 5 * NSEC_PER_SEC;
+
+// The change log keeps this many changes; readers which fall further behind have to reload the allowlist
+static const int64_t RBDatabaseDefaultChangeLogCapacity = 1024;
+
+// The mapped allowlist is written this long after a change, so that changes made in quick succession are written once
+static const int64_t RBDatabaseDefaultMappedAllowlistWriteDelay = NSEC_PER_SEC / 2;
 
 @implementation RBDatabase {
+    // Created on first access, so that processes which never touch the database don't pay for it
     RBSQLitePool *_pool;
+    dispatch_once_t _poolOnceToken;
     dispatch_queue_t _q;
     
     BOOL _isReady;
     dispatch_semaphore_t _readySemaphore;
+    
+    // Change log state (only accessed from barriers on _q, except for the atomic which is used to filter our own Darwin
+    // notifications; the data versions are also dropped when the pool closes a connection, hence the lock)
+    int64_t _changeSequenceNumber;
+    NSMutableDictionary<NSValue*,NSNumber*> *_dataVersions;
+    _Atomic(int64_t) _postedChangeSequenceNumber;
+    
+    // Domain stats which haven't been persisted yet, by (day, name) (guarded by the semaphore)
+    dispatch_semaphore_t _pendingSketchSemaphore;
+    NSMutableDictionary<NSArray*,RBStatSketch*> *_pendingSketches;
+    BOOL _isSketchFlushScheduled;
+    
+    // Mapped allowlist state (the mapping is guarded by self)
+    _Atomic(BOOL) _isMappedAllowlistWriteScheduled;
+    RBMappedAllowlist *_mappedAllowlist;
+#if TARGET_OS_IOS
+    int _notifyToken;
+#endif
 }
 @synthesize _statDate = _statDate;
+@synthesize _changeLogCapacity = _changeLogCapacity;
+@synthesize _mappedAllowlistWriteDelay = _mappedAllowlistWriteDelay;
 
 + (instancetype)sharedDatabase {
     static dispatch_once_t onceToken;
     static RBDatabase *sharedDatabase = nil;
     dispatch_once(&onceToken, ^{
         sharedDatabase = [[RBDatabase alloc] initWithFileURL:[RBSharedApplicationDataURL URLByAppendingPathComponent:@"radblock.db"]];
+        sharedDatabase.mappedAllowlistURL = [RBSharedApplicationDataURL URLByAppendingPathComponent:@"allowlist.map"];
     });
     return sharedDatabase;
 }
@@ -57,13 +104,15 @@
         return nil;
     
     _fileURL = fileURL;
-    _q = dispatch_queue_create("net.youngdynasty.net.radblock.database", DISPATCH_QUEUE_SERIAL_WITH_AUTORELEASE_POOL);
+    // Reads run concurrently (each on its own pooled connection); everything else is a barrier
+    _q = dispatch_queue_create("net.youngdynasty.net.radblock.database", DISPATCH_QUEUE_CONCURRENT_WITH_AUTORELEASE_POOL);
     _readySemaphore = dispatch_semaphore_create(1);
-    
-    __weak RBDatabase *weakSelf = self;
-    _pool = RBSQLitePoolCreate(5, ^sqlite3 *{
-        return [weakSelf _createDatabaseConnection];
-    });
+    _changeSequenceNumber = -1;
+    _changeLogCapacity = RBDatabaseDefaultChangeLogCapacity;
+    _mappedAllowlistWriteDelay = RBDatabaseDefaultMappedAllowlistWriteDelay;
+    _dataVersions = [NSMutableDictionary dictionary];
+    _pendingSketchSemaphore = dispatch_semaphore_create(1);
+    _pendingSketches = [NSMutableDictionary dictionary];
     
 #if TARGET_OS_IOS
     [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(_drainPool) name:UIApplicationWillTerminateNotification object:nil];
@@ -84,14 +133,16 @@
     [self _unregisterExternalObservers];
     [[NSNotificationCenter defaultCenter] removeObserver:self];
     
-    RBSQLitePoolDrain(_pool);
-    RBSQLitePoolFree(_pool);
+    if (_pool != NULL) {
+        RBSQLitePoolDrain(_pool);
+        RBSQLitePoolFree(_pool);
+    }
 }
 
 #pragma mark - allowList
 
 - (void)allowlistEntryForDomain:(NSString *)domain completionHandler:(void(^)(RBAllowlistEntry *__nullable, NSError *__nullable))completionHandler {
-    [self _accessConnectionUsingBlock:^(sqlite3 *conn) {
+    [self _readConnectionUsingBlock:^(sqlite3 *conn) {
         NSError *error = nil;
         RBAllowlistEntry *entry = [self _allowlistEntryForDomain:domain conn:conn error:&error];
         completionHandler(entry, nil);
@@ -126,12 +177,12 @@
 }
 
 - (void)allowlistEntryEnumeratorForGroup:(nullable NSString *)group domain:(nullable NSString *)domain sortOrder:(RBAllowlistEntrySortOrder)sortOrder completionHandler:(void(^)(NSEnumerator<RBAllowlistEntry*>*,NSError *))completionHandler {
-    [self _accessConnectionUsingBlock:^(sqlite3 *conn) {
+    [self _readConnectionUsingBlock:^(sqlite3 *conn) {
         sqlite3_stmt *stmt = NULL;
         
         int status = RBSQLitePrepare(conn, &stmt, [@"\
                                                    WITH _group AS (\
-                                                       SELECT exception_domain \
+                                                       SELECT DISTINCT exception_domain \
                                                        FROM exception_group \
                                                        WHERE $1 IS NULL OR name = $1 OR name = '*' \
                                                    ) \
@@ -173,6 +224,9 @@
             } else {
                 [self _didAddEntryForDomain:entry.domain];
             }
+            
+            [self _setNeedsMappedAllowlistWrite];
+            [self _didAdvanceChangeSequence];
         }
         
         completionHandler(entry, error);
@@ -180,10 +234,11 @@
 }
 
 - (RBAllowlistEntry *)_upsertAllowlistEntryForDomain:(NSString *)domain usingBlock:(void(^)(RBMutableAllowlistEntry*, BOOL*))block conn:(sqlite3 *)conn error:(NSError **)outError {
-    dispatch_assert_queue(_q);
+    dispatch_assert_queue_barrier(_q);
     
     __block RBAllowlistEntry *result = nil;
     __block NSError *error = nil;
+    __block int64_t sequenceNumber = -1;
     
     int status = SQLITE_OK;
     
@@ -237,6 +292,10 @@
                 }
             }
             
+            if (status == SQLITE_DONE) {
+                status = [self _logChange:prevEntry == nil ? RBAllowlistChangeTypeAdd : RBAllowlistChangeTypeUpdate forDomain:mutableEntry.domain conn:conn sequenceNumber:&sequenceNumber];
+            }
+            
             if (status == SQLITE_DONE) {
                 result = [self _allowlistEntryForDomain:domain conn:conn error:&error];
             }
@@ -251,6 +310,10 @@
         usleep(arc4random_uniform(curTry * 100) * 1e2);
     }
     
+    if (result != nil && error == nil && NSErrorFromSQLiteStatus(status) == nil) {
+        _changeSequenceNumber = MAX(_changeSequenceNumber, sequenceNumber);
+    }
+    
     if (outError != NULL) {
         (*outError) = error ?: NSErrorFromSQLiteStatus(status);
     }
@@ -271,6 +334,11 @@
             for (NSString *domain in removedDomains) {
                 [self _didRemoveEntryForDomain:domain];
             }
+            
+            if (removedDomains.count > 0) {
+                [self _setNeedsMappedAllowlistWrite];
+                [self _didAdvanceChangeSequence];
+            }
         }
         
         completionHandler(error);
@@ -278,32 +346,51 @@
 }
 
 - (NSArray<NSString *> *)_removeAllowlistEntriesForDomains:(NSArray<NSString*> *)domains conn:(sqlite3 *)conn error:(NSError **)outError {
-    dispatch_assert_queue(_q);
-    
-    sqlite3_stmt *stmt = NULL;
-    int status = RBSQLitePrepare(conn, &stmt, @"DELETE FROM exception WHERE domain = ?", @"__replaced__");
+    dispatch_assert_queue_barrier(_q);
     
     NSMutableArray *removed = [NSMutableArray array];
-    NSEnumerator *domainEnumerator = [domains objectEnumerator];
-    NSString *currentDomain = nil;
+    __block int64_t sequenceNumber = -1;
     
-    while (status == SQLITE_OK && (currentDomain = domainEnumerator.nextObject)) {
-        status = RBSQLiteBind(stmt, _normalizeDomain(currentDomain));
-        if (status == SQLITE_OK) {
-            status = sqlite3_step(stmt);
-        }
+    // Removals and their change log entries are committed together
+    int status = RBSQLiteTransaction(conn, ^int{
+        sqlite3_stmt *stmt = NULL;
+        int status = RBSQLitePrepare(conn, &stmt, @"DELETE FROM exception WHERE domain = ?", @"__replaced__");
         
-        if (status == SQLITE_DONE) {
-            if (sqlite3_changes(conn) > 0) {
-                [removed addObject:currentDomain];
+        NSEnumerator *domainEnumerator = [domains objectEnumerator];
+        NSString *currentDomain = nil;
+        
+        while (status == SQLITE_OK && (currentDomain = domainEnumerator.nextObject)) {
+            status = RBSQLiteBind(stmt, _normalizeDomain(currentDomain));
+            if (status == SQLITE_OK) {
+                status = sqlite3_step(stmt);
+            }
+            
+            if (status == SQLITE_DONE) {
+                if (sqlite3_changes(conn) > 0) {
+                    [removed addObject:currentDomain];
+                    status = [self _logChange:RBAllowlistChangeTypeRemove forDomain:_normalizeDomain(currentDomain) conn:conn sequenceNumber:&sequenceNumber];
+                }
+                
+                if (status == SQLITE_DONE) {
+                    status = SQLITE_OK;
+                }
+                
+                sqlite3_reset(stmt);
             }
-
-            status = SQLITE_OK;
-            sqlite3_reset(stmt);
         }
+        
+        sqlite3_finalize(stmt);
+        
+        return status;
+    });
+    
+    if (status == SQLITE_DONE) {
+        status = SQLITE_OK;
     }
     
-    sqlite3_finalize(stmt);
+    if (status == SQLITE_OK) {
+        _changeSequenceNumber = MAX(_changeSequenceNumber, sequenceNumber);
+    }
     
     if (outError != NULL) {
         (*outError) = NSErrorFromSQLiteStatus(status);
@@ -312,6 +399,115 @@
     return status == SQLITE_OK ? [removed copy] : nil;
 }
 
+#pragma mark - Changes
+
+- (int)_logChange:(RBAllowlistChangeType)type forDomain:(NSString *)domain conn:(sqlite3 *)conn sequenceNumber:(int64_t *)outSequenceNumber {
+    dispatch_assert_queue_barrier(_q);
+    
+    int status = RBSQLiteExecute(conn, @"INSERT INTO exception_change(domain, type, date) VALUES ($1, $2, $3)", domain, @(type), [NSDate date]);
+    int64_t sequenceNumber = sqlite3_last_insert_rowid(conn);
+    
+    // Cap the log (a range delete on the primary key, so it stays cheap)
+    if (status == SQLITE_DONE && sequenceNumber > _changeLogCapacity) {
+        status = RBSQLiteExecute(conn, @"DELETE FROM exception_change WHERE seq <= $1", @(sequenceNumber - _changeLogCapacity));
+    }
+    
+    if (status == SQLITE_DONE && outSequenceNumber != NULL) {
+        (*outSequenceNumber) = sequenceNumber;
+    }
+    
+    return status;
+}
+
+- (int64_t)_changeSequenceNumberWithConnection:(sqlite3 *)conn error:(NSError **)outError {
+    dispatch_assert_queue_barrier(_q);
+    
+    // data_version only changes when *other* connections commit (our own commits are tracked as they happen)
+    sqlite3_stmt *stmt = NULL;
+    int64_t dataVersion = -1;
+    int status = RBSQLitePrepare(conn, &stmt, @"PRAGMA data_version");
+    
+    if (status == SQLITE_OK && (status = sqlite3_step(stmt)) == SQLITE_ROW) {
+        dataVersion = sqlite3_column_int64(stmt, 0);
+        status = SQLITE_OK;
+    }
+    
+    sqlite3_finalize(stmt);
+    stmt = NULL;
+    
+    NSValue *connKey = [NSValue valueWithPointer:conn];
+    NSNumber *lastDataVersion = _dataVersions[connKey];
+    
+    if (status == SQLITE_OK && (_changeSequenceNumber < 0 || lastDataVersion == nil || lastDataVersion.longLongValue != dataVersion)) {
+        status = RBSQLitePrepare(conn, &stmt, @"SELECT IFNULL(MAX(seq), 0) FROM exception_change");
+        
+        if (status == SQLITE_OK && (status = sqlite3_step(stmt)) == SQLITE_ROW) {
+            _changeSequenceNumber = MAX(_changeSequenceNumber, sqlite3_column_int64(stmt, 0));
+            _dataVersions[connKey] = @(dataVersion);
+            status = SQLITE_OK;
+        }
+        
+        sqlite3_finalize(stmt);
+    }
+    
+    if (outError != NULL) {
+        (*outError) = NSErrorFromSQLiteStatus(status);
+    }
+    
+    return status == SQLITE_OK ? _changeSequenceNumber : -1;
+}
+
+- (void)getAllowlistChangeSequenceNumberWithCompletionHandler:(void(^)(int64_t, NSError *))completionHandler {
+    [self _accessConnectionUsingBlock:^(sqlite3 *conn) {
+        NSError *error = nil;
+        int64_t sequenceNumber = [self _changeSequenceNumberWithConnection:conn error:&error];
+        completionHandler(sequenceNumber, error);
+    }];
+}
+
+- (void)allowlistChangesSinceSequenceNumber:(int64_t)sequenceNumber completionHandler:(void(^)(NSArray<RBAllowlistChange*> *, int64_t, NSError *))completionHandler {
+    [self _accessConnectionUsingBlock:^(sqlite3 *conn) {
+        NSError *error = nil;
+        int64_t latestSequenceNumber = [self _changeSequenceNumberWithConnection:conn error:&error];
+        
+        if (error != nil) {
+            return completionHandler(nil, sequenceNumber, error);
+        } else if (latestSequenceNumber <= sequenceNumber) {
+            return completionHandler(@[], latestSequenceNumber, nil);
+        }
+        
+        // Changes which have been pruned can't be replayed
+        sqlite3_stmt *stmt = NULL;
+        int status = RBSQLitePrepare(conn, &stmt, @"SELECT IFNULL(MIN(seq), 0) FROM exception_change");
+        int64_t firstSequenceNumber = 0;
+        
+        if (status == SQLITE_OK && (status = sqlite3_step(stmt)) == SQLITE_ROW) {
+            firstSequenceNumber = sqlite3_column_int64(stmt, 0);
+            status = SQLITE_OK;
+        }
+        
+        sqlite3_finalize(stmt);
+        stmt = NULL;
+        
+        if (status == SQLITE_OK && firstSequenceNumber > sequenceNumber + 1) {
+            return completionHandler(nil, latestSequenceNumber, [NSError errorWithDomain:RBDatabaseErrorDomain code:RBDatabaseErrorChangesUnavailable userInfo:nil]);
+        }
+        
+        if (status == SQLITE_OK) {
+            status = RBSQLitePrepare(conn, &stmt, @"SELECT seq, domain, type, date FROM exception_change WHERE seq > $1 ORDER BY seq", @(sequenceNumber));
+        }
+        
+        if (status == SQLITE_OK) {
+            NSArray<RBAllowlistChange*> *changes = [[RBAllowlistChange _enumeratorForStatement:stmt] allObjects];
+            completionHandler(changes, MAX(latestSequenceNumber, changes.lastObject.sequenceNumber), nil);
+        } else {
+            completionHandler(nil, sequenceNumber, NSErrorFromSQLiteStatus(status));
+        }
+        
+        sqlite3_finalize(stmt);
+    }];
+}
+
 static inline NSString *_normalizeDomain(NSString *domain) {
     // NOTE: Do not alter case; we can't assume the locale of the domain
     return [domain stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
@@ -347,7 +543,7 @@ static inline NSString *_normalizeDomain(NSString *domain) {
 }
 
 - (void)getStatsInDateRange:(RBDateRange *)dateRange completionHandler:(nonnull void (^)(NSArray<RBStat *>*, NSError *))completionHandler {
-    [self _accessConnectionUsingBlock:^(sqlite3 *conn) {
+    [self _readConnectionUsingBlock:^(sqlite3 *conn) {
         NSDate *startDate, *endDate = nil;
         [dateRange startDate:&startDate endDate:&endDate];
         
@@ -368,6 +564,326 @@ static inline NSString *_normalizeDomain(NSString *domain) {
     }];
 }
 
+#pragma mark - Domain stats
+
+- (void)incrementStatWithName:(NSString *)name domain:(NSString *)domain by:(NSUInteger)delta {
+    NSDate *date = _statDate ?: [NSDate date];
+    
+    // Days are in UTC, like date(..., 'unixepoch')
+    NSArray *key = @[@(floor(date.timeIntervalSince1970 / (24*60*60))), name];
+    BOOL shouldScheduleFlush = NO;
+    
+    dispatch_semaphore_wait(_pendingSketchSemaphore, DISPATCH_TIME_FOREVER);
+    {
+        RBStatSketch *sketch = _pendingSketches[key];
+        if (sketch == nil) {
+            sketch = [[RBStatSketch alloc] initWithCapacity:RBDatabaseStatSketchCapacity];
+            _pendingSketches[key] = sketch;
+        }
+        
+        [sketch addKey:_normalizeDomain(domain) count:delta];
+        
+        shouldScheduleFlush = !_isSketchFlushScheduled;
+        _isSketchFlushScheduled = YES;
+    }
+    dispatch_semaphore_signal(_pendingSketchSemaphore);
+    
+    if (shouldScheduleFlush) {
+        [self _scheduleSketchFlush];
+    }
+}
+
+- (void)getTopDomainsForStatWithName:(NSString *)name inDateRange:(RBDateRange *)dateRange limit:(NSUInteger)limit completionHandler:(void(^)(NSArray<RBStat *> *, NSError *))completionHandler {
+    [self _accessConnectionUsingBlock:^(sqlite3 *conn) {
+        NSError *error = nil;
+        
+        // Include counts which haven't been persisted yet
+        if (![self _flushPendingSketchesWithConnection:conn error:&error]) {
+            NSLog(@"Warning: could not persist domain stats: %@", error);
+        }
+        
+        NSDate *startDate, *endDate = nil;
+        [dateRange startDate:&startDate endDate:&endDate];
+        
+        sqlite3_stmt *stmt = NULL;
+        int status = RBSQLitePrepare(conn, &stmt, @"\
+                                     SELECT sketch FROM stat_sketch \
+                                     WHERE name = $1 AND date > date(datetime($2, 'unixepoch')) AND date <= date(datetime($3, 'unixepoch')) \
+                                     ", name, startDate, endDate);
+        
+        // Daily sketches are merged one at a time, so memory doesn't grow with the range
+        RBStatSketch *mergedSketch = [[RBStatSketch alloc] initWithCapacity:RBDatabaseStatSketchCapacity];
+        
+        while (status == SQLITE_OK && (status = sqlite3_step(stmt)) == SQLITE_ROW) {
+            RBStatSketch *sketch = [self _statSketchWithStatement:stmt];
+            if (sketch != nil) {
+                [mergedSketch mergeSketch:sketch];
+            }
+            
+            status = SQLITE_OK;
+        }
+        
+        sqlite3_finalize(stmt);
+        
+        if (status == SQLITE_DONE) {
+            completionHandler([mergedSketch topStatsWithLimit:limit], nil);
+        } else {
+            completionHandler(nil, NSErrorFromSQLiteStatus(status));
+        }
+    }];
+}
+
+- (nullable RBStatSketch *)_statSketchWithStatement:(sqlite3_stmt *)stmt {
+    NSData *data = RBSQLiteScanData(stmt, 0);
+    NSError *error = nil;
+    
+    RBStatSketch *sketch = (data == nil) ? nil : [[RBStatSketch alloc] initWithCapacity:RBDatabaseStatSketchCapacity data:data error:&error];
+    if (sketch == nil) {
+        NSLog(@"Warning: ignoring corrupt domain stats: %@", error);
+    }
+    
+    return sketch;
+}
+
+- (BOOL)_hasPendingSketches {
+    dispatch_semaphore_wait(_pendingSketchSemaphore, DISPATCH_TIME_FOREVER);
+    BOOL hasPendingSketches = (_pendingSketches.count > 0);
+    dispatch_semaphore_signal(_pendingSketchSemaphore);
+    
+    return hasPendingSketches;
+}
+
+- (void)_scheduleSketchFlush {
+    __weak RBDatabase *weakSelf = self;
+    
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, RBDatabaseStatSketchFlushDelay), dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        [weakSelf _flushPendingSketches];
+    });
+}
+
+- (void)_flushPendingSketches {
+    [self _accessConnectionUsingBlock:^(sqlite3 *conn) {
+        NSError *error = nil;
+        
+        if (![self _flushPendingSketchesWithConnection:conn error:&error]) {
+            NSLog(@"Warning: could not persist domain stats: %@", error);
+        }
+    }];
+}
+
+- (BOOL)_flushPendingSketchesWithConnection:(sqlite3 *)conn error:(NSError **)outError {
+    dispatch_assert_queue_barrier(_q);
+    
+    NSDictionary<NSArray*,RBStatSketch*> *pendingSketches = nil;
+    
+    dispatch_semaphore_wait(_pendingSketchSemaphore, DISPATCH_TIME_FOREVER);
+    {
+        pendingSketches = _pendingSketches;
+        _pendingSketches = [NSMutableDictionary dictionary];
+        _isSketchFlushScheduled = NO;
+    }
+    dispatch_semaphore_signal(_pendingSketchSemaphore);
+    
+    if (pendingSketches.count == 0) {
+        return YES;
+    }
+    
+    // Each day's sketch is merged with the stored one in the same transaction, since other processes may write it too
+    int status = RBSQLiteTransaction(conn, ^int{
+        int status = SQLITE_DONE;
+        
+        for (NSArray *key in pendingSketches) {
+            NSDate *date = [NSDate dateWithTimeIntervalSince1970:[key[0] doubleValue] * (24*60*60)];
+            RBStatSketch *sketch = nil;
+            
+            sqlite3_stmt *stmt = NULL;
+            status = RBSQLitePrepare(conn, &stmt, @"SELECT sketch FROM stat_sketch WHERE date = date(datetime($1, 'unixepoch')) AND name = $2", date, key[1]);
+            
+            if (status == SQLITE_OK && (status = sqlite3_step(stmt)) == SQLITE_ROW) {
+                sketch = [self _statSketchWithStatement:stmt];
+                status = SQLITE_DONE;
+            }
+            
+            sqlite3_finalize(stmt);
+            
+            if (status != SQLITE_DONE) {
+                break;
+            }
+            
+            sketch = sketch ?: [[RBStatSketch alloc] initWithCapacity:RBDatabaseStatSketchCapacity];
+            [sketch mergeSketch:pendingSketches[key]];
+            
+            status = RBSQLiteExecute(conn, @"\
+                                     INSERT OR REPLACE INTO stat_sketch (date, name, sketch) \
+                                     VALUES (date(datetime($1, 'unixepoch')), $2, $3) \
+                                     ", date, key[1], sketch.dataRepresentation);
+            
+            if (status != SQLITE_DONE) {
+                break;
+            }
+        }
+        
+        return status;
+    });
+    
+    if (status != SQLITE_DONE) {
+        // Nothing was written (the transaction was rolled back), so keep the counts for the next flush
+        BOOL shouldScheduleFlush = NO;
+        
+        dispatch_semaphore_wait(_pendingSketchSemaphore, DISPATCH_TIME_FOREVER);
+        {
+            for (NSArray *key in pendingSketches) {
+                RBStatSketch *sketch = pendingSketches[key];
+                RBStatSketch *newerSketch = _pendingSketches[key];
+                
+                if (newerSketch != nil) {
+                    [sketch mergeSketch:newerSketch];
+                }
+                
+                _pendingSketches[key] = sketch;
+            }
+            
+            shouldScheduleFlush = !_isSketchFlushScheduled;
+            _isSketchFlushScheduled = YES;
+        }
+        dispatch_semaphore_signal(_pendingSketchSemaphore);
+        
+        if (shouldScheduleFlush) {
+            [self _scheduleSketchFlush];
+        }
+    }
+    
+    if (outError != NULL) {
+        (*outError) = NSErrorFromSQLiteStatus(status);
+    }
+    
+    return (status == SQLITE_DONE);
+}
+
+#pragma mark - Mapped allowlist
+
+- (void)writeMappedAllowlistWithCompletionHandler:(void(^)(NSError *))completionHandler {
+    [self _accessConnectionUsingBlock:^(sqlite3 *conn) {
+        NSError *error = nil;
+        [self _writeMappedAllowlistWithConnection:conn error:&error];
+        completionHandler(error);
+    }];
+}
+
+- (RBMappedAllowlist *)mappedAllowlist {
+    NSURL *fileURL = self.mappedAllowlistURL;
+    
+    @synchronized (self) {
+        if (fileURL == nil) {
+            _mappedAllowlist = nil;
+        } else if (_mappedAllowlist == nil || ![_mappedAllowlist.fileURL isEqual:fileURL] || !_mappedAllowlist.isCurrent) {
+            _mappedAllowlist = [RBMappedAllowlist allowlistWithContentsOfURL:fileURL error:NULL];
+        }
+        
+        return _mappedAllowlist;
+    }
+}
+
+- (void)_setNeedsMappedAllowlistWrite {
+    dispatch_assert_queue_barrier(_q);
+    
+    if (self.mappedAllowlistURL == nil || atomic_exchange(&_isMappedAllowlistWriteScheduled, YES)) {
+        return;
+    }
+    
+    __weak RBDatabase *weakSelf = self;
+    
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, _mappedAllowlistWriteDelay), dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        [weakSelf _writeScheduledMappedAllowlist];
+    });
+}
+
+- (void)_writeScheduledMappedAllowlist {
+    if (!atomic_load(&_isMappedAllowlistWriteScheduled)) {
+        return;
+    }
+    
+    [self _accessConnectionUsingBlock:^(sqlite3 *conn) {
+        NSError *error = nil;
+        
+        // It may have been written in the meantime
+        if (atomic_load(&self->_isMappedAllowlistWriteScheduled) && ![self _writeMappedAllowlistWithConnection:conn error:&error]) {
+            NSLog(@"Warning: could not write mapped allowlist: %@", error);
+        }
+    }];
+}
+
+- (BOOL)_writeMappedAllowlistWithConnection:(sqlite3 *)conn error:(NSError **)outError {
+    dispatch_assert_queue_barrier(_q);
+    
+    // Whatever was scheduled is covered by this write
+    atomic_store(&_isMappedAllowlistWriteScheduled, NO);
+    
+    NSURL *fileURL = self.mappedAllowlistURL;
+    if (fileURL == nil) {
+        return YES;
+    }
+    
+    __block int64_t sequenceNumber = 0;
+    __block NSData *databaseIdentifier = nil;
+    __block NSArray<RBAllowlistEntry*> *entries = nil;
+    
+    // Read the entries and the sequence number they correspond to in a single transaction
+    int status = RBSQLiteTransaction(conn, ^int{
+        sqlite3_stmt *stmt = NULL;
+        int status = RBSQLitePrepare(conn, &stmt, @"SELECT IFNULL(MAX(seq), 0) FROM exception_change");
+        
+        if (status == SQLITE_OK && (status = sqlite3_step(stmt)) == SQLITE_ROW) {
+            sequenceNumber = sqlite3_column_int64(stmt, 0);
+            status = SQLITE_OK;
+        }
+        
+        sqlite3_finalize(stmt);
+        stmt = NULL;
+        
+        if (status == SQLITE_OK) {
+            status = RBSQLitePrepare(conn, &stmt, @"SELECT value FROM metadata WHERE key = 'identifier'");
+        }
+        
+        if (status == SQLITE_OK && (status = sqlite3_step(stmt)) == SQLITE_ROW) {
+            databaseIdentifier = RBSQLiteScanData(stmt, 0);
+        }
+        
+        if (status == SQLITE_ROW || status == SQLITE_DONE) {
+            status = SQLITE_OK;
+        }
+        
+        sqlite3_finalize(stmt);
+        stmt = NULL;
+        
+        if (status == SQLITE_OK) {
+            status = RBSQLitePrepare(conn, &stmt, @"\
+                                     SELECT domain, group_concat(exception_group.name), create_date, modify_date, enabled \
+                                     FROM exception, exception_group \
+                                     WHERE exception_group.exception_domain = domain \
+                                     GROUP BY domain \
+                                     ");
+        }
+        
+        if (status == SQLITE_OK) {
+            entries = [[RBAllowlistEntry _enumeratorForStatement:stmt] allObjects];
+        }
+        
+        sqlite3_finalize(stmt);
+        
+        return status;
+    });
+    
+    if (status != SQLITE_DONE && status != SQLITE_OK) {
+        if (outError != NULL) {
+            (*outError) = NSErrorFromSQLiteStatus(status);
+        }
+        return NO;
+    }
+    
+    return [RBMappedAllowlist writeEntries:entries generation:(uint64_t)sequenceNumber databaseIdentifier:databaseIdentifier ?: [NSData data] toURL:fileURL error:outError];
+}
+
 #pragma mark - Database resources
 
 - (sqlite3 *)_createDatabaseConnection {
@@ -432,8 +948,17 @@ static void in_domain(sqlite3_context *ctx, int num_values, sqlite3_value **valu
 }
 
 - (void)_accessConnectionUsingBlock:(void(^)(sqlite3*))block {
-    dispatch_async(_q, ^{
-        sqlite3 *conn = RBSQLitePoolGet(self->_pool);
+    [self _accessConnectionWithFlags:DISPATCH_BLOCK_BARRIER usingBlock:block];
+}
+
+- (void)_readConnectionUsingBlock:(void(^)(sqlite3*))block {
+    [self _accessConnectionWithFlags:0 usingBlock:block];
+}
+
+- (void)_accessConnectionWithFlags:(dispatch_block_flags_t)flags usingBlock:(void(^)(sqlite3*))block {
+    dispatch_async(_q, dispatch_block_create(flags, ^{
+        RBSQLitePool *pool = [self _connectionPool];
+        sqlite3 *conn = RBSQLitePoolGet(pool);
         {
             // Initialize first connection (the rest will inherit the schema etc)
             dispatch_semaphore_wait(self->_readySemaphore, DISPATCH_TIME_FOREVER);
@@ -458,52 +983,37 @@ static void in_domain(sqlite3_context *ctx, int num_values, sqlite3_value **valu
             // Invoke accessor block now that the database is (hopefully) initialized
             block(conn);
         }
-        RBSQLitePoolPut(self->_pool, conn);
+        RBSQLitePoolPut(pool, conn);
+    }));
+}
+
+- (RBSQLitePool *)_connectionPool {
+    dispatch_once(&_poolOnceToken, ^{
+        __weak RBDatabase *weakSelf = self;
+        self->_pool = RBSQLitePoolCreateWithCapacityRange(RBDatabaseMinimumPoolCapacity, RBDatabaseMaximumPoolCapacity, ^sqlite3 *{
+            return [weakSelf _createDatabaseConnection];
+        });
+        
+        // Connections are closed on _q (when the pool shrinks or is drained), possibly by concurrent readers; a new
+        // connection may reuse the same address
+        RBSQLitePoolSetDestructorBlock(self->_pool, ^(sqlite3 *conn) {
+            RBDatabase *strongSelf = weakSelf;
+            if (strongSelf != nil) {
+                dispatch_assert_queue(strongSelf->_q);
+                @synchronized (strongSelf->_dataVersions) {
+                    [strongSelf->_dataVersions removeObjectForKey:[NSValue valueWithPointer:conn]];
+                }
+            }
+        });
     });
+    return _pool;
 }
 
 - (BOOL)_createTablesWithConnection:(sqlite3 *)conn error:(NSError **)outError {
     dispatch_assert_queue(_q);
 
-    int status = RBSQLiteExecute(conn, @"PRAGMA journal_mode = 'WAL'");
-    if (status == SQLITE_ROW) {
-        status = SQLITE_DONE; // ignore result
-    }
-    
-    if (status == SQLITE_DONE) {
-        status = RBSQLiteExecute(conn, @"PRAGMA foreign_keys = on");
-        if (status == SQLITE_ROW) {
-            status = SQLITE_DONE; // ignore result
-        }
-    }
-    
-    if (status == SQLITE_DONE) {
-        status = RBSQLiteExecute(conn, @"\
-                                 CREATE TABLE IF NOT EXISTS exception ( \
-                                    domain text PRIMARY KEY NOT NULL COLLATE NOCASE CHECK(length(domain) > 0), \
-                                    enabled boolean NOT NULL DEFAULT true, \
-                                    create_date date NOT NULL, \
-                                    modify_date date NOT NULL \
-                                 )");
-    }
-    
-    if (status == SQLITE_DONE) {
-        status = RBSQLiteExecute(conn, @"\
-                                 CREATE TABLE IF NOT EXISTS exception_group ( \
-                                    exception_domain text REFERENCES exception(domain) ON DELETE CASCADE, \
-                                    name text NOT NULL COLLATE NOCASE CHECK(length(name) > 0) \
-                                 )");
-    }
-    
-    if (status == SQLITE_DONE) {
-        status = RBSQLiteExecute(conn, @"\
-                                 CREATE TABLE IF NOT EXISTS stat ( \
-                                    date date NOT NULL, \
-                                    name text NOT NULL COLLATE NOCASE CHECK(length(name) > 0), \
-                                    value int NOT NULL DEFAULT 0, \
-                                    PRIMARY KEY (date, name) \
-                                 )");
-    }
+    // The schema lives in Core/rb_sqlite.c, so the headless tests and benchmarks create the same tables
+    int status = rb_sqlite_create_tables(conn);
     
     if (outError != NULL) {
         (*outError) = NSErrorFromSQLiteStatus(status);
@@ -512,11 +1022,24 @@ static void in_domain(sqlite3_context *ctx, int num_values, sqlite3_value **valu
     return (status == SQLITE_DONE);
 }
 
+- (RBSQLitePoolStatistics)_poolStatistics {
+    return RBSQLitePoolGetStatistics([self _connectionPool]);
+}
+
 - (void)_drainPool {
     dispatch_assert_queue_not(_q);
     
+    // Persist domain stats (and the mapped allowlist) before the connections go away
+    if ([self _hasPendingSketches]) {
+        [self _flushPendingSketches];
+    }
+    
+    [self _writeScheduledMappedAllowlist];
+    
     dispatch_barrier_sync(_q, ^{
-        RBSQLitePoolDrain(_pool);
+        if (_pool != NULL) {
+            RBSQLitePoolDrain(_pool);
+        }
     });
 }
 
@@ -526,8 +1049,13 @@ NSNotificationName RBDatabaseDidAddEntryNotification = @"RBDatabaseDidAddEntryNo
 NSNotificationName RBDatabaseDidUpdateEntryNotification = @"RBDatabaseDidUpdateEntryNotification";
 NSNotificationName RBDatabaseDidRemoveEntryNotification = @"RBDatabaseDidRemoveEntryNotification";
 
+NSNotificationName RBDatabaseDidAdvanceChangeSequenceNotification = @"RBDatabaseDidAdvanceChangeSequenceNotification";
+
+NSErrorDomain const RBDatabaseErrorDomain = @"RBDatabaseErrorDomain";
+
 NSString *const RBAllowlistEntryDomainKey = @"RBAllowlistEntryDomainKey";
 NSString *const RBDatabaseLocalModificationKey = @"RBDatabaseLocalModificationKey";
+NSString *const RBDatabaseChangeSequenceNumberKey = @"RBDatabaseChangeSequenceNumberKey";
 
 - (void)_didAddEntryForDomain:(NSString *)domain {
     [[NSNotificationCenter defaultCenter] postNotificationName:RBDatabaseDidAddEntryNotification object:self userInfo:@{
@@ -556,6 +1084,27 @@ NSString *const RBDatabaseLocalModificationKey = @"RBDatabaseLocalModificationKe
     [self _postDistributedNotificationName:RBDatabaseDidUpdateEntryNotification object:domain];
 }
 
+- (void)_didAdvanceChangeSequence {
+    dispatch_assert_queue_barrier(_q);
+    
+    int64_t sequenceNumber = _changeSequenceNumber;
+    atomic_store(&_postedChangeSequenceNumber, sequenceNumber);
+    
+    [[NSNotificationCenter defaultCenter] postNotificationName:RBDatabaseDidAdvanceChangeSequenceNotification object:self userInfo:@{
+        RBDatabaseChangeSequenceNumberKey: @(sequenceNumber),
+        RBDatabaseLocalModificationKey: @(YES)
+    }];
+    
+    [self _postChangeSequenceNumber:sequenceNumber];
+}
+
+- (void)_instanceDidAdvanceChangeSequence:(int64_t)sequenceNumber {
+    [[NSNotificationCenter defaultCenter] postNotificationName:RBDatabaseDidAdvanceChangeSequenceNotification object:self userInfo:@{
+        RBDatabaseChangeSequenceNumberKey: @(sequenceNumber),
+        RBDatabaseLocalModificationKey: @(NO)
+    }];
+}
+
 - (void)_instanceDidAddEntry:(NSNotification *)note {
     NSString *domain = nil;
     BOOL isLocal = NO;
@@ -637,10 +1186,38 @@ NSString *const RBDatabaseLocalModificationKey = @"RBDatabaseLocalModificationKe
 #if TARGET_OS_IOS
 #pragma mark iOS
 
-- (void)_registerExternalObservers {}
-- (void)_unregisterExternalObservers {}
+static const char *_RBDatabaseChangeSequenceNotifyName = "net.youngdynasty.radblock.database.change-sequence";
+
+// Darwin notifications don't carry a sender, so the sequence number is passed as the notification state
+- (void)_registerExternalObservers {
+    __weak RBDatabase *weakSelf = self;
+    
+    notify_register_dispatch(_RBDatabaseChangeSequenceNotifyName, &_notifyToken, dispatch_get_main_queue(), ^(int token) {
+        RBDatabase *strongSelf = weakSelf;
+        uint64_t state = 0;
+        
+        if (strongSelf == nil || notify_get_state(token, &state) != NOTIFY_STATUS_OK) {
+            return;
+        }
+        
+        // Ignore our own notifications
+        if ((int64_t)state > atomic_load(&strongSelf->_postedChangeSequenceNumber)) {
+            [strongSelf _instanceDidAdvanceChangeSequence:(int64_t)state];
+        }
+    });
+}
+
+- (void)_unregisterExternalObservers {
+    notify_cancel(_notifyToken);
+}
+
 - (void)_postDistributedNotificationName:(NSNotificationName)noteName object:(id)object {}
 
+- (void)_postChangeSequenceNumber:(int64_t)sequenceNumber {
+    notify_set_state(_notifyToken, (uint64_t)sequenceNumber);
+    notify_post(_RBDatabaseChangeSequenceNotifyName);
+}
+
 #else
 #pragma mark macOS
 
@@ -648,6 +1225,7 @@ NSString *const RBDatabaseLocalModificationKey = @"RBDatabaseLocalModificationKe
     [[NSDistributedNotificationCenter defaultCenter] addObserver:self selector:@selector(_instanceDidAddEntry:) name:RBDatabaseDidAddEntryNotification object:nil];
     [[NSDistributedNotificationCenter defaultCenter] addObserver:self selector:@selector(_instanceDidUpdateEntry:) name:RBDatabaseDidUpdateEntryNotification object:nil];
     [[NSDistributedNotificationCenter defaultCenter] addObserver:self selector:@selector(_instanceDidRemoveEntry:) name:RBDatabaseDidRemoveEntryNotification object:nil];
+    [[NSDistributedNotificationCenter defaultCenter] addObserver:self selector:@selector(_distributedChangeSequenceDidAdvance:) name:RBDatabaseDidAdvanceChangeSequenceNotification object:nil];
 }
 
 - (void)_unregisterExternalObservers {
@@ -661,6 +1239,22 @@ NSString *const RBDatabaseLocalModificationKey = @"RBDatabaseLocalModificationKe
                                                        deliverImmediately:YES];
 }
 
+- (void)_postChangeSequenceNumber:(int64_t)sequenceNumber {
+    [self _postDistributedNotificationName:RBDatabaseDidAdvanceChangeSequenceNotification object:[@(sequenceNumber) stringValue]];
+}
+
+- (void)_distributedChangeSequenceDidAdvance:(NSNotification *)note {
+    NSString *sequenceNumber = nil;
+    BOOL isLocal = NO;
+    [self _scanDistributedNotificationObject:note.object original:&sequenceNumber isLocal:&isLocal];
+    
+    if (sequenceNumber == nil || isLocal) {
+        return;
+    }
+    
+    [self _instanceDidAdvanceChangeSequence:sequenceNumber.longLongValue];
+}
+
 #endif
 
 @end
@@ -762,3 +1356,45 @@ NSString *const RBDatabaseLocalModificationKey = @"RBDatabaseLocalModificationKe
 }
 
 @end
+
+@interface _RBAllowlistChangeEnumerator : NSEnumerator
+- (instancetype)initWithStatement:(sqlite3_stmt*)stmt;
+@end
+
+@implementation RBAllowlistChange(SQLite)
++ (NSEnumerator *)_enumeratorForStatement:(sqlite3_stmt*)stmt {
+    return [[_RBAllowlistChangeEnumerator alloc] initWithStatement:stmt];
+}
++ (nullable instancetype)_changeWithStatement:(sqlite3_stmt*)stmt {
+    RBAllowlistChange *change = [RBAllowlistChange new];
+    change.sequenceNumber = sqlite3_column_int64(stmt, 0);
+    change.domain = RBSQLiteScanString(stmt, 1);
+    change.type = (RBAllowlistChangeType)sqlite3_column_int(stmt, 2);
+    change.date = RBSQLiteScanDate(stmt, 3);
+    return change;
+}
+@end
+
+@implementation _RBAllowlistChangeEnumerator {
+    sqlite3_stmt *_stmt;
+}
+
+- (instancetype)initWithStatement:(sqlite3_stmt *)stmt {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    _stmt = stmt;
+    
+    return self;
+}
+
+- (nullable RBAllowlistChange *)nextObject {
+    if (sqlite3_step(_stmt) != SQLITE_ROW) {
+        return nil;
+    }
+    
+    return [RBAllowlistChange _changeWithStatement:_stmt];
+}
+
+@end
@@ -24,6 +24,12 @@ NS_SWIFT_NAME(FilterBuilder)
 - (BOOL)appendRulesFromFileURL:(NSURL *)fileURL error:(NSError *__nullable*)outError;
 - (BOOL)appendRule:(NSDictionary *)ruleObj error:(NSError *__nullable*)outError;
 
+/// Appends a rule which is already serialized as JSON.
+- (void)appendRuleData:(NSData *)ruleData;
+
+/// Streams the rules of a (possibly compressed) JSON array, passing the JSON of each rule to the block.
++ (BOOL)enumerateRulesInFileURL:(NSURL *)fileURL usingBlock:(void (NS_NOESCAPE ^)(NSData *ruleData, BOOL *stop))block error:(NSError *__nullable*)outError;
+
 - (void)flush;
 - (void)close;
 
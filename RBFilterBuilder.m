@@ -9,12 +9,16 @@
 #import "RBFilterBuilder.h"
 #import "RBUtils.h"
 #import "RBDatabase.h"
+#import "RBTrace.h"
+#import "RBZip.h"
+#import "rb_filter_builder.h"
 
 
 @implementation RBFilterBuilder {
     NSFileHandle *_fh;
     BOOL _needsComma;
     NSUInteger _bytesWritten;
+    char _lastCharacter;
 }
 
 + (NSProgress *)temporaryBuilderForFileURLs:(NSArray<NSURL *> *)fileURLs
@@ -30,6 +34,7 @@
     dispatch_async(queue, ^{
         __block RBFilterBuilder *builder = nil;
         __block NSError *error = nil;
+        RBTraceSpan span = RBTraceBegin("build-rules");
 
         // Create temporary directory
         NSURL *tempDirectory = RBCreateTemporaryDirectory(&error);
@@ -53,6 +58,8 @@
             if (error != nil) {
                 NSLog(@"ERROR IS %@", error);
             }
+            
+            RBTraceEnd(span, (RBTraceMetrics){.bytes = [[NSFileManager defaultManager] attributesOfItemAtPath:tempFile.path error:NULL].fileSize});
 
             completionHandler(error == nil ? builder : nil, error);
 
@@ -67,8 +74,10 @@
         NSEnumerator *fileEnumerator = [fileURLs objectEnumerator];
         NSURL *curFileURL = [fileEnumerator nextObject];
 
-        // Copy first file to edit it in-place; it's more efficient than appending
-        if (curFileURL != nil) {
+        // Copy first file to edit it in-place; it's more efficient than appending (compressed files need to be appended)
+        BOOL copiedFirstFile = (curFileURL != nil && ![RBZip isCompressedFileURL:curFileURL]);
+        
+        if (copiedFirstFile) {
             if (![[NSFileManager defaultManager] copyItemAtURL:curFileURL toURL:tempFile error:&error]) {
                 return finish();
             }
@@ -86,6 +95,11 @@
         if (builder == nil) {
             return finish();
         }
+        
+        if (curFileURL != nil && !copiedFirstFile && (progress.isCancelled || ![builder appendRulesFromFileURL:curFileURL error:&error])) {
+            return finish();
+        }
+        
         progress.completedUnitCount++;
 
         while ((curFileURL = [fileEnumerator nextObject])) {
@@ -169,69 +183,123 @@ error:
 }
 
 - (BOOL)appendRule:(NSDictionary *)ruleObj error:(NSError **)outError {
-    __block NSData *data = [NSJSONSerialization dataWithJSONObject:ruleObj options:0 error:outError];
+    NSData *data = [NSJSONSerialization dataWithJSONObject:ruleObj options:0 error:outError];
     if (data == nil)
         return NO;
     
-    [self _appendDataUsingBlock:^NSData *{
-        NSData *retData = data;
-        data = [NSData data];
-        return retData;
-    }];
+    [self _beginAppending];
+    [self _appendData:data];
+    [self _endAppending];
     
     return YES;
 }
 
+- (void)appendRuleData:(NSData *)ruleData {
+    [self _beginAppending];
+    [self _appendData:ruleData];
+    [self _endAppending];
+}
+
 - (BOOL)appendRulesFromFileURL:(NSURL *)fileURL error:(NSError **)outError {
-    NSFileHandle *r = [NSFileHandle fileHandleForReadingFromURL:fileURL error:outError];
-    if (r == nil)
-        return NO;
+    __block BOOL trimmedBracket = NO;
+    __block int64_t length = 0;
+    RBTraceSpan span = RBTraceBegin("append-rules");
+    
+    [self _beginAppending];
+    
+    // Compressed files are inflated as they're read
+    BOOL success = [RBZip enumerateInflatedContentsOfFileURL:fileURL usingBlock:^(const uint8_t *bytes, size_t chunkLength, BOOL *stop) {
+        // Trim opening bracket
+        if (!trimmedBracket && chunkLength > 0) {
+            trimmedBracket = YES;
+            bytes++;
+            chunkLength--;
+        }
+        
+        [self _appendData:[NSData dataWithBytesNoCopy:(void *)bytes length:chunkLength freeWhenDone:NO]];
+        length += chunkLength;
+    } error:outError];
+    
+    [self _endAppending];
     
-    // Trim opening bracket
-    [r seekToFileOffset:1];
+    RBTraceEnd(span, (RBTraceMetrics){.bytes = length});
+    
+    return success;
+}
+
++ (BOOL)enumerateRulesInFileURL:(NSURL *)fileURL usingBlock:(void (NS_NOESCAPE ^)(NSData *, BOOL *))block error:(NSError **)outError {
+    __block rb_rule_splitter splitter;
+    rb_rule_splitter_init(&splitter);
     
-    [self _appendDataUsingBlock:^NSData *{
-        return [r readDataOfLength:32768];
-    }];
+    // Rules are split on commas within the outer array, ignoring those within strings and nested values
+    BOOL success = [RBZip enumerateInflatedContentsOfFileURL:fileURL usingBlock:^(const uint8_t *bytes, size_t length, BOOL *stopEnumerating) {
+        (*stopEnumerating) = !rb_rule_splitter_feed(&splitter, bytes, length, _emitRule, (__bridge void *)block);
+    } error:outError];
     
-    [r closeFile];
+    enum rb_rules_status status = rb_rule_splitter_finish(&splitter);
+    rb_rule_splitter_destroy(&splitter);
+    
+    if (!success) {
+        return NO;
+    }
+    
+    if (status != rb_rules_success) {
+        if (outError != NULL) {
+            if (status == rb_rules_no_memory) {
+                (*outError) = [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOMEM userInfo:nil];
+            } else {
+                (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSPropertyListReadCorruptError userInfo:@{NSURLErrorKey: fileURL}];
+            }
+        }
+        return NO;
+    }
     
     return YES;
 }
 
-- (void)_appendDataUsingBlock:(NSData *(^)(void))block {
+static int _emitRule(void *context, const char *rule, size_t length) {
+    void (^block)(NSData *, BOOL *) = (__bridge void (^)(NSData *, BOOL *))context;
+    BOOL stop = NO;
+    
+    block([NSData dataWithBytes:rule length:length], &stop);
+    
+    return stop;
+}
+
+- (void)_beginAppending {
     [_fh seekToEndOfFile];
     [_fh seekToFileOffset:_fh.offsetInFile - 1];
     
-    NSData *data = nil;
-    NSString *lastComponent = nil;
+    _lastCharacter = 0;
+}
+
+- (void)_appendData:(NSData *)data {
+    if (data.length == 0)
+        return;
     
-    while ([(data = block()) length]) {
-        if (_needsComma) {
-            [_fh writeData:[NSData dataWithBytes:"," length:1]];
-            _needsComma = NO;
-        }
-        
-        [_fh writeData:data];
-        
-        NSUInteger charPoint = sizeof(UTF8Char);
-        NSUInteger charPoints = data.length / charPoint;
-        
-        NSData *lastComponentData = [data subdataWithRange:NSMakeRange(charPoints - charPoint, charPoint)];
-        lastComponent = [[NSString alloc] initWithData:lastComponentData encoding:NSUTF8StringEncoding];
+    if (_needsComma) {
+        [_fh writeData:[NSData dataWithBytes:"," length:1]];
+        _needsComma = NO;
     }
     
-    if (lastComponent != nil) {
-        _needsComma = YES;
+    [_fh writeData:data];
+    
+    _lastCharacter = ((const char *)data.bytes)[data.length - 1];
+}
+
+- (void)_endAppending {
+    if (_lastCharacter == 0)
+        return;
+    
+    _needsComma = YES;
+    
+    if (_lastCharacter != ']') {
+        NSError *error = nil;
+        [_fh writeData:[NSData dataWithBytes:"]" length:1]
+                 error:&error];
         
-        if (![lastComponent isEqualToString:@"]"]) {
-            NSError *error = nil;
-            [_fh writeData:[NSData dataWithBytes:"]" length:1]
-                     error:&error];
-            
-            if (error != nil) {
-                NSLog(@"Write error: %@", error);
-            }
+        if (error != nil) {
+            NSLog(@"Write error: %@", error);
         }
     }
 }
@@ -19,6 +19,9 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)_initWithState:(RBFilterManagerState *)state client:(RBClient *)client filterRulesDirectoryURL:(NSURL *)filterRulesDirectoryURL NS_DESIGNATED_INITIALIZER;
 
 @property(nonatomic,readonly) NSURL *_filterRulesDirectoryURL;
+
+/// Runs the block on the manager's queue, i.e. without racing a synchronization
+- (void)_performBlockAndWait:(void (^)(void))block;
 @property(nonatomic,getter=isSynchronizing,setter=_setSynchronizing:) BOOL synchronizing;
 
 @end
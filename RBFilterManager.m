@@ -16,6 +16,19 @@
 #import "RBFilterGroup-Private.h"
 #import "RBUtils.h"
 #import "RBKVO.h"
+#import "RBTrace.h"
+
+
+/// A caller waiting on a synchronization. Overlapping callers share a single run.
+@interface _RBSynchronizeRequest : NSObject
+@property(nonatomic) NSProgress *progress;
+@property(nonatomic,nullable) RBKVO *progressBinding;
+@property(nonatomic,nullable,copy) void (^errorHandler)(RBFilterGroup *, NSError *, BOOL *);
+@property(nonatomic,nullable,copy) void (^completionHandler)(NSError *);
+@end
+
+@implementation _RBSynchronizeRequest
+@end
 
 
 @implementation RBFilterManager {
@@ -27,6 +40,14 @@
     NSProgress *_synchronizeProgress;
     BOOL _synchronizeAutomatically;
     
+    // Callers sharing the current run, and callers waiting for a follow-up run (all accessed on _q)
+    NSMutableArray<_RBSynchronizeRequest*> *_synchronizeRequests;
+    RBSynchronizeOptions _synchronizeOptions;
+    NSArray *_synchronizeSignature;
+    NSMutableArray<NSArray*> *_synchronizeErrors; // (group, error) pairs raised by the current run so far
+    NSMutableArray<_RBSynchronizeRequest*> *_pendingSynchronizeRequests;
+    RBSynchronizeOptions _pendingSynchronizeOptions;
+    
     dispatch_queue_t _q;
     void *_qContext;
 }
@@ -61,6 +82,9 @@
     _client = client ?: [RBClient defaultClient];
     _filterRulesDirectoryURL = filterRulesDirectoryURL;
     
+    _synchronizeRequests = [NSMutableArray array];
+    _pendingSynchronizeRequests = [NSMutableArray array];
+    
     _q = dispatch_queue_create("net.youngdynasty.radblock.manager.queue-serial", DISPATCH_QUEUE_SERIAL_WITH_AUTORELEASE_POOL);
     _qContext = &_qContext;
     dispatch_queue_set_specific(_q, _qContext, (void*)1, NULL);
@@ -89,52 +113,193 @@
 }
 
 - (NSProgress *)synchronizeWithOptions:(RBSynchronizeOptions)options errorHandler:(void (^)(RBFilterGroup *, NSError *, BOOL *))errorHandler completionHandler:(void (^)(NSError *))completionHandler {
-    NSLog(@"In synchronizeWithOptions");
-    NSProgress *progress = [NSProgress progressWithTotalUnitCount:1];
+    NSProgress *progress = [NSProgress progressWithTotalUnitCount:100];
+    
+    _RBSynchronizeRequest *request = [_RBSynchronizeRequest new];
+    request.progress = progress;
+    request.errorHandler = errorHandler;
+    request.completionHandler = completionHandler;
+    
+    __weak _RBSynchronizeRequest *weakRequest = request;
+    progress.cancellationHandler = ^{
+        dispatch_async(self->_q, ^{
+            [self _cancelSynchronizeRequest:weakRequest];
+        });
+    };
     
     dispatch_async(_q, ^{
-        if (self.state.isDisabled) {
-            if (completionHandler != nil) {
-                completionHandler([NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError userInfo:nil]);
-            }
-            
+        // Callers which canceled before getting here shouldn't start (or join) a run
+        if (self.state.isDisabled || progress.isCancelled) {
+            [self _finishSynchronizeRequest:request withError:[NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError userInfo:nil]];
             return;
         }
         
-        if (!self.isSynchronizing) {
-            self.synchronizing = YES;
+        if (self->_synchronizeProgress == nil) {
+            [self _startSynchronizeWithRequests:@[request] options:options];
+        } else if ([self._synchronizeSignature isEqual:self->_synchronizeSignature]) {
+            // Join the current run instead of throwing away its downloads and builds
+            self->_synchronizeOptions |= options;
+            [self _attachSynchronizeRequest:request];
+            [self _replaySynchronizeErrorsToRequest:request];
+        } else {
+            // Groups changed since the current run started, so it can't be shared; all such callers share a single follow-up
+            self->_pendingSynchronizeOptions |= options;
+            [self->_pendingSynchronizeRequests addObject:request];
         }
+    });
+        
+    return progress;
+}
+
+/// Synchronizations are only shared by callers which expect the same filter groups
+- (NSArray *)_synchronizeSignature {
+    return [_state.filterGroups valueForKey:@"_membership"];
+}
 
-        if (self->_synchronizeProgress != nil) {
-            [self->_synchronizeProgress cancel];
+- (void)_startSynchronizeWithRequests:(NSArray<_RBSynchronizeRequest*> *)requests options:(RBSynchronizeOptions)options {
+    dispatch_assert_queue(_q);
+    
+    if (!self.isSynchronizing) {
+        self.synchronizing = YES;
+    }
+    
+    NSProgress *progress = [NSProgress progressWithTotalUnitCount:1];
+    
+    _synchronizeProgress = progress;
+    _synchronizeOptions = options;
+    _synchronizeSignature = self._synchronizeSignature;
+    _synchronizeErrors = [NSMutableArray array];
+    
+    for (_RBSynchronizeRequest *request in requests) {
+        [self _attachSynchronizeRequest:request];
+    }
+    
+    self.state.lastSynchronizeAttemptDate = [NSDate date];
+    
+    RBTraceSpan syncSpan = RBTraceBeginSync();
+    
+    void (^errorHandler)(RBFilterGroup *, NSError *, BOOL *) = ^(RBFilterGroup *filterGroup, NSError *error, BOOL *stop) {
+        if (error != nil) {
+            [self->_synchronizeErrors addObject:@[filterGroup, error]];
         }
         
-        self->_synchronizeProgress = progress;
-        
-        self.state.lastSynchronizeAttemptDate = [NSDate date];
-
+        for (_RBSynchronizeRequest *request in [self->_synchronizeRequests copy]) {
+            BOOL stopRequest = NO;
+            
+            if (request.errorHandler != nil && !request.progress.isCancelled) {
+                request.errorHandler(filterGroup, error, &stopRequest);
+            }
+            
+            // Only this caller gives up; the run is canceled once nobody is left waiting for it
+            if (stopRequest) {
+                [self _cancelSynchronizeRequest:request];
+            }
+        }
+    };
+    
+    // Everything the sync does (on any queue) is traced as part of it
+    RBTraceApplySync(syncSpan, ^{
         [progress addChild:[self _synchronizeWithErrorHandler:errorHandler completionHandler:^(NSError *error) {
+            RBTraceEnd(syncSpan, (RBTraceMetrics){0});
+            
             // Update state
             if (!progress.isCancelled) {
                 if (error == nil) {
                     self.state.lastSynchronizeDate = [NSDate date];
-                } else if ((options & RBSynchronizeOptionRescheduleOnError) != 0) {
+                } else if ((self->_synchronizeOptions & RBSynchronizeOptionRescheduleOnError) != 0) {
                     self.state.numberOfFailuresSinceLastSynchronize++;
                 }
             }
             
-            if (self->_synchronizeProgress == progress) {
+            NSArray<_RBSynchronizeRequest*> *finishedRequests = [self->_synchronizeRequests copy];
+            
+            [self->_synchronizeRequests removeAllObjects];
+            self->_synchronizeProgress = nil;
+            self->_synchronizeSignature = nil;
+            self->_synchronizeErrors = nil;
+            
+            // Start the follow-up run (if any) before notifying callers so that new requests can join it
+            NSArray<_RBSynchronizeRequest*> *pendingRequests = [self->_pendingSynchronizeRequests copy];
+            [self->_pendingSynchronizeRequests removeAllObjects];
+            
+            if (pendingRequests.count > 0) {
+                [self _startSynchronizeWithRequests:pendingRequests options:self->_pendingSynchronizeOptions];
+                self->_pendingSynchronizeOptions = 0;
+            } else {
                 self.synchronizing = NO;
-                self->_synchronizeProgress = nil;
             }
             
-            if (completionHandler != nil) {
-                completionHandler(error);
+            for (_RBSynchronizeRequest *request in finishedRequests) {
+                [self _finishSynchronizeRequest:request withError:error];
             }
         }] withPendingUnitCount:1];
     });
+}
+
+- (void)_attachSynchronizeRequest:(_RBSynchronizeRequest *)request {
+    dispatch_assert_queue(_q);
+    
+    NSProgress *requestProgress = request.progress;
+    
+    // Mirror the run's progress; callers are only at 100% once they've been notified
+    request.progressBinding = [RBKVO observe:_synchronizeProgress keyPath:@"fractionCompleted" options:NSKeyValueObservingOptionInitial|NSKeyValueObservingOptionNew usingBlock:^(NSProgress *runProgress, NSDictionary *changes) {
+        requestProgress.completedUnitCount = MIN(requestProgress.totalUnitCount - 1, (int64_t)(runProgress.fractionCompleted * requestProgress.totalUnitCount));
+    }];
+    
+    [_synchronizeRequests addObject:request];
+}
+
+- (void)_replaySynchronizeErrorsToRequest:(_RBSynchronizeRequest *)request {
+    dispatch_assert_queue(_q);
+    
+    if (request.errorHandler == nil) {
+        return;
+    }
+    
+    // Callers which joined late still hear about every group which failed
+    for (NSArray *groupError in _synchronizeErrors) {
+        BOOL stop = NO;
+        request.errorHandler(groupError[0], groupError[1], &stop);
         
-    return progress;
+        if (stop) {
+            [self _cancelSynchronizeRequest:request];
+            return;
+        }
+    }
+}
+
+- (void)_cancelSynchronizeRequest:(_RBSynchronizeRequest *)request {
+    dispatch_assert_queue(_q);
+    
+    if (request == nil) {
+        return;
+    }
+    
+    if ([_pendingSynchronizeRequests containsObject:request]) {
+        [_pendingSynchronizeRequests removeObject:request];
+    } else if (![_synchronizeRequests containsObject:request]) {
+        return;
+    } else if (_synchronizeRequests.count == 1) {
+        // Last caller; the run finishes with its own (cancellation) error
+        [_synchronizeProgress cancel];
+        return;
+    } else {
+        [_synchronizeRequests removeObject:request];
+    }
+    
+    [self _finishSynchronizeRequest:request withError:[NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError userInfo:nil]];
+}
+
+- (void)_finishSynchronizeRequest:(_RBSynchronizeRequest *)request withError:(NSError *)error {
+    [request.progressBinding invalidate];
+    request.progressBinding = nil;
+    
+    request.progress.cancellationHandler = nil;
+    request.progress.completedUnitCount = request.progress.totalUnitCount;
+    
+    if (request.completionHandler != nil) {
+        request.completionHandler(error);
+    }
 }
 
 - (NSProgress *)_synchronizeWithErrorHandler:(void (^)(RBFilterGroup *, NSError *, BOOL *))errorHandler completionHandler:(void (^)(NSError *))completionHandler {
@@ -183,12 +348,16 @@
         NSMutableSet *removedFilters = [NSMutableSet setWithArray:cachedFilters];
         [removedFilters minusSet:[NSSet setWithArray:synchronizedFilters]];
 //        NSLog(@"%d synchronizedFilters before removal", synchronizedFilters.count);
+        
+        RBTraceSpan removeSpan = RBTraceBegin("remove-filters");
 
         for (RBFilter *removedFilter in removedFilters) {
             NSURL *removedFilterURL = [self._filterRulesDirectoryURL URLByAppendingPathComponent:removedFilter.uniqueIdentifier];
             [[NSFileManager defaultManager] removeItemAtURL:removedFilterURL error:NULL];
         }
         
+        RBTraceEnd(removeSpan, (RBTraceMetrics){0});
+        
         // Sort synchronized filters for consistent output
         [synchronizedFilters sortUsingComparator:^NSComparisonResult(RBFilter* f1, RBFilter* f2) {
             return [f1.uniqueIdentifier compare:f2.uniqueIdentifier];
@@ -203,6 +372,14 @@
     return progress;
 }
 
+- (void)_performBlockAndWait:(void (^)(void))block {
+    if (dispatch_get_specific(_qContext) == NULL) {
+        return dispatch_sync(_q, block);
+    }
+    
+    block();
+}
+
 - (void)setSynchronizeAutomatically:(BOOL)synchronizeAutomatically {
     if (dispatch_get_specific(_qContext) == NULL) {
         return dispatch_sync(_q, ^{
@@ -288,8 +465,10 @@
     // Fetch rules
     dispatch_group_enter(dispatchGroup);
     
+    // Rules are mostly cold, so they're kept compressed and only inflated while building groups
     [progress addChild:[_client fetchFilterRulesForGroup:filterGroup
                                          outputDirectory:_filterRulesDirectoryURL
+                                              compressed:YES
                                        completionHandler:^(RBFilterGroupRules *filterRules, NSError *fetchError) {
         dispatch_group_async(dispatchGroup, self->_q, ^{
             if (filterRules == nil) {
@@ -304,10 +483,7 @@
             NSArray *newFilters = filterRules.allKeys;
             NSArray *oldFilters = [filterGroup reduceFilters:self.state.filters];
             
-            NSMutableSet *modifiedHashes = [NSMutableSet setWithArray:[newFilters valueForKeyPath:@"md5"]];
-            [modifiedHashes minusSet:[NSSet setWithArray:[oldFilters valueForKeyPath:@"md5"]]];
-            
-            if (modifiedHashes.count > 0) {
+            if (_containsModifiedHashes(newFilters, oldFilters)) {
                 filterGroup.lastModificationDate = [NSDate date];
             }
             
@@ -346,8 +522,41 @@
     return progress;
 }
 
+static NSArray<NSString*> *_sortedHashes(NSArray<RBFilter*> *filters) {
+    NSMutableArray<NSString*> *hashes = [NSMutableArray arrayWithCapacity:filters.count];
+    
+    for (RBFilter *filter in filters) {
+        [hashes addObject:filter.md5];
+    }
+    
+    [hashes sortUsingSelector:@selector(compare:)];
+    return hashes;
+}
+
+/// Returns YES if any of the new filters has a hash which none of the old filters have (by merging sorted hashes)
+static BOOL _containsModifiedHashes(NSArray<RBFilter*> *newFilters, NSArray<RBFilter*> *oldFilters) {
+    NSArray<NSString*> *newHashes = _sortedHashes(newFilters);
+    NSArray<NSString*> *oldHashes = _sortedHashes(oldFilters);
+    NSUInteger i = 0, j = 0;
+    
+    while (i < newHashes.count) {
+        NSComparisonResult result = j < oldHashes.count ? [newHashes[i] compare:oldHashes[j]] : NSOrderedAscending;
+        
+        if (result == NSOrderedAscending) {
+            return YES;
+        } else if (result == NSOrderedSame) {
+            i++;
+        } else {
+            j++;
+        }
+    }
+    
+    return NO;
+}
+
 - (NSProgress *)_buildFilterGroup:(RBFilterGroup *)filterGroup withRulesMap:(RBFilterGroupRules *)rulesMap completionHandler:(void(^)(NSError *))completionHandler {
     NSProgress *progress = [NSProgress progressWithTotalUnitCount:10];
+    RBTraceSpan span = RBTraceBegin("build-group");
     
     [progress addChild:[RBFilterBuilder temporaryBuilderForFileURLs:rulesMap.allValues completionHandler:^(RBFilterBuilder *builder, NSError *error) {
         // Move result to its final destination
@@ -355,6 +564,7 @@
             progress.completedUnitCount++;
         }
         
+        RBTraceEnd(span, (RBTraceMetrics){.numberOfRules = RBFilterGroupRulesCount(rulesMap)});
         completionHandler(error);
     }] withPendingUnitCount:9];
     
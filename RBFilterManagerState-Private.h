@@ -26,6 +26,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property(nonatomic,setter=_setFilters:) NSArray<RBFilter*> *filters;
 
+/// Bumped whenever the stored filters change (in this process or another one).
+@property(nonatomic,readonly) uint64_t _filtersGeneration;
+
 // Non-persistent (exposed for testing)
 @property(nonatomic,setter=_setCooldownInterval:) NSTimeInterval _cooldownInterval;
 @property(nonatomic,setter=_setMaxCooldownInterval:) NSTimeInterval _maxCooldownInterval;
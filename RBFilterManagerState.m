@@ -6,20 +6,73 @@
 //  Copyright © 2019 Young Dynasty. All rights reserved.
 //
 
+#include <math.h>
+
 #import "RBFilterManagerState-Private.h"
 #import "RBFilterGroup-Private.h"
 #import "RBFilter.h"
 #import "RBKVO.h"
 #import "RBUtils.h"
 #import "RBDatabase.h"
+#import "RBSharedMemory.h"
+
+#define NUMBER_OF_FILTER_GROUPS 4
+
+// Filter groups whose defaults are behind are read again every 100ms, for up to 5s
+static const int64_t RBFilterGroupReloadRetryDelay = NSEC_PER_SEC / 10;
+static const NSUInteger RBFilterGroupReloadMaxAttempts = 50;
+
+// Scalar values live in shared memory so they can be read without locks or going through the defaults. Dates are
+// relative to the reference date (NAN when unset). Values which are too large for shared memory (filters and filter
+// groups) are kept in the defaults and have a generation which is bumped whenever they're written. The defaults
+// propagate asynchronously, so both are stored along with their generation (see -filters and
+// -_reloadFilterGroupsIfNeeded).
+typedef struct {
+    bool initialized;
+    bool disabled;
+    int32_t synchronizeInterval;
+    uint64_t numberOfFailuresSinceLastSynchronize;
+    double nextSynchronizeDate;
+    double lastSynchronizeDate;
+    double lastSynchronizeAttemptDate;
+    
+    uint64_t filtersGeneration;
+    uint64_t filterGroupGenerations[NUMBER_OF_FILTER_GROUPS];
+} _RBStateValues;
+
+// The keys of the scalar values (which are also their keys in the defaults they're migrated from)
+static NSString *sharedValueKeys[] = {
+    @"synchronizeInterval",
+    @"disabled",
+    @"numberOfFailuresSinceLastSynchronize",
+    @"nextSynchronizeDate",
+    @"lastSynchronizeDate",
+    @"lastSynchronizeAttemptDate",
+};
+
+/// An immutable copy of the stored filters, stamped with the generation it belongs to
+@interface _RBFilterSnapshot : NSObject
+- (instancetype)initWithFilters:(NSArray<RBFilter*> *)filters generation:(uint64_t)generation;
+@property(nonatomic,readonly) NSArray<RBFilter*> *filters;
+@property(nonatomic,readonly) uint64_t generation;
+@end
+
+
+@interface RBFilterManagerState()
+// Readers load the snapshot without taking our lock; it's replaced whenever the stored value changes
+@property(atomic,nullable) _RBFilterSnapshot *_filterSnapshot;
+@end
 
-static void* txQueueProcessKey = &txQueueProcessKey;
 
 @implementation RBFilterManagerState {
     NSUserDefaults *_defaults;
     NSURL *_filterGroupDirectoryURL;
     NSSet<RBKVO*> *_observers;
-    dispatch_queue_t _txQueue;
+    RBSharedMemory *_sharedMemory;
+    BOOL _isSharedMemoryPersistent;
+    _RBStateValues _observedValues;
+    uint64_t _loadedFilterGroupGenerations[NUMBER_OF_FILTER_GROUPS]; // guarded by self
+    NSUInteger _numberOfFilterGroupReloadAttempts;
     dispatch_group_t _syncGroup;
     dispatch_source_t _debugSource;
 }
@@ -48,9 +101,6 @@ static void* txQueueProcessKey = &txQueueProcessKey;
     
     _defaults = defaults;
     _filterGroupDirectoryURL = filterGroupDirectoryURL;
-    
-    _txQueue = dispatch_queue_create("net.youngdynasty.net.radblock.manager-state.tx", DISPATCH_QUEUE_SERIAL_WITH_AUTORELEASE_POOL);
-    dispatch_queue_set_specific(_txQueue, txQueueProcessKey, (void*)1, NULL);
     _syncGroup = dispatch_group_create();
 
     _adsFilterGroup = [[RBAdsFilterGroup alloc] _initWithFileURL:[filterGroupDirectoryURL URLByAppendingPathComponent:@"ads.json"]];
@@ -59,12 +109,54 @@ static void* txQueueProcessKey = &txQueueProcessKey;
     _annoyanceFilterGroup = [[RBAnnoyanceFilterGroup alloc] _initWithFileURL:[filterGroupDirectoryURL URLByAppendingPathComponent:@"annoyance.json"]];
     _filterGroups = @[_adsFilterGroup, _regionalFilterGroup, _privacyFilterGroup, _annoyanceFilterGroup];
     
+    // The shared memory lives next to the filter groups, so each set of groups has its own state
+    NSURL *sharedMemoryURL = [filterGroupDirectoryURL.URLByDeletingLastPathComponent URLByAppendingPathComponent:@"manager-state.map"];
+    NSError *sharedMemoryError = nil;
+    
+    if ([[NSFileManager defaultManager] createDirectoryAtURL:filterGroupDirectoryURL.URLByDeletingLastPathComponent withIntermediateDirectories:YES attributes:nil error:&sharedMemoryError]) {
+        _sharedMemory = [[RBSharedMemory alloc] initWithFileURL:sharedMemoryURL length:sizeof(_RBStateValues) error:&sharedMemoryError];
+        _isSharedMemoryPersistent = (_sharedMemory != nil);
+    }
+    
+    if (_sharedMemory == nil) {
+        NSLog(@"Warning: Could not map shared state (changes won't be seen by other processes): %@", sharedMemoryError);
+        _sharedMemory = [[RBSharedMemory alloc] initWithFileURL:nil length:sizeof(_RBStateValues) error:NULL];
+    }
+    
+    // Migrate values from the defaults (and set default values, implicitly setting nextSynchronizeDate to now). The
+    // defaults aren't updated anymore, so they're removed once the values are safely in the mapped file.
+    [_sharedMemory writeUsingBlock:^(void *bytes) {
+        _RBStateValues *values = bytes;
+        if (!values->initialized) {
+            [self _loadValues:values fromDefaults:defaults];
+            
+            if (self->_isSharedMemoryPersistent) {
+                for (int i = 0, m = sizeof(sharedValueKeys) / sizeof(NSString*); i < m; i++) {
+                    [defaults removeObjectForKey:sharedValueKeys[i]];
+                }
+            }
+        }
+    }];
+    
+    [_sharedMemory readBytes:&_observedValues];
+    
+    __weak RBFilterManagerState *weakSelf = self;
+    _sharedMemory.changeHandler = ^{
+        [weakSelf _noteValuesDidChangeExternally:YES];
+    };
+    
     NSMutableSet<RBKVO*> *observers = [NSMutableSet set];
     
-    for (RBFilterGroup *group in _filterGroups) {
-        __block NSDictionary *plist = RBKindOfClassInDefaults(NSDictionary, defaults, _filterGroupKey(group)) ?: @{};
+    for (NSUInteger i = 0; i < NUMBER_OF_FILTER_GROUPS; i++) {
+        RBFilterGroup *group = _filterGroups[i];
+        __block NSDictionary *plist = _filterGroupPlistInDefaults(defaults, group, &_loadedFilterGroupGenerations[i]);
         [group _reloadWithPropertyList:plist];
         
+        // Groups stored without a generation are as current as they get
+        if (RBKindOfClassInDefaults(NSDictionary, defaults, _storedFilterGroupKey(group)) == nil) {
+            _loadedFilterGroupGenerations[i] = _observedValues.filterGroupGenerations[i];
+        }
+        
         [observers addObject:[RBKVO observe:self keyPath:[NSString stringWithFormat:@"%@.propertyList", _filterGroupKey(group)] usingBlock:^(RBFilterManagerState *self) {
             if ([plist isEqualToDictionary:group.propertyList]) {
                 return;
@@ -81,14 +173,8 @@ static void* txQueueProcessKey = &txQueueProcessKey;
     
     _observers = [observers copy];
     
-    for (int i = 0, m = sizeof(ipcBindings) / sizeof(NSString*); i < m; i++) {
-        [_defaults addObserver:self forKeyPath:ipcBindings[i] options:NSKeyValueObservingOptionNew context:ipcContext];
-    }
-    
-    // Set default values (and implicitly set nextSynchronizeDate to now)
-    if ([self _isSynchronizeIntervalEmpty]) {
-        self.synchronizeInterval = RBSynchronizeIntervalWeekly;
-    }
+    // Another process may have changed a group before its defaults reached us
+    [self _reloadFilterGroupsIfNeeded];
     
     return self;
 }
@@ -98,10 +184,6 @@ static void* txQueueProcessKey = &txQueueProcessKey;
 }
 
 - (void)dealloc {
-    for (int i = 0, m = sizeof(ipcBindings) / sizeof(NSString*); i < m; i++) {
-        [_defaults removeObserver:self forKeyPath:ipcBindings[i]];
-    }
-    
     for (RBKVO *observer in _observers) {
         [observer invalidate];
     }
@@ -113,155 +195,101 @@ static void* txQueueProcessKey = &txQueueProcessKey;
 
 #pragma mark -
 
-- (BOOL)_isSynchronizeIntervalEmpty {
-    return RBKindOfClassInDefaults(NSString, _defaults, @"synchronizeInterval") == nil;
-}
-
 - (RBSynchronizeInterval)synchronizeInterval {
-    return RBSynchronizeIntervalFromNSString(RBKindOfClassInDefaults(NSString, _defaults, @"synchronizeInterval"));
+    return self._values.synchronizeInterval;
 }
 
 - (void)setSynchronizeInterval:(RBSynchronizeInterval)synchronizeInterval {
-    [self _invokeBlockWithinInterProcessLock:^{
-        [self->_defaults setObject:NSStringFromRBSynchronizeInterval(synchronizeInterval) forKey:@"synchronizeInterval"];
-        [self _updateNextSynchronizeDate];
+    [self _updateValuesUsingBlock:^(_RBStateValues *values) {
+        values->synchronizeInterval = synchronizeInterval;
+        [self _updateNextSynchronizeDate:values];
     }];
 }
 
 - (BOOL)isDisabled {
-    return [_defaults boolForKey:@"disabled"];
+    return self._values.disabled;
 }
 
 - (void)setDisabled:(BOOL)disabled {
-    [self _invokeBlockWithinInterProcessLock:^{
-        [self->_defaults setBool:disabled forKey:@"disabled"];
-        [self _updateNextSynchronizeDate];
+    [self _updateValuesUsingBlock:^(_RBStateValues *values) {
+        values->disabled = disabled;
+        [self _updateNextSynchronizeDate:values];
     }];
 }
 
 - (NSDate *)lastSynchronizeDate {
-    NSDate *date = RBKindOfClassInDefaults(NSDate, _defaults, @"lastSynchronizeDate");
-    if (date != nil) {
-        return date;
-    }
-    
-    // Tests use integers (the defaults CLI doesn't write dates properly)
-    NSNumber *timestamp = RBKindOfClassInDefaults(NSNumber, _defaults, @"lastSynchronizeDate");
-    if (timestamp != nil) {
-        return [NSDate dateWithTimeIntervalSince1970:[timestamp doubleValue]];
-    }
-    
-    return nil;
+    return _dateFromValue(self._values.lastSynchronizeDate);
 }
 
 - (void)_setLastSynchronizeDate:(NSDate *)newValue {
-    [self _invokeBlockWithinInterProcessLock:^{
-        if (newValue != nil) {
-            [self->_defaults setObject:newValue forKey:@"lastSynchronizeDate"];
-        } else {
-            [self->_defaults removeObjectForKey:@"lastSynchronizeDate"];
-        }
-        
-        [self _setNumberOfFailuresSinceLastSynchronize:0];
-        [self _updateNextSynchronizeDate];
+    [self _updateValuesUsingBlock:^(_RBStateValues *values) {
+        values->lastSynchronizeDate = _valueFromDate(newValue);
+        values->numberOfFailuresSinceLastSynchronize = 0;
+        [self _updateNextSynchronizeDate:values];
     }];
 }
 
 - (NSDate *)lastSynchronizeAttemptDate {
-    NSDate *date = RBKindOfClassInDefaults(NSDate, _defaults, @"lastSynchronizeAttemptDate");
-    if (date != nil) {
-        return date;
-    }
-    
-    // Tests use integers (the defaults CLI doesn't write dates properly)
-    NSNumber *timestamp = RBKindOfClassInDefaults(NSNumber, _defaults, @"lastSynchronizeAttemptDate");
-    if (timestamp != nil) {
-        return [NSDate dateWithTimeIntervalSince1970:[timestamp doubleValue]];
-    }
-    
-    return nil;
+    return _dateFromValue(self._values.lastSynchronizeAttemptDate);
 }
 
 - (void)_setLastSynchronizeAttemptDate:(NSDate *)newValue {
-    [self _invokeBlockWithinInterProcessLock:^{
-        if (newValue != nil) {
-            [self->_defaults setObject:newValue forKey:@"lastSynchronizeAttemptDate"];
-        } else {
-            [self->_defaults removeObjectForKey:@"lastSynchronizeAttemptDate"];
-        }
+    [self _updateValuesUsingBlock:^(_RBStateValues *values) {
+        values->lastSynchronizeAttemptDate = _valueFromDate(newValue);
     }];
 }
 
 - (NSDate *)nextSynchronizeDate {
-    NSDate *date = RBKindOfClassInDefaults(NSDate, _defaults, @"nextSynchronizeDate");
-    if (date != nil) {
-        return date;
-    }
-
-    // Tests use integers (the defaults CLI doesn't write dates properly)
-    NSNumber *timestamp = RBKindOfClassInDefaults(NSNumber, _defaults, @"nextSynchronizeDate");
-    if (timestamp != nil) {
-        return [NSDate dateWithTimeIntervalSince1970:[timestamp doubleValue]];
-    }
-    
-    return nil;
+    return _dateFromValue(self._values.nextSynchronizeDate);
 }
 
 - (void)_setNextSynchronizeDate:(NSDate *)newValue {
-    [self _invokeBlockWithinInterProcessLock:^{
-        if (newValue != nil) {
-            [self->_defaults setObject:newValue forKey:@"nextSynchronizeDate"];
-        } else {
-            [self->_defaults removeObjectForKey:@"nextSynchronizeDate"];
-        }
+    [self _updateValuesUsingBlock:^(_RBStateValues *values) {
+        values->nextSynchronizeDate = _valueFromDate(newValue);
     }];
 }
 
-- (void)_updateNextSynchronizeDate {
-    if (self.isDisabled) {
-        self.nextSynchronizeDate = nil;
+- (void)_updateNextSynchronizeDate:(_RBStateValues *)values {
+    if (values->disabled) {
+        values->nextSynchronizeDate = NAN;
         return;
     }
     
-    RBSynchronizeInterval interval = self.synchronizeInterval;
+    RBSynchronizeInterval interval = values->synchronizeInterval;
     NSDateComponents *dateComponents = NSDateComponentsFromRBSynchronizeInterval(interval);
     if (interval == RBSynchronizeIntervalDisabled || dateComponents == nil) {
-        self.nextSynchronizeDate = nil;
+        values->nextSynchronizeDate = NAN;
         return;
     }
     
-    NSTimeInterval cooldown = self._currentCooldown;
-    NSDate *lastSynchronizeDate = self.lastSynchronizeDate;
-    NSDate *lastSynchronizeAttemptDate = self.lastSynchronizeAttemptDate;
+    NSTimeInterval cooldown = [self _cooldownForNumberOfFailures:values->numberOfFailuresSinceLastSynchronize];
+    NSDate *lastSynchronizeDate = _dateFromValue(values->lastSynchronizeDate);
+    NSDate *lastSynchronizeAttemptDate = _dateFromValue(values->lastSynchronizeAttemptDate);
+    NSDate *nextSynchronizeDate = nil;
     
     if (cooldown > 0) {
-        self.nextSynchronizeDate = [lastSynchronizeAttemptDate ?: [NSDate date] dateByAddingTimeInterval:cooldown];
+        nextSynchronizeDate = [lastSynchronizeAttemptDate ?: [NSDate date] dateByAddingTimeInterval:cooldown];
     } else if (lastSynchronizeAttemptDate == nil) {
-        self.nextSynchronizeDate = [NSDate date];
+        nextSynchronizeDate = [NSDate date];
     } else {
-        self.nextSynchronizeDate = [[NSCalendar currentCalendar] dateByAddingComponents:dateComponents toDate:lastSynchronizeDate ?: [NSDate date] options:0];
+        nextSynchronizeDate = [[NSCalendar currentCalendar] dateByAddingComponents:dateComponents toDate:lastSynchronizeDate ?: [NSDate date] options:0];
     }
+    
+    values->nextSynchronizeDate = _valueFromDate(nextSynchronizeDate);
 }
 
 - (NSUInteger)numberOfFailuresSinceLastSynchronize {
-    NSNumber *v = RBKindOfClassInDefaults(NSNumber, _defaults, @"numberOfFailuresSinceLastSynchronize");
-    return v != nil ? [v unsignedIntegerValue] : 0;
+    return (NSUInteger)self._values.numberOfFailuresSinceLastSynchronize;
 }
 
 - (void)_setNumberOfFailuresSinceLastSynchronize:(NSUInteger)newValue {
-    [self _invokeBlockWithinInterProcessLock:^{
-        if (newValue == 0) {
-            [self->_defaults removeObjectForKey:@"numberOfFailuresSinceLastSynchronize"];
-        } else {
-            [self->_defaults setObject:@(newValue) forKey:@"numberOfFailuresSinceLastSynchronize"];
-        }
-        
-        [self _updateNextSynchronizeDate];
+    [self _updateValuesUsingBlock:^(_RBStateValues *values) {
+        values->numberOfFailuresSinceLastSynchronize = newValue;
+        [self _updateNextSynchronizeDate:values];
     }];
 }
 
-- (NSTimeInterval)_currentCooldown {
-    NSUInteger numAttempts = self.numberOfFailuresSinceLastSynchronize;
+- (NSTimeInterval)_cooldownForNumberOfFailures:(NSUInteger)numAttempts {
     if (numAttempts == 0) {
         return -1;
     }
@@ -280,11 +308,15 @@ static void* txQueueProcessKey = &txQueueProcessKey;
 }
 
 - (NSArray *)filters {
-    NSArray *filterPlists = RBKindOfClassInDefaults(NSArray, _defaults, @"filters");
-    if (filterPlists == nil) {
-        return @[];
+    uint64_t generation = self._filtersGeneration;
+    
+    _RBFilterSnapshot *snapshot = self._filterSnapshot;
+    if (snapshot != nil && snapshot.generation == generation) {
+        return snapshot.filters;
     }
     
+    uint64_t storedGeneration = 0;
+    NSArray *filterPlists = _filterPlistsInDefaults(_defaults, &storedGeneration);
     NSMutableArray *filters = [NSMutableArray array];
     
     for (id plist in filterPlists) {
@@ -298,93 +330,340 @@ static void* txQueueProcessKey = &txQueueProcessKey;
         }
     }
     
-    return [filters copy];
+    // The snapshot is stamped with the generation of what we actually read. If the defaults haven't caught up with the
+    // shared generation yet, it won't match and is read again next time.
+    snapshot = [[_RBFilterSnapshot alloc] initWithFilters:filters generation:storedGeneration];
+    [self _publishFilterSnapshot:snapshot];
+    
+    return snapshot.filters;
 }
 
 - (void)_setFilters:(NSArray<RBFilter*> *)newValue {
-    [self _invokeBlockWithinInterProcessLock:^{
-        if (newValue.count != 0) {
-            [self->_defaults setObject:[newValue valueForKeyPath:@"propertyList"] forKey:@"filters"];
-        } else {
+    NSArray *filters = [newValue copy] ?: @[];
+    NSArray *filterPlists = [filters valueForKeyPath:@"propertyList"];
+    __block uint64_t generation = 0;
+    
+    [_sharedMemory writeUsingBlock:^(void *bytes) {
+        _RBStateValues *values = bytes;
+        
+        // Avoid rewriting (and notifying other processes about) the same list
+        BOOL changed = ![_filterPlistsInDefaults(self->_defaults, NULL) isEqualToArray:filterPlists];
+        
+        if (changed) {
+            values->filtersGeneration++;
+            
+            // The generation is written with the filters, so readers can tell whether the defaults are up to date
+            [self->_defaults setObject:@{@"generation": @(values->filtersGeneration), @"filters": filterPlists} forKey:@"filterList"];
             [self->_defaults removeObjectForKey:@"filters"];
         }
+        
+        generation = values->filtersGeneration;
     }];
+    
+    [self _publishFilterSnapshot:[[_RBFilterSnapshot alloc] initWithFilters:filters generation:generation]];
+    [self _noteValuesDidChangeExternally:NO];
+}
+
+/// Filters used to be stored without a generation (under "filters")
+static NSArray *_filterPlistsInDefaults(NSUserDefaults *defaults, uint64_t *outGeneration) {
+    NSDictionary *filterList = RBKindOfClassInDefaults(NSDictionary, defaults, @"filterList");
+    NSArray *filterPlists = nil;
+    uint64_t generation = 0;
+    
+    if (filterList != nil) {
+        filterPlists = RBKindOfClassOrNil(NSArray, filterList[@"filters"]);
+        generation = [RBKindOfClassOrNil(NSNumber, filterList[@"generation"]) unsignedLongLongValue];
+    } else {
+        filterPlists = RBKindOfClassInDefaults(NSArray, defaults, @"filters");
+    }
+    
+    if (outGeneration != NULL) {
+        (*outGeneration) = generation;
+    }
+    
+    return filterPlists ?: @[];
+}
+
+- (uint64_t)_filtersGeneration {
+    return self._values.filtersGeneration;
+}
+
+- (void)_publishFilterSnapshot:(_RBFilterSnapshot *)snapshot {
+    @synchronized (self) {
+        _RBFilterSnapshot *currentSnapshot = self._filterSnapshot;
+        if (currentSnapshot == nil || currentSnapshot.generation < snapshot.generation) {
+            self._filterSnapshot = snapshot;
+        }
+    }
 }
 
 static inline NSString *_filterGroupKey(RBFilterGroup *filterGroup) {
     return [filterGroup.name stringByAppendingString:@"FilterGroup"];
 }
 
+/// Filter groups used to be stored without a generation (under their key path)
+static inline NSString *_storedFilterGroupKey(RBFilterGroup *filterGroup) {
+    return [filterGroup.name stringByAppendingString:@"FilterGroupEntry"];
+}
+
+static NSDictionary *_filterGroupPlistInDefaults(NSUserDefaults *defaults, RBFilterGroup *filterGroup, uint64_t *outGeneration) {
+    NSDictionary *entry = RBKindOfClassInDefaults(NSDictionary, defaults, _storedFilterGroupKey(filterGroup));
+    NSDictionary *plist = nil;
+    uint64_t generation = 0;
+    
+    if (entry != nil) {
+        plist = RBKindOfClassOrNil(NSDictionary, entry[@"propertyList"]);
+        generation = [RBKindOfClassOrNil(NSNumber, entry[@"generation"]) unsignedLongLongValue];
+    } else {
+        plist = RBKindOfClassInDefaults(NSDictionary, defaults, _filterGroupKey(filterGroup));
+    }
+    
+    if (outGeneration != NULL) {
+        (*outGeneration) = generation;
+    }
+    
+    return plist ?: @{};
+}
+
 - (void)_noteFilterGroupDidChange:(RBFilterGroup *)filterGroup {
-    [self _invokeBlockWithinInterProcessLock:^{
-        [self->_defaults setObject:filterGroup.propertyList forKey:_filterGroupKey(filterGroup)];
+    NSUInteger index = [_filterGroups indexOfObjectIdenticalTo:filterGroup];
+    __block uint64_t generation = 0;
+    
+    [_sharedMemory writeUsingBlock:^(void *bytes) {
+        _RBStateValues *values = bytes;
+        
+        generation = ++values->filterGroupGenerations[index];
+        
+        // The generation is written with the group, so readers can tell whether the defaults are up to date
+        [self->_defaults setObject:@{@"generation": @(generation), @"propertyList": filterGroup.propertyList} forKey:_storedFilterGroupKey(filterGroup)];
+        [self->_defaults removeObjectForKey:_filterGroupKey(filterGroup)];
     }];
+    
+    @synchronized (self) {
+        _loadedFilterGroupGenerations[index] = MAX(_loadedFilterGroupGenerations[index], generation);
+    }
+    
+    [self _noteValuesDidChangeExternally:NO];
+}
+
+/// Reloads groups which another process has changed. Groups whose defaults haven't caught up with the shared generation
+/// yet are left alone and tried again shortly, so a stale read is never applied.
+- (void)_reloadFilterGroupsIfNeeded {
+    _RBStateValues values = self._values;
+    BOOL shouldRetry = NO;
+    
+    for (NSUInteger i = 0; i < NUMBER_OF_FILTER_GROUPS; i++) {
+        @synchronized (self) {
+            if (_loadedFilterGroupGenerations[i] >= values.filterGroupGenerations[i]) {
+                continue;
+            }
+        }
+        
+        RBFilterGroup *filterGroup = _filterGroups[i];
+        uint64_t storedGeneration = 0;
+        NSDictionary *plist = _filterGroupPlistInDefaults(_defaults, filterGroup, &storedGeneration);
+        
+        if (storedGeneration < values.filterGroupGenerations[i]) {
+            shouldRetry = YES;
+            continue;
+        }
+        
+        @synchronized (self) {
+            _loadedFilterGroupGenerations[i] = storedGeneration;
+        }
+        
+        [filterGroup _reloadWithPropertyList:plist];
+    }
+    
+    NSUInteger attempt = 0;
+    @synchronized (self) {
+        attempt = shouldRetry ? ++_numberOfFilterGroupReloadAttempts : (_numberOfFilterGroupReloadAttempts = 0);
+    }
+    
+    // Give up after a few seconds; the next change picks the groups up again
+    if (shouldRetry && attempt <= RBFilterGroupReloadMaxAttempts) {
+        __weak RBFilterManagerState *weakSelf = self;
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, RBFilterGroupReloadRetryDelay), dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            [weakSelf _reloadFilterGroupsIfNeeded];
+        });
+    }
 }
 
 - (void)_waitUntilSynchronized {
     dispatch_group_wait(_syncGroup, DISPATCH_TIME_FOREVER);
 }
 
-#pragma mark - IPC
+#pragma mark - Shared values
 
-static NSString *ipcBindings[] = {
-    @"synchronizeInterval",
-    @"numberOfFailuresSinceLastSynchronize",
-    @"nextSynchronizeDate",
-    @"lastSynchronizeDate",
-    @"lastSynchronizeAttemptDate",
-    @"filters",
-    @"adsFilterGroup",
-    @"regionalFilterGroup",
-    @"privacyFilterGroup",
-    @"annoyanceFilterGroup",
-};
-static void* ipcContext = &ipcContext;
+static inline NSDate *_dateFromValue(double value) {
+    return isnan(value) ? nil : [NSDate dateWithTimeIntervalSinceReferenceDate:value];
+}
 
-- (void)observeValueForKeyPath:(NSString *)keyPath ofObject:(id)object change:(NSDictionary<NSKeyValueChangeKey,id> *)change context:(void *)context {
-    if (context != ipcContext) {
-        return [super observeValueForKeyPath:keyPath ofObject:object change:change context:context];
+static inline double _valueFromDate(NSDate *date) {
+    return date != nil ? date.timeIntervalSinceReferenceDate : NAN;
+}
+
+static NSDate *_dateInDefaults(NSUserDefaults *defaults, NSString *key) {
+    NSDate *date = RBKindOfClassInDefaults(NSDate, defaults, key);
+    if (date != nil) {
+        return date;
     }
     
-    // Ignore mutations from within our process (assume we have one shared state instance per process)
-    if (dispatch_get_specific(txQueueProcessKey) != NULL) {
-        return;
+    // Tests use integers (the defaults CLI doesn't write dates properly)
+    NSNumber *timestamp = RBKindOfClassInDefaults(NSNumber, defaults, key);
+    if (timestamp != nil) {
+        return [NSDate dateWithTimeIntervalSince1970:[timestamp doubleValue]];
     }
     
-    // Defer group changes (and KVO compliance) to their respective values
-    if ([keyPath hasSuffix:@"FilterGroup"]) {
-        RBFilterGroup *filterGroup = RBKindOfClassOrNil(RBFilterGroup, [self valueForKeyPath:keyPath]);
-        if (filterGroup != nil) {
-            id newValue = change ? change[NSKeyValueChangeNewKey] : [_defaults objectForKey:keyPath];
-            
-            return dispatch_async(dispatch_get_main_queue(), ^{
-                NSDictionary *plist = RBKindOfClassOrNil(NSDictionary, newValue) ?: @{};
-                [filterGroup _reloadWithPropertyList:plist];
-            });
-        }
+    return nil;
+}
+
+- (_RBStateValues)_values {
+    _RBStateValues values;
+    [_sharedMemory readBytes:&values];
+    return values;
+}
+
+- (void)_loadValues:(_RBStateValues *)values fromDefaults:(NSUserDefaults *)defaults {
+    values->initialized = true;
+    values->disabled = [defaults boolForKey:@"disabled"];
+    values->numberOfFailuresSinceLastSynchronize = [RBKindOfClassInDefaults(NSNumber, defaults, @"numberOfFailuresSinceLastSynchronize") unsignedLongLongValue];
+    values->lastSynchronizeDate = _valueFromDate(_dateInDefaults(defaults, @"lastSynchronizeDate"));
+    values->lastSynchronizeAttemptDate = _valueFromDate(_dateInDefaults(defaults, @"lastSynchronizeAttemptDate"));
+    values->nextSynchronizeDate = _valueFromDate(_dateInDefaults(defaults, @"nextSynchronizeDate"));
+    
+    // Keep counting from the stored generations, so the stored values are still recognized as up to date
+    _filterPlistsInDefaults(defaults, &values->filtersGeneration);
+    
+    for (NSUInteger i = 0; i < NUMBER_OF_FILTER_GROUPS; i++) {
+        _filterGroupPlistInDefaults(defaults, _filterGroups[i], &values->filterGroupGenerations[i]);
     }
     
-    // Generate KVO messages for other values
-    dispatch_async(dispatch_get_main_queue(), ^{
-        [self willChangeValueForKey:keyPath];
-        [self didChangeValueForKey:keyPath];
-    });
+    NSString *synchronizeInterval = RBKindOfClassInDefaults(NSString, defaults, @"synchronizeInterval");
+    
+    if (synchronizeInterval != nil) {
+        values->synchronizeInterval = RBSynchronizeIntervalFromNSString(synchronizeInterval);
+    } else {
+        values->synchronizeInterval = RBSynchronizeIntervalWeekly;
+        [self _updateNextSynchronizeDate:values];
+    }
+}
+
+- (void)_updateValuesUsingBlock:(void (NS_NOESCAPE ^)(_RBStateValues *values))block {
+    // Observers which ask for old values need -willChangeValueForKey: before the write, so apply the block to a copy
+    // first to find out which keys it changes
+    _RBStateValues values = self._values;
+    block(&values);
+    
+    _RBStateValues observedValues;
+    @synchronized (self) {
+        observedValues = _observedValues;
+    }
+    
+    NSArray<NSString*> *changedKeys = _changedValueKeys(observedValues, values);
+    
+    for (NSString *key in changedKeys) {
+        [self willChangeValueForKey:key];
+    }
+    
+    [_sharedMemory writeUsingBlock:^(void *bytes) {
+        block((_RBStateValues *)bytes);
+    }];
+    
+    [self _noteValuesDidChangeExternally:NO excludingKeys:changedKeys];
+    
+    for (NSString *key in changedKeys.reverseObjectEnumerator) {
+        [self didChangeValueForKey:key];
+    }
 }
 
-- (void)_invokeBlockWithinInterProcessLock:(void(^)(void))block {
-    // Invoke immediately if our process already owns a lock
-    if (dispatch_get_specific(txQueueProcessKey) != NULL) {
-        return block();
+#pragma mark - KVO
+
++ (BOOL)automaticallyNotifiesObserversForKey:(NSString *)key {
+    // Setters can change several values at once, so we notify observers about whatever they change ourselves
+    for (int i = 0, m = sizeof(sharedValueKeys) / sizeof(NSString*); i < m; i++) {
+        if ([key isEqualToString:sharedValueKeys[i]]) {
+            return NO;
+        }
     }
     
-    dispatch_sync(_txQueue, ^{
-        int lock = RBInterProcessLock(@"manager-state");
-        {
-            NSAssert(lock != -1, @"Could not open lock: %d", errno);
-            block();
+    return [super automaticallyNotifiesObserversForKey:key];
+}
+
+#define _RBStateValueChanged(a, b, field) (memcmp(&(a).field, &(b).field, sizeof((a).field)) != 0)
+
+static NSMutableArray<NSString*> *_changedValueKeys(_RBStateValues oldValues, _RBStateValues values) {
+    BOOL changes[] = {
+        _RBStateValueChanged(oldValues, values, synchronizeInterval),
+        _RBStateValueChanged(oldValues, values, disabled),
+        _RBStateValueChanged(oldValues, values, numberOfFailuresSinceLastSynchronize),
+        _RBStateValueChanged(oldValues, values, nextSynchronizeDate),
+        _RBStateValueChanged(oldValues, values, lastSynchronizeDate),
+        _RBStateValueChanged(oldValues, values, lastSynchronizeAttemptDate),
+    };
+    
+    NSMutableArray<NSString*> *changedKeys = [NSMutableArray array];
+    
+    for (int i = 0, m = sizeof(sharedValueKeys) / sizeof(NSString*); i < m; i++) {
+        if (changes[i]) {
+            [changedKeys addObject:sharedValueKeys[i]];
         }
-        RBInterProcessUnlock(lock);
-    });
+    }
+    
+    return changedKeys;
+}
+
+- (void)_noteValuesDidChangeExternally:(BOOL)external {
+    [self _noteValuesDidChangeExternally:external excludingKeys:nil];
+}
+
+/// Keys which are excluded have already been sent -willChangeValueForKey: (and are sent -didChangeValueForKey: by the caller)
+- (void)_noteValuesDidChangeExternally:(BOOL)external excludingKeys:(nullable NSArray<NSString*> *)excludedKeys {
+    _RBStateValues values = self._values;
+    _RBStateValues oldValues;
+    
+    @synchronized (self) {
+        oldValues = _observedValues;
+        _observedValues = values;
+    }
+    
+    NSMutableArray<NSString*> *changedKeys = _changedValueKeys(oldValues, values);
+    
+    if (excludedKeys != nil) {
+        [changedKeys removeObjectsInArray:excludedKeys];
+    }
+    
+    // Our own setters generate KVO messages for filters, and filter groups are already up to date
+    if (external && _RBStateValueChanged(oldValues, values, filtersGeneration)) {
+        [changedKeys addObject:@"filters"];
+    }
+    
+    for (NSString *key in changedKeys) {
+        [self willChangeValueForKey:key];
+    }
+    for (NSString *key in changedKeys.reverseObjectEnumerator) {
+        [self didChangeValueForKey:key];
+    }
+    
+    if (external && memcmp(oldValues.filterGroupGenerations, values.filterGroupGenerations, sizeof(values.filterGroupGenerations)) != 0) {
+        [self _reloadFilterGroupsIfNeeded];
+    }
+}
+
+@end
+
+
+@implementation _RBFilterSnapshot
+
+- (instancetype)initWithFilters:(NSArray<RBFilter *> *)filters generation:(uint64_t)generation {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    _filters = [filters copy];
+    _generation = generation;
+    
+    return self;
 }
 
 @end
@@ -0,0 +1,46 @@
+//
+//  RBMappedAllowlist.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class RBAllowlistEntry;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A compact, immutable copy of the allowlist which can be memory-mapped and searched without SQLite.
+/// Domains are stored lowercased with their labels reversed (i.e. "com.example.www") and sorted so that an entry and
+/// its parent domains can be found by binary search. The generation is the database's change sequence number.
+@interface RBMappedAllowlist : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (nullable instancetype)allowlistWithContentsOfURL:(NSURL *)fileURL error:(NSError **)outError;
+
+/// Atomically replaces the file at the URL unless it already contains a newer generation of the same database.
+/// The identifier is the database's own (up to 16 bytes), so a recreated database can replace what the old one wrote.
++ (BOOL)writeEntries:(NSArray<RBAllowlistEntry*> *)entries generation:(uint64_t)generation databaseIdentifier:(NSData *)databaseIdentifier toURL:(NSURL *)fileURL error:(NSError **)outError;
+
+@property(nonatomic,readonly) NSURL *fileURL;
+@property(nonatomic,readonly) uint64_t generation;
+@property(nonatomic,readonly) NSData *databaseIdentifier;
+@property(nonatomic,readonly) NSUInteger count;
+@property(nonatomic,readonly) NSArray<NSString*> *groupNames;
+
+/// NO once the file has been replaced by a newer snapshot (readers should map it again).
+@property(nonatomic,readonly,getter=isCurrent) BOOL current;
+
+/// Returns YES if the domain or one of its parent domains has an enabled entry which applies to the group.
+/// Entries without groups apply to all groups; a nil group matches any entry.
+- (BOOL)isDomainAllowlisted:(NSString *)domain forGroup:(nullable NSString *)groupName;
+
+/// Returns the domain of the closest entry for the domain or one of its parent domains.
+- (nullable NSString *)entryDomainMatchingDomain:(NSString *)domain groupNames:(NSArray<NSString*> *_Nullable *_Nullable)outGroupNames enabled:(nullable BOOL *)outEnabled;
+
+@end
+
+NS_ASSUME_NONNULL_END
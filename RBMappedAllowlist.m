@@ -0,0 +1,458 @@
+//
+//  RBMappedAllowlist.m
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import "RBMappedAllowlist.h"
+#import "RBAllowlistEntry.h"
+#import "RBUtils.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define RBMappedAllowlistMagic 0x4c414252 // "RBAL"
+#define RBMappedAllowlistVersion 2
+#define RBMappedAllowlistDatabaseIdentifierLength 16
+#define RBMappedAllowlistMaxKeyLength 256
+#define RBMappedAllowlistMaxGroups 64
+
+typedef NS_OPTIONS(uint16_t, RBMappedAllowlistFlags) {
+    RBMappedAllowlistFlagEnabled = 1 << 0,
+    RBMappedAllowlistFlagAllGroups = 1 << 1,
+};
+
+// All offsets are relative to the start of the file (except for keys, which are relative to the strings section)
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint64_t generation;
+    uint32_t fileSize;
+    uint32_t entryCount;
+    uint32_t groupCount;
+    uint32_t groupsOffset;
+    uint32_t recordsOffset;
+    uint32_t stringsOffset;
+    uint32_t stringsSize;
+    uint32_t reserved;
+    uint8_t databaseIdentifier[RBMappedAllowlistDatabaseIdentifierLength];
+} RBMappedAllowlistHeader;
+
+typedef struct {
+    uint32_t offset;
+    uint32_t length;
+} RBMappedAllowlistString;
+
+typedef struct {
+    uint32_t keyOffset;
+    uint16_t keyLength;
+    uint16_t flags;
+    uint64_t groups;
+} RBMappedAllowlistRecord;
+
+static NSError *_RBMappedAllowlistError(NSInteger code, NSURL *fileURL) {
+    return [NSError errorWithDomain:NSCocoaErrorDomain code:code userInfo:@{
+        NSFilePathErrorKey: fileURL.path,
+        NSUnderlyingErrorKey: [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil]
+    }];
+}
+
+/// Writes the lowercased domain with its labels reversed into the buffer (i.e. "www.Example.com" -> "com.example.www").
+/// Returns 0 if the domain is empty or too long.
+static size_t _RBMappedAllowlistCopyKey(NSString *domain, char buf[RBMappedAllowlistMaxKeyLength]) {
+    char domainBuf[RBMappedAllowlistMaxKeyLength];
+    NSUInteger length = 0;
+    NSRange remainingRange = NSMakeRange(0, 0);
+    
+    [domain getBytes:domainBuf maxLength:sizeof(domainBuf) usedLength:&length encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, domain.length) remainingRange:&remainingRange];
+    
+    if (remainingRange.length > 0) {
+        return 0;
+    }
+    
+    // Trim whitespace and trailing dots
+    const char *start = domainBuf;
+    const char *end = domainBuf + length;
+    
+    while (start < end && isspace((unsigned char)*start)) {
+        start++;
+    }
+    while (end > start && (isspace((unsigned char)end[-1]) || end[-1] == '.')) {
+        end--;
+    }
+    
+    size_t keyLength = 0;
+    
+    for (const char *labelEnd = end; labelEnd > start;) {
+        const char *labelStart = labelEnd;
+        while (labelStart > start && labelStart[-1] != '.') {
+            labelStart--;
+        }
+        
+        if (keyLength > 0) {
+            buf[keyLength++] = '.';
+        }
+        
+        for (const char *c = labelStart; c < labelEnd; c++) {
+            buf[keyLength++] = (*c >= 'A' && *c <= 'Z') ? (*c | 0x20) : *c;
+        }
+        
+        labelEnd = labelStart > start ? labelStart - 1 : start;
+    }
+    
+    return keyLength;
+}
+
+static inline int _RBMappedAllowlistCompareKeys(const char *a, size_t aLength, const char *b, size_t bLength) {
+    int result = memcmp(a, b, MIN(aLength, bLength));
+    if (result == 0) {
+        return aLength < bLength ? -1 : (aLength > bLength ? 1 : 0);
+    }
+    return result;
+}
+
+
+@implementation RBMappedAllowlist {
+    void *_bytes;
+    size_t _size;
+    ino_t _inode;
+    dev_t _device;
+    
+    const RBMappedAllowlistHeader *_header;
+    const RBMappedAllowlistRecord *_records;
+    const char *_strings;
+}
+
+#pragma mark - Reading
+
++ (instancetype)allowlistWithContentsOfURL:(NSURL *)fileURL error:(NSError **)outError {
+    return [[self alloc] _initWithContentsOfURL:fileURL error:outError];
+}
+
+- (instancetype)_initWithContentsOfURL:(NSURL *)fileURL error:(NSError **)outError {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    _fileURL = fileURL;
+    
+    int fd = open(fileURL.fileSystemRepresentation, O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        if (outError != NULL) {
+            (*outError) = _RBMappedAllowlistError(errno == ENOENT ? NSFileReadNoSuchFileError : NSFileReadUnknownError, fileURL);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+        return nil;
+    }
+    
+    _size = (size_t)st.st_size;
+    _inode = st.st_ino;
+    _device = st.st_dev;
+    
+    if (_size >= sizeof(RBMappedAllowlistHeader)) {
+        // Files are replaced rather than modified, so the mapping stays valid for our lifetime
+        _bytes = mmap(NULL, _size, PROT_READ, MAP_SHARED, fd, 0);
+        if (_bytes == MAP_FAILED) {
+            _bytes = NULL;
+        }
+    }
+    
+    close(fd);
+    
+    if (_bytes == NULL || ![self _validate]) {
+        if (outError != NULL) {
+            (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadCorruptFileError userInfo:@{NSFilePathErrorKey: fileURL.path}];
+        }
+        return nil;
+    }
+    
+    return self;
+}
+
+- (void)dealloc {
+    if (_bytes != NULL) {
+        munmap(_bytes, _size);
+    }
+}
+
+- (BOOL)_validate {
+    const RBMappedAllowlistHeader *header = _bytes;
+    
+    if (header->magic != RBMappedAllowlistMagic || header->version != RBMappedAllowlistVersion || header->headerSize != sizeof(RBMappedAllowlistHeader) || header->fileSize != _size) {
+        return NO;
+    }
+    
+    if (header->groupCount > RBMappedAllowlistMaxGroups
+        || (uint64_t)header->groupsOffset + (uint64_t)header->groupCount * sizeof(RBMappedAllowlistString) > _size
+        || (uint64_t)header->recordsOffset + (uint64_t)header->entryCount * sizeof(RBMappedAllowlistRecord) > _size
+        || (uint64_t)header->stringsOffset + (uint64_t)header->stringsSize > _size
+        || header->recordsOffset % _Alignof(RBMappedAllowlistRecord) != 0
+        || header->groupsOffset % _Alignof(RBMappedAllowlistString) != 0) {
+        return NO;
+    }
+    
+    const RBMappedAllowlistRecord *records = (const void *)((const char *)_bytes + header->recordsOffset);
+    const RBMappedAllowlistString *groups = (const void *)((const char *)_bytes + header->groupsOffset);
+    
+    for (uint32_t i = 0; i < header->entryCount; i++) {
+        if ((uint64_t)records[i].keyOffset + records[i].keyLength > header->stringsSize) {
+            return NO;
+        }
+    }
+    
+    for (uint32_t i = 0; i < header->groupCount; i++) {
+        if ((uint64_t)groups[i].offset + groups[i].length > header->stringsSize) {
+            return NO;
+        }
+    }
+    
+    _header = header;
+    _records = records;
+    _strings = (const char *)_bytes + header->stringsOffset;
+    
+    return YES;
+}
+
+- (uint64_t)generation {
+    return _header->generation;
+}
+
+- (NSData *)databaseIdentifier {
+    return [NSData dataWithBytes:_header->databaseIdentifier length:sizeof(_header->databaseIdentifier)];
+}
+
+- (NSUInteger)count {
+    return _header->entryCount;
+}
+
+- (NSArray<NSString *> *)groupNames {
+    const RBMappedAllowlistString *groups = (const void *)((const char *)_bytes + _header->groupsOffset);
+    NSMutableArray *groupNames = [NSMutableArray arrayWithCapacity:_header->groupCount];
+    
+    for (uint32_t i = 0; i < _header->groupCount; i++) {
+        [groupNames addObject:[[NSString alloc] initWithBytes:_strings + groups[i].offset length:groups[i].length encoding:NSUTF8StringEncoding] ?: @""];
+    }
+    
+    return groupNames;
+}
+
+- (BOOL)isCurrent {
+    struct stat st;
+    return stat(_fileURL.fileSystemRepresentation, &st) == 0 && st.st_ino == _inode && st.st_dev == _device;
+}
+
+#pragma mark - Lookups
+
+- (const RBMappedAllowlistRecord *)_recordForKey:(const char *)key length:(size_t)length {
+    size_t lo = 0;
+    size_t hi = _header->entryCount;
+    
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const RBMappedAllowlistRecord *record = &_records[mid];
+        int result = _RBMappedAllowlistCompareKeys(_strings + record->keyOffset, record->keyLength, key, length);
+        
+        if (result == 0) {
+            return record;
+        } else if (result < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    
+    return NULL;
+}
+
+- (const RBMappedAllowlistRecord *)_recordMatchingDomain:(NSString *)domain {
+    char key[RBMappedAllowlistMaxKeyLength];
+    size_t length = _RBMappedAllowlistCopyKey(domain, key);
+    
+    // Since labels are reversed, parent domains are prefixes which end at a label boundary (most specific first)
+    for (size_t prefixLength = length; prefixLength > 0; prefixLength--) {
+        if (prefixLength != length && key[prefixLength] != '.') {
+            continue;
+        }
+        
+        const RBMappedAllowlistRecord *record = [self _recordForKey:key length:prefixLength];
+        if (record != NULL) {
+            return record;
+        }
+    }
+    
+    return NULL;
+}
+
+- (BOOL)isDomainAllowlisted:(NSString *)domain forGroup:(NSString *)groupName {
+    const RBMappedAllowlistRecord *record = [self _recordMatchingDomain:domain];
+    
+    if (record == NULL || (record->flags & RBMappedAllowlistFlagEnabled) == 0) {
+        return NO;
+    } else if (groupName == nil || (record->flags & RBMappedAllowlistFlagAllGroups) != 0) {
+        return YES;
+    }
+    
+    const RBMappedAllowlistString *groups = (const void *)((const char *)_bytes + _header->groupsOffset);
+    const char *groupNameBytes = groupName.UTF8String;
+    size_t groupNameLength = strlen(groupNameBytes);
+    
+    for (uint32_t i = 0; i < _header->groupCount; i++) {
+        if (groups[i].length == groupNameLength && memcmp(_strings + groups[i].offset, groupNameBytes, groupNameLength) == 0) {
+            return (record->groups & (1ULL << i)) != 0;
+        }
+    }
+    
+    return NO;
+}
+
+- (NSString *)entryDomainMatchingDomain:(NSString *)domain groupNames:(NSArray<NSString *> **)outGroupNames enabled:(BOOL *)outEnabled {
+    const RBMappedAllowlistRecord *record = [self _recordMatchingDomain:domain];
+    if (record == NULL) {
+        return nil;
+    }
+    
+    if (outEnabled != NULL) {
+        (*outEnabled) = (record->flags & RBMappedAllowlistFlagEnabled) != 0;
+    }
+    
+    if (outGroupNames != NULL) {
+        NSMutableArray *groupNames = nil;
+        
+        if ((record->flags & RBMappedAllowlistFlagAllGroups) == 0) {
+            groupNames = [NSMutableArray array];
+            [self.groupNames enumerateObjectsUsingBlock:^(NSString *groupName, NSUInteger i, BOOL *stop) {
+                if ((record->groups & (1ULL << i)) != 0) {
+                    [groupNames addObject:groupName];
+                }
+            }];
+        }
+        
+        (*outGroupNames) = [groupNames copy];
+    }
+    
+    // Reverse the labels back
+    NSArray *labels = [[[NSString alloc] initWithBytes:_strings + record->keyOffset length:record->keyLength encoding:NSUTF8StringEncoding] componentsSeparatedByString:@"."];
+    return [labels.reverseObjectEnumerator.allObjects componentsJoinedByString:@"."];
+}
+
+#pragma mark - Writing
+
++ (BOOL)writeEntries:(NSArray<RBAllowlistEntry *> *)entries generation:(uint64_t)generation databaseIdentifier:(NSData *)databaseIdentifier toURL:(NSURL *)fileURL error:(NSError **)outError {
+    // Assign bits to groups
+    NSMutableOrderedSet<NSString *> *groupNameSet = [NSMutableOrderedSet orderedSet];
+    for (RBAllowlistEntry *entry in entries) {
+        [groupNameSet addObjectsFromArray:entry.groupNames ?: @[]];
+    }
+    [groupNameSet sortUsingSelector:@selector(compare:)];
+    
+    if (groupNameSet.count > RBMappedAllowlistMaxGroups) {
+        if (outError != NULL) {
+            (*outError) = [NSError errorWithDomain:NSPOSIXErrorDomain code:ERANGE userInfo:nil];
+        }
+        return NO;
+    }
+    
+    NSMutableData *strings = [NSMutableData data];
+    NSMutableData *records = [NSMutableData dataWithCapacity:entries.count * sizeof(RBMappedAllowlistRecord)];
+    NSMutableData *groups = [NSMutableData dataWithCapacity:groupNameSet.count * sizeof(RBMappedAllowlistString)];
+    
+    for (NSString *groupName in groupNameSet) {
+        NSData *bytes = [groupName dataUsingEncoding:NSUTF8StringEncoding];
+        RBMappedAllowlistString string = { (uint32_t)strings.length, (uint32_t)bytes.length };
+        
+        [groups appendBytes:&string length:sizeof(string)];
+        [strings appendData:bytes];
+    }
+    
+    for (RBAllowlistEntry *entry in entries) {
+        char key[RBMappedAllowlistMaxKeyLength];
+        size_t keyLength = _RBMappedAllowlistCopyKey(entry.domain, key);
+        
+        if (keyLength == 0) {
+            continue;
+        }
+        
+        RBMappedAllowlistRecord record = {
+            .keyOffset = (uint32_t)strings.length,
+            .keyLength = (uint16_t)keyLength,
+            .flags = (entry.isEnabled ? RBMappedAllowlistFlagEnabled : 0) | (entry.groupNames == nil ? RBMappedAllowlistFlagAllGroups : 0),
+            .groups = 0
+        };
+        
+        for (NSString *groupName in entry.groupNames) {
+            record.groups |= (1ULL << [groupNameSet indexOfObject:groupName]);
+        }
+        
+        [records appendBytes:&record length:sizeof(record)];
+        [strings appendBytes:key length:keyLength];
+    }
+    
+    // Sort records by key
+    const char *stringBytes = strings.bytes;
+    qsort_b(records.mutableBytes, records.length / sizeof(RBMappedAllowlistRecord), sizeof(RBMappedAllowlistRecord), ^int(const void *a, const void *b) {
+        const RBMappedAllowlistRecord *recordA = a;
+        const RBMappedAllowlistRecord *recordB = b;
+        return _RBMappedAllowlistCompareKeys(stringBytes + recordA->keyOffset, recordA->keyLength, stringBytes + recordB->keyOffset, recordB->keyLength);
+    });
+    
+    RBMappedAllowlistHeader header = {
+        .magic = RBMappedAllowlistMagic,
+        .version = RBMappedAllowlistVersion,
+        .headerSize = sizeof(RBMappedAllowlistHeader),
+        .generation = generation,
+        .entryCount = (uint32_t)(records.length / sizeof(RBMappedAllowlistRecord)),
+        .groupCount = (uint32_t)groupNameSet.count,
+        .groupsOffset = sizeof(RBMappedAllowlistHeader),
+    };
+    header.recordsOffset = header.groupsOffset + (uint32_t)groups.length;
+    header.stringsOffset = header.recordsOffset + (uint32_t)records.length;
+    header.stringsSize = (uint32_t)strings.length;
+    header.fileSize = header.stringsOffset + header.stringsSize;
+    [databaseIdentifier getBytes:header.databaseIdentifier length:MIN(databaseIdentifier.length, sizeof(header.databaseIdentifier))];
+    
+    NSMutableData *data = [NSMutableData dataWithCapacity:header.fileSize];
+    [data appendBytes:&header length:sizeof(header)];
+    [data appendData:groups];
+    [data appendData:records];
+    [data appendData:strings];
+    
+    // Write next to the destination so that it can be renamed into place
+    NSURL *tempURL = [fileURL.URLByDeletingLastPathComponent URLByAppendingPathComponent:[NSString stringWithFormat:@".%@.%@", fileURL.lastPathComponent, [NSUUID UUID].UUIDString]];
+    
+    if (![data writeToURL:tempURL options:0 error:outError]) {
+        return NO;
+    }
+    
+    BOOL success = YES;
+    
+    // Writers in other processes may race us; never replace a newer generation of the same database (generations of
+    // a recreated database start over, so they can't be compared with the old ones)
+    int lock = RBInterProcessLock([@"mapped-allowlist-" stringByAppendingString:fileURL.lastPathComponent]);
+    {
+        RBMappedAllowlist *existingAllowlist = [RBMappedAllowlist allowlistWithContentsOfURL:fileURL error:NULL];
+        NSData *headerIdentifier = [NSData dataWithBytes:header.databaseIdentifier length:sizeof(header.databaseIdentifier)];
+        
+        if (existingAllowlist != nil && [existingAllowlist.databaseIdentifier isEqualToData:headerIdentifier] && existingAllowlist.generation > generation) {
+            unlink(tempURL.fileSystemRepresentation);
+        } else if (rename(tempURL.fileSystemRepresentation, fileURL.fileSystemRepresentation) != 0) {
+            if (outError != NULL) {
+                (*outError) = _RBMappedAllowlistError(NSFileWriteUnknownError, fileURL);
+            }
+            
+            unlink(tempURL.fileSystemRepresentation);
+            success = NO;
+        }
+    }
+    RBInterProcessUnlock(lock);
+    
+    return success;
+}
+
+@end
@@ -12,6 +12,10 @@
 #import "RBFilterManager.h"
 #import "RBFilterManagerState.h"
 #import "RBKVO.h"
+#import "RBTrace.h"
 #import "RBUtils.h"
 #import "RBDatabase.h"
 #import "RBAllowlistEntry.h"
+#import "RBAllowlistChange.h"
+#import "RBAllowlistSnapshot.h"
+#import "RBMappedAllowlist.h"
@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+#
+#  generate_uts46_tables.py
+#  RadBlock
+#
+#  Created by Mike Pulaski on 19/10/2026.
+#  Copyright © 2026 Young Dynasty. All rights reserved.
+#
+#  Generates uts46_tables.h, the lookup tables used by idna.c, from the Unicode Character Database:
+#
+#      curl -O https://www.unicode.org/Public/idna/15.1.0/IdnaMappingTable.txt
+#      curl -O https://www.unicode.org/Public/15.1.0/ucd/UnicodeData.txt
+#      curl -O https://www.unicode.org/Public/15.1.0/ucd/CompositionExclusions.txt
+#      Scripts/generate_uts46_tables.py --version 15.1.0 . > uts46_tables.h
+#
+#  Statuses are resolved for nontransitional processing with UseSTD3ASCIIRules=false (like WebKit's URL parser), so
+#  the tables only need to distinguish valid, mapped, ignored and disallowed code points. Every code point gets a
+#  property (status, UTS #46 mapping, canonical combining class and full canonical decomposition) through a two-stage
+#  trie, and canonical compositions are listed separately for NFC.
+
+import argparse
+import os
+import sys
+
+MAX_CODE_POINT = 0x10FFFF
+
+VALID, MAPPED, IGNORED, DISALLOWED = range(4)
+
+STATUSES = {
+    'valid': VALID,
+    'deviation': VALID,
+    'disallowed_STD3_valid': VALID,
+    'mapped': MAPPED,
+    'disallowed_STD3_mapped': MAPPED,
+    'ignored': IGNORED,
+    'disallowed': DISALLOWED,
+}
+
+# Hangul syllables are decomposed and composed algorithmically
+HANGUL_FIRST, HANGUL_LAST = 0xAC00, 0xD7A3
+
+
+def parse_ranges(path):
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+
+            fields = [field.strip() for field in line.split(';')]
+            first, _, last = fields[0].partition('..')
+            yield int(first, 16), int(last or first, 16), fields[1:]
+
+
+def load_mappings(path):
+    statuses = [DISALLOWED] * (MAX_CODE_POINT + 1)
+    mappings = {}
+
+    for first, last, fields in parse_ranges(path):
+        status = STATUSES[fields[0]]
+        mapping = tuple(int(cp, 16) for cp in fields[1].split()) if len(fields) > 1 else ()
+
+        for cp in range(first, last + 1):
+            statuses[cp] = status
+            if status == MAPPED:
+                mappings[cp] = mapping
+
+    return statuses, mappings
+
+
+def load_unicode_data(path):
+    classes = {}
+    decompositions = {}
+
+    for first, _, fields in parse_ranges(path):
+        if int(fields[2]):
+            classes[first] = int(fields[2])
+
+        # Compatibility decompositions are tagged, and UTS #46 mappings already include them
+        if fields[4] and not fields[4].startswith('<'):
+            decompositions[first] = tuple(int(cp, 16) for cp in fields[4].split())
+
+    return classes, decompositions
+
+
+def load_exclusions(path):
+    return {first for first, _, _ in parse_ranges(path)}
+
+
+def full_decomposition(cp, decompositions):
+    if cp not in decompositions:
+        return (cp,)
+    return tuple(d for part in decompositions[cp] for d in full_decomposition(part, decompositions))
+
+
+def compositions(decompositions, classes, exclusions):
+    pairs = []
+
+    for cp, decomposition in decompositions.items():
+        # Singletons and decompositions which start with a non-starter never compose (Full_Composition_Exclusion)
+        if len(decomposition) != 2 or cp in exclusions or classes.get(decomposition[0], 0) != 0:
+            continue
+        pairs.append((decomposition[0], decomposition[1], cp))
+
+    return sorted(pairs)
+
+
+class Pool:
+    """Deduplicated runs of code points, packed back to back."""
+
+    def __init__(self):
+        self.values = []
+        self.offsets = {}
+
+    def add(self, sequence):
+        if sequence not in self.offsets:
+            self.offsets[sequence] = len(self.values)
+            self.values.extend(sequence)
+        return self.offsets[sequence]
+
+
+def build_properties(statuses, mappings, classes, decompositions):
+    mapping_pool = Pool()
+    decomposition_pool = Pool()
+    properties = []
+    property_indexes = {}
+    values = []
+
+    for cp in range(MAX_CODE_POINT + 1):
+        status = statuses[cp]
+        mapping = mappings.get(cp, ())
+
+        # Single code point mappings are stored as a delta, so that (for instance) all of A-Z share a property
+        if status == MAPPED and len(mapping) == 1:
+            mapping_value = (mapping[0] - cp) & 0x1FFFFFF
+        elif status == MAPPED and len(mapping) > 1:
+            mapping_value = mapping_pool.add(mapping)
+        else:
+            mapping_value = 0
+
+        assert len(mapping) < 32, 'Mapping is too long'
+        packed_mapping = status | (len(mapping) << 2) | (mapping_value << 7)
+
+        decomposition = ()
+        if cp in decompositions and not HANGUL_FIRST <= cp <= HANGUL_LAST:
+            decomposition = full_decomposition(cp, decompositions)
+
+        assert len(decomposition) < 8, 'Decomposition is too long'
+        packed_decomposition = len(decomposition) | (decomposition_pool.add(decomposition) << 3 if decomposition else 0)
+        assert packed_decomposition <= 0xFFFF, 'Decomposition pool is too large'
+
+        prop = (packed_mapping, packed_decomposition, classes.get(cp, 0))
+        if prop not in property_indexes:
+            property_indexes[prop] = len(properties)
+            properties.append(prop)
+        values.append(property_indexes[prop])
+
+    assert len(properties) <= 0xFFFF, 'Too many properties'
+    return properties, values, mapping_pool.values, decomposition_pool.values
+
+
+def build_trie(values, shift):
+    block_size = 1 << shift
+    blocks = []
+    block_indexes = {}
+    stage1 = []
+
+    for start in range(0, len(values), block_size):
+        block = tuple(values[start:start + block_size])
+        if block not in block_indexes:
+            block_indexes[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_indexes[block])
+
+    stage2 = [value for block in blocks for value in block]
+    return stage1, stage2
+
+
+def smallest_trie(values):
+    tries = []
+
+    for shift in range(4, 11):
+        stage1, stage2 = build_trie(values, shift)
+        if len(stage2) >> shift <= 0xFFFF:
+            tries.append((2 * len(stage1) + 2 * len(stage2), shift, stage1, stage2))
+
+    return min(tries)[1:]
+
+
+def format_array(declaration, values, per_line, width):
+    lines = ['static const %s = {' % declaration]
+    for start in range(0, len(values), per_line):
+        lines.append('  ' + ' '.join('0x%0*X,' % (width, value) for value in values[start:start + per_line]))
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--version', required=True, help='Unicode version of the data files')
+    parser.add_argument('directory', help='Directory containing IdnaMappingTable.txt, UnicodeData.txt and CompositionExclusions.txt')
+    args = parser.parse_args()
+
+    statuses, mappings = load_mappings(os.path.join(args.directory, 'IdnaMappingTable.txt'))
+    classes, decompositions = load_unicode_data(os.path.join(args.directory, 'UnicodeData.txt'))
+    exclusions = load_exclusions(os.path.join(args.directory, 'CompositionExclusions.txt'))
+
+    properties, values, mapping_pool, decomposition_pool = build_properties(statuses, mappings, classes, decompositions)
+    shift, stage1, stage2 = smallest_trie(values)
+    pairs = compositions(decompositions, classes, exclusions)
+
+    out = sys.stdout
+    out.write('//\n')
+    out.write('//  uts46_tables.h\n')
+    out.write('//  RadBlock\n')
+    out.write('//\n')
+    out.write('//  Generated by Scripts/generate_uts46_tables.py from Unicode %s data. Do not edit.\n' % args.version)
+    out.write('//\n\n')
+    out.write('#ifndef uts46_tables_h\n#define uts46_tables_h\n\n')
+    out.write('#include <stdint.h>\n\n')
+    out.write('#define UTS46_UNICODE_VERSION "%s"\n\n' % args.version)
+    out.write('/* Statuses for nontransitional processing with UseSTD3ASCIIRules=false */\n')
+    out.write('enum { uts46_valid, uts46_mapped, uts46_ignored, uts46_disallowed };\n\n')
+    out.write('/* mapping:       status (bits 0-1), length (bits 2-6), then a signed delta for single code points  */\n')
+    out.write('/*                or an offset into uts46_mappings (bits 7-31)                                      */\n')
+    out.write('/* decomposition: length (bits 0-2), then an offset into uts46_decompositions (bits 3-15)          */\n')
+    out.write('typedef struct {\n  uint32_t mapping;\n  uint16_t decomposition;\n  uint8_t combining_class;\n} uts46_property;\n\n')
+    out.write('#define UTS46_SHIFT %d\n\n' % shift)
+    out.write(format_array('uint16_t uts46_stage1[%d]' % len(stage1), stage1, 12, 4) + '\n\n')
+    out.write(format_array('uint16_t uts46_stage2[%d]' % len(stage2), stage2, 12, 4) + '\n\n')
+
+    out.write('static const uts46_property uts46_properties[%d] = {\n' % len(properties))
+    for start in range(0, len(properties), 4):
+        out.write('  ' + ' '.join('{0x%08X, 0x%04X, %d},' % prop for prop in properties[start:start + 4]) + '\n')
+    out.write('};\n\n')
+
+    out.write(format_array('uint32_t uts46_mappings[%d]' % len(mapping_pool), mapping_pool, 8, 5) + '\n\n')
+    out.write(format_array('uint32_t uts46_decompositions[%d]' % len(decomposition_pool), decomposition_pool, 8, 5) + '\n\n')
+
+    out.write('/* Canonical compositions as {first, second, composite}, sorted by first and second */\n')
+    out.write('#define UTS46_MIN_COMPOSITION_SECOND 0x%X\n\n' % min(pair[1] for pair in pairs))
+    out.write('static const uint32_t uts46_compositions[%d][3] = {\n' % len(pairs))
+    for start in range(0, len(pairs), 3):
+        out.write('  ' + ' '.join('{0x%05X, 0x%05X, 0x%05X},' % pair for pair in pairs[start:start + 3]) + '\n')
+    out.write('};\n\n')
+    out.write('#endif /* uts46_tables_h */\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,178 @@
+//
+//  rb_allowlist_tests.c
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#define _GNU_SOURCE
+#undef NDEBUG
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "rb_allowlist.h"
+
+#define IGNORE_RULE "{\"action\":{\"type\":\"ignore-previous-rules\"},\"trigger\":{"
+
+typedef struct {
+  char rules[8][512];
+  size_t count, stop_after;
+} rule_list;
+
+static int collect_rule(void *context, const char *rule, size_t length)
+{
+  rule_list *list = context;
+
+  if (list->stop_after > 0 && list->count == list->stop_after) return 1;
+
+  assert(list->count < 8 && length < 512);
+  memcpy(list->rules[list->count], rule, length);
+  list->rules[list->count][length] = '\0';
+  list->count++;
+
+  return 0;
+}
+
+static int insert_entries(sqlite3 *db, void *context)
+{
+  static const char *const entries[][3] = {
+    {"aaa.com", "1", "ads"},
+    {"sub.aaa.com", "0", "ads"},
+    {"bbb.com", "1", "ads"},
+    {"x.bbb.com", "1", "ads"},
+    {"Y.BBB.COM", "1", "ads"},
+    {"ccc.org", "0", "ads"},
+    {"b\xc3\xbc" "cher.de", "1", "ads"},
+    {"ddd.net", "1", "*"},
+    {"eee.com", "1", "privacy"},
+  };
+  size_t i;
+  int status = SQLITE_DONE;
+
+  (void)context;
+
+  for (i = 0; i < sizeof(entries) / sizeof(entries[0]) && status == SQLITE_DONE; i++) {
+    const char *values[] = {entries[i][0], entries[i][1], entries[i][2]};
+
+    status = rb_sqlite_execute(db, "INSERT INTO exception VALUES (?1, ?2, 0, 0)", 2, values);
+    if (status == SQLITE_DONE) status = rb_sqlite_execute(db, "INSERT INTO exception_group VALUES (?1, ?3)", 3, values);
+  }
+
+  return status;
+}
+
+static sqlite3 *create_database(const char *path)
+{
+  sqlite3 *db = NULL;
+
+  assert(rb_sqlite_open(path, SQLITE_OPEN_CREATE | SQLITE_OPEN_READWRITE, &db) == SQLITE_OK);
+  assert(rb_sqlite_create_tables(db) == SQLITE_DONE);
+
+  assert(rb_sqlite_transaction(db, insert_entries, NULL) == SQLITE_DONE);
+  return db;
+}
+
+static void test_root_domain(void)
+{
+  size_t length;
+
+  assert(strcmp(rb_root_domain("a.b.example.com", 15, &length), "example.com") == 0 && length == 11);
+  assert(strcmp(rb_root_domain("example.com", 11, &length), "example.com") == 0 && length == 11);
+  assert(strcmp(rb_root_domain("localhost", 9, &length), "localhost") == 0 && length == 9);
+}
+
+static void test_sql_functions(sqlite3 *db)
+{
+  sqlite3_stmt *stmt = NULL;
+
+  assert(rb_sqlite_prepare(db, &stmt, "SELECT root_domain('x.y.Example.com'), in_domain('example.COM', 'www.example.com'), in_domain('www.example.com', 'example.com')", 0, NULL) == SQLITE_OK);
+  assert(sqlite3_step(stmt) == SQLITE_ROW);
+  assert(strcmp((const char *)sqlite3_column_text(stmt, 0), "Example.com") == 0);
+  assert(sqlite3_column_int(stmt, 1) == 1);
+  assert(sqlite3_column_int(stmt, 2) == 0);
+  sqlite3_finalize(stmt);
+}
+
+static void test_rules(sqlite3 *db)
+{
+  rule_list list = {0};
+
+  assert(rb_allowlist_enumerate_rules(db, "ads", 2, collect_rule, &list) == SQLITE_OK);
+  assert(list.count == 4);
+
+  /* The root domain is allowlisted, except for one of its subdomains */
+  assert(strcmp(list.rules[0], IGNORE_RULE "\"url-filter\":\"^[htpsw]+:\\\\/\\\\/([a-z0-9-]+\\\\.)*aaa\\\\.com[/:&?]?\",\"unless-domain\":[\"sub.aaa.com\"]}}") == 0);
+
+  /* Enabled entries are packed into rules in the database's order (root domains as stored, so uppercase first) */
+  assert(strcmp(list.rules[1], IGNORE_RULE "\"url-filter\":\".*\",\"if-domain\":[\"*y.bbb.com\",\"*bbb.com\"]}}") == 0);
+  assert(strcmp(list.rules[2], IGNORE_RULE "\"url-filter\":\".*\",\"if-domain\":[\"*x.bbb.com\",\"*xn--bcher-kva.de\"]}}") == 0);
+  assert(strcmp(list.rules[3], IGNORE_RULE "\"url-filter\":\".*\",\"if-domain\":[\"*ddd.net\"]}}") == 0);
+
+  /* Every group */
+  memset(&list, 0, sizeof(list));
+  assert(rb_allowlist_enumerate_rules(db, NULL, RB_ALLOWLIST_GROUP_SIZE, collect_rule, &list) == SQLITE_OK);
+  assert(list.count == 2);
+  assert(strstr(list.rules[1], "\"*eee.com\"") != NULL);
+
+  /* Entries for every group ("*") apply to groups without entries of their own */
+  memset(&list, 0, sizeof(list));
+  assert(rb_allowlist_enumerate_rules(db, "missing", 2, collect_rule, &list) == SQLITE_OK);
+  assert(list.count == 1 && strstr(list.rules[0], "[\"*ddd.net\"]") != NULL);
+}
+
+static void test_stop(sqlite3 *db)
+{
+  rule_list list = {0};
+
+  list.stop_after = 2;
+  assert(rb_allowlist_enumerate_rules(db, "ads", 2, collect_rule, &list) == SQLITE_OK);
+  assert(list.count == 2);
+}
+
+static void test_identifier(sqlite3 *db)
+{
+  sqlite3_stmt *stmt = NULL;
+  unsigned char identifier[16];
+
+  assert(rb_sqlite_prepare(db, &stmt, "SELECT value FROM metadata WHERE key = 'identifier'", 0, NULL) == SQLITE_OK);
+  assert(sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_bytes(stmt, 0) == sizeof(identifier));
+  memcpy(identifier, sqlite3_column_blob(stmt, 0), sizeof(identifier));
+  sqlite3_finalize(stmt);
+
+  /* Setting up the tables again keeps the identifier */
+  assert(rb_sqlite_create_tables(db) == SQLITE_DONE);
+  assert(rb_sqlite_prepare(db, &stmt, "SELECT value FROM metadata WHERE key = 'identifier'", 0, NULL) == SQLITE_OK);
+  assert(sqlite3_step(stmt) == SQLITE_ROW && memcmp(sqlite3_column_blob(stmt, 0), identifier, sizeof(identifier)) == 0);
+  sqlite3_finalize(stmt);
+}
+
+int main(void)
+{
+  char directory[] = "/tmp/rb-allowlist-XXXXXX";
+  char path[128], command[128];
+  sqlite3 *db;
+
+  assert(mkdtemp(directory) != NULL);
+  snprintf(path, sizeof(path), "%s/radblock.db", directory);
+
+  db = create_database(path);
+
+  test_root_domain();
+  test_sql_functions(db);
+  test_rules(db);
+  test_stop(db);
+  test_identifier(db);
+
+  sqlite3_close(db);
+
+  snprintf(command, sizeof(command), "rm -rf %s", directory);
+  assert(system(command) == 0);
+
+  puts("rb_allowlist_tests: ok");
+  return 0;
+}
@@ -0,0 +1,241 @@
+//
+//  rb_filter_builder_tests.c
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#define _GNU_SOURCE
+#undef NDEBUG
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "rb_filter_builder.h"
+#include "rb_zip.h"
+
+static const char *fixtures;
+static char directory[] = "/tmp/rb-filter-builder-XXXXXX";
+
+typedef struct {
+  char rules[16][256];
+  size_t count, stop_after;
+} rule_list;
+
+static int collect_rule(void *context, const char *rule, size_t length)
+{
+  rule_list *list = context;
+
+  assert(list->count < 16 && length < 256);
+  memcpy(list->rules[list->count], rule, length);
+  list->rules[list->count][length] = '\0';
+
+  return ++list->count == list->stop_after;
+}
+
+static const char *temporary_path(const char *name)
+{
+  static char paths[8][4096];
+  static size_t next;
+  char *path = paths[next++ % 8];
+
+  snprintf(path, 4096, "%s/%s", directory, name);
+  return path;
+}
+
+static const char *write_file(const char *name, const char *contents)
+{
+  const char *path = temporary_path(name);
+  FILE *file = fopen(path, "wb");
+
+  assert(file != NULL);
+  assert(fwrite(contents, 1, strlen(contents), file) == strlen(contents));
+  assert(fclose(file) == 0);
+
+  return path;
+}
+
+static int write_chunk(void *context, const uint8_t *bytes, size_t length)
+{
+  return fwrite(bytes, 1, length, context) == length ? Z_OK : Z_ERRNO;
+}
+
+static const char *write_compressed_file(const char *name, const char *contents)
+{
+  const char *path = temporary_path(name);
+  FILE *file = fopen(path, "wb");
+
+  assert(file != NULL);
+  assert(rb_zip_deflate((const uint8_t *)contents, strlen(contents), rb_zip_gzip, 1, write_chunk, file) == Z_OK);
+  assert(fclose(file) == 0);
+
+  return path;
+}
+
+static char *read_file(const char *path)
+{
+  static char contents[4096];
+  FILE *file = fopen(path, "rb");
+  size_t length;
+
+  assert(file != NULL);
+  length = fread(contents, 1, sizeof(contents) - 1, file);
+  contents[length] = '\0';
+  fclose(file);
+
+  return contents;
+}
+
+/*** Enumerating ***/
+
+static void test_splitter(void)
+{
+  const char *input = " [ {\"a\":\"x,]}\"} ,\n{\"b\":[1,{\"c\":\"\\\"\"}]},{\"d\":\"\\\\\"}, ] ";
+  rb_rule_splitter splitter;
+  rule_list list = {0};
+  size_t i;
+
+  /* Rules which span chunks (and escapes which span chunks) are stitched back together */
+  rb_rule_splitter_init(&splitter);
+  for (i = 0; input[i] != '\0'; i++) {
+    assert(rb_rule_splitter_feed(&splitter, (const uint8_t *)input + i, 1, collect_rule, &list));
+  }
+  assert(rb_rule_splitter_finish(&splitter) == rb_rules_success);
+  rb_rule_splitter_destroy(&splitter);
+
+  assert(list.count == 3);
+  assert(strcmp(list.rules[0], "{\"a\":\"x,]}\"}") == 0);
+  assert(strcmp(list.rules[1], "{\"b\":[1,{\"c\":\"\\\"\"}]}") == 0);
+  assert(strcmp(list.rules[2], "{\"d\":\"\\\\\"}") == 0);
+}
+
+static void test_enumerate_file(void)
+{
+  rule_list list = {0};
+  char path[4096];
+
+  snprintf(path, sizeof(path), "%s/blockerList.json", fixtures);
+  assert(rb_enumerate_rules(path, collect_rule, &list) == rb_rules_success);
+  assert(list.count == 1);
+
+  memset(&list, 0, sizeof(list));
+  assert(rb_enumerate_rules(write_compressed_file("compressed.json.gz", "[{\"a\":1},{\"b\":2}]"), collect_rule, &list) == rb_rules_success);
+  assert(list.count == 2 && strcmp(list.rules[1], "{\"b\":2}") == 0);
+
+  memset(&list, 0, sizeof(list));
+  list.stop_after = 1;
+  assert(rb_enumerate_rules(write_file("stop.json", "[{\"a\":1},{\"b\":2}"), collect_rule, &list) == rb_rules_success);
+  assert(list.count == 1);
+}
+
+static void test_enumerate_corrupt_file(void)
+{
+  rule_list list = {0};
+
+  assert(rb_enumerate_rules(write_file("object.json", "{\"a\":1}"), collect_rule, &list) == rb_rules_corrupt);
+  assert(rb_enumerate_rules(write_file("unclosed.json", "[{\"a\":1},"), collect_rule, &list) == rb_rules_corrupt);
+  assert(rb_enumerate_rules(write_file("trailing.json", "[{\"a\":1}] x"), collect_rule, &list) == rb_rules_corrupt);
+  assert(rb_enumerate_rules(temporary_path("missing.json"), collect_rule, &list) == rb_rules_io_error);
+}
+
+/*** Building ***/
+
+static void test_create(void)
+{
+  const char *paths[5];
+  const char *output = temporary_path("output.json");
+  rb_filter_builder builder;
+  rule_list list = {0};
+
+  paths[0] = write_file("a.json", "[\n  {\"a\":1}\n]\n");
+  paths[1] = write_compressed_file("b.json.gz", "[{\"b\":\"x,]\"}]");
+  paths[2] = write_file("empty.json", " [ ]\n");
+  paths[3] = write_file("c.json", "[{\"c\":3},\n{\"d\":4}]");
+  paths[4] = write_file("truncated.json", "[{\"e\":5}");
+
+  assert(rb_filter_builder_create(&builder, output, paths, 5) == rb_rules_success);
+  assert(rb_filter_builder_append_rule(&builder, "{\"f\":6}", 7) == rb_rules_success);
+  assert(rb_filter_builder_close(&builder) == rb_rules_success);
+
+  assert(strcmp(read_file(output), "[\n  {\"a\":1}\n,{\"b\":\"x,]\"},{\"c\":3},\n{\"d\":4},{\"e\":5},{\"f\":6}]") == 0);
+
+  assert(rb_enumerate_rules(output, collect_rule, &list) == rb_rules_success);
+  assert(list.count == 6);
+}
+
+static void test_create_from_compressed_file(void)
+{
+  const char *paths[2];
+  const char *output = temporary_path("compressed-output.json");
+  rb_filter_builder builder;
+
+  paths[0] = write_compressed_file("first.json.gz", "[{\"a\":1}]");
+  paths[1] = write_file("second.json", "[{\"b\":2}]");
+
+  assert(rb_filter_builder_create(&builder, output, paths, 2) == rb_rules_success);
+  assert(rb_filter_builder_close(&builder) == rb_rules_success);
+  assert(strcmp(read_file(output), "[{\"a\":1},{\"b\":2}]") == 0);
+
+  /* Without any files */
+  assert(rb_filter_builder_create(&builder, output, NULL, 0) == rb_rules_success);
+  assert(rb_filter_builder_append_rule(&builder, "{}", 2) == rb_rules_success);
+  assert(rb_filter_builder_close(&builder) == rb_rules_success);
+  assert(strcmp(read_file(output), "[{}]") == 0);
+}
+
+static void test_open(void)
+{
+  rb_filter_builder builder;
+  const char *path = write_file("existing.json", "[ ]  \n");
+
+  assert(rb_filter_builder_open(&builder, path) == rb_rules_success);
+  assert(rb_filter_builder_append_rule(&builder, "{\"a\":1}", 7) == rb_rules_success);
+  assert(rb_filter_builder_append_rule(&builder, "{\"b\":2}", 7) == rb_rules_success);
+  assert(builder.number_of_rules == 2);
+  assert(rb_filter_builder_flush(&builder) == rb_rules_success);
+  assert(rb_filter_builder_close(&builder) == rb_rules_success);
+  assert(strcmp(read_file(path), "[ {\"a\":1},{\"b\":2}]") == 0);
+
+  assert(rb_filter_builder_open(&builder, write_file("object.json", "{}")) == rb_rules_corrupt);
+  assert(rb_filter_builder_open(&builder, write_file("unclosed.json", "[{}")) == rb_rules_corrupt);
+  assert(rb_filter_builder_open(&builder, temporary_path("missing.json")) == rb_rules_io_error);
+}
+
+static void test_append_corrupt_file(void)
+{
+  rb_filter_builder builder;
+  const char *path = write_file("append-corrupt.json", "[{\"a\":1}]");
+
+  assert(rb_filter_builder_open(&builder, path) == rb_rules_success);
+  assert(rb_filter_builder_append_file(&builder, write_file("object.json", "{\"b\":2}")) == rb_rules_corrupt);
+  assert(rb_filter_builder_close(&builder) == rb_rules_success);
+
+  /* Nothing was written */
+  assert(strcmp(read_file(path), "[{\"a\":1}]") == 0);
+}
+
+int main(int argc, char *argv[])
+{
+  fixtures = argc > 1 ? argv[1] : "Tests";
+  assert(mkdtemp(directory) != NULL);
+
+  test_splitter();
+  test_enumerate_file();
+  test_enumerate_corrupt_file();
+  test_create();
+  test_create_from_compressed_file();
+  test_open();
+  test_append_corrupt_file();
+
+  char command[128];
+  snprintf(command, sizeof(command), "rm -rf %s", directory);
+  assert(system(command) == 0);
+
+  puts("rb_filter_builder_tests: ok");
+  return 0;
+}
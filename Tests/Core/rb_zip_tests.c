@@ -0,0 +1,186 @@
+//
+//  rb_zip_tests.c
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#undef NDEBUG
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include "rb_zip.h"
+
+static const char *fixtures;
+
+typedef struct {
+  uint8_t *bytes;
+  size_t length, capacity;
+  size_t calls, stop_after;
+} output_buffer;
+
+static int collect(void *context, const uint8_t *bytes, size_t length)
+{
+  output_buffer *output = context;
+
+  if (output->length + length > output->capacity) {
+    output->capacity = (output->length + length) * 2;
+    output->bytes = realloc(output->bytes, output->capacity);
+    assert(output->bytes != NULL);
+  }
+
+  memcpy(output->bytes + output->length, bytes, length);
+  output->length += length;
+
+  return (++output->calls == output->stop_after) ? Z_STREAM_END : Z_OK;
+}
+
+/* Text which compresses (like rules do), but not to nothing */
+
+static uint8_t *make_input(size_t length)
+{
+  static const char *const words[] = {"trigger", "action", "url-filter", "if-domain", "block", "css-display-none", "\"", ",", "{", "}"};
+  uint8_t *bytes = malloc(length + 1);
+  uint32_t seed = 42;
+  size_t i = 0;
+
+  while (i < length) {
+    const char *word;
+    size_t word_length;
+
+    seed = seed * 1103515245 + 12345;
+    word = words[(seed >> 16) % 10];
+    word_length = strlen(word) < length - i ? strlen(word) : length - i;
+
+    memcpy(bytes + i, word, word_length);
+    i += word_length;
+  }
+
+  return bytes;
+}
+
+static void test_is_compressed(void)
+{
+  const uint8_t gzip[] = {0x1f, 0x8b}, zlib[] = {0x78, 0x9c}, json[] = {'[', ']'};
+
+  assert(rb_zip_is_compressed(gzip, 2));
+  assert(rb_zip_is_compressed(zlib, 2));
+  assert(!rb_zip_is_compressed(json, 2));
+  assert(!rb_zip_is_compressed(gzip, 1));
+}
+
+static void test_inflate_file(void)
+{
+  output_buffer output = {0};
+  char path[4096];
+
+  snprintf(path, sizeof(path), "%s/kith.gz", fixtures);
+
+  assert(rb_zip_enumerate_file(path, collect, &output) == Z_OK);
+  assert(output.length == 74960);
+  assert(memcmp(output.bytes + 6, "JFIF", 4) == 0);
+
+  free(output.bytes);
+}
+
+static void test_round_trip(enum rb_zip_format format, size_t length, unsigned threads)
+{
+  uint8_t *input = make_input(length);
+  output_buffer compressed = {0}, inflated = {0};
+
+  assert(rb_zip_deflate(input, length, format, threads, collect, &compressed) == Z_OK);
+  assert(rb_zip_is_compressed(compressed.bytes, compressed.length));
+  assert(length < 1024 || compressed.length < length / 2);
+
+  assert(rb_zip_inflate(compressed.bytes, compressed.length, collect, &inflated) == Z_OK);
+  assert(inflated.length == length);
+  assert(length == 0 || memcmp(inflated.bytes, input, length) == 0);
+
+  /* zlib itself has to agree that the stitched stream (and its checksum) is valid */
+  if (format == rb_zip_zlib && length > 0) {
+    uLongf uncompressed_length = length;
+    uint8_t *uncompressed = malloc(length);
+
+    assert(uncompress(uncompressed, &uncompressed_length, compressed.bytes, compressed.length) == Z_OK);
+    assert(uncompressed_length == length && memcmp(uncompressed, input, length) == 0);
+    free(uncompressed);
+  }
+
+  free(input);
+  free(compressed.bytes);
+  free(inflated.bytes);
+}
+
+static void test_concatenated_members(void)
+{
+  output_buffer compressed = {0}, inflated = {0};
+
+  assert(rb_zip_deflate((const uint8_t *)"[{\"a\":1}", 8, rb_zip_gzip, 1, collect, &compressed) == Z_OK);
+  assert(rb_zip_deflate((const uint8_t *)",{\"b\":2}]", 9, rb_zip_gzip, 1, collect, &compressed) == Z_OK);
+
+  assert(rb_zip_inflate(compressed.bytes, compressed.length, collect, &inflated) == Z_OK);
+  assert(inflated.length == 17 && memcmp(inflated.bytes, "[{\"a\":1},{\"b\":2}]", 17) == 0);
+
+  free(compressed.bytes);
+  free(inflated.bytes);
+}
+
+static void test_corrupt_data(void)
+{
+  uint8_t *input = make_input(100000);
+  output_buffer compressed = {0}, inflated = {0};
+
+  assert(rb_zip_deflate(input, 100000, rb_zip_zlib, 0, collect, &compressed) == Z_OK);
+
+  /* Truncated */
+  assert(rb_zip_inflate(compressed.bytes, compressed.length / 2, collect, &inflated) == Z_DATA_ERROR);
+
+  /* Bad checksum */
+  compressed.bytes[compressed.length - 1] ^= 0xff;
+  inflated.length = 0;
+  assert(rb_zip_inflate(compressed.bytes, compressed.length, collect, &inflated) == Z_DATA_ERROR);
+
+  free(input);
+  free(compressed.bytes);
+  free(inflated.bytes);
+}
+
+static void test_stop(void)
+{
+  uint8_t *input = make_input(RB_ZIP_BUFFER_SIZE * 4);
+  output_buffer compressed = {0}, inflated = {0};
+
+  assert(rb_zip_deflate(input, RB_ZIP_BUFFER_SIZE * 4, rb_zip_gzip, 0, collect, &compressed) == Z_OK);
+
+  inflated.stop_after = 1;
+  assert(rb_zip_inflate(compressed.bytes, compressed.length, collect, &inflated) == Z_OK);
+  assert(inflated.calls == 1 && inflated.length == RB_ZIP_BUFFER_SIZE);
+
+  free(input);
+  free(compressed.bytes);
+  free(inflated.bytes);
+}
+
+int main(int argc, char *argv[])
+{
+  fixtures = argc > 1 ? argv[1] : "Tests";
+
+  test_is_compressed();
+  test_inflate_file();
+  test_round_trip(rb_zip_zlib, 0, 1);
+  test_round_trip(rb_zip_gzip, 100, 1);
+  test_round_trip(rb_zip_zlib, RB_ZIP_BLOCK_SIZE * 5 + 17, 1);
+  test_round_trip(rb_zip_zlib, RB_ZIP_BLOCK_SIZE * 5 + 17, 4);
+  test_round_trip(rb_zip_gzip, RB_ZIP_BLOCK_SIZE * 8, 0);
+  test_concatenated_members();
+  test_corrupt_data();
+  test_stop();
+
+  puts("rb_zip_tests: ok");
+  return 0;
+}
@@ -0,0 +1,42 @@
+# Runs rbcompile against the fixtures in Tests/ (see the rbcompile_tests test in CMakeLists.txt).
+
+file(REMOVE_RECURSE ${OUTPUT})
+
+function(rbcompile expected_result)
+  execute_process(COMMAND ${RBCOMPILE} -o ${OUTPUT} ${ARGN} RESULT_VARIABLE result OUTPUT_VARIABLE output ERROR_VARIABLE error)
+  message("${output}${error}")
+
+  if(expected_result EQUAL 0 AND NOT result EQUAL 0)
+    message(FATAL_ERROR "rbcompile ${ARGN} failed: ${result}")
+  elseif(NOT expected_result EQUAL 0 AND result EQUAL 0)
+    message(FATAL_ERROR "rbcompile ${ARGN} should have failed")
+  endif()
+
+  set(output "${output}" PARENT_SCOPE)
+endfunction()
+
+# Groups are merged from their filters
+rbcompile(0 ads=${FIXTURES}/blockerList.json,${FIXTURES}/blockerList.json privacy=${FIXTURES}/blockerList.json)
+
+if(NOT EXISTS ${OUTPUT}/ads.json OR NOT EXISTS ${OUTPUT}/privacy.json)
+  message(FATAL_ERROR "Missing group rule files")
+endif()
+
+if(NOT output MATCHES "ads +total +[0-9.]+ ms +2 rules")
+  message(FATAL_ERROR "Expected both copies of the rule in the ads group")
+endif()
+
+# Compressed output replaces the rule file
+rbcompile(0 -z ads=${FIXTURES}/blockerList.json)
+
+if(NOT EXISTS ${OUTPUT}/ads.json.gz OR EXISTS ${OUTPUT}/ads.json)
+  message(FATAL_ERROR "Expected only a compressed rule file")
+endif()
+
+# Missing or corrupt filters (kith.gz is an image) don't leave rule files behind
+rbcompile(1 missing=${FIXTURES}/missing.json)
+rbcompile(1 corrupt=${FIXTURES}/kith.gz)
+
+if(EXISTS ${OUTPUT}/missing.json OR EXISTS ${OUTPUT}/corrupt.json)
+  message(FATAL_ERROR "Failed groups shouldn't have rule files")
+endif()
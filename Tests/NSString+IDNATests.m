@@ -190,6 +190,22 @@
     XCTAssertEqualObjects([@"goo.gl" idnaEncodedString], @"goo.gl");
 }
 
+- (void)testUTS46Mapping {
+    XCTAssertEqualObjects([@"例子。com" idnaEncodedString], @"xn--fsqu00a.com");
+    XCTAssertEqualObjects([@"例子．com" idnaEncodedString], @"xn--fsqu00a.com");
+    XCTAssertEqualObjects([@"ｅｘａｍｐｌｅ.com" idnaEncodedString], @"example.com");
+    XCTAssertEqualObjects([@"BÜCHER.com" idnaEncodedString], @"xn--bcher-kva.com");
+    XCTAssertEqualObjects([@"ex\u00ADample.com" idnaEncodedString], @"example.com");
+    XCTAssertEqualObjects([@"fa\u00DF.de" idnaEncodedString], @"xn--fa-hia.de");
+    XCTAssertEqualObjects([@"\uFB01le.com" idnaEncodedString], @"file.com");
+    
+    // Precomposed and decomposed forms are encoded the same way
+    XCTAssertEqualObjects([@"caf\u00E9.com" idnaEncodedString], @"xn--caf-dma.com");
+    XCTAssertEqualObjects([@"cafe\u0301.com" idnaEncodedString], @"xn--caf-dma.com");
+    XCTAssertEqualObjects([@"\u1100\u1161\u11A8.kr" idnaEncodedString], [@"\uAC01.kr" idnaEncodedString]);
+    XCTAssertEqualObjects([@"x\u0301\u0323.com" idnaEncodedString], [@"x\u0323\u0301.com" idnaEncodedString]);
+}
+
 - (void)testIDNADecoding {
     XCTAssertEqualObjects([@"xn--maana-pta.com" idnaDecodedString], @"mañana.com");
     XCTAssertEqualObjects([@"example.com." idnaDecodedString], @"example.com.");
@@ -202,4 +218,63 @@
     XCTAssertEqualObjects([@"goo.gl" idnaDecodedString], @"goo.gl");
 }
 
+- (void)testBatchEncoding {
+    NSDictionary<NSString*, NSString*> *expectedStrings = @{
+        @"mañana.com": @"xn--maana-pta.com",
+        @"example.com.": @"example.com.",
+        @"bücher.com": @"xn--bcher-kva.com",
+        @"café.com": @"xn--caf-dma.com",
+        @"☃-⌘.com": @"xn----dqo34k.com",
+        @"퐀☃-⌘.com": @"xn----dqo34kn65z.com",
+        @"💩.la": @"xn--ls8h.la",
+        @"джумла@джpумлатест.bрфa": @"джумла@xn--p-8sbkgc5ag7bhce.xn--ba-lmcq",
+        @"goo.gl": @"goo.gl",
+        @"": @"",
+        @"WWW.Example.COM": @"www.example.com",
+        @"Foo@BAR.com": @"Foo@bar.com",
+        @"BÜCHER.com": @"xn--bcher-kva.com",
+        @"例子。com": @"xn--fsqu00a.com",
+        @"ｅｘａｍｐｌｅ.com": @"example.com",
+        @"user＠mñ.com": @"xn--user@m-1wa.com",
+        @"a-very-long-label-which-spans-more-than-one-vector.Example.COM": @"a-very-long-label-which-spans-more-than-one-vector.example.com",
+    };
+    
+    NSArray *strings = expectedStrings.allKeys;
+    NSArray *encodedStrings = [NSString idnaEncodedStringsForStrings:strings];
+    XCTAssertEqualObjects(encodedStrings, [expectedStrings objectsForKeys:strings notFoundMarker:@""]);
+}
+
+- (void)testWhitespaceIsKept {
+    // Spaces are valid without STD3 rules, so they're kept (and punycoded) like any other character. Non-ASCII domains
+    // used to lose the whitespace at the start of each label, unlike ASCII ones.
+    XCTAssertEqualObjects([@"  mañana . com" idnaEncodedString], @"xn--  maana -g3a. com");
+    XCTAssertEqualObjects([@" Example.com " idnaEncodedString], @" example.com ");
+}
+
+- (void)testBatchEncodingPerformance {
+    NSDictionary<NSString*, NSString*> *encodedWords = @{
+        @"news.com": @"news.com", @"Shop.net": @"shop.net", @"mañana.org": @"xn--maana-pta.org",
+        @"bücher.de": @"xn--bcher-kva.de", @"例子.JP": @"xn--fsqu00a.jp", @"static.co.uk": @"static.co.uk",
+    };
+    NSUInteger numberOfDomains = 100000;
+    
+    NSArray *words = encodedWords.allKeys;
+    NSMutableArray *domains = [NSMutableArray arrayWithCapacity:numberOfDomains];
+    NSMutableArray *expectedDomains = [NSMutableArray arrayWithCapacity:numberOfDomains];
+    
+    for (NSUInteger i = 0; i < numberOfDomains; i++) {
+        NSString *word = words[i % words.count];
+        [domains addObject:[NSString stringWithFormat:@"cdn%lu.%@", (unsigned long)(i % 1000), word]];
+        [expectedDomains addObject:[NSString stringWithFormat:@"cdn%lu.%@", (unsigned long)(i % 1000), encodedWords[word]]];
+    }
+    
+    __block NSArray *encodedDomains = nil;
+    
+    [self measureBlock:^{
+        encodedDomains = [NSString idnaEncodedStringsForStrings:domains];
+    }];
+    
+    XCTAssertEqualObjects(encodedDomains, expectedDomains);
+}
+
 @end
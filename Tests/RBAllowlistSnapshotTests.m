@@ -0,0 +1,179 @@
+//
+//  RBAllowlistSnapshotTests.m
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "RBAllowlistSnapshot.h"
+#import "RBSQLite.h"
+#import "RBUtils.h"
+#import "RBDatabase-Private.h"
+
+
+@interface RBAllowlistSnapshotTests : XCTestCase
+@end
+
+
+@implementation RBAllowlistSnapshotTests {
+    RBDatabase *_database;
+    NSURL *_tempDirectoryURL;
+}
+
+- (void)setUp {
+    self.continueAfterFailure = NO;
+    
+    _tempDirectoryURL = RBCreateTemporaryDirectory(NULL);
+    _database = [[RBDatabase alloc] initWithFileURL:[_tempDirectoryURL URLByAppendingPathComponent:@"database"]];
+}
+
+- (void)tearDown {
+    [_database _drainPool];
+    [[NSFileManager defaultManager] removeItemAtURL:_tempDirectoryURL error:NULL];
+    
+    // Force dealloc
+    _database = nil;
+}
+
+- (void)_writeAllowlistEntryForDomain:(NSString *)domain {
+    XCTestExpectation *write = [self expectationWithDescription:@"write"];
+    
+    [_database writeAllowlistEntryForDomain:domain usingBlock:nil completionHandler:^(RBAllowlistEntry *entry, NSError *error) {
+        XCTAssertNotNil(entry, @"%@", error);
+        [write fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)_updateSnapshot:(RBAllowlistSnapshot *)snapshot {
+    XCTestExpectation *update = [self expectationWithDescription:@"update"];
+    
+    [snapshot updateWithCompletionHandler:^(NSError *error) {
+        XCTAssertNil(error);
+        [update fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testLookup {
+    [self _writeAllowlistEntryForDomain:@"example.com"];
+    [self _writeAllowlistEntryForDomain:@"Sub.Other.org"];
+    
+    RBAllowlistSnapshot *snapshot = [[RBAllowlistSnapshot alloc] initWithDatabase:_database];
+    XCTAssertFalse(snapshot.isLoaded);
+    XCTAssertNil([snapshot entryForDomain:@"example.com"]);
+    
+    [self _updateSnapshot:snapshot];
+    
+    XCTAssertTrue(snapshot.isLoaded);
+    XCTAssertEqual(snapshot.count, 2);
+    XCTAssertEqual(snapshot.sequenceNumber, 2);
+    
+    XCTAssertEqualObjects([snapshot entryForDomain:@"example.com"].domain, @"example.com");
+    XCTAssertEqualObjects([snapshot entryForDomain:@" EXAMPLE.com "].domain, @"example.com");
+    XCTAssertEqualObjects([snapshot entryForDomain:@"sub.other.org"].domain, @"Sub.Other.org");
+    XCTAssertNil([snapshot entryForDomain:@"www.example.com"]);
+    XCTAssertNil([snapshot entryForDomain:@"other.org"]);
+    
+    XCTAssertEqualObjects([snapshot entryMatchingDomain:@"example.com"].domain, @"example.com");
+    XCTAssertEqualObjects([snapshot entryMatchingDomain:@"a.b.www.example.com"].domain, @"example.com");
+    XCTAssertEqualObjects([snapshot entryMatchingDomain:@"www.sub.other.org"].domain, @"Sub.Other.org");
+    XCTAssertNil([snapshot entryMatchingDomain:@"other.org"]);
+    XCTAssertNil([snapshot entryMatchingDomain:@"notexample.com"]);
+    XCTAssertNil([snapshot entryMatchingDomain:@"example.com.evil.net"]);
+    XCTAssertNil([snapshot entryMatchingDomain:@""]);
+}
+
+- (void)testPatch {
+    [self _writeAllowlistEntryForDomain:@"example.com"];
+    
+    RBAllowlistSnapshot *snapshot = [[RBAllowlistSnapshot alloc] initWithDatabase:_database];
+    [self _updateSnapshot:snapshot];
+    XCTAssertEqual(snapshot.count, 1);
+    
+    // Loaded snapshots follow the change log on their own
+    [self expectationForPredicate:[NSPredicate predicateWithFormat:@"sequenceNumber == 2"] evaluatedWithObject:snapshot handler:nil];
+    [self _writeAllowlistEntryForDomain:@"other.org"];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    XCTAssertEqual(snapshot.count, 2);
+    XCTAssertNotNil([snapshot entryMatchingDomain:@"www.other.org"]);
+    
+    XCTestExpectation *remove = [self expectationWithDescription:@"remove"];
+    [_database removeAllowlistEntryForDomain:@"example.com" completionHandler:^(NSError *error) {
+        XCTAssertNil(error);
+        [remove fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    [self _updateSnapshot:snapshot];
+    
+    XCTAssertEqual(snapshot.count, 1);
+    XCTAssertEqual(snapshot.sequenceNumber, 3);
+    XCTAssertNil([snapshot entryForDomain:@"example.com"]);
+    XCTAssertNotNil([snapshot entryForDomain:@"other.org"]);
+}
+
+- (void)testNegativeLookupPerformance {
+    XCTestExpectation *insert = [self expectationWithDescription:@"insert"];
+    
+    [_database _accessConnectionUsingBlock:^(sqlite3 *conn) {
+        int status = RBSQLiteTransaction(conn, ^int{
+            NSDate *date = [NSDate date];
+            int status = SQLITE_DONE;
+            
+            for (int i = 0; i < 100000 && status == SQLITE_DONE; i++) {
+                NSString *domain = [NSString stringWithFormat:@"domain-%d.com", i];
+                
+                status = RBSQLiteExecute(conn, @"INSERT INTO exception(domain, create_date, modify_date) VALUES ($1, $2, $2)", domain, date);
+                if (status == SQLITE_DONE) {
+                    status = RBSQLiteExecute(conn, @"INSERT INTO exception_group(exception_domain, name) VALUES ($1, '*')", domain);
+                }
+            }
+            
+            return status;
+        });
+        
+        XCTAssertEqual(status, SQLITE_DONE, @"%@", NSErrorFromSQLiteStatus(status));
+        [insert fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:30 handler:nil];
+    
+    RBAllowlistSnapshot *snapshot = [[RBAllowlistSnapshot alloc] initWithDatabase:_database];
+    
+    XCTestExpectation *load = [self expectationWithDescription:@"load"];
+    [snapshot updateWithCompletionHandler:^(NSError *error) {
+        XCTAssertNil(error);
+        [load fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:30 handler:nil];
+    
+    XCTAssertEqual(snapshot.count, 100000);
+    XCTAssertNotNil([snapshot entryMatchingDomain:@"www.domain-99999.com"]);
+    
+    NSMutableArray *domains = [NSMutableArray array];
+    for (int i = 0; i < 1000; i++) {
+        [domains addObject:[NSString stringWithFormat:@"cdn.static-%d.example.net", i]];
+    }
+    
+    // 100k lookups per iteration
+    [self measureBlock:^{
+        NSUInteger matches = 0;
+        
+        for (int j = 0; j < 100; j++) {
+            for (NSString *domain in domains) {
+                matches += ([snapshot entryMatchingDomain:domain] != nil);
+            }
+        }
+        
+        XCTAssertEqual(matches, 0);
+    }];
+}
+
+@end
@@ -10,10 +10,12 @@
 #import <CloudKit/CloudKit.h>
 
 #import "RBMockClient.h"
+#import "RBClient-Private.h"
 #import "RBDigest.h"
 #import "RBFilter+Mock.h"
 #import "RBFilterGroup-Private.h"
 #import "RBUtils.h"
+#import "RBZip.h"
 
 @interface RBClientTests : XCTestCase
 @end
@@ -40,6 +42,19 @@
     _adGroup = nil;
 }
 
+- (void)testClientIsReleased {
+    __weak RBMockClient *weakClient = nil;
+    
+    // The URL session shouldn't keep its client alive
+    @autoreleasepool {
+        RBMockClient *client = [RBMockClient new];
+        weakClient = client;
+        [client invalidate];
+    }
+    
+    XCTAssertNil(weakClient);
+}
+
 #pragma mark - CloudKit
 
 - (void)testCloudKitFetchRules {
@@ -197,6 +212,467 @@
     XCTAssertEqual(numDownloads, 2);
 }
 
+- (void)testServerFetchNotModified {
+    _mockClient.cloudKitEnabled = NO;
+    
+    RBFilter *filter = [RBFilter mockFilterWithGroup:@"ads" rules:@[@{}, @{}]];
+    [_mockClient mockFilters:@[filter]];
+    
+    NSString *filterDownloadPath = [@"/filter/" stringByAppendingString:filter.uniqueIdentifier];
+    RBMockClientHandler downloadHandler = [_mockClient handlerForPath:filterDownloadPath];
+    __block NSUInteger numDownloads = 0;
+    
+    [_mockClient handlePath:filterDownloadPath usingBlock:^(int * _Nonnull status, NSDictionary * _Nonnull __autoreleasing * _Nonnull headers, NSData * _Nonnull __autoreleasing * _Nonnull data) {
+        numDownloads++;
+        downloadHandler(status, headers, data);
+    }];
+    
+    void(^fetch)(void) = ^{
+        XCTestExpectation *fetch = [self expectationWithDescription:@"fetch"];
+        [self->_mockClient fetchFilterRulesForGroup:self->_adGroup outputDirectory:self->_tempDirectoryURL completionHandler:^(RBFilterGroupRules *filterRules, NSError *error) {
+            XCTAssertNotNil(filterRules, @"%@", error);
+            XCTAssertEqual(filterRules.count, 1);
+            XCTAssertEqualObjects([RBDigest MD5HashOfFileURL:filterRules.allValues.firstObject error:NULL], filter.md5);
+            [fetch fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:1 handler:nil];
+    };
+    
+    fetch();
+    XCTAssertEqual(numDownloads, 1);
+    
+    NSArray<NSURLRequest*> *requests = [_mockClient requestsForPath:@"/filters"];
+    XCTAssertEqual(requests.count, 1);
+    XCTAssertNil([requests.firstObject valueForHTTPHeaderField:@"If-None-Match"]);
+    
+    // Unchanged manifest is served from the cache and nothing is downloaded
+    fetch();
+    XCTAssertEqual(numDownloads, 1);
+    
+    requests = [_mockClient requestsForPath:@"/filters"];
+    XCTAssertEqual(requests.count, 2);
+    XCTAssertNotNil([requests.lastObject valueForHTTPHeaderField:@"If-None-Match"]);
+    
+    // Missing output is downloaded again, even if the manifest hasn't changed
+    [[NSFileManager defaultManager] removeItemAtURL:[_tempDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier] error:NULL];
+    fetch();
+    XCTAssertEqual(numDownloads, 2);
+    
+    // Missing cached manifest causes the manifest to be fetched unconditionally
+    NSArray *cachedFiles = [[NSFileManager defaultManager] contentsOfDirectoryAtURL:_mockClient._cacheDirectoryURL includingPropertiesForKeys:nil options:0 error:NULL];
+    for (NSURL *fileURL in cachedFiles) {
+        if ([fileURL.pathExtension isEqualToString:@"json"]) {
+            [[NSFileManager defaultManager] removeItemAtURL:fileURL error:NULL];
+        }
+    }
+    
+    fetch();
+    XCTAssertEqual(numDownloads, 2);
+    
+    requests = [_mockClient requestsForPath:@"/filters"];
+    XCTAssertEqual(requests.count, 5);
+    XCTAssertNil([requests.lastObject valueForHTTPHeaderField:@"If-None-Match"]);
+}
+
+- (void)testServerFetchDelta {
+    _mockClient.cloudKitEnabled = NO;
+    
+    NSMutableArray *rules = [NSMutableArray array];
+    for (int i = 0; i < 1000; i++) {
+        [rules addObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": [NSString stringWithFormat:@"ads-%d\\.example\\.com", i]}}];
+    }
+    
+    RBFilter *filter = [RBFilter mockFilterWithGroup:@"ads" rules:rules];
+    [_mockClient mockFilters:@[filter]];
+    
+    void(^fetch)(RBFilter *) = ^(RBFilter *expectedFilter) {
+        XCTestExpectation *fetch = [self expectationWithDescription:@"fetch"];
+        [self->_mockClient fetchFilterRulesForGroup:self->_adGroup outputDirectory:self->_tempDirectoryURL completionHandler:^(RBFilterGroupRules *filterRules, NSError *error) {
+            XCTAssertNotNil(filterRules, @"%@", error);
+            XCTAssertEqual(filterRules.count, 1);
+            XCTAssertEqualObjects([RBDigest MD5HashOfFileURL:filterRules.allValues.firstObject error:NULL], expectedFilter.md5);
+            [fetch fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:1 handler:nil];
+    };
+    
+    fetch(filter);
+    
+    NSString *filterDownloadPath = [@"/filter/" stringByAppendingString:filter.uniqueIdentifier];
+    XCTAssertEqual([_mockClient requestsForPath:filterDownloadPath].count, 1);
+    
+    // Updated rules are patched
+    [rules replaceObjectAtIndex:500 withObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": @"changed\\.example\\.com"}}];
+    RBFilter *updatedFilter = [filter copyWithRules:rules];
+    
+    [_mockClient mockFilters:@[updatedFilter]];
+    [_mockClient mockDeltaFromFilter:filter toFilter:updatedFilter];
+    
+    NSString *deltaPath = [NSString stringWithFormat:@"/filter/%@/delta/%@", filter.uniqueIdentifier, filter.md5.lowercaseString];
+    RBMockClientHandler deltaHandler = [_mockClient handlerForPath:deltaPath];
+    __block NSUInteger deltaLength = 0;
+    
+    [_mockClient handlePath:deltaPath usingBlock:^(int * _Nonnull status, NSDictionary * _Nonnull __autoreleasing * _Nonnull headers, NSData * _Nonnull __autoreleasing * _Nonnull data) {
+        deltaHandler(status, headers, data);
+        deltaLength = (*data).length;
+    }];
+    
+    fetch(updatedFilter);
+    
+    XCTAssertEqual([_mockClient requestsForPath:deltaPath].count, 1);
+    XCTAssertEqual([_mockClient requestsForPath:filterDownloadPath].count, 1);
+    XCTAssertLessThan(deltaLength, [RBMockClient jsonData:rules].length / 10);
+    
+    // Deltas which don't produce the expected file fall back to a full download
+    [rules removeLastObject];
+    RBFilter *otherFilter = [updatedFilter copyWithRules:rules];
+    
+    [_mockClient mockFilters:@[otherFilter]];
+    [_mockClient mockDeltaFromFilter:updatedFilter toFilter:updatedFilter];
+    
+    fetch(otherFilter);
+    
+    XCTAssertEqual([_mockClient requestsForPath:filterDownloadPath].count, 2);
+    
+    // Once the delta has failed, retries of the full download don't ask for it again
+    [rules removeLastObject];
+    RBFilter *lastFilter = [otherFilter copyWithRules:rules];
+    NSString *otherDeltaPath = [NSString stringWithFormat:@"/filter/%@/delta/%@", filter.uniqueIdentifier, otherFilter.md5.lowercaseString];
+    
+    [_mockClient mockFilters:@[lastFilter]];
+    [_mockClient mockDeltaFromFilter:otherFilter toFilter:otherFilter];
+    [_mockClient truncateNextResponseForPath:filterDownloadPath afterLength:1000];
+    
+    fetch(lastFilter);
+    
+    XCTAssertEqual([_mockClient requestsForPath:otherDeltaPath].count, 1);
+    XCTAssertEqual([_mockClient requestsForPath:filterDownloadPath].count, 4);
+}
+
+- (void)testServerFetchCompressedRules {
+    _mockClient.cloudKitEnabled = NO;
+    
+    NSMutableArray *rules = [NSMutableArray array];
+    for (int i = 0; i < 1000; i++) {
+        [rules addObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": [NSString stringWithFormat:@"ads-%d\\.example\\.com", i]}}];
+    }
+    
+    RBFilter *filter = [RBFilter mockFilterWithGroup:@"ads" rules:rules];
+    [_mockClient mockFilters:@[filter]];
+    
+    void(^fetch)(RBFilter *) = ^(RBFilter *expectedFilter) {
+        XCTestExpectation *fetch = [self expectationWithDescription:@"fetch"];
+        [self->_mockClient fetchFilterRulesForGroup:self->_adGroup outputDirectory:self->_tempDirectoryURL compressed:YES completionHandler:^(RBFilterGroupRules *filterRules, NSError *error) {
+            XCTAssertNotNil(filterRules, @"%@", error);
+            XCTAssertEqual(filterRules.count, 1);
+            
+            // Stored compressed, but hashes refer to the rules
+            NSURL *rulesURL = filterRules.allValues.firstObject;
+            XCTAssertTrue([RBZip isCompressedFileURL:rulesURL]);
+            XCTAssertLessThan([NSData dataWithContentsOfURL:rulesURL].length, [RBMockClient jsonData:rules].length / 4);
+            XCTAssertEqualObjects([RBDigest MD5HashOfInflatedContentsOfFileURL:rulesURL error:NULL], expectedFilter.md5);
+            
+            [fetch fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:1 handler:nil];
+    };
+    
+    // Compressed partial downloads resume from the length of their content
+    NSString *filterDownloadPath = [@"/filter/" stringByAppendingString:filter.uniqueIdentifier];
+    [_mockClient truncateNextResponseForPath:filterDownloadPath afterLength:1000];
+    
+    fetch(filter);
+    
+    NSArray<NSURLRequest*> *requests = [_mockClient requestsForPath:filterDownloadPath];
+    XCTAssertEqual(requests.count, 2);
+    XCTAssertEqualObjects([requests[1] valueForHTTPHeaderField:@"Range"], @"bytes=1000-");
+    XCTAssertFalse(_mockClient.compressesFilterRules);
+    
+    // Compressed rules are recognized as up to date
+    fetch(filter);
+    XCTAssertEqual([_mockClient requestsForPath:filterDownloadPath].count, 2);
+    
+    // Compressed rules can be patched
+    [rules replaceObjectAtIndex:500 withObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": @"changed\\.example\\.com"}}];
+    RBFilter *updatedFilter = [filter copyWithRules:rules];
+    
+    [_mockClient mockFilters:@[updatedFilter]];
+    [_mockClient mockDeltaFromFilter:filter toFilter:updatedFilter];
+    
+    fetch(updatedFilter);
+    
+    NSString *deltaPath = [NSString stringWithFormat:@"/filter/%@/delta/%@", filter.uniqueIdentifier, filter.md5.lowercaseString];
+    XCTAssertEqual([_mockClient requestsForPath:deltaPath].count, 1);
+    XCTAssertEqual([_mockClient requestsForPath:filterDownloadPath].count, 2);
+}
+
+- (void)testServerFetchSchedulingAndRetries {
+    _mockClient.cloudKitEnabled = NO;
+    _mockClient.latency = 0.02;
+    _mockClient.maximumConcurrentDownloads = 4;
+    
+    NSArray<RBFilter*> *filters = [RBFilter mockFilters:24 plistBlock:^NSDictionary *(NSUInteger idx) {
+        return @{@"group": @"ads", @"language": [NSNull null], @"selector": [NSNull null]};
+    } rulesBlock:^NSArray<NSDictionary *> *(NSUInteger idx) {
+        NSMutableArray *rules = [NSMutableArray array];
+        for (NSUInteger i = 0; i <= idx; i++) {
+            [rules addObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": [NSString stringWithFormat:@"ads-%lu", i]}}];
+        }
+        return rules;
+    }];
+    
+    [_mockClient mockFilters:filters];
+    
+    // Every third filter fails its first request
+    NSMutableArray<NSString*> *requestedIdentifiers = [NSMutableArray array];
+    NSMutableDictionary<NSString*, NSDate*> *completionDates = [NSMutableDictionary dictionary];
+    
+    for (RBFilter *filter in filters) {
+        NSString *path = [@"/filter/" stringByAppendingString:filter.uniqueIdentifier];
+        RBMockClientHandler handler = [_mockClient handlerForPath:path];
+        BOOL flaky = [filters indexOfObject:filter] % 3 == 0;
+        __block NSUInteger numRequests = 0;
+        
+        [_mockClient handlePath:path usingBlock:^(int *status, NSDictionary **headers, NSData **data) {
+            @synchronized (requestedIdentifiers) {
+                [requestedIdentifiers addObject:filter.uniqueIdentifier];
+                numRequests++;
+                
+                if (flaky && numRequests == 1) {
+                    *status = 503;
+                    return;
+                }
+                
+                completionDates[filter.uniqueIdentifier] = [NSDate date];
+            }
+            
+            handler(status, headers, data);
+        }];
+    }
+    
+    NSDate *startDate = [NSDate date];
+    
+    XCTestExpectation *fetch = [self expectationWithDescription:@"fetch"];
+    [_mockClient fetchFilterRulesForGroup:_adGroup outputDirectory:_tempDirectoryURL completionHandler:^(RBFilterGroupRules *filterRules, NSError *error) {
+        XCTAssertNotNil(filterRules, @"%@", error);
+        XCTAssertEqual(filterRules.count, filters.count);
+        [fetch fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    
+    NSTimeInterval duration = -[startDate timeIntervalSinceNow];
+    NSArray *latencies = [[completionDates.allValues valueForKey:@"timeIntervalSinceReferenceDate"] sortedArrayUsingSelector:@selector(compare:)];
+    NSTimeInterval p50 = [latencies[latencies.count / 2] doubleValue] - startDate.timeIntervalSinceReferenceDate;
+    NSTimeInterval p95 = [latencies[latencies.count * 95 / 100] doubleValue] - startDate.timeIntervalSinceReferenceDate;
+    
+    NSLog(@"Downloaded %lu filters in %.3fs (%.1f filters/s, p50 %.3fs, p95 %.3fs)", filters.count, duration, filters.count / duration, p50, p95);
+    
+    XCTAssertLessThanOrEqual(_mockClient.maximumConcurrentRequests, 4);
+    XCTAssertEqual(requestedIdentifiers.count, filters.count + (filters.count + 2) / 3);
+    
+    // Largest filters are requested first
+    NSArray *largestIdentifiers = [[filters subarrayWithRange:NSMakeRange(filters.count - 4, 4)] valueForKey:@"uniqueIdentifier"];
+    XCTAssertEqualObjects([NSSet setWithArray:[requestedIdentifiers subarrayWithRange:NSMakeRange(0, 4)]], [NSSet setWithArray:largestIdentifiers]);
+}
+
+- (void)testServerFetchKeepsPartialResults {
+    _mockClient.cloudKitEnabled = NO;
+    
+    NSArray<RBFilter*> *filters = [RBFilter mockFilters:3 plistBlock:^NSDictionary *(NSUInteger idx) {
+        return @{@"group": @"ads", @"language": [NSNull null], @"selector": [NSNull null]};
+    } rulesBlock:nil];
+    
+    [_mockClient mockFilters:filters];
+    
+    NSString *failingPath = [@"/filter/" stringByAppendingString:filters.firstObject.uniqueIdentifier];
+    RBMockClientHandler failingHandler = [_mockClient handlerForPath:failingPath];
+    
+    [_mockClient handlePath:failingPath usingBlock:^(int *status, NSDictionary **headers, NSData **data) {
+        *status = 500;
+    }];
+    
+    XCTestExpectation *fetch = [self expectationWithDescription:@"fetch"];
+    [_mockClient fetchFilterRulesForGroup:_adGroup outputDirectory:_tempDirectoryURL completionHandler:^(RBFilterGroupRules *filterRules, NSError *error) {
+        XCTAssertNil(filterRules);
+        XCTAssertNotNil(error);
+        [fetch fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:2 handler:nil];
+    
+    XCTAssertEqual([_mockClient requestsForPath:failingPath].count, _mockClient.maximumDownloadAttempts);
+    
+    for (RBFilter *filter in [filters subarrayWithRange:NSMakeRange(1, 2)]) {
+        NSURL *fileURL = [_tempDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier];
+        XCTAssertEqualObjects([RBDigest MD5HashOfFileURL:fileURL error:NULL], filter.md5, @"Successful downloads should be kept");
+    }
+    
+    // Only the failed filter is fetched again
+    [_mockClient handlePath:failingPath usingBlock:failingHandler];
+    
+    XCTestExpectation *retry = [self expectationWithDescription:@"retry"];
+    [_mockClient fetchFilterRulesForGroup:_adGroup outputDirectory:_tempDirectoryURL completionHandler:^(RBFilterGroupRules *filterRules, NSError *error) {
+        XCTAssertNotNil(filterRules, @"%@", error);
+        XCTAssertEqual(filterRules.count, 3);
+        [retry fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:2 handler:nil];
+    
+    for (RBFilter *filter in filters) {
+        NSString *path = [@"/filter/" stringByAppendingString:filter.uniqueIdentifier];
+        XCTAssertEqual([_mockClient requestsForPath:path].count, filter == filters.firstObject ? _mockClient.maximumDownloadAttempts + 1 : 1);
+    }
+}
+
+- (void)testServerFetchResumesTruncatedDownload {
+    _mockClient.cloudKitEnabled = NO;
+    
+    NSMutableArray *rules = [NSMutableArray array];
+    for (int i = 0; i < 1000; i++) {
+        [rules addObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": [NSString stringWithFormat:@"ads-%d\\.example\\.com", i]}}];
+    }
+    
+    RBFilter *filter = [RBFilter mockFilterWithGroup:@"ads" rules:rules];
+    [_mockClient mockFilters:@[filter]];
+    
+    NSString *path = [@"/filter/" stringByAppendingString:filter.uniqueIdentifier];
+    NSUInteger truncatedLength = [RBMockClient jsonData:rules].length / 2;
+    [_mockClient truncateNextResponseForPath:path afterLength:truncatedLength];
+    
+    XCTestExpectation *fetch = [self expectationWithDescription:@"fetch"];
+    [_mockClient fetchFilterRulesForGroup:_adGroup outputDirectory:_tempDirectoryURL completionHandler:^(RBFilterGroupRules *filterRules, NSError *error) {
+        XCTAssertNotNil(filterRules, @"%@", error);
+        XCTAssertEqualObjects([RBDigest MD5HashOfFileURL:filterRules[filter] error:NULL], filter.md5);
+        [fetch fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:2 handler:nil];
+    
+    // The retry picks up where the dropped connection left off
+    NSArray<NSURLRequest*> *requests = [_mockClient requestsForPath:path];
+    XCTAssertEqual(requests.count, 2);
+    XCTAssertNil([requests[0] valueForHTTPHeaderField:@"Range"]);
+    XCTAssertEqualObjects([requests[1] valueForHTTPHeaderField:@"Range"], ([NSString stringWithFormat:@"bytes=%lu-", truncatedLength]));
+    XCTAssertEqualObjects([requests[1] valueForHTTPHeaderField:@"If-Range"], ([NSString stringWithFormat:@"\"%@\"", filter.md5.lowercaseString]));
+    XCTAssertEqualObjects([requests[1] valueForHTTPHeaderField:@"Accept-Encoding"], @"identity");
+}
+
+- (void)testServerFetchResumesAcrossSyncs {
+    _mockClient.cloudKitEnabled = NO;
+    _mockClient.maximumDownloadAttempts = 1;
+    
+    NSMutableArray *rules = [NSMutableArray array];
+    for (int i = 0; i < 1000; i++) {
+        [rules addObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": [NSString stringWithFormat:@"ads-%d\\.example\\.com", i]}}];
+    }
+    
+    RBFilter *filter = [RBFilter mockFilterWithGroup:@"ads" rules:rules];
+    NSString *path = [@"/filter/" stringByAppendingString:filter.uniqueIdentifier];
+    
+    void(^fetch)(RBFilter *, BOOL) = ^(RBFilter *expectedFilter, BOOL shouldSucceed) {
+        XCTestExpectation *fetch = [self expectationWithDescription:@"fetch"];
+        [self->_mockClient fetchFilterRulesForGroup:self->_adGroup outputDirectory:self->_tempDirectoryURL completionHandler:^(RBFilterGroupRules *filterRules, NSError *error) {
+            if (shouldSucceed) {
+                XCTAssertNotNil(filterRules, @"%@", error);
+                XCTAssertEqualObjects([RBDigest MD5HashOfFileURL:filterRules[expectedFilter] error:NULL], expectedFilter.md5);
+            } else {
+                XCTAssertNil(filterRules);
+                XCTAssertEqualObjects(error.domain, NSURLErrorDomain);
+            }
+            [fetch fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:2 handler:nil];
+    };
+    
+    // Interrupted syncs are resumed by the next one
+    [_mockClient mockFilters:@[filter]];
+    [_mockClient truncateNextResponseForPath:path afterLength:1000];
+    
+    fetch(filter, NO);
+    fetch(filter, YES);
+    
+    NSArray<NSURLRequest*> *requests = [_mockClient requestsForPath:path];
+    XCTAssertEqual(requests.count, 2);
+    XCTAssertEqualObjects([requests[1] valueForHTTPHeaderField:@"Range"], @"bytes=1000-");
+    
+    // Partial downloads of an older version are thrown away
+    [rules removeLastObject];
+    RBFilter *updatedFilter = [filter copyWithRules:rules];
+    
+    [[NSFileManager defaultManager] removeItemAtURL:[_tempDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier] error:NULL];
+    [_mockClient truncateNextResponseForPath:path afterLength:1000];
+    fetch(filter, NO);
+    
+    [_mockClient mockFilters:@[updatedFilter]];
+    fetch(updatedFilter, YES);
+    
+    requests = [_mockClient requestsForPath:path];
+    XCTAssertEqual(requests.count, 4);
+    XCTAssertNil([requests[3] valueForHTTPHeaderField:@"Range"]);
+    
+    // The server sends the whole file when the validator doesn't match
+    [rules removeLastObject];
+    RBFilter *otherFilter = [updatedFilter copyWithRules:rules];
+    
+    [_mockClient mockFilters:@[otherFilter]];
+    [_mockClient truncateNextResponseForPath:path afterLength:1000];
+    fetch(otherFilter, NO);
+    
+    RBMockClientHandler handler = [_mockClient handlerForPath:path];
+    [_mockClient handlePath:path usingBlock:^(int *status, NSDictionary **headers, NSData **data) {
+        handler(status, headers, data);
+        (*headers) = @{@"Content-Type": @"application/json", @"ETag": @"\"changed\""};
+    }];
+    
+    fetch(otherFilter, YES);
+    
+    requests = [_mockClient requestsForPath:path];
+    XCTAssertEqual(requests.count, 6);
+    XCTAssertEqualObjects([requests[5] valueForHTTPHeaderField:@"Range"], @"bytes=1000-");
+}
+
+- (void)testServerFetchPartialsPerOutputDirectory {
+    _mockClient.cloudKitEnabled = NO;
+    _mockClient.maximumDownloadAttempts = 1;
+    
+    NSMutableArray *rules = [NSMutableArray array];
+    for (int i = 0; i < 1000; i++) {
+        [rules addObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": [NSString stringWithFormat:@"ads-%d\\.example\\.com", i]}}];
+    }
+    
+    RBFilter *filter = [RBFilter mockFilterWithGroup:@"ads" rules:rules];
+    NSString *path = [@"/filter/" stringByAppendingString:filter.uniqueIdentifier];
+    NSURL *otherDirectoryURL = [_tempDirectoryURL URLByAppendingPathComponent:@"other" isDirectory:YES];
+    
+    void(^fetch)(NSURL *, BOOL, BOOL) = ^(NSURL *outputDirectoryURL, BOOL compressed, BOOL shouldSucceed) {
+        XCTestExpectation *fetch = [self expectationWithDescription:@"fetch"];
+        [self->_mockClient fetchFilterRulesForGroup:self->_adGroup outputDirectory:outputDirectoryURL compressed:compressed completionHandler:^(RBFilterGroupRules *filterRules, NSError *error) {
+            if (shouldSucceed) {
+                XCTAssertNotNil(filterRules, @"%@", error);
+                XCTAssertEqualObjects([RBDigest MD5HashOfInflatedContentsOfFileURL:filterRules[filter] error:NULL], filter.md5);
+            } else {
+                XCTAssertNil(filterRules);
+            }
+            [fetch fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:2 handler:nil];
+    };
+    
+    [_mockClient mockFilters:@[filter]];
+    [_mockClient truncateNextResponseForPath:path afterLength:1000];
+    fetch(_tempDirectoryURL, NO, NO);
+    
+    // Other output directories and compression modes don't share (or clobber) the partial download
+    fetch(otherDirectoryURL, NO, YES);
+    fetch(_tempDirectoryURL, YES, YES);
+    [[NSFileManager defaultManager] removeItemAtURL:[_tempDirectoryURL URLByAppendingPathComponent:filter.uniqueIdentifier] error:NULL];
+    fetch(_tempDirectoryURL, NO, YES);
+    
+    NSArray<NSURLRequest*> *requests = [_mockClient requestsForPath:path];
+    XCTAssertEqual(requests.count, 4);
+    XCTAssertNil([requests[1] valueForHTTPHeaderField:@"Range"]);
+    XCTAssertNil([requests[2] valueForHTTPHeaderField:@"Range"]);
+    XCTAssertEqualObjects([requests[3] valueForHTTPHeaderField:@"Range"], @"bytes=1000-");
+}
+
 - (void)testServerFetchBadContent {
     _mockClient.cloudKitEnabled = NO;
 
@@ -358,4 +358,170 @@ static _RBContentBlockerRules dummyRules;
     [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+- (void)_writeAllowlistDomains:(NSArray<NSString *> *)domains {
+    XCTestExpectation *allowList = [self expectationWithDescription:@"allowList"];
+    allowList.expectedFulfillmentCount = domains.count;
+    
+    for (NSString *domain in domains) {
+        [_contentBlocker.allowList writeAllowlistEntryForDomain:domain usingBlock:^(RBMutableAllowlistEntry *entry, BOOL *stop) {
+            entry.groupNames = @[self->_contentBlocker.filterGroup.name];
+        } completionHandler:^(RBAllowlistEntry *entry, NSError *error) {
+            XCTAssertNotNil(entry, @"%@", error);
+            [allowList fulfill];
+        }];
+    }
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (NSArray<_RBContentBlockerRules> *)_readShardedRules {
+    XCTestExpectation *read = [self expectationWithDescription:@"read"];
+    NSMutableArray *shards = [NSMutableArray array];
+    
+    [_contentBlocker writeShardedRulesWithCompletionHandler:^(NSArray<NSURL *> *shardURLs, NSError *error) {
+        XCTAssertNotNil(shardURLs, @"%@", error);
+        
+        for (NSURL *shardURL in shardURLs) {
+            NSData *data = [NSData dataWithContentsOfURL:shardURL];
+            id rules = [NSJSONSerialization JSONObjectWithData:data options:0 error:&error];
+            XCTAssertNotNil(rules, @"%@", error);
+            [shards addObject:rules];
+        }
+        
+        [read fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    return shards;
+}
+
+- (void)testShardedRules {
+    [self _writeAllowlistDomains:@[@"aaa.com", @"bbb.com"]];
+    
+    NSMutableArray *groupRules = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 5; i++) {
+        [groupRules addObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": [NSString stringWithFormat:@"rule-%lu", (unsigned long)i]}}];
+    }
+    
+    NSError *error = nil;
+    NSData *groupRuleData = [NSJSONSerialization dataWithJSONObject:groupRules options:0 error:&error];
+    XCTAssertTrue([groupRuleData writeToURL:_contentBlocker.filterGroup.fileURL options:0 error:&error], @"%@", error);
+    
+    _contentBlocker.allowListGroupSize = 1;
+    _contentBlocker.maxNumberOfRulesPerShard = 4;
+    
+    NSArray<_RBContentBlockerRules> *shards = [self _readShardedRules];
+    XCTAssertEqual(shards.count, 3);
+    
+    // Every shard ends with the allowlist rules, and the group's rules keep their order
+    NSMutableArray *shardedGroupRules = [NSMutableArray array];
+    
+    for (_RBContentBlockerRules shard in shards) {
+        XCTAssertLessThanOrEqual(shard.count, 4);
+        
+        NSArray *allowlistRules = [shard subarrayWithRange:NSMakeRange(shard.count - 2, 2)];
+        XCTAssertEqualObjects(allowlistRules[0][@"trigger"][@"if-domain"], @[@"*aaa.com"]);
+        XCTAssertEqualObjects(allowlistRules[1][@"trigger"][@"if-domain"], @[@"*bbb.com"]);
+        
+        [shardedGroupRules addObjectsFromArray:[shard subarrayWithRange:NSMakeRange(0, shard.count - 2)]];
+    }
+    
+    XCTAssertEqualObjects(shardedGroupRules, groupRules);
+    
+    // Shards are also limited by size
+    _contentBlocker.maxNumberOfRulesPerShard = 50000;
+    _contentBlocker.maxNumberOfBytesPerShard = groupRuleData.length;
+    
+    shards = [self _readShardedRules];
+    XCTAssertGreaterThan(shards.count, 1);
+    [shardedGroupRules removeAllObjects];
+    
+    for (NSUInteger i = 0; i < shards.count; i++) {
+        NSURL *shardURL = (i == 0) ? _contentBlocker.rulesFileURL : [_tempDirectoryURL URLByAppendingPathComponent:[NSString stringWithFormat:@"rules-%lu.json", (unsigned long)i]];
+        NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:shardURL.path error:&error];
+        XCTAssertNotNil(attributes, @"%@", error);
+        XCTAssertLessThanOrEqual(attributes.fileSize, groupRuleData.length);
+        
+        [shardedGroupRules addObjectsFromArray:[shards[i] filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"action.type == 'block'"]]];
+    }
+    
+    XCTAssertEqualObjects(shardedGroupRules, groupRules);
+    
+    // Shards left over from the previous write are removed
+    NSString *staleShardName = [NSString stringWithFormat:@"rules-%lu.json", (unsigned long)shards.count];
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:[_tempDirectoryURL URLByAppendingPathComponent:staleShardName].path]);
+}
+
+- (void)testShardedRulesKeepPreviousShardsOnError {
+    NSMutableArray *groupRules = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 5; i++) {
+        [groupRules addObject:@{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": [NSString stringWithFormat:@"rule-%lu", (unsigned long)i]}}];
+    }
+    
+    NSError *error = nil;
+    NSData *groupRuleData = [NSJSONSerialization dataWithJSONObject:groupRules options:0 error:&error];
+    XCTAssertTrue([groupRuleData writeToURL:_contentBlocker.filterGroup.fileURL options:0 error:&error], @"%@", error);
+    
+    _contentBlocker.maxNumberOfRulesPerShard = 2;
+    
+    NSArray<_RBContentBlockerRules> *shards = [self _readShardedRules];
+    XCTAssertEqual(shards.count, 3);
+    
+    // The new shards can't be moved into place, so the previous set is kept as a whole (and the error is passed on)
+    _contentBlocker.maxNumberOfRulesPerShard = 50000;
+    XCTAssertTrue([[NSFileManager defaultManager] setAttributes:@{NSFilePosixPermissions: @(0500)} ofItemAtPath:_tempDirectoryURL.path error:&error], @"%@", error);
+    
+    XCTestExpectation *write = [self expectationWithDescription:@"write"];
+    
+    [_contentBlocker writeShardedRulesWithCompletionHandler:^(NSArray<NSURL *> *shardURLs, NSError *error) {
+        XCTAssertNotNil(error);
+        XCTAssertEqual(shardURLs.count, 3);
+        XCTAssertEqualObjects(shardURLs.firstObject, self->_contentBlocker.rulesFileURL);
+        [write fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    XCTAssertTrue([[NSFileManager defaultManager] setAttributes:@{NSFilePosixPermissions: @(0700)} ofItemAtPath:_tempDirectoryURL.path error:&error], @"%@", error);
+    
+    NSData *firstShardData = [NSData dataWithContentsOfURL:_contentBlocker.rulesFileURL];
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:firstShardData options:0 error:NULL], (@[groupRules[0], groupRules[1]]));
+}
+
+- (void)testAllowlistPruning {
+    [self _writeAllowlistDomains:@[@"aaa.com"]];
+    
+    NSArray *groupRules = @[
+        @{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": @"rule-0", @"if-domain": @[@"aaa.com"]}},
+        @{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": @"rule-1", @"if-domain": @[@"*sub.AAA.com", @"ccc.com"]}},
+        @{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": @"rule-2"}},
+        @{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": @"rule-3", @"if-domain": @[@"baaa.com"]}},
+    ];
+    
+    NSError *error = nil;
+    NSData *groupRuleData = [NSJSONSerialization dataWithJSONObject:groupRules options:0 error:&error];
+    XCTAssertTrue([groupRuleData writeToURL:_contentBlocker.filterGroup.fileURL options:0 error:&error], @"%@", error);
+    
+    // Rules which only apply to allowlisted domains (or their subdomains) are dropped, and the others lose those domains
+    NSArray *expectedRules = @[
+        @{@"action": @{@"type": @"block"}, @"trigger": @{@"url-filter": @"rule-1", @"if-domain": @[@"ccc.com"]}},
+        groupRules[2],
+        groupRules[3],
+        @{@"action": @{@"type": @"ignore-previous-rules"}, @"trigger": @{@"url-filter": @".*", @"if-domain": @[@"*aaa.com"]}},
+    ];
+    
+    XCTestExpectation *read = [self expectationWithDescription:@"read"];
+    [self _readRulesUsingBlock:^(_RBContentBlockerRules rules, NSError *error) {
+        XCTAssertEqualObjects(rules, expectedRules, @"%@", error);
+        [read fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    // Shards are pruned the same way
+    NSArray<_RBContentBlockerRules> *shards = [self _readShardedRules];
+    XCTAssertEqual(shards.count, 1);
+    XCTAssertEqualObjects(shards.firstObject, expectedRules);
+}
+
 @end
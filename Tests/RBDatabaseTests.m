@@ -144,6 +144,56 @@
     [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+- (void)testLazyInitialization {
+    // Creating a database shouldn't touch the disk until it's accessed
+    NSString *path = _database.fileURL.path;
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:path]);
+    
+    XCTestExpectation *lookup = [self expectationWithDescription:@"lookup"];
+    
+    [_database allowlistEntryForDomain:@"yolo.com" completionHandler:^(RBAllowlistEntry *entry, NSError *error) {
+        XCTAssertNil(entry, @"%@", error);
+        [lookup fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    XCTAssertTrue([[NSFileManager defaultManager] fileExistsAtPath:path]);
+    XCTAssertEqual(_database._poolStatistics.idleConnections, 1);
+}
+
+- (void)testConcurrentReads {
+    XCTestExpectation *lookups = [self expectationWithDescription:@"lookups"];
+    lookups.expectedFulfillmentCount = 64;
+    
+    // Readers hold their connection while their completion handler runs, so the others have to wait for one
+    for (int i = 0; i < lookups.expectedFulfillmentCount; i++) {
+        [_database allowlistEntryForDomain:@"yolo.com" completionHandler:^(RBAllowlistEntry *entry, NSError *error) {
+            [NSThread sleepForTimeInterval:0.005];
+            [lookups fulfill];
+        }];
+    }
+    
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    
+    // The pool grew to let readers run side by side
+    XCTAssertGreaterThan(_database._poolStatistics.connectionsCreated, 1);
+}
+
+- (void)testLazyInitializationPerformance {
+    [self measureBlock:^{
+        RBDatabase *database = [[RBDatabase alloc] initWithFileURL:[self->_tempDirectoryURL URLByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+        dispatch_semaphore_t lookup = dispatch_semaphore_create(0);
+        
+        [database allowlistEntryForDomain:@"yolo.com" completionHandler:^(RBAllowlistEntry *entry, NSError *error) {
+            dispatch_semaphore_signal(lookup);
+        }];
+        
+        dispatch_semaphore_wait(lookup, DISPATCH_TIME_FOREVER);
+        [database _drainPool];
+    }];
+}
+
 - (void)testAllowlistEntryLookupSubdomain {
     NSString *domain = [NSStringFromSelector(_cmd) stringByAppendingString:@".app"];
     NSString *subdomain = [@"wow." stringByAppendingString:domain];
@@ -578,6 +628,114 @@
     [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+- (void)testAllowlistChanges {
+    NSString *domain = [NSStringFromSelector(_cmd) stringByAppendingString:@".app"];
+    NSString *otherDomain = [@"other." stringByAppendingString:domain];
+    RBDatabase *otherAllowlist = [[RBDatabase alloc] initWithFileURL:_database.fileURL];
+
+    [self addTeardownBlock:^{
+        [otherAllowlist _drainPool];
+    }];
+
+    XCTestExpectation *initial = [self expectationWithDescription:@"initial"];
+
+    [_database getAllowlistChangeSequenceNumberWithCompletionHandler:^(int64_t sequenceNumber, NSError *error) {
+        XCTAssertNil(error, @"%@", error);
+        XCTAssertEqual(sequenceNumber, 0);
+        [initial fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+
+    [self expectationForNotification:RBDatabaseDidAdvanceChangeSequenceNotification object:_database handler:^BOOL(NSNotification *notification) {
+        return [notification.userInfo[RBDatabaseLocalModificationKey] boolValue] && [notification.userInfo[RBDatabaseChangeSequenceNumberKey] longLongValue] == 1;
+    }];
+
+    for (NSString *d in @[domain, otherDomain, domain]) {
+        [_database writeAllowlistEntryForDomain:d usingBlock:nil completionHandler:^(RBAllowlistEntry *entry, NSError *error) {
+            XCTAssertNotNil(entry, @"%@", error);
+        }];
+    }
+
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+
+    XCTestExpectation *remove = [self expectationWithDescription:@"remove"];
+
+    [_database removeAllowlistEntriesForDomains:@[domain, otherDomain, @"missing.app"] completionHandler:^(NSError *error) {
+        XCTAssertNil(error, @"%@", error);
+        [remove fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+
+    // Changes made by another instance should be picked up via data_version
+    XCTestExpectation *changesExpectation = [self expectationWithDescription:@"changes"];
+
+    [otherAllowlist allowlistChangesSinceSequenceNumber:1 completionHandler:^(NSArray<RBAllowlistChange *> *changes, int64_t sequenceNumber, NSError *error) {
+        XCTAssertNotNil(changes, @"%@", error);
+        XCTAssertEqual(sequenceNumber, 5);
+        XCTAssertEqualObjects([changes valueForKeyPath:@"domain"], (@[otherDomain, domain, domain, otherDomain]));
+        XCTAssertEqualObjects([changes valueForKeyPath:@"type"], (@[@(RBAllowlistChangeTypeAdd), @(RBAllowlistChangeTypeUpdate), @(RBAllowlistChangeTypeRemove), @(RBAllowlistChangeTypeRemove)]));
+        XCTAssertEqual(changes.lastObject.sequenceNumber, 5);
+
+        [changesExpectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+
+    XCTestExpectation *upToDate = [self expectationWithDescription:@"up to date"];
+
+    [_database allowlistChangesSinceSequenceNumber:5 completionHandler:^(NSArray<RBAllowlistChange *> *changes, int64_t sequenceNumber, NSError *error) {
+        XCTAssertEqualObjects(changes, @[], @"%@", error);
+        XCTAssertEqual(sequenceNumber, 5);
+        [upToDate fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testAllowlistChangeLogCapacity {
+    RBDatabase *database = [[RBDatabase alloc] initWithFileURL:_database.fileURL];
+    database._changeLogCapacity = 2;
+
+    [self addTeardownBlock:^{
+        [database _drainPool];
+    }];
+
+    XCTestExpectation *write = [self expectationWithDescription:@"write"];
+    write.expectedFulfillmentCount = 4;
+
+    for (int i = 0; i < 4; i++) {
+        [database writeAllowlistEntryForDomain:[NSString stringWithFormat:@"%d.app", i] usingBlock:nil completionHandler:^(RBAllowlistEntry *entry, NSError *error) {
+            XCTAssertNotNil(entry, @"%@", error);
+            [write fulfill];
+        }];
+    }
+
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+
+    // Only the last two changes can be replayed
+    XCTestExpectation *recent = [self expectationWithDescription:@"recent"];
+
+    [database allowlistChangesSinceSequenceNumber:2 completionHandler:^(NSArray<RBAllowlistChange *> *changes, int64_t sequenceNumber, NSError *error) {
+        XCTAssertEqualObjects([changes valueForKeyPath:@"domain"], (@[@"2.app", @"3.app"]), @"%@", error);
+        XCTAssertEqual(sequenceNumber, 4);
+        [recent fulfill];
+    }];
+
+    XCTestExpectation *pruned = [self expectationWithDescription:@"pruned"];
+
+    [database allowlistChangesSinceSequenceNumber:1 completionHandler:^(NSArray<RBAllowlistChange *> *changes, int64_t sequenceNumber, NSError *error) {
+        XCTAssertNil(changes);
+        XCTAssertEqualObjects(error.domain, RBDatabaseErrorDomain);
+        XCTAssertEqual(error.code, RBDatabaseErrorChangesUnavailable);
+        XCTAssertEqual(sequenceNumber, 4);
+        [pruned fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
 - (void)testAllowlistConcurrency {
     const int numInstances = 3;
     const int numReads = 10;
@@ -724,6 +882,94 @@
     [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+- (void)testTopDomains {
+    [self addTeardownBlock:^{ self->_database._statDate = nil; }];
+    
+    NSString *name = self.testRun.test.name;
+    
+    [_database incrementStatWithName:name domain:@"aaa.com" by:3];
+    [_database incrementStatWithName:name domain:@"bbb.com" by:1];
+    [_database incrementStatWithName:@"other" domain:@"ccc.com" by:10];
+    
+    _database._statDate = [NSDate dateWithTimeIntervalSinceNow:6*-24*60*60];
+    [_database incrementStatWithName:name domain:@"bbb.com" by:5];
+    
+    _database._statDate = [NSDate dateWithTimeIntervalSinceNow:14*-24*60*60];
+    [_database incrementStatWithName:name domain:@"ccc.com" by:20];
+    
+    XCTestExpectation *lookup = [self expectationWithDescription:@"lookup"];
+    lookup.expectedFulfillmentCount = 3;
+    
+    [_database getTopDomainsForStatWithName:name inDateRange:[RBDateRange today] limit:10 completionHandler:^(NSArray<RBStat *> *stats, NSError *error) {
+        XCTAssertEqualObjects([stats valueForKey:@"name"], (@[@"aaa.com", @"bbb.com"]), @"%@", error);
+        XCTAssertEqualObjects([stats valueForKey:@"value"], (@[@3, @1]), @"%@", error);
+        [lookup fulfill];
+    }];
+    
+    [_database getTopDomainsForStatWithName:name inDateRange:[RBDateRange lastWeek] limit:10 completionHandler:^(NSArray<RBStat *> *stats, NSError *error) {
+        XCTAssertEqualObjects([stats valueForKey:@"name"], (@[@"bbb.com", @"aaa.com"]), @"%@", error);
+        XCTAssertEqualObjects([stats valueForKey:@"value"], (@[@6, @3]), @"%@", error);
+        [lookup fulfill];
+    }];
+    
+    [_database getTopDomainsForStatWithName:name inDateRange:[RBDateRange lastMonth] limit:1 completionHandler:^(NSArray<RBStat *> *stats, NSError *error) {
+        XCTAssertEqualObjects([stats valueForKey:@"name"], @[@"ccc.com"], @"%@", error);
+        XCTAssertEqualObjects([stats valueForKey:@"value"], @[@20], @"%@", error);
+        [lookup fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    // Counts which were already persisted are merged with new ones
+    _database._statDate = nil;
+    [_database incrementStatWithName:name domain:@"bbb.com" by:4];
+    
+    XCTestExpectation *relookup = [self expectationWithDescription:@"relookup"];
+    
+    [_database getTopDomainsForStatWithName:name inDateRange:[RBDateRange today] limit:10 completionHandler:^(NSArray<RBStat *> *stats, NSError *error) {
+        XCTAssertEqualObjects([stats valueForKey:@"name"], (@[@"bbb.com", @"aaa.com"]), @"%@", error);
+        XCTAssertEqualObjects([stats valueForKey:@"value"], (@[@5, @3]), @"%@", error);
+        [relookup fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testTopDomainsKeptWhenBusy {
+    NSString *name = self.testRun.test.name;
+    
+    XCTestExpectation *setup = [self expectationWithDescription:@"setup"];
+    [_database getTopDomainsForStatWithName:name inDateRange:[RBDateRange today] limit:10 completionHandler:^(NSArray<RBStat *> *stats, NSError *error) {
+        [setup fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    // Another connection (like one in another process) holds the write lock
+    sqlite3 *conn = NULL;
+    XCTAssertEqual(sqlite3_open(_database.fileURL.fileSystemRepresentation, &conn), SQLITE_OK);
+    XCTAssertEqual(RBSQLiteExecute(conn, @"BEGIN EXCLUSIVE TRANSACTION"), SQLITE_DONE);
+    
+    [_database incrementStatWithName:name domain:@"aaa.com" by:3];
+    
+    XCTestExpectation *busyLookup = [self expectationWithDescription:@"busy lookup"];
+    [_database getTopDomainsForStatWithName:name inDateRange:[RBDateRange today] limit:10 completionHandler:^(NSArray<RBStat *> *stats, NSError *error) {
+        [busyLookup fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    
+    XCTAssertEqual(RBSQLiteExecute(conn, @"COMMIT TRANSACTION"), SQLITE_DONE);
+    sqlite3_close(conn);
+    
+    // The counts which couldn't be written are written with the next flush
+    XCTestExpectation *lookup = [self expectationWithDescription:@"lookup"];
+    [_database getTopDomainsForStatWithName:name inDateRange:[RBDateRange today] limit:10 completionHandler:^(NSArray<RBStat *> *stats, NSError *error) {
+        XCTAssertEqualObjects([stats valueForKey:@"name"], @[@"aaa.com"], @"%@", error);
+        XCTAssertEqualObjects([stats valueForKey:@"value"], @[@3], @"%@", error);
+        [lookup fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
 - (void)testStatConcurrency {
     const int numInstances = 3;
     const int numReads = 10;
@@ -0,0 +1,102 @@
+//
+//  RBDeltaTests.m
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "RBDelta.h"
+#import "RBUtils.h"
+
+
+@interface RBDeltaTests : XCTestCase
+@end
+
+
+@implementation RBDeltaTests {
+    NSURL *_tempDirectoryURL;
+}
+
+- (void)setUp {
+    self.continueAfterFailure = NO;
+    _tempDirectoryURL = RBCreateTemporaryDirectory(NULL);
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:_tempDirectoryURL error:NULL];
+}
+
+- (NSData *)_applyDelta:(NSData *)delta toData:(NSData *)baseData error:(NSError **)outError {
+    NSURL *baseURL = [_tempDirectoryURL URLByAppendingPathComponent:@"base"];
+    NSURL *outputURL = [_tempDirectoryURL URLByAppendingPathComponent:@"output"];
+    
+    [baseData writeToURL:baseURL atomically:YES];
+    
+    if (![RBDelta applyDeltaData:delta toContentsOfFileURL:baseURL outputURL:outputURL error:outError]) {
+        return nil;
+    }
+    
+    return [NSData dataWithContentsOfURL:outputURL];
+}
+
+- (void)testRoundTrip {
+    NSMutableArray *lines = [NSMutableArray array];
+    for (int i = 0; i < 1000; i++) {
+        [lines addObject:[NSString stringWithFormat:@"||ads-%d.example.com^", i]];
+    }
+    
+    NSData *baseData = [[lines componentsJoinedByString:@"\n"] dataUsingEncoding:NSUTF8StringEncoding];
+    
+    [lines removeObjectAtIndex:500];
+    [lines insertObject:@"||new.example.net^" atIndex:10];
+    [lines exchangeObjectAtIndex:100 withObjectAtIndex:900];
+    [lines addObject:@"||last.example.org^"];
+    
+    NSData *targetData = [[lines componentsJoinedByString:@"\n"] dataUsingEncoding:NSUTF8StringEncoding];
+    NSData *delta = [RBDelta deltaFromData:baseData toData:targetData];
+    
+    NSError *error = nil;
+    XCTAssertEqualObjects([self _applyDelta:delta toData:baseData error:&error], targetData, @"%@", error);
+    XCTAssertLessThan(delta.length, targetData.length / 20);
+    
+    // Degenerate inputs
+    NSData *emptyData = [NSData data];
+    XCTAssertEqualObjects([self _applyDelta:[RBDelta deltaFromData:emptyData toData:targetData] toData:emptyData error:&error], targetData, @"%@", error);
+    XCTAssertEqualObjects([self _applyDelta:[RBDelta deltaFromData:baseData toData:emptyData] toData:baseData error:&error], emptyData, @"%@", error);
+    XCTAssertEqualObjects([self _applyDelta:[RBDelta deltaFromData:baseData toData:baseData] toData:baseData error:&error], baseData, @"%@", error);
+}
+
+- (void)testSingleLineRoundTrip {
+    NSData *baseData = [@"[{\"a\":1},{\"b\":2},{\"c\":3}]" dataUsingEncoding:NSUTF8StringEncoding];
+    NSData *targetData = [@"[{\"a\":1},{\"b\":4},{\"c\":3}]" dataUsingEncoding:NSUTF8StringEncoding];
+    NSData *delta = [RBDelta deltaFromData:baseData toData:targetData];
+    
+    NSError *error = nil;
+    XCTAssertEqualObjects([self _applyDelta:delta toData:baseData error:&error], targetData, @"%@", error);
+    XCTAssertLessThan(delta.length, targetData.length);
+}
+
+- (void)testCorruptDelta {
+    NSData *baseData = [@"line 1\nline 2\n" dataUsingEncoding:NSUTF8StringEncoding];
+    NSURL *outputURL = [_tempDirectoryURL URLByAppendingPathComponent:@"output"];
+    
+    // Bad magic, unknown op, copy out of bounds, truncated insert
+    NSArray<NSData*> *deltas = @[
+        [NSData dataWithBytes:"RBD0" length:4],
+        [NSData dataWithBytes:"RBD1X" length:5],
+        [NSData dataWithBytes:"RBD1C\x0a\x0a" length:7],
+        [NSData dataWithBytes:"RBD1I\x0a" "abc" length:9],
+    ];
+    
+    for (NSData *delta in deltas) {
+        NSError *error = nil;
+        XCTAssertNil([self _applyDelta:delta toData:baseData error:&error]);
+        XCTAssertEqualObjects(error.domain, NSCocoaErrorDomain);
+        XCTAssertEqual(error.code, NSFileReadCorruptFileError);
+        XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:outputURL.path]);
+    }
+}
+
+@end
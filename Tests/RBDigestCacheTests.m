@@ -0,0 +1,113 @@
+//
+//  RBDigestCacheTests.m
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "RBDigestCache.h"
+#import "RBDigest.h"
+#import "RBUtils.h"
+
+
+@interface RBDigestCacheTests : XCTestCase
+@end
+
+
+@implementation RBDigestCacheTests {
+    NSURL *_tempDirectoryURL;
+    NSURL *_cacheURL;
+    NSURL *_fileURL;
+}
+
+- (void)setUp {
+    self.continueAfterFailure = NO;
+    
+    _tempDirectoryURL = RBCreateTemporaryDirectory(NULL);
+    _cacheURL = [_tempDirectoryURL URLByAppendingPathComponent:@"Digests.plist"];
+    _fileURL = [_tempDirectoryURL URLByAppendingPathComponent:@"rules.json"];
+    
+    [[@"[{\"a\":1}]" dataUsingEncoding:NSUTF8StringEncoding] writeToURL:_fileURL atomically:YES];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:_tempDirectoryURL error:NULL];
+}
+
+- (void)testHashLargeFile {
+    // Spans several chunks and doesn't end on a chunk boundary
+    NSMutableData *data = [NSMutableData dataWithLength:(3 << 20) + 12345];
+    arc4random_buf(data.mutableBytes, data.length);
+    [data writeToURL:_fileURL atomically:YES];
+    
+    RBDigestCache *cache = [[RBDigestCache alloc] initWithFileURL:_cacheURL];
+    NSError *error = nil;
+    
+    XCTAssertEqualObjects([cache MD5HashOfFileURL:_fileURL error:&error], [RBDigest MD5HashOfData:data], @"%@", error);
+    XCTAssertEqualObjects([RBDigest MD5HashOfFileURL:_fileURL error:&error], [RBDigest MD5HashOfData:data], @"%@", error);
+}
+
+- (void)testUnchangedFileIsNotRead {
+    RBDigestCache *cache = [[RBDigestCache alloc] initWithFileURL:_cacheURL];
+    NSString *md5 = [RBDigest MD5HashOfFileURL:_fileURL error:NULL];
+    
+    XCTAssertEqualObjects([cache MD5HashOfFileURL:_fileURL error:NULL], md5);
+    
+    // A bogus hash is only returned if the file isn't read again
+    [cache setMD5Hash:@"bogus" forFileURL:_fileURL];
+    XCTAssertEqualObjects([cache MD5HashOfFileURL:_fileURL error:NULL], @"bogus");
+    
+    // Survives being reloaded
+    NSError *error = nil;
+    XCTAssertTrue([cache synchronizeWithError:&error], @"%@", error);
+    
+    cache = [[RBDigestCache alloc] initWithFileURL:_cacheURL];
+    XCTAssertEqualObjects([cache MD5HashOfFileURL:_fileURL error:NULL], @"bogus");
+}
+
+- (void)testChangedFileIsRehashed {
+    RBDigestCache *cache = [[RBDigestCache alloc] initWithFileURL:_cacheURL];
+    [cache setMD5Hash:@"bogus" forFileURL:_fileURL];
+    
+    // Same size, different file
+    NSData *data = [@"[{\"b\":2}]" dataUsingEncoding:NSUTF8StringEncoding];
+    [data writeToURL:_fileURL atomically:YES];
+    XCTAssertEqualObjects([cache MD5HashOfFileURL:_fileURL error:NULL], [RBDigest MD5HashOfData:data]);
+    
+    // Modified in place
+    [cache setMD5Hash:@"bogus" forFileURL:_fileURL];
+    
+    NSFileHandle *handle = [NSFileHandle fileHandleForWritingToURL:_fileURL error:NULL];
+    [handle seekToEndOfFile];
+    [handle writeData:[@"\n" dataUsingEncoding:NSUTF8StringEncoding]];
+    [handle closeFile];
+    
+    XCTAssertEqualObjects([cache MD5HashOfFileURL:_fileURL error:NULL], [RBDigest MD5HashOfFileURL:_fileURL error:NULL]);
+}
+
+- (void)testPeriodicVerification {
+    RBDigestCache *cache = [[RBDigestCache alloc] initWithFileURL:_cacheURL];
+    cache.verificationInterval = 0.05;
+    
+    [cache setMD5Hash:@"bogus" forFileURL:_fileURL];
+    XCTAssertEqualObjects([cache MD5HashOfFileURL:_fileURL error:NULL], @"bogus");
+    
+    [NSThread sleepForTimeInterval:0.1];
+    XCTAssertEqualObjects([cache MD5HashOfFileURL:_fileURL error:NULL], [RBDigest MD5HashOfFileURL:_fileURL error:NULL]);
+}
+
+- (void)testMissingFile {
+    RBDigestCache *cache = [[RBDigestCache alloc] initWithFileURL:_cacheURL];
+    XCTAssertNotNil([cache MD5HashOfFileURL:_fileURL error:NULL]);
+    
+    [[NSFileManager defaultManager] removeItemAtURL:_fileURL error:NULL];
+    
+    NSError *error = nil;
+    XCTAssertNil([cache MD5HashOfFileURL:_fileURL error:&error]);
+    XCTAssertEqualObjects(error.domain, NSCocoaErrorDomain);
+    XCTAssertEqual(error.code, NSFileReadNoSuchFileError);
+}
+
+@end
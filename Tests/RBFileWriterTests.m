@@ -0,0 +1,170 @@
+//
+//  RBFileWriterTests.m
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "RBFileWriter.h"
+#import "RBDigest.h"
+#import "RBUtils.h"
+#import "RBZip.h"
+
+
+@interface RBFileWriterTests : XCTestCase
+@end
+
+
+@implementation RBFileWriterTests {
+    NSURL *_tempDirectoryURL;
+}
+
+- (void)setUp {
+    self.continueAfterFailure = NO;
+    _tempDirectoryURL = RBCreateTemporaryDirectory(NULL);
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:_tempDirectoryURL error:NULL];
+}
+
+- (void)testInflateFile {
+    NSURL *input = [[NSBundle bundleForClass:[self class]] URLForResource:@"kith" withExtension:@"gz"];
+    NSURL *output = [_tempDirectoryURL URLByAppendingPathComponent:@"kith.jpg" isDirectory:NO];
+    NSString *md5 = nil;
+    NSError *error = nil;
+    
+    XCTAssertTrue([RBFileWriter writeContentsOfFileURL:input toFileURL:output inflate:YES MD5Hash:&md5 error:&error], @"%@", error);
+    XCTAssertEqualObjects(md5, @"bac8b8eeeecd7a48317c02d953d04a31");
+    XCTAssertEqualObjects([RBDigest MD5HashOfFileURL:output error:NULL], md5);
+}
+
+- (void)testCopyFile {
+    NSURL *input = [[NSBundle bundleForClass:[self class]] URLForResource:@"kith" withExtension:@"gz"];
+    NSURL *output = [_tempDirectoryURL URLByAppendingPathComponent:@"kith.gz" isDirectory:NO];
+    NSString *md5 = nil;
+    NSError *error = nil;
+    
+    XCTAssertTrue([RBFileWriter writeContentsOfFileURL:input toFileURL:output inflate:NO MD5Hash:&md5 error:&error], @"%@", error);
+    XCTAssertEqualObjects(md5, [RBDigest MD5HashOfFileURL:input error:NULL]);
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:output], [NSData dataWithContentsOfURL:input]);
+}
+
+- (void)testInflateInSmallChunks {
+    NSMutableData *data = [NSMutableData data];
+    for (int i = 0; i < 10000; i++) {
+        [data appendData:[[NSString stringWithFormat:@"||ads-%d.example.com^\n", i] dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    
+    NSURL *compressedURL = [_tempDirectoryURL URLByAppendingPathComponent:@"compressed"];
+    NSURL *outputURL = [_tempDirectoryURL URLByAppendingPathComponent:@"output"];
+    XCTAssertTrue([RBZip deflateData:data toFileURL:compressedURL error:NULL]);
+    
+    NSData *compressedData = [NSData dataWithContentsOfURL:compressedURL];
+    NSError *error = nil;
+    
+    RBFileWriter *writer = [[RBFileWriter alloc] initWithFileURL:outputURL inflate:YES error:&error];
+    XCTAssertNotNil(writer, @"%@", error);
+    
+    for (NSUInteger i = 0; i < compressedData.length; i += 7) {
+        NSData *chunk = [compressedData subdataWithRange:NSMakeRange(i, MIN(7, compressedData.length - i))];
+        XCTAssertTrue([writer appendData:chunk error:&error], @"%@", error);
+    }
+    
+    XCTAssertTrue([writer finishWithError:&error], @"%@", error);
+    XCTAssertEqual(writer.length, data.length);
+    XCTAssertEqualObjects(writer.MD5Hash, [RBDigest MD5HashOfData:data]);
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:outputURL], data);
+}
+
+- (void)testDeflateFile {
+    NSMutableData *data = [NSMutableData data];
+    for (int i = 0; i < 100000; i++) {
+        [data appendData:[[NSString stringWithFormat:@"||ads-%d.example.com^\n", i] dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    
+    NSURL *outputURL = [_tempDirectoryURL URLByAppendingPathComponent:@"output"];
+    NSError *error = nil;
+    
+    RBFileWriter *writer = [[RBFileWriter alloc] initWithFileURL:outputURL options:RBFileWriterOptionDeflate error:&error];
+    XCTAssertNotNil(writer, @"%@", error);
+    
+    for (NSUInteger i = 0; i < data.length; i += 1000) {
+        XCTAssertTrue([writer appendData:[data subdataWithRange:NSMakeRange(i, MIN(1000, data.length - i))] error:&error], @"%@", error);
+    }
+    
+    // Hashes and lengths refer to the content, not the file
+    XCTAssertTrue([writer finishWithError:&error], @"%@", error);
+    XCTAssertEqual(writer.length, data.length);
+    XCTAssertEqualObjects(writer.MD5Hash, [RBDigest MD5HashOfData:data]);
+    
+    XCTAssertTrue([RBZip isCompressedFileURL:outputURL]);
+    XCTAssertLessThan([NSData dataWithContentsOfURL:outputURL].length, data.length / 4);
+    XCTAssertEqualObjects([RBZip inflateData:[NSData dataWithContentsOfURL:outputURL] error:NULL], data);
+}
+
+- (void)testAppendToDeflatedFile {
+    NSMutableData *data = [NSMutableData data];
+    for (int i = 0; i < 100000; i++) {
+        [data appendData:[[NSString stringWithFormat:@"||ads-%d.example.com^\n", i] dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    
+    NSURL *outputURL = [_tempDirectoryURL URLByAppendingPathComponent:@"output"];
+    NSUInteger half = data.length / 2;
+    NSError *error = nil;
+    
+    RBFileWriter *writer = [[RBFileWriter alloc] initWithFileURL:outputURL options:RBFileWriterOptionDeflate error:&error];
+    XCTAssertTrue([writer appendData:[data subdataWithRange:NSMakeRange(0, half)] error:&error], @"%@", error);
+    XCTAssertTrue([writer finishWithError:&error], @"%@", error);
+    
+    // Interrupted files keep everything up to their last flush
+    NSData *compressedData = [NSData dataWithContentsOfURL:outputURL];
+    XCTAssertTrue([[compressedData subdataWithRange:NSMakeRange(0, compressedData.length - 100)] writeToURL:outputURL atomically:NO]);
+    
+    writer = [[RBFileWriter alloc] initForAppendingToFileURL:outputURL options:RBFileWriterOptionDeflate error:&error];
+    XCTAssertNotNil(writer, @"%@", error);
+    XCTAssertGreaterThan(writer.length, 0);
+    XCTAssertLessThan(writer.length, half);
+    
+    XCTAssertTrue([writer appendData:[data subdataWithRange:NSMakeRange(writer.length, data.length - writer.length)] error:&error], @"%@", error);
+    XCTAssertTrue([writer finishWithError:&error], @"%@", error);
+    XCTAssertEqual(writer.length, data.length);
+    XCTAssertEqualObjects(writer.MD5Hash, [RBDigest MD5HashOfData:data]);
+    XCTAssertEqualObjects([RBZip inflateData:[NSData dataWithContentsOfURL:outputURL] error:NULL], data);
+    
+    // Plain files are appended to as they are
+    XCTAssertTrue([[data subdataWithRange:NSMakeRange(0, half)] writeToURL:outputURL atomically:NO]);
+    
+    writer = [[RBFileWriter alloc] initForAppendingToFileURL:outputURL options:0 error:&error];
+    XCTAssertEqual(writer.length, half);
+    XCTAssertTrue([writer appendData:[data subdataWithRange:NSMakeRange(half, data.length - half)] error:&error], @"%@", error);
+    XCTAssertTrue([writer finishWithError:&error], @"%@", error);
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:outputURL], data);
+    XCTAssertEqualObjects([[NSFileManager defaultManager] contentsOfDirectoryAtPath:_tempDirectoryURL.path error:NULL], @[@"output"]);
+}
+
+- (void)testTruncatedInput {
+    NSURL *input = [[NSBundle bundleForClass:[self class]] URLForResource:@"kith" withExtension:@"gz"];
+    NSData *compressedData = [NSData dataWithContentsOfURL:input];
+    NSURL *outputURL = [_tempDirectoryURL URLByAppendingPathComponent:@"output"];
+    NSError *error = nil;
+    
+    RBFileWriter *writer = [[RBFileWriter alloc] initWithFileURL:outputURL inflate:YES error:&error];
+    XCTAssertTrue([writer appendData:[compressedData subdataWithRange:NSMakeRange(0, compressedData.length / 2)] error:&error], @"%@", error);
+    XCTAssertFalse([writer finishWithError:&error]);
+    XCTAssertEqualObjects(error.domain, NSPOSIXErrorDomain);
+    XCTAssertEqual(error.code, EFTYPE);
+    XCTAssertNil(writer.MD5Hash);
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:outputURL.path]);
+}
+
+- (void)testBadOutput {
+    NSError *error = nil;
+    XCTAssertNil([[RBFileWriter alloc] initWithFileURL:[NSURL fileURLWithPath:@"/no/such/path"] inflate:NO error:&error]);
+    XCTAssertEqualObjects(error.domain, NSCocoaErrorDomain);
+    XCTAssertEqual(error.code, NSFileWriteUnknownError);
+}
+
+@end
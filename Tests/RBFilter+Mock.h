@@ -24,6 +24,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)copyByMergingPropertyList:(NSDictionary *)plist;
 - (instancetype)copyOutOfSync;
+- (instancetype)copyWithRules:(NSArray<NSDictionary*>*)rules;
 
 @end
 
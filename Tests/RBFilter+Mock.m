@@ -151,9 +151,13 @@
 }
 
 - (instancetype)copyOutOfSync {
-    NSArray<NSDictionary*>* rules = @[@{ @"action": @{@"type": @"block"}, @"selector": @{@"unless-domain": @[@"out-of-sync.com"]}}];
+    return [self copyWithRules:@[@{ @"action": @{@"type": @"block"}, @"selector": @{@"unless-domain": @[@"out-of-sync.com"]}}]];
+}
+
+- (instancetype)copyWithRules:(NSArray<NSDictionary*>*)rules {
     NSMutableDictionary *plistCopy = [self.propertyList mutableCopy];
     plistCopy[@"md5"] = [RBDigest MD5HashOfData:[RBMockClient jsonData:rules]];
+    plistCopy[@"numberOfRules"] = @(rules.count);
     
     RBFilter *filter = [[[self class] alloc] initWithPropertyList:plistCopy];
     [[self class] _rulesDictionary][filter.uniqueIdentifier] = rules;
@@ -8,6 +8,7 @@
 
 #import <XCTest/XCTest.h>
 #import "RBFilterBuilder.h"
+#import "RBZip.h"
 
 @interface RBFilterBuilderTests : XCTestCase
 @end
@@ -80,6 +81,36 @@ static int rulesPerFile = 1000;
     [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+- (void)testAsyncCompressed {
+    XCTestExpectation *build = [self expectationWithDescription:@"build"];
+    NSMutableArray<NSURL*> *fileURLs = [ruleFileURLs mutableCopy];
+    
+    // Compress the first file (which would otherwise be copied) and one in the middle
+    for (NSUInteger i = 0; i < fileURLs.count; i += 2) {
+        NSURL *url = [fileURLs[i] URLByAppendingPathExtension:@"z"];
+        NSError *error = nil;
+        
+        XCTAssertTrue([RBZip deflateData:[NSData dataWithContentsOfURL:fileURLs[i]] toFileURL:url error:&error], @"%@", error);
+        XCTAssertTrue([RBZip isCompressedFileURL:url]);
+        
+        fileURLs[i] = url;
+    }
+    
+    [RBFilterBuilder temporaryBuilderForFileURLs:fileURLs completionHandler:^(RBFilterBuilder *builder, NSError *error) {
+        NSData *data = [NSData dataWithContentsOfURL:builder.outputURL options:0 error:&error];
+        XCTAssertNotNil(data, @"%@", error);
+        
+        NSArray *decodedData = [NSJSONSerialization JSONObjectWithData:data options:0 error:&error];
+        XCTAssertNotNil(decodedData, @"%@", error);
+        
+        XCTAssertEqual(rulesPerFile * fileURLs.count, decodedData.count);
+        
+        [build fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
 - (void)testAsyncCancel {
     XCTestExpectation *build = [self expectationWithDescription:@"build"];
     
@@ -108,4 +139,42 @@ static int rulesPerFile = 1000;
     [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+- (void)testEnumerateRules {
+    NSArray *rules = @[
+        @{@"trigger": @{@"url-filter": @"a,b]"}, @"action": @{@"type": @"block"}},
+        @{@"trigger": @{@"url-filter": @"\"],[{", @"if-domain": @[@"*a.com", @"b.com"]}, @"action": @{@"type": @"block"}},
+        @1,
+    ];
+    
+    NSURL *url = [tempDirectoryURL URLByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    NSError *error = nil;
+    XCTAssertTrue([[NSJSONSerialization dataWithJSONObject:rules options:NSJSONWritingPrettyPrinted error:NULL] writeToURL:url options:0 error:&error], @"%@", error);
+    
+    NSMutableArray *enumeratedRules = [NSMutableArray array];
+    BOOL success = [RBFilterBuilder enumerateRulesInFileURL:url usingBlock:^(NSData *ruleData, BOOL *stop) {
+        NSError *error = nil;
+        id rule = [NSJSONSerialization JSONObjectWithData:ruleData options:NSJSONReadingAllowFragments error:&error];
+        XCTAssertNotNil(rule, @"%@", error);
+        [enumeratedRules addObject:rule];
+    } error:&error];
+    
+    XCTAssertTrue(success, @"%@", error);
+    XCTAssertEqualObjects(enumeratedRules, rules);
+    
+    // Compressed files are inflated as they're read
+    NSURL *compressedURL = [url URLByAppendingPathExtension:@"z"];
+    XCTAssertTrue([RBZip deflateData:[NSData dataWithContentsOfURL:ruleFileURLs[0]] toFileURL:compressedURL error:&error], @"%@", error);
+    
+    __block NSUInteger numberOfRules = 0;
+    XCTAssertTrue([RBFilterBuilder enumerateRulesInFileURL:compressedURL usingBlock:^(NSData *ruleData, BOOL *stop) {
+        numberOfRules++;
+    } error:&error], @"%@", error);
+    XCTAssertEqual(numberOfRules, rulesPerFile);
+    
+    // Truncated arrays are corrupt
+    XCTAssertTrue([@"[{\"a\":1}," writeToURL:url atomically:YES encoding:NSUTF8StringEncoding error:&error], @"%@", error);
+    XCTAssertFalse([RBFilterBuilder enumerateRulesInFileURL:url usingBlock:^(NSData *ruleData, BOOL *stop) {} error:&error]);
+    XCTAssertEqual(error.code, NSPropertyListReadCorruptError, @"%@", error);
+}
+
 @end
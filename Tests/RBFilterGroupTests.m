@@ -154,4 +154,63 @@
     XCTAssertEqual([frenchGermanFilters filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"language != 'de' AND language != 'fr'"]].count, (NSUInteger)0);
 }
 
+- (void)testReduceMatchesPredicate {
+    NSArray *filters = [[RBFilter mockFilters:200] arrayByAddingObjectsFromArray:@[
+        [[RBFilter mockFilterWithGroup:@"privacy" rules:nil] copyByMergingPropertyList:@{@"selector": @"social"}],
+        [[RBFilter mockFilterWithGroup:@"annoyance" rules:nil] copyByMergingPropertyList:@{@"selector": @"cookies"}],
+        [[RBFilter mockFilterWithGroup:@"ads" rules:nil] copyByMergingPropertyList:@{@"language": @"fr"}],
+    ]];
+    
+    _regionalGroup.languageCodes = @[@"fr", @"de"];
+    _privacyGroup.socialMediaFilterEnabled = YES;
+    _annoyanceGroup.cookiesFilterEnabled = YES;
+    
+    // Local evaluation doesn't use predicates, but must agree with the ones sent to CloudKit (including order)
+    for (RBFilterGroup *group in @[_adGroup, _regionalGroup, _privacyGroup, _annoyanceGroup]) {
+        XCTAssertEqualObjects([group reduceFilters:filters], [filters filteredArrayUsingPredicate:group._filterPredicate], @"%@", group.name);
+    }
+}
+
+- (void)testIndexIsInvalidatedBySettings {
+    NSArray *filters = @[
+        [RBFilter mockFilterWithGroup:@"privacy" rules:nil],
+        [[RBFilter mockFilterWithGroup:@"privacy" rules:nil] copyByMergingPropertyList:@{@"selector": @"social"}],
+    ];
+    
+    RBFilterGroupIndex *index = [RBFilterGroupIndex indexForFilters:filters];
+    XCTAssertEqual([RBFilterGroupIndex indexForFilters:filters], index);
+    
+    _RBFilterGroupMembership *membership = _privacyGroup._membership;
+    XCTAssertEqual(_privacyGroup._membership, membership);
+    XCTAssertEqual([index filtersForGroup:_privacyGroup].count, 1);
+    
+    _privacyGroup.socialMediaFilterEnabled = YES;
+    XCTAssertNotEqual(_privacyGroup._membership, membership);
+    XCTAssertEqual([index filtersForGroup:_privacyGroup].count, 2);
+    
+    _privacyGroup.socialMediaFilterEnabled = NO;
+    XCTAssertEqualObjects(_privacyGroup._membership, membership);
+    XCTAssertEqual([index filtersForGroup:_privacyGroup].count, 1);
+}
+
+- (void)testIndexIsReleasedWithFilters {
+    __weak NSArray *weakFilters = nil;
+    __weak RBFilterGroupIndex *weakIndex = nil;
+    
+    @autoreleasepool {
+        NSArray *filters = [RBFilter mockFilters:10];
+        weakFilters = filters;
+        
+        RBFilterGroupIndex *index = [RBFilterGroupIndex indexForFilters:filters];
+        weakIndex = index;
+        
+        XCTAssertEqual(index.filters, filters);
+        XCTAssertEqual([RBFilterGroupIndex indexForFilters:filters], index);
+        XCTAssertGreaterThan([index filtersForGroup:_adGroup].count, 0);
+    }
+    
+    XCTAssertNil(weakFilters);
+    XCTAssertNil(weakIndex);
+}
+
 @end
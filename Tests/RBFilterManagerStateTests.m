@@ -10,6 +10,7 @@
 #import "RBFilterManagerState-Private.h"
 #import "RBFilter+Mock.h"
 #import "RBFilterGroup.h"
+#import "RBKVO.h"
 #import "RBUtils.h"
 #import "RBDatabase-Private.h"
 
@@ -122,6 +123,148 @@
     XCTAssertEqual(otherState.annoyanceFilterGroup.isCookiesFilterEnabled, _state.annoyanceFilterGroup.isCookiesFilterEnabled);
 }
 
+- (void)testFilterSnapshot {
+    XCTAssertEqualObjects(_state.filters, @[]);
+    
+    NSArray<RBFilter*> *filters = [RBFilter mockFilters:5];
+    uint64_t generation = _state._filtersGeneration;
+    
+    _state.filters = filters;
+    XCTAssertGreaterThan(_state._filtersGeneration, generation);
+    XCTAssertEqualObjects(_state.filters, filters);
+    
+    // Unchanged values are shared rather than rebuilt from the defaults
+    XCTAssertEqual(_state.filters, _state.filters);
+    
+    // Writing the same list again doesn't change anything
+    generation = _state._filtersGeneration;
+    _state.filters = [filters copy];
+    XCTAssertEqual(_state._filtersGeneration, generation);
+    
+    _state.filters = @[];
+    XCTAssertGreaterThan(_state._filtersGeneration, generation);
+    XCTAssertEqualObjects(_state.filters, @[]);
+}
+
+- (void)testFilterSnapshotExternalChange {
+    NSArray<RBFilter*> *filters = [RBFilter mockFilters:5];
+    _state.filters = filters;
+    
+    // Another state (like one in another process) writes new filters
+    RBFilterManagerState *otherState = [_state copy];
+    XCTAssertEqualObjects(otherState.filters, filters);
+    
+    NSArray<RBFilter*> *otherFilters = [RBFilter mockFilters:3];
+    otherState.filters = otherFilters;
+    
+    XCTAssertEqualObjects(otherState.filters, otherFilters);
+    XCTAssertEqualObjects(_state.filters, otherFilters);
+}
+
+- (void)testFilterSnapshotWithStaleDefaults {
+    NSUserDefaults *defaults = [[NSUserDefaults alloc] initWithSuiteName:self.className];
+    RBFilterManagerState *otherState = [_state copy];
+    
+    _state.filters = [RBFilter mockFilters:5];
+    id staleFilterList = [defaults objectForKey:@"filterList"];
+    
+    NSArray<RBFilter*> *otherFilters = [RBFilter mockFilters:3];
+    otherState.filters = otherFilters;
+    id filterList = [defaults objectForKey:@"filterList"];
+    
+    // The new generation is visible before the defaults have caught up (like they might in another process)
+    [defaults setObject:staleFilterList forKey:@"filterList"];
+    RBFilterManagerState *thirdState = [_state copy];
+    XCTAssertNotEqualObjects(thirdState.filters, otherFilters);
+    
+    // What was read isn't trusted once the defaults arrive
+    [defaults setObject:filterList forKey:@"filterList"];
+    XCTAssertEqualObjects(thirdState.filters, otherFilters);
+}
+
+- (void)testFilterGroupWithStaleDefaults {
+    NSUserDefaults *defaults = [[NSUserDefaults alloc] initWithSuiteName:self.className];
+    NSString *key = [_state.privacyFilterGroup.name stringByAppendingString:@"FilterGroupEntry"];
+    RBFilterManagerState *otherState = [_state copy];
+    
+    _state.privacyFilterGroup.socialMediaFilterEnabled = NO;
+    [_state _waitUntilSynchronized];
+    id staleEntry = [defaults objectForKey:key];
+    
+    otherState.privacyFilterGroup.socialMediaFilterEnabled = YES;
+    [otherState _waitUntilSynchronized];
+    id entry = [defaults objectForKey:key];
+    XCTAssertNotEqualObjects(entry, staleEntry);
+    
+    // The new generation is visible before the defaults have caught up (like they might in another process)
+    [defaults setObject:staleEntry forKey:key];
+    RBFilterManagerState *thirdState = [_state copy];
+    XCTAssertFalse(thirdState.privacyFilterGroup.isSocialMediaFilterEnabled);
+    
+    // The group is reloaded once the defaults arrive
+    [defaults setObject:entry forKey:key];
+    [self expectationForPredicate:[NSPredicate predicateWithFormat:@"privacyFilterGroup.socialMediaFilterEnabled == YES"] evaluatedWithObject:thirdState handler:nil];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+}
+
+- (void)testObservedValuesIncludeOldValue {
+    NSUInteger numberOfFailures = _state.numberOfFailuresSinceLastSynchronize;
+    __block NSDictionary *change = nil;
+    
+    RBKVO *observer = [RBKVO observe:_state keyPath:@"numberOfFailuresSinceLastSynchronize" options:NSKeyValueObservingOptionOld|NSKeyValueObservingOptionNew usingBlock:^(RBFilterManagerState *state, NSDictionary *observedChange) {
+        change = observedChange;
+    }];
+    
+    _state.numberOfFailuresSinceLastSynchronize = numberOfFailures + 1;
+    [observer invalidate];
+    
+    XCTAssertEqualObjects(change[NSKeyValueChangeOldKey], @(numberOfFailures));
+    XCTAssertEqualObjects(change[NSKeyValueChangeNewKey], @(numberOfFailures + 1));
+}
+
+- (void)testSharedValues {
+    RBFilterManagerState *otherState = [_state copy];
+    [self keyValueObservingExpectationForObject:_state keyPath:@"numberOfFailuresSinceLastSynchronize" expectedValue:@(3)];
+    
+    otherState.numberOfFailuresSinceLastSynchronize = 3;
+    
+    // Reads don't wait for the change to be observed
+    XCTAssertEqual(_state.numberOfFailuresSinceLastSynchronize, 3);
+    XCTAssertEqualObjects(_state.nextSynchronizeDate, otherState.nextSynchronizeDate);
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testMigrateValuesFromDefaults {
+    NSString *suiteName = [self.className stringByAppendingString:@".migration"];
+    NSURL *tempDirectoryURL = RBCreateTemporaryDirectory(NULL);
+    NSUserDefaults *defaults = [[NSUserDefaults alloc] initWithSuiteName:suiteName];
+    
+    [self addTeardownBlock:^{
+        [[NSFileManager defaultManager] removeItemAtURL:tempDirectoryURL error:NULL];
+        [[[NSUserDefaults alloc] init] removePersistentDomainForName:suiteName];
+    }];
+    
+    NSDate *lastSynchronizeDate = [NSDate dateWithTimeIntervalSinceReferenceDate:1000];
+    
+    [defaults setObject:NSStringFromRBSynchronizeInterval(RBSynchronizeIntervalMonthly) forKey:@"synchronizeInterval"];
+    [defaults setObject:lastSynchronizeDate forKey:@"lastSynchronizeDate"];
+    [defaults setObject:@(1000) forKey:@"lastSynchronizeAttemptDate"];
+    [defaults setObject:@(2) forKey:@"numberOfFailuresSinceLastSynchronize"];
+    
+    RBFilterManagerState *state = [[RBFilterManagerState alloc] _initWithDefaults:defaults filterGroupDirectoryURL:[tempDirectoryURL URLByAppendingPathComponent:@"groups" isDirectory:YES]];
+    
+    XCTAssertEqual(state.synchronizeInterval, RBSynchronizeIntervalMonthly);
+    XCTAssertEqualObjects(state.lastSynchronizeDate, lastSynchronizeDate);
+    XCTAssertEqualObjects(state.lastSynchronizeAttemptDate, [NSDate dateWithTimeIntervalSince1970:1000]);
+    XCTAssertEqual(state.numberOfFailuresSinceLastSynchronize, 2);
+    XCTAssertFalse(state.isDisabled);
+    
+    // The defaults aren't kept up to date, so they're gone once migrated
+    XCTAssertNil([defaults objectForKey:@"synchronizeInterval"]);
+    XCTAssertNil([defaults objectForKey:@"lastSynchronizeDate"]);
+}
+
 static NSArray *_defaultsValueArgs(id value) {
     if (value == nil) {
         return @[];
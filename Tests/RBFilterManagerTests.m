@@ -17,6 +17,7 @@
 #import "RBUtils.h"
 #import "RBDigest.h"
 #import "RBDatabase-Private.h"
+#import "RBKVO.h"
 
 
 @interface RBFilterManagerTests : XCTestCase
@@ -306,6 +307,177 @@
     [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+- (void)testSynchronizeCoalescing {
+    NSArray<RBFilter*> *filters = [RBFilter standardMockFilters:4];
+    [_mockClient mockFilters:filters];
+    
+    _mockClient.cloudKitEnabled = NO;
+    _mockClient.latency = 0.02;
+    
+    __block NSUInteger numberOfRuns = 0;
+    RBKVO *synchronizingBinding = [RBKVO observe:_manager keyPath:@"synchronizing" options:NSKeyValueObservingOptionNew usingBlock:^(RBFilterManager *manager, NSDictionary *changes) {
+        if ([changes[NSKeyValueChangeNewKey] boolValue]) {
+            numberOfRuns++;
+        }
+    }];
+    
+    // Timers, app launches and refreshes can all ask at once
+    NSUInteger numberOfRequests = 100;
+    NSMutableArray<NSProgress*> *progresses = [NSMutableArray array];
+    
+    XCTestExpectation *sync = [self expectationWithDescription:@"sync"];
+    sync.expectedFulfillmentCount = numberOfRequests;
+    
+    dispatch_apply(numberOfRequests, DISPATCH_APPLY_AUTO, ^(size_t i) {
+        NSProgress *progress = [self->_manager synchronizeWithOptions:(i % 2 ? RBSynchronizeOptionRescheduleOnError : 0) completionHandler:^(NSError *error) {
+            XCTAssertNil(error, @"%@", error);
+            [sync fulfill];
+        }];
+        
+        @synchronized (progresses) {
+            [progresses addObject:progress];
+        }
+    });
+    
+    [self waitForExpectationsWithTimeout:2 handler:nil];
+    [synchronizingBinding invalidate];
+    
+    // The work was done once
+    XCTAssertEqual(numberOfRuns, 1);
+    XCTAssertEqual([_mockClient requestsForPath:@"/filters"].count, _manager.state.filterGroups.count);
+    
+    for (RBFilter *filter in filters) {
+        XCTAssertEqual([_mockClient requestsForPath:[@"/filter/" stringByAppendingString:filter.uniqueIdentifier]].count, 1, @"%@", filter);
+    }
+    
+    XCTAssertEqual(_manager.filterRuleURLs.count, filters.count);
+    XCTAssertFalse(_manager.isSynchronizing);
+    
+    for (NSProgress *progress in progresses) {
+        XCTAssertEqual(progress.fractionCompleted, 1.0);
+    }
+}
+
+- (void)testSynchronizeCoalescingFollowUp {
+    [_mockClient mockFilters:[RBFilter standardMockFilters:4]];
+    
+    _mockClient.cloudKitEnabled = NO;
+    _mockClient.latency = 0.1;
+    
+    XCTestExpectation *sync = [self expectationWithDescription:@"sync"];
+    sync.expectedFulfillmentCount = 11;
+    
+    [_manager synchronizeWithOptions:0 completionHandler:^(NSError *error) {
+        XCTAssertNil(error, @"%@", error);
+        [sync fulfill];
+    }];
+    
+    // Callers which expect different groups can't share the current run, so they share a follow-up
+    [NSThread sleepForTimeInterval:0.02];
+    [_manager _performBlockAndWait:^{
+        self->_manager.state.regionalFilterGroup.languageCodes = @[@"fr"];
+    }];
+    
+    __block NSUInteger numberOfFollowUpCalls = 0;
+    
+    for (int i = 0; i < 10; i++) {
+        [_manager synchronizeWithOptions:0 completionHandler:^(NSError *error) {
+            XCTAssertNil(error, @"%@", error);
+            numberOfFollowUpCalls++;
+            [sync fulfill];
+        }];
+    }
+    
+    [self waitForExpectationsWithTimeout:2 handler:nil];
+    
+    XCTAssertEqual(numberOfFollowUpCalls, 10);
+    XCTAssertEqual([_mockClient requestsForPath:@"/filters"].count, _manager.state.filterGroups.count * 2);
+}
+
+- (void)testSynchronizeCancelSharedRequest {
+    [_mockClient mockFilters:[RBFilter standardMockFilters:4]];
+    
+    _mockClient.cloudKitEnabled = NO;
+    _mockClient.latency = 0.05;
+    
+    XCTestExpectation *sync = [self expectationWithDescription:@"sync"];
+    XCTestExpectation *cancel = [self expectationWithDescription:@"cancel"];
+    
+    [_manager synchronizeWithOptions:0 completionHandler:^(NSError *error) {
+        XCTAssertNil(error, @"%@", error);
+        [sync fulfill];
+    }];
+    
+    // Canceling one caller doesn't cancel the run for the others
+    [[_manager synchronizeWithOptions:0 completionHandler:^(NSError *error) {
+        XCTAssertEqualObjects(error.domain, NSCocoaErrorDomain);
+        XCTAssertEqual(error.code, NSUserCancelledError);
+        [cancel fulfill];
+    }] cancel];
+    
+    [self waitForExpectationsWithTimeout:2 handler:nil];
+}
+
+- (void)testSynchronizeCancelBeforeStarting {
+    [_mockClient mockFilters:[RBFilter standardMockFilters:4]];
+    
+    _mockClient.cloudKitEnabled = NO;
+    
+    XCTestExpectation *cancel = [self expectationWithDescription:@"cancel"];
+    
+    // Callers which cancel before their request reaches the manager's queue don't start a run
+    [_manager _performBlockAndWait:^{
+        [[self->_manager synchronizeWithOptions:0 completionHandler:^(NSError *error) {
+            XCTAssertEqualObjects(error.domain, NSCocoaErrorDomain);
+            XCTAssertEqual(error.code, NSUserCancelledError);
+            [cancel fulfill];
+        }] cancel];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2 handler:nil];
+    
+    XCTAssertEqual([_mockClient requestsForPath:@"/filters"].count, 0);
+    XCTAssertFalse(_manager.isSynchronizing);
+}
+
+- (void)testSynchronizeJoinAfterError {
+    RBFilter *filter = [RBFilter mockFilter];
+    [_mockClient mockFilters:@[filter]];
+    
+    NSError *unknownError = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorUnknown userInfo:nil];
+    [_mockClient mockError:unknownError forFilter:filter];
+    
+    XCTestExpectation *sync = [self expectationWithDescription:@"sync"];
+    sync.expectedFulfillmentCount = 2;
+    
+    XCTestExpectation *replayedError = [self expectationWithDescription:@"replayed error"];
+    
+    __block BOOL joined = NO;
+    
+    [_manager synchronizeWithOptions:0 errorHandler:^(RBFilterGroup *filterGroup, NSError *error, BOOL *stop) {
+        if (joined) {
+            return;
+        }
+        joined = YES;
+        
+        // Callers which join after a group failed still hear about it
+        [self->_manager synchronizeWithOptions:0 errorHandler:^(RBFilterGroup *lateFilterGroup, NSError *lateError, BOOL *lateStop) {
+            XCTAssertEqualObjects(lateFilterGroup, filterGroup);
+            XCTAssertEqualObjects(lateError, error);
+            [replayedError fulfill];
+        } completionHandler:^(NSError *err) {
+            XCTAssertNotNil(err);
+            [sync fulfill];
+        }];
+    } completionHandler:^(NSError *err) {
+        XCTAssertNotNil(err);
+        [sync fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2 handler:nil];
+    XCTAssertEqual([_mockClient requestsForPath:@"/filters"].count, _manager.state.filterGroups.count);
+}
+
 // TODO disabled for first iteration
 //- (void)testSynchronizeConcurrency {
 //    NSArray *filters = [RBFilter standardMockFilters:4];
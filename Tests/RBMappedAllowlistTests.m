@@ -0,0 +1,198 @@
+//
+//  RBMappedAllowlistTests.m
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "RBAllowlistEntry-Private.h"
+#import "RBMappedAllowlist.h"
+#import "RBUtils.h"
+#import "RBDatabase-Private.h"
+
+
+@interface RBMappedAllowlistTests : XCTestCase
+@end
+
+
+@implementation RBMappedAllowlistTests {
+    RBDatabase *_database;
+    NSURL *_tempDirectoryURL;
+    NSURL *_mappedAllowlistURL;
+}
+
+- (void)setUp {
+    self.continueAfterFailure = NO;
+    
+    _tempDirectoryURL = RBCreateTemporaryDirectory(NULL);
+    _mappedAllowlistURL = [_tempDirectoryURL URLByAppendingPathComponent:@"allowlist.map"];
+    _database = [[RBDatabase alloc] initWithFileURL:[_tempDirectoryURL URLByAppendingPathComponent:@"database"]];
+    _database.mappedAllowlistURL = _mappedAllowlistURL;
+}
+
+- (void)tearDown {
+    [_database _drainPool];
+    [[NSFileManager defaultManager] removeItemAtURL:_tempDirectoryURL error:NULL];
+    
+    // Force dealloc
+    _database = nil;
+}
+
+- (void)_writeAllowlistEntryForDomain:(NSString *)domain groupNames:(NSArray *)groupNames enabled:(BOOL)enabled {
+    XCTestExpectation *write = [self expectationWithDescription:@"write"];
+    
+    [_database writeAllowlistEntryForDomain:domain usingBlock:^(RBMutableAllowlistEntry *entry, BOOL *stop) {
+        entry.groupNames = groupNames;
+        entry.enabled = enabled;
+    } completionHandler:^(RBAllowlistEntry *entry, NSError *error) {
+        XCTAssertNotNil(entry, @"%@", error);
+        [write fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)_waitForMappedAllowlistGeneration:(uint64_t)generation {
+    RBDatabase *database = _database;
+    NSPredicate *predicate = [NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+        return database.mappedAllowlist.generation >= generation;
+    }];
+    
+    [self expectationForPredicate:predicate evaluatedWithObject:database handler:nil];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+}
+
+- (void)testWriteOnChange {
+    _database._mappedAllowlistWriteDelay = NSEC_PER_SEC;
+    
+    XCTestExpectation *write = [self expectationWithDescription:@"write"];
+    [_database writeMappedAllowlistWithCompletionHandler:^(NSError *error) {
+        XCTAssertNil(error);
+        [write fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    NSError *error = nil;
+    RBMappedAllowlist *emptyAllowlist = [RBMappedAllowlist allowlistWithContentsOfURL:_mappedAllowlistURL error:&error];
+    XCTAssertNotNil(emptyAllowlist, @"%@", error);
+    XCTAssertEqual(emptyAllowlist.generation, 0);
+    XCTAssertEqual(emptyAllowlist.count, 0);
+    XCTAssertFalse([emptyAllowlist isDomainAllowlisted:@"example.com" forGroup:nil]);
+    
+    [self _writeAllowlistEntryForDomain:@"Example.com" groupNames:nil enabled:YES];
+    [self _writeAllowlistEntryForDomain:@"ads.other.org" groupNames:@[@"ads"] enabled:YES];
+    [self _writeAllowlistEntryForDomain:@"disabled.net" groupNames:nil enabled:NO];
+    
+    // Changes made in quick succession are written once, after the fact
+    XCTAssertTrue(emptyAllowlist.isCurrent);
+    [self _waitForMappedAllowlistGeneration:3];
+    XCTAssertFalse(emptyAllowlist.isCurrent);
+    
+    RBMappedAllowlist *allowlist = _database.mappedAllowlist;
+    XCTAssertNotNil(allowlist);
+    XCTAssertTrue(allowlist.isCurrent);
+    XCTAssertEqual(allowlist.generation, 3);
+    XCTAssertEqual(allowlist.count, 3);
+    XCTAssertEqualObjects(allowlist.groupNames, @[@"ads"]);
+    
+    XCTAssertTrue([allowlist isDomainAllowlisted:@"example.com" forGroup:nil]);
+    XCTAssertTrue([allowlist isDomainAllowlisted:@"www.EXAMPLE.com" forGroup:@"privacy"]);
+    XCTAssertFalse([allowlist isDomainAllowlisted:@"notexample.com" forGroup:nil]);
+    XCTAssertFalse([allowlist isDomainAllowlisted:@"com" forGroup:nil]);
+    
+    XCTAssertTrue([allowlist isDomainAllowlisted:@"cdn.ads.other.org" forGroup:@"ads"]);
+    XCTAssertFalse([allowlist isDomainAllowlisted:@"cdn.ads.other.org" forGroup:@"privacy"]);
+    XCTAssertFalse([allowlist isDomainAllowlisted:@"other.org" forGroup:nil]);
+    
+    XCTAssertFalse([allowlist isDomainAllowlisted:@"disabled.net" forGroup:nil]);
+    
+    NSArray *groupNames = nil;
+    BOOL enabled = YES;
+    XCTAssertEqualObjects([allowlist entryDomainMatchingDomain:@"a.b.disabled.net" groupNames:&groupNames enabled:&enabled], @"disabled.net");
+    XCTAssertNil(groupNames);
+    XCTAssertFalse(enabled);
+    
+    XCTAssertEqualObjects([allowlist entryDomainMatchingDomain:@"ads.other.org" groupNames:&groupNames enabled:&enabled], @"ads.other.org");
+    XCTAssertEqualObjects(groupNames, @[@"ads"]);
+    XCTAssertTrue(enabled);
+    
+    // Removals are reflected too
+    XCTestExpectation *remove = [self expectationWithDescription:@"remove"];
+    [_database removeAllowlistEntriesForDomains:@[@"example.com", @"disabled.net"] completionHandler:^(NSError *error) {
+        XCTAssertNil(error);
+        [remove fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    [self _waitForMappedAllowlistGeneration:5];
+    
+    allowlist = _database.mappedAllowlist;
+    XCTAssertEqual(allowlist.generation, 5);
+    XCTAssertEqual(allowlist.count, 1);
+    XCTAssertFalse([allowlist isDomainAllowlisted:@"www.example.com" forGroup:nil]);
+}
+
+- (void)testOlderGenerationIsIgnored {
+    RBAllowlistEntry *entry = [RBAllowlistEntry new];
+    entry.domain = @"example.com";
+    entry.enabled = YES;
+    
+    NSData *databaseIdentifier = [@"database" dataUsingEncoding:NSUTF8StringEncoding];
+    NSError *error = nil;
+    XCTAssertTrue([RBMappedAllowlist writeEntries:@[entry] generation:2 databaseIdentifier:databaseIdentifier toURL:_mappedAllowlistURL error:&error], @"%@", error);
+    XCTAssertTrue([RBMappedAllowlist writeEntries:@[] generation:1 databaseIdentifier:databaseIdentifier toURL:_mappedAllowlistURL error:&error], @"%@", error);
+    
+    RBMappedAllowlist *allowlist = [RBMappedAllowlist allowlistWithContentsOfURL:_mappedAllowlistURL error:&error];
+    XCTAssertNotNil(allowlist, @"%@", error);
+    XCTAssertEqual(allowlist.generation, 2);
+    XCTAssertTrue([allowlist isDomainAllowlisted:@"example.com" forGroup:nil]);
+    
+    NSArray *contents = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:_tempDirectoryURL.path error:NULL];
+    XCTAssertEqualObjects([contents filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"self BEGINSWITH '.allowlist.map'"]], @[]);
+}
+
+- (void)testRecreatedDatabaseReplacesNewerGeneration {
+    [self _writeAllowlistEntryForDomain:@"example.com" groupNames:nil enabled:YES];
+    [self _writeAllowlistEntryForDomain:@"other.org" groupNames:nil enabled:YES];
+    [self _waitForMappedAllowlistGeneration:2];
+    
+    // The database is deleted (sequence numbers start over), but the mapped allowlist stays behind
+    [_database _drainPool];
+    NSURL *databaseURL = _database.fileURL;
+    for (NSString *suffix in @[@"", @"-wal", @"-shm"]) {
+        [[NSFileManager defaultManager] removeItemAtPath:[databaseURL.path stringByAppendingString:suffix] error:NULL];
+    }
+    
+    NSData *databaseIdentifier = [RBMappedAllowlist allowlistWithContentsOfURL:_mappedAllowlistURL error:NULL].databaseIdentifier;
+    
+    _database = [[RBDatabase alloc] initWithFileURL:databaseURL];
+    _database.mappedAllowlistURL = _mappedAllowlistURL;
+    
+    [self _writeAllowlistEntryForDomain:@"new.net" groupNames:nil enabled:YES];
+    
+    XCTestExpectation *write = [self expectationWithDescription:@"write"];
+    [_database writeMappedAllowlistWithCompletionHandler:^(NSError *error) {
+        XCTAssertNil(error);
+        [write fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    RBMappedAllowlist *allowlist = _database.mappedAllowlist;
+    XCTAssertEqual(allowlist.generation, 1);
+    XCTAssertNotEqualObjects(allowlist.databaseIdentifier, databaseIdentifier);
+    XCTAssertTrue([allowlist isDomainAllowlisted:@"new.net" forGroup:nil]);
+    XCTAssertFalse([allowlist isDomainAllowlisted:@"example.com" forGroup:nil]);
+}
+
+- (void)testCorruptFile {
+    [[NSData dataWithBytes:"RBAL" length:4] writeToURL:_mappedAllowlistURL atomically:YES];
+    
+    NSError *error = nil;
+    XCTAssertNil([RBMappedAllowlist allowlistWithContentsOfURL:_mappedAllowlistURL error:&error]);
+    XCTAssertEqual(error.code, NSFileReadCorruptFileError);
+}
+
+@end
@@ -20,13 +20,28 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)mockFilters:(NSArray<RBFilter*>*)filters;
 - (void)mockError:(NSError *)error forFilter:(RBFilter *)filter;
+- (void)mockDeltaFromFilter:(RBFilter *)baseFilter toFilter:(RBFilter *)filter;
+
+/// Cuts off the next response for the path after the given number of bytes, as if the connection dropped.
+- (void)truncateNextResponseForPath:(NSString *)path afterLength:(NSUInteger)length;
+
 - (void)invalidate;
 
+/// Delay before each response is sent.
+@property(atomic) NSTimeInterval latency;
+
+/// Highest number of requests the mock server has handled at once.
+@property(atomic,readonly) NSUInteger maximumConcurrentRequests;
+
 typedef void(^RBMockClientHandler)(int *__nonnull status, NSDictionary *__nonnull*_Nonnull headers, NSData *__nonnull*_Nonnull data);
 
 - (void)handlePath:(NSString *)path usingBlock:(RBMockClientHandler)handler;
 - (RBMockClientHandler)handlerForPath:(NSString *)path;
 
+/// Requests received for the path, in order. Responses with an ETag header are answered with 304 when the request's
+/// If-None-Match header matches, and with 206 when the request has a Range header (and a matching If-Range header).
+- (NSArray<NSURLRequest*>*)requestsForPath:(NSString *)path;
+
 @end
 
 NS_ASSUME_NONNULL_END
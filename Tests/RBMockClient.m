@@ -9,6 +9,8 @@
 #import "RBMockClient.h"
 #import "RBClient-Private.h"
 #import "RBFilter+Mock.h"
+#import "RBDelta.h"
+#import "RBDigest.h"
 #import "RBUtils.h"
 #import "RBZip.h"
 
@@ -23,6 +25,9 @@
     dispatch_queue_t _q;
 
     NSMapTable *_handlerMap;
+    NSMutableDictionary *_requests;
+    NSMutableDictionary *_truncations;
+    NSUInteger _activeRequests;
     NSString *_uniqueIdentifier;
 }
 @synthesize cloudKitEnabled = _cloudKitEnabled;
@@ -77,6 +82,8 @@
     _cloudKitEnabled = YES;
     
     _handlerMap = [NSMapTable strongToStrongObjectsMapTable];
+    _requests = [NSMutableDictionary dictionary];
+    _truncations = [NSMutableDictionary dictionary];
     _uniqueIdentifier = [[NSUUID UUID] UUIDString];
 
     [[self class] _accessRegistryWithBlock:^(NSMapTable *r) {
@@ -109,6 +116,14 @@
     return sessionConfig;
 }
 
+- (NSURL *)_cacheDirectoryURL {
+    return [_tempDirectoryURL URLByAppendingPathComponent:@"Cache" isDirectory:YES];
+}
+
+- (NSTimeInterval)_downloadRetryInterval {
+    return 0.01;
+}
+
 #pragma mark - Mocks
 
 - (void)mockFilters:(NSArray<RBFilter*>*)filters {
@@ -120,13 +135,21 @@
     
     [self _resetHandlerMap];
     
+    NSData *manifestData = [NSJSONSerialization dataWithJSONObject:[filters valueForKeyPath:@"propertyList"] options:NSJSONWritingSortedKeys error:NULL];
+    NSString *manifestTag = [NSString stringWithFormat:@"\"%@\"", [RBDigest MD5HashOfData:manifestData]];
+    
     [self handlePath:@"/filters" usingBlock:^(int *status, NSDictionary **headers, NSData **data) {
-        (*data) = [NSJSONSerialization dataWithJSONObject:[filters valueForKeyPath:@"propertyList"] options:NSJSONWritingSortedKeys error:NULL];
+        (*headers) = @{@"Content-Type": @"application/json", @"ETag": manifestTag};
+        (*data) = manifestData;
     }];
     
     for (RBFilter *filter in filters) {
+        NSData *rulesData = [NSJSONSerialization dataWithJSONObject:filter.rulesObject options:NSJSONWritingSortedKeys error:NULL];
+        NSString *rulesTag = [NSString stringWithFormat:@"\"%@\"", [RBDigest MD5HashOfData:rulesData]];
+        
         [self handlePath:[@"/filter/" stringByAppendingString:filter.uniqueIdentifier] usingBlock:^(int *status, NSDictionary **headers, NSData **data) {
-            (*data) = [NSJSONSerialization dataWithJSONObject:filter.rulesObject options:NSJSONWritingSortedKeys error:NULL];
+            (*headers) = @{@"Content-Type": @"application/json", @"ETag": rulesTag};
+            (*data) = rulesData;
         }];
     }
 }
@@ -139,6 +162,30 @@
     }
 }
 
+- (void)mockDeltaFromFilter:(RBFilter *)baseFilter toFilter:(RBFilter *)filter {
+    NSString *path = [NSString stringWithFormat:@"/filter/%@/delta/%@", filter.uniqueIdentifier, baseFilter.md5.lowercaseString];
+    NSData *delta = [RBDelta deltaFromData:[RBMockClient jsonData:baseFilter.rulesObject] toData:[RBMockClient jsonData:filter.rulesObject]];
+    
+    [self handlePath:path usingBlock:^(int *status, NSDictionary **headers, NSData **data) {
+        (*headers) = @{@"Content-Type": RBDeltaMIMEType};
+        (*data) = delta;
+    }];
+}
+
+- (void)truncateNextResponseForPath:(NSString *)path afterLength:(NSUInteger)length {
+    @synchronized (_truncations) {
+        _truncations[path] = @(length);
+    }
+}
+
+- (NSNumber *)_takeTruncationForPath:(NSString *)path {
+    @synchronized (_truncations) {
+        NSNumber *length = _truncations[path];
+        [_truncations removeObjectForKey:path];
+        return length;
+    }
+}
+
 #pragma mark - Mock CloudKit
 
 - (NSProgress *)_performQuery:(CKQuery *)query completionHandler:(void (^)(NSArray<CKRecord *>*, NSError *))completionHandler {
@@ -217,6 +264,38 @@
     return handler ? [handler copy] : nil;
 }
 
+- (NSArray<NSURLRequest*>*)requestsForPath:(NSString *)path {
+    @synchronized (_requests) {
+        return [_requests[path] copy] ?: @[];
+    }
+}
+
+- (void)_recordRequest:(NSURLRequest *)request {
+    @synchronized (_requests) {
+        NSMutableArray *requests = _requests[request.URL.path];
+        if (requests == nil) {
+            _requests[request.URL.path] = requests = [NSMutableArray array];
+        }
+        [requests addObject:request];
+    }
+}
+
+- (void)_beginRequest {
+    @synchronized (_requests) {
+        _activeRequests++;
+        
+        if (_activeRequests > self.maximumConcurrentRequests) {
+            _maximumConcurrentRequests = _activeRequests;
+        }
+    }
+}
+
+- (void)_endRequest {
+    @synchronized (_requests) {
+        _activeRequests--;
+    }
+}
+
 - (id)_handlerOrErrorForPath:(NSString *)path {
     if ([path hasPrefix:@"/filter/"]) {
         NSString *identifier = path.lastPathComponent;
@@ -236,7 +315,9 @@
 
 #pragma mark - RBMockClientProtocol
 
-@implementation RBMockClientProtocol
+@implementation RBMockClientProtocol {
+    BOOL _stopped;
+}
 
 - (instancetype)initWithTask:(NSURLSessionTask *)task cachedResponse:(NSCachedURLResponse *)cachedResponse client:(id<NSURLProtocolClient>)client {
     self = [super initWithTask:task cachedResponse:cachedResponse client:client];
@@ -256,6 +337,31 @@
 
 - (void)startLoading {
     RBMockClient *mock = [RBMockClient _clientForIdentifier:self.request.URL.host];
+    NSTimeInterval latency = mock.latency;
+    
+    [mock _recordRequest:self.request];
+    [mock _beginRequest];
+    
+    if (latency <= 0) {
+        [self _respondWithMockClient:mock];
+        return;
+    }
+    
+    // Clients must be messaged on the loading thread
+    NSThread *thread = [NSThread currentThread];
+    
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(latency * NSEC_PER_SEC)), dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+        [self performSelector:@selector(_respondWithMockClient:) onThread:thread withObject:mock waitUntilDone:NO modes:@[NSRunLoopCommonModes]];
+    });
+}
+
+- (void)_respondWithMockClient:(RBMockClient *)mock {
+    [mock _endRequest];
+    
+    if (_stopped) {
+        return;
+    }
+    
     RBMockClientHandler handler = mock ? [mock _handlerOrErrorForPath:self.request.URL.path] : nil;
     
     if ([handler isKindOfClass:[NSError class]]) {
@@ -272,14 +378,49 @@
         handler(&status, &headers, &data);
     }
     
+    NSString *etag = headers[@"ETag"];
+    if (status == 200 && etag != nil && [[self.request valueForHTTPHeaderField:@"If-None-Match"] isEqualToString:etag]) {
+        status = 304;
+        data = nil;
+    }
+    
+    // Only open-ended ranges are supported ("bytes=N-")
+    NSString *range = [self.request valueForHTTPHeaderField:@"Range"];
+    NSString *ifRange = [self.request valueForHTTPHeaderField:@"If-Range"];
+    
+    if (status == 200 && [range hasPrefix:@"bytes="] && (ifRange == nil || [ifRange isEqualToString:etag])) {
+        NSUInteger offset = (NSUInteger)[[range substringFromIndex:6] longLongValue];
+        NSMutableDictionary *rangeHeaders = [headers mutableCopy];
+        
+        if (offset >= data.length) {
+            status = 416;
+            rangeHeaders[@"Content-Range"] = [NSString stringWithFormat:@"bytes */%lu", data.length];
+            data = nil;
+        } else {
+            status = 206;
+            rangeHeaders[@"Content-Range"] = [NSString stringWithFormat:@"bytes %lu-%lu/%lu", offset, data.length - 1, data.length];
+            data = [data subdataWithRange:NSMakeRange(offset, data.length - offset)];
+        }
+        
+        headers = rangeHeaders;
+    }
+    
     NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:self.request.URL statusCode:status HTTPVersion:@"1.1" headerFields:headers];
     [self.client URLProtocol:self didReceiveResponse:response cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    
+    NSNumber *truncation = [mock _takeTruncationForPath:self.request.URL.path];
+    if (truncation != nil && truncation.unsignedIntegerValue < data.length) {
+        [self.client URLProtocol:self didLoadData:[data subdataWithRange:NSMakeRange(0, truncation.unsignedIntegerValue)]];
+        [self.client URLProtocol:self didFailWithError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNetworkConnectionLost userInfo:nil]];
+        return;
+    }
+    
     [self.client URLProtocol:self didLoadData:data ?: [NSData data]];
     [self.client URLProtocolDidFinishLoading:self];
 }
 
 - (void)stopLoading {
-    
+    _stopped = YES;
 }
 
 @end
@@ -6,6 +6,7 @@
 //  Copyright © 2019 Young Dynasty. All rights reserved.
 //
 
+#import <stdatomic.h>
 #import <XCTest/XCTest.h>
 
 #import "RBSQLite.h"
@@ -56,6 +57,61 @@
     [self waitForExpectationsWithTimeout:3 handler:nil];
 }
 
+- (void)testAdaptivePool {
+    RBSQLitePoolRef pool = RBSQLitePoolCreateWithCapacityRange(1, 3, ^sqlite3 *{
+        sqlite3 *db = NULL;
+        XCTAssertEqual(sqlite3_open(":memory:", &db), SQLITE_OK);
+        return db;
+    });
+    
+    [self addTeardownBlock:^{
+        RBSQLitePoolDrain(pool);
+        RBSQLitePoolFree(pool);
+    }];
+    
+    __block _Atomic(uint64_t) connectionsDestroyed = 0;
+    RBSQLitePoolSetDestructorBlock(pool, ^(sqlite3 *db) {
+        connectionsDestroyed++;
+    });
+    
+    // Long leases under contention should grow the pool
+    dispatch_apply(64, _concurrentQueue, ^(size_t i) {
+        sqlite3 *db = RBSQLitePoolGet(pool);
+        usleep(2000);
+        RBSQLitePoolPut(pool, db);
+    });
+    
+    RBSQLitePoolStatistics stats = RBSQLitePoolGetStatistics(pool);
+    XCTAssertEqual(stats.waitCount, 64);
+    XCTAssertEqual(stats.leaseCount, 64);
+    XCTAssertEqual(stats.hits + stats.misses, 64);
+    XCTAssertEqual(stats.misses, stats.connectionsCreated);
+    XCTAssertGreaterThan(stats.connectionsCreated, 1);
+    XCTAssertGreaterThanOrEqual(stats.leaseTimeMax, 2 * NSEC_PER_MSEC);
+    XCTAssertEqual(stats.leases, 0);
+    
+    uint64_t histogramCount = 0;
+    for (int i = 0; i < RBSQLitePoolWaitHistogramSize; i++) {
+        histogramCount += stats.waitHistogram[i];
+    }
+    XCTAssertEqual(histogramCount, stats.waitCount);
+    
+    // Uncontended access should shrink it back down
+    for (int i = 0; i < 128; i++) {
+        RBSQLitePoolPut(pool, RBSQLitePoolGet(pool));
+    }
+    
+    stats = RBSQLitePoolGetStatistics(pool);
+    XCTAssertEqual(stats.capacity, 1);
+    XCTAssertEqual(stats.idleConnections, 1);
+    XCTAssertEqual(stats.connectionsClosed, stats.connectionsCreated - 1);
+    XCTAssertEqual(connectionsDestroyed, stats.connectionsClosed);
+    
+    // Draining closes (and destroys) the rest
+    RBSQLitePoolDrain(pool);
+    XCTAssertEqual(connectionsDestroyed, stats.connectionsCreated);
+}
+
 - (void)testExecutePrepareAndScan {
     sqlite3 *db = NULL;
     [self addTeardownBlock:^{ sqlite3_close(db); }];
@@ -0,0 +1,139 @@
+//
+//  RBSharedMemoryTests.m
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "RBSharedMemory.h"
+#import "RBUtils.h"
+
+#define NUMBER_OF_WORDS 16
+
+
+@interface RBSharedMemoryTests : XCTestCase
+@end
+
+
+@implementation RBSharedMemoryTests {
+    NSURL *_tempDirectoryURL;
+    NSURL *_fileURL;
+}
+
+- (void)setUp {
+    self.continueAfterFailure = NO;
+    
+    _tempDirectoryURL = RBCreateTemporaryDirectory(NULL);
+    _fileURL = [_tempDirectoryURL URLByAppendingPathComponent:@"state.map"];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:_tempDirectoryURL error:NULL];
+}
+
+- (RBSharedMemory *)_sharedMemoryWithLength:(size_t)length {
+    NSError *error = nil;
+    RBSharedMemory *sharedMemory = [[RBSharedMemory alloc] initWithFileURL:_fileURL length:length error:&error];
+    XCTAssertNotNil(sharedMemory, @"%@", error);
+    return sharedMemory;
+}
+
+- (void)testReadWrite {
+    RBSharedMemory *sharedMemory = [self _sharedMemoryWithLength:sizeof(uint64_t)];
+    RBSharedMemory *otherSharedMemory = [self _sharedMemoryWithLength:sizeof(uint64_t)];
+    
+    uint64_t value = 1;
+    uint64_t generation = [sharedMemory readBytes:&value];
+    XCTAssertEqual(value, 0);
+    
+    uint64_t newGeneration = [sharedMemory writeUsingBlock:^(void *bytes) {
+        *(uint64_t *)bytes = 42;
+    }];
+    XCTAssertGreaterThan(newGeneration, generation);
+    XCTAssertEqual(sharedMemory.generation, newGeneration);
+    
+    // Other mappings of the file see the change immediately
+    XCTAssertEqual([otherSharedMemory readBytes:&value], newGeneration);
+    XCTAssertEqual(value, 42);
+    
+    // Writes which don't change anything are ignored
+    XCTAssertEqual([otherSharedMemory writeUsingBlock:^(void *bytes) {
+        *(uint64_t *)bytes = 42;
+    }], newGeneration);
+}
+
+- (void)testPersistence {
+    [[self _sharedMemoryWithLength:sizeof(uint64_t)] writeUsingBlock:^(void *bytes) {
+        *(uint64_t *)bytes = 42;
+    }];
+    
+    uint64_t value = 0;
+    [[self _sharedMemoryWithLength:sizeof(uint64_t)] readBytes:&value];
+    XCTAssertEqual(value, 42);
+    
+    // Regions mapped with another length are reset
+    uint64_t values[2] = {1, 1};
+    [[self _sharedMemoryWithLength:sizeof(values)] readBytes:values];
+    XCTAssertEqual(values[0], 0);
+    XCTAssertEqual(values[1], 0);
+}
+
+- (void)testConcurrentReadsAreConsistent {
+    RBSharedMemory *sharedMemory = [self _sharedMemoryWithLength:sizeof(uint64_t) * NUMBER_OF_WORDS];
+    RBSharedMemory *otherSharedMemory = [self _sharedMemoryWithLength:sizeof(uint64_t) * NUMBER_OF_WORDS];
+    NSUInteger numberOfWrites = 10000;
+    
+    // Writers fill every word with the same value, so readers can tell if they copied half of a write
+    dispatch_apply(8, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i) {
+        RBSharedMemory *memory = (i % 2) ? sharedMemory : otherSharedMemory;
+        
+        for (NSUInteger j = 0; j < numberOfWrites; j++) {
+            if (i < 4) {
+                [memory writeUsingBlock:^(void *bytes) {
+                    uint64_t *words = bytes;
+                    uint64_t value = words[0] + 1;
+                    
+                    for (int k = 0; k < NUMBER_OF_WORDS; k++) {
+                        words[k] = value;
+                    }
+                }];
+            } else {
+                uint64_t words[NUMBER_OF_WORDS];
+                [memory readBytes:words];
+                
+                for (int k = 1; k < NUMBER_OF_WORDS; k++) {
+                    XCTAssertEqual(words[k], words[0]);
+                }
+            }
+        }
+    });
+    
+    uint64_t words[NUMBER_OF_WORDS];
+    [sharedMemory readBytes:words];
+    XCTAssertEqual(words[0], 4 * numberOfWrites);
+}
+
+- (void)testChangeHandler {
+    RBSharedMemory *sharedMemory = [self _sharedMemoryWithLength:sizeof(uint64_t)];
+    RBSharedMemory *otherSharedMemory = [self _sharedMemoryWithLength:sizeof(uint64_t)];
+    
+    XCTestExpectation *changeExpectation = [self expectationWithDescription:@"change"];
+    sharedMemory.changeHandler = ^{
+        [changeExpectation fulfill];
+    };
+    
+    // Our own writes don't invoke the handler
+    otherSharedMemory.changeHandler = ^{
+        XCTFail(@"Unexpected change");
+    };
+    
+    [otherSharedMemory writeUsingBlock:^(void *bytes) {
+        *(uint64_t *)bytes = 42;
+    }];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+@end
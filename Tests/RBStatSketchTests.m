@@ -0,0 +1,102 @@
+//
+//  RBStatSketchTests.m
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "RBStatSketch.h"
+
+
+@interface RBStatSketchTests : XCTestCase
+@end
+
+
+@implementation RBStatSketchTests
+
+static NSDictionary<NSString *, NSNumber *> *_statValues(NSArray<RBStat *> *stats) {
+    NSMutableDictionary *values = [NSMutableDictionary dictionary];
+    for (RBStat *stat in stats) {
+        values[stat.name] = @(stat.value);
+    }
+    return values;
+}
+
+- (void)testExactCounts {
+    RBStatSketch *sketch = [[RBStatSketch alloc] initWithCapacity:4];
+    [sketch addKey:@"aaa.com" count:3];
+    [sketch addKey:@"bbb.com" count:5];
+    [sketch addKey:@"aaa.com" count:4];
+    [sketch addKey:@"ccc.com" count:1];
+    
+    NSArray<RBStat *> *stats = [sketch topStatsWithLimit:10];
+    XCTAssertEqualObjects([stats valueForKey:@"name"], (@[@"aaa.com", @"bbb.com", @"ccc.com"]));
+    XCTAssertEqualObjects([stats valueForKey:@"value"], (@[@7, @5, @1]));
+    
+    XCTAssertEqual([sketch topStatsWithLimit:1].count, 1);
+}
+
+- (void)testHeavyHitters {
+    const NSUInteger capacity = 32;
+    RBStatSketch *sketch = [[RBStatSketch alloc] initWithCapacity:capacity];
+    NSMutableDictionary<NSString *, NSNumber *> *counts = [NSMutableDictionary dictionary];
+    NSUInteger total = 0;
+    
+    // A few frequent domains among lots of one-offs
+    for (NSUInteger i = 0; i < 20000; i++) {
+        NSString *domain = (i % 4 == 0) ? [NSString stringWithFormat:@"frequent-%lu.com", (unsigned long)(i % 5)] : [NSString stringWithFormat:@"rare-%lu.com", (unsigned long)i];
+        [sketch addKey:domain count:1];
+        counts[domain] = @(counts[domain].unsignedIntegerValue + 1);
+        total++;
+    }
+    
+    NSDictionary *values = _statValues([sketch topStatsWithLimit:capacity]);
+    
+    // Anything which occurs more than total / capacity times is tracked, and counts are never underestimated
+    [counts enumerateKeysAndObjectsUsingBlock:^(NSString *domain, NSNumber *count, BOOL *stop) {
+        if (count.unsignedIntegerValue > total / capacity) {
+            XCTAssertNotNil(values[domain], @"%@", domain);
+        }
+        if (values[domain] != nil) {
+            XCTAssertGreaterThanOrEqual([values[domain] unsignedIntegerValue], count.unsignedIntegerValue, @"%@", domain);
+        }
+    }];
+}
+
+- (void)testMergeAndSerialize {
+    RBStatSketch *monday = [[RBStatSketch alloc] initWithCapacity:8];
+    [monday addKey:@"aaa.com" count:10];
+    [monday addKey:@"bbb.com" count:2];
+    
+    RBStatSketch *tuesday = [[RBStatSketch alloc] initWithCapacity:8];
+    [tuesday addKey:@"aaa.com" count:1];
+    [tuesday addKey:@"ccc.com" count:4];
+    
+    NSError *error = nil;
+    RBStatSketch *week = [[RBStatSketch alloc] initWithCapacity:8 data:monday.dataRepresentation error:&error];
+    XCTAssertNotNil(week, @"%@", error);
+    
+    [week mergeSketch:[[RBStatSketch alloc] initWithCapacity:8 data:tuesday.dataRepresentation error:NULL]];
+    
+    XCTAssertEqualObjects(_statValues([week topStatsWithLimit:10]), (@{@"aaa.com": @11, @"ccc.com": @4, @"bbb.com": @2}));
+    
+    // Loading into a smaller sketch keeps the most frequent keys
+    RBStatSketch *smallWeek = [[RBStatSketch alloc] initWithCapacity:1 data:week.dataRepresentation error:&error];
+    XCTAssertNotNil(smallWeek, @"%@", error);
+    XCTAssertEqualObjects([[smallWeek topStatsWithLimit:10] valueForKey:@"name"], @[@"aaa.com"]);
+}
+
+- (void)testCorruptData {
+    NSError *error = nil;
+    NSMutableData *data = [[[[RBStatSketch alloc] initWithCapacity:8] dataRepresentation] mutableCopy];
+    [data appendBytes:"x" length:1];
+    
+    XCTAssertNil([[RBStatSketch alloc] initWithCapacity:8 data:data error:&error]);
+    XCTAssertEqual(error.code, NSPropertyListReadCorruptError, @"%@", error);
+    
+    XCTAssertNil([[RBStatSketch alloc] initWithCapacity:8 data:[NSData data] error:NULL]);
+}
+
+@end
@@ -0,0 +1,186 @@
+//
+//  RBTraceTests.m
+//  RadBlockTests
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "RBTrace.h"
+
+
+@interface RBTraceTests : XCTestCase
+@end
+
+
+@implementation RBTraceTests
+
+- (void)setUp {
+    self.continueAfterFailure = NO;
+    
+    RBTrace.enabled = YES;
+    [RBTrace reset];
+}
+
+- (void)tearDown {
+    RBTrace.enabled = YES;
+    [RBTrace reset];
+}
+
+- (NSArray<NSDictionary*> *)_traceEventsForLastSyncs:(NSUInteger)numberOfSyncs {
+    NSError *error = nil;
+    NSDictionary *trace = [NSJSONSerialization JSONObjectWithData:[RBTrace chromeTraceDataForLastSyncs:numberOfSyncs] options:0 error:&error];
+    XCTAssertNotNil(trace, @"%@", error);
+    
+    return trace[@"traceEvents"];
+}
+
+- (void)testChromeTrace {
+    RBTraceSpan sync = RBTraceBeginSync();
+    RBTraceApplySync(sync, ^{
+        RBTraceSpan download = RBTraceBegin("download");
+        [NSThread sleepForTimeInterval:0.01];
+        RBTraceEnd(download, (RBTraceMetrics){.bytes = 1024, .numberOfRules = 10});
+        RBTraceEnd(RBTraceBegin("check-digests"), (RBTraceMetrics){.cacheHits = 3});
+    });
+    RBTraceEnd(sync, (RBTraceMetrics){0});
+    
+    NSArray<NSDictionary*> *events = [self _traceEventsForLastSyncs:1];
+    XCTAssertEqual(events.count, 3);
+    
+    // Ordered by start time
+    XCTAssertEqualObjects([events valueForKey:@"name"], (@[@"sync", @"download", @"check-digests"]));
+    
+    NSDictionary *downloadEvent = events[1];
+    XCTAssertEqualObjects(downloadEvent[@"ph"], @"X");
+    XCTAssertEqualObjects(downloadEvent[@"args"][@"bytes"], @1024);
+    XCTAssertEqualObjects(downloadEvent[@"args"][@"rules"], @10);
+    XCTAssertEqualObjects(downloadEvent[@"args"][@"sync"], events[0][@"args"][@"sync"]);
+    XCTAssertGreaterThanOrEqual([downloadEvent[@"dur"] doubleValue], 10000);
+    XCTAssertLessThanOrEqual([downloadEvent[@"dur"] doubleValue], [events[0][@"dur"] doubleValue]);
+    
+    XCTAssertEqualObjects(events[2][@"args"][@"cacheHits"], @3);
+}
+
+- (void)testLastSyncs {
+    for (int i = 0; i < 3; i++) {
+        RBTraceSpan sync = RBTraceBeginSync();
+        RBTraceApplySync(sync, ^{
+            RBTraceEnd(RBTraceBegin("download"), (RBTraceMetrics){0});
+        });
+        RBTraceEnd(sync, (RBTraceMetrics){0});
+    }
+    
+    XCTAssertEqual([self _traceEventsForLastSyncs:1].count, 2);
+    XCTAssertEqual([self _traceEventsForLastSyncs:2].count, 4);
+    XCTAssertEqual([self _traceEventsForLastSyncs:0].count, 0);
+    
+    NSArray *syncIdentifiers = [[self _traceEventsForLastSyncs:2] valueForKeyPath:@"args.sync"];
+    XCTAssertEqual([NSSet setWithArray:syncIdentifiers].count, 2);
+}
+
+- (void)testOverlappingSyncs {
+    dispatch_queue_t queue = dispatch_queue_create(NULL, DISPATCH_QUEUE_CONCURRENT);
+    dispatch_group_t group = dispatch_group_create();
+    
+    RBTraceSpan firstSync = RBTraceBeginSync();
+    RBTraceSpan secondSync = RBTraceBeginSync();
+    
+    // Spans begin after both syncs have started, from whichever queue the work ends up on
+    RBTraceApplySync(firstSync, ^{
+        dispatch_group_async(group, queue, ^{
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, NSEC_PER_MSEC), queue, ^{
+                RBTraceEnd(RBTraceBegin("download"), (RBTraceMetrics){.bytes = 1});
+            });
+            RBTraceEnd(RBTraceBegin("download"), (RBTraceMetrics){.bytes = 1});
+        });
+    });
+    RBTraceApplySync(secondSync, ^{
+        dispatch_group_async(group, queue, ^{
+            RBTraceEnd(RBTraceBegin("download"), (RBTraceMetrics){.bytes = 2});
+        });
+    });
+    
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    [NSThread sleepForTimeInterval:0.05];
+    
+    RBTraceEnd(firstSync, (RBTraceMetrics){0});
+    RBTraceEnd(secondSync, (RBTraceMetrics){0});
+    
+    NSArray<NSDictionary*> *events = [[self _traceEventsForLastSyncs:2] filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"name == 'download'"]];
+    XCTAssertEqual(events.count, 3);
+    
+    for (NSDictionary *event in events) {
+        uint64_t expectedSyncIdentifier = [event[@"args"][@"bytes"] isEqual:@1] ? firstSync.syncIdentifier : secondSync.syncIdentifier;
+        XCTAssertEqualObjects(event[@"args"][@"sync"], @(expectedSyncIdentifier));
+    }
+    
+    // Outside of a sync, spans don't belong to one
+    RBTraceEnd(RBTraceBegin("download"), (RBTraceMetrics){0});
+    XCTAssertEqual([self _traceEventsForLastSyncs:2].count, 5);
+}
+
+- (void)testDisabled {
+    RBTrace.enabled = NO;
+    
+    RBTraceSpan sync = RBTraceBeginSync();
+    RBTraceApplySync(sync, ^{
+        RBTraceEnd(RBTraceBegin("download"), (RBTraceMetrics){0});
+    });
+    RBTraceEnd(sync, (RBTraceMetrics){0});
+    
+    XCTAssertEqual([self _traceEventsForLastSyncs:1].count, 0);
+}
+
+- (void)testRingBufferOverwritesOldestSpans {
+    RBTraceSpan sync = RBTraceBeginSync();
+    
+    // Concurrent writers don't need a lock; the buffer keeps the most recent spans
+    RBTraceApplySync(sync, ^{
+        dispatch_group_t group = dispatch_group_create();
+        
+        for (int i = 0; i < 20000; i++) {
+            dispatch_group_async(group, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+                RBTraceEnd(RBTraceBegin("download"), (RBTraceMetrics){.bytes = 1});
+            });
+        }
+        
+        dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    });
+    
+    RBTraceEnd(sync, (RBTraceMetrics){0});
+    
+    NSDictionary<NSString*, RBTraceHistogram*> *histograms = [RBTrace histogramsForLastSyncs:1];
+    XCTAssertEqual(histograms[@"sync"].count, 1);
+    XCTAssertGreaterThan(histograms[@"download"].count, 1000);
+    XCTAssertLessThan(histograms[@"download"].count, 20000);
+    XCTAssertEqual(histograms[@"download"].totalBytes, (int64_t)histograms[@"download"].count);
+}
+
+- (void)testHistograms {
+    RBTraceSpan sync = RBTraceBeginSync();
+    
+    RBTraceApplySync(sync, ^{
+        for (int i = 0; i < 9; i++) {
+            RBTraceEnd(RBTraceBegin("fetch-json"), (RBTraceMetrics){.cacheHits = 1});
+        }
+        
+        RBTraceSpan slowSpan = RBTraceBegin("fetch-json");
+        [NSThread sleepForTimeInterval:0.05];
+        RBTraceEnd(slowSpan, (RBTraceMetrics){0});
+    });
+    
+    RBTraceEnd(sync, (RBTraceMetrics){0});
+    
+    RBTraceHistogram *histogram = [RBTrace histogramsForLastSyncs:1][@"fetch-json"];
+    XCTAssertEqual(histogram.count, 10);
+    XCTAssertEqual(histogram.totalCacheHits, 9);
+    XCTAssertGreaterThanOrEqual(histogram.maximumDuration, 0.05);
+    XCTAssertGreaterThanOrEqual(histogram.totalDuration, histogram.maximumDuration);
+    
+    XCTAssertLessThan([histogram durationAtPercentile:50], 0.01);
+    XCTAssertEqual([histogram durationAtPercentile:100], histogram.maximumDuration);
+}
+
+@end
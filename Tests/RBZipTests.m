@@ -59,4 +59,149 @@
     XCTAssertEqualObjects(error.userInfo[NSFilePathErrorKey], output.path);
 }
 
+- (void)testUnzipGzipMembers {
+    NSData *data = [self _rulesDataOfLength:300000];
+    NSData *first = [RBZip deflateData:[data subdataWithRange:NSMakeRange(0, 1000)] format:RBZipFormatGzip error:NULL];
+    NSData *second = [RBZip deflateData:[data subdataWithRange:NSMakeRange(1000, data.length - 1000)] format:RBZipFormatGzip error:NULL];
+    
+    NSMutableData *members = [first mutableCopy];
+    [members appendData:second];
+    
+    NSError *error = nil;
+    XCTAssertEqualObjects([RBZip inflateData:members error:&error], data, @"%@", error);
+}
+
+- (void)testZipRoundTrip {
+    // Spans several blocks
+    NSData *data = [self _rulesDataOfLength:1000000];
+    NSError *error = nil;
+    
+    for (NSNumber *format in @[@(RBZipFormatZlib), @(RBZipFormatGzip)]) {
+        NSData *compressedData = [RBZip deflateData:data format:format.integerValue error:&error];
+        XCTAssertNotNil(compressedData, @"%@", error);
+        XCTAssertLessThan(compressedData.length, data.length / 4);
+        XCTAssertEqual(((const uint8_t *)compressedData.bytes)[0], format.integerValue == RBZipFormatGzip ? 0x1f : 0x78);
+        XCTAssertEqualObjects([RBZip inflateData:compressedData error:&error], data, @"%@", error);
+    }
+    
+    // Files
+    NSURL *compressedURL = [_tempDirectoryURL URLByAppendingPathComponent:@"rules.gz"];
+    NSURL *outputURL = [_tempDirectoryURL URLByAppendingPathComponent:@"rules.json"];
+    
+    XCTAssertTrue([RBZip deflateData:data format:RBZipFormatGzip toFileURL:compressedURL error:&error], @"%@", error);
+    XCTAssertTrue([RBZip inflateContentsOfFileURL:compressedURL toFileURL:outputURL error:&error], @"%@", error);
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:outputURL], data);
+    
+    // Empty data
+    NSData *emptyData = [RBZip deflateData:[NSData data] format:RBZipFormatGzip error:&error];
+    XCTAssertEqualObjects([RBZip inflateData:emptyData error:&error], [NSData data], @"%@", error);
+}
+
+- (void)testUnzipTruncatedData {
+    NSData *compressedData = [RBZip deflateData:[self _rulesDataOfLength:100000] format:RBZipFormatGzip error:NULL];
+    NSError *error = nil;
+    
+    XCTAssertNil([RBZip inflateData:[compressedData subdataWithRange:NSMakeRange(0, compressedData.length - 4)] error:&error]);
+    XCTAssertEqualObjects(error.domain, NSPOSIXErrorDomain);
+    XCTAssertEqual(error.code, EFTYPE);
+    
+    XCTAssertNil([RBZip inflateData:[NSData data] error:&error]);
+    XCTAssertEqual(error.code, EFTYPE);
+}
+
+- (void)testEnumerateInflatedContents {
+    NSData *data = [self _rulesDataOfLength:1000000];
+    NSURL *compressedURL = [_tempDirectoryURL URLByAppendingPathComponent:@"rules.z"];
+    NSURL *plainURL = [_tempDirectoryURL URLByAppendingPathComponent:@"rules.json"];
+    NSError *error = nil;
+    
+    XCTAssertTrue([RBZip deflateData:data toFileURL:compressedURL error:&error], @"%@", error);
+    XCTAssertTrue([data writeToURL:plainURL options:0 error:&error], @"%@", error);
+    
+    XCTAssertTrue([RBZip isCompressedFileURL:compressedURL]);
+    XCTAssertFalse([RBZip isCompressedFileURL:plainURL]);
+    
+    // Either kind of file produces the same contents
+    for (NSURL *url in @[compressedURL, plainURL]) {
+        NSMutableData *contents = [NSMutableData data];
+        
+        XCTAssertTrue([RBZip enumerateInflatedContentsOfFileURL:url usingBlock:^(const uint8_t *bytes, size_t length, BOOL *stop) {
+            [contents appendBytes:bytes length:length];
+        } error:&error], @"%@", error);
+        
+        XCTAssertEqualObjects(contents, data);
+        XCTAssertEqualObjects([RBDigest MD5HashOfInflatedContentsOfFileURL:url error:&error], [RBDigest MD5HashOfData:data], @"%@", error);
+    }
+    
+    // Stopping early isn't an error
+    __block NSUInteger numberOfChunks = 0;
+    XCTAssertTrue([RBZip enumerateInflatedContentsOfFileURL:compressedURL usingBlock:^(const uint8_t *bytes, size_t length, BOOL *stop) {
+        numberOfChunks++;
+        (*stop) = YES;
+    } error:&error], @"%@", error);
+    XCTAssertEqual(numberOfChunks, 1);
+    
+    // Missing files
+    XCTAssertFalse([RBZip enumerateInflatedContentsOfFileURL:[NSURL fileURLWithPath:@"/no/such/path"] usingBlock:^(const uint8_t *bytes, size_t length, BOOL *stop) {} error:&error]);
+    XCTAssertEqualObjects(error.domain, NSCocoaErrorDomain);
+    XCTAssertEqual(error.code, NSFileNoSuchFileError);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testDeflateThroughput {
+    NSData *data = [self _fixtureDataOfLength:32 << 20];
+    
+    [self measureBlock:^{
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+        NSData *compressedData = [RBZip deflateData:data format:RBZipFormatGzip error:NULL];
+        CFAbsoluteTime duration = CFAbsoluteTimeGetCurrent() - start;
+        
+        XCTAssertNotNil(compressedData);
+        NSLog(@"Deflated %lu bytes to %lu in %.3fs (%.1f MB/s)", data.length, compressedData.length, duration, data.length / duration / 1e6);
+    }];
+}
+
+- (void)testInflateThroughput {
+    NSData *data = [self _fixtureDataOfLength:32 << 20];
+    NSURL *compressedURL = [_tempDirectoryURL URLByAppendingPathComponent:@"fixtures.gz"];
+    NSURL *outputURL = [_tempDirectoryURL URLByAppendingPathComponent:@"fixtures"];
+    
+    XCTAssertTrue([RBZip deflateData:data format:RBZipFormatGzip toFileURL:compressedURL error:NULL]);
+    
+    [self measureBlock:^{
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+        NSError *error = nil;
+        XCTAssertTrue([RBZip inflateContentsOfFileURL:compressedURL toFileURL:outputURL error:&error], @"%@", error);
+        CFAbsoluteTime duration = CFAbsoluteTimeGetCurrent() - start;
+        
+        NSLog(@"Inflated %lu bytes in %.3fs (%.1f MB/s)", data.length, duration, data.length / duration / 1e6);
+    }];
+}
+
+#pragma mark - Data
+
+/// The test fixtures (an image and a block list), repeated
+- (NSData *)_fixtureDataOfLength:(NSUInteger)length {
+    NSBundle *bundle = [NSBundle bundleForClass:[self class]];
+    NSData *image = [RBZip inflateData:[NSData dataWithContentsOfURL:[bundle URLForResource:@"kith" withExtension:@"gz"]] error:NULL];
+    NSData *blockerList = [NSData dataWithContentsOfURL:[bundle URLForResource:@"blockerList" withExtension:@"json"]];
+    
+    NSMutableData *data = [NSMutableData dataWithCapacity:length];
+    while (data.length < length) {
+        [data appendData:image];
+        [data appendData:blockerList];
+    }
+    
+    return data;
+}
+
+- (NSData *)_rulesDataOfLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithCapacity:length];
+    for (int i = 0; data.length < length; i++) {
+        [data appendData:[[NSString stringWithFormat:@"||ads-%d.example.com^\n", i] dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    return data;
+}
+
 @end
@@ -0,0 +1,363 @@
+//
+//  rbcompile.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+//  Headless rule compiler, built on the portable core in Core/. For every group it does what RBFilterManager and
+//  RBContentBlocker do on a Mac: the group's filter files (which may be compressed) are merged into one rule file, and
+//  rules for the group's allowlist entries are appended from an allowlist database (a copy of RadBlock's database, or
+//  any SQLite file with the same schema). The time spent in each stage is printed as it completes:
+//
+//      cmake -S . -B build && cmake --build build
+//      ./build/rbcompile -a radblock.db -o out ads=easylist.json,extra.json.gz privacy=easyprivacy.json
+//
+//  Output goes to <directory>/<group>.json (or <group>.json.gz with -z). Rules in the filter files which the allowlist
+//  covers aren't pruned, unlike on the Mac.
+//
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "rb_allowlist.h"
+#include "rb_filter_builder.h"
+#include "rb_zip.h"
+
+/*** Configuration ***/
+
+typedef struct {
+    const char *outputDirectory;
+    const char *allowlistPath;
+    unsigned long long maxNumberOfRules;
+    size_t allowlistGroupSize;
+    unsigned threads;
+    int compress;
+} Config;
+
+typedef struct {
+    char *name;
+    const char **paths;
+    size_t numberOfPaths;
+} Group;
+
+/*** Output ***/
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned long long fileSize(const char *path) {
+    struct stat st;
+    return stat(path, &st) == 0 ? (unsigned long long)st.st_size : 0;
+}
+
+// Rules or bytes are -1 when the stage doesn't know them
+static void printStage(const char *group, const char *stage, double start, long long rules, long long bytes) {
+    char rulesString[32] = "-", bytesString[32] = "-";
+
+    if (rules >= 0) {
+        snprintf(rulesString, sizeof(rulesString), "%lld", rules);
+    }
+    if (bytes >= 0) {
+        snprintf(bytesString, sizeof(bytesString), "%lld", bytes);
+    }
+
+    printf("%-16s %-10s %10.2f ms %10s rules %12s bytes\n", group, stage, (now() - start) * 1e3, rulesString, bytesString);
+    fflush(stdout);
+}
+
+static int reportRulesError(const char *path, enum rb_rules_status status) {
+    switch (status) {
+        case rb_rules_success:
+            return 0;
+        case rb_rules_io_error:
+            fprintf(stderr, "rbcompile: %s: %s\n", path, strerror(errno));
+            return 1;
+        case rb_rules_corrupt:
+            fprintf(stderr, "rbcompile: %s: Not a (compressed) JSON array of rules\n", path);
+            return 1;
+        case rb_rules_no_memory:
+            fprintf(stderr, "rbcompile: %s: Out of memory\n", path);
+            return 1;
+    }
+
+    return 1;
+}
+
+/*** Stages ***/
+
+static int countRule(void *context, const char *rule, size_t length) {
+    (void)rule;
+    (void)length;
+    (*(unsigned long long *)context)++;
+    return 0;
+}
+
+typedef struct {
+    rb_filter_builder *builder;
+    unsigned long long numberOfRules;
+    unsigned long long maxNumberOfRules;
+    unsigned long long bytes;
+    enum rb_rules_status status;
+} AllowlistContext;
+
+// Same limit as RBContentBlocker: allowlist rules stop once the group and allowlist rules reach the maximum
+static int appendAllowlistRule(void *context, const char *rule, size_t length) {
+    AllowlistContext *allowlist = context;
+
+    if (allowlist->numberOfRules >= allowlist->maxNumberOfRules) {
+        return 1;
+    }
+
+    allowlist->status = rb_filter_builder_append_rule(allowlist->builder, rule, length);
+    if (allowlist->status != rb_rules_success) {
+        return 1;
+    }
+
+    allowlist->numberOfRules++;
+    allowlist->bytes += length + 1;
+    return 0;
+}
+
+typedef struct {
+    FILE *file;
+    unsigned char *bytes;
+    size_t length, capacity;
+} CompressContext;
+
+static int readChunk(void *context, const uint8_t *bytes, size_t length) {
+    CompressContext *compress = context;
+
+    if (compress->capacity - compress->length < length) {
+        size_t capacity = (compress->capacity + length) * 2;
+        unsigned char *grown = realloc(compress->bytes, capacity);
+        if (grown == NULL) {
+            return Z_MEM_ERROR;
+        }
+
+        compress->bytes = grown;
+        compress->capacity = capacity;
+    }
+
+    memcpy(compress->bytes + compress->length, bytes, length);
+    compress->length += length;
+    return Z_OK;
+}
+
+static int writeChunk(void *context, const uint8_t *bytes, size_t length) {
+    CompressContext *compress = context;
+    return fwrite(bytes, 1, length, compress->file) == length ? Z_OK : Z_ERRNO;
+}
+
+static int compressFile(const char *path, const char *outputPath, unsigned threads) {
+    CompressContext compress = {0};
+    int status = rb_zip_enumerate_file(path, readChunk, &compress);
+
+    if (status == Z_OK && (compress.file = fopen(outputPath, "wb")) == NULL) {
+        status = Z_ERRNO;
+    }
+
+    if (status == Z_OK) {
+        status = rb_zip_deflate(compress.bytes, compress.length, rb_zip_gzip, threads, writeChunk, &compress);
+    }
+
+    if (compress.file != NULL && fclose(compress.file) != 0 && status == Z_OK) {
+        status = Z_ERRNO;
+    }
+
+    free(compress.bytes);
+
+    if (status != Z_OK) {
+        fprintf(stderr, "rbcompile: %s: %s\n", outputPath, status == Z_ERRNO ? strerror(errno) : zError(status));
+        unlink(outputPath);
+        return 1;
+    }
+
+    unlink(path);
+    return 0;
+}
+
+static int compileGroup(const Config *config, const Group *group, sqlite3 *db) {
+    char path[4096], compressedPath[4100];
+    rb_filter_builder builder;
+    unsigned long long numberOfGroupRules = 0;
+    enum rb_rules_status status;
+    double start = now(), stageStart;
+
+    snprintf(path, sizeof(path), "%s/%s.json", config->outputDirectory, group->name);
+    snprintf(compressedPath, sizeof(compressedPath), "%s.gz", path);
+
+    // Merge filters (like -[RBFilterManager _buildFilterGroup:])
+    stageStart = now();
+    status = rb_filter_builder_create(&builder, path, group->paths, group->numberOfPaths);
+    if (status != rb_rules_success) {
+        // The builder doesn't say which input failed, so name the group's output
+        reportRulesError(path, status);
+        unlink(path);
+        return 1;
+    }
+
+    printStage(group->name, "merge", stageStart, -1, (long long)fileSize(path));
+
+    // Count rules, which also makes sure the result is well-formed
+    stageStart = now();
+    if (fflush(builder.file) != 0) {
+        status = rb_rules_io_error;
+    } else {
+        status = rb_enumerate_rules(path, countRule, &numberOfGroupRules);
+    }
+
+    if (reportRulesError(path, status)) {
+        rb_filter_builder_close(&builder);
+        unlink(path);
+        return 1;
+    }
+
+    printStage(group->name, "count", stageStart, (long long)numberOfGroupRules, -1);
+
+    // Append allowlist rules (like -[RBContentBlocker _writeRulesWithCompletionHandler:])
+    if (db != NULL) {
+        AllowlistContext allowlist = {
+            .builder = &builder,
+            .maxNumberOfRules = config->maxNumberOfRules > numberOfGroupRules ? config->maxNumberOfRules - numberOfGroupRules : 0,
+        };
+
+        stageStart = now();
+        int sqliteStatus = rb_allowlist_enumerate_rules(db, group->name, config->allowlistGroupSize, appendAllowlistRule, &allowlist);
+
+        if (sqliteStatus != SQLITE_OK) {
+            fprintf(stderr, "rbcompile: %s: %s\n", config->allowlistPath, sqlite3_errstr(sqliteStatus));
+        }
+
+        if (sqliteStatus != SQLITE_OK || reportRulesError(path, allowlist.status)) {
+            rb_filter_builder_close(&builder);
+            unlink(path);
+            return 1;
+        }
+
+        printStage(group->name, "allowlist", stageStart, (long long)allowlist.numberOfRules, (long long)allowlist.bytes);
+        numberOfGroupRules += allowlist.numberOfRules;
+    }
+
+    if (reportRulesError(path, rb_filter_builder_close(&builder))) {
+        unlink(path);
+        return 1;
+    }
+
+    if (config->compress) {
+        stageStart = now();
+        if (compressFile(path, compressedPath, config->threads)) {
+            unlink(path);
+            return 1;
+        }
+
+        printStage(group->name, "compress", stageStart, -1, (long long)fileSize(compressedPath));
+    }
+
+    printStage(group->name, "total", start, (long long)numberOfGroupRules, (long long)fileSize(config->compress ? compressedPath : path));
+    return 0;
+}
+
+/*** Arguments ***/
+
+// Groups are given as name=file[,file...]
+static int parseGroup(char *argument, Group *group) {
+    char *separator = strchr(argument, '=');
+    char *slash = strchr(argument, '/');
+    char *path = NULL;
+
+    // Group names become file names
+    if (separator == NULL || separator == argument || separator[1] == '\0' || (slash != NULL && slash < separator)) {
+        return 0;
+    }
+
+    *separator = '\0';
+    group->name = argument;
+    group->numberOfPaths = 0;
+    group->paths = calloc(strlen(separator + 1) / 2 + 1, sizeof(char *));
+
+    for (char *paths = separator + 1; (path = strsep(&paths, ",")) != NULL;) {
+        if (*path != '\0') {
+            group->paths[group->numberOfPaths++] = path;
+        }
+    }
+
+    return group->numberOfPaths > 0;
+}
+
+static void usage(const char *program) {
+    fprintf(stderr, "Usage: %s [-a allowlist.db] [-n max rules] [-s allowlist group size] [-j threads] [-z] -o directory group=file[,file...] ...\n", program);
+}
+
+int main(int argc, char *argv[]) {
+    Config config = {
+        .maxNumberOfRules = 50000,
+        .allowlistGroupSize = RB_ALLOWLIST_GROUP_SIZE,
+    };
+    int option, failures = 0;
+
+    while ((option = getopt(argc, argv, "a:n:s:j:zo:")) != -1) {
+        switch (option) {
+            case 'a': config.allowlistPath = optarg; break;
+            case 'n': config.maxNumberOfRules = strtoull(optarg, NULL, 10); break;
+            case 's': config.allowlistGroupSize = (size_t)strtoul(optarg, NULL, 10); break;
+            case 'j': config.threads = (unsigned)strtoul(optarg, NULL, 10); break;
+            case 'z': config.compress = 1; break;
+            case 'o': config.outputDirectory = optarg; break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (config.outputDirectory == NULL || optind == argc || config.allowlistGroupSize == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    size_t numberOfGroups = (size_t)(argc - optind);
+    Group *groups = calloc(numberOfGroups, sizeof(Group));
+
+    for (size_t i = 0; i < numberOfGroups; i++) {
+        if (!parseGroup(argv[optind + (int)i], &groups[i])) {
+            fprintf(stderr, "rbcompile: Expected group=file[,file...], not %s\n", argv[optind + (int)i]);
+            return 1;
+        }
+    }
+
+    if (mkdir(config.outputDirectory, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "rbcompile: %s: %s\n", config.outputDirectory, strerror(errno));
+        return 1;
+    }
+
+    sqlite3 *db = NULL;
+    if (config.allowlistPath != NULL) {
+        int status = rb_sqlite_open(config.allowlistPath, SQLITE_OPEN_READONLY, &db);
+        if (status != SQLITE_OK) {
+            fprintf(stderr, "rbcompile: %s: %s\n", config.allowlistPath, sqlite3_errstr(status));
+            return 1;
+        }
+    }
+
+    for (size_t i = 0; i < numberOfGroups; i++) {
+        failures += compileGroup(&config, &groups[i], db);
+        free(groups[i].paths);
+    }
+
+    free(groups);
+    sqlite3_close(db);
+
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,36 @@
+//
+//  RBDelta.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// MIME type of deltas served by the filter delta endpoint.
+extern NSString *const RBDeltaMIMEType;
+
+/// Binary deltas which rebuild a file from an older version of itself.
+///
+/// A delta starts with the "RBD1" magic and is followed by a list of operations. Each operation is a single opcode
+/// byte followed by LEB128-encoded arguments: 'C' <offset> <length> copies bytes from the base file and 'I' <length>
+/// <bytes> inserts literal bytes.
+@interface RBDelta : NSObject
+
+/// Returns a delta which produces the target data from the base data. Runs of matching lines are copied from the base.
++ (NSData *)deltaFromData:(NSData *)baseData toData:(NSData *)targetData;
+
++ (BOOL)applyDeltaData:(NSData *)deltaData toContentsOfFileURL:(NSURL *)baseURL outputURL:(NSURL *)outputURL error:(NSError *__nullable *__nullable)outError;
+
+/// Applies the delta and hashes the output as it is written, so it can be verified without being read back.
++ (BOOL)applyDeltaData:(NSData *)deltaData toContentsOfFileURL:(NSURL *)baseURL outputURL:(NSURL *)outputURL MD5Hash:(NSString *__nullable *__nullable)outMD5Hash error:(NSError *__nullable *__nullable)outError;
+
+/// Like the above, optionally deflating (zlib) the output as it is written. The hash is of the inflated output.
++ (BOOL)applyDeltaData:(NSData *)deltaData toContentsOfFileURL:(NSURL *)baseURL outputURL:(NSURL *)outputURL deflate:(BOOL)deflate MD5Hash:(NSString *__nullable *__nullable)outMD5Hash error:(NSError *__nullable *__nullable)outError;
+
+@end
+
+NS_ASSUME_NONNULL_END
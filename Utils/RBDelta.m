@@ -0,0 +1,231 @@
+//
+//  RBDelta.m
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import "RBDelta.h"
+#import "RBFileWriter.h"
+
+NSString *const RBDeltaMIMEType = @"application/vnd.radblock.delta";
+
+static const char RBDeltaMagic[4] = {'R', 'B', 'D', '1'};
+
+enum {
+    RBDeltaOpCopy = 'C',
+    RBDeltaOpInsert = 'I',
+};
+
+@implementation RBDelta
+
++ (NSData *)deltaFromData:(NSData *)baseData toData:(NSData *)targetData {
+    const uint8_t *base = baseData.bytes;
+    const uint8_t *target = targetData.bytes;
+    NSUInteger baseLength = baseData.length;
+    NSUInteger targetLength = targetData.length;
+    
+    // Index the first occurrence of each line in the base
+    NSMutableDictionary<NSData*, NSNumber*> *lineOffsets = [NSMutableDictionary dictionary];
+    
+    for (NSUInteger start = 0, end = 0; start < baseLength; start = end) {
+        end = _lineEnd(base, baseLength, start);
+        
+        NSData *line = [NSData dataWithBytesNoCopy:(void *)(base + start) length:end - start freeWhenDone:NO];
+        if (lineOffsets[line] == nil) {
+            lineOffsets[line] = @(start);
+        }
+    }
+    
+    // Most updates touch a single region, so trim the common prefix / suffix before matching lines
+    NSUInteger prefixLength = 0;
+    NSUInteger suffixLength = 0;
+    
+    while (prefixLength < baseLength && prefixLength < targetLength && base[prefixLength] == target[prefixLength]) {
+        prefixLength++;
+    }
+    
+    while (suffixLength < baseLength - prefixLength && suffixLength < targetLength - prefixLength &&
+           base[baseLength - suffixLength - 1] == target[targetLength - suffixLength - 1]) {
+        suffixLength++;
+    }
+    
+    NSMutableData *delta = [NSMutableData dataWithBytes:RBDeltaMagic length:sizeof(RBDeltaMagic)];
+    NSUInteger regionEnd = targetLength - suffixLength;
+    NSUInteger insertStart = prefixLength;
+    NSUInteger pos = prefixLength;
+    
+    _appendCopy(delta, 0, prefixLength);
+    
+    while (pos < regionEnd) {
+        NSUInteger end = _lineEnd(target, regionEnd, pos);
+        NSNumber *offset = lineOffsets[[NSData dataWithBytesNoCopy:(void *)(target + pos) length:end - pos freeWhenDone:NO]];
+        
+        if (offset == nil) {
+            pos = end;
+            continue;
+        }
+        
+        // Extend the copy for as long as the files agree
+        NSUInteger copyStart = offset.unsignedIntegerValue;
+        NSUInteger copyLength = end - pos;
+        
+        while (copyStart + copyLength < baseLength && pos + copyLength < regionEnd && base[copyStart + copyLength] == target[pos + copyLength]) {
+            copyLength++;
+        }
+        
+        _appendInsert(delta, target + insertStart, pos - insertStart);
+        _appendCopy(delta, copyStart, copyLength);
+        
+        pos += copyLength;
+        insertStart = pos;
+    }
+    
+    _appendInsert(delta, target + insertStart, regionEnd - insertStart);
+    _appendCopy(delta, baseLength - suffixLength, suffixLength);
+    
+    return [delta copy];
+}
+
++ (BOOL)applyDeltaData:(NSData *)deltaData toContentsOfFileURL:(NSURL *)baseURL outputURL:(NSURL *)outputURL error:(NSError **)outError {
+    return [self applyDeltaData:deltaData toContentsOfFileURL:baseURL outputURL:outputURL MD5Hash:NULL error:outError];
+}
+
++ (BOOL)applyDeltaData:(NSData *)deltaData toContentsOfFileURL:(NSURL *)baseURL outputURL:(NSURL *)outputURL MD5Hash:(NSString **)outMD5Hash error:(NSError **)outError {
+    return [self applyDeltaData:deltaData toContentsOfFileURL:baseURL outputURL:outputURL deflate:NO MD5Hash:outMD5Hash error:outError];
+}
+
++ (BOOL)applyDeltaData:(NSData *)deltaData toContentsOfFileURL:(NSURL *)baseURL outputURL:(NSURL *)outputURL deflate:(BOOL)deflate MD5Hash:(NSString **)outMD5Hash error:(NSError **)outError {
+    NSError *error = nil;
+    NSData *baseData = [NSData dataWithContentsOfURL:baseURL options:NSDataReadingMappedIfSafe error:&error];
+    RBFileWriter *writer = nil;
+    
+    if (baseData != nil && (writer = [[RBFileWriter alloc] initWithFileURL:outputURL options:(deflate ? RBFileWriterOptionDeflate : 0) error:&error]) != nil) {
+        error = _apply(deltaData.bytes, deltaData.length, baseData.bytes, baseData.length, writer);
+        
+        if (error != nil) {
+            [writer cancel];
+        } else {
+            [writer finishWithError:&error];
+        }
+    }
+    
+    if (error == nil && outMD5Hash != NULL) {
+        (*outMD5Hash) = writer.MD5Hash;
+    }
+    
+    if (outError != NULL) {
+        (*outError) = error;
+    }
+    
+    return error == nil;
+}
+
+#pragma mark - Encoding
+
+static NSUInteger _lineEnd(const uint8_t *bytes, NSUInteger length, NSUInteger start) {
+    const uint8_t *newline = memchr(bytes + start, '\n', length - start);
+    return newline != NULL ? (NSUInteger)(newline - bytes) + 1 : length;
+}
+
+static void _appendOp(NSMutableData *delta, uint8_t op) {
+    [delta appendBytes:&op length:1];
+}
+
+static void _appendVarint(NSMutableData *delta, uint64_t value) {
+    uint8_t buf[10];
+    size_t len = 0;
+    
+    do {
+        buf[len] = (value & 0x7f) | (value > 0x7f ? 0x80 : 0);
+        value >>= 7;
+        len++;
+    } while (value != 0);
+    
+    [delta appendBytes:buf length:len];
+}
+
+static void _appendCopy(NSMutableData *delta, NSUInteger offset, NSUInteger length) {
+    if (length == 0) {
+        return;
+    }
+    
+    _appendOp(delta, RBDeltaOpCopy);
+    _appendVarint(delta, offset);
+    _appendVarint(delta, length);
+}
+
+static void _appendInsert(NSMutableData *delta, const uint8_t *bytes, NSUInteger length) {
+    if (length == 0) {
+        return;
+    }
+    
+    _appendOp(delta, RBDeltaOpInsert);
+    _appendVarint(delta, length);
+    [delta appendBytes:bytes length:length];
+}
+
+#pragma mark - Decoding
+
+static BOOL _readVarint(const uint8_t *bytes, size_t length, size_t *pos, uint64_t *outValue) {
+    uint64_t value = 0;
+    
+    for (unsigned shift = 0; shift < 64 && *pos < length; shift += 7) {
+        uint8_t byte = bytes[(*pos)++];
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        
+        if ((byte & 0x80) == 0) {
+            *outValue = value;
+            return YES;
+        }
+    }
+    
+    return NO;
+}
+
+static NSError *_apply(const uint8_t *delta, size_t deltaLength, const uint8_t *base, size_t baseLength, RBFileWriter *writer) {
+    NSError *corruptError = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadCorruptFileError userInfo:@{
+        NSLocalizedDescriptionKey: @"Delta is corrupt or does not apply to the base file"
+    }];
+    
+    if (deltaLength < sizeof(RBDeltaMagic) || memcmp(delta, RBDeltaMagic, sizeof(RBDeltaMagic)) != 0) {
+        return corruptError;
+    }
+    
+    size_t pos = sizeof(RBDeltaMagic);
+    
+    while (pos < deltaLength) {
+        uint8_t op = delta[pos++];
+        uint64_t offset = 0, length = 0;
+        const uint8_t *bytes = NULL;
+        
+        switch (op) {
+            case RBDeltaOpCopy:
+                if (!_readVarint(delta, deltaLength, &pos, &offset) || !_readVarint(delta, deltaLength, &pos, &length) ||
+                    offset > baseLength || length > baseLength - offset) {
+                    return corruptError;
+                }
+                bytes = base + offset;
+                break;
+            case RBDeltaOpInsert:
+                if (!_readVarint(delta, deltaLength, &pos, &length) || length > deltaLength - pos) {
+                    return corruptError;
+                }
+                bytes = delta + pos;
+                pos += length;
+                break;
+            default:
+                return corruptError;
+        }
+        
+        NSError *writeError = nil;
+        if (![writer appendBytes:bytes length:length error:&writeError]) {
+            return writeError;
+        }
+    }
+    
+    return nil;
+}
+
+@end
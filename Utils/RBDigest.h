@@ -16,6 +16,12 @@ NS_ASSUME_NONNULL_BEGIN
 + (NSString *)MD5HashOfUTF8String:(NSString *)string;
 + (NSString *_Nullable)MD5HashOfFileURL:(NSURL *)fileURL error:(NSError *__nonnull*_Nullable)outError;
 
+/// Hashes what a compressed file (see RBZip) inflates to. Other files are hashed as they are.
++ (NSString *_Nullable)MD5HashOfInflatedContentsOfFileURL:(NSURL *)fileURL error:(NSError *__nonnull*_Nullable)outError;
+
+/// Formats a finalized 16-byte MD5 digest (i.e. from CC_MD5_Final) the same way as the methods above.
++ (NSString *)MD5HashWithDigest:(const unsigned char *)digest;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -7,8 +7,13 @@
 //
 
 #include <CommonCrypto/CommonDigest.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #import "RBDigest.h"
+#import "RBZip.h"
+
+#define CHUNK (1 << 20)
 
 @implementation RBDigest
 
@@ -32,21 +37,58 @@
 }
 
 + (NSString *)MD5HashOfFileURL:(NSURL *)fileURL error:(NSError *__nonnull*_Nullable)outError {
-    NSFileHandle *reader = [NSFileHandle fileHandleForReadingFromURL:fileURL error:outError];
-    if (reader == nil) {
+    int fd = open(fileURL.fileSystemRepresentation, O_RDONLY);
+    if (fd < 0) {
+        if (outError != NULL) {
+            (*outError) = _errorFromPOSIXCode(errno, fileURL);
+        }
         return nil;
     }
     
     CC_MD5_CTX ctx;
     CC_MD5_Init(&ctx);
     
-    NSData *chunk = nil;
+    struct stat st;
+    int readError = (fstat(fd, &st) == 0) ? 0 : errno;
+    void *map = MAP_FAILED;
+    
+    // Hash the mapped file in large chunks, falling back to large reads for anything which can't be mapped
+    if (readError == 0 && st.st_size > 0 && (uint64_t)st.st_size <= SIZE_MAX) {
+        map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
     
-    while ((chunk = [reader readDataOfLength:32*1028]) && chunk.length > 0) {
-        CC_MD5_Update(&ctx, chunk.bytes, (CC_LONG)chunk.length);
+    if (map != MAP_FAILED) {
+        madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+        
+        for (size_t offset = 0; offset < (size_t)st.st_size; offset += CHUNK) {
+            CC_MD5_Update(&ctx, (uint8_t *)map + offset, (CC_LONG)MIN(CHUNK, (size_t)st.st_size - offset));
+        }
+        
+        munmap(map, (size_t)st.st_size);
+    } else if (readError == 0) {
+        uint8_t *buf = malloc(CHUNK);
+        ssize_t len = 0;
+        
+        while ((len = read(fd, buf, CHUNK)) != 0) {
+            if (len > 0) {
+                CC_MD5_Update(&ctx, buf, (CC_LONG)len);
+            } else if (errno != EINTR) {
+                readError = errno;
+                break;
+            }
+        }
+        
+        free(buf);
     }
     
-    [reader closeFile];
+    close(fd);
+    
+    if (readError != 0) {
+        if (outError != NULL) {
+            (*outError) = _errorFromPOSIXCode(readError, fileURL);
+        }
+        return nil;
+    }
     
     unsigned char digest[CC_MD5_DIGEST_LENGTH];
     CC_MD5_Final(digest, &ctx);
@@ -54,6 +96,40 @@
     return _MD5HexString(digest);
 }
 
++ (NSString *)MD5HashOfInflatedContentsOfFileURL:(NSURL *)fileURL error:(NSError *__nonnull*_Nullable)outError {
+    if (![RBZip isCompressedFileURL:fileURL]) {
+        return [self MD5HashOfFileURL:fileURL error:outError];
+    }
+    
+    CC_MD5_CTX ctx;
+    CC_MD5_CTX *ctxRef = &ctx;
+    CC_MD5_Init(&ctx);
+    
+    BOOL success = [RBZip enumerateInflatedContentsOfFileURL:fileURL usingBlock:^(const uint8_t *bytes, size_t length, BOOL *stop) {
+        CC_MD5_Update(ctxRef, bytes, (CC_LONG)length);
+    } error:outError];
+    
+    if (!success) {
+        return nil;
+    }
+    
+    unsigned char digest[CC_MD5_DIGEST_LENGTH];
+    CC_MD5_Final(digest, &ctx);
+    
+    return _MD5HexString(digest);
+}
+
+static NSError *_errorFromPOSIXCode(int code, NSURL *fileURL) {
+    return [NSError errorWithDomain:NSCocoaErrorDomain code:(code == ENOENT ? NSFileReadNoSuchFileError : NSFileReadUnknownError) userInfo:@{
+        NSFilePathErrorKey: fileURL.path ?: @"",
+        NSUnderlyingErrorKey: [NSError errorWithDomain:NSPOSIXErrorDomain code:code userInfo:nil]
+    }];
+}
+
++ (NSString *)MD5HashWithDigest:(const unsigned char *)digest {
+    return _MD5HexString((unsigned char *)digest);
+}
+
 static NSString* _MD5HexString(unsigned char digest[CC_MD5_DIGEST_LENGTH]) {
     NSMutableString *ret = [NSMutableString stringWithCapacity:CC_MD5_DIGEST_LENGTH*2];
     
@@ -0,0 +1,42 @@
+//
+//  RBDigestCache.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Remembers the MD5 hashes of files so they don't need to be read again while they're unchanged. A file is considered
+/// unchanged for as long as its path, inode, size and modification date are.
+@interface RBDigestCache : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Loads the cache from the property list at the given URL (if any). Changes are only saved by synchronizing.
+- (instancetype)initWithFileURL:(NSURL *)fileURL NS_DESIGNATED_INITIALIZER;
+
+@property(nonatomic,readonly) NSURL *fileURL;
+
+/// Cached hashes older than this are verified by reading the file again. Defaults to 0 (never).
+@property(atomic) NSTimeInterval verificationInterval;
+
+/// Hash what compressed files inflate to rather than the files themselves. Defaults to NO.
+@property(atomic) BOOL hashesInflatedContents;
+
+/// Returns the cached hash of an unchanged file, otherwise hashes the file and caches the result.
+- (nullable NSString *)MD5HashOfFileURL:(NSURL *)fileURL error:(NSError *__nullable *__nullable)outError;
+
+/// Records a hash which is already known, i.e. from a writer which hashed the file as it was written.
+- (void)setMD5Hash:(NSString *)md5 forFileURL:(NSURL *)fileURL;
+- (void)removeFileURL:(NSURL *)fileURL;
+
+/// Writes the cache if it has changed.
+- (BOOL)synchronizeWithError:(NSError *__nullable *__nullable)outError;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,124 @@
+//
+//  RBDigestCache.m
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#include <sys/stat.h>
+
+#import "RBDigestCache.h"
+#import "RBDigest.h"
+#import "RBUtils.h"
+
+@implementation RBDigestCache {
+    NSMutableDictionary<NSString*, NSDictionary*> *_entries;
+    BOOL _dirty;
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    _fileURL = [fileURL copy];
+    
+    NSDictionary *plist = [NSDictionary dictionaryWithContentsOfURL:fileURL];
+    _entries = [RBKindOfClassOrNil(NSDictionary, plist[@"files"]) mutableCopy] ?: [NSMutableDictionary dictionary];
+    
+    return self;
+}
+
+- (NSString *)MD5HashOfFileURL:(NSURL *)fileURL error:(NSError **)outError {
+    NSString *path = fileURL.path;
+    NSDictionary *identity = _fileIdentity(fileURL);
+    
+    if (identity == nil) {
+        [self _setEntry:nil forPath:path];
+        return [RBDigest MD5HashOfFileURL:fileURL error:outError]; // produces the appropriate error
+    }
+    
+    NSDictionary *entry = nil;
+    @synchronized (self) {
+        entry = _entries[path];
+    }
+    
+    NSString *md5 = RBKindOfClassOrNil(NSString, entry[@"md5"]);
+    NSDate *verifiedDate = RBKindOfClassOrNil(NSDate, entry[@"verified"]);
+    NSTimeInterval verificationInterval = self.verificationInterval;
+    
+    if (md5 != nil && [entry[@"identity"] isEqual:identity] && (verificationInterval <= 0 || -[verifiedDate timeIntervalSinceNow] < verificationInterval)) {
+        return md5;
+    }
+    
+    md5 = self.hashesInflatedContents ? [RBDigest MD5HashOfInflatedContentsOfFileURL:fileURL error:outError] : [RBDigest MD5HashOfFileURL:fileURL error:outError];
+    
+    // Don't cache a hash of a file which changed while we were reading it
+    if (md5 != nil && [_fileIdentity(fileURL) isEqual:identity]) {
+        [self _setEntry:@{@"identity": identity, @"md5": md5, @"verified": [NSDate date]} forPath:path];
+    } else {
+        [self _setEntry:nil forPath:path];
+    }
+    
+    return md5;
+}
+
+- (void)setMD5Hash:(NSString *)md5 forFileURL:(NSURL *)fileURL {
+    NSDictionary *identity = _fileIdentity(fileURL);
+    [self _setEntry:identity ? @{@"identity": identity, @"md5": md5, @"verified": [NSDate date]} : nil forPath:fileURL.path];
+}
+
+- (void)removeFileURL:(NSURL *)fileURL {
+    [self _setEntry:nil forPath:fileURL.path];
+}
+
+- (void)_setEntry:(NSDictionary *)entry forPath:(NSString *)path {
+    @synchronized (self) {
+        if (entry == nil && _entries[path] == nil) {
+            return;
+        }
+        
+        _entries[path] = entry;
+        _dirty = YES;
+    }
+}
+
+- (BOOL)synchronizeWithError:(NSError **)outError {
+    NSDictionary *plist = nil;
+    
+    @synchronized (self) {
+        if (!_dirty) {
+            return YES;
+        }
+        
+        plist = @{@"files": [_entries copy]};
+        _dirty = NO;
+    }
+    
+    if (![[NSFileManager defaultManager] createDirectoryAtURL:_fileURL.URLByDeletingLastPathComponent withIntermediateDirectories:YES attributes:nil error:outError] ||
+        ![plist writeToURL:_fileURL error:outError]) {
+        @synchronized (self) {
+            _dirty = YES;
+        }
+        return NO;
+    }
+    
+    return YES;
+}
+
+static NSDictionary *_fileIdentity(NSURL *fileURL) {
+    struct stat st;
+    if (stat(fileURL.fileSystemRepresentation, &st) != 0) {
+        return nil;
+    }
+    
+    return @{
+        @"inode": @(st.st_ino),
+        @"size": @(st.st_size),
+        @"mtime": @(st.st_mtimespec.tv_sec),
+        @"mtimeNanoseconds": @(st.st_mtimespec.tv_nsec),
+    };
+}
+
+@end
@@ -0,0 +1,61 @@
+//
+//  RBFileWriter.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_OPTIONS(NSUInteger, RBFileWriterOptions) {
+    /// Appended bytes are inflated (zlib format) before they're written.
+    RBFileWriterOptionInflate = 1 << 0,
+    
+    /// The file is deflated (zlib format) as it's written. The stream is flushed regularly, so an interrupted file can
+    /// still be appended to.
+    RBFileWriterOptionDeflate = 1 << 1,
+};
+
+/// Writes a stream of bytes to a file in a single pass, optionally inflating them and/or deflating the file (zlib
+/// format) on the way, while computing the MD5 hash of the content. Lets downloads and assets be verified (and stored
+/// compressed) without reading them back. The content is what's appended, after inflating and before deflating.
+@interface RBFileWriter : NSObject
+
+/// Copies (or inflates) the input file to the output URL, returning the MD5 hash of the output.
++ (BOOL)writeContentsOfFileURL:(NSURL *)inputURL toFileURL:(NSURL *)outputURL inflate:(BOOL)inflate MD5Hash:(NSString *__nullable *__nullable)outMD5Hash error:(NSError *__nullable *__nullable)outError;
++ (BOOL)writeContentsOfFileURL:(NSURL *)inputURL toFileURL:(NSURL *)outputURL options:(RBFileWriterOptions)options MD5Hash:(NSString *__nullable *__nullable)outMD5Hash error:(NSError *__nullable *__nullable)outError;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (nullable instancetype)initWithFileURL:(NSURL *)fileURL inflate:(BOOL)inflate error:(NSError *__nullable *__nullable)outError;
+- (nullable instancetype)initWithFileURL:(NSURL *)fileURL options:(RBFileWriterOptions)options error:(NSError *__nullable *__nullable)outError;
+
+/// Continues writing (and hashing) an existing file, i.e. to resume a download. The existing contents are read once.
+- (nullable instancetype)initForAppendingToFileURL:(NSURL *)fileURL error:(NSError *__nullable *__nullable)outError;
+
+/// Like the above; only RBFileWriterOptionDeflate is supported. Deflated (or otherwise compressed) files are rewritten
+/// once, keeping as much of their content as can be inflated (i.e. everything up to where they were interrupted).
+- (nullable instancetype)initForAppendingToFileURL:(NSURL *)fileURL options:(RBFileWriterOptions)options error:(NSError *__nullable *__nullable)outError;
+
+@property(nonatomic,readonly) NSURL *fileURL;
+
+/// Length of the content so far (including existing content when appending).
+@property(nonatomic,readonly) uint64_t length;
+
+/// The MD5 hash of the content. Available once the writer has finished successfully.
+@property(nonatomic,nullable,readonly) NSString *MD5Hash;
+
+- (BOOL)appendBytes:(const void *)bytes length:(size_t)length error:(NSError *__nullable *__nullable)outError;
+- (BOOL)appendData:(NSData *)data error:(NSError *__nullable *__nullable)outError;
+
+/// Closes the file. Fails if the compressed stream was incomplete.
+- (BOOL)finishWithError:(NSError *__nullable *__nullable)outError;
+
+/// Closes and removes the file.
+- (void)cancel;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,391 @@
+//
+//  RBFileWriter.m
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#include <CommonCrypto/CommonDigest.h>
+#import <zlib.h>
+
+#import "RBFileWriter.h"
+#import "RBDigest.h"
+#import "RBZip.h"
+
+#define CHUNK 65536
+
+// How much content is deflated between sync flushes, i.e. the most an interrupted file loses
+#define FLUSH_INTERVAL (1 << 20)
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+
+@implementation RBFileWriter {
+    FILE *_file;
+    CC_MD5_CTX _md5;
+    
+    BOOL _inflate;
+    BOOL _streamEnded;
+    z_stream _inflateStream;
+    
+    BOOL _deflate;
+    size_t _unflushedLength;
+    z_stream _deflateStream;
+}
+
++ (BOOL)writeContentsOfFileURL:(NSURL *)inputURL toFileURL:(NSURL *)outputURL inflate:(BOOL)inflate MD5Hash:(NSString **)outMD5Hash error:(NSError **)outError {
+    return [self writeContentsOfFileURL:inputURL toFileURL:outputURL options:(inflate ? RBFileWriterOptionInflate : 0) MD5Hash:outMD5Hash error:outError];
+}
+
++ (BOOL)writeContentsOfFileURL:(NSURL *)inputURL toFileURL:(NSURL *)outputURL options:(RBFileWriterOptions)options MD5Hash:(NSString **)outMD5Hash error:(NSError **)outError {
+    FILE *input = fopen(inputURL.fileSystemRepresentation, "r");
+    if (input == NULL) {
+        if (outError != NULL) {
+            (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadUnknownError userInfo:@{
+                NSFilePathErrorKey: inputURL.path,
+                NSUnderlyingErrorKey: [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil]
+            }];
+        }
+        return NO;
+    }
+    
+    RBFileWriter *writer = [[RBFileWriter alloc] initWithFileURL:outputURL options:options error:outError];
+    BOOL success = writer != nil;
+    
+    if (success) {
+        uint8_t *buf = malloc(CHUNK);
+        size_t len = 0;
+        
+        while (success && (len = fread(buf, 1, CHUNK, input)) > 0) {
+            success = [writer appendBytes:buf length:len error:outError];
+        }
+        
+        free(buf);
+        
+        if (success && ferror(input)) {
+            success = NO;
+            
+            if (outError != NULL) {
+                (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadUnknownError userInfo:@{NSFilePathErrorKey: inputURL.path}];
+            }
+        }
+        
+        if (success) {
+            success = [writer finishWithError:outError];
+        } else {
+            [writer cancel];
+        }
+    }
+    
+    fclose(input);
+    
+    if (success && outMD5Hash != NULL) {
+        (*outMD5Hash) = writer.MD5Hash;
+    }
+    
+    return success;
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL inflate:(BOOL)inflate error:(NSError **)outError {
+    return [self _initWithFileURL:fileURL options:(inflate ? RBFileWriterOptionInflate : 0) append:NO error:outError];
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL options:(RBFileWriterOptions)options error:(NSError **)outError {
+    return [self _initWithFileURL:fileURL options:options append:NO error:outError];
+}
+
+- (instancetype)initForAppendingToFileURL:(NSURL *)fileURL error:(NSError **)outError {
+    return [self _initWithFileURL:fileURL options:0 append:YES error:outError];
+}
+
+- (instancetype)initForAppendingToFileURL:(NSURL *)fileURL options:(RBFileWriterOptions)options error:(NSError **)outError {
+    NSParameterAssert(!(options & RBFileWriterOptionInflate));
+    return [self _initWithFileURL:fileURL options:options append:YES error:outError];
+}
+
+- (instancetype)_initWithFileURL:(NSURL *)fileURL options:(RBFileWriterOptions)options append:(BOOL)append error:(NSError **)outError {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    _fileURL = [fileURL copy];
+    
+    if (options & RBFileWriterOptionInflate) {
+        memset(&_inflateStream, 0, sizeof(_inflateStream));
+        
+        int status = inflateInit(&_inflateStream);
+        if (status != Z_OK) {
+            if (outError != NULL) {
+                (*outError) = _errorFromZlibStatus(status);
+            }
+            return nil;
+        }
+        
+        _inflate = YES;
+    }
+    
+    if (options & RBFileWriterOptionDeflate) {
+        memset(&_deflateStream, 0, sizeof(_deflateStream));
+        
+        int status = deflateInit(&_deflateStream, Z_DEFAULT_COMPRESSION);
+        if (status != Z_OK) {
+            if (outError != NULL) {
+                (*outError) = _errorFromZlibStatus(status);
+            }
+            return nil;
+        }
+        
+        _deflate = YES;
+    }
+    
+    // Compressed files can't be appended to as they are, so their content is written again next to them
+    BOOL rewrite = append && (_deflate || [RBZip isCompressedFileURL:fileURL]);
+    NSURL *openURL = rewrite ? [fileURL URLByAppendingPathExtension:@"rewrite"] : fileURL;
+    
+    if ((_file = fopen(openURL.fileSystemRepresentation, (append && !rewrite) ? "a+" : "w")) == NULL) {
+        if (outError != NULL) {
+            (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{
+                NSFilePathErrorKey: openURL.path,
+                NSUnderlyingErrorKey: [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil]
+            }];
+        }
+        return nil;
+    }
+    
+    CC_MD5_Init(&_md5);
+    
+    if (rewrite) {
+        __block NSError *error = nil;
+        
+        // Whatever can be inflated is a prefix of the content, so an interrupted stream just ends early (and is
+        // resumed from there)
+        [RBZip enumerateInflatedContentsOfFileURL:fileURL usingBlock:^(const uint8_t *bytes, size_t length, BOOL *stop) {
+            (*stop) = ![self _writeBytes:bytes length:length error:&error];
+        } error:NULL];
+        
+        if (error == nil && rename(openURL.fileSystemRepresentation, fileURL.fileSystemRepresentation) != 0) {
+            error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{
+                NSFilePathErrorKey: fileURL.path,
+                NSUnderlyingErrorKey: [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil]
+            }];
+        }
+        
+        if (error != nil) {
+            fclose(_file);
+            _file = NULL;
+            [[NSFileManager defaultManager] removeItemAtURL:openURL error:NULL];
+            
+            if (outError != NULL) {
+                (*outError) = error;
+            }
+            return nil;
+        }
+    } else if (append) {
+        // Hash what's already there
+        uint8_t *buf = malloc(CHUNK);
+        size_t len = 0;
+        
+        rewind(_file);
+        
+        while ((len = fread(buf, 1, CHUNK, _file)) > 0) {
+            CC_MD5_Update(&_md5, buf, (CC_LONG)len);
+            _length += len;
+        }
+        
+        free(buf);
+        
+        if (ferror(_file)) {
+            if (outError != NULL) {
+                (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadUnknownError userInfo:@{NSFilePathErrorKey: fileURL.path}];
+            }
+            return nil;
+        }
+    }
+    
+    return self;
+}
+
+- (void)dealloc {
+    if (_inflate) {
+        inflateEnd(&_inflateStream);
+    }
+    
+    if (_deflate) {
+        deflateEnd(&_deflateStream);
+    }
+    
+    if (_file != NULL) {
+        fclose(_file);
+    }
+}
+
+- (BOOL)appendData:(NSData *)data error:(NSError **)outError {
+    __block BOOL success = YES;
+    
+    // Data received from NSURLSession may be discontiguous
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange byteRange, BOOL *stop) {
+        success = [self appendBytes:bytes length:byteRange.length error:outError];
+        (*stop) = !success;
+    }];
+    
+    return success;
+}
+
+- (BOOL)appendBytes:(const void *)bytes length:(size_t)length error:(NSError **)outError {
+    NSAssert(_file != NULL, @"Writer is closed");
+    
+    if (!_inflate) {
+        return [self _writeBytes:bytes length:length error:outError];
+    }
+    
+    uint8_t out[CHUNK];
+    
+    _inflateStream.next_in = (Bytef *)bytes;
+    _inflateStream.avail_in = (uInt)length;
+    
+    // Keep going while there's input left or inflate filled our buffer (it may be holding more output)
+    do {
+        _inflateStream.next_out = out;
+        _inflateStream.avail_out = sizeof(out);
+        
+        int status = inflate(&_inflateStream, Z_NO_FLUSH);
+        if (status == Z_NEED_DICT) {
+            status = Z_DATA_ERROR;
+        }
+        
+        if (status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR) {
+            if (outError != NULL) {
+                (*outError) = _errorFromZlibStatus(status);
+            }
+            return NO;
+        }
+        
+        _streamEnded = (status == Z_STREAM_END);
+        
+        if (![self _writeBytes:out length:sizeof(out) - _inflateStream.avail_out error:outError]) {
+            return NO;
+        }
+    } while (!_streamEnded && (_inflateStream.avail_in > 0 || _inflateStream.avail_out == 0));
+    
+    return YES;
+}
+
+- (BOOL)_writeBytes:(const void *)bytes length:(size_t)length error:(NSError **)outError {
+    if (length == 0) {
+        return YES;
+    }
+    
+    if (!(_deflate ? [self _deflateBytes:bytes length:length flush:Z_NO_FLUSH error:outError] : [self _writeFileBytes:bytes length:length error:outError])) {
+        return NO;
+    }
+    
+    CC_MD5_Update(&_md5, bytes, (CC_LONG)length);
+    _length += length;
+    
+    if (_deflate && (_unflushedLength += length) >= FLUSH_INTERVAL) {
+        _unflushedLength = 0;
+        return [self _deflateBytes:NULL length:0 flush:Z_SYNC_FLUSH error:outError];
+    }
+    
+    return YES;
+}
+
+- (BOOL)_deflateBytes:(const void *)bytes length:(size_t)length flush:(int)flush error:(NSError **)outError {
+    uint8_t out[CHUNK];
+    
+    _deflateStream.next_in = (Bytef *)bytes;
+    _deflateStream.avail_in = (uInt)length;
+    
+    // Deflate consumes all of its input as long as there's room for output; a full buffer may mean there's more
+    do {
+        _deflateStream.next_out = out;
+        _deflateStream.avail_out = sizeof(out);
+        
+        int status = deflate(&_deflateStream, flush);
+        if (status == Z_STREAM_ERROR) {
+            if (outError != NULL) {
+                (*outError) = _errorFromZlibStatus(status);
+            }
+            return NO;
+        }
+        
+        if (![self _writeFileBytes:out length:sizeof(out) - _deflateStream.avail_out error:outError]) {
+            return NO;
+        }
+    } while (_deflateStream.avail_out == 0);
+    
+    return YES;
+}
+
+- (BOOL)_writeFileBytes:(const void *)bytes length:(size_t)length error:(NSError **)outError {
+    if (length > 0 && fwrite(bytes, 1, length, _file) != length) {
+        if (outError != NULL) {
+            (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{NSFilePathErrorKey: _fileURL.path}];
+        }
+        return NO;
+    }
+    
+    return YES;
+}
+
+- (BOOL)finishWithError:(NSError **)outError {
+    NSAssert(_file != NULL, @"Writer is closed");
+    
+    NSError *error = nil;
+    
+    if (_inflate && !_streamEnded) {
+        error = _errorFromZlibStatus(Z_DATA_ERROR);
+    }
+    
+    if (_deflate && error == nil) {
+        [self _deflateBytes:NULL length:0 flush:Z_FINISH error:&error];
+    }
+    
+    if (fclose(_file) != 0 && error == nil) {
+        error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{NSFilePathErrorKey: _fileURL.path}];
+    }
+    
+    _file = NULL;
+    
+    if (error != nil) {
+        [[NSFileManager defaultManager] removeItemAtURL:_fileURL error:NULL];
+        
+        if (outError != NULL) {
+            (*outError) = error;
+        }
+        return NO;
+    }
+    
+    unsigned char digest[CC_MD5_DIGEST_LENGTH];
+    CC_MD5_Final(digest, &_md5);
+    _MD5Hash = [RBDigest MD5HashWithDigest:digest];
+    
+    return YES;
+}
+
+- (void)cancel {
+    if (_file != NULL) {
+        fclose(_file);
+        _file = NULL;
+    }
+    
+    [[NSFileManager defaultManager] removeItemAtURL:_fileURL error:NULL];
+}
+
+static NSError *_errorFromZlibStatus(int status) {
+    switch (status) {
+    case Z_MEM_ERROR:
+        return [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOMEM userInfo:nil];
+    case Z_VERSION_ERROR:
+        return [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOEXEC userInfo:nil];
+    case Z_STREAM_ERROR:
+        return [NSError errorWithDomain:NSPOSIXErrorDomain code:EINVAL userInfo:nil];
+    default:
+        return [NSError errorWithDomain:NSPOSIXErrorDomain code:EFTYPE userInfo:nil];
+    }
+}
+
+@end
+
+#pragma clang diagnostic pop
@@ -34,9 +34,45 @@ typedef struct _RBSQLitePool RBSQLitePool;
 typedef RBSQLitePool*__nullable RBSQLitePoolRef;
 
 extern RBSQLitePoolRef RBSQLitePoolCreate(int capacity, sqlite3*(^constructorBlock)(void));
+
+/// Creates a pool which grows when callers spend too long waiting for a connection and shrinks when connections sit idle.
+extern RBSQLitePoolRef RBSQLitePoolCreateWithCapacityRange(int minCapacity, int maxCapacity, sqlite3*(^constructorBlock)(void));
+
+/// Invoked right before the pool closes a connection (when shrinking or draining), so per-connection state can be dropped.
+extern void RBSQLitePoolSetDestructorBlock(RBSQLitePoolRef pool, void(^__nullable destructorBlock)(sqlite3 *db));
+
 extern sqlite3* RBSQLitePoolGet(RBSQLitePoolRef pool);
 extern void RBSQLitePoolPut(RBSQLitePoolRef pool, sqlite3 *db);
 extern void RBSQLitePoolDrain(RBSQLitePoolRef pool);
 extern void RBSQLitePoolFree(RBSQLitePoolRef pool);
 
+/// Wait times are bucketed by powers of 10 starting at 1µs (the last bucket holds waits of 1s or more).
+#define RBSQLitePoolWaitHistogramSize 8
+
+/// All durations are in nanoseconds.
+typedef struct {
+    int capacity;
+    int minCapacity;
+    int maxCapacity;
+    
+    NSInteger leases;
+    NSInteger idleConnections;
+    
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t connectionsCreated;
+    uint64_t connectionsClosed;
+    
+    uint64_t waitCount;
+    uint64_t waitTimeTotal;
+    uint64_t waitTimeMax;
+    uint64_t waitHistogram[RBSQLitePoolWaitHistogramSize];
+    
+    uint64_t leaseCount;
+    uint64_t leaseTimeTotal;
+    uint64_t leaseTimeMax;
+} RBSQLitePoolStatistics;
+
+extern RBSQLitePoolStatistics RBSQLitePoolGetStatistics(RBSQLitePoolRef pool);
+
 NS_ASSUME_NONNULL_END
@@ -151,23 +151,54 @@ NSError* NSErrorFromSQLiteStatus(int status) {
 
 #pragma mark - Resource Sharing
 
+// Adaptive pools are re-evaluated every window of leases
+#define RBSQLitePoolAdaptWindow 32
+#define RBSQLitePoolGrowThreshold (1 * NSEC_PER_MSEC)
+#define RBSQLitePoolShrinkThreshold (50 * NSEC_PER_USEC)
+
 typedef struct _RBSQLitePool {
     sqlite3 *(^constructor)(void);
+    void (^destructor)(sqlite3 *);
     NSHashTable *resources;
+    NSMapTable *leaseStartTimes;
     dispatch_semaphore_t semaphore;
     dispatch_semaphore_t resourcesSemaphore;
     NSInteger leases;
+    
+    int capacity;
+    int minCapacity;
+    int maxCapacity;
+    int shrinkDebt;
+    
+    uint64_t windowWaitTime;
+    uint64_t windowWaitCount;
+    
+    RBSQLitePoolStatistics stats;
 } RBSQLitePool;
 
+static inline uint64_t _RBSQLitePoolNow(void) {
+    return clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+}
+
 RBSQLitePoolRef RBSQLitePoolCreate(int capacity, sqlite3*(^constructorBlock)(void)) {
-    RBSQLitePoolRef pool = malloc(sizeof(RBSQLitePool));
+    return RBSQLitePoolCreateWithCapacityRange(capacity, capacity, constructorBlock);
+}
+
+RBSQLitePoolRef RBSQLitePoolCreateWithCapacityRange(int minCapacity, int maxCapacity, sqlite3*(^constructorBlock)(void)) {
+    RBSQLitePoolRef pool = calloc(1, sizeof(RBSQLitePool));
     
     if (pool != NULL) {
         pool->constructor = [constructorBlock copy];
-        pool->resources = [[NSHashTable alloc] initWithOptions:NSPointerFunctionsOpaqueMemory|NSPointerFunctionsOpaquePersonality capacity:capacity];
+        pool->resources = [[NSHashTable alloc] initWithOptions:NSPointerFunctionsOpaqueMemory|NSPointerFunctionsOpaquePersonality capacity:maxCapacity];
+        pool->leaseStartTimes = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsOpaqueMemory|NSPointerFunctionsOpaquePersonality
+                                                          valueOptions:NSPointerFunctionsOpaqueMemory|NSPointerFunctionsIntegerPersonality
+                                                              capacity:maxCapacity];
         pool->semaphore = dispatch_semaphore_create(1);
-        pool->resourcesSemaphore = dispatch_semaphore_create(capacity);
+        pool->resourcesSemaphore = dispatch_semaphore_create(minCapacity);
         pool->leases = 0;
+        pool->capacity = minCapacity;
+        pool->minCapacity = minCapacity;
+        pool->maxCapacity = MAX(minCapacity, maxCapacity);
     }
     
     return pool;
@@ -176,7 +207,9 @@ RBSQLitePoolRef RBSQLitePoolCreate(int capacity, sqlite3*(^constructorBlock)(voi
 void RBSQLitePoolFree(RBSQLitePoolRef pool) {
     if (pool != NULL) {
         [pool->resources release];
+        [pool->leaseStartTimes release];
         [pool->constructor release];
+        [pool->destructor release];
         dispatch_release(pool->semaphore);
         dispatch_release(pool->resourcesSemaphore);
         
@@ -184,8 +217,69 @@ void RBSQLitePoolFree(RBSQLitePoolRef pool) {
     }
 }
 
+void RBSQLitePoolSetDestructorBlock(RBSQLitePoolRef pool, void(^destructorBlock)(sqlite3 *db)) {
+    void (^destructor)(sqlite3 *) = [destructorBlock copy];
+    
+    dispatch_semaphore_wait(pool->semaphore, DISPATCH_TIME_FOREVER);
+    {
+        [pool->destructor release];
+        pool->destructor = destructor;
+    }
+    dispatch_semaphore_signal(pool->semaphore);
+}
+
+static void _RBSQLitePoolClose(sqlite3 *db, void (^destructor)(sqlite3 *)) {
+    if (destructor != nil) {
+        destructor(db);
+    }
+    sqlite3_close(db);
+}
+
+static void _RBSQLitePoolRecordWait(RBSQLitePoolRef pool, uint64_t waitTime) {
+    RBSQLitePoolStatistics *stats = &pool->stats;
+    
+    stats->waitCount++;
+    stats->waitTimeTotal += waitTime;
+    stats->waitTimeMax = MAX(stats->waitTimeMax, waitTime);
+    
+    int bucket = 0;
+    for (uint64_t limit = NSEC_PER_USEC; bucket < RBSQLitePoolWaitHistogramSize - 1 && waitTime >= limit; limit *= 10) {
+        bucket++;
+    }
+    stats->waitHistogram[bucket]++;
+    
+    // Adapt capacity based on the average wait time of the last window
+    if (pool->minCapacity == pool->maxCapacity) {
+        return;
+    }
+    
+    pool->windowWaitTime += waitTime;
+    
+    if (++pool->windowWaitCount < RBSQLitePoolAdaptWindow) {
+        return;
+    }
+    
+    uint64_t averageWaitTime = pool->windowWaitTime / pool->windowWaitCount;
+    pool->windowWaitTime = 0;
+    pool->windowWaitCount = 0;
+    
+    if (averageWaitTime >= RBSQLitePoolGrowThreshold && pool->capacity < pool->maxCapacity) {
+        if (pool->shrinkDebt > 0) {
+            pool->shrinkDebt--;
+        } else {
+            dispatch_semaphore_signal(pool->resourcesSemaphore);
+        }
+        pool->capacity++;
+    } else if (averageWaitTime < RBSQLitePoolShrinkThreshold && pool->capacity > pool->minCapacity && pool->resources.count > 0) {
+        // Connections are closed as they're returned to the pool
+        pool->shrinkDebt++;
+        pool->capacity--;
+    }
+}
+
 sqlite3* RBSQLitePoolGet(RBSQLitePoolRef pool) {
     sqlite3 *db = NULL;
+    uint64_t startTime = _RBSQLitePoolNow();
     
     // Wait for a resource to become available
     dispatch_semaphore_wait(pool->resourcesSemaphore, DISPATCH_TIME_FOREVER);
@@ -196,49 +290,120 @@ sqlite3* RBSQLitePoolGet(RBSQLitePoolRef pool) {
         db = (sqlite3*)[pool->resources anyObject];
         if (db != nil) {
             [pool->resources removeObject:(id)(db)];
+            pool->stats.hits++;
+        } else {
+            pool->stats.misses++;
         }
         pool->leases++;
+        
+        _RBSQLitePoolRecordWait(pool, _RBSQLitePoolNow() - startTime);
+    }
+    dispatch_semaphore_signal(pool->semaphore);
+    
+    BOOL isNewConnection = (db == NULL);
+    if (isNewConnection) {
+        db = pool->constructor();
+    }
+    
+    if (db == NULL) {
+        return NULL;
+    }
+    
+    dispatch_semaphore_wait(pool->semaphore, DISPATCH_TIME_FOREVER);
+    {
+        NSMapInsert(pool->leaseStartTimes, db, (void *)(uintptr_t)_RBSQLitePoolNow());
+        
+        if (isNewConnection) {
+            pool->stats.connectionsCreated++;
+        }
     }
     dispatch_semaphore_signal(pool->semaphore);
     
-    return db ?: pool->constructor();
+    return db;
 }
 
 void RBSQLitePoolPut(RBSQLitePoolRef pool, sqlite3 *db) {
+    BOOL shouldClose = NO;
+    void (^destructor)(sqlite3 *) = nil;
+    
     dispatch_semaphore_wait(pool->semaphore, DISPATCH_TIME_FOREVER);
     {
-        [pool->resources addObject:(id)db];
+        uint64_t leaseStartTime = (uint64_t)(uintptr_t)NSMapGet(pool->leaseStartTimes, db);
+        if (leaseStartTime != 0) {
+            uint64_t leaseTime = _RBSQLitePoolNow() - leaseStartTime;
+            
+            pool->stats.leaseCount++;
+            pool->stats.leaseTimeTotal += leaseTime;
+            pool->stats.leaseTimeMax = MAX(pool->stats.leaseTimeMax, leaseTime);
+            
+            NSMapRemove(pool->leaseStartTimes, db);
+        }
+        
+        if (pool->shrinkDebt > 0) {
+            pool->shrinkDebt--;
+            pool->stats.connectionsClosed++;
+            destructor = [pool->destructor retain];
+            shouldClose = YES;
+        } else {
+            [pool->resources addObject:(id)db];
+        }
+        
         pool->leases--;
     }
     dispatch_semaphore_signal(pool->semaphore);
     
+    if (shouldClose) {
+        // Capacity was reduced; drop the connection without releasing its slot
+        _RBSQLitePoolClose(db, destructor);
+        [destructor release];
+        return;
+    }
+    
     // Signal that we have a resource has become available
     dispatch_semaphore_signal(pool->resourcesSemaphore);
 }
 
 void RBSQLitePoolDrain(RBSQLitePoolRef pool) {
     NSHashTable *resources = nil;
+    void (^destructor)(sqlite3 *) = nil;
     
     dispatch_semaphore_wait(pool->semaphore, DISPATCH_TIME_FOREVER);
     {
         assert(pool->leases == 0);
         
+        destructor = [pool->destructor retain];
         resources = [pool->resources copy];
         [pool->resources removeAllObjects];
+        
+        pool->stats.connectionsClosed += resources.count;
     }
     dispatch_semaphore_signal(pool->semaphore);
     
-    if (resources == nil) {
-        return;
-    }
-    
     while (resources.count > 0) {
         sqlite3 *db = (sqlite3*)[resources anyObject];
-        sqlite3_close(db);
+        _RBSQLitePoolClose(db, destructor);
         [resources removeObject:(id)db];
     }
     
     [resources release];
+    [destructor release];
+}
+
+RBSQLitePoolStatistics RBSQLitePoolGetStatistics(RBSQLitePoolRef pool) {
+    RBSQLitePoolStatistics stats;
+    
+    dispatch_semaphore_wait(pool->semaphore, DISPATCH_TIME_FOREVER);
+    {
+        stats = pool->stats;
+        stats.capacity = pool->capacity;
+        stats.minCapacity = pool->minCapacity;
+        stats.maxCapacity = pool->maxCapacity;
+        stats.leases = pool->leases;
+        stats.idleConnections = (NSInteger)pool->resources.count;
+    }
+    dispatch_semaphore_signal(pool->semaphore);
+    
+    return stats;
 }
 
 #pragma mark -
@@ -0,0 +1,44 @@
+//
+//  RBSharedMemory.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A small, fixed-size region of memory shared between processes by mapping the same file.
+///
+/// Readers copy the region seqlock-style: they never take a lock or make a system call, and only retry if a write
+/// overlapped their copy. Writers are serialized by a lock within the process and an advisory lock on the file.
+/// Every write which changes the region bumps its generation and notifies other mappings of the file.
+@interface RBSharedMemory : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Maps the file, creating it if needed. The region starts out zeroed if the file was created with another length.
+/// Without a file URL, the region is private to this instance.
+- (nullable instancetype)initWithFileURL:(nullable NSURL *)fileURL length:(size_t)length error:(NSError **)outError NS_DESIGNATED_INITIALIZER;
+
+@property(nonatomic,readonly,nullable) NSURL *fileURL;
+@property(nonatomic,readonly) size_t length;
+
+/// Bumped by every write which changes the region (from any process).
+@property(nonatomic,readonly) uint64_t generation;
+
+/// Copies a consistent view of the region into the buffer (which must be `length` bytes). Returns its generation.
+- (uint64_t)readBytes:(void *)bytes;
+
+/// The block is given a copy of the region to modify while holding the writer lock, which is published when the block
+/// returns (unless it didn't change). Writes aren't reentrant. Returns the generation after the write.
+- (uint64_t)writeUsingBlock:(void (NS_NOESCAPE ^)(void *bytes))block;
+
+/// Invoked on the main queue after the region was changed through another mapping (in this process or another one).
+@property(atomic,copy,nullable) void (^changeHandler)(void);
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,253 @@
+//
+//  RBSharedMemory.m
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import "RBSharedMemory.h"
+
+#include <notify.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define RBSharedMemoryMagic 0x4d485352 // "RSHM"
+#define RBSharedMemoryDataOffset 64
+#define RBSharedMemoryMaxReadAttempts (1 << 16)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t length;
+    _Atomic(uint64_t) sequence; // odd while a write is in progress; the generation is half of it
+} RBSharedMemoryHeader;
+
+_Static_assert(sizeof(RBSharedMemoryHeader) <= RBSharedMemoryDataOffset, "Header overlaps data");
+
+@implementation RBSharedMemory {
+    int _fd;
+    void *_bytes;
+    size_t _size;
+    
+    RBSharedMemoryHeader *_header;
+    void *_data;
+    
+    pthread_mutex_t _mutex;
+    
+    NSString *_notifyName;
+    int _notifyToken;
+    _Atomic(uint64_t) _observedSequence;
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL length:(size_t)length error:(NSError **)outError {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    _fileURL = [fileURL copy];
+    _length = length;
+    _fd = -1;
+    _notifyToken = NOTIFY_TOKEN_INVALID;
+    pthread_mutex_init(&_mutex, NULL);
+    
+    size_t pageSize = (size_t)getpagesize();
+    _size = ((RBSharedMemoryDataOffset + length + pageSize - 1) / pageSize) * pageSize;
+    
+    if (fileURL == nil) {
+        _bytes = mmap(NULL, _size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
+    } else {
+        _fd = open(fileURL.fileSystemRepresentation, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        
+        struct stat st;
+        if (_fd < 0 || fstat(_fd, &st) != 0 || ((size_t)st.st_size < _size && ftruncate(_fd, (off_t)_size) != 0)) {
+            if (outError != NULL) {
+                (*outError) = _RBSharedMemoryError(fileURL);
+            }
+            return nil;
+        }
+        
+        _bytes = mmap(NULL, _size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    }
+    
+    if (_bytes == MAP_FAILED) {
+        _bytes = NULL;
+        
+        if (outError != NULL) {
+            (*outError) = _RBSharedMemoryError(fileURL);
+        }
+        return nil;
+    }
+    
+    _header = _bytes;
+    _data = (char *)_bytes + RBSharedMemoryDataOffset;
+    
+    // Zero regions which were created by someone else (or with another layout)
+    [self _lock];
+    {
+        if (_header->magic != RBSharedMemoryMagic || _header->length != length) {
+            uint64_t sequence = atomic_load_explicit(&_header->sequence, memory_order_relaxed);
+            sequence += (sequence & 1) ? 1 : 2;
+            
+            memset(_data, 0, length);
+            _header->magic = RBSharedMemoryMagic;
+            _header->length = (uint32_t)length;
+            
+            atomic_store_explicit(&_header->sequence, sequence, memory_order_release);
+        }
+        
+        atomic_store(&_observedSequence, atomic_load(&_header->sequence));
+    }
+    [self _unlock];
+    
+    if (fileURL != nil) {
+        [self _registerForChanges];
+    }
+    
+    return self;
+}
+
+- (void)dealloc {
+    if (_notifyToken != NOTIFY_TOKEN_INVALID) {
+        notify_cancel(_notifyToken);
+    }
+    if (_bytes != NULL) {
+        munmap(_bytes, _size);
+    }
+    if (_fd >= 0) {
+        close(_fd);
+    }
+    
+    pthread_mutex_destroy(&_mutex);
+}
+
+static NSError *_RBSharedMemoryError(NSURL *fileURL) {
+    NSDictionary *userInfo = fileURL != nil ? @{NSFilePathErrorKey: fileURL.path} : nil;
+    return [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:userInfo];
+}
+
+#pragma mark - Reading
+
+- (uint64_t)generation {
+    return atomic_load_explicit(&_header->sequence, memory_order_acquire) / 2;
+}
+
+- (uint64_t)readBytes:(void *)bytes {
+    for (NSUInteger attempt = 1;; attempt++) {
+        uint64_t sequence = atomic_load_explicit(&_header->sequence, memory_order_acquire);
+        
+        if ((sequence & 1) == 0) {
+            memcpy(bytes, _data, _length);
+            atomic_thread_fence(memory_order_acquire);
+            
+            if (atomic_load_explicit(&_header->sequence, memory_order_relaxed) == sequence) {
+                return sequence / 2;
+            }
+        }
+        
+        // Writes only take as long as a memcpy, so a write which never finishes belongs to a process which died
+        if (attempt % RBSharedMemoryMaxReadAttempts == 0) {
+            [self _recoverFromInterruptedWrite];
+        }
+    }
+}
+
+- (void)_recoverFromInterruptedWrite {
+    [self _lock];
+    {
+        uint64_t sequence = atomic_load_explicit(&_header->sequence, memory_order_relaxed);
+        if (sequence & 1) {
+            NSLog(@"Warning: Recovering from an interrupted write to %@", _fileURL.path);
+            atomic_store_explicit(&_header->sequence, sequence + 1, memory_order_release);
+        }
+    }
+    [self _unlock];
+}
+
+#pragma mark - Writing
+
+- (uint64_t)writeUsingBlock:(void (NS_NOESCAPE ^)(void *))block {
+    void *bytes = malloc(_length);
+    uint64_t sequence = 0;
+    BOOL changed = NO;
+    
+    [self _lock];
+    {
+        // Nobody else can write while we hold the lock, so the region can be copied directly
+        memcpy(bytes, _data, _length);
+        block(bytes);
+        
+        sequence = atomic_load_explicit(&_header->sequence, memory_order_relaxed);
+        changed = memcmp(bytes, _data, _length) != 0;
+        
+        if (changed) {
+            atomic_store_explicit(&_header->sequence, sequence + 1, memory_order_relaxed);
+            atomic_thread_fence(memory_order_release);
+            
+            memcpy(_data, bytes, _length);
+            
+            sequence += 2;
+            atomic_store_explicit(&_header->sequence, sequence, memory_order_release);
+            atomic_store(&_observedSequence, sequence);
+        }
+    }
+    [self _unlock];
+    
+    free(bytes);
+    
+    if (changed && _notifyName != nil) {
+        notify_post(_notifyName.UTF8String);
+    }
+    
+    return sequence / 2;
+}
+
+- (void)_lock {
+    pthread_mutex_lock(&_mutex);
+    
+    // The descriptor is shared by our threads, so the file lock only excludes other mappings
+    if (_fd >= 0) {
+        while (flock(_fd, LOCK_EX) != 0 && errno == EINTR);
+    }
+}
+
+- (void)_unlock {
+    if (_fd >= 0) {
+        flock(_fd, LOCK_UN);
+    }
+    
+    pthread_mutex_unlock(&_mutex);
+}
+
+#pragma mark - Observing
+
+- (void)_registerForChanges {
+    __weak RBSharedMemory *weakSelf = self;
+    
+    // Notifications don't carry a sender, so changes are detected by comparing sequence numbers
+    _notifyName = [@"net.youngdynasty.radblock.shared-memory." stringByAppendingString:_fileURL.lastPathComponent];
+    
+    notify_register_dispatch(_notifyName.UTF8String, &_notifyToken, dispatch_get_main_queue(), ^(int token) {
+        RBSharedMemory *strongSelf = weakSelf;
+        if (strongSelf == nil) {
+            return;
+        }
+        
+        // Our own writes have already been observed
+        uint64_t sequence = atomic_load_explicit(&strongSelf->_header->sequence, memory_order_acquire) & ~1ull;
+        uint64_t observedSequence = atomic_load(&strongSelf->_observedSequence);
+        
+        if (sequence <= observedSequence || !atomic_compare_exchange_strong(&strongSelf->_observedSequence, &observedSequence, sequence)) {
+            return;
+        }
+        
+        void (^changeHandler)(void) = strongSelf.changeHandler;
+        if (changeHandler != nil) {
+            changeHandler();
+        }
+    });
+}
+
+@end
@@ -0,0 +1,39 @@
+//
+//  RBStatSketch.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "RBStat.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Counts the most frequent keys of a stat (i.e. blocked domains) in fixed memory, using the Space-Saving sketch in
+/// space_saving.h. Counts are upper bounds, which are exact until more keys are seen than the sketch has room for.
+/// Sketches aren't thread-safe.
+@interface RBStatSketch : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/// Loads a sketch from its data representation. If the data was written with a larger capacity, only the most frequent
+/// keys are kept.
+- (nullable instancetype)initWithCapacity:(NSUInteger)capacity data:(NSData *)data error:(NSError *__nullable *__nullable)outError;
+
+@property(nonatomic,readonly) NSUInteger capacity;
+@property(nonatomic,readonly) NSData *dataRepresentation;
+
+- (void)addKey:(NSString *)key count:(NSUInteger)count;
+
+/// Combines the counts of another sketch, keeping this sketch's capacity.
+- (void)mergeSketch:(RBStatSketch *)sketch;
+
+/// The most frequent keys (as stat names), most frequent first.
+- (NSArray<RBStat *> *)topStatsWithLimit:(NSUInteger)limit;
+
+@end
+
+NS_ASSUME_NONNULL_END
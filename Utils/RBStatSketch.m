@@ -0,0 +1,92 @@
+//
+//  RBStatSketch.m
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import "RBStatSketch.h"
+#import "RBStat-Private.h"
+#import "space_saving.h"
+
+@implementation RBStatSketch {
+    space_saving _sketch;
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    self = [super init];
+    if (self == nil)
+        return nil;
+    
+    if (space_saving_init(&_sketch, MAX(capacity, 1)) != space_saving_success) {
+        [NSException raise:NSMallocException format:@"Could not allocate sketch with capacity %lu", (unsigned long)capacity];
+    }
+    
+    return self;
+}
+
+- (nullable instancetype)initWithCapacity:(NSUInteger)capacity data:(NSData *)data error:(NSError **)outError {
+    self = [self initWithCapacity:capacity];
+    if (self == nil)
+        return nil;
+    
+    if (space_saving_deserialize(&_sketch, data.bytes, data.length) != space_saving_success) {
+        if (outError != NULL) {
+            (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSPropertyListReadCorruptError userInfo:nil];
+        }
+        return nil;
+    }
+    
+    return self;
+}
+
+- (void)dealloc {
+    space_saving_destroy(&_sketch);
+}
+
+- (NSUInteger)capacity {
+    return _sketch.capacity;
+}
+
+- (NSData *)dataRepresentation {
+    NSMutableData *data = [NSMutableData dataWithLength:space_saving_serialized_length(&_sketch)];
+    space_saving_serialize(&_sketch, data.mutableBytes);
+    return data;
+}
+
+- (void)addKey:(NSString *)key count:(NSUInteger)count {
+    const char *bytes = key.UTF8String;
+    
+    // Keys which are too long to be domains are ignored
+    space_saving_add(&_sketch, bytes, strlen(bytes), count);
+}
+
+- (void)mergeSketch:(RBStatSketch *)sketch {
+    if (space_saving_merge(&_sketch, &sketch->_sketch) != space_saving_success) {
+        [NSException raise:NSMallocException format:@"Could not merge sketches"];
+    }
+}
+
+- (NSArray<RBStat *> *)topStatsWithLimit:(NSUInteger)limit {
+    limit = MIN(limit, _sketch.count);
+    if (limit == 0) {
+        return @[];
+    }
+    
+    const space_saving_counter **counters = calloc(limit, sizeof(space_saving_counter *));
+    size_t count = space_saving_top(&_sketch, counters, limit);
+    NSMutableArray *stats = [NSMutableArray arrayWithCapacity:count];
+    
+    for (size_t i = 0; i < count; i++) {
+        RBStat *stat = [RBStat new];
+        stat.name = [[NSString alloc] initWithBytes:counters[i]->key length:counters[i]->length encoding:NSUTF8StringEncoding] ?: @"";
+        stat.value = (NSUInteger)counters[i]->count;
+        [stats addObject:stat];
+    }
+    
+    free(counters);
+    return stats;
+}
+
+@end
@@ -0,0 +1,75 @@
+//
+//  RBTrace.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// An open span. Spans are cheap value types so they can be captured by the blocks which end them.
+typedef struct {
+    const char *name;
+    uint64_t syncIdentifier;
+    uint64_t startTime;
+} RBTraceSpan;
+
+/// Optional measurements recorded with a span.
+typedef struct {
+    int64_t bytes;
+    int64_t numberOfRules;
+    int64_t cacheHits;
+} RBTraceMetrics;
+
+/// Starts a span which belongs to the sync whose work is running (see RBTraceApplySync), if any. Names must be string
+/// literals (only the pointer is kept).
+extern RBTraceSpan RBTraceBegin(const char *name);
+
+/// Starts a new sync. Its spans are the ones which begin inside RBTraceApplySync.
+extern RBTraceSpan RBTraceBeginSync(void);
+
+/// Runs the block in an activity for the sync. The activity follows the work the block dispatches (or hands to
+/// NSURLSession and the like), so overlapping syncs keep their spans apart.
+extern void RBTraceApplySync(RBTraceSpan syncSpan, dispatch_block_t block);
+
+/// Records the span into a fixed-size ring buffer without taking locks. The oldest spans are overwritten.
+extern void RBTraceEnd(RBTraceSpan span, RBTraceMetrics metrics);
+
+
+@interface RBTraceHistogram : NSObject
+
+@property(nonatomic,readonly) NSUInteger count;
+@property(nonatomic,readonly) NSTimeInterval totalDuration;
+@property(nonatomic,readonly) NSTimeInterval maximumDuration;
+
+@property(nonatomic,readonly) int64_t totalBytes;
+@property(nonatomic,readonly) int64_t totalNumberOfRules;
+@property(nonatomic,readonly) int64_t totalCacheHits;
+
+/// Percentiles range from 0 to 100. Durations are bucketed by powers of two (in microseconds), so this returns the
+/// upper bound of the bucket.
+- (NSTimeInterval)durationAtPercentile:(double)percentile;
+
+@end
+
+
+@interface RBTrace : NSObject
+
+/// Defaults to YES. Disabling tracing makes ending a span a no-op.
+@property(class,atomic,getter=isEnabled) BOOL enabled;
+
+/// Spans belonging to the last N syncs in Chrome's trace event format (chrome://tracing, Perfetto).
++ (NSData *)chromeTraceDataForLastSyncs:(NSUInteger)numberOfSyncs;
+
+/// Span durations and metrics for the last N syncs, keyed by span name.
++ (NSDictionary<NSString*, RBTraceHistogram*> *)histogramsForLastSyncs:(NSUInteger)numberOfSyncs;
+
+/// Discards all spans.
++ (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
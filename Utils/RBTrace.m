@@ -0,0 +1,293 @@
+//
+//  RBTrace.m
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#include <os/activity.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+#import "RBTrace.h"
+
+#define CAPACITY 4096
+#define NUMBER_OF_BUCKETS 40
+#define NUMBER_OF_SYNC_ACTIVITIES 16
+
+typedef struct {
+    const char *name;
+    uint64_t syncIdentifier;
+    uint64_t startTime;
+    uint64_t endTime;
+    uint64_t threadIdentifier;
+    RBTraceMetrics metrics;
+} _RBTraceEvent;
+
+typedef struct {
+    _Atomic(uint64_t) sequence; // 0 while empty or being written, otherwise the event's position + 1
+    _RBTraceEvent event;
+} _RBTraceSlot;
+
+typedef struct {
+    _Atomic(uint64_t) syncIdentifier; // 0 while empty or being written
+    _Atomic(os_activity_id_t) activityIdentifier;
+} _RBTraceSyncActivity;
+
+static _RBTraceSlot _slots[CAPACITY];
+static _Atomic(uint64_t) _cursor;
+static _Atomic(uint64_t) _currentSyncIdentifier;
+static atomic_bool _enabled = true;
+
+// Recent syncs by the identifier of their activity (only syncs which may still be running need to be found)
+static _RBTraceSyncActivity _syncActivities[NUMBER_OF_SYNC_ACTIVITIES];
+
+static uint64_t _now(void) {
+    return clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+}
+
+static uint64_t _syncIdentifierForActivity(os_activity_id_t activityIdentifier) {
+    if (activityIdentifier == 0) {
+        return 0;
+    }
+    
+    for (size_t i = 0; i < NUMBER_OF_SYNC_ACTIVITIES; i++) {
+        _RBTraceSyncActivity *syncActivity = &_syncActivities[i];
+        
+        uint64_t syncIdentifier = atomic_load_explicit(&syncActivity->syncIdentifier, memory_order_acquire);
+        if (syncIdentifier != 0 && atomic_load_explicit(&syncActivity->activityIdentifier, memory_order_relaxed) == activityIdentifier) {
+            return syncIdentifier;
+        }
+    }
+    
+    return 0;
+}
+
+RBTraceSpan RBTraceBegin(const char *name) {
+    // Work done for a sync runs in its activity, or in one nested directly inside it (i.e. by the system)
+    os_activity_id_t parentActivityIdentifier = 0;
+    os_activity_id_t activityIdentifier = os_activity_get_identifier(OS_ACTIVITY_CURRENT, &parentActivityIdentifier);
+    uint64_t syncIdentifier = _syncIdentifierForActivity(activityIdentifier) ?: _syncIdentifierForActivity(parentActivityIdentifier);
+    
+    return (RBTraceSpan){
+        .name = name,
+        .syncIdentifier = syncIdentifier,
+        .startTime = _now()
+    };
+}
+
+RBTraceSpan RBTraceBeginSync(void) {
+    uint64_t syncIdentifier = atomic_fetch_add(&_currentSyncIdentifier, 1) + 1;
+    return (RBTraceSpan){.name = "sync", .syncIdentifier = syncIdentifier, .startTime = _now()};
+}
+
+void RBTraceApplySync(RBTraceSpan syncSpan, dispatch_block_t block) {
+    // Detached, so a sync started from another sync's work isn't mistaken for it
+    os_activity_t activity = os_activity_create("sync", OS_ACTIVITY_CURRENT, OS_ACTIVITY_FLAG_DETACHED);
+    _RBTraceSyncActivity *syncActivity = &_syncActivities[syncSpan.syncIdentifier % NUMBER_OF_SYNC_ACTIVITIES];
+    
+    atomic_store_explicit(&syncActivity->syncIdentifier, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&syncActivity->activityIdentifier, os_activity_get_identifier(activity, NULL), memory_order_relaxed);
+    atomic_store_explicit(&syncActivity->syncIdentifier, syncSpan.syncIdentifier, memory_order_release);
+    
+    os_activity_apply(activity, block);
+}
+
+void RBTraceEnd(RBTraceSpan span, RBTraceMetrics metrics) {
+    if (!atomic_load_explicit(&_enabled, memory_order_relaxed)) {
+        return;
+    }
+    
+    uint64_t threadIdentifier = 0;
+    pthread_threadid_np(NULL, &threadIdentifier);
+    
+    _RBTraceEvent event = {
+        .name = span.name,
+        .syncIdentifier = span.syncIdentifier,
+        .startTime = span.startTime,
+        .endTime = _now(),
+        .threadIdentifier = threadIdentifier,
+        .metrics = metrics
+    };
+    
+    // Claim a slot and publish the event seqlock-style, so readers can tell when they've copied a slot mid-write
+    uint64_t position = atomic_fetch_add_explicit(&_cursor, 1, memory_order_relaxed);
+    _RBTraceSlot *slot = &_slots[position % CAPACITY];
+    
+    atomic_store_explicit(&slot->sequence, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    
+    slot->event = event;
+    
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+}
+
+static int _compareEvents(const void *a, const void *b) {
+    uint64_t startA = ((const _RBTraceEvent *)a)->startTime;
+    uint64_t startB = ((const _RBTraceEvent *)b)->startTime;
+    return startA < startB ? -1 : (startA > startB ? 1 : 0);
+}
+
+/// Copies the events belonging to the last N syncs, ordered by start time. The caller frees the result.
+static size_t _copyEvents(NSUInteger numberOfSyncs, _RBTraceEvent **outEvents) {
+    uint64_t currentSyncIdentifier = atomic_load(&_currentSyncIdentifier);
+    uint64_t minimumSyncIdentifier = currentSyncIdentifier >= numberOfSyncs ? currentSyncIdentifier - numberOfSyncs + 1 : 0;
+    
+    _RBTraceEvent *events = malloc(sizeof(_RBTraceEvent) * CAPACITY);
+    size_t count = 0;
+    
+    for (size_t i = 0; i < CAPACITY && numberOfSyncs > 0; i++) {
+        _RBTraceSlot *slot = &_slots[i];
+        
+        uint64_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        if (sequence == 0) {
+            continue;
+        }
+        
+        _RBTraceEvent event = slot->event;
+        atomic_thread_fence(memory_order_acquire);
+        
+        // Overwritten while we were copying it
+        if (atomic_load_explicit(&slot->sequence, memory_order_relaxed) != sequence) {
+            continue;
+        }
+        
+        if (event.syncIdentifier >= minimumSyncIdentifier) {
+            events[count++] = event;
+        }
+    }
+    
+    qsort(events, count, sizeof(_RBTraceEvent), _compareEvents);
+    
+    (*outEvents) = events;
+    return count;
+}
+
+
+@interface RBTraceHistogram()
+- (void)_addEvent:(const _RBTraceEvent *)event;
+@end
+
+
+@implementation RBTrace
+
++ (BOOL)isEnabled {
+    return atomic_load(&_enabled);
+}
+
++ (void)setEnabled:(BOOL)enabled {
+    atomic_store(&_enabled, enabled);
+}
+
++ (NSData *)chromeTraceDataForLastSyncs:(NSUInteger)numberOfSyncs {
+    _RBTraceEvent *events = NULL;
+    size_t count = _copyEvents(numberOfSyncs, &events);
+    
+    NSMutableArray *traceEvents = [NSMutableArray arrayWithCapacity:count];
+    uint64_t origin = count > 0 ? events[0].startTime : 0;
+    int pid = getpid();
+    
+    for (size_t i = 0; i < count; i++) {
+        _RBTraceEvent *event = &events[i];
+        NSMutableDictionary *args = [NSMutableDictionary dictionaryWithObject:@(event->syncIdentifier) forKey:@"sync"];
+        
+        if (event->metrics.bytes != 0) {
+            args[@"bytes"] = @(event->metrics.bytes);
+        }
+        if (event->metrics.numberOfRules != 0) {
+            args[@"rules"] = @(event->metrics.numberOfRules);
+        }
+        if (event->metrics.cacheHits != 0) {
+            args[@"cacheHits"] = @(event->metrics.cacheHits);
+        }
+        
+        // Complete events, with timestamps in microseconds
+        [traceEvents addObject:@{
+            @"name": @(event->name),
+            @"cat": @"radblock",
+            @"ph": @"X",
+            @"ts": @((event->startTime - origin) / 1000.0),
+            @"dur": @((event->endTime - event->startTime) / 1000.0),
+            @"pid": @(pid),
+            @"tid": @(event->threadIdentifier),
+            @"args": args
+        }];
+    }
+    
+    free(events);
+    
+    return [NSJSONSerialization dataWithJSONObject:@{@"traceEvents": traceEvents, @"displayTimeUnit": @"ms"} options:0 error:NULL];
+}
+
++ (NSDictionary<NSString *, RBTraceHistogram *> *)histogramsForLastSyncs:(NSUInteger)numberOfSyncs {
+    _RBTraceEvent *events = NULL;
+    size_t count = _copyEvents(numberOfSyncs, &events);
+    
+    NSMutableDictionary *histograms = [NSMutableDictionary dictionary];
+    
+    for (size_t i = 0; i < count; i++) {
+        NSString *name = @(events[i].name);
+        RBTraceHistogram *histogram = histograms[name];
+        
+        if (histogram == nil) {
+            histogram = histograms[name] = [RBTraceHistogram new];
+        }
+        
+        [histogram _addEvent:&events[i]];
+    }
+    
+    free(events);
+    
+    return [histograms copy];
+}
+
++ (void)reset {
+    for (size_t i = 0; i < CAPACITY; i++) {
+        atomic_store(&_slots[i].sequence, 0);
+    }
+}
+
+@end
+
+
+@implementation RBTraceHistogram {
+    NSUInteger _buckets[NUMBER_OF_BUCKETS];
+}
+
+- (void)_addEvent:(const _RBTraceEvent *)event {
+    uint64_t microseconds = (event->endTime - event->startTime) / 1000;
+    NSTimeInterval duration = (event->endTime - event->startTime) / (double)NSEC_PER_SEC;
+    
+    // Bucket 0 holds durations under 1µs, bucket N holds [2^(N-1), 2^N)
+    NSUInteger bucket = microseconds == 0 ? 0 : 64 - __builtin_clzll(microseconds);
+    _buckets[MIN(bucket, NUMBER_OF_BUCKETS - 1)]++;
+    
+    _count++;
+    _totalDuration += duration;
+    _maximumDuration = MAX(_maximumDuration, duration);
+    
+    _totalBytes += event->metrics.bytes;
+    _totalNumberOfRules += event->metrics.numberOfRules;
+    _totalCacheHits += event->metrics.cacheHits;
+}
+
+- (NSTimeInterval)durationAtPercentile:(double)percentile {
+    NSUInteger target = (NSUInteger)ceil(_count * MAX(0, MIN(percentile, 100)) / 100.0);
+    NSUInteger seen = 0;
+    
+    for (NSUInteger i = 0; i < NUMBER_OF_BUCKETS; i++) {
+        seen += _buckets[i];
+        
+        if (seen >= target && seen > 0) {
+            return MIN((1ull << i) / (double)USEC_PER_SEC, _maximumDuration);
+        }
+    }
+    
+    return _maximumDuration;
+}
+
+@end
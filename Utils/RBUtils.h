@@ -11,15 +11,23 @@
 NS_ASSUME_NONNULL_BEGIN
 
 extern NSString *const RBAppGroupIdentifier;
-extern NSURL *RBApplicationDataURL;
-extern NSURL *RBSharedApplicationDataURL;
 
-extern NSUserDefaults* RBSharedUserDefaults;
+// Resolved (and created) on first use; safe to call from any thread. These used to be globals set at load time, so
+// the old names are kept as read-only macros for existing Objective-C callers (Swift only sees the RBGet functions).
+extern NSURL *RBGetApplicationDataURL(void);
+extern NSURL *RBGetSharedApplicationDataURL(void);
+
+extern NSUserDefaults* RBGetSharedUserDefaults(void);
+
+#define RBApplicationDataURL RBGetApplicationDataURL()
+#define RBSharedApplicationDataURL RBGetSharedApplicationDataURL()
+#define RBSharedUserDefaults RBGetSharedUserDefaults()
 
 extern BOOL RBMoveFileURL(NSURL *sourceURL, NSURL *destURL, NSError **outError);
 extern NSURL *__nullable RBCreateTemporaryDirectory(NSError **outError);
 
-extern BOOL RBIsDateDurationFake;
+extern BOOL RBGetIsDateDurationFake(void);
+#define RBIsDateDurationFake RBGetIsDateDurationFake()
 
 extern BOOL RBSafariServicesIsVersion13OrHigher(void);
 extern NSString* RBRootDomain(NSString *domain);
@@ -10,39 +10,63 @@
 #import "RBUtils.h"
 
 NSString *const RBAppGroupIdentifier = @"EEQTQC5N2L.radblock";
-NSUserDefaults *RBSharedUserDefaults = nil;
 
-BOOL RBIsDateDurationFake = NO;
+// Everything below is resolved on first use rather than at load time, since most processes which link the framework
+// never touch filters
 
-NSURL *RBApplicationDataURL = nil;
-NSURL *RBSharedApplicationDataURL = nil;
-
-__attribute__((constructor)) static void init() {
-    NSFileManager *fileManager = [NSFileManager defaultManager];
-    
-    NSURL *supportDirectory = [fileManager URLForDirectory:NSApplicationSupportDirectory inDomain:NSUserDomainMask appropriateForURL:nil create:YES error:NULL];
-    assert(supportDirectory != nil);
-    
-    RBApplicationDataURL = [supportDirectory URLByAppendingPathComponent:[[NSBundle mainBundle] bundleIdentifier] isDirectory:YES];
-//    RBSharedApplicationDataURL = [fileManager containerURLForSecurityApplicationGroupIdentifier:RBAppGroupIdentifier];
-    RBSharedApplicationDataURL = RBApplicationDataURL; // TODO(nl) check that swapping this root path is OK
-    
-    assert(RBSharedApplicationDataURL != nil);
-    
-    // Make sure directories actually exist
-    if (![fileManager fileExistsAtPath:RBApplicationDataURL.path]) {
-        assert([fileManager createDirectoryAtURL:RBApplicationDataURL withIntermediateDirectories:YES attributes:nil error:NULL]);
+static NSURL *_RBCreateDirectoryURL(NSURL *directoryURL) {
+    NSError *error = nil;
+    if (![[NSFileManager defaultManager] createDirectoryAtURL:directoryURL withIntermediateDirectories:YES attributes:nil error:&error]) {
+        NSLog(@"Warning: could not create %@: %@", directoryURL.path, error);
     }
+    return directoryURL;
+}
 
-    if (![fileManager fileExistsAtPath:RBSharedApplicationDataURL.path]) {
-        assert([fileManager createDirectoryAtURL:RBSharedApplicationDataURL withIntermediateDirectories:YES attributes:nil error:NULL]);
-    }
+NSURL *RBGetApplicationDataURL(void) {
+    static dispatch_once_t onceToken;
+    static NSURL *applicationDataURL = nil;
+    dispatch_once(&onceToken, ^{
+        NSURL *supportDirectory = [[NSFileManager defaultManager] URLForDirectory:NSApplicationSupportDirectory inDomain:NSUserDomainMask appropriateForURL:nil create:YES error:NULL];
+        if (supportDirectory == nil) {
+            // Shouldn't happen, but the temporary directory is better than crashing
+            supportDirectory = [NSURL fileURLWithPath:NSTemporaryDirectory() isDirectory:YES];
+        }
+        
+        applicationDataURL = _RBCreateDirectoryURL([supportDirectory URLByAppendingPathComponent:[[NSBundle mainBundle] bundleIdentifier] isDirectory:YES]);
+    });
+    return applicationDataURL;
+}
 
-    #ifdef DEBUG
-        RBIsDateDurationFake = [(NSProcessInfo.processInfo.environment[@"RADBLOCK_FAKE_DATE_DURATIONS"] ?: @"") boolValue];
-    #endif
-    
-    RBSharedUserDefaults = [[NSUserDefaults alloc] initWithSuiteName:RBAppGroupIdentifier];
+NSURL *RBGetSharedApplicationDataURL(void) {
+    static dispatch_once_t onceToken;
+    static NSURL *sharedApplicationDataURL = nil;
+    dispatch_once(&onceToken, ^{
+//        sharedApplicationDataURL = [[NSFileManager defaultManager] containerURLForSecurityApplicationGroupIdentifier:RBAppGroupIdentifier];
+        sharedApplicationDataURL = _RBCreateDirectoryURL(RBApplicationDataURL); // TODO(nl) check that swapping this root path is OK
+    });
+    return sharedApplicationDataURL;
+}
+
+NSUserDefaults *RBGetSharedUserDefaults(void) {
+    static dispatch_once_t onceToken;
+    static NSUserDefaults *sharedUserDefaults = nil;
+    dispatch_once(&onceToken, ^{
+        sharedUserDefaults = [[NSUserDefaults alloc] initWithSuiteName:RBAppGroupIdentifier];
+    });
+    return sharedUserDefaults;
+}
+
+BOOL RBGetIsDateDurationFake(void) {
+#ifdef DEBUG
+    static dispatch_once_t onceToken;
+    static BOOL isDateDurationFake = NO;
+    dispatch_once(&onceToken, ^{
+        isDateDurationFake = [(NSProcessInfo.processInfo.environment[@"RADBLOCK_FAKE_DATE_DURATIONS"] ?: @"") boolValue];
+    });
+    return isDateDurationFake;
+#else
+    return NO;
+#endif
 }
 
 BOOL RBSafariServicesIsVersion13OrHigher() {
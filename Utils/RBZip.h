@@ -10,12 +10,31 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+typedef NS_ENUM(NSInteger, RBZipFormat) {
+    RBZipFormatZlib,
+    RBZipFormatGzip,
+};
+
 @interface RBZip : NSObject
 
+/// Large inputs are compressed in blocks on multiple threads (à la pigz); the output is a single regular stream.
++ (nullable NSData *)deflateData:(NSData *)data format:(RBZipFormat)format error:(NSError *__nullable *__nullable)outError;
++ (BOOL)deflateData:(NSData *)data format:(RBZipFormat)format toFileURL:(NSURL *)fileURL error:(NSError *__nullable *__nullable)outError;
+
+/// Writes zlib-formatted data.
 + (BOOL)deflateData:(NSData *)data toFileURL:(NSURL *)fileURL error:(NSError *__nullable *__nullable)outError;
 
+/// Inflates zlib or gzip data (the format is detected). Concatenated gzip members are inflated one after the other.
++ (nullable NSData *)inflateData:(NSData *)data error:(NSError *__nullable *__nullable)outError;
 + (BOOL)inflateContentsOfFileURL:(NSURL *)inputURL toFileURL:(NSURL *)outputURL error:(NSError *__nullable *__nullable)outError;
 
+/// Returns YES if the file starts with a zlib or gzip header.
++ (BOOL)isCompressedFileURL:(NSURL *)fileURL;
+
+/// Inflates a (mapped) file chunk by chunk without writing it anywhere. Files which aren't compressed are enumerated as
+/// they are, so callers can read either kind.
++ (BOOL)enumerateInflatedContentsOfFileURL:(NSURL *)fileURL usingBlock:(void(^)(const uint8_t *bytes, size_t length, BOOL *stop))block error:(NSError *__nullable *__nullable)outError;
+
 @end
 
 NS_ASSUME_NONNULL_END
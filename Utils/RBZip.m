@@ -6,47 +6,132 @@
 //  Copyright © 2019 Young Dynasty. All rights reserved.
 //
 
+#include <sys/mman.h>
+#include <sys/stat.h>
 #import <zlib.h>
+
 #import "RBZip.h"
+#import "rb_zip.h"
+
+typedef int (^_RBZipOutputBlock)(const uint8_t *bytes, size_t length);
 
 @implementation RBZip
 
 + (BOOL)deflateData:(NSData *)data toFileURL:(NSURL *)outputURL error:(NSError **)outError {
-    FILE *output = fopen(outputURL.fileSystemRepresentation, "w");
+    return [self deflateData:data format:RBZipFormatZlib toFileURL:outputURL error:outError];
+}
+
++ (BOOL)deflateData:(NSData *)data format:(RBZipFormat)format toFileURL:(NSURL *)outputURL error:(NSError **)outError {
+    NSData *compressedData = [self deflateData:data format:format error:outError];
+    if (compressedData == nil) {
+        return NO;
+    }
+    
     NSError *error = nil;
     
-    if (output == NULL) {
-        error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{
-            NSFilePathErrorKey: outputURL.path,
-            NSUnderlyingErrorKey: [NSError errorWithDomain:NSOSStatusErrorDomain code:errno userInfo:nil]
-        }];
+    if (![compressedData writeToURL:outputURL options:0 error:&error]) {
+        if (outError != NULL) {
+            (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{
+                NSFilePathErrorKey: outputURL.path,
+                NSUnderlyingErrorKey: error
+            }];
+        }
+        return NO;
+    }
+    
+    return YES;
+}
+
++ (NSData *)deflateData:(NSData *)data format:(RBZipFormat)format error:(NSError **)outError {
+    const uint8_t *bytes = data.bytes;
+    size_t length = data.length;
+    size_t numberOfBlocks = MAX(1, (length + RB_ZIP_BLOCK_SIZE - 1) / RB_ZIP_BLOCK_SIZE);
+    rb_zip_block *blocks = calloc(numberOfBlocks, sizeof(rb_zip_block));
+    
+    // Blocks don't depend on each other's output, so they can be compressed in parallel and stitched together
+    dispatch_apply(numberOfBlocks, DISPATCH_APPLY_AUTO, ^(size_t i) {
+        size_t offset = i * RB_ZIP_BLOCK_SIZE;
+        
+        rb_zip_deflate_block(bytes + offset, MIN(RB_ZIP_BLOCK_SIZE, length - offset), MIN(offset, RB_ZIP_WINDOW_SIZE), i == numberOfBlocks - 1,
+                             (format == RBZipFormatGzip) ? rb_zip_gzip : rb_zip_zlib, &blocks[i]);
+    });
+    
+    NSMutableData *compressedData = [NSMutableData dataWithCapacity:length / 2 + 32];
+    uLong check = (format == RBZipFormatGzip) ? crc32(0, NULL, 0) : adler32(0, NULL, 0);
+    int status = Z_OK;
+    
+    if (format == RBZipFormatGzip) {
+        const uint8_t header[10] = {0x1f, 0x8b, Z_DEFLATED, 0, 0, 0, 0, 0, 0, 3};
+        [compressedData appendBytes:header length:sizeof(header)];
     } else {
-        NSInputStream *input = [NSInputStream inputStreamWithData:data];
-        [input open];
-        error = _normalizeError(_deflate(input, output, Z_DEFAULT_COMPRESSION), nil, nil, outputURL);
-        [input close];
+        const uint8_t header[2] = {0x78, 0x9c}; // 32K window, default compression
+        [compressedData appendBytes:header length:sizeof(header)];
+    }
+    
+    for (size_t i = 0; i < numberOfBlocks; i++) {
+        if (status == Z_OK && (status = blocks[i].status) == Z_OK) {
+            [compressedData appendBytes:blocks[i].bytes length:blocks[i].length];
+            
+            if (format == RBZipFormatGzip) {
+                check = crc32_combine(check, blocks[i].check, (z_off_t)blocks[i].input_length);
+            } else {
+                check = adler32_combine(check, blocks[i].check, (z_off_t)blocks[i].input_length);
+            }
+        }
+        
+        free(blocks[i].bytes);
     }
     
-    if (output != NULL) {
-        fclose(output);
+    free(blocks);
+    
+    if (status != Z_OK) {
+        if (outError != NULL) {
+            (*outError) = _normalizeError(status, nil);
+        }
+        return nil;
     }
     
-    if (outError != NULL) {
-        (*outError) = error;
+    if (format == RBZipFormatGzip) {
+        const uint8_t trailer[8] = {
+            check, check >> 8, check >> 16, check >> 24,
+            length, length >> 8, length >> 16, length >> 24
+        };
+        [compressedData appendBytes:trailer length:sizeof(trailer)];
+    } else {
+        const uint8_t trailer[4] = {check >> 24, check >> 16, check >> 8, check};
+        [compressedData appendBytes:trailer length:sizeof(trailer)];
     }
     
-    return error == nil;
+    return compressedData;
+}
+
++ (NSData *)inflateData:(NSData *)data error:(NSError **)outError {
+    NSMutableData *inflatedData = [NSMutableData dataWithCapacity:data.length * 4];
+    
+    int status = _inflate(data.bytes, data.length, ^int(const uint8_t *bytes, size_t length) {
+        [inflatedData appendBytes:bytes length:length];
+        return Z_OK;
+    });
+    
+    if (status != Z_OK) {
+        if (outError != NULL) {
+            (*outError) = _normalizeError(status, nil);
+        }
+        return nil;
+    }
+    
+    return inflatedData;
 }
 
 + (BOOL)inflateContentsOfFileURL:(NSURL *)inputURL toFileURL:(NSURL *)outputURL error:(NSError *__nullable *__nullable)outError {
     NSError *error = nil;
-    FILE *input = NULL;
+    NSData *input = [NSData dataWithContentsOfURL:inputURL options:NSDataReadingMappedIfSafe error:&error];
     FILE *output = NULL;
     
-    if ((input = fopen(inputURL.fileSystemRepresentation, "r")) == NULL) {
+    if (input == nil) {
         error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadUnknownError userInfo:@{
             NSFilePathErrorKey: outputURL.path,
-            NSUnderlyingErrorKey: [NSError errorWithDomain:NSOSStatusErrorDomain code:errno userInfo:nil]
+            NSUnderlyingErrorKey: error
         }];
     } else if ((output = fopen(outputURL.fileSystemRepresentation, "w")) == NULL) {
         error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{
@@ -54,32 +139,102 @@
             NSUnderlyingErrorKey: [NSError errorWithDomain:NSOSStatusErrorDomain code:errno userInfo:nil]
         }];
     } else {
-        error = _normalizeError(_inflate(input, output), input, inputURL, outputURL);
+        int status = _inflate(input.bytes, input.length, ^int(const uint8_t *bytes, size_t length) {
+            return fwrite(bytes, 1, length, output) == length ? Z_OK : Z_ERRNO;
+        });
+        
+        if (fclose(output) != 0 && status == Z_OK) {
+            status = Z_ERRNO;
+        }
+        
+        error = _normalizeError(status, outputURL);
+    }
+    
+    if (outError != NULL) {
+        (*outError) = error;
     }
     
-    if (input != NULL) {
-        fclose(input);
+    return error == nil;
+}
+
++ (BOOL)isCompressedFileURL:(NSURL *)fileURL {
+    FILE *file = fopen(fileURL.fileSystemRepresentation, "r");
+    if (file == NULL) {
+        return NO;
     }
     
-    if (output != NULL) {
-        fclose(output);
+    uint8_t header[2];
+    size_t length = fread(header, 1, sizeof(header), file);
+    fclose(file);
+    
+    return rb_zip_is_compressed(header, length);
+}
+
++ (BOOL)enumerateInflatedContentsOfFileURL:(NSURL *)fileURL usingBlock:(void(^)(const uint8_t *bytes, size_t length, BOOL *stop))block error:(NSError **)outError {
+    NSFileHandle *handle = [NSFileHandle fileHandleForReadingFromURL:fileURL error:outError];
+    if (handle == nil) {
+        return NO;
     }
     
-    if (outError != NULL) {
-        (*outError) = error;
+    NSData *input = _mappedContentsOfFileHandle(handle);
+    [handle closeFile];
+    
+    if (input == nil) {
+        if (outError != NULL) {
+            (*outError) = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadUnknownError userInfo:@{NSFilePathErrorKey: fileURL.path}];
+        }
+        return NO;
     }
     
-    return error == nil;
+    const uint8_t *bytes = input.bytes;
+    __block BOOL stop = NO;
+    
+    if (!rb_zip_is_compressed(bytes, input.length)) {
+        for (size_t offset = 0; offset < input.length && !stop; offset += RB_ZIP_BUFFER_SIZE) {
+            block(bytes + offset, MIN(RB_ZIP_BUFFER_SIZE, input.length - offset), &stop);
+        }
+        return YES;
+    }
+    
+    int status = _inflate(bytes, input.length, ^int(const uint8_t *chunk, size_t chunkLength) {
+        block(chunk, chunkLength, &stop);
+        return stop ? Z_STREAM_END : Z_OK;
+    });
+    
+    if (status != Z_OK) {
+        if (outError != NULL) {
+            (*outError) = _normalizeError(status, nil);
+        }
+        return NO;
+    }
+    
+    return YES;
+}
+
+static NSData *_mappedContentsOfFileHandle(NSFileHandle *handle) {
+    struct stat st;
+    if (fstat(handle.fileDescriptor, &st) != 0) {
+        return nil;
+    } else if (st.st_size == 0) {
+        return [NSData data];
+    }
+    
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, handle.fileDescriptor, 0);
+    if (map == MAP_FAILED) {
+        return [handle readDataToEndOfFile];
+    }
+    
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+    
+    return [[NSData alloc] initWithBytesNoCopy:map length:(size_t)st.st_size deallocator:^(void *bytes, NSUInteger length) {
+        munmap(bytes, length);
+    }];
 }
 
-static NSError *_normalizeError(int status, FILE *input, NSURL *inputURL, NSURL *outputURL) {
+static NSError *_normalizeError(int status, NSURL *outputURL) {
     switch (status) {
     case Z_ERRNO:
-        if (input != NULL && inputURL != nil && ferror(input)) {
-            return [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadUnknownError userInfo:@{NSFilePathErrorKey: inputURL.path}];
-        } else {
-            return [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{NSFilePathErrorKey: outputURL.path}];
-        }
+        return [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:outputURL ? @{NSFilePathErrorKey: outputURL.path} : nil];
     case Z_STREAM_ERROR:
         return [NSError errorWithDomain:NSPOSIXErrorDomain code:EINVAL userInfo:nil];
     case Z_DATA_ERROR:
@@ -93,116 +248,14 @@ static NSError *_normalizeError(int status, FILE *input, NSURL *inputURL, NSURL
     }
 }
 
-// From https://zlib.net/zpipe.c
-
-#define CHUNK 16384
-
-static int _inflate(FILE *source, FILE *dest)
-{
-    int ret;
-    unsigned have;
-    z_stream strm;
-    unsigned char in[CHUNK];
-    unsigned char out[CHUNK];
-
-    /* allocate inflate state */
-    strm.zalloc = Z_NULL;
-    strm.zfree = Z_NULL;
-    strm.opaque = Z_NULL;
-    strm.avail_in = 0;
-    strm.next_in = Z_NULL;
-    ret = inflateInit(&strm);
-    if (ret != Z_OK)
-        return ret;
-
-    /* decompress until deflate stream ends or end of file */
-    do {
-        strm.avail_in = (unsigned int)fread(in, 1, CHUNK, source);
-        if (ferror(source)) {
-            (void)inflateEnd(&strm);
-            return Z_ERRNO;
-        }
-        if (strm.avail_in == 0)
-            break;
-        strm.next_in = in;
-
-        /* run inflate() on input until output buffer not full */
-        do {
-            strm.avail_out = CHUNK;
-            strm.next_out = out;
-            ret = inflate(&strm, Z_NO_FLUSH);
-            assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
-            switch (ret) {
-            case Z_NEED_DICT:
-                ret = Z_DATA_ERROR;     /* and fall through */
-            case Z_DATA_ERROR:
-            case Z_MEM_ERROR:
-                (void)inflateEnd(&strm);
-                return ret;
-            }
-            have = CHUNK - strm.avail_out;
-            if (fwrite(out, 1, have, dest) != have || ferror(dest)) {
-                (void)inflateEnd(&strm);
-                return Z_ERRNO;
-            }
-        } while (strm.avail_out == 0);
-
-        /* done when inflate() says it's done */
-    } while (ret != Z_STREAM_END);
-
-    /* clean up and return */
-    (void)inflateEnd(&strm);
-    return ret == Z_STREAM_END ? Z_OK : Z_DATA_ERROR;
+// The inflate loop lives in Core/rb_zip.c, so it can be shared with the headless tools
+static int _callOutputBlock(void *context, const uint8_t *bytes, size_t length) {
+    _RBZipOutputBlock output = (__bridge _RBZipOutputBlock)context;
+    return output(bytes, length);
 }
 
-static int _deflate(NSInputStream *source, FILE *dest, int level)
-{
-    int ret, flush;
-    unsigned have;
-    z_stream strm;
-    unsigned char in[CHUNK];
-    unsigned char out[CHUNK];
-
-    /* allocate deflate state */
-    strm.zalloc = Z_NULL;
-    strm.zfree = Z_NULL;
-    strm.opaque = Z_NULL;
-    ret = deflateInit(&strm, level);
-    if (ret != Z_OK)
-        return ret;
-
-    /* compress until end of file */
-    do {
-        strm.avail_in = (unsigned int)[source read:in maxLength:CHUNK];
-        if (source.streamError != nil) {
-            (void)deflateEnd(&strm);
-            return Z_ERRNO;
-        }
-        flush = !source.hasBytesAvailable ? Z_FINISH : Z_NO_FLUSH;
-        strm.next_in = in;
-
-        /* run deflate() on input until output buffer not full, finish
-           compression if all of source has been read in */
-        do {
-            strm.avail_out = CHUNK;
-            strm.next_out = out;
-            ret = deflate(&strm, flush);    /* no bad return value */
-            assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
-            have = CHUNK - strm.avail_out;
-            if (fwrite(out, 1, have, dest) != have || ferror(dest)) {
-                (void)deflateEnd(&strm);
-                return Z_ERRNO;
-            }
-        } while (strm.avail_out == 0);
-        assert(strm.avail_in == 0);     /* all input will be used */
-
-        /* done when last data in file processed */
-    } while (flush != Z_FINISH);
-    assert(ret == Z_STREAM_END);        /* stream will be complete */
-
-    /* clean up and return */
-    (void)deflateEnd(&strm);
-    return Z_OK;
+static int _inflate(const uint8_t *bytes, size_t length, _RBZipOutputBlock output) {
+    return rb_zip_inflate(bytes, length, _callOutputBlock, (__bridge void *)output);
 }
 
 @end
@@ -0,0 +1,499 @@
+//
+//  idna.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#include "idna.h"
+#include "uts46_tables.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*** Buffers ***/
+
+static int grow(void **buffer, size_t *capacity, size_t needed, size_t size)
+{
+  size_t new_capacity;
+  void *new_buffer;
+
+  if (needed <= *capacity) return 1;
+
+  new_capacity = *capacity ? *capacity : 64;
+  while (new_capacity < needed) new_capacity *= 2;
+
+  new_buffer = realloc(*buffer, new_capacity * size);
+  if (new_buffer == NULL) return 0;
+
+  *buffer = new_buffer;
+  *capacity = new_capacity;
+  return 1;
+}
+
+static int reserve_output(idna_batch *batch, size_t length)
+{
+  return grow((void **)&batch->output, &batch->output_capacity, batch->output_length + length, 1);
+}
+
+void idna_batch_init(idna_batch *batch)
+{
+  memset(batch, 0, sizeof(*batch));
+}
+
+void idna_batch_destroy(idna_batch *batch)
+{
+  free(batch->output);
+  free(batch->offsets);
+  free(batch->code_points);
+  free(batch->normalized);
+  memset(batch, 0, sizeof(*batch));
+}
+
+void idna_batch_reset(idna_batch *batch)
+{
+  batch->output_length = 0;
+  batch->count = 0;
+}
+
+/*** ASCII fast path ***/
+
+/* Bytes are checked and lowercased 16 at a time using vector extensions (SSE2 or NEON,  */
+/* depending on the target).                                                               */
+
+typedef uint8_t idna_vector __attribute__((vector_size(16)));
+
+static inline int is_ascii_byte(unsigned char c)
+{
+  return c < 0x80;
+}
+
+static inline unsigned char lowercase_byte(unsigned char c)
+{
+  return c + (((unsigned char)(c - 'A') < 26) << 5);
+}
+
+/* Copies the input lowercased into the output, which must have room for it. Returns 0 */
+/* (possibly after writing some of the output) if the input isn't ASCII.               */
+
+static int copy_lowercase_ascii(const char *input, size_t length, char *output)
+{
+  size_t i = 0;
+
+  for (; i + sizeof(idna_vector) <= length; i += sizeof(idna_vector)) {
+    idna_vector v, non_ascii, upper;
+    uint64_t words[2];
+
+    memcpy(&v, input + i, sizeof(v));
+
+    non_ascii = v & 0x80;
+    memcpy(words, &non_ascii, sizeof(words));
+    if (words[0] | words[1]) return 0;
+
+    upper = (idna_vector)((idna_vector)(v - 'A') < 26);
+    v += upper & 0x20;
+    memcpy(output + i, &v, sizeof(v));
+  }
+
+  for (; i < length; i++) {
+    unsigned char c = input[i];
+    if (!is_ascii_byte(c)) return 0;
+    output[i] = lowercase_byte(c);
+  }
+
+  return 1;
+}
+
+int idna_is_ascii(const char *input, size_t length)
+{
+  size_t i = 0;
+
+  for (; i + sizeof(idna_vector) <= length; i += sizeof(idna_vector)) {
+    idna_vector v, non_ascii;
+    uint64_t words[2];
+
+    memcpy(&v, input + i, sizeof(v));
+    non_ascii = v & 0x80;
+    memcpy(words, &non_ascii, sizeof(words));
+    if (words[0] | words[1]) return 0;
+  }
+
+  for (; i < length; i++) {
+    if (!is_ascii_byte(input[i])) return 0;
+  }
+
+  return 1;
+}
+
+/*** UTS #46 ***/
+
+static inline const uts46_property *lookup(punycode_uint cp)
+{
+  unsigned block = uts46_stage1[cp >> UTS46_SHIFT];
+  return &uts46_properties[uts46_stage2[(block << UTS46_SHIFT) | (cp & ((1 << UTS46_SHIFT) - 1))]];
+}
+
+/* Hangul syllables are decomposed and composed algorithmically (see Unicode 3.12). */
+
+enum { hangul_s = 0xAC00, hangul_l = 0x1100, hangul_v = 0x1161, hangul_t = 0x11A7,
+       hangul_l_count = 19, hangul_v_count = 21, hangul_t_count = 28,
+       hangul_n_count = hangul_v_count * hangul_t_count,
+       hangul_s_count = hangul_l_count * hangul_n_count };
+
+static int reserve_normalized(idna_batch *batch, size_t length, size_t extra)
+{
+  return grow((void **)&batch->normalized, &batch->normalized_capacity, length + extra, sizeof(punycode_uint));
+}
+
+/* Appends the full canonical decomposition of a code point. */
+
+static enum idna_status append_decomposed(idna_batch *batch, size_t *length, punycode_uint cp)
+{
+  const uts46_property *property;
+  punycode_uint *normalized;
+  size_t decomposition_length, i;
+
+  if (!reserve_normalized(batch, *length, 8)) return idna_no_memory;
+  normalized = batch->normalized;
+
+  if (cp - hangul_s < hangul_s_count) {
+    punycode_uint index = cp - hangul_s;
+
+    normalized[(*length)++] = hangul_l + index / hangul_n_count;
+    normalized[(*length)++] = hangul_v + (index % hangul_n_count) / hangul_t_count;
+    if (index % hangul_t_count) normalized[(*length)++] = hangul_t + index % hangul_t_count;
+
+    return idna_success;
+  }
+
+  property = lookup(cp);
+  decomposition_length = property->decomposition & 0x7;
+
+  if (decomposition_length == 0) {
+    normalized[(*length)++] = cp;
+  } else {
+    const uint32_t *decomposition = uts46_decompositions + (property->decomposition >> 3);
+    for (i = 0; i < decomposition_length; i++) normalized[(*length)++] = decomposition[i];
+  }
+
+  return idna_success;
+}
+
+/* Maps code points as per UTS #46 into batch->normalized, decomposed. */
+
+static enum idna_status map_code_points(idna_batch *batch, const punycode_uint *code_points, size_t count, size_t *length)
+{
+  size_t i, j;
+
+  *length = 0;
+
+  for (i = 0; i < count; i++) {
+    punycode_uint cp = code_points[i];
+    uint32_t mapping;
+    size_t mapping_length;
+    enum idna_status status = idna_success;
+
+    /* ASCII is valid apart from uppercase letters, and nothing decomposes into it */
+    if (cp < 0x80) {
+      if (!reserve_normalized(batch, *length, 1)) return idna_no_memory;
+      batch->normalized[(*length)++] = lowercase_byte((unsigned char)cp);
+      continue;
+    }
+
+    mapping = lookup(cp)->mapping;
+    mapping_length = (mapping >> 2) & 0x1F;
+
+    switch (mapping & 0x3) {
+      case uts46_valid:
+        status = append_decomposed(batch, length, cp);
+        break;
+      case uts46_mapped:
+        if (mapping_length == 1) {
+          /* The delta is a 25-bit two's complement number */
+          punycode_uint delta = mapping >> 7;
+          status = append_decomposed(batch, length, (cp + delta - ((delta & 0x1000000) << 1)) & 0x1FFFFF);
+        } else {
+          for (j = 0; j < mapping_length && status == idna_success; j++) {
+            status = append_decomposed(batch, length, uts46_mappings[(mapping >> 7) + j]);
+          }
+        }
+        break;
+      case uts46_ignored:
+        break;
+      default:
+        return idna_disallowed;
+    }
+
+    if (status != idna_success) return status;
+  }
+
+  return idna_success;
+}
+
+static inline uint8_t combining_class(punycode_uint cp)
+{
+  return cp < 0x300 ? 0 : lookup(cp)->combining_class;
+}
+
+static punycode_uint compose(punycode_uint first, punycode_uint second)
+{
+  size_t low = 0, high = sizeof(uts46_compositions) / sizeof(uts46_compositions[0]);
+
+  if (first - hangul_l < hangul_l_count && second - hangul_v < hangul_v_count) {
+    return hangul_s + ((first - hangul_l) * hangul_v_count + (second - hangul_v)) * hangul_t_count;
+  }
+
+  if (first - hangul_s < hangul_s_count && (first - hangul_s) % hangul_t_count == 0 &&
+      second - hangul_t - 1 < hangul_t_count - 1) {
+    return first + (second - hangul_t);
+  }
+
+  if (second < UTS46_MIN_COMPOSITION_SECOND) return 0;
+
+  while (low < high) {
+    size_t middle = (low + high) / 2;
+    const uint32_t *pair = uts46_compositions[middle];
+
+    if (pair[0] == first && pair[1] == second) return pair[2];
+
+    if (pair[0] < first || (pair[0] == first && pair[1] < second)) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+
+  return 0;
+}
+
+/* Puts decomposed code points in canonical order and composes them (NFC). Returns the new length. */
+
+static size_t compose_code_points(punycode_uint *code_points, size_t length)
+{
+  size_t i, j, starter = 0, composed_length = 1;
+  punycode_uint starter_cp;
+  int last_class;
+
+  if (length == 0) return 0;
+
+  /* Canonical ordering: a stable insertion sort of each run of non-starters */
+  for (i = 1; i < length; i++) {
+    punycode_uint cp = code_points[i];
+    uint8_t cc = combining_class(cp);
+
+    if (cc == 0) continue;
+
+    for (j = i; j > 0 && combining_class(code_points[j - 1]) > cc; j--) {
+      code_points[j] = code_points[j - 1];
+    }
+    code_points[j] = cp;
+  }
+
+  /* Canonical composition, where a non-starter is blocked by an earlier one of the same or higher class */
+  starter_cp = code_points[0];
+  last_class = combining_class(starter_cp) ? 256 : 0;
+
+  for (i = 1; i < length; i++) {
+    punycode_uint cp = code_points[i];
+    int cc = combining_class(cp);
+    punycode_uint composite = compose(starter_cp, cp);
+
+    if (composite != 0 && (last_class < cc || last_class == 0)) {
+      code_points[starter] = starter_cp = composite;
+      continue;
+    }
+
+    if (cc == 0) {
+      starter = composed_length;
+      starter_cp = cp;
+    }
+
+    last_class = cc;
+    code_points[composed_length++] = cp;
+  }
+
+  return composed_length;
+}
+
+/*** Labels ***/
+
+static enum idna_status append_label(idna_batch *batch, const punycode_uint *label, size_t length)
+{
+  size_t i, capacity;
+  int ascii = 1;
+
+  for (i = 0; i < length; i++) {
+    if (label[i] >= 0x80) {
+      ascii = 0;
+      break;
+    }
+  }
+
+  /* Mapping has already lowercased ASCII */
+  if (ascii) {
+    if (!reserve_output(batch, length)) return idna_no_memory;
+
+    for (i = 0; i < length; i++) {
+      batch->output[batch->output_length++] = (char)label[i];
+    }
+
+    return idna_success;
+  }
+
+  /* Punycode needs at most a few digits per code point, so this rarely needs a retry */
+  for (capacity = 4 + length * 4 + 16;; capacity *= 2) {
+    punycode_uint output_length;
+    enum punycode_status status;
+    char *output;
+
+    if (!reserve_output(batch, capacity)) return idna_no_memory;
+
+    output = batch->output + batch->output_length;
+    memcpy(output, "xn--", 4);
+    output_length = (punycode_uint)(capacity - 4);
+
+    status = punycode_encode((punycode_uint)length, label, NULL, &output_length, output + 4);
+
+    if (status == punycode_success) {
+      batch->output_length += 4 + output_length;
+      return idna_success;
+    } else if (status != punycode_big_output) {
+      return status == punycode_overflow ? idna_overflow : idna_bad_input;
+    }
+  }
+}
+
+/* Decodes UTF-8 into code_points. Returns the number of code points or -1 if the input */
+/* isn't valid UTF-8.                                                                    */
+
+static long decode_utf8(const unsigned char *input, size_t length, punycode_uint *code_points)
+{
+  size_t i = 0, n = 0;
+
+  while (i < length) {
+    unsigned char c = input[i++];
+    punycode_uint cp, min;
+    int continuation;
+
+    if (c < 0x80) {
+      code_points[n++] = c;
+      continue;
+    } else if ((c & 0xE0) == 0xC0) {
+      cp = c & 0x1F, continuation = 1, min = 0x80;
+    } else if ((c & 0xF0) == 0xE0) {
+      cp = c & 0x0F, continuation = 2, min = 0x800;
+    } else if ((c & 0xF8) == 0xF0) {
+      cp = c & 0x07, continuation = 3, min = 0x10000;
+    } else {
+      return -1;
+    }
+
+    if (length - i < (size_t)continuation) return -1;
+
+    while (continuation--) {
+      c = input[i++];
+      if ((c & 0xC0) != 0x80) return -1;
+      cp = (cp << 6) | (c & 0x3F);
+    }
+
+    if (cp < min || cp > 0x10FFFF || (cp - 0xD800 < 0x800)) return -1;
+    code_points[n++] = cp;
+  }
+
+  return (long)n;
+}
+
+/* Maps and normalizes the domain, then splits it into labels and punycodes those with */
+/* non-ASCII characters. UTS #46 maps every full stop to U+002E.                       */
+
+static enum idna_status append_labels(idna_batch *batch, const char *input, size_t length)
+{
+  size_t i = 0, n;
+  long decoded;
+  enum idna_status status;
+
+  /* UTF-8 never has fewer bytes than code points */
+  if (!grow((void **)&batch->code_points, &batch->code_points_capacity, length, sizeof(punycode_uint))) {
+    return idna_no_memory;
+  }
+
+  decoded = decode_utf8((const unsigned char *)input, length, batch->code_points);
+  if (decoded < 0) return idna_bad_input;
+
+  status = map_code_points(batch, batch->code_points, (size_t)decoded, &n);
+  if (status != idna_success) return status;
+
+  n = compose_code_points(batch->normalized, n);
+
+  while (i < n) {
+    size_t start = i;
+
+    while (i < n && batch->normalized[i] != '.') i++;
+
+    status = append_label(batch, batch->normalized + start, i - start);
+    if (status != idna_success) return status;
+
+    if (i < n) {
+      if (!reserve_output(batch, 1)) return idna_no_memory;
+      batch->output[batch->output_length++] = '.';
+      i++;
+    }
+  }
+
+  return idna_success;
+}
+
+/*** Batches ***/
+
+enum idna_status idna_batch_append(idna_batch *batch, const char *input, size_t length)
+{
+  size_t initial_length = batch->output_length;
+  const char *at = memchr(input, '@', length);
+  enum idna_status status = idna_success;
+
+  if (!grow((void **)&batch->offsets, &batch->offsets_capacity, batch->count + 2, sizeof(size_t))) {
+    return idna_no_memory;
+  }
+
+  /* Most domains are ASCII and don't grow when encoded, so try that first */
+  if (!reserve_output(batch, length)) return idna_no_memory;
+
+  if (at != NULL) {
+    size_t address_length = (size_t)(at - input) + 1;
+
+    memcpy(batch->output + batch->output_length, input, address_length);
+    batch->output_length += address_length;
+    input += address_length;
+    length -= address_length;
+  }
+
+  if (copy_lowercase_ascii(input, length, batch->output + batch->output_length)) {
+    batch->output_length += length;
+  } else {
+    status = append_labels(batch, input, length);
+  }
+
+  if (status != idna_success) {
+    batch->output_length = initial_length;
+    return status;
+  }
+
+  batch->offsets[batch->count] = initial_length;
+  batch->offsets[++batch->count] = batch->output_length;
+
+  return idna_success;
+}
+
+enum idna_status idna_batch_append_all(idna_batch *batch, const char *input, const size_t offsets[], size_t count)
+{
+  size_t i;
+
+  for (i = 0; i < count; i++) {
+    enum idna_status status = idna_batch_append(batch, input + offsets[i], offsets[i + 1] - offsets[i]);
+    if (status != idna_success) return status;
+  }
+
+  return idna_success;
+}
@@ -0,0 +1,70 @@
+//
+//  idna.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+// Batch IDNA encoding on top of punycode.c. Domains are UTF-8 and are encoded into one contiguous output buffer,
+// which (along with the scratch space used for normalization and punycode) is reused for the lifetime of the batch.
+//
+// Domains are processed as per UTS #46 (nontransitional, without STD3 rules, like WebKit's URL parser): code points
+// are mapped using the tables in uts46_tables.h, normalized to NFC and labels with non-ASCII characters are punycoded.
+// Bidi, joiner and hyphen checks are not applied.
+
+#ifndef idna_h
+#define idna_h
+
+#include <stddef.h>
+#include "punycode.h"
+
+enum idna_status {
+  idna_success,
+  idna_bad_input,   /* Input is not valid UTF-8.                 */
+  idna_disallowed,  /* Input contains a disallowed code point.   */
+  idna_no_memory,   /* A buffer could not be grown.              */
+  idna_overflow     /* A label needs wider integers to encode.   */
+};
+
+typedef struct idna_batch {
+  /* Encoded domains, back to back and not null-terminated. */
+  char *output;
+  size_t output_length, output_capacity;
+
+  /* Domain i is output[offsets[i]..offsets[i+1]]. */
+  size_t *offsets;
+  size_t count, offsets_capacity;
+
+  /* Scratch space for domains which aren't ASCII. */
+  punycode_uint *code_points;
+  size_t code_points_capacity;
+  punycode_uint *normalized;
+  size_t normalized_capacity;
+} idna_batch;
+
+void idna_batch_init(idna_batch *batch);
+void idna_batch_destroy(idna_batch *batch);
+
+/* Forgets all domains, but keeps the buffers around for the next ones. */
+void idna_batch_reset(idna_batch *batch);
+
+/* Encodes a domain and appends it to the batch. Anything up to and including the first "@" is copied verbatim. Input
+   which is entirely ASCII is only lowercased (which is all UTS #46 does to it). If the domain can't be encoded, the
+   batch is left unchanged. */
+enum idna_status idna_batch_append(idna_batch *batch, const char *input, size_t length);
+
+/* Encodes `count` domains which are back to back in `input`, where domain i is input[offsets[i]..offsets[i+1]].
+   Stops at the first domain which can't be encoded. */
+enum idna_status idna_batch_append_all(idna_batch *batch, const char *input, const size_t offsets[], size_t count);
+
+/* Returns the encoded domain at the given index. */
+static inline const char *idna_batch_domain(const idna_batch *batch, size_t index, size_t *length) {
+  *length = batch->offsets[index + 1] - batch->offsets[index];
+  return batch->output + batch->offsets[index];
+}
+
+/* Whether the input only contains ASCII characters. */
+int idna_is_ascii(const char *input, size_t length);
+
+#endif /* idna_h */
@@ -0,0 +1,467 @@
+//
+//  space_saving.c
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+#include "space_saving.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define SPACE_SAVING_MAGIC 0x314B5353 /* "SSK1" */
+#define SPACE_SAVING_HEADER_LENGTH 20
+#define SPACE_SAVING_COUNTER_LENGTH 17
+
+/*** Lifecycle ***/
+
+enum space_saving_status space_saving_init(space_saving *sketch, size_t capacity)
+{
+  size_t slot_count = 1;
+
+  memset(sketch, 0, sizeof(*sketch));
+  if (capacity == 0 || capacity > UINT32_MAX / 4) return space_saving_bad_input;
+
+  /* Keep the hash table at most half full, so that probes stay short */
+  while (slot_count < capacity * 2) slot_count *= 2;
+
+  sketch->capacity = capacity;
+  sketch->slot_mask = slot_count - 1;
+  sketch->counters = malloc(capacity * sizeof(space_saving_counter));
+  sketch->heap = malloc(capacity * sizeof(uint32_t));
+  sketch->slots = calloc(slot_count, sizeof(uint32_t));
+
+  if (sketch->counters == NULL || sketch->heap == NULL || sketch->slots == NULL) {
+    space_saving_destroy(sketch);
+    return space_saving_no_memory;
+  }
+
+  return space_saving_success;
+}
+
+void space_saving_destroy(space_saving *sketch)
+{
+  free(sketch->counters);
+  free(sketch->heap);
+  free(sketch->slots);
+  memset(sketch, 0, sizeof(*sketch));
+}
+
+void space_saving_reset(space_saving *sketch)
+{
+  sketch->count = 0;
+  sketch->floor = 0;
+  memset(sketch->slots, 0, (sketch->slot_mask + 1) * sizeof(uint32_t));
+}
+
+/*** Hash table ***/
+
+static uint32_t hash_key(const char *key, size_t length)
+{
+  uint32_t hash = 2166136261u;
+  size_t i;
+
+  for (i = 0; i < length; i++) {
+    hash ^= (unsigned char)key[i];
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+/* Returns the slot for the key: either the one which holds it, or the empty slot it would go in. */
+
+static size_t find_slot(const space_saving *sketch, const char *key, size_t length, uint32_t hash, int *found)
+{
+  size_t i = hash & sketch->slot_mask;
+
+  for (; sketch->slots[i] != 0; i = (i + 1) & sketch->slot_mask) {
+    const space_saving_counter *counter = &sketch->counters[sketch->slots[i] - 1];
+
+    if (counter->hash == hash && counter->length == length && memcmp(counter->key, key, length) == 0) {
+      *found = 1;
+      return i;
+    }
+  }
+
+  *found = 0;
+  return i;
+}
+
+/* Backward shift deletion, so that lookups never need tombstones. */
+
+static void remove_slot(space_saving *sketch, size_t i)
+{
+  size_t j = i;
+
+  for (;;) {
+    size_t home;
+
+    sketch->slots[i] = 0;
+
+    for (;;) {
+      j = (j + 1) & sketch->slot_mask;
+      if (sketch->slots[j] == 0) return;
+
+      /* Entries can only move back if their home slot isn't cyclically within (i, j] */
+      home = sketch->counters[sketch->slots[j] - 1].hash & sketch->slot_mask;
+      if (i <= j ? (i < home && home <= j) : (i < home || home <= j)) continue;
+      break;
+    }
+
+    sketch->slots[i] = sketch->slots[j];
+    i = j;
+  }
+}
+
+/*** Heap ***/
+
+static inline uint64_t heap_count(const space_saving *sketch, size_t i)
+{
+  return sketch->counters[sketch->heap[i]].count;
+}
+
+static inline void heap_swap(space_saving *sketch, size_t i, size_t j)
+{
+  uint32_t index = sketch->heap[i];
+
+  sketch->heap[i] = sketch->heap[j];
+  sketch->heap[j] = index;
+  sketch->counters[sketch->heap[i]].heap_index = (uint32_t)i;
+  sketch->counters[sketch->heap[j]].heap_index = (uint32_t)j;
+}
+
+static void sift_up(space_saving *sketch, size_t i)
+{
+  while (i > 0) {
+    size_t parent = (i - 1) / 2;
+    if (heap_count(sketch, parent) <= heap_count(sketch, i)) break;
+
+    heap_swap(sketch, i, parent);
+    i = parent;
+  }
+}
+
+static void sift_down(space_saving *sketch, size_t i)
+{
+  for (;;) {
+    size_t smallest = i, left = 2 * i + 1, right = 2 * i + 2;
+
+    if (left < sketch->count && heap_count(sketch, left) < heap_count(sketch, smallest)) smallest = left;
+    if (right < sketch->count && heap_count(sketch, right) < heap_count(sketch, smallest)) smallest = right;
+    if (smallest == i) break;
+
+    heap_swap(sketch, i, smallest);
+    i = smallest;
+  }
+}
+
+static void heapify(space_saving *sketch)
+{
+  size_t i;
+
+  for (i = 0; i < sketch->count; i++) {
+    sketch->heap[i] = (uint32_t)i;
+    sketch->counters[i].heap_index = (uint32_t)i;
+  }
+
+  for (i = sketch->count / 2; i-- > 0;) {
+    sift_down(sketch, i);
+  }
+}
+
+/*** Counting ***/
+
+static void set_key(space_saving_counter *counter, const char *key, size_t length, uint32_t hash)
+{
+  memcpy(counter->key, key, length);
+  counter->length = (uint8_t)length;
+  counter->hash = hash;
+}
+
+/* Tracks a key which isn't in the sketch with the given count, recycling the least frequent counter if the sketch is */
+/* full and the key is more frequent. Returns the count of whichever key isn't tracked anymore (or 0).                */
+
+static uint64_t insert(space_saving *sketch, const char *key, size_t length, uint32_t hash, size_t slot, uint64_t count, uint64_t error)
+{
+  space_saving_counter *counter;
+  uint64_t dropped = 0;
+
+  if (sketch->count < sketch->capacity) {
+    size_t index = sketch->count++;
+
+    counter = &sketch->counters[index];
+    counter->heap_index = (uint32_t)index;
+    sketch->heap[index] = (uint32_t)index;
+    sketch->slots[slot] = (uint32_t)index + 1;
+  } else {
+    int found;
+
+    counter = &sketch->counters[sketch->heap[0]];
+    if (counter->count >= count) return count;
+
+    dropped = counter->count;
+    remove_slot(sketch, find_slot(sketch, counter->key, counter->length, counter->hash, &found));
+
+    /* Removing the old key may have shifted the slot for the new one */
+    slot = find_slot(sketch, key, length, hash, &found);
+    sketch->slots[slot] = sketch->heap[0] + 1;
+  }
+
+  set_key(counter, key, length, hash);
+  counter->count = count;
+  counter->error = error;
+
+  sift_up(sketch, counter->heap_index);
+  sift_down(sketch, counter->heap_index);
+
+  return dropped;
+}
+
+enum space_saving_status space_saving_add(space_saving *sketch, const char *key, size_t length, uint64_t count)
+{
+  uint32_t hash;
+  size_t slot;
+  int found;
+
+  if (length > SPACE_SAVING_MAX_KEY_LENGTH) return space_saving_bad_input;
+
+  hash = hash_key(key, length);
+  slot = find_slot(sketch, key, length, hash, &found);
+
+  if (found) {
+    space_saving_counter *counter = &sketch->counters[sketch->slots[slot] - 1];
+
+    counter->count += count;
+    sift_down(sketch, counter->heap_index);
+  } else if (sketch->count < sketch->capacity) {
+    insert(sketch, key, length, hash, slot, sketch->floor + count, sketch->floor);
+  } else {
+    /* The new key takes over the least frequent counter, along with its count as error */
+    uint64_t min = heap_count(sketch, 0);
+    insert(sketch, key, length, hash, slot, min + count, min);
+  }
+
+  return space_saving_success;
+}
+
+uint64_t space_saving_untracked_count(const space_saving *sketch)
+{
+  if (sketch->count == sketch->capacity && heap_count(sketch, 0) > sketch->floor) {
+    return heap_count(sketch, 0);
+  }
+  return sketch->floor;
+}
+
+/*** Merging ***/
+
+static inline uint64_t max_count(uint64_t a, uint64_t b)
+{
+  return a > b ? a : b;
+}
+
+enum space_saving_status space_saving_merge(space_saving *sketch, const space_saving *other)
+{
+  uint64_t floor = space_saving_untracked_count(sketch);
+  uint64_t other_floor = space_saving_untracked_count(other);
+  uint64_t dropped = 0;
+  uint8_t *matched, *other_matched;
+  size_t i;
+
+  matched = calloc(sketch->capacity, 1);
+  other_matched = calloc(other->count + 1, 1);
+
+  if (matched == NULL || other_matched == NULL) {
+    free(matched);
+    free(other_matched);
+    return space_saving_no_memory;
+  }
+
+  /* Keys in both sketches add up, and keys in only one of them get the other's bound for untracked keys */
+  for (i = 0; i < other->count; i++) {
+    const space_saving_counter *other_counter = &other->counters[i];
+    size_t slot;
+    int found;
+
+    slot = find_slot(sketch, other_counter->key, other_counter->length, other_counter->hash, &found);
+    if (found) {
+      space_saving_counter *counter = &sketch->counters[sketch->slots[slot] - 1];
+
+      counter->count += other_counter->count;
+      counter->error += other_counter->error;
+      matched[sketch->slots[slot] - 1] = 1;
+      other_matched[i] = 1;
+    }
+  }
+
+  for (i = 0; i < sketch->count; i++) {
+    if (!matched[i]) {
+      sketch->counters[i].count += other_floor;
+      sketch->counters[i].error += other_floor;
+    }
+  }
+
+  heapify(sketch);
+
+  for (i = 0; i < other->count; i++) {
+    const space_saving_counter *other_counter = &other->counters[i];
+    size_t slot;
+    int found;
+
+    if (other_matched[i]) continue;
+
+    slot = find_slot(sketch, other_counter->key, other_counter->length, other_counter->hash, &found);
+    dropped = max_count(dropped, insert(sketch, other_counter->key, other_counter->length, other_counter->hash, slot,
+                                        other_counter->count + floor, other_counter->error + floor));
+  }
+
+  sketch->floor = max_count(floor + other_floor, dropped);
+
+  free(matched);
+  free(other_matched);
+  return space_saving_success;
+}
+
+/*** Queries ***/
+
+static int is_more_frequent(const space_saving_counter *a, const space_saving_counter *b)
+{
+  int order;
+
+  if (a->count != b->count) return a->count > b->count;
+
+  /* Ties are broken by key, so that results are stable */
+  order = memcmp(a->key, b->key, a->length < b->length ? a->length : b->length);
+  return order != 0 ? order < 0 : a->length < b->length;
+}
+
+size_t space_saving_top(const space_saving *sketch, const space_saving_counter **counters, size_t limit)
+{
+  size_t count = 0, i;
+
+  if (limit == 0) return 0;
+
+  /* Sketches are small, so an insertion sort into the output is fine */
+  for (i = 0; i < sketch->count; i++) {
+    const space_saving_counter *counter = &sketch->counters[i];
+    size_t j;
+
+    if (count == limit && !is_more_frequent(counter, counters[count - 1])) continue;
+    if (count < limit) count++;
+
+    for (j = count - 1; j > 0 && is_more_frequent(counter, counters[j - 1]); j--) {
+      counters[j] = counters[j - 1];
+    }
+    counters[j] = counter;
+  }
+
+  return count;
+}
+
+/*** Serialization ***/
+
+static uint8_t *write_le(uint8_t *output, uint64_t value, size_t length)
+{
+  size_t i;
+
+  for (i = 0; i < length; i++) {
+    output[i] = (uint8_t)(value >> (8 * i));
+  }
+  return output + length;
+}
+
+static uint64_t read_le(const uint8_t *input, size_t length)
+{
+  uint64_t value = 0;
+  size_t i;
+
+  for (i = 0; i < length; i++) {
+    value |= (uint64_t)input[i] << (8 * i);
+  }
+  return value;
+}
+
+size_t space_saving_serialized_length(const space_saving *sketch)
+{
+  size_t length = SPACE_SAVING_HEADER_LENGTH, i;
+
+  for (i = 0; i < sketch->count; i++) {
+    length += SPACE_SAVING_COUNTER_LENGTH + sketch->counters[i].length;
+  }
+  return length;
+}
+
+void space_saving_serialize(const space_saving *sketch, uint8_t *output)
+{
+  size_t i;
+
+  output = write_le(output, SPACE_SAVING_MAGIC, 4);
+  output = write_le(output, sketch->capacity, 4);
+  output = write_le(output, sketch->count, 4);
+  output = write_le(output, sketch->floor, 8);
+
+  for (i = 0; i < sketch->count; i++) {
+    const space_saving_counter *counter = &sketch->counters[i];
+
+    output = write_le(output, counter->count, 8);
+    output = write_le(output, counter->error, 8);
+    output = write_le(output, counter->length, 1);
+    memcpy(output, counter->key, counter->length);
+    output += counter->length;
+  }
+}
+
+enum space_saving_status space_saving_deserialize(space_saving *sketch, const uint8_t *input, size_t length)
+{
+  const uint8_t *end = input + length;
+  uint64_t capacity, count, floor, min = UINT64_MAX, dropped = 0, i;
+
+  space_saving_reset(sketch);
+
+  if (length < SPACE_SAVING_HEADER_LENGTH || read_le(input, 4) != SPACE_SAVING_MAGIC) return space_saving_bad_input;
+
+  capacity = read_le(input + 4, 4);
+  count = read_le(input + 8, 4);
+  floor = read_le(input + 12, 8);
+  input += SPACE_SAVING_HEADER_LENGTH;
+
+  if (count > capacity) return space_saving_bad_input;
+
+  for (i = 0; i < count; i++) {
+    uint64_t counter_count, error;
+    size_t key_length, slot;
+    uint32_t hash;
+    int found;
+
+    if ((size_t)(end - input) < SPACE_SAVING_COUNTER_LENGTH) goto corrupt;
+
+    counter_count = read_le(input, 8);
+    error = read_le(input + 8, 8);
+    key_length = input[16];
+    input += SPACE_SAVING_COUNTER_LENGTH;
+
+    if ((size_t)(end - input) < key_length || error > counter_count) goto corrupt;
+
+    hash = hash_key((const char *)input, key_length);
+    slot = find_slot(sketch, (const char *)input, key_length, hash, &found);
+    if (found) goto corrupt;
+
+    dropped = max_count(dropped, insert(sketch, (const char *)input, key_length, hash, slot, counter_count, error));
+    min = counter_count < min ? counter_count : min;
+    input += key_length;
+  }
+
+  if (input != end) goto corrupt;
+
+  /* Keys which the serialized sketch had no room for may have occurred as often as its least frequent one */
+  if (count == capacity && count > 0) floor = max_count(floor, min);
+  sketch->floor = max_count(floor, dropped);
+
+  return space_saving_success;
+
+corrupt:
+  space_saving_reset(sketch);
+  return space_saving_bad_input;
+}
@@ -0,0 +1,83 @@
+//
+//  space_saving.h
+//  RadBlock
+//
+//  Created by Mike Pulaski on 19/10/2026.
+//  Copyright © 2026 Young Dynasty. All rights reserved.
+//
+
+// Space-Saving heavy hitters sketch (Metwally et al.) over byte-string keys, used for per-domain stats. A sketch
+// tracks at most `capacity` keys in memory which is allocated up front: the least frequent counter is recycled when a
+// new key arrives, and inherits its count as error. Every key which occurs more than N / capacity times (where N is
+// the total of all counts) is guaranteed to be tracked.
+//
+// Sketches are mergeable (Agarwal et al.), so daily sketches can be persisted and combined for a date range without
+// growing beyond the same capacity. Sketches aren't thread-safe.
+
+#ifndef space_saving_h
+#define space_saving_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Domains are at most 253 bytes. */
+#define SPACE_SAVING_MAX_KEY_LENGTH 255
+
+enum space_saving_status {
+  space_saving_success,
+  space_saving_bad_input,   /* Key is too long, or serialized data is corrupt.  */
+  space_saving_no_memory    /* Scratch space for merging could not be allocated. */
+};
+
+typedef struct space_saving_counter {
+  uint64_t count;   /* Upper bound of the key's total.               */
+  uint64_t error;   /* How much the count may overestimate it by.    */
+  uint32_t hash;
+  uint32_t heap_index;
+  uint8_t length;
+  char key[SPACE_SAVING_MAX_KEY_LENGTH];
+} space_saving_counter;
+
+typedef struct space_saving {
+  size_t capacity, count;
+
+  /* Keys which aren't tracked occurred at most this many times (besides what the least frequent counter allows). */
+  uint64_t floor;
+
+  space_saving_counter *counters;
+
+  /* Counter indexes, as a min-heap by count. */
+  uint32_t *heap;
+
+  /* Open addressing hash table of counter index + 1 (0 is empty). */
+  uint32_t *slots;
+  size_t slot_mask;
+} space_saving;
+
+enum space_saving_status space_saving_init(space_saving *sketch, size_t capacity);
+void space_saving_destroy(space_saving *sketch);
+
+/* Forgets all keys, but keeps the memory around. */
+void space_saving_reset(space_saving *sketch);
+
+/* Adds `count` occurrences of a key. */
+enum space_saving_status space_saving_add(space_saving *sketch, const char *key, size_t length, uint64_t count);
+
+/* Merges another sketch (of any capacity) into this one, keeping the most frequent keys of both. */
+enum space_saving_status space_saving_merge(space_saving *sketch, const space_saving *other);
+
+/* Fills `counters` with up to `limit` of the most frequent keys, most frequent first, and returns how many. */
+size_t space_saving_top(const space_saving *sketch, const space_saving_counter **counters, size_t limit);
+
+/* The upper bound for keys which aren't tracked. */
+uint64_t space_saving_untracked_count(const space_saving *sketch);
+
+/* Sketches are serialized as little-endian counters (without empty space), so they're compact and portable. */
+size_t space_saving_serialized_length(const space_saving *sketch);
+void space_saving_serialize(const space_saving *sketch, uint8_t *output);
+
+/* Replaces the sketch's keys with those which were serialized. If the serialized sketch had a larger capacity, only
+   its most frequent keys are kept. */
+enum space_saving_status space_saving_deserialize(space_saving *sketch, const uint8_t *input, size_t length);
+
+#endif /* space_saving_h */
@@ -0,0 +1,5532 @@
+//
+//  uts46_tables.h
+//  RadBlock
+//
+//  Generated by Scripts/generate_uts46_tables.py from Unicode 15.1.0 data. Do not edit.
+//
+
+#ifndef uts46_tables_h
+#define uts46_tables_h
+
+#include <stdint.h>
+
+#define UTS46_UNICODE_VERSION "15.1.0"
+
+/* Statuses for nontransitional processing with UseSTD3ASCIIRules=false */
+enum { uts46_valid, uts46_mapped, uts46_ignored, uts46_disallowed };
+
+/* mapping:       status (bits 0-1), length (bits 2-6), then a signed delta for single code points  */
+/*                or an offset into uts46_mappings (bits 7-31)                                      */
+/* decomposition: length (bits 0-2), then an offset into uts46_decompositions (bits 3-15)          */
+typedef struct {
+  uint32_t mapping;
+  uint16_t decomposition;
+  uint8_t combining_class;
+} uts46_property;
+
+#define UTS46_SHIFT 7
+
+static const uint16_t uts46_stage1[8704] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B,
+  0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023,
+  0x0024, 0x0025, 0x0026, 0x0027, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0028, 0x0029, 0x002A,
+  0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+  0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0023,
+  0x0042, 0x0043, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0058, 0x0023, 0x0023, 0x0059, 0x005A, 0x005B, 0x005C,
+  0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0065,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C,
+  0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+  0x0066, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0023, 0x0023, 0x0080, 0x0081,
+  0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0066,
+  0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0066,
+  0x0098, 0x0099, 0x0066, 0x009A, 0x009B, 0x009C, 0x009D, 0x0066, 0x009E, 0x009F, 0x00A0, 0x00A1,
+  0x00A2, 0x00A3, 0x00A4, 0x0066, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x0066, 0x00A9, 0x00AA, 0x00AB,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x00AC, 0x00AD, 0x0023, 0x00AE, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x00AF, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x00B0, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x00B1, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x00BA, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x00BB, 0x00BC, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x00BD,
+  0x0023, 0x0023, 0x00BE, 0x0023, 0x0023, 0x00BF, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x00C0, 0x00C1, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x00C2, 0x00AE, 0x0023, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x0066,
+  0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x00D1, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x00D2, 0x0066,
+  0x00D3, 0x00D4, 0x00D5, 0x0066, 0x0066, 0x00D6, 0x0066, 0x0066, 0x0066, 0x00D7, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x00D8, 0x0023, 0x00D9, 0x00DA, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x00DB, 0x00DC, 0x00DD, 0x0066, 0x00DE, 0x00DF, 0x0066, 0x0066, 0x00E0, 0x00E1, 0x00E2, 0x00E3,
+  0x00E4, 0x0066, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x00E5, 0x00E6, 0x00E7,
+  0x00E8, 0x00E9, 0x0023, 0x0023, 0x00EA, 0x00EB, 0x0023, 0x00EC, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x00ED, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x00EE, 0x0023,
+  0x00EF, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x00F0, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x00F1, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x004C, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x00F2, 0x00F3, 0x00F4, 0x00F5,
+  0x00F6, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x00F7, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x00F8,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x00F9, 0x00FA, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066,
+};
+
+static const uint16_t uts46_stage2[32128] = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0005, 0x0000, 0x0000, 0x0006, 0x0000, 0x0007, 0x0000, 0x0000, 0x0003, 0x0003,
+  0x0008, 0x0009, 0x0000, 0x0000, 0x000A, 0x000B, 0x000C, 0x0000, 0x000D, 0x000E, 0x000F, 0x0000,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0001, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A,
+  0x001B, 0x001C, 0x001D, 0x001E, 0x0001, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0000,
+  0x0001, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x0001, 0x0000, 0x002A, 0x002B, 0x002C, 0x002D,
+  0x002E, 0x002F, 0x0000, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+  0x0000, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x0000, 0x0000, 0x003F, 0x0040, 0x0041,
+  0x0042, 0x0043, 0x0000, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C,
+  0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0000, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x0055, 0x0000, 0x006A, 0x006B, 0x006C, 0x006D,
+  0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0000, 0x0073, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0000, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007E, 0x0055, 0x0000, 0x007F,
+  0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0055, 0x0000, 0x0086, 0x0087, 0x0088, 0x0089,
+  0x008A, 0x008B, 0x0055, 0x0000, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+  0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x0055, 0x0000,
+  0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9,
+  0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5,
+  0x0000, 0x00B6, 0x0055, 0x0000, 0x0055, 0x0000, 0x00B7, 0x0055, 0x0000, 0x00B8, 0x00B8, 0x0055,
+  0x0000, 0x0000, 0x00B9, 0x00BA, 0x00BB, 0x0055, 0x0000, 0x00B8, 0x00BC, 0x0000, 0x00BD, 0x00BE,
+  0x0055, 0x0000, 0x0000, 0x0000, 0x00BD, 0x00BF, 0x0000, 0x00C0, 0x00C1, 0x00C2, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x00C3, 0x0055, 0x0000, 0x00C3, 0x0000, 0x0000, 0x0055, 0x0000, 0x00C3, 0x00C4,
+  0x00C5, 0x00C6, 0x00C6, 0x0055, 0x0000, 0x0055, 0x0000, 0x00C7, 0x0055, 0x0000, 0x0000, 0x0000,
+  0x0055, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C8, 0x00C8, 0x00C8, 0x00C9,
+  0x00C9, 0x00C9, 0x00CA, 0x00CA, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1,
+  0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x0000, 0x00DB, 0x00DC,
+  0x00DD, 0x00DE, 0x00DF, 0x00E0, 0x0055, 0x0000, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6,
+  0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00EC, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F0,
+  0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC,
+  0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108,
+  0x0109, 0x010A, 0x010B, 0x010C, 0x010D, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114,
+  0x0055, 0x0000, 0x0115, 0x0116, 0x0117, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0118, 0x0119,
+  0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0126, 0x0055, 0x0000, 0x0127, 0x0128, 0x0000,
+  0x0000, 0x0055, 0x0000, 0x0129, 0x012A, 0x012B, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x012C, 0x000C, 0x012C, 0x012D, 0x012E, 0x012F, 0x0130, 0x0131,
+  0x0132, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0134, 0x0135, 0x0136,
+  0x0137, 0x0138, 0x0000, 0x0000, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013F, 0x0140, 0x0140,
+  0x0140, 0x0140, 0x013F, 0x0141, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0142, 0x0142, 0x0140,
+  0x0140, 0x0140, 0x0140, 0x0142, 0x0142, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140,
+  0x0140, 0x0140, 0x0140, 0x0140, 0x0143, 0x0143, 0x0143, 0x0143, 0x0143, 0x0140, 0x0140, 0x0140,
+  0x0140, 0x013E, 0x013E, 0x013E, 0x0144, 0x0145, 0x013E, 0x0146, 0x0147, 0x0148, 0x013E, 0x0140,
+  0x0140, 0x0140, 0x013E, 0x013E, 0x013E, 0x0140, 0x0140, 0x0006, 0x013E, 0x013E, 0x013E, 0x0140,
+  0x0140, 0x0140, 0x0140, 0x013E, 0x013F, 0x0140, 0x0140, 0x013E, 0x0149, 0x014A, 0x014A, 0x0149,
+  0x014A, 0x014A, 0x0149, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x0055, 0x0000, 0x0055, 0x0000, 0x014B, 0x0000, 0x0055, 0x0000,
+  0x0002, 0x0002, 0x014C, 0x0000, 0x0000, 0x0000, 0x014D, 0x014E, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0008, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x0002, 0x0155, 0x0002, 0x0156, 0x0157,
+  0x0158, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0159, 0x015A, 0x015B, 0x015C, 0x015D, 0x015E, 0x015F, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0160, 0x0161,
+  0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x0169, 0x016A, 0x016B, 0x016C, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x016D, 0x016E, 0x016F, 0x0000, 0x0170, 0x0171, 0x0000, 0x0055, 0x0000, 0x016D, 0x0055, 0x0000,
+  0x0000, 0x0117, 0x0117, 0x0117, 0x0172, 0x0173, 0x0174, 0x0175, 0x0174, 0x0174, 0x0174, 0x0176,
+  0x0174, 0x0174, 0x0174, 0x0174, 0x0177, 0x0178, 0x0179, 0x0174, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x017A, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x017B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x017C, 0x017D, 0x0000, 0x017E, 0x0000, 0x0000, 0x0000, 0x017F, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0180, 0x0181, 0x0182, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0183, 0x0184, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0000, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0000, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0002, 0x0185, 0x0186, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055,
+  0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0000, 0x0187, 0x0188, 0x0189, 0x018A,
+  0x0055, 0x0000, 0x018B, 0x018C, 0x0055, 0x0000, 0x018D, 0x018E, 0x018F, 0x0190, 0x0191, 0x0192,
+  0x0055, 0x0000, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197, 0x0198, 0x0055, 0x0000, 0x0199, 0x019A,
+  0x019B, 0x019C, 0x019D, 0x019E, 0x019F, 0x01A0, 0x01A1, 0x01A2, 0x01A3, 0x01A4, 0x0055, 0x0000,
+  0x01A5, 0x01A6, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0002, 0x01A7, 0x01A7, 0x01A7,
+  0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7,
+  0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7,
+  0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01A8,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0140, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x0140, 0x013E, 0x013E, 0x013E, 0x01A9, 0x0140, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x013E, 0x013E, 0x0140, 0x013E,
+  0x013E, 0x01A9, 0x01AA, 0x013E, 0x01AB, 0x01AC, 0x01AD, 0x01AE, 0x01AF, 0x01B0, 0x01B1, 0x01B2,
+  0x01B3, 0x01B4, 0x01B4, 0x01B5, 0x01B6, 0x01B7, 0x0000, 0x01B8, 0x0000, 0x01B9, 0x01BA, 0x0000,
+  0x013E, 0x0140, 0x0000, 0x01B3, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x01BB, 0x01BC, 0x01BD, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01BE, 0x01BF,
+  0x01C0, 0x01C1, 0x01C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x01C3, 0x01C4, 0x01C5, 0x01BB, 0x01BC, 0x01BD, 0x01C6, 0x01C7, 0x013E,
+  0x013E, 0x0140, 0x0140, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0140, 0x013E, 0x013E, 0x0140,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C9, 0x01CA, 0x01CB,
+  0x01CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x01CD, 0x0000, 0x01CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01CF, 0x0000, 0x0000, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0000, 0x013E, 0x013E, 0x013E, 0x013E, 0x0140,
+  0x013E, 0x0000, 0x0000, 0x013E, 0x013E, 0x0000, 0x0140, 0x013E, 0x013E, 0x0140, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x01D0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x0140, 0x013E, 0x013E, 0x0140, 0x013E, 0x013E, 0x0140,
+  0x0140, 0x0140, 0x013E, 0x0140, 0x0140, 0x013E, 0x0140, 0x013E, 0x013E, 0x013E, 0x0140, 0x013E,
+  0x0140, 0x013E, 0x0140, 0x013E, 0x0140, 0x013E, 0x013E, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0140, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E, 0x013E, 0x013E, 0x0000, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0000, 0x013E, 0x013E, 0x013E,
+  0x0000, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0140, 0x0140, 0x0140, 0x0002, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x013E, 0x0140, 0x0140, 0x0140, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0140,
+  0x0140, 0x0140, 0x0140, 0x0140, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0140, 0x013E, 0x013E, 0x0140, 0x013E,
+  0x013E, 0x0140, 0x013E, 0x013E, 0x013E, 0x0140, 0x0140, 0x0140, 0x01C3, 0x01C4, 0x01C5, 0x013E,
+  0x013E, 0x013E, 0x0140, 0x013E, 0x013E, 0x0140, 0x0140, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x01D2, 0x0000, 0x0000, 0x01D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x01D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0000, 0x013E, 0x0140, 0x013E,
+  0x013E, 0x0000, 0x0000, 0x0000, 0x01D6, 0x01D7, 0x01D8, 0x01D9, 0x01DA, 0x01DB, 0x01DC, 0x01DD,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x01D4, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x01DE,
+  0x01DF, 0x01D5, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x01E0, 0x01E1, 0x0002, 0x01E2, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x013E, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x01E3, 0x0002, 0x0000, 0x01E4, 0x0002,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x01D4, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x01D5, 0x0002, 0x0002,
+  0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x01E5, 0x01E6, 0x01E7,
+  0x0000, 0x0002, 0x01E8, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x01D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x01D5, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x01D4, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x01E9, 0x0002, 0x0002, 0x01EA,
+  0x01EB, 0x01D5, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x01EC, 0x01ED, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x01EE, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x01EF, 0x01F0, 0x01F1, 0x01D5, 0x0002, 0x0002,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x01D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x01F2, 0x0002, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x01F3, 0x01F4, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x01D4, 0x0000, 0x0000, 0x0000,
+  0x01F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x01F6, 0x01F7, 0x0002, 0x01F8, 0x01F9,
+  0x0000, 0x01D5, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x01D5, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x01FA, 0x01FB, 0x01FC, 0x01D5, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x01D5, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000, 0x01FD, 0x0000, 0x01FE, 0x01FF, 0x0200, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0201,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0202, 0x0202, 0x01D5, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0203, 0x0203, 0x0203, 0x0203,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0205, 0x0205, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0002, 0x0206, 0x0206, 0x0206, 0x0206, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0207, 0x0208, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0209, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0140, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0140, 0x0000, 0x0140, 0x0000, 0x0141, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x020A, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x020B, 0x0000, 0x0000, 0x0000, 0x0000, 0x020C, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x020D, 0x0000, 0x0000, 0x0000, 0x0000, 0x020E, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x020F, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0210, 0x0211, 0x0212, 0x0213, 0x0214, 0x0215, 0x0216,
+  0x0217, 0x0218, 0x0211, 0x0211, 0x0211, 0x0211, 0x0000, 0x0000, 0x0211, 0x0219, 0x013E, 0x013E,
+  0x01D5, 0x0000, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x021A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x021B, 0x0000, 0x0000, 0x0000, 0x0000, 0x021C, 0x0000, 0x0000, 0x0000, 0x0000, 0x021D,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x021E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x021F, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D4,
+  0x0000, 0x01D5, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0221,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0221, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x013E, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x01D5, 0x01D5, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0006, 0x0002, 0x0006,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01AA, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01A9, 0x013E, 0x0140,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x013E, 0x0140, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0002, 0x0140,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x013E,
+  0x013E, 0x0140, 0x0000, 0x0140, 0x0140, 0x013E, 0x013E, 0x0140, 0x0140, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x0140, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0224, 0x0000, 0x0225, 0x0000, 0x0226, 0x0000, 0x0227, 0x0000, 0x0228, 0x0000,
+  0x0000, 0x0000, 0x0229, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x01D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022A, 0x0000, 0x022B, 0x0000, 0x0000,
+  0x022C, 0x022D, 0x0000, 0x022E, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x0140, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x01D5,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D4, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x01D5,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D4, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022F, 0x0230, 0x0231, 0x0232,
+  0x0232, 0x0233, 0x0234, 0x0235, 0x0236, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237,
+  0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237,
+  0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237,
+  0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0002, 0x0002, 0x0237, 0x0237, 0x0237,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x013E, 0x013E, 0x013E, 0x0000, 0x0143, 0x0140, 0x0140, 0x0140,
+  0x0140, 0x0140, 0x013E, 0x013E, 0x0140, 0x0140, 0x0140, 0x0140, 0x013E, 0x0000, 0x0143, 0x0143,
+  0x0143, 0x0143, 0x0143, 0x0143, 0x0143, 0x0000, 0x0000, 0x0000, 0x0000, 0x0140, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0238, 0x0239, 0x023A, 0x0000, 0x023A, 0x023A, 0x023B, 0x023A, 0x023A, 0x023A, 0x023A, 0x023A,
+  0x023A, 0x023A, 0x023A, 0x0000, 0x023C, 0x023D, 0x023E, 0x023C, 0x023A, 0x023A, 0x0238, 0x023F,
+  0x0240, 0x0240, 0x0241, 0x0242, 0x0243, 0x0243, 0x0244, 0x0245, 0x0245, 0x0246, 0x0000, 0x0243,
+  0x0247, 0x0248, 0x0247, 0x0249, 0x024A, 0x024A, 0x0246, 0x0247, 0x0247, 0x0170, 0x024B, 0x0242,
+  0x024C, 0x024D, 0x024D, 0x024D, 0x024E, 0x024E, 0x024F, 0x0250, 0x0251, 0x0251, 0x0252, 0x0252,
+  0x0253, 0x0254, 0x0254, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0255, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+  0x025F, 0x025F, 0x025F, 0x0260, 0x0261, 0x025F, 0x0262, 0x0263, 0x0264, 0x0265, 0x025F, 0x025F,
+  0x025F, 0x025F, 0x0266, 0x0267, 0x0267, 0x0268, 0x0269, 0x0269, 0x026A, 0x026B, 0x026B, 0x026C,
+  0x026D, 0x026D, 0x026D, 0x026E, 0x013E, 0x013E, 0x0140, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x0140, 0x013E, 0x013E, 0x014A, 0x026F, 0x0140, 0x0142, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013F, 0x01AA,
+  0x01AA, 0x0140, 0x0270, 0x013E, 0x0149, 0x0140, 0x013E, 0x0140, 0x0271, 0x0272, 0x0273, 0x0274,
+  0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280,
+  0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0x028B, 0x028C,
+  0x028D, 0x028E, 0x028F, 0x0290, 0x0291, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297, 0x0298,
+  0x0299, 0x029A, 0x029B, 0x029C, 0x029D, 0x029E, 0x029F, 0x02A0, 0x02A1, 0x02A2, 0x02A3, 0x02A4,
+  0x02A5, 0x02A6, 0x02A7, 0x02A8, 0x02A9, 0x02AA, 0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02AF, 0x02B0,
+  0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC,
+  0x02BD, 0x02BE, 0x02BF, 0x02C0, 0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8,
+  0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0, 0x02D1, 0x02D2, 0x02D3, 0x02D4,
+  0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+  0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC,
+  0x02ED, 0x02EE, 0x02EF, 0x02F0, 0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8,
+  0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300, 0x0301, 0x0302, 0x0303, 0x0304,
+  0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x0000, 0x0000, 0x030D, 0x0000,
+  0x030E, 0x030F, 0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317, 0x0318, 0x0319,
+  0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F, 0x0320, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325,
+  0x0326, 0x0327, 0x0328, 0x0329, 0x032A, 0x032B, 0x032C, 0x032D, 0x032E, 0x032F, 0x0330, 0x0331,
+  0x0332, 0x0333, 0x0334, 0x0335, 0x0336, 0x0337, 0x0338, 0x0339, 0x033A, 0x033B, 0x033C, 0x033D,
+  0x033E, 0x033F, 0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0346, 0x0347, 0x0348, 0x0349,
+  0x034A, 0x034B, 0x034C, 0x034D, 0x034E, 0x034F, 0x0350, 0x0351, 0x0352, 0x0353, 0x0354, 0x0355,
+  0x0356, 0x0357, 0x0358, 0x0359, 0x035A, 0x035B, 0x035C, 0x035D, 0x035E, 0x035F, 0x0360, 0x0361,
+  0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0368, 0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F, 0x0370, 0x0371, 0x0372, 0x0373,
+  0x0374, 0x0375, 0x0376, 0x0377, 0x0378, 0x0379, 0x037A, 0x037B, 0x037C, 0x037D, 0x0002, 0x0002,
+  0x037E, 0x037F, 0x0380, 0x0381, 0x0382, 0x0383, 0x0002, 0x0002, 0x0384, 0x0385, 0x0386, 0x0387,
+  0x0388, 0x0389, 0x038A, 0x038B, 0x038C, 0x038D, 0x038E, 0x038F, 0x0390, 0x0391, 0x0392, 0x0393,
+  0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+  0x03A0, 0x03A1, 0x03A2, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x0002, 0x0002,
+  0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x0002, 0x0002, 0x03B0, 0x03B1, 0x03B2, 0x03B3,
+  0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x0002, 0x03B8, 0x0002, 0x03B9, 0x0002, 0x03BA, 0x0002, 0x03BB,
+  0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+  0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x03CF, 0x03D0, 0x03D1, 0x03D2, 0x03D3,
+  0x03D4, 0x03D5, 0x03D6, 0x03D7, 0x03D8, 0x03D9, 0x0002, 0x0002, 0x03DA, 0x03DB, 0x03DC, 0x03DD,
+  0x03DE, 0x03DF, 0x03E0, 0x03E1, 0x03E2, 0x03E3, 0x03E4, 0x03E5, 0x03E6, 0x03E7, 0x03E8, 0x03E9,
+  0x03EA, 0x03EB, 0x03EC, 0x03ED, 0x03EE, 0x03EF, 0x03F0, 0x03F1, 0x03F2, 0x03F3, 0x03F4, 0x03F5,
+  0x03F6, 0x03F7, 0x03F8, 0x03F9, 0x03FA, 0x03FB, 0x03FC, 0x03FD, 0x03FE, 0x03FF, 0x0400, 0x0401,
+  0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x040D,
+  0x040E, 0x0002, 0x040F, 0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0416,
+  0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x0002, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421, 0x0422,
+  0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x0002, 0x0002, 0x042B, 0x042C,
+  0x042D, 0x042E, 0x042F, 0x0430, 0x0002, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+  0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x014F, 0x0442,
+  0x0002, 0x0002, 0x0443, 0x0444, 0x0445, 0x0002, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B,
+  0x044C, 0x044D, 0x044E, 0x0002, 0x044F, 0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456,
+  0x0457, 0x0458, 0x0459, 0x0006, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0209, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x045A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x045B, 0x0000, 0x0000, 0x0000, 0x045C, 0x045D, 0x0000, 0x045E, 0x045F,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0460, 0x0000, 0x0461, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0462, 0x0463, 0x0464, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0465, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0466, 0x0006, 0x0002, 0x0002, 0x0002, 0x0006, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0467, 0x0468, 0x0002, 0x0002,
+  0x0467, 0x0467, 0x0467, 0x0467, 0x0467, 0x0467, 0x0469, 0x046A, 0x0466, 0x046B, 0x046B, 0x046C,
+  0x046D, 0x046D, 0x046D, 0x046D, 0x046D, 0x046D, 0x046D, 0x046D, 0x046D, 0x046D, 0x046E, 0x046F,
+  0x0469, 0x0470, 0x0470, 0x0002, 0x0471, 0x0472, 0x0473, 0x0474, 0x0475, 0x0476, 0x0477, 0x0477,
+  0x0477, 0x0477, 0x0478, 0x0479, 0x0479, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x047A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x013E, 0x013E, 0x0143, 0x0143,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x0143, 0x0143, 0x0143, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x013E, 0x0000, 0x0000, 0x0000, 0x0143, 0x0143, 0x013E, 0x0140, 0x013E, 0x0143, 0x0143,
+  0x0140, 0x0140, 0x0140, 0x0140, 0x013E, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x047B, 0x047C, 0x047D, 0x047E,
+  0x0000, 0x047F, 0x0480, 0x0481, 0x0000, 0x0482, 0x0483, 0x0483, 0x0484, 0x0485, 0x0486, 0x0457,
+  0x0487, 0x0488, 0x0486, 0x0487, 0x0000, 0x0487, 0x0489, 0x0000, 0x0000, 0x048A, 0x048A, 0x048A,
+  0x048B, 0x048C, 0x0000, 0x0000, 0x048D, 0x048E, 0x048F, 0x0000, 0x048B, 0x0000, 0x0490, 0x0000,
+  0x0491, 0x0000, 0x0492, 0x0493, 0x0494, 0x0494, 0x0000, 0x0494, 0x0495, 0x0495, 0x0002, 0x0496,
+  0x0497, 0x0498, 0x0498, 0x0498, 0x0498, 0x0499, 0x0000, 0x049A, 0x049B, 0x049C, 0x049D, 0x049E,
+  0x00BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x049F, 0x04A0, 0x04A0, 0x04A1, 0x04A1, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x04A2, 0x04A3, 0x04A4, 0x04A5, 0x04A6, 0x04A7, 0x04A8, 0x04A9,
+  0x04AA, 0x04AB, 0x04AC, 0x04AD, 0x04AE, 0x04AF, 0x04B0, 0x04B1, 0x04B2, 0x04B3, 0x04B4, 0x04B5,
+  0x04B6, 0x04B7, 0x04B8, 0x04B9, 0x04BA, 0x04BB, 0x04BC, 0x04BD, 0x04BE, 0x04BF, 0x04BF, 0x04C0,
+  0x04C1, 0x04B3, 0x04B4, 0x04B5, 0x04C2, 0x04B7, 0x04B8, 0x04B9, 0x04BA, 0x04C3, 0x04BC, 0x04BD,
+  0x04C4, 0x04C5, 0x04C5, 0x04C6, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x04C7, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04C8, 0x04C9, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x04CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04CB, 0x04CC, 0x04CD,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x04CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x04CF, 0x0000, 0x0000,
+  0x04D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x04D1, 0x0000, 0x04D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D3, 0x04D4, 0x0000, 0x04D5,
+  0x04D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D7, 0x0000, 0x0000, 0x04D8, 0x0000, 0x0000, 0x04D9,
+  0x0000, 0x04DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x04DB, 0x0000, 0x04DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x04DD, 0x04DE, 0x04DF, 0x04E0, 0x04E1, 0x0000, 0x0000, 0x04E2, 0x04E3, 0x0000, 0x0000,
+  0x04E4, 0x04E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04E6, 0x04E7, 0x0000, 0x0000,
+  0x04E8, 0x04E9, 0x0000, 0x0000, 0x04EA, 0x04EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x04EC, 0x04ED, 0x04EE, 0x04EF, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04F0, 0x04F1, 0x04F2, 0x04F3,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04F4, 0x04F5, 0x04F6, 0x04F7, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04F8, 0x04F9, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FB, 0x04FC, 0x04FD,
+  0x04FE, 0x04FF, 0x0500, 0x0501, 0x0502, 0x0503, 0x0504, 0x0505, 0x0506, 0x0507, 0x0508, 0x0509,
+  0x050A, 0x050B, 0x050C, 0x050D, 0x050E, 0x050F, 0x0510, 0x0511, 0x0512, 0x0513, 0x0514, 0x0515,
+  0x0516, 0x0517, 0x0518, 0x0519, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x051A, 0x051B, 0x051C, 0x051D, 0x051E, 0x051F, 0x0520, 0x0521, 0x0522, 0x0523, 0x0524, 0x0525,
+  0x0526, 0x0527, 0x0528, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D, 0x052E, 0x052F, 0x0530, 0x0531,
+  0x0532, 0x0533, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534,
+  0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534, 0x0534,
+  0x0534, 0x0534, 0x0534, 0x0534, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535,
+  0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535,
+  0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0535, 0x0536, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0537, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0538, 0x0539, 0x053A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x053B, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7,
+  0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7,
+  0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7,
+  0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0055, 0x0000, 0x053C, 0x053D, 0x053E, 0x0000, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055,
+  0x0000, 0x053F, 0x0540, 0x0541, 0x0542, 0x0000, 0x0055, 0x0000, 0x0000, 0x0055, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0543, 0x0544, 0x0545, 0x0545, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x013E,
+  0x013E, 0x013E, 0x0055, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0546, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x01D5,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0547,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0548,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x054E, 0x054F, 0x0550, 0x0551, 0x0552, 0x0553, 0x0554,
+  0x0555, 0x0556, 0x0557, 0x0558, 0x0559, 0x055A, 0x055B, 0x055C, 0x055D, 0x055E, 0x055F, 0x0560,
+  0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569, 0x056A, 0x056B, 0x056C,
+  0x056D, 0x056E, 0x056F, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578,
+  0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584,
+  0x0585, 0x0586, 0x0587, 0x0588, 0x0589, 0x058A, 0x058B, 0x058C, 0x058D, 0x058E, 0x058F, 0x0590,
+  0x0591, 0x0592, 0x0593, 0x0594, 0x0595, 0x0596, 0x0597, 0x0598, 0x0599, 0x059A, 0x059B, 0x059C,
+  0x059D, 0x059E, 0x059F, 0x05A0, 0x05A1, 0x05A2, 0x05A3, 0x05A4, 0x05A5, 0x05A6, 0x05A7, 0x05A8,
+  0x05A9, 0x05AA, 0x05AB, 0x05AC, 0x05AD, 0x05AE, 0x05AF, 0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4,
+  0x05B5, 0x05B6, 0x05B7, 0x05B8, 0x05B9, 0x05BA, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF, 0x05C0,
+  0x05C1, 0x05C2, 0x05C3, 0x05C4, 0x05C5, 0x05C6, 0x05C7, 0x05C8, 0x05C9, 0x05CA, 0x05CB, 0x05CC,
+  0x05CD, 0x05CE, 0x05CF, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8,
+  0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, 0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4,
+  0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x05EB, 0x05EC, 0x05ED, 0x05EE, 0x05EF, 0x05F0,
+  0x05F1, 0x05F2, 0x05F3, 0x05F4, 0x05F5, 0x05F6, 0x05F7, 0x05F8, 0x05F9, 0x05FA, 0x05FB, 0x05FC,
+  0x05FD, 0x05FE, 0x05FF, 0x0600, 0x0601, 0x0602, 0x0603, 0x0604, 0x0605, 0x0606, 0x0607, 0x0608,
+  0x0609, 0x060A, 0x060B, 0x060C, 0x060D, 0x060E, 0x060F, 0x0610, 0x0611, 0x0612, 0x0613, 0x0614,
+  0x0615, 0x0616, 0x0617, 0x0618, 0x0619, 0x061A, 0x061B, 0x061C, 0x061D, 0x061E, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x061F, 0x0000, 0x0620, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0270, 0x01AA,
+  0x013F, 0x01A9, 0x0621, 0x0621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0622, 0x0000,
+  0x0623, 0x0624, 0x0624, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0625, 0x0000, 0x0626, 0x0000,
+  0x0627, 0x0000, 0x0628, 0x0000, 0x0629, 0x0000, 0x062A, 0x0000, 0x062B, 0x0000, 0x062C, 0x0000,
+  0x062D, 0x0000, 0x062E, 0x0000, 0x062F, 0x0000, 0x0630, 0x0000, 0x0000, 0x0631, 0x0000, 0x0632,
+  0x0000, 0x0633, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0634, 0x0635, 0x0000, 0x0636,
+  0x0637, 0x0000, 0x0638, 0x0639, 0x0000, 0x063A, 0x063B, 0x0000, 0x063C, 0x063D, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x063E, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x063F, 0x063F, 0x0640, 0x0641, 0x0000, 0x0642, 0x0643, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0644, 0x0000, 0x0645, 0x0000,
+  0x0646, 0x0000, 0x0647, 0x0000, 0x0648, 0x0000, 0x0649, 0x0000, 0x064A, 0x0000, 0x064B, 0x0000,
+  0x064C, 0x0000, 0x064D, 0x0000, 0x064E, 0x0000, 0x064F, 0x0000, 0x0000, 0x0650, 0x0000, 0x0651,
+  0x0000, 0x0652, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0653, 0x0654, 0x0000, 0x0655,
+  0x0656, 0x0000, 0x0657, 0x0658, 0x0000, 0x0659, 0x065A, 0x0000, 0x065B, 0x065C, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x065D, 0x0000, 0x0000, 0x065E,
+  0x065F, 0x0660, 0x0661, 0x0000, 0x0000, 0x0000, 0x0662, 0x0663, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0664, 0x0664, 0x0665,
+  0x0666, 0x0665, 0x0665, 0x0667, 0x0667, 0x0667, 0x0668, 0x0668, 0x0668, 0x0668, 0x0668, 0x0668,
+  0x0669, 0x066A, 0x066A, 0x066A, 0x0473, 0x066B, 0x066B, 0x066B, 0x066B, 0x066B, 0x066B, 0x066B,
+  0x066B, 0x066B, 0x066B, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C,
+  0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C, 0x066C,
+  0x0002, 0x066D, 0x066D, 0x066E, 0x066E, 0x066F, 0x0670, 0x0671, 0x0672, 0x0673, 0x0674, 0x0675,
+  0x0676, 0x0677, 0x0677, 0x0678, 0x0674, 0x0674, 0x0469, 0x0679, 0x067A, 0x067A, 0x067A, 0x067A,
+  0x067A, 0x067B, 0x067C, 0x0466, 0x067D, 0x067E, 0x0676, 0x0676, 0x0476, 0x0476, 0x0476, 0x067F,
+  0x067F, 0x0680, 0x0681, 0x0681, 0x0682, 0x0683, 0x0684, 0x0002, 0x0000, 0x0000, 0x0685, 0x0686,
+  0x0687, 0x0688, 0x0689, 0x068A, 0x068B, 0x068C, 0x068D, 0x068E, 0x068F, 0x0690, 0x0691, 0x0692,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0693, 0x0694, 0x0695, 0x0696, 0x0697, 0x0698, 0x0699, 0x069A, 0x069B, 0x069C, 0x069D, 0x069E,
+  0x069F, 0x06A0, 0x06A1, 0x06A2, 0x06A3, 0x06A4, 0x06A5, 0x06A6, 0x06A7, 0x06A8, 0x06A9, 0x06AA,
+  0x06AB, 0x06AC, 0x06AD, 0x06AE, 0x06AF, 0x06B0, 0x06B1, 0x0002, 0x06B2, 0x06B3, 0x06B4, 0x06B5,
+  0x06B6, 0x06B7, 0x06B8, 0x06B9, 0x06BA, 0x06BB, 0x06BC, 0x06BD, 0x06BE, 0x06BF, 0x06C0, 0x06C1,
+  0x06C2, 0x06C3, 0x06C4, 0x06C5, 0x06C6, 0x06C7, 0x06C8, 0x06C9, 0x06CA, 0x06CB, 0x06CC, 0x06CD,
+  0x06CE, 0x06CF, 0x06D0, 0x06D1, 0x06D2, 0x06D3, 0x06D4, 0x06D5, 0x0624, 0x06D6, 0x06D7, 0x06D8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06D9, 0x06DA, 0x06DB, 0x06DC,
+  0x06DD, 0x06DE, 0x06DF, 0x06E0, 0x06E1, 0x06E2, 0x06E3, 0x06E4, 0x06E5, 0x06E6, 0x06E7, 0x06E8,
+  0x06E9, 0x06EA, 0x06EA, 0x06EB, 0x06EB, 0x06EB, 0x06EC, 0x06ED, 0x06ED, 0x06EE, 0x06EE, 0x06EE,
+  0x06EE, 0x06EE, 0x06EF, 0x06F0, 0x06F1, 0x06F2, 0x06F3, 0x06F4, 0x06F5, 0x06F6, 0x06F7, 0x06F8,
+  0x06F9, 0x06FA, 0x06FB, 0x06FC, 0x06FD, 0x06FE, 0x06FF, 0x0000, 0x0700, 0x0701, 0x0702, 0x0703,
+  0x0704, 0x0705, 0x0706, 0x0707, 0x0708, 0x0709, 0x070A, 0x070B, 0x070C, 0x070D, 0x070E, 0x070F,
+  0x0710, 0x0711, 0x0712, 0x0713, 0x0714, 0x0715, 0x0716, 0x0717, 0x0718, 0x0719, 0x071A, 0x071B,
+  0x071C, 0x071D, 0x071E, 0x071F, 0x0720, 0x0721, 0x0722, 0x0723, 0x0724, 0x0725, 0x0726, 0x0727,
+  0x0728, 0x0729, 0x072A, 0x072B, 0x072C, 0x072D, 0x072E, 0x072F, 0x0730, 0x0731, 0x0732, 0x0733,
+  0x0734, 0x0735, 0x0736, 0x0737, 0x0738, 0x0739, 0x073A, 0x073B, 0x073C, 0x073D, 0x073E, 0x073F,
+  0x0740, 0x0741, 0x0742, 0x0743, 0x0744, 0x0745, 0x0746, 0x0747, 0x0748, 0x0749, 0x074A, 0x074B,
+  0x074C, 0x074D, 0x074E, 0x074F, 0x0750, 0x0751, 0x0752, 0x0753, 0x0754, 0x0754, 0x0755, 0x0756,
+  0x0757, 0x0758, 0x0759, 0x075A, 0x075B, 0x075C, 0x075D, 0x075E, 0x075F, 0x0760, 0x0761, 0x0762,
+  0x0763, 0x0763, 0x0763, 0x0763, 0x0763, 0x0763, 0x0764, 0x0765, 0x0766, 0x0767, 0x0768, 0x0768,
+  0x0768, 0x0768, 0x0768, 0x0769, 0x076A, 0x076B, 0x076B, 0x076B, 0x076B, 0x076B, 0x076B, 0x076C,
+  0x076C, 0x076C, 0x076C, 0x076D, 0x076E, 0x076F, 0x0770, 0x0771, 0x0772, 0x0773, 0x0774, 0x0775,
+  0x0776, 0x0777, 0x0778, 0x0779, 0x077A, 0x077B, 0x077C, 0x077D, 0x077E, 0x077F, 0x0780, 0x0781,
+  0x0782, 0x0783, 0x0784, 0x0785, 0x0786, 0x0787, 0x0788, 0x0789, 0x078A, 0x078B, 0x078C, 0x078D,
+  0x078E, 0x078F, 0x0790, 0x0791, 0x0792, 0x0793, 0x0794, 0x0795, 0x0796, 0x0797, 0x0798, 0x0799,
+  0x079A, 0x079B, 0x079C, 0x079D, 0x079E, 0x079F, 0x07A0, 0x07A1, 0x07A2, 0x07A3, 0x07A4, 0x07A5,
+  0x07A6, 0x07A7, 0x07A8, 0x07A9, 0x07AA, 0x07AB, 0x07AC, 0x07AD, 0x07AE, 0x07AF, 0x07B0, 0x07B1,
+  0x07B2, 0x07B3, 0x07B4, 0x07B5, 0x07B6, 0x07B7, 0x07B8, 0x07B9, 0x07BA, 0x07BB, 0x07BC, 0x07BD,
+  0x07BE, 0x07BF, 0x07C0, 0x07C1, 0x07C2, 0x07C3, 0x07C4, 0x07C5, 0x07C6, 0x07C7, 0x07C8, 0x07C9,
+  0x07CA, 0x07CB, 0x07CC, 0x07CD, 0x07CE, 0x07CF, 0x07D0, 0x07D1, 0x07D2, 0x07D3, 0x07D4, 0x07D5,
+  0x07D6, 0x07D7, 0x07D8, 0x07D9, 0x07DA, 0x07DB, 0x07DC, 0x07DD, 0x07DE, 0x07DF, 0x07E0, 0x07E1,
+  0x07E2, 0x07E3, 0x07E4, 0x07E5, 0x07E6, 0x07E7, 0x07E8, 0x07E9, 0x07EA, 0x07EB, 0x07EC, 0x07ED,
+  0x07EE, 0x07EF, 0x07F0, 0x07F1, 0x07F2, 0x07F3, 0x07F4, 0x07F5, 0x07F6, 0x07F7, 0x07F8, 0x07F9,
+  0x07FA, 0x07FB, 0x07FC, 0x07FD, 0x07FE, 0x07FF, 0x0800, 0x0801, 0x0802, 0x0803, 0x0804, 0x0805,
+  0x0806, 0x0807, 0x0808, 0x0809, 0x080A, 0x080B, 0x080C, 0x080D, 0x080E, 0x080F, 0x0810, 0x0811,
+  0x0812, 0x0813, 0x0814, 0x0815, 0x0816, 0x07EE, 0x0817, 0x0818, 0x0819, 0x081A, 0x081B, 0x081C,
+  0x081D, 0x081E, 0x081F, 0x0820, 0x0821, 0x0822, 0x0823, 0x0824, 0x0825, 0x0824, 0x0826, 0x0827,
+  0x0828, 0x0829, 0x082A, 0x0829, 0x082B, 0x082C, 0x0002, 0x082D, 0x082E, 0x082F, 0x0830, 0x0002,
+  0x0831, 0x0832, 0x0833, 0x0834, 0x0835, 0x0836, 0x080C, 0x0837, 0x0838, 0x0839, 0x083A, 0x083B,
+  0x07F4, 0x083C, 0x083D, 0x083E, 0x0002, 0x083F, 0x0840, 0x0841, 0x0842, 0x0843, 0x0844, 0x0845,
+  0x0846, 0x0847, 0x0848, 0x0849, 0x084A, 0x084B, 0x084C, 0x084D, 0x084E, 0x084F, 0x0850, 0x0851,
+  0x0852, 0x0853, 0x0854, 0x0855, 0x0856, 0x0857, 0x0858, 0x0859, 0x085A, 0x085B, 0x085C, 0x085D,
+  0x085E, 0x085F, 0x0860, 0x0861, 0x0862, 0x0863, 0x0864, 0x0865, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0000, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0000, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0866, 0x0867, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0000, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0209, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0055, 0x0000, 0x0055,
+  0x0000, 0x0868, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0055, 0x0000, 0x0869, 0x0000, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0000, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x086A, 0x086B,
+  0x086C, 0x086D, 0x086A, 0x0000, 0x086E, 0x086F, 0x0870, 0x0871, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000,
+  0x016E, 0x0872, 0x0873, 0x0055, 0x0000, 0x0055, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0055, 0x0000, 0x0002, 0x0000, 0x0002, 0x0000, 0x0055, 0x0000, 0x0055, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0874, 0x0875,
+  0x0876, 0x0055, 0x0000, 0x0000, 0x0877, 0x0878, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0140,
+  0x0140, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x01D5, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x01D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x0000, 0x013E, 0x013E, 0x0140, 0x0000, 0x0000, 0x013E,
+  0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E, 0x0000, 0x013E, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x01D5, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0879, 0x087A, 0x087B, 0x0168,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x087C, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D,
+  0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D,
+  0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D,
+  0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D,
+  0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D,
+  0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D,
+  0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D, 0x087D,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x087E, 0x087F, 0x0880, 0x0881,
+  0x0882, 0x0883, 0x0884, 0x0885, 0x0886, 0x0887, 0x0888, 0x0889, 0x088A, 0x088B, 0x088C, 0x088D,
+  0x088E, 0x088F, 0x0890, 0x0891, 0x0892, 0x0893, 0x0894, 0x0895, 0x0896, 0x0897, 0x0898, 0x0899,
+  0x089A, 0x089B, 0x089C, 0x089D, 0x089E, 0x089F, 0x08A0, 0x08A1, 0x08A2, 0x08A3, 0x08A4, 0x08A5,
+  0x08A6, 0x08A7, 0x08A8, 0x08A9, 0x08AA, 0x08AB, 0x08AC, 0x08AD, 0x08AE, 0x08AF, 0x08B0, 0x08B1,
+  0x08B2, 0x08B3, 0x08B4, 0x08B5, 0x08B6, 0x08B7, 0x08B8, 0x08B9, 0x08BA, 0x08BB, 0x08BC, 0x08BD,
+  0x08BE, 0x08BF, 0x08C0, 0x08C1, 0x08C2, 0x08C3, 0x08C4, 0x08C5, 0x08C6, 0x08C7, 0x08C8, 0x08C9,
+  0x08CA, 0x08CB, 0x08CC, 0x08CD, 0x08CE, 0x08CF, 0x08D0, 0x08D1, 0x08D2, 0x08D3, 0x08D4, 0x08D5,
+  0x08D6, 0x08D7, 0x08D8, 0x08D9, 0x08DA, 0x08DB, 0x08DC, 0x08DD, 0x08DE, 0x08DF, 0x08E0, 0x08E1,
+  0x08E2, 0x08E3, 0x08E4, 0x08E5, 0x08E6, 0x08E7, 0x08E8, 0x08E9, 0x08EA, 0x08EB, 0x08EC, 0x08ED,
+  0x08EE, 0x08EF, 0x08F0, 0x08F1, 0x08F2, 0x08F3, 0x08F4, 0x08F5, 0x08F6, 0x08F7, 0x08F8, 0x08F9,
+  0x08FA, 0x08FB, 0x08FC, 0x08FD, 0x08FE, 0x08FF, 0x0900, 0x0901, 0x0902, 0x0903, 0x0904, 0x0905,
+  0x0906, 0x0907, 0x0908, 0x0909, 0x090A, 0x090B, 0x090C, 0x090D, 0x090E, 0x090F, 0x0910, 0x0911,
+  0x0912, 0x0913, 0x0914, 0x0915, 0x0916, 0x0917, 0x0918, 0x0919, 0x091A, 0x091B, 0x091C, 0x091D,
+  0x091E, 0x091F, 0x0920, 0x0921, 0x0922, 0x0923, 0x0924, 0x0925, 0x0926, 0x0927, 0x0928, 0x0929,
+  0x092A, 0x092B, 0x092C, 0x092D, 0x092E, 0x092F, 0x0930, 0x0931, 0x0932, 0x0933, 0x0934, 0x0935,
+  0x0936, 0x0937, 0x0938, 0x0939, 0x093A, 0x093B, 0x093C, 0x093D, 0x093E, 0x093F, 0x0940, 0x0941,
+  0x0942, 0x0943, 0x0944, 0x0945, 0x0946, 0x0947, 0x0948, 0x0949, 0x094A, 0x094B, 0x094C, 0x094D,
+  0x094E, 0x094F, 0x0950, 0x0951, 0x0952, 0x0953, 0x0954, 0x0955, 0x0956, 0x0957, 0x0958, 0x0959,
+  0x095A, 0x095B, 0x095C, 0x095D, 0x095E, 0x095F, 0x0960, 0x0961, 0x0962, 0x0963, 0x0964, 0x0965,
+  0x0966, 0x0967, 0x0968, 0x0969, 0x096A, 0x096B, 0x096C, 0x096D, 0x096E, 0x096F, 0x0970, 0x0971,
+  0x0972, 0x0973, 0x0974, 0x0975, 0x0976, 0x0977, 0x0978, 0x0979, 0x097A, 0x097B, 0x097C, 0x097D,
+  0x097E, 0x097F, 0x0980, 0x0981, 0x0982, 0x0983, 0x0984, 0x0985, 0x0986, 0x0987, 0x0988, 0x0989,
+  0x098A, 0x098B, 0x0000, 0x0000, 0x098C, 0x0000, 0x098D, 0x0000, 0x0000, 0x098E, 0x098F, 0x0990,
+  0x0991, 0x0992, 0x0993, 0x0994, 0x0995, 0x0996, 0x0997, 0x0000, 0x0998, 0x0000, 0x0999, 0x0000,
+  0x0000, 0x099A, 0x099B, 0x0000, 0x0000, 0x0000, 0x099C, 0x099D, 0x099E, 0x099F, 0x09A0, 0x09A1,
+  0x09A2, 0x09A3, 0x09A4, 0x09A5, 0x09A6, 0x09A7, 0x09A8, 0x09A9, 0x09AA, 0x09AB, 0x09AC, 0x09AD,
+  0x09AE, 0x09AF, 0x09B0, 0x09B1, 0x09B2, 0x09B3, 0x09B4, 0x09B5, 0x09B6, 0x09B7, 0x09B8, 0x09B9,
+  0x09BA, 0x09BB, 0x09BC, 0x09BD, 0x09BE, 0x09BF, 0x09C0, 0x09C1, 0x09C2, 0x09C3, 0x09C4, 0x09C5,
+  0x09C6, 0x09C7, 0x09C8, 0x09C9, 0x09CA, 0x09CB, 0x09CC, 0x09CD, 0x09CE, 0x09CF, 0x09D0, 0x09D1,
+  0x09D2, 0x09D3, 0x09D4, 0x09D5, 0x09D6, 0x09D7, 0x09D8, 0x09D9, 0x09DA, 0x09DB, 0x09DC, 0x09DD,
+  0x09DE, 0x09DF, 0x0002, 0x0002, 0x09E0, 0x09E1, 0x09E2, 0x09E3, 0x09E4, 0x09E5, 0x09E6, 0x09E7,
+  0x09E8, 0x09E9, 0x09EA, 0x09EB, 0x09EC, 0x09ED, 0x09EE, 0x09EF, 0x09F0, 0x09F1, 0x09F2, 0x09F3,
+  0x09F4, 0x09F5, 0x09F6, 0x09F7, 0x09F8, 0x09F9, 0x09FA, 0x09FB, 0x09FC, 0x09FD, 0x09FE, 0x09FF,
+  0x0A00, 0x0A01, 0x0A02, 0x0A03, 0x0A04, 0x0A05, 0x0A06, 0x0A07, 0x0A08, 0x0A09, 0x0A0A, 0x0A0B,
+  0x0A0C, 0x0A0D, 0x0A0E, 0x0A0F, 0x0A10, 0x0A11, 0x0A12, 0x0A13, 0x0A14, 0x0A15, 0x0A16, 0x0A17,
+  0x0A18, 0x0A19, 0x0A1A, 0x0A1B, 0x0A1C, 0x0A1D, 0x0A1E, 0x0A1F, 0x0A20, 0x0A21, 0x0A22, 0x0A23,
+  0x0A24, 0x0A25, 0x0A26, 0x0A27, 0x0A28, 0x0A29, 0x0A2A, 0x0A2B, 0x0A2C, 0x0A2D, 0x0A2E, 0x0A2F,
+  0x0A30, 0x0A31, 0x0A32, 0x0A33, 0x0A34, 0x0A35, 0x0A36, 0x0A37, 0x0A38, 0x0A39, 0x0A3A, 0x0A3B,
+  0x0A3C, 0x0A3D, 0x0A3E, 0x0A3F, 0x0A40, 0x0A41, 0x0A42, 0x0A43, 0x0A44, 0x0A45, 0x0A46, 0x0A47,
+  0x0A48, 0x0A49, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0A4A, 0x0A4B, 0x0A4C, 0x0A4D, 0x0A4E, 0x0A4F, 0x0A4F, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0A50,
+  0x0A51, 0x0A52, 0x0A53, 0x0A54, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0A55, 0x0A56, 0x0A57,
+  0x0A58, 0x0A59, 0x0A5A, 0x0A5A, 0x0A5B, 0x0A5B, 0x0A5B, 0x0A5C, 0x0A58, 0x0A5D, 0x0A5E, 0x0A5F,
+  0x0A60, 0x0A61, 0x0A62, 0x0A63, 0x0A64, 0x0A65, 0x0A66, 0x0A67, 0x0A68, 0x0A69, 0x0A6A, 0x0002,
+  0x0A6B, 0x0A6C, 0x0A6D, 0x0A6E, 0x0A6F, 0x0002, 0x0A70, 0x0002, 0x0A71, 0x0A72, 0x0002, 0x0A73,
+  0x0A74, 0x0002, 0x0A75, 0x0A76, 0x0A77, 0x0A78, 0x0A79, 0x0A7A, 0x0A7B, 0x0A7C, 0x0A7D, 0x0A7E,
+  0x0A7F, 0x0A80, 0x0A81, 0x0A82, 0x0A83, 0x0A84, 0x0A82, 0x0A83, 0x0A84, 0x0A85, 0x0A84, 0x0A85,
+  0x0A86, 0x0A87, 0x0A88, 0x0A89, 0x0A8A, 0x0A8B, 0x0A8C, 0x0A88, 0x0A89, 0x0A8A, 0x0A8D, 0x0A8E,
+  0x0A8F, 0x0A90, 0x0A91, 0x0A92, 0x0A93, 0x0A94, 0x0A93, 0x0A94, 0x0A95, 0x0A96, 0x0A8E, 0x0A8F,
+  0x0A90, 0x0A97, 0x0A98, 0x0A99, 0x0A9A, 0x0A9B, 0x0A99, 0x0A9A, 0x0A9B, 0x0A9C, 0x0A9C, 0x0A9D,
+  0x0A9E, 0x0A9F, 0x0A9A, 0x0A9B, 0x0A9D, 0x0A9E, 0x0A9D, 0x0A9E, 0x0AA0, 0x0AA1, 0x0AA2, 0x0A98,
+  0x0AA3, 0x0AA4, 0x0A89, 0x0A8A, 0x0A8B, 0x0AA5, 0x0A8C, 0x0A88, 0x0A89, 0x0A8A, 0x0A8C, 0x0A88,
+  0x0A89, 0x0A8A, 0x0AA6, 0x0AA7, 0x0AA8, 0x0AA9, 0x0A88, 0x0A89, 0x0A89, 0x0A8A, 0x0A8B, 0x0AA5,
+  0x0A88, 0x0A89, 0x0A89, 0x0A8A, 0x0A8B, 0x0AA5, 0x0AA9, 0x0A8D, 0x0A8E, 0x0A8F, 0x0A86, 0x0A87,
+  0x0A87, 0x0AAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0AAB,
+  0x0AAC, 0x0AAD, 0x0AAE, 0x0AAF, 0x0AB0, 0x0AB1, 0x0AB2, 0x0AB1, 0x0AB2, 0x01CB, 0x0AB1, 0x0AB2,
+  0x0AB3, 0x0AB4, 0x0AB5, 0x0AB6, 0x0AB2, 0x0AB7, 0x0AB8, 0x0AB9, 0x0ABA, 0x0ABB, 0x0ABC, 0x0ABC,
+  0x0ABD, 0x0ABD, 0x0ABE, 0x0ABE, 0x0ABF, 0x0ABF, 0x0AC0, 0x0AC0, 0x0AC1, 0x0AC1, 0x0AC2, 0x0AC2,
+  0x0AC2, 0x0AC3, 0x0AC3, 0x0AC3, 0x0AC4, 0x0AC5, 0x0AC6, 0x0AC7, 0x0AC8, 0x0AC9, 0x0ACA, 0x0AC3,
+  0x0ACB, 0x0ACC, 0x0ACD, 0x0ACE, 0x0ACF, 0x0AD0, 0x0AD1, 0x0AD2, 0x0AD3, 0x0AD4, 0x0AD5, 0x0AD6,
+  0x0AD7, 0x0AD8, 0x0AD9, 0x0ADA, 0x0ADB, 0x0ADC, 0x0ADD, 0x0ADE, 0x0ADF, 0x0AE0, 0x0AE1, 0x0AE2,
+  0x0AE3, 0x0AE4, 0x0AE5, 0x0AE6, 0x0AE7, 0x0AE8, 0x0AE9, 0x0AEA, 0x0AEB, 0x0AEC, 0x0AED, 0x0AEE,
+  0x0AEF, 0x0AF0, 0x0AF1, 0x0AF2, 0x0AF3, 0x0AF4, 0x0AF5, 0x0AF6, 0x0AF7, 0x0AF8, 0x0AF9, 0x0AFA,
+  0x0AFB, 0x0AFC, 0x0AFD, 0x0AFE, 0x0AFF, 0x0B00, 0x0B01, 0x0B02, 0x0B03, 0x0B04, 0x0B05, 0x0B06,
+  0x0B07, 0x0B08, 0x0B09, 0x0B0A, 0x0B0B, 0x0B0C, 0x0B0D, 0x0B0E, 0x0B0F, 0x0B10, 0x0B11, 0x0B12,
+  0x0B13, 0x0B14, 0x0B15, 0x0B16, 0x0B17, 0x0B18, 0x0B19, 0x0B1A, 0x0B1B, 0x0B1C, 0x0B1D, 0x0B1E,
+  0x0B1F, 0x0B20, 0x0B21, 0x0B22, 0x0B23, 0x0B24, 0x0B25, 0x0B26, 0x0B27, 0x0B28, 0x0B29, 0x0B2A,
+  0x0B2B, 0x0B2C, 0x0ACA, 0x0B2D, 0x0AC3, 0x0ACB, 0x0B2E, 0x0B2F, 0x0ACF, 0x0B30, 0x0AD0, 0x0AD1,
+  0x0B31, 0x0B32, 0x0AD5, 0x0B33, 0x0AD6, 0x0AD7, 0x0B34, 0x0B35, 0x0AD9, 0x0B36, 0x0ADA, 0x0ADB,
+  0x0AF8, 0x0AF9, 0x0AFC, 0x0AFD, 0x0AFE, 0x0B02, 0x0B03, 0x0B04, 0x0B05, 0x0B09, 0x0B0A, 0x0B0B,
+  0x0B37, 0x0B0F, 0x0B38, 0x0B39, 0x0B15, 0x0B3A, 0x0B16, 0x0B17, 0x0B24, 0x0B3B, 0x0B3C, 0x0B1F,
+  0x0B3D, 0x0B20, 0x0B21, 0x0AC8, 0x0AC9, 0x0B3E, 0x0ACA, 0x0B3F, 0x0ACC, 0x0ACD, 0x0ACE, 0x0ACF,
+  0x0B40, 0x0AD2, 0x0AD3, 0x0AD4, 0x0AD5, 0x0B41, 0x0AD9, 0x0ADC, 0x0ADD, 0x0ADE, 0x0ADF, 0x0AE0,
+  0x0AE2, 0x0AE3, 0x0AE4, 0x0AE5, 0x0AE6, 0x0AE7, 0x0B42, 0x0AE8, 0x0AE9, 0x0AEA, 0x0AEB, 0x0AEC,
+  0x0AED, 0x0AEF, 0x0AF0, 0x0AF1, 0x0AF2, 0x0AF3, 0x0AF4, 0x0AF5, 0x0AF6, 0x0AF7, 0x0AFA, 0x0AFB,
+  0x0AFF, 0x0B00, 0x0B01, 0x0B02, 0x0B03, 0x0B06, 0x0B07, 0x0B08, 0x0B09, 0x0B43, 0x0B0C, 0x0B0D,
+  0x0B0E, 0x0B0F, 0x0B12, 0x0B13, 0x0B14, 0x0B15, 0x0B44, 0x0B18, 0x0B19, 0x0B45, 0x0B1C, 0x0B1D,
+  0x0B1E, 0x0B1F, 0x0B46, 0x0ACA, 0x0B3F, 0x0ACF, 0x0B40, 0x0AD5, 0x0B41, 0x0AD9, 0x0B47, 0x0AE6,
+  0x0B48, 0x0B49, 0x0B4A, 0x0B02, 0x0B03, 0x0B09, 0x0B15, 0x0B44, 0x0B1F, 0x0B46, 0x0B4B, 0x0B4C,
+  0x0B4D, 0x0B4E, 0x0B4F, 0x0B50, 0x0B51, 0x0B52, 0x0B53, 0x0B54, 0x0B55, 0x0B56, 0x0B57, 0x0B58,
+  0x0B59, 0x0B5A, 0x0B5B, 0x0B5C, 0x0B5D, 0x0B5E, 0x0B5F, 0x0B60, 0x0B61, 0x0B62, 0x0B63, 0x0B64,
+  0x0B49, 0x0B65, 0x0B66, 0x0B67, 0x0B68, 0x0B4E, 0x0B4F, 0x0B50, 0x0B51, 0x0B52, 0x0B53, 0x0B54,
+  0x0B55, 0x0B56, 0x0B57, 0x0B58, 0x0B59, 0x0B5A, 0x0B5B, 0x0B5C, 0x0B5D, 0x0B5E, 0x0B5F, 0x0B60,
+  0x0B61, 0x0B62, 0x0B63, 0x0B64, 0x0B49, 0x0B65, 0x0B66, 0x0B67, 0x0B68, 0x0B62, 0x0B63, 0x0B64,
+  0x0B49, 0x0B48, 0x0B4A, 0x0AEE, 0x0AE3, 0x0AE4, 0x0AE5, 0x0B62, 0x0B63, 0x0B64, 0x0AEE, 0x0AEF,
+  0x0B69, 0x0B69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B6A, 0x0B6B, 0x0B6B, 0x0B6C,
+  0x0B6D, 0x0B6E, 0x0B6F, 0x0B70, 0x0B71, 0x0B71, 0x0B72, 0x0B73, 0x0B74, 0x0B75, 0x0B76, 0x0B77,
+  0x0B77, 0x0B78, 0x0B79, 0x0B79, 0x0B7A, 0x0B7A, 0x0B7B, 0x0B7C, 0x0B7C, 0x0B7D, 0x0B7E, 0x0B7E,
+  0x0B7F, 0x0B7F, 0x0B80, 0x0B81, 0x0B81, 0x0B82, 0x0B82, 0x0B83, 0x0B84, 0x0B85, 0x0B86, 0x0B86,
+  0x0B87, 0x0B88, 0x0B89, 0x0B8A, 0x0B8B, 0x0B8B, 0x0B8C, 0x0B8D, 0x0B8E, 0x0B8F, 0x0B90, 0x0B91,
+  0x0B91, 0x0B92, 0x0B92, 0x0B93, 0x0B93, 0x0B94, 0x0B95, 0x0B96, 0x0B97, 0x0B98, 0x0B99, 0x0B9A,
+  0x0002, 0x0002, 0x0B9B, 0x0B9C, 0x0B9D, 0x0B9E, 0x0B9F, 0x0BA0, 0x0BA0, 0x0BA1, 0x0BA2, 0x0BA3,
+  0x0BA4, 0x0BA4, 0x0BA5, 0x0BA6, 0x0BA7, 0x0BA8, 0x0BA9, 0x0BAA, 0x0BAB, 0x0BAC, 0x0BAD, 0x0BAE,
+  0x0BAF, 0x0BB0, 0x0BB1, 0x0BB2, 0x0BB3, 0x0BB4, 0x0BB5, 0x0BB6, 0x0BB7, 0x0BB8, 0x0BB9, 0x0BBA,
+  0x0B8C, 0x0B8E, 0x0BBB, 0x0BBC, 0x0BBD, 0x0BBE, 0x0BBF, 0x0BC0, 0x0BBF, 0x0BBD, 0x0BC1, 0x0BC2,
+  0x0BC3, 0x0BC4, 0x0BC5, 0x0BC0, 0x0B85, 0x0B7B, 0x0BC6, 0x0BC7, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0BC8, 0x0BC9, 0x0BCA, 0x0BCB, 0x0BCC, 0x0BCD, 0x0BCE, 0x0BCF, 0x0BD0, 0x0BD1, 0x0BD2, 0x0BD3,
+  0x0BD4, 0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0BD5, 0x0BD6, 0x0002, 0x0BD7,
+  0x0BD7, 0x0BD8, 0x0BD9, 0x0BDA, 0x0BDA, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140,
+  0x0140, 0x0140, 0x013E, 0x013E, 0x0002, 0x0BDB, 0x0BDC, 0x0BDD, 0x0BDE, 0x0BDF, 0x0BDF, 0x0BE0,
+  0x0BE1, 0x0BE2, 0x0BE2, 0x0BE3, 0x0BE3, 0x0BE4, 0x0BE4, 0x0BE5, 0x0BE5, 0x0BE6, 0x0BE6, 0x0BE6,
+  0x0BE6, 0x0000, 0x0000, 0x0BE7, 0x0BE8, 0x0461, 0x0461, 0x0461, 0x0461, 0x0BE9, 0x0BEA, 0x0BEB,
+  0x0BEC, 0x0BED, 0x0002, 0x0002, 0x0BEE, 0x0BEF, 0x0BF0, 0x0BF1, 0x0BF2, 0x0BF3, 0x0BF3, 0x0BF4,
+  0x0BF5, 0x0BF6, 0x0BF6, 0x0BF7, 0x0BF8, 0x0BF9, 0x0BF9, 0x0BF1, 0x0BFA, 0x0BFB, 0x0BFC, 0x0002,
+  0x0BFD, 0x0BFE, 0x0BFE, 0x0BFF, 0x0002, 0x0002, 0x0002, 0x0002, 0x0C00, 0x0C01, 0x0C02, 0x0000,
+  0x0C03, 0x0002, 0x0C04, 0x0C05, 0x0C06, 0x0C07, 0x0C08, 0x0C09, 0x0C0A, 0x0C0B, 0x0C0C, 0x0C0D,
+  0x0C0E, 0x0C0E, 0x0C0F, 0x0C0F, 0x0C10, 0x0C10, 0x0C11, 0x0C11, 0x0C12, 0x0C12, 0x0C13, 0x0C14,
+  0x0C15, 0x0C15, 0x0C16, 0x0C16, 0x0C17, 0x0C18, 0x0C19, 0x0C19, 0x0C1A, 0x0C1A, 0x0C1B, 0x0C1C,
+  0x0C1D, 0x0C1D, 0x0C1E, 0x0C1F, 0x0C20, 0x0C20, 0x0C21, 0x0C22, 0x0C23, 0x0C23, 0x0C24, 0x0C25,
+  0x0C26, 0x0C26, 0x0C27, 0x0C28, 0x0C29, 0x0C29, 0x0C2A, 0x0C2A, 0x0C2B, 0x0C2B, 0x0C2C, 0x0C2C,
+  0x0C2D, 0x0C2D, 0x0C2E, 0x0C2F, 0x0C30, 0x0C30, 0x0C31, 0x0C32, 0x0C33, 0x0C33, 0x0C34, 0x0C35,
+  0x0C36, 0x0C36, 0x0C37, 0x0C38, 0x0C39, 0x0C39, 0x0C3A, 0x0C3B, 0x0C3C, 0x0C3C, 0x0C3D, 0x0C3E,
+  0x0C3F, 0x0C3F, 0x0C40, 0x0C41, 0x0C42, 0x0C42, 0x0C43, 0x0C44, 0x0C45, 0x0C3F, 0x0C40, 0x0C41,
+  0x0C42, 0x0C42, 0x0C43, 0x0C44, 0x0C45, 0x0C45, 0x0C46, 0x0C47, 0x0C48, 0x0C48, 0x0C49, 0x0C4A,
+  0x0C4B, 0x0C4B, 0x0C4C, 0x0C4D, 0x0C4E, 0x0C4E, 0x0C4F, 0x0C50, 0x0C51, 0x0C51, 0x0C52, 0x0C53,
+  0x0C54, 0x0C54, 0x0C55, 0x0C55, 0x0C56, 0x0C56, 0x0C57, 0x0C58, 0x0C59, 0x0C5A, 0x0C5A, 0x0C5B,
+  0x0C5B, 0x0C5C, 0x0C5C, 0x0C5D, 0x0C5D, 0x0002, 0x0002, 0x0006, 0x0002, 0x0C5E, 0x0C5E, 0x0C5E,
+  0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E,
+  0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E,
+  0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F,
+  0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F,
+  0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5F, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E,
+  0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E,
+  0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E,
+  0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C5E, 0x0C60, 0x0C60, 0x0C61, 0x0C62, 0x0C62,
+  0x0C63, 0x0C64, 0x0C65, 0x0C66, 0x0C67, 0x0C68, 0x0C69, 0x0C6A, 0x0C6B, 0x0C6C, 0x0C6D, 0x0C6E,
+  0x0C65, 0x0C6F, 0x0C70, 0x0C71, 0x0C72, 0x0C73, 0x0C73, 0x0C74, 0x0C75, 0x0C76, 0x0C77, 0x0C66,
+  0x0C67, 0x0C68, 0x0C69, 0x0C6A, 0x0C78, 0x0C79, 0x0C7A, 0x0C7B, 0x0C7C, 0x0C7D, 0x0C7D, 0x0C7D,
+  0x0C7D, 0x0C7D, 0x0C7D, 0x0C7E, 0x0C7F, 0x0C80, 0x0C81, 0x0C82, 0x0C82, 0x0C82, 0x0C82, 0x0C82,
+  0x0C83, 0x0C84, 0x0C85, 0x0C85, 0x0C85, 0x0C85, 0x0C85, 0x0C85, 0x0C86, 0x0C87, 0x0C88, 0x0C88,
+  0x0002, 0x0C89, 0x0C89, 0x0C8A, 0x0C8B, 0x0C8A, 0x0C8A, 0x0C8C, 0x0C8C, 0x0C8C, 0x0C8D, 0x0C8D,
+  0x0C8D, 0x0C8D, 0x0C8D, 0x0C8D, 0x0C8E, 0x0C8F, 0x0C8F, 0x0C8F, 0x0C90, 0x0C91, 0x0C91, 0x0C91,
+  0x0C91, 0x0C91, 0x0C91, 0x0C91, 0x0C91, 0x0C91, 0x0C91, 0x0002, 0x0002, 0x0002, 0x0C92, 0x0C92,
+  0x0C92, 0x0C92, 0x0C92, 0x0C92, 0x0002, 0x0002, 0x0C93, 0x0C93, 0x0C93, 0x0C93, 0x0C93, 0x0C93,
+  0x0002, 0x0002, 0x0C94, 0x0C94, 0x0C94, 0x0C94, 0x0C94, 0x0C94, 0x0002, 0x0002, 0x0C95, 0x0C95,
+  0x0C95, 0x0002, 0x0002, 0x0002, 0x0C96, 0x0C96, 0x0C97, 0x0007, 0x0C96, 0x0C98, 0x0C99, 0x0002,
+  0x0C9A, 0x0C9B, 0x0C9B, 0x0C9B, 0x0C9B, 0x0C9C, 0x0C9D, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0140, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0140, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E,
+  0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E,
+  0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E,
+  0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E,
+  0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E,
+  0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E,
+  0x0C9E, 0x0C9E, 0x0C9E, 0x0C9E, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0000, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F,
+  0x0C9F, 0x0C9F, 0x0C9F, 0x0002, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F,
+  0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F, 0x0002, 0x0C9F, 0x0C9F, 0x0C9F, 0x0C9F,
+  0x0C9F, 0x0C9F, 0x0C9F, 0x0002, 0x0C9F, 0x0C9F, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0CA0, 0x0CA0, 0x0CA1, 0x0CA2, 0x0CA3, 0x0002, 0x0CA4, 0x0CA5, 0x0CA4, 0x0CA6, 0x0CA7,
+  0x0CA7, 0x0CA8, 0x0CA9, 0x0CAA, 0x0CAB, 0x0CAC, 0x0CAD, 0x0CAE, 0x0CAF, 0x0CB0, 0x0CB1, 0x0CAD,
+  0x0CB2, 0x0CB3, 0x0CB3, 0x0CB4, 0x0CB5, 0x0CB6, 0x0CAD, 0x0CB7, 0x0CB8, 0x0CB9, 0x0CBA, 0x0CAC,
+  0x0CAC, 0x0CBB, 0x0CBC, 0x0CBD, 0x0CBE, 0x0CBE, 0x0CBF, 0x0CC0, 0x0CC1, 0x0CC2, 0x0CC3, 0x0CC4,
+  0x0CC5, 0x0002, 0x0CC6, 0x0CB8, 0x0CB8, 0x0CC7, 0x0CC8, 0x0CC8, 0x0CC8, 0x0CC9, 0x0CCA, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0140, 0x0000, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x013E, 0x0143, 0x0140, 0x0002, 0x0002, 0x0002, 0x0002, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x0140, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB,
+  0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB,
+  0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB,
+  0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB,
+  0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0CCB, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x013E, 0x013E, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0140, 0x0140, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0140, 0x0140, 0x013E, 0x013E, 0x013E, 0x0140, 0x013E, 0x0140, 0x0140, 0x0140,
+  0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x013E, 0x0140, 0x013E, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CCC, 0x0000, 0x0CCD, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CCE,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x01D5, 0x01D4, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x013E, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CCF, 0x0CD0,
+  0x0000, 0x0000, 0x0000, 0x01D5, 0x01D5, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D4, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D4, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x01D4, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D4, 0x01D5, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x01D4, 0x01D4, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x0CD1,
+  0x0CD2, 0x01D5, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0002, 0x0002,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000,
+  0x0000, 0x0000, 0x01D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x013E, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CD3,
+  0x0CD4, 0x0000, 0x0CD5, 0x0000, 0x0000, 0x0000, 0x01D5, 0x01D4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0CD6, 0x0CD7, 0x0000, 0x0000, 0x0000, 0x01D5,
+  0x01D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x01D4, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x01D5, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x01D5, 0x01D4, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0CD8, 0x0002, 0x0002, 0x0000, 0x0000, 0x01D5, 0x01D5, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x01D4, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x01D4, 0x0000,
+  0x01D5, 0x01D5, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000,
+  0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x01D5, 0x01D5, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0143, 0x0143, 0x0143, 0x0143,
+  0x0143, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0CD9, 0x0CD9, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0143, 0x0000, 0x0006, 0x0006, 0x0006, 0x0006, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CDA, 0x0CDB, 0x0CDC, 0x0CDD, 0x0CDE, 0x0CDF,
+  0x0CE0, 0x0141, 0x0141, 0x0143, 0x0143, 0x0143, 0x0000, 0x0000, 0x0000, 0x0CE1, 0x0141, 0x0141,
+  0x0141, 0x0141, 0x0141, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0140,
+  0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0000, 0x0000, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x0140, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0CE2, 0x0CE3, 0x0CE4, 0x0CE5, 0x0CE6, 0x0CE7, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E, 0x013E, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8,
+  0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8, 0x0CE8,
+  0x0CE8, 0x0CE8, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9,
+  0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9,
+  0x0CE9, 0x0CE9, 0x0CE9, 0x0CE9, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA,
+  0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA,
+  0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEA, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB,
+  0x0CEB, 0x0002, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB,
+  0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEB, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC,
+  0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC,
+  0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CEC, 0x0CED, 0x0CED,
+  0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED,
+  0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED, 0x0CED,
+  0x0CEE, 0x0002, 0x0CEE, 0x0CEE, 0x0002, 0x0002, 0x0CEE, 0x0002, 0x0002, 0x0CEE, 0x0CEE, 0x0002,
+  0x0002, 0x0CEE, 0x0CEE, 0x0CEE, 0x0CEE, 0x0002, 0x0CEE, 0x0CEE, 0x0CEE, 0x0CEE, 0x0CEE, 0x0CEE,
+  0x0CEE, 0x0CEE, 0x0CEF, 0x0CEF, 0x0CEF, 0x0CEF, 0x0002, 0x0CEF, 0x0002, 0x0CEF, 0x0CEF, 0x0CEF,
+  0x0CEF, 0x0CEF, 0x0CEF, 0x0CEF, 0x0002, 0x0CEF, 0x0CEF, 0x0CEF, 0x0CEF, 0x0CEF, 0x0CEF, 0x0CEF,
+  0x0CEF, 0x0CEF, 0x0CEF, 0x0CEF, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0,
+  0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0,
+  0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF0, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1,
+  0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1,
+  0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF1, 0x0CF2, 0x0CF2, 0x0002, 0x0CF2,
+  0x0CF2, 0x0CF2, 0x0CF2, 0x0002, 0x0002, 0x0CF2, 0x0CF2, 0x0CF2, 0x0CF2, 0x0CF2, 0x0CF2, 0x0CF2,
+  0x0CF2, 0x0002, 0x0CF2, 0x0CF2, 0x0CF2, 0x0CF2, 0x0CF2, 0x0CF2, 0x0CF2, 0x0002, 0x0CF3, 0x0CF3,
+  0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3,
+  0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3, 0x0CF3,
+  0x0CF4, 0x0CF4, 0x0002, 0x0CF4, 0x0CF4, 0x0CF4, 0x0CF4, 0x0002, 0x0CF4, 0x0CF4, 0x0CF4, 0x0CF4,
+  0x0CF4, 0x0002, 0x0CF4, 0x0002, 0x0002, 0x0002, 0x0CF4, 0x0CF4, 0x0CF4, 0x0CF4, 0x0CF4, 0x0CF4,
+  0x0CF4, 0x0002, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5,
+  0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5,
+  0x0CF5, 0x0CF5, 0x0CF5, 0x0CF5, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6,
+  0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6,
+  0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF6, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7,
+  0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7,
+  0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF7, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8,
+  0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8,
+  0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF8, 0x0CF9, 0x0CF9,
+  0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9,
+  0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9, 0x0CF9,
+  0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA,
+  0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA, 0x0CFA,
+  0x0CFA, 0x0CFA, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB,
+  0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB,
+  0x0CFB, 0x0CFB, 0x0CFB, 0x0CFB, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC,
+  0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC,
+  0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFC, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD,
+  0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD,
+  0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFD, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE,
+  0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE,
+  0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFE, 0x0CFF, 0x0CFF,
+  0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF,
+  0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF, 0x0CFF,
+  0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00,
+  0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00, 0x0D00,
+  0x0D00, 0x0D00, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01,
+  0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0D01,
+  0x0D01, 0x0D01, 0x0D01, 0x0D01, 0x0CFA, 0x0D02, 0x0002, 0x0002, 0x0D03, 0x0D03, 0x0D03, 0x0D03,
+  0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03,
+  0x0D03, 0x0D04, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D03, 0x0D05, 0x0D06, 0x0D06,
+  0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06,
+  0x0D06, 0x0D06, 0x0D06, 0x0D07, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D06, 0x0D08,
+  0x0D09, 0x0D0A, 0x0D0B, 0x0D0C, 0x0D0D, 0x0D0E, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F,
+  0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D10,
+  0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D0F, 0x0D11, 0x0D12, 0x0D12, 0x0D12, 0x0D12,
+  0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12,
+  0x0D12, 0x0D13, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D12, 0x0D14, 0x0D15, 0x0D16,
+  0x0D17, 0x0D18, 0x0D19, 0x0D1A, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B,
+  0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1C, 0x0D1B, 0x0D1B,
+  0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1B, 0x0D1D, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E,
+  0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1F,
+  0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D1E, 0x0D20, 0x0D21, 0x0D22, 0x0D23, 0x0D24,
+  0x0D25, 0x0D26, 0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D27,
+  0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D27, 0x0D28, 0x0D27, 0x0D27, 0x0D27, 0x0D27,
+  0x0D27, 0x0D27, 0x0D27, 0x0D29, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A,
+  0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2B, 0x0D2A, 0x0D2A,
+  0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2A, 0x0D2C, 0x0D2D, 0x0CEA, 0x0D2E, 0x0D2F, 0x0D30, 0x0D31,
+  0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32,
+  0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D33, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32, 0x0D32,
+  0x0D32, 0x0D34, 0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D35,
+  0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D35, 0x0D36, 0x0D35, 0x0D35, 0x0D35, 0x0D35,
+  0x0D35, 0x0D35, 0x0D35, 0x0D37, 0x0D38, 0x0D39, 0x0D3A, 0x0D3B, 0x0CEC, 0x0D3C, 0x0CEB, 0x0D3D,
+  0x0002, 0x0002, 0x0D3E, 0x0D3E, 0x0D3E, 0x0D3E, 0x0D3E, 0x0D3E, 0x0D3E, 0x0D3E, 0x0D3E, 0x0D3E,
+  0x0D3F, 0x0D3F, 0x0D3F, 0x0D3F, 0x0D3F, 0x0D3F, 0x0D3F, 0x0D3F, 0x0D3F, 0x0D3F, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D41, 0x0D41, 0x0D41, 0x0D41,
+  0x0D41, 0x0D41, 0x0D41, 0x0D41, 0x0D41, 0x0D41, 0x0D42, 0x0D42, 0x0D42, 0x0D42, 0x0D42, 0x0D42,
+  0x0D42, 0x0D42, 0x0D42, 0x0D42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x0002, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x0002, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0002, 0x013E, 0x013E, 0x0002, 0x013E, 0x013E,
+  0x013E, 0x013E, 0x013E, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0D43, 0x0D43, 0x0D43, 0x0D43,
+  0x0D43, 0x0D43, 0x0D43, 0x0D43, 0x0D43, 0x0D44, 0x0D44, 0x0D44, 0x0D45, 0x0D45, 0x0D45, 0x0D45,
+  0x0D45, 0x0D45, 0x0D45, 0x0D45, 0x0D45, 0x0D45, 0x0D45, 0x0D46, 0x0D47, 0x0D47, 0x0D48, 0x0D49,
+  0x0D4A, 0x0D4B, 0x0D4C, 0x0D4D, 0x0D4E, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F,
+  0x0D4F, 0x0D4F, 0x0D50, 0x0D50, 0x0D51, 0x0D51, 0x0D52, 0x0D53, 0x0D53, 0x0D53, 0x0D53, 0x0D53,
+  0x0D53, 0x0D54, 0x0D54, 0x0D55, 0x0D56, 0x0D57, 0x0D58, 0x0D59, 0x0D5A, 0x0D5B, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x013E, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013E, 0x013E, 0x013E, 0x013E,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x0140, 0x013E, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C,
+  0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C,
+  0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C, 0x0D5C,
+  0x0D5C, 0x0D5C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x01D4, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0D5D, 0x0D5D, 0x0D5E, 0x0D5F, 0x0002, 0x0D60, 0x0D5F, 0x0D61, 0x0D62, 0x0D63, 0x0D64, 0x0D64,
+  0x0D64, 0x0D64, 0x0D65, 0x0D5E, 0x0D66, 0x0D67, 0x0D68, 0x0D69, 0x0D6A, 0x0D6B, 0x0D6B, 0x0D6C,
+  0x0D6D, 0x0D6E, 0x0D69, 0x0D6F, 0x0D70, 0x0D71, 0x0D72, 0x0D73, 0x0002, 0x0D74, 0x0D75, 0x0002,
+  0x0D76, 0x0002, 0x0002, 0x0D77, 0x0002, 0x0D78, 0x0D79, 0x0D79, 0x0D79, 0x0D79, 0x0D7A, 0x0D75,
+  0x0D7B, 0x0D7C, 0x0D7D, 0x0002, 0x0D7E, 0x0D7F, 0x0D7F, 0x0D80, 0x0002, 0x0D81, 0x0002, 0x0D82,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0D83, 0x0002, 0x0002, 0x0002, 0x0002, 0x0D84,
+  0x0002, 0x0D85, 0x0002, 0x0D86, 0x0002, 0x0D86, 0x0D87, 0x0D83, 0x0002, 0x0D88, 0x0D89, 0x0002,
+  0x0D8A, 0x0002, 0x0002, 0x0D8B, 0x0002, 0x0D8C, 0x0002, 0x0D8D, 0x0002, 0x0D8E, 0x0002, 0x0D7D,
+  0x0002, 0x0D8F, 0x0D90, 0x0002, 0x0D91, 0x0002, 0x0002, 0x0D92, 0x0D93, 0x0D94, 0x0D95, 0x0002,
+  0x0D95, 0x0D95, 0x0D96, 0x0D90, 0x0D97, 0x0D98, 0x0D99, 0x0002, 0x0D9A, 0x0D9B, 0x0D9B, 0x0D9C,
+  0x0002, 0x0D9D, 0x0D9E, 0x0D9F, 0x0DA0, 0x0002, 0x0D76, 0x0002, 0x0DA1, 0x0DA1, 0x0DA2, 0x0DA3,
+  0x0DA4, 0x0DA4, 0x0DA3, 0x0DA5, 0x0DA6, 0x0DA7, 0x0002, 0x0DA8, 0x0DA8, 0x0DA8, 0x0DA9, 0x0DA2,
+  0x0DAA, 0x0DAB, 0x0DAC, 0x0DAD, 0x0DAE, 0x0DAF, 0x0DAF, 0x0DB0, 0x0DB1, 0x0DB2, 0x0DAD, 0x0DB3,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0DB4, 0x0DB5, 0x0DB6, 0x0002, 0x0DB7, 0x0DB6, 0x0DB8,
+  0x0DB9, 0x0DBA, 0x0002, 0x0DBB, 0x0DBB, 0x0DBB, 0x0DBC, 0x0DB5, 0x0DBD, 0x0DBE, 0x0DBF, 0x0DC0,
+  0x0DC1, 0x0DC2, 0x0DC2, 0x0DC3, 0x0DC4, 0x0DC5, 0x0DC0, 0x0DC6, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0DC7, 0x0DC8, 0x0DC9,
+  0x0DCA, 0x0DCB, 0x0DCC, 0x0DCD, 0x0DCE, 0x0DCF, 0x0DD0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x051A, 0x051B, 0x051C, 0x051D, 0x051E, 0x051F, 0x0520, 0x0521, 0x0522, 0x0523, 0x0524, 0x0525,
+  0x0526, 0x0527, 0x0528, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D, 0x052E, 0x052F, 0x0530, 0x0531,
+  0x0532, 0x0533, 0x0DD1, 0x0DD2, 0x0DD3, 0x082F, 0x0DD4, 0x0000, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5,
+  0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5,
+  0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD5, 0x0DD6, 0x0824,
+  0x0DD7, 0x0DD8, 0x0DD9, 0x0DDA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DDB, 0x0DDC, 0x0DDD, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DDE, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0DDF, 0x0DE0, 0x0DE1, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0DE2, 0x0DE3, 0x0DE4, 0x0DE5, 0x0DE6, 0x0DE7, 0x0DE8, 0x0DE9,
+  0x0DEA, 0x0DEB, 0x0DEC, 0x0DED, 0x0DEE, 0x0DEF, 0x0DF0, 0x0DF1, 0x0DF2, 0x0DF3, 0x0DF4, 0x0DF5,
+  0x0DF6, 0x0DF7, 0x0DF8, 0x0DF9, 0x0DFA, 0x0DFB, 0x0DFC, 0x0DFD, 0x0DFE, 0x0DFF, 0x0E00, 0x0E01,
+  0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0E0E, 0x0E0F, 0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15,
+  0x0E16, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0E17, 0x0E18, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0E19, 0x0E19, 0x0E19, 0x0E19,
+  0x0E19, 0x0E19, 0x0E19, 0x0E19, 0x0E19, 0x0E19, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F, 0x0E20, 0x0E21,
+  0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D,
+  0x0E2E, 0x0E2F, 0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37, 0x0E38, 0x0E39,
+  0x0E3A, 0x0E3B, 0x0E3C, 0x0E3D, 0x0E3E, 0x0E3F, 0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45,
+  0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F, 0x0E50, 0x0E51,
+  0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57, 0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0x0E5C, 0x0E5D,
+  0x0E5E, 0x0E5F, 0x0E60, 0x0E61, 0x0E62, 0x0E63, 0x0E64, 0x0E65, 0x0E66, 0x0E67, 0x0E68, 0x0E69,
+  0x0E6A, 0x0E6B, 0x0E6C, 0x0E6D, 0x0E6E, 0x0E6F, 0x0E70, 0x0E71, 0x0E72, 0x0E73, 0x0E74, 0x0E75,
+  0x0E76, 0x0E77, 0x0E78, 0x0E79, 0x0E7A, 0x0E7B, 0x0E7C, 0x0E7D, 0x0E7E, 0x0E7F, 0x0E80, 0x0E81,
+  0x0E82, 0x0E83, 0x0E84, 0x0E85, 0x0E86, 0x0E87, 0x0E88, 0x0E89, 0x0E8A, 0x0E8B, 0x0E8C, 0x0E8D,
+  0x0E8E, 0x0E8F, 0x0E90, 0x0E91, 0x0E92, 0x0E93, 0x0E94, 0x0E95, 0x0E96, 0x0E97, 0x0E98, 0x0E99,
+  0x0E9A, 0x0E9B, 0x0E9C, 0x0E9D, 0x0E9E, 0x0E9F, 0x0EA0, 0x0EA1, 0x0EA2, 0x0EA3, 0x0EA4, 0x0EA5,
+  0x0EA6, 0x0EA7, 0x0EA8, 0x0EA9, 0x0EAA, 0x0EAB, 0x0EAC, 0x0EAD, 0x0EAE, 0x0EAF, 0x0EB0, 0x0EB1,
+  0x0EB2, 0x0EB3, 0x0EB4, 0x0EB5, 0x0EB6, 0x0EB7, 0x0EB8, 0x0EB9, 0x0EBA, 0x0EBB, 0x0EBC, 0x0EBD,
+  0x0EBE, 0x0EBF, 0x0EC0, 0x0EC1, 0x0EC2, 0x0EC3, 0x0EC4, 0x0EC5, 0x0EC6, 0x0EC7, 0x0EC8, 0x0EC9,
+  0x0ECA, 0x0ECB, 0x0ECC, 0x0ECD, 0x0ECE, 0x0ECF, 0x0ED0, 0x0ED1, 0x0ED2, 0x0ED3, 0x0ED4, 0x0ED5,
+  0x0ED6, 0x0ED7, 0x0ED8, 0x0ED9, 0x0EDA, 0x0EDB, 0x0EDC, 0x0EDD, 0x0EDE, 0x0EDF, 0x0EE0, 0x0EE1,
+  0x0EE2, 0x0EE3, 0x0EE4, 0x0EE5, 0x0EE6, 0x0EE7, 0x0EE8, 0x0EE9, 0x0EEA, 0x0EEB, 0x0EEC, 0x0EED,
+  0x0EEE, 0x0EEF, 0x0EF0, 0x0EF1, 0x0EF2, 0x0EF3, 0x0EF4, 0x0EF5, 0x0EF6, 0x0EF7, 0x0EF8, 0x0EF9,
+  0x0EFA, 0x0EFB, 0x0EFC, 0x0EFD, 0x0EFE, 0x0EFF, 0x0F00, 0x0F01, 0x0F02, 0x0F03, 0x0F04, 0x0F05,
+  0x0F06, 0x0F07, 0x0F08, 0x0F09, 0x0F0A, 0x0F0B, 0x0F0C, 0x0F0D, 0x0F0E, 0x0F0F, 0x0F10, 0x0F11,
+  0x0F12, 0x0F13, 0x0F14, 0x0F15, 0x0F16, 0x0F17, 0x0F18, 0x0F19, 0x0F1A, 0x0F1B, 0x0F1C, 0x0F1D,
+  0x0F1E, 0x0F1F, 0x0F20, 0x0F21, 0x0F22, 0x0F23, 0x0F24, 0x0F25, 0x0F26, 0x0F27, 0x0F28, 0x0F29,
+  0x0F2A, 0x0F2B, 0x0F2C, 0x0F2D, 0x0F2E, 0x0F2F, 0x0F30, 0x0F31, 0x0F32, 0x0F33, 0x0F34, 0x0F35,
+  0x0F36, 0x0F37, 0x0F38, 0x0F39, 0x0F3A, 0x0F3B, 0x0F3C, 0x0F3D, 0x0F3E, 0x0F3F, 0x0F40, 0x0F41,
+  0x0F42, 0x0F43, 0x0F44, 0x0F45, 0x0F46, 0x0F47, 0x0F48, 0x0F49, 0x0F4A, 0x0F4B, 0x0F4C, 0x0F4D,
+  0x0F4E, 0x0F4F, 0x0F50, 0x0F51, 0x0F52, 0x0F53, 0x0F54, 0x0F55, 0x0F56, 0x0F57, 0x0F58, 0x0F59,
+  0x0F5A, 0x0F5B, 0x0F5C, 0x0F5D, 0x0F5E, 0x0F5F, 0x0F60, 0x0F61, 0x0F62, 0x0F63, 0x0F64, 0x0F65,
+  0x0F66, 0x0F67, 0x0F68, 0x0F69, 0x0F6A, 0x0F6B, 0x0F6C, 0x0F6D, 0x0F6E, 0x0F6F, 0x0F70, 0x0F71,
+  0x0F72, 0x0F73, 0x0F74, 0x0F75, 0x0F76, 0x0F77, 0x0F78, 0x0F79, 0x0F7A, 0x0F7B, 0x0F7C, 0x0F7D,
+  0x0F7E, 0x0F7F, 0x0F80, 0x0F81, 0x0F82, 0x0F83, 0x0F84, 0x0F85, 0x0F86, 0x0F87, 0x0F88, 0x0F89,
+  0x0F8A, 0x0F8B, 0x0F8C, 0x0F8D, 0x0F8E, 0x0F8F, 0x0F90, 0x0F91, 0x0F92, 0x0F93, 0x0F94, 0x0F95,
+  0x0F96, 0x0F97, 0x0F98, 0x0F99, 0x0F9A, 0x0F9B, 0x0F9C, 0x0F9D, 0x0F9E, 0x0F9F, 0x0FA0, 0x0FA1,
+  0x0FA2, 0x0FA3, 0x0FA4, 0x0FA5, 0x0FA6, 0x0FA7, 0x0FA8, 0x0FA9, 0x0FAA, 0x0FAB, 0x0FAC, 0x0FAD,
+  0x0FAE, 0x0FAF, 0x0FB0, 0x0FB1, 0x0FB2, 0x0FB3, 0x0FB4, 0x0FB5, 0x0FB6, 0x0FB7, 0x0FB8, 0x0FB9,
+  0x0FBA, 0x0FBB, 0x0FBC, 0x0FBD, 0x0FBE, 0x0FBF, 0x0FC0, 0x0FC1, 0x0FC2, 0x0FC3, 0x0FC4, 0x0FC5,
+  0x0FC6, 0x0FC7, 0x0FC8, 0x0FC9, 0x0FCA, 0x0FCB, 0x0FCC, 0x0FCD, 0x0FCE, 0x0FCF, 0x0FD0, 0x0FD1,
+  0x0FD2, 0x0FD3, 0x0FD4, 0x0FD5, 0x0FD6, 0x0FD7, 0x0FD8, 0x0FD9, 0x0FDA, 0x0FDB, 0x0FDC, 0x0FDD,
+  0x0FDE, 0x0FDF, 0x0FE0, 0x0FE1, 0x0FE2, 0x0FE3, 0x0FE4, 0x0FE5, 0x0FE6, 0x0FE7, 0x0FE8, 0x0FE9,
+  0x0FEA, 0x0FEB, 0x0FEC, 0x0FED, 0x0FEE, 0x0FEF, 0x0FF0, 0x0FF1, 0x0FF2, 0x0FF3, 0x0FF4, 0x0FF5,
+  0x0FF6, 0x0FF7, 0x0FF8, 0x0FF9, 0x0FFA, 0x0FFB, 0x0FFC, 0x0FFD, 0x0FFE, 0x0FFF, 0x1000, 0x1001,
+  0x1002, 0x1003, 0x1004, 0x1005, 0x1006, 0x1007, 0x1008, 0x1009, 0x100A, 0x100B, 0x100C, 0x100D,
+  0x100E, 0x100F, 0x1010, 0x1011, 0x1012, 0x1013, 0x1014, 0x1015, 0x1016, 0x1017, 0x1018, 0x1019,
+  0x101A, 0x101B, 0x101C, 0x101D, 0x101E, 0x101F, 0x1020, 0x1021, 0x1022, 0x1023, 0x1024, 0x1025,
+  0x1026, 0x1027, 0x1028, 0x1029, 0x102A, 0x102B, 0x102C, 0x102D, 0x102E, 0x102F, 0x1030, 0x1031,
+  0x1032, 0x1033, 0x1034, 0x1035, 0x1036, 0x1037, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002,
+};
+
+static const uts46_property uts46_properties[4152] = {
+  {0x00000000, 0x0000, 0}, {0x00001005, 0x0000, 0}, {0x00000003, 0x0000, 0}, {0xFFFFC005, 0x0000, 0},
+  {0x00000009, 0x0000, 0}, {0xFFFFDB85, 0x0000, 0}, {0x00000002, 0x0000, 0}, {0x00000109, 0x0000, 0},
+  {0x00000209, 0x0000, 0}, {0x00018385, 0x0000, 0}, {0x00000309, 0x0000, 0}, {0xFFFFBC05, 0x0000, 0},
+  {0xFFFFDA85, 0x0000, 0}, {0x0000040D, 0x0000, 0}, {0x0000058D, 0x0000, 0}, {0x0000070D, 0x0000, 0},
+  {0x00001005, 0x0002, 0}, {0x00001005, 0x0012, 0}, {0x00001005, 0x0022, 0}, {0x00001005, 0x0032, 0},
+  {0x00001005, 0x0042, 0}, {0x00001005, 0x0052, 0}, {0x00001005, 0x0062, 0}, {0x00001005, 0x0072, 0},
+  {0x00001005, 0x0082, 0}, {0x00001005, 0x0092, 0}, {0x00001005, 0x00A2, 0}, {0x00001005, 0x00B2, 0},
+  {0x00001005, 0x00C2, 0}, {0x00001005, 0x00D2, 0}, {0x00001005, 0x00E2, 0}, {0x00001005, 0x00F2, 0},
+  {0x00001005, 0x0102, 0}, {0x00001005, 0x0112, 0}, {0x00001005, 0x0122, 0}, {0x00001005, 0x0132, 0},
+  {0x00001005, 0x0142, 0}, {0x00001005, 0x0152, 0}, {0x00001005, 0x0162, 0}, {0x00001005, 0x0172, 0},
+  {0x00001005, 0x0182, 0}, {0x00001005, 0x0192, 0}, {0x00000000, 0x01A2, 0}, {0x00000000, 0x01B2, 0},
+  {0x00000000, 0x01C2, 0}, {0x00000000, 0x01D2, 0}, {0x00000000, 0x01E2, 0}, {0x00000000, 0x01F2, 0},
+  {0x00000000, 0x0202, 0}, {0x00000000, 0x0212, 0}, {0x00000000, 0x0222, 0}, {0x00000000, 0x0232, 0},
+  {0x00000000, 0x0242, 0}, {0x00000000, 0x0252, 0}, {0x00000000, 0x0262, 0}, {0x00000000, 0x0272, 0},
+  {0x00000000, 0x0282, 0}, {0x00000000, 0x0292, 0}, {0x00000000, 0x02A2, 0}, {0x00000000, 0x02B2, 0},
+  {0x00000000, 0x02C2, 0}, {0x00000000, 0x02D2, 0}, {0x00000000, 0x02E2, 0}, {0x00000000, 0x02F2, 0},
+  {0x00000000, 0x0302, 0}, {0x00000000, 0x0312, 0}, {0x00000000, 0x0322, 0}, {0x00000000, 0x0332, 0},
+  {0x00000000, 0x0342, 0}, {0x00000085, 0x0352, 0}, {0x00000000, 0x0362, 0}, {0x00000085, 0x0372, 0},
+  {0x00000000, 0x0382, 0}, {0x00000085, 0x0392, 0}, {0x00000000, 0x03A2, 0}, {0x00000085, 0x03B2, 0},
+  {0x00000000, 0x03C2, 0}, {0x00000085, 0x03D2, 0}, {0x00000000, 0x03E2, 0}, {0x00000085, 0x03F2, 0},
+  {0x00000000, 0x0402, 0}, {0x00000085, 0x0412, 0}, {0x00000000, 0x0422, 0}, {0x00000085, 0x0432, 0},
+  {0x00000000, 0x0442, 0}, {0x00000085, 0x0000, 0}, {0x00000085, 0x0452, 0}, {0x00000000, 0x0462, 0},
+  {0x00000085, 0x0472, 0}, {0x00000000, 0x0482, 0}, {0x00000085, 0x0492, 0}, {0x00000000, 0x04A2, 0},
+  {0x00000085, 0x04B2, 0}, {0x00000000, 0x04C2, 0}, {0x00000085, 0x04D2, 0}, {0x00000000, 0x04E2, 0},
+  {0x00000085, 0x04F2, 0}, {0x00000000, 0x0502, 0}, {0x00000085, 0x0512, 0}, {0x00000000, 0x0522, 0},
+  {0x00000085, 0x0532, 0}, {0x00000000, 0x0542, 0}, {0x00000085, 0x0552, 0}, {0x00000000, 0x0562, 0},
+  {0x00000085, 0x0572, 0}, {0x00000000, 0x0582, 0}, {0x00000085, 0x0592, 0}, {0x00000000, 0x05A2, 0},
+  {0x00000085, 0x05B2, 0}, {0x00000000, 0x05C2, 0}, {0x00000085, 0x05D2, 0}, {0x00000000, 0x05E2, 0},
+  {0x00000085, 0x05F2, 0}, {0x00000000, 0x0602, 0}, {0x00000889, 0x0612, 0}, {0x00000989, 0x0000, 0},
+  {0x00000085, 0x0622, 0}, {0x00000000, 0x0632, 0}, {0x00000085, 0x0642, 0}, {0x00000000, 0x0652, 0},
+  {0x00000085, 0x0662, 0}, {0x00000000, 0x0672, 0}, {0x00000085, 0x0682, 0}, {0x00000000, 0x0692, 0},
+  {0x00000085, 0x06A2, 0}, {0x00000000, 0x06B2, 0}, {0x00000A89, 0x0000, 0}, {0x00000085, 0x06C2, 0},
+  {0x00000000, 0x06D2, 0}, {0x00000085, 0x06E2, 0}, {0x00000000, 0x06F2, 0}, {0x00000085, 0x0702, 0},
+  {0x00000000, 0x0712, 0}, {0x00000B89, 0x0000, 0}, {0x00000085, 0x0722, 0}, {0x00000000, 0x0732, 0},
+  {0x00000085, 0x0742, 0}, {0x00000000, 0x0752, 0}, {0x00000085, 0x0762, 0}, {0x00000000, 0x0772, 0},
+  {0x00000085, 0x0782, 0}, {0x00000000, 0x0792, 0}, {0x00000085, 0x07A2, 0}, {0x00000000, 0x07B2, 0},
+  {0x00000085, 0x07C2, 0}, {0x00000000, 0x07D2, 0}, {0x00000085, 0x07E2, 0}, {0x00000000, 0x07F2, 0},
+  {0x00000085, 0x0802, 0}, {0x00000000, 0x0812, 0}, {0x00000085, 0x0822, 0}, {0x00000000, 0x0832, 0},
+  {0x00000085, 0x0842, 0}, {0x00000000, 0x0852, 0}, {0x00000085, 0x0862, 0}, {0x00000000, 0x0872, 0},
+  {0x00000085, 0x0882, 0}, {0x00000000, 0x0892, 0}, {0x00000085, 0x08A2, 0}, {0x00000000, 0x08B2, 0},
+  {0x00000085, 0x08C2, 0}, {0x00000000, 0x08D2, 0}, {0x00000085, 0x08E2, 0}, {0x00000000, 0x08F2, 0},
+  {0x00000085, 0x0902, 0}, {0x00000000, 0x0912, 0}, {0x00000085, 0x0922, 0}, {0x00000000, 0x0932, 0},
+  {0x00000085, 0x0942, 0}, {0x00000000, 0x0952, 0}, {0x00000085, 0x0962, 0}, {0x00000000, 0x0972, 0},
+  {0x00000085, 0x0982, 0}, {0x00000000, 0x0992, 0}, {0xFFFFC385, 0x09A2, 0}, {0x00000085, 0x09B2, 0},
+  {0x00000000, 0x09C2, 0}, {0x00000085, 0x09D2, 0}, {0x00000000, 0x09E2, 0}, {0x00000085, 0x09F2, 0},
+  {0x00000000, 0x0A02, 0}, {0xFFFF7A05, 0x0000, 0}, {0x00006905, 0x0000, 0}, {0x00006705, 0x0000, 0},
+  {0x00006685, 0x0000, 0}, {0x00002785, 0x0000, 0}, {0x00006505, 0x0000, 0}, {0x00006585, 0x0000, 0},
+  {0x00006785, 0x0000, 0}, {0x00006985, 0x0000, 0}, {0x00006885, 0x0000, 0}, {0x00006A85, 0x0000, 0},
+  {0x00006B05, 0x0000, 0}, {0x00000085, 0x0A12, 0}, {0x00000000, 0x0A22, 0}, {0x00006D05, 0x0000, 0},
+  {0x00000085, 0x0A32, 0}, {0x00000000, 0x0A42, 0}, {0x00006C85, 0x0000, 0}, {0x00006D85, 0x0000, 0},
+  {0x00000C89, 0x0000, 0}, {0x00000D89, 0x0000, 0}, {0x00000E89, 0x0000, 0}, {0x00000085, 0x0A52, 0},
+  {0x00000000, 0x0A62, 0}, {0x00000085, 0x0A72, 0}, {0x00000000, 0x0A82, 0}, {0x00000085, 0x0A92, 0},
+  {0x00000000, 0x0AA2, 0}, {0x00000085, 0x0AB2, 0}, {0x00000000, 0x0AC2, 0}, {0x00000085, 0x0AD3, 0},
+  {0x00000000, 0x0AEB, 0}, {0x00000085, 0x0B03, 0}, {0x00000000, 0x0B1B, 0}, {0x00000085, 0x0B33, 0},
+  {0x00000000, 0x0B4B, 0}, {0x00000085, 0x0B63, 0}, {0x00000000, 0x0B7B, 0}, {0x00000085, 0x0B93, 0},
+  {0x00000000, 0x0BAB, 0}, {0x00000085, 0x0BC3, 0}, {0x00000000, 0x0BDB, 0}, {0x00000085, 0x0BF2, 0},
+  {0x00000000, 0x0C02, 0}, {0x00000085, 0x0C12, 0}, {0x00000000, 0x0C22, 0}, {0x00000085, 0x0C32, 0},
+  {0x00000000, 0x0C42, 0}, {0x00000085, 0x0C52, 0}, {0x00000000, 0x0C62, 0}, {0x00000085, 0x0C73, 0},
+  {0x00000000, 0x0C8B, 0}, {0x00000085, 0x0CA2, 0}, {0x00000000, 0x0CB2, 0}, {0x00000000, 0x0CC2, 0},
+  {0x00000F89, 0x0000, 0}, {0x00000085, 0x0CD2, 0}, {0x00000000, 0x0CE2, 0}, {0xFFFFCF85, 0x0000, 0},
+  {0xFFFFE405, 0x0000, 0}, {0x00000085, 0x0CF2, 0}, {0x00000000, 0x0D02, 0}, {0x00000085, 0x0D13, 0},
+  {0x00000000, 0x0D2B, 0}, {0x00000085, 0x0D42, 0}, {0x00000000, 0x0D52, 0}, {0x00000085, 0x0D62, 0},
+  {0x00000000, 0x0D72, 0}, {0x00000085, 0x0D82, 0}, {0x00000000, 0x0D92, 0}, {0x00000085, 0x0DA2, 0},
+  {0x00000000, 0x0DB2, 0}, {0x00000085, 0x0DC2, 0}, {0x00000000, 0x0DD2, 0}, {0x00000085, 0x0DE2, 0},
+  {0x00000000, 0x0DF2, 0}, {0x00000085, 0x0E02, 0}, {0x00000000, 0x0E12, 0}, {0x00000085, 0x0E22, 0},
+  {0x00000000, 0x0E32, 0}, {0x00000085, 0x0E42, 0}, {0x00000000, 0x0E52, 0}, {0x00000085, 0x0E62, 0},
+  {0x00000000, 0x0E72, 0}, {0x00000085, 0x0E82, 0}, {0x00000000, 0x0E92, 0}, {0x00000085, 0x0EA2, 0},
+  {0x00000000, 0x0EB2, 0}, {0x00000085, 0x0EC2, 0}, {0x00000000, 0x0ED2, 0}, {0x00000085, 0x0EE2, 0},
+  {0x00000000, 0x0EF2, 0}, {0x00000085, 0x0F02, 0}, {0x00000000, 0x0F12, 0}, {0x00000085, 0x0F22, 0},
+  {0x00000000, 0x0F32, 0}, {0x00000085, 0x0F42, 0}, {0x00000000, 0x0F52, 0}, {0xFFFFBF05, 0x0000, 0},
+  {0x00000085, 0x0F62, 0}, {0x00000000, 0x0F72, 0}, {0x00000085, 0x0F82, 0}, {0x00000000, 0x0F92, 0},
+  {0x00000085, 0x0FA3, 0}, {0x00000000, 0x0FBB, 0}, {0x00000085, 0x0FD3, 0}, {0x00000000, 0x0FEB, 0},
+  {0x00000085, 0x1002, 0}, {0x00000000, 0x1012, 0}, {0x00000085, 0x1023, 0}, {0x00000000, 0x103B, 0},
+  {0x00000085, 0x1052, 0}, {0x00000000, 0x1062, 0}, {0x00151585, 0x0000, 0}, {0xFFFFAE85, 0x0000, 0},
+  {0x00151405, 0x0000, 0}, {0xFFFF9E85, 0x0000, 0}, {0x00002285, 0x0000, 0}, {0x00002385, 0x0000, 0},
+  {0xFFFEDC05, 0x0000, 0}, {0xFFFEDF85, 0x0000, 0}, {0xFFFFE285, 0x0000, 0}, {0xFFFFE305, 0x0000, 0},
+  {0xFFFFE585, 0x0000, 0}, {0xFFFEE005, 0x0000, 0}, {0xFFFEE085, 0x0000, 0}, {0x00001089, 0x0000, 0},
+  {0x00001189, 0x0000, 0}, {0x00001289, 0x0000, 0}, {0x00001389, 0x0000, 0}, {0x00001489, 0x0000, 0},
+  {0x00001589, 0x0000, 0}, {0xFFFFC185, 0x0000, 0}, {0xFFFEC585, 0x0000, 0}, {0xFFFEC885, 0x0000, 0},
+  {0xFFFECA85, 0x0000, 0}, {0xFFFFD885, 0x0000, 0}, {0x00000000, 0x0000, 230}, {0x00000000, 0x0000, 232},
+  {0x00000000, 0x0000, 220}, {0x00000000, 0x0000, 216}, {0x00000000, 0x0000, 202}, {0x00000000, 0x0000, 1},
+  {0xFFFFE005, 0x1071, 230}, {0xFFFFE005, 0x1079, 230}, {0xFFFFE805, 0x1081, 230}, {0x00001689, 0x108A, 230},
+  {0x00003A05, 0x0000, 240}, {0x00000000, 0x0000, 233}, {0x00000000, 0x0000, 234}, {0xFFFFA285, 0x1099, 0},
+  {0x00001789, 0x0000, 0}, {0xFFFE5E85, 0x10A1, 0}, {0x00003A05, 0x0000, 0}, {0x0000188D, 0x10AA, 0},
+  {0x00001305, 0x10BA, 0}, {0xFFFE9805, 0x10C9, 0}, {0x00001285, 0x10D2, 0}, {0x00001285, 0x10E2, 0},
+  {0x00001285, 0x10F2, 0}, {0x00002005, 0x1102, 0}, {0x00001F85, 0x1112, 0}, {0x00001F85, 0x1122, 0},
+  {0x00000000, 0x1133, 0}, {0x00001005, 0x114A, 0}, {0x00001005, 0x115A, 0}, {0x00000000, 0x116A, 0},
+  {0x00000000, 0x117A, 0}, {0x00000000, 0x118A, 0}, {0x00000000, 0x119A, 0}, {0x00000000, 0x11AB, 0},
+  {0x00000000, 0x11C2, 0}, {0x00000000, 0x11D2, 0}, {0x00000000, 0x11E2, 0}, {0x00000000, 0x11F2, 0},
+  {0x00000000, 0x1202, 0}, {0x00000405, 0x0000, 0}, {0xFFFFF105, 0x0000, 0}, {0xFFFFF385, 0x0000, 0},
+  {0xFFFFF985, 0x0000, 0}, {0xFFFFFD05, 0x1212, 0}, {0xFFFFFB85, 0x1222, 0}, {0xFFFFF885, 0x0000, 0},
+  {0xFFFFF505, 0x0000, 0}, {0xFFFFE505, 0x0000, 0}, {0xFFFFE805, 0x0000, 0}, {0xFFFFE885, 0x0000, 0},
+  {0xFFFFE205, 0x0000, 0}, {0xFFFFE005, 0x0000, 0}, {0x00002805, 0x1232, 0}, {0x00002805, 0x1242, 0},
+  {0x00002805, 0x0000, 0}, {0x00002805, 0x1252, 0}, {0x00002805, 0x1262, 0}, {0x00002805, 0x1272, 0},
+  {0x00002805, 0x1282, 0}, {0x00002805, 0x1292, 0}, {0x00001005, 0x12A2, 0}, {0x00000000, 0x12B2, 0},
+  {0x00000000, 0x12C2, 0}, {0x00000000, 0x12D2, 0}, {0x00000000, 0x12E2, 0}, {0x00000000, 0x12F2, 0},
+  {0x00000000, 0x1302, 0}, {0x00000000, 0x1312, 0}, {0x00000000, 0x1322, 0}, {0x00000085, 0x1332, 0},
+  {0x00000000, 0x1342, 0}, {0x00000085, 0x1352, 0}, {0x00000000, 0x1362, 0}, {0x00000085, 0x1372, 0},
+  {0x00000000, 0x1382, 0}, {0x00000085, 0x1392, 0}, {0x00000000, 0x13A2, 0}, {0x00000085, 0x13B2, 0},
+  {0x00000000, 0x13C2, 0}, {0x00000085, 0x13D2, 0}, {0x00000000, 0x13E2, 0}, {0x00000085, 0x13F2, 0},
+  {0x00000000, 0x1402, 0}, {0x00000085, 0x1412, 0}, {0x00000000, 0x1422, 0}, {0x00000085, 0x1432, 0},
+  {0x00000000, 0x1442, 0}, {0x00000085, 0x1452, 0}, {0x00000000, 0x1462, 0}, {0x00000085, 0x1472, 0},
+  {0x00000000, 0x1482, 0}, {0x00000085, 0x1492, 0}, {0x00000000, 0x14A2, 0}, {0x00000085, 0x14B2, 0},
+  {0x00000000, 0x14C2, 0}, {0x00000085, 0x14D2, 0}, {0x00000000, 0x14E2, 0}, {0x00000085, 0x14F2, 0},
+  {0x00000000, 0x1502, 0}, {0x00000085, 0x1512, 0}, {0x00000000, 0x1522, 0}, {0x00000085, 0x1532, 0},
+  {0x00000000, 0x1542, 0}, {0x00000085, 0x1552, 0}, {0x00000000, 0x1562, 0}, {0x00001805, 0x0000, 0},
+  {0x00001A09, 0x0000, 0}, {0x00000000, 0x0000, 222}, {0x00000000, 0x0000, 228}, {0x00000000, 0x0000, 10},
+  {0x00000000, 0x0000, 11}, {0x00000000, 0x0000, 12}, {0x00000000, 0x0000, 13}, {0x00000000, 0x0000, 14},
+  {0x00000000, 0x0000, 15}, {0x00000000, 0x0000, 16}, {0x00000000, 0x0000, 17}, {0x00000000, 0x0000, 18},
+  {0x00000000, 0x0000, 19}, {0x00000000, 0x0000, 20}, {0x00000000, 0x0000, 21}, {0x00000000, 0x0000, 22},
+  {0x00000000, 0x0000, 23}, {0x00000000, 0x0000, 24}, {0x00000000, 0x0000, 25}, {0x00000000, 0x0000, 30},
+  {0x00000000, 0x0000, 31}, {0x00000000, 0x0000, 32}, {0x00000000, 0x1572, 0}, {0x00000000, 0x1582, 0},
+  {0x00000000, 0x1592, 0}, {0x00000000, 0x15A2, 0}, {0x00000000, 0x15B2, 0}, {0x00000000, 0x0000, 27},
+  {0x00000000, 0x0000, 28}, {0x00000000, 0x0000, 29}, {0x00000000, 0x0000, 33}, {0x00000000, 0x0000, 34},
+  {0x00000000, 0x0000, 35}, {0x00001B09, 0x0000, 0}, {0x00001C09, 0x0000, 0}, {0x00001D09, 0x0000, 0},
+  {0x00001E09, 0x0000, 0}, {0x00000000, 0x15C2, 0}, {0x00000000, 0x15D2, 0}, {0x00000000, 0x15E2, 0},
+  {0x00000000, 0x0000, 36}, {0x00000000, 0x15F2, 0}, {0x00000000, 0x1602, 0}, {0x00000000, 0x1612, 0},
+  {0x00000000, 0x0000, 7}, {0x00000000, 0x0000, 9}, {0x00001F09, 0x1622, 0}, {0x00002009, 0x1632, 0},
+  {0x00002109, 0x1642, 0}, {0x00002209, 0x1652, 0}, {0x00002309, 0x1662, 0}, {0x00002409, 0x1672, 0},
+  {0x00002509, 0x1682, 0}, {0x00002609, 0x1692, 0}, {0x00000000, 0x16A2, 0}, {0x00000000, 0x16B2, 0},
+  {0x00002709, 0x16C2, 0}, {0x00002809, 0x16D2, 0}, {0x00002909, 0x16E2, 0}, {0x00002A09, 0x16F2, 0},
+  {0x00002B09, 0x1702, 0}, {0x00002C09, 0x1712, 0}, {0x00002D09, 0x1722, 0}, {0x00002E09, 0x1732, 0},
+  {0x00002F09, 0x1742, 0}, {0x00000000, 0x1752, 0}, {0x00000000, 0x1762, 0}, {0x00000000, 0x1772, 0},
+  {0x00003009, 0x1782, 0}, {0x00003109, 0x1792, 0}, {0x00000000, 0x17A2, 0}, {0x00000000, 0x17B2, 0},
+  {0x00000000, 0x17C2, 0}, {0x00000000, 0x17D2, 0}, {0x00000000, 0x17E2, 0}, {0x00000000, 0x0000, 84},
+  {0x00000000, 0x0000, 91}, {0x00000000, 0x17F2, 0}, {0x00000000, 0x1802, 0}, {0x00000000, 0x1812, 0},
+  {0x00000000, 0x1822, 0}, {0x00000000, 0x1833, 0}, {0x00000000, 0x184A, 0}, {0x00000000, 0x185A, 0},
+  {0x00000000, 0x186A, 0}, {0x00000000, 0x187A, 0}, {0x00000000, 0x188A, 0}, {0x00000000, 0x189B, 0},
+  {0x00000000, 0x18B2, 0}, {0x00003209, 0x0000, 0}, {0x00000000, 0x0000, 103}, {0x00000000, 0x0000, 107},
+  {0x00003309, 0x0000, 0}, {0x00000000, 0x0000, 118}, {0x00000000, 0x0000, 122}, {0x00003409, 0x0000, 0},
+  {0x00003509, 0x0000, 0}, {0xFFFFFF85, 0x0000, 0}, {0x00003609, 0x18C2, 0}, {0x00003709, 0x18D2, 0},
+  {0x00003809, 0x18E2, 0}, {0x00003909, 0x18F2, 0}, {0x00003A09, 0x1902, 0}, {0x00003B09, 0x1912, 0},
+  {0x00000000, 0x0000, 129}, {0x00000000, 0x0000, 130}, {0x00003C09, 0x1922, 0}, {0x00000000, 0x0000, 132},
+  {0x00003D09, 0x1932, 0}, {0x00003E09, 0x1942, 0}, {0x00003F0D, 0x0000, 0}, {0x00004089, 0x1952, 0},
+  {0x0000418D, 0x0000, 0}, {0x00004309, 0x1962, 0}, {0x00004409, 0x1972, 0}, {0x00004509, 0x1982, 0},
+  {0x00004609, 0x1992, 0}, {0x00004709, 0x19A2, 0}, {0x00004809, 0x19B2, 0}, {0x00004909, 0x19C2, 0},
+  {0x00000000, 0x19D2, 0}, {0x000E3005, 0x0000, 0}, {0xFFFFF005, 0x0000, 0}, {0xFFFFFC05, 0x0000, 0},
+  {0x00000000, 0x19E2, 0}, {0x00000000, 0x19F2, 0}, {0x00000000, 0x1A02, 0}, {0x00000000, 0x1A12, 0},
+  {0x00000000, 0x1A22, 0}, {0x00000000, 0x1A32, 0}, {0x00000000, 0x1A42, 0}, {0x00000000, 0x1A52, 0},
+  {0x00000000, 0x1A62, 0}, {0x00000000, 0x1A72, 0}, {0x00000000, 0x1A82, 0}, {0xFFF3D905, 0x0000, 0},
+  {0xFFF3D985, 0x0000, 0}, {0xFFF3DE05, 0x0000, 0}, {0xFFF3DF05, 0x0000, 0}, {0xFFF3DE85, 0x0000, 0},
+  {0xFFF3E205, 0x0000, 0}, {0xFFF3EE05, 0x0000, 0}, {0x0044E185, 0x0000, 0}, {0xFFFA2005, 0x0000, 0},
+  {0xFFF19A85, 0x0000, 0}, {0xFFF1DC85, 0x0000, 0}, {0xFFF19A05, 0x0000, 0}, {0xFFF25585, 0x0000, 0},
+  {0xFFF19985, 0x0000, 0}, {0xFFF27305, 0x0000, 0}, {0xFFF19905, 0x0000, 0}, {0xFFF18F05, 0x0000, 0},
+  {0xFFF28605, 0x0000, 0}, {0xFFFFDE05, 0x0000, 0}, {0xFFF18D85, 0x0000, 0}, {0xFFF18E05, 0x0000, 0},
+  {0xFFF28785, 0x0000, 0}, {0xFFF28805, 0x0000, 0}, {0xFFF18D05, 0x0000, 0}, {0xFFF18E85, 0x0000, 0},
+  {0xFFF1FD05, 0x0000, 0}, {0xFFF28085, 0x0000, 0}, {0xFFFFE105, 0x0000, 0}, {0xFFF28A85, 0x0000, 0},
+  {0xFFFFE485, 0x0000, 0}, {0xFFF32A85, 0x0000, 0}, {0xFFF33305, 0x0000, 0}, {0xFFF18385, 0x0000, 0},
+  {0xFFF18785, 0x0000, 0}, {0xFFF18885, 0x0000, 0}, {0xFFF32605, 0x0000, 0}, {0xFFF32C85, 0x0000, 0},
+  {0xFFF32E85, 0x0000, 0}, {0xFFF36285, 0x0000, 0}, {0xFFF25B85, 0x0000, 0}, {0xFFF16385, 0x0000, 0},
+  {0xFFF25C05, 0x0000, 0}, {0xFFF1A905, 0x0000, 0}, {0xFFF25E85, 0x0000, 0}, {0xFFF16305, 0x0000, 0},
+  {0xFFF25F05, 0x0000, 0}, {0xFFF25F85, 0x0000, 0}, {0xFFF26105, 0x0000, 0}, {0xFFF26205, 0x0000, 0},
+  {0xFFFFEA05, 0x0000, 0}, {0xFFF27A85, 0x0000, 0}, {0xFFFFED85, 0x0000, 0}, {0xFFF27A05, 0x0000, 0},
+  {0xFFF26285, 0x0000, 0}, {0xFFF26185, 0x0000, 0}, {0xFFF26305, 0x0000, 0}, {0xFFF26785, 0x0000, 0},
+  {0xFFF1FB05, 0x0000, 0}, {0xFFF26985, 0x0000, 0}, {0xFFFFB205, 0x0000, 0}, {0xFFF26905, 0x0000, 0},
+  {0xFFF15F85, 0x0000, 0}, {0xFFF26A05, 0x0000, 0}, {0xFFF2FC85, 0x0000, 0}, {0x00000000, 0x0000, 214},
+  {0x00000000, 0x0000, 218}, {0x00000085, 0x1A92, 0}, {0x00000000, 0x1AA2, 0}, {0x00000085, 0x1AB2, 0},
+  {0x00000000, 0x1AC2, 0}, {0x00000085, 0x1AD2, 0}, {0x00000000, 0x1AE2, 0}, {0x00000085, 0x1AF2, 0},
+  {0x00000000, 0x1B02, 0}, {0x00000085, 0x1B13, 0}, {0x00000000, 0x1B2B, 0}, {0x00000085, 0x1B42, 0},
+  {0x00000000, 0x1B52, 0}, {0x00000085, 0x1B62, 0}, {0x00000000, 0x1B72, 0}, {0x00000085, 0x1B82, 0},
+  {0x00000000, 0x1B92, 0}, {0x00000085, 0x1BA2, 0}, {0x00000000, 0x1BB2, 0}, {0x00000085, 0x1BC2, 0},
+  {0x00000000, 0x1BD2, 0}, {0x00000085, 0x1BE3, 0}, {0x00000000, 0x1BFB, 0}, {0x00000085, 0x1C13, 0},
+  {0x00000000, 0x1C2B, 0}, {0x00000085, 0x1C42, 0}, {0x00000000, 0x1C52, 0}, {0x00000085, 0x1C62, 0},
+  {0x00000000, 0x1C72, 0}, {0x00000085, 0x1C83, 0}, {0x00000000, 0x1C9B, 0}, {0x00000085, 0x1CB2, 0},
+  {0x00000000, 0x1CC2, 0}, {0x00000085, 0x1CD2, 0}, {0x00000000, 0x1CE2, 0}, {0x00000085, 0x1CF2, 0},
+  {0x00000000, 0x1D02, 0}, {0x00000085, 0x1D12, 0}, {0x00000000, 0x1D22, 0}, {0x00000085, 0x1D32, 0},
+  {0x00000000, 0x1D42, 0}, {0x00000085, 0x1D52, 0}, {0x00000000, 0x1D62, 0}, {0x00000085, 0x1D72, 0},
+  {0x00000000, 0x1D82, 0}, {0x00000085, 0x1D92, 0}, {0x00000000, 0x1DA2, 0}, {0x00000085, 0x1DB3, 0},
+  {0x00000000, 0x1DCB, 0}, {0x00000085, 0x1DE2, 0}, {0x00000000, 0x1DF2, 0}, {0x00000085, 0x1E02, 0},
+  {0x00000000, 0x1E12, 0}, {0x00000085, 0x1E22, 0}, {0x00000000, 0x1E32, 0}, {0x00000085, 0x1E42, 0},
+  {0x00000000, 0x1E52, 0}, {0x00000085, 0x1E63, 0}, {0x00000000, 0x1E7B, 0}, {0x00000085, 0x1E92, 0},
+  {0x00000000, 0x1EA2, 0}, {0x00000085, 0x1EB2, 0}, {0x00000000, 0x1EC2, 0}, {0x00000085, 0x1ED2, 0},
+  {0x00000000, 0x1EE2, 0}, {0x00000085, 0x1EF2, 0}, {0x00000000, 0x1F02, 0}, {0x00000085, 0x1F12, 0},
+  {0x00000000, 0x1F22, 0}, {0x00000085, 0x1F32, 0}, {0x00000000, 0x1F42, 0}, {0x00000085, 0x1F52, 0},
+  {0x00000000, 0x1F62, 0}, {0x00000085, 0x1F72, 0}, {0x00000000, 0x1F82, 0}, {0x00000085, 0x1F92, 0},
+  {0x00000000, 0x1FA2, 0}, {0x00000085, 0x1FB3, 0}, {0x00000000, 0x1FCB, 0}, {0x00000085, 0x1FE3, 0},
+  {0x00000000, 0x1FFB, 0}, {0x00000085, 0x2013, 0}, {0x00000000, 0x202B, 0}, {0x00000085, 0x2043, 0},
+  {0x00000000, 0x205B, 0}, {0x00000085, 0x2072, 0}, {0x00000000, 0x2082, 0}, {0x00000085, 0x2092, 0},
+  {0x00000000, 0x20A2, 0}, {0x00000085, 0x20B2, 0}, {0x00000000, 0x20C2, 0}, {0x00000085, 0x20D2, 0},
+  {0x00000000, 0x20E2, 0}, {0x00000085, 0x20F3, 0}, {0x00000000, 0x210B, 0}, {0x00000085, 0x2122, 0},
+  {0x00000000, 0x2132, 0}, {0x00000085, 0x2142, 0}, {0x00000000, 0x2152, 0}, {0x00000085, 0x2162, 0},
+  {0x00000000, 0x2172, 0}, {0x00000085, 0x2183, 0}, {0x00000000, 0x219B, 0}, {0x00000085, 0x21B3, 0},
+  {0x00000000, 0x21CB, 0}, {0x00000085, 0x21E3, 0}, {0x00000000, 0x21FB, 0}, {0x00000085, 0x2212, 0},
+  {0x00000000, 0x2222, 0}, {0x00000085, 0x2232, 0}, {0x00000000, 0x2242, 0}, {0x00000085, 0x2252, 0},
+  {0x00000000, 0x2262, 0}, {0x00000085, 0x2272, 0}, {0x00000000, 0x2282, 0}, {0x00000085, 0x2292, 0},
+  {0x00000000, 0x22A2, 0}, {0x00000085, 0x22B2, 0}, {0x00000000, 0x22C2, 0}, {0x00000085, 0x22D2, 0},
+  {0x00000000, 0x22E2, 0}, {0x00000085, 0x22F3, 0}, {0x00000000, 0x230B, 0}, {0x00000085, 0x2323, 0},
+  {0x00000000, 0x233B, 0}, {0x00000085, 0x2352, 0}, {0x00000000, 0x2362, 0}, {0x00000085, 0x2372, 0},
+  {0x00000000, 0x2382, 0}, {0x00000085, 0x2392, 0}, {0x00000000, 0x23A2, 0}, {0x00000085, 0x23B2, 0},
+  {0x00000000, 0x23C2, 0}, {0x00000085, 0x23D2, 0}, {0x00000000, 0x23E2, 0}, {0x00000085, 0x23F2, 0},
+  {0x00000000, 0x2402, 0}, {0x00000085, 0x2412, 0}, {0x00000000, 0x2422, 0}, {0x00000085, 0x2432, 0},
+  {0x00000000, 0x2442, 0}, {0x00000085, 0x2452, 0}, {0x00000000, 0x2462, 0}, {0x00000085, 0x2472, 0},
+  {0x00000000, 0x2482, 0}, {0x00000085, 0x2492, 0}, {0x00000000, 0x24A2, 0}, {0x00000085, 0x24B2, 0},
+  {0x00000000, 0x24C2, 0}, {0x00000085, 0x24D2, 0}, {0x00000000, 0x24E2, 0}, {0x00000000, 0x24F2, 0},
+  {0x00000000, 0x2502, 0}, {0x00000000, 0x2512, 0}, {0x00000000, 0x2522, 0}, {0x00004A09, 0x0000, 0},
+  {0xFFFFE305, 0x2532, 0}, {0xFFF12085, 0x0000, 0}, {0x00000085, 0x2542, 0}, {0x00000000, 0x2552, 0},
+  {0x00000085, 0x2562, 0}, {0x00000000, 0x2572, 0}, {0x00000085, 0x2583, 0}, {0x00000000, 0x259B, 0},
+  {0x00000085, 0x25B3, 0}, {0x00000000, 0x25CB, 0}, {0x00000085, 0x25E3, 0}, {0x00000000, 0x25FB, 0},
+  {0x00000085, 0x2613, 0}, {0x00000000, 0x262B, 0}, {0x00000085, 0x2643, 0}, {0x00000000, 0x265B, 0},
+  {0x00000085, 0x2673, 0}, {0x00000000, 0x268B, 0}, {0x00000085, 0x26A3, 0}, {0x00000000, 0x26BB, 0},
+  {0x00000085, 0x26D3, 0}, {0x00000000, 0x26EB, 0}, {0x00000085, 0x2703, 0}, {0x00000000, 0x271B, 0},
+  {0x00000085, 0x2733, 0}, {0x00000000, 0x274B, 0}, {0x00000085, 0x2762, 0}, {0x00000000, 0x2772, 0},
+  {0x00000085, 0x2782, 0}, {0x00000000, 0x2792, 0}, {0x00000085, 0x27A2, 0}, {0x00000000, 0x27B2, 0},
+  {0x00000085, 0x27C3, 0}, {0x00000000, 0x27DB, 0}, {0x00000085, 0x27F3, 0}, {0x00000000, 0x280B, 0},
+  {0x00000085, 0x2823, 0}, {0x00000000, 0x283B, 0}, {0x00000085, 0x2853, 0}, {0x00000000, 0x286B, 0},
+  {0x00000085, 0x2883, 0}, {0x00000000, 0x289B, 0}, {0x00000085, 0x28B2, 0}, {0x00000000, 0x28C2, 0},
+  {0x00000085, 0x28D2, 0}, {0x00000000, 0x28E2, 0}, {0x00000085, 0x28F2, 0}, {0x00000000, 0x2902, 0},
+  {0x00000085, 0x2912, 0}, {0x00000000, 0x2922, 0}, {0x00000085, 0x2933, 0}, {0x00000000, 0x294B, 0},
+  {0x00000085, 0x2963, 0}, {0x00000000, 0x297B, 0}, {0x00000085, 0x2993, 0}, {0x00000000, 0x29AB, 0},
+  {0x00000085, 0x29C3, 0}, {0x00000000, 0x29DB, 0}, {0x00000085, 0x29F3, 0}, {0x00000000, 0x2A0B, 0},
+  {0x00000085, 0x2A23, 0}, {0x00000000, 0x2A3B, 0}, {0x00000085, 0x2A53, 0}, {0x00000000, 0x2A6B, 0},
+  {0x00000085, 0x2A83, 0}, {0x00000000, 0x2A9B, 0}, {0x00000085, 0x2AB3, 0}, {0x00000000, 0x2ACB, 0},
+  {0x00000085, 0x2AE3, 0}, {0x00000000, 0x2AFB, 0}, {0x00000085, 0x2B12, 0}, {0x00000000, 0x2B22, 0},
+  {0x00000085, 0x2B32, 0}, {0x00000000, 0x2B42, 0}, {0x00000085, 0x2B53, 0}, {0x00000000, 0x2B6B, 0},
+  {0x00000085, 0x2B83, 0}, {0x00000000, 0x2B9B, 0}, {0x00000085, 0x2BB3, 0}, {0x00000000, 0x2BCB, 0},
+  {0x00000085, 0x2BE3, 0}, {0x00000000, 0x2BFB, 0}, {0x00000085, 0x2C13, 0}, {0x00000000, 0x2C2B, 0},
+  {0x00000085, 0x2C42, 0}, {0x00000000, 0x2C52, 0}, {0x00000085, 0x2C62, 0}, {0x00000000, 0x2C72, 0},
+  {0x00000085, 0x2C82, 0}, {0x00000000, 0x2C92, 0}, {0x00000085, 0x2CA2, 0}, {0x00000000, 0x2CB2, 0},
+  {0x00000000, 0x2CC2, 0}, {0x00000000, 0x2CD2, 0}, {0x00000000, 0x2CE3, 0}, {0x00000000, 0x2CFB, 0},
+  {0x00000000, 0x2D13, 0}, {0x00000000, 0x2D2B, 0}, {0x00000000, 0x2D43, 0}, {0x00000000, 0x2D5B, 0},
+  {0xFFFFFC05, 0x2D72, 0}, {0xFFFFFC05, 0x2D82, 0}, {0xFFFFFC05, 0x2D93, 0}, {0xFFFFFC05, 0x2DAB, 0},
+  {0xFFFFFC05, 0x2DC3, 0}, {0xFFFFFC05, 0x2DDB, 0}, {0xFFFFFC05, 0x2DF3, 0}, {0xFFFFFC05, 0x2E0B, 0},
+  {0x00000000, 0x2E22, 0}, {0x00000000, 0x2E32, 0}, {0x00000000, 0x2E43, 0}, {0x00000000, 0x2E5B, 0},
+  {0x00000000, 0x2E73, 0}, {0x00000000, 0x2E8B, 0}, {0xFFFFFC05, 0x2EA2, 0}, {0xFFFFFC05, 0x2EB2, 0},
+  {0xFFFFFC05, 0x2EC3, 0}, {0xFFFFFC05, 0x2EDB, 0}, {0xFFFFFC05, 0x2EF3, 0}, {0xFFFFFC05, 0x2F0B, 0},
+  {0x00000000, 0x2F22, 0}, {0x00000000, 0x2F32, 0}, {0x00000000, 0x2F43, 0}, {0x00000000, 0x2F5B, 0},
+  {0x00000000, 0x2F73, 0}, {0x00000000, 0x2F8B, 0}, {0x00000000, 0x2FA3, 0}, {0x00000000, 0x2FBB, 0},
+  {0xFFFFFC05, 0x2FD2, 0}, {0xFFFFFC05, 0x2FE2, 0}, {0xFFFFFC05, 0x2FF3, 0}, {0xFFFFFC05, 0x300B, 0},
+  {0xFFFFFC05, 0x3023, 0}, {0xFFFFFC05, 0x303B, 0}, {0xFFFFFC05, 0x3053, 0}, {0xFFFFFC05, 0x306B, 0},
+  {0x00000000, 0x3082, 0}, {0x00000000, 0x3092, 0}, {0x00000000, 0x30A3, 0}, {0x00000000, 0x30BB, 0},
+  {0x00000000, 0x30D3, 0}, {0x00000000, 0x30EB, 0}, {0x00000000, 0x3103, 0}, {0x00000000, 0x311B, 0},
+  {0xFFFFFC05, 0x3132, 0}, {0xFFFFFC05, 0x3142, 0}, {0xFFFFFC05, 0x3153, 0}, {0xFFFFFC05, 0x316B, 0},
+  {0xFFFFFC05, 0x3183, 0}, {0xFFFFFC05, 0x319B, 0}, {0xFFFFFC05, 0x31B3, 0}, {0xFFFFFC05, 0x31CB, 0},
+  {0x00000000, 0x31E2, 0}, {0x00000000, 0x31F2, 0}, {0x00000000, 0x3203, 0}, {0x00000000, 0x321B, 0},
+  {0x00000000, 0x3233, 0}, {0x00000000, 0x324B, 0}, {0xFFFFFC05, 0x3262, 0}, {0xFFFFFC05, 0x3272, 0},
+  {0xFFFFFC05, 0x3283, 0}, {0xFFFFFC05, 0x329B, 0}, {0xFFFFFC05, 0x32B3, 0}, {0xFFFFFC05, 0x32CB, 0},
+  {0x00000000, 0x32E2, 0}, {0x00000000, 0x32F2, 0}, {0x00000000, 0x3303, 0}, {0x00000000, 0x331B, 0},
+  {0x00000000, 0x3333, 0}, {0x00000000, 0x334B, 0}, {0x00000000, 0x3363, 0}, {0x00000000, 0x337B, 0},
+  {0xFFFFFC05, 0x3392, 0}, {0xFFFFFC05, 0x33A3, 0}, {0xFFFFFC05, 0x33BB, 0}, {0xFFFFFC05, 0x33D3, 0},
+  {0x00000000, 0x33EA, 0}, {0x00000000, 0x33FA, 0}, {0x00000000, 0x340B, 0}, {0x00000000, 0x3423, 0},
+  {0x00000000, 0x343B, 0}, {0x00000000, 0x3453, 0}, {0x00000000, 0x346B, 0}, {0x00000000, 0x3483, 0},
+  {0xFFFFFC05, 0x349A, 0}, {0xFFFFFC05, 0x34AA, 0}, {0xFFFFFC05, 0x34BB, 0}, {0xFFFFFC05, 0x34D3, 0},
+  {0xFFFFFC05, 0x34EB, 0}, {0xFFFFFC05, 0x3503, 0}, {0xFFFFFC05, 0x351B, 0}, {0xFFFFFC05, 0x3533, 0},
+  {0x00000000, 0x354A, 0}, {0xFFF21D85, 0x116A, 0}, {0x00000000, 0x355A, 0}, {0xFFF21D05, 0x117A, 0},
+  {0x00000000, 0x356A, 0}, {0xFFF21C85, 0x118A, 0}, {0x00000000, 0x357A, 0}, {0xFFF21C05, 0x119A, 0},
+  {0x00000000, 0x358A, 0}, {0xFFF22985, 0x11E2, 0}, {0x00000000, 0x359A, 0}, {0xFFF22905, 0x11F2, 0},
+  {0x00000000, 0x35AA, 0}, {0xFFF22885, 0x1202, 0}, {0x00004B09, 0x35BB, 0}, {0x00004C09, 0x35D3, 0},
+  {0x00004D09, 0x35EC, 0}, {0x00004E09, 0x360C, 0}, {0x00004F09, 0x362C, 0}, {0x00005009, 0x364C, 0},
+  {0x00005109, 0x366C, 0}, {0x00005209, 0x368C, 0}, {0x00004B09, 0x36AB, 0}, {0x00004C09, 0x36C3, 0},
+  {0x00004D09, 0x36DC, 0}, {0x00004E09, 0x36FC, 0}, {0x00004F09, 0x371C, 0}, {0x00005009, 0x373C, 0},
+  {0x00005109, 0x375C, 0}, {0x00005209, 0x377C, 0}, {0x00005309, 0x379B, 0}, {0x00005409, 0x37B3, 0},
+  {0x00005509, 0x37CC, 0}, {0x00005609, 0x37EC, 0}, {0x00005709, 0x380C, 0}, {0x00005809, 0x382C, 0},
+  {0x00005909, 0x384C, 0}, {0x00005A09, 0x386C, 0}, {0x00005309, 0x388B, 0}, {0x00005409, 0x38A3, 0},
+  {0x00005509, 0x38BC, 0}, {0x00005609, 0x38DC, 0}, {0x00005709, 0x38FC, 0}, {0x00005809, 0x391C, 0},
+  {0x00005909, 0x393C, 0}, {0x00005A09, 0x395C, 0}, {0x00005B09, 0x397B, 0}, {0x00005C09, 0x3993, 0},
+  {0x00005D09, 0x39AC, 0}, {0x00005E09, 0x39CC, 0}, {0x00005F09, 0x39EC, 0}, {0x00006009, 0x3A0C, 0},
+  {0x00006109, 0x3A2C, 0}, {0x00006209, 0x3A4C, 0}, {0x00005B09, 0x3A6B, 0}, {0x00005C09, 0x3A83, 0},
+  {0x00005D09, 0x3A9C, 0}, {0x00005E09, 0x3ABC, 0}, {0x00005F09, 0x3ADC, 0}, {0x00006009, 0x3AFC, 0},
+  {0x00006109, 0x3B1C, 0}, {0x00006209, 0x3B3C, 0}, {0x00000000, 0x3B5A, 0}, {0x00000000, 0x3B6A, 0},
+  {0x00006309, 0x3B7B, 0}, {0x00006409, 0x3B92, 0}, {0x00006509, 0x3BA3, 0}, {0x00000000, 0x3BBA, 0},
+  {0x00006609, 0x3BCB, 0}, {0xFFFFFC05, 0x3BE2, 0}, {0xFFFFFC05, 0x3BF2, 0}, {0xFFFFDB05, 0x3C02, 0},
+  {0xFFF1F885, 0x10BA, 0}, {0x00006409, 0x3C12, 0}, {0x00006709, 0x0000, 0}, {0xFFF1FD85, 0x3C21, 0},
+  {0x00006809, 0x0000, 0}, {0x0000690D, 0x3C2A, 0}, {0x00006A89, 0x3C3B, 0}, {0x00006B89, 0x3C52, 0},
+  {0x00006C89, 0x3C63, 0}, {0x00000000, 0x3C7A, 0}, {0x00006D89, 0x3C8B, 0}, {0xFFFFD505, 0x3CA2, 0},
+  {0xFFF1F205, 0x10D2, 0}, {0xFFFFD505, 0x3CB2, 0}, {0xFFF1F185, 0x10E2, 0}, {0x00006B89, 0x3CC2, 0},
+  {0x00006E8D, 0x3CD2, 0}, {0x0000700D, 0x3CE2, 0}, {0x0000718D, 0x3CF2, 0}, {0x00000000, 0x3D02, 0},
+  {0x00000000, 0x3D12, 0}, {0x00000000, 0x3D23, 0}, {0xFFF1DE85, 0x1133, 0}, {0x00000000, 0x3D3A, 0},
+  {0x00000000, 0x3D4B, 0}, {0xFFFFFC05, 0x3D62, 0}, {0xFFFFFC05, 0x3D72, 0}, {0xFFFFCE05, 0x3D82, 0},
+  {0xFFF1EA05, 0x10F2, 0}, {0x0000730D, 0x3D92, 0}, {0x0000748D, 0x3DA2, 0}, {0x0000760D, 0x3DB2, 0},
+  {0x00000000, 0x3DC2, 0}, {0x00000000, 0x3DD2, 0}, {0x00000000, 0x3DE3, 0}, {0xFFF1E685, 0x11AB, 0},
+  {0x00000000, 0x3DFA, 0}, {0x00000000, 0x3E0A, 0}, {0x00000000, 0x3E1A, 0}, {0x00000000, 0x3E2B, 0},
+  {0xFFFFFC05, 0x3E42, 0}, {0xFFFFFC05, 0x3E52, 0}, {0xFFFFC805, 0x3E62, 0}, {0xFFF1F105, 0x1112, 0},
+  {0xFFFFFC85, 0x3E72, 0}, {0x0000778D, 0x3E82, 0}, {0xFFF03885, 0x3E91, 0}, {0x00007909, 0x3E9B, 0},
+  {0x00007A09, 0x3EB2, 0}, {0x00007B09, 0x3EC3, 0}, {0x00000000, 0x3EDA, 0}, {0x00007C09, 0x3EEB, 0},
+  {0xFFFFC005, 0x3F02, 0}, {0xFFF1E985, 0x1102, 0}, {0xFFFFC105, 0x3F12, 0}, {0xFFF1E985, 0x1122, 0},
+  {0x00007A09, 0x3F22, 0}, {0x00000209, 0x3F31, 0}, {0x00007D09, 0x0000, 0}, {0xFFF01005, 0x3F39, 0},
+  {0xFFF00F85, 0x3F41, 0}, {0xFFF00F05, 0x0000, 0}, {0xFFF00E85, 0x0000, 0}, {0xFFF00E05, 0x0000, 0},
+  {0xFFF00D85, 0x0000, 0}, {0xFFF00D05, 0x0000, 0}, {0xFFF00C85, 0x0000, 0}, {0xFFF00C05, 0x0000, 0},
+  {0xFFF00B85, 0x0000, 0}, {0xFFF00B05, 0x0000, 0}, {0x00007E09, 0x0000, 0}, {0xFFEFF885, 0x0000, 0},
+  {0x00007F09, 0x0000, 0}, {0x0000800D, 0x0000, 0}, {0x00008189, 0x0000, 0}, {0x0000828D, 0x0000, 0},
+  {0x00008409, 0x0000, 0}, {0x00008509, 0x0000, 0}, {0x00008609, 0x0000, 0}, {0x00008709, 0x0000, 0},
+  {0x00008809, 0x0000, 0}, {0x00008911, 0x0000, 0}, {0xFFEFE085, 0x0000, 0}, {0xFFEFE005, 0x0000, 0},
+  {0xFFEFFC05, 0x0000, 0}, {0xFFEFD885, 0x0000, 0}, {0x0000CB85, 0x0000, 0}, {0xFFEFD585, 0x0000, 0},
+  {0xFFEFF785, 0x0000, 0}, {0xFFEFD805, 0x0000, 0}, {0xFFEFD085, 0x0000, 0}, {0x0000C385, 0x0000, 0},
+  {0xFFEFCD85, 0x0000, 0}, {0xFFEFE885, 0x0000, 0}, {0xFFEFEA05, 0x0000, 0}, {0xFFEFEE85, 0x0000, 0},
+  {0xFFEFF285, 0x0000, 0}, {0xFFF0E285, 0x0000, 0}, {0xFFEFE985, 0x0000, 0}, {0xFFEFEA85, 0x0000, 0},
+  {0xFFEFEB05, 0x0000, 0}, {0xFFEFEC05, 0x0000, 0}, {0x00008B09, 0x0000, 0}, {0x00008C0D, 0x0000, 0},
+  {0x00008D8D, 0x0000, 0}, {0xFFEFB085, 0x0000, 0}, {0x00008F09, 0x0000, 0}, {0x0000900D, 0x0000, 0},
+  {0x0000918D, 0x0000, 0}, {0xFFF0AA05, 0x0000, 0}, {0x00009309, 0x0000, 0}, {0xFFEFAE85, 0x0000, 0},
+  {0xFFEFAE05, 0x0000, 0}, {0xFFEFAD85, 0x0000, 0}, {0xFFEFAD05, 0x0000, 0}, {0xFFEFAC85, 0x0000, 0},
+  {0xFFEFAC05, 0x0000, 0}, {0x00009409, 0x0000, 0}, {0xFFEFAB85, 0x0000, 0}, {0xFFEFAB05, 0x0000, 0},
+  {0xFFEFAA85, 0x0000, 0}, {0x00009509, 0x0000, 0}, {0x0000960D, 0x0000, 0}, {0x00009789, 0x0000, 0},
+  {0xFFF15185, 0x3F49, 0}, {0xFFEFA905, 0x0000, 0}, {0xFFEFA085, 0x3F51, 0}, {0xFFEFDD05, 0x0052, 0},
+  {0xFFEF9B05, 0x0000, 0}, {0xFFEF9A85, 0x0000, 0}, {0xFFEF9D05, 0x0000, 0}, {0xFFEF9D85, 0x0000, 0},
+  {0xFFF24D85, 0x0000, 0}, {0xFFEF9805, 0x0000, 0}, {0x0000988D, 0x0000, 0}, {0xFFF14205, 0x0000, 0},
+  {0xFFF13B05, 0x0000, 0}, {0xFFF13A85, 0x0000, 0}, {0xFFF14085, 0x0000, 0}, {0xFFEF8F85, 0x0000, 0},
+  {0xFFEF8F05, 0x0000, 0}, {0xFFEF9085, 0x0000, 0}, {0x00009A0D, 0x0000, 0}, {0x00009B8D, 0x0000, 0},
+  {0x00009D11, 0x0000, 0}, {0x00009F0D, 0x0000, 0}, {0x0000A08D, 0x0000, 0}, {0x0000A20D, 0x0000, 0},
+  {0x0000A38D, 0x0000, 0}, {0x0000A50D, 0x0000, 0}, {0x0000A68D, 0x0000, 0}, {0x0000A80D, 0x0000, 0},
+  {0x0000A98D, 0x0000, 0}, {0x0000AB0D, 0x0000, 0}, {0x0000AC8D, 0x0000, 0}, {0x0000AE0D, 0x0000, 0},
+  {0x0000AF8D, 0x0000, 0}, {0x0000B109, 0x0000, 0}, {0xFFEF8485, 0x0000, 0}, {0x0000B209, 0x0000, 0},
+  {0x0000B30D, 0x0000, 0}, {0x0000B489, 0x0000, 0}, {0xFFEF8905, 0x0000, 0}, {0x0000B589, 0x0000, 0},
+  {0x0000B68D, 0x0000, 0}, {0x0000B811, 0x0000, 0}, {0x0000BA09, 0x0000, 0}, {0xFFEF8785, 0x0000, 0},
+  {0x0000BB09, 0x0000, 0}, {0x0000BC0D, 0x0000, 0}, {0xFFEF8005, 0x0000, 0}, {0xFFEF7B05, 0x0000, 0},
+  {0xFFEF7F05, 0x0000, 0}, {0xFFEF7C85, 0x0000, 0}, {0xFFEF8105, 0x0000, 0}, {0xFFEF7F85, 0x0000, 0},
+  {0xFFEF7805, 0x0000, 0}, {0xFFEF7305, 0x0000, 0}, {0xFFEF7705, 0x0000, 0}, {0x0000BD8D, 0x0000, 0},
+  {0x00000000, 0x3F5A, 0}, {0x00000000, 0x3F6A, 0}, {0x00000000, 0x3F7A, 0}, {0x00000000, 0x3F8A, 0},
+  {0x00000000, 0x3F9A, 0}, {0x00000000, 0x3FAA, 0}, {0x00000000, 0x3FBA, 0}, {0x00000000, 0x3FCA, 0},
+  {0x00000000, 0x3FDA, 0}, {0x00000000, 0x3FEA, 0}, {0x00000000, 0x3FFA, 0}, {0x0000BF09, 0x0000, 0},
+  {0x0000C00D, 0x0000, 0}, {0x0000C189, 0x0000, 0}, {0x0000C28D, 0x0000, 0}, {0x00000000, 0x400A, 0},
+  {0x00000000, 0x401A, 0}, {0x00000000, 0x402A, 0}, {0x00000000, 0x403A, 0}, {0x00000000, 0x404A, 0},
+  {0x00000000, 0x405A, 0}, {0x00000000, 0x406A, 0}, {0x00000000, 0x407A, 0}, {0x00000000, 0x408A, 0},
+  {0x00000000, 0x409A, 0}, {0x00000000, 0x40AA, 0}, {0x00000000, 0x40BA, 0}, {0x00000000, 0x40CA, 0},
+  {0x00000000, 0x40DA, 0}, {0x00000000, 0x40EA, 0}, {0x00000000, 0x40FA, 0}, {0x00000000, 0x410A, 0},
+  {0x00000000, 0x411A, 0}, {0x00000000, 0x412A, 0}, {0x00000000, 0x413A, 0}, {0x00000000, 0x414A, 0},
+  {0x00000000, 0x415A, 0}, {0x00000000, 0x416A, 0}, {0x00000000, 0x417A, 0}, {0x00000000, 0x418A, 0},
+  {0x00000000, 0x419A, 0}, {0x00000000, 0x41AA, 0}, {0x00000000, 0x41BA, 0}, {0x00000000, 0x41CA, 0},
+  {0x00000000, 0x41DA, 0}, {0x00000000, 0x41EA, 0}, {0x00000000, 0x41FA, 0}, {0x00000000, 0x420A, 0},
+  {0x00066F85, 0x4219, 0}, {0x00066F85, 0x4221, 0}, {0xFFEDE885, 0x0000, 0}, {0x0000C409, 0x0000, 0},
+  {0x0000C509, 0x0000, 0}, {0x0000C609, 0x0000, 0}, {0x0000C709, 0x0000, 0}, {0x0000C809, 0x0000, 0},
+  {0x0000C909, 0x0000, 0}, {0x0000CA09, 0x0000, 0}, {0x0000CB09, 0x0000, 0}, {0x0000CC09, 0x0000, 0},
+  {0x0000CD09, 0x0000, 0}, {0x0000CE09, 0x0000, 0}, {0x0000CF0D, 0x0000, 0}, {0x0000D08D, 0x0000, 0},
+  {0x0000D20D, 0x0000, 0}, {0x0000D38D, 0x0000, 0}, {0x0000D50D, 0x0000, 0}, {0x0000D68D, 0x0000, 0},
+  {0x0000D80D, 0x0000, 0}, {0x0000D98D, 0x0000, 0}, {0x0000DB0D, 0x0000, 0}, {0x0000DC91, 0x0000, 0},
+  {0x0000DE91, 0x0000, 0}, {0x0000E091, 0x0000, 0}, {0x0000E291, 0x0000, 0}, {0x0000E491, 0x0000, 0},
+  {0x0000E691, 0x0000, 0}, {0x0000E891, 0x0000, 0}, {0x0000EA91, 0x0000, 0}, {0x0000EC91, 0x0000, 0},
+  {0x0000EE91, 0x0000, 0}, {0x0000F091, 0x0000, 0}, {0x0000F28D, 0x0000, 0}, {0x0000F40D, 0x0000, 0},
+  {0x0000F58D, 0x0000, 0}, {0x0000F70D, 0x0000, 0}, {0x0000F88D, 0x0000, 0}, {0x0000FA0D, 0x0000, 0},
+  {0x0000FB8D, 0x0000, 0}, {0x0000FD0D, 0x0000, 0}, {0x0000FE8D, 0x0000, 0}, {0x0001000D, 0x0000, 0},
+  {0x0001018D, 0x0000, 0}, {0x0001030D, 0x0000, 0}, {0x0001048D, 0x0000, 0}, {0x0001060D, 0x0000, 0},
+  {0x0001078D, 0x0000, 0}, {0x0001090D, 0x0000, 0}, {0x00010A8D, 0x0000, 0}, {0x00010C0D, 0x0000, 0},
+  {0x00010D8D, 0x0000, 0}, {0x00010F0D, 0x0000, 0}, {0x0001108D, 0x0000, 0}, {0x0001120D, 0x0000, 0},
+  {0x0001138D, 0x0000, 0}, {0x0001150D, 0x0000, 0}, {0x0001168D, 0x0000, 0}, {0x0001180D, 0x0000, 0},
+  {0xFFEDD585, 0x0000, 0}, {0xFFEDC885, 0x0000, 0}, {0xFFEDA305, 0x0000, 0}, {0x00011991, 0x0000, 0},
+  {0x00011B8D, 0x0000, 0}, {0x00011D09, 0x0000, 0}, {0x00011E0D, 0x0000, 0}, {0x00011F89, 0x422A, 0},
+  {0xFFEB0485, 0x0000, 0}, {0xFFF88D05, 0x0000, 0}, {0xFFEB0C85, 0x0000, 0}, {0xFFEAF205, 0x0000, 0},
+  {0xFFEB0185, 0x0000, 0}, {0xFFEAF085, 0x0000, 0}, {0xFFEAF105, 0x0000, 0}, {0xFFE9F705, 0x0000, 0},
+  {0xFFE9FC85, 0x0000, 0}, {0xFFEAE085, 0x0000, 0}, {0xFFFFF905, 0x0000, 0}, {0x001E9705, 0x0000, 0},
+  {0x00385605, 0x0000, 0}, {0x000F8005, 0x0000, 0}, {0x000F9385, 0x0000, 0}, {0x000F9A05, 0x0000, 0},
+  {0x000F9E05, 0x0000, 0}, {0x000FAA85, 0x0000, 0}, {0x000FC005, 0x0000, 0}, {0x000FC305, 0x0000, 0},
+  {0x000FCC85, 0x0000, 0}, {0x000FD905, 0x0000, 0}, {0x00111B05, 0x0000, 0}, {0x00112D85, 0x0000, 0},
+  {0x00113005, 0x0000, 0}, {0x00113B05, 0x0000, 0}, {0x00114485, 0x0000, 0}, {0x00114E85, 0x0000, 0},
+  {0x00116885, 0x0000, 0}, {0x00117285, 0x0000, 0}, {0x00117785, 0x0000, 0}, {0x0011C485, 0x0000, 0},
+  {0x0011F305, 0x0000, 0}, {0x00120085, 0x0000, 0}, {0x00120285, 0x0000, 0}, {0x00121105, 0x0000, 0},
+  {0x00121505, 0x0000, 0}, {0x00122205, 0x0000, 0}, {0x00122805, 0x0000, 0}, {0x00123405, 0x0000, 0},
+  {0x00124D85, 0x0000, 0}, {0x00125605, 0x0000, 0}, {0x00126305, 0x0000, 0}, {0x0013DC85, 0x0000, 0},
+  {0x00140005, 0x0000, 0}, {0x0014E585, 0x0000, 0}, {0x0014F085, 0x0000, 0}, {0x0014F405, 0x0000, 0},
+  {0x0014F905, 0x0000, 0}, {0x00150185, 0x0000, 0}, {0x00152705, 0x0000, 0}, {0x00161505, 0x0000, 0},
+  {0x00162C85, 0x0000, 0}, {0x00166805, 0x0000, 0}, {0x00167305, 0x0000, 0}, {0x00167C05, 0x0000, 0},
+  {0x00168685, 0x0000, 0}, {0x0016A105, 0x0000, 0}, {0x0016A205, 0x0000, 0}, {0x00175685, 0x0000, 0},
+  {0x00175B05, 0x0000, 0}, {0x00176085, 0x0000, 0}, {0x00176685, 0x0000, 0}, {0x0017A005, 0x0000, 0},
+  {0x0017A385, 0x0000, 0}, {0x0017A585, 0x0000, 0}, {0x0017DF85, 0x0000, 0}, {0x0017E405, 0x0000, 0},
+  {0x0017EA05, 0x0000, 0}, {0x0017ED85, 0x0000, 0}, {0x00180B85, 0x0000, 0}, {0x00181385, 0x0000, 0},
+  {0x00181C05, 0x0000, 0}, {0x00184385, 0x0000, 0}, {0x00196585, 0x0000, 0}, {0x00197C05, 0x0000, 0},
+  {0x00198605, 0x0000, 0}, {0x001AF785, 0x0000, 0}, {0x001AF985, 0x0000, 0}, {0x001B2285, 0x0000, 0},
+  {0x001B2A05, 0x0000, 0}, {0x001B3005, 0x0000, 0}, {0x001B3A05, 0x0000, 0}, {0x001B4D05, 0x0000, 0},
+  {0x001B4F05, 0x0000, 0}, {0x001BD405, 0x0000, 0}, {0x001BDF85, 0x0000, 0}, {0x001BEF05, 0x0000, 0},
+  {0x001DEA85, 0x0000, 0}, {0x001E0B05, 0x0000, 0}, {0x001E1605, 0x0000, 0}, {0x001E3285, 0x0000, 0},
+  {0x001E3E05, 0x0000, 0}, {0x001E4205, 0x0000, 0}, {0x001E4505, 0x0000, 0}, {0x001E5E85, 0x0000, 0},
+  {0x001E6085, 0x0000, 0}, {0x001E7005, 0x0000, 0}, {0x00208B05, 0x0000, 0}, {0x00216A05, 0x0000, 0},
+  {0x00216F85, 0x0000, 0}, {0x00217185, 0x0000, 0}, {0x00217305, 0x0000, 0}, {0x00217685, 0x0000, 0},
+  {0x00217F05, 0x0000, 0}, {0x00217F85, 0x0000, 0}, {0x0021A785, 0x0000, 0}, {0x00221305, 0x0000, 0},
+  {0x00221505, 0x0000, 0}, {0x0022BE05, 0x0000, 0}, {0x0022C285, 0x0000, 0}, {0x0022DB05, 0x0000, 0},
+  {0x0022DE05, 0x0000, 0}, {0x0022E205, 0x0000, 0}, {0x0022E585, 0x0000, 0}, {0x00231285, 0x0000, 0},
+  {0x00231585, 0x0000, 0}, {0x00238705, 0x0000, 0}, {0x00238A05, 0x0000, 0}, {0x0023A205, 0x0000, 0},
+  {0x0023AA05, 0x0000, 0}, {0x0023C105, 0x0000, 0}, {0x00243705, 0x0000, 0}, {0x00243A05, 0x0000, 0},
+  {0x00244205, 0x0000, 0}, {0x0024E505, 0x0000, 0}, {0x00252385, 0x0000, 0}, {0x00252605, 0x0000, 0},
+  {0x00258085, 0x0000, 0}, {0x0025AB85, 0x0000, 0}, {0x0025C205, 0x0000, 0}, {0x00267E85, 0x0000, 0},
+  {0x0026C085, 0x0000, 0}, {0x0027DF05, 0x0000, 0}, {0x0027EC05, 0x0000, 0}, {0x00280805, 0x0000, 0},
+  {0x00282105, 0x0000, 0}, {0x00284285, 0x0000, 0}, {0x00284785, 0x0000, 0}, {0x00284A05, 0x0000, 0},
+  {0x00285A05, 0x0000, 0}, {0x00287F85, 0x0000, 0}, {0x00288405, 0x0000, 0}, {0x00293085, 0x0000, 0},
+  {0x00293385, 0x0000, 0}, {0x00293785, 0x0000, 0}, {0x00293B85, 0x0000, 0}, {0x00294305, 0x0000, 0},
+  {0x00294A05, 0x0000, 0}, {0x00294B85, 0x0000, 0}, {0x00297285, 0x0000, 0}, {0x00297405, 0x0000, 0},
+  {0x00297685, 0x0000, 0}, {0x002B6085, 0x0000, 0}, {0x002B6F05, 0x0000, 0}, {0x002C5905, 0x0000, 0},
+  {0x002C5E85, 0x0000, 0}, {0x002C6985, 0x0000, 0}, {0x002CF685, 0x0000, 0}, {0x002CFC85, 0x0000, 0},
+  {0x002D1F85, 0x0000, 0}, {0x002D3605, 0x0000, 0}, {0x002E5105, 0x0000, 0}, {0x002E5805, 0x0000, 0},
+  {0x002E5F05, 0x0000, 0}, {0x002E7005, 0x0000, 0}, {0x002E8205, 0x0000, 0}, {0x002EE505, 0x0000, 0},
+  {0x002EEA85, 0x0000, 0}, {0x002F0B85, 0x0000, 0}, {0x002F8705, 0x0000, 0}, {0x002F9605, 0x0000, 0},
+  {0x002FFE05, 0x0000, 0}, {0x00300805, 0x0000, 0}, {0x00300A05, 0x0000, 0}, {0x00307785, 0x0000, 0},
+  {0x0030D305, 0x0000, 0}, {0x00311105, 0x0000, 0}, {0x00311385, 0x0000, 0}, {0x00311585, 0x0000, 0},
+  {0x0032E805, 0x0000, 0}, {0x0032EC05, 0x0000, 0}, {0x00333985, 0x0000, 0}, {0x00338605, 0x0000, 0},
+  {0x00338705, 0x0000, 0}, {0x00339E05, 0x0000, 0}, {0x0033D205, 0x0000, 0}, {0x0033D805, 0x0000, 0},
+  {0x0033D985, 0x0000, 0}, {0x0033DC85, 0x0000, 0}, {0x00340D05, 0x0000, 0}, {0x00341D85, 0x0000, 0},
+  {0x00342005, 0x0000, 0}, {0x00342685, 0x0000, 0}, {0x00347985, 0x0000, 0}, {0x00349285, 0x0000, 0},
+  {0x00349405, 0x0000, 0}, {0x0034EF05, 0x0000, 0}, {0x0034F005, 0x0000, 0}, {0x0034F905, 0x0000, 0},
+  {0x00357685, 0x0000, 0}, {0x00358E05, 0x0000, 0}, {0x00359105, 0x0000, 0}, {0x0035B385, 0x0000, 0},
+  {0x0035B805, 0x0000, 0}, {0x0035B905, 0x0000, 0}, {0x0035BD85, 0x0000, 0}, {0x0035CC05, 0x0000, 0},
+  {0x00369105, 0x0000, 0}, {0x00375885, 0x0000, 0}, {0x00375D05, 0x0000, 0}, {0x00376F85, 0x0000, 0},
+  {0x00377A05, 0x0000, 0}, {0x00377D85, 0x0000, 0}, {0x00378205, 0x0000, 0}, {0x00378385, 0x0000, 0},
+  {0x00379705, 0x0000, 0}, {0x00379885, 0x0000, 0}, {0x0037A085, 0x0000, 0}, {0x0037A285, 0x0000, 0},
+  {0x0037A885, 0x0000, 0}, {0x0037B585, 0x0000, 0}, {0x0037BC85, 0x0000, 0}, {0x0037C005, 0x0000, 0},
+  {0x0037DD05, 0x0000, 0}, {0x0037E405, 0x0000, 0}, {0x0037E585, 0x0000, 0}, {0xFFE81005, 0x0000, 0},
+  {0xFFE81605, 0x0000, 0}, {0x00000000, 0x0000, 224}, {0xFFFFEE05, 0x0000, 0}, {0x00118485, 0x0000, 0},
+  {0x00118585, 0x0000, 0}, {0x00000000, 0x423A, 0}, {0x00000000, 0x424A, 0}, {0x00000000, 0x425A, 0},
+  {0x00000000, 0x426A, 0}, {0x00000000, 0x427A, 0}, {0x00000000, 0x428A, 0}, {0x00000000, 0x429A, 0},
+  {0x00000000, 0x42AA, 0}, {0x00000000, 0x42BA, 0}, {0x00000000, 0x42CA, 0}, {0x00000000, 0x42DA, 0},
+  {0x00000000, 0x42EA, 0}, {0x00000000, 0x42FA, 0}, {0x00000000, 0x430A, 0}, {0x00000000, 0x431A, 0},
+  {0x00000000, 0x432A, 0}, {0x00000000, 0x433A, 0}, {0x00000000, 0x434A, 0}, {0x00000000, 0x435A, 0},
+  {0x00000000, 0x436A, 0}, {0x00000000, 0x437A, 0}, {0x00000000, 0x438A, 0}, {0x00000000, 0x439A, 0},
+  {0x00000000, 0x43AA, 0}, {0x00000000, 0x43BA, 0}, {0x00000000, 0x43CA, 0}, {0x00000000, 0x0000, 8},
+  {0x00012089, 0x0000, 0}, {0x00012189, 0x0000, 0}, {0x00000000, 0x43DA, 0}, {0x00012289, 0x0000, 0},
+  {0x00000000, 0x43EA, 0}, {0x00000000, 0x43FA, 0}, {0x00000000, 0x440A, 0}, {0x00000000, 0x441A, 0},
+  {0x00000000, 0x442A, 0}, {0x00000000, 0x443A, 0}, {0x00000000, 0x444A, 0}, {0x00000000, 0x445A, 0},
+  {0x00000000, 0x446A, 0}, {0x00000000, 0x447A, 0}, {0x00000000, 0x448A, 0}, {0x00000000, 0x449A, 0},
+  {0x00000000, 0x44AA, 0}, {0x00000000, 0x44BA, 0}, {0x00000000, 0x44CA, 0}, {0x00000000, 0x44DA, 0},
+  {0x00000000, 0x44EA, 0}, {0x00000000, 0x44FA, 0}, {0x00000000, 0x450A, 0}, {0x00000000, 0x451A, 0},
+  {0x00000000, 0x452A, 0}, {0x00000000, 0x453A, 0}, {0x00000000, 0x454A, 0}, {0x00000000, 0x455A, 0},
+  {0x00000000, 0x456A, 0}, {0x00000000, 0x457A, 0}, {0x00000000, 0x458A, 0}, {0x00000000, 0x459A, 0},
+  {0x00000000, 0x45AA, 0}, {0x00000000, 0x45BA, 0}, {0x00000000, 0x45CA, 0}, {0x00012389, 0x0000, 0},
+  {0xFFEFE785, 0x0000, 0}, {0xFFF03B85, 0x0000, 0}, {0xFFEFE705, 0x0000, 0}, {0xFFEFE605, 0x0000, 0},
+  {0xFFF03B05, 0x0000, 0}, {0xFFEFED05, 0x0000, 0}, {0xFFEFE285, 0x0000, 0}, {0xFFEFE205, 0x0000, 0},
+  {0xFFF00905, 0x0000, 0}, {0xFFEFD785, 0x0000, 0}, {0xFFF03005, 0x0000, 0}, {0xFFF03185, 0x0000, 0},
+  {0xFFF03205, 0x0000, 0}, {0xFFF03405, 0x0000, 0}, {0xFFF03585, 0x0000, 0}, {0xFFF03605, 0x0000, 0},
+  {0xFFEFD705, 0x0000, 0}, {0xFFF03705, 0x0000, 0}, {0xFFF03785, 0x0000, 0}, {0xFFEFD605, 0x0000, 0},
+  {0xFFEFD685, 0x0000, 0}, {0xFFEFD905, 0x0000, 0}, {0xFFEFD985, 0x0000, 0}, {0xFFEFDA85, 0x0000, 0},
+  {0xFFEFDC05, 0x0000, 0}, {0xFFEFE385, 0x0000, 0}, {0xFFEFE585, 0x0000, 0}, {0xFFEFFE85, 0x0000, 0},
+  {0xFFEFFF85, 0x0000, 0}, {0xFFF00385, 0x0000, 0}, {0xFFF00405, 0x0000, 0}, {0xFFF00885, 0x0000, 0},
+  {0xFFF00985, 0x0000, 0}, {0x000E3705, 0x0000, 0}, {0x000E7C85, 0x0000, 0}, {0x000E3A85, 0x0000, 0},
+  {0x0012A305, 0x0000, 0}, {0x000E3A05, 0x0000, 0}, {0x000E4B05, 0x0000, 0}, {0x000E3985, 0x0000, 0},
+  {0x0021CC85, 0x0000, 0}, {0x000E5F85, 0x0000, 0}, {0x000E3F05, 0x0000, 0}, {0x000E3285, 0x0000, 0},
+  {0x0013C605, 0x0000, 0}, {0x0012C905, 0x0000, 0}, {0x000E8D85, 0x0000, 0}, {0x0001248D, 0x0000, 0},
+  {0x0001260D, 0x0000, 0}, {0x0001278D, 0x0000, 0}, {0x0001290D, 0x0000, 0}, {0x00012A8D, 0x0000, 0},
+  {0x00012C0D, 0x0000, 0}, {0x00012D8D, 0x0000, 0}, {0x00012F0D, 0x0000, 0}, {0x0001308D, 0x0000, 0},
+  {0x0001320D, 0x0000, 0}, {0x0001338D, 0x0000, 0}, {0x0001350D, 0x0000, 0}, {0x0001368D, 0x0000, 0},
+  {0x0001380D, 0x0000, 0}, {0x0001398D, 0x0000, 0}, {0x00013B0D, 0x0000, 0}, {0x00013C8D, 0x0000, 0},
+  {0x00013E0D, 0x0000, 0}, {0x00013F8D, 0x0000, 0}, {0x0001410D, 0x0000, 0}, {0x0001428D, 0x0000, 0},
+  {0x0001440D, 0x0000, 0}, {0x0001458D, 0x0000, 0}, {0x0001470D, 0x0000, 0}, {0x0001488D, 0x0000, 0},
+  {0x00014A0D, 0x0000, 0}, {0x00014B8D, 0x0000, 0}, {0x00014D0D, 0x0000, 0}, {0x00014E8D, 0x0000, 0},
+  {0x00015011, 0x0000, 0}, {0x00015211, 0x0000, 0}, {0x0001540D, 0x0000, 0}, {0x0001558D, 0x0000, 0},
+  {0x0001570D, 0x0000, 0}, {0x0001588D, 0x0000, 0}, {0x00015A0D, 0x0000, 0}, {0x00015B8D, 0x0000, 0},
+  {0x00015D0D, 0x0000, 0}, {0x00015E8D, 0x0000, 0}, {0x0001600D, 0x0000, 0}, {0x0001618D, 0x0000, 0},
+  {0x0001630D, 0x0000, 0}, {0x0001648D, 0x0000, 0}, {0x0001660D, 0x0000, 0}, {0x0001678D, 0x0000, 0},
+  {0x0001690D, 0x0000, 0}, {0x00016A8D, 0x0000, 0}, {0x00016C0D, 0x0000, 0}, {0x00016D8D, 0x0000, 0},
+  {0x00016F0D, 0x0000, 0}, {0x0001708D, 0x0000, 0}, {0x0001720D, 0x0000, 0}, {0x0001738D, 0x0000, 0},
+  {0x0001750D, 0x0000, 0}, {0x0001768D, 0x0000, 0}, {0x0001780D, 0x0000, 0}, {0x0001798D, 0x0000, 0},
+  {0x00017B0D, 0x0000, 0}, {0x00017C8D, 0x0000, 0}, {0x00017E0D, 0x0000, 0}, {0x00017F8D, 0x0000, 0},
+  {0x0001810D, 0x0000, 0}, {0x0001828D, 0x0000, 0}, {0x0001840D, 0x0000, 0}, {0x0001858D, 0x0000, 0},
+  {0x0001870D, 0x0000, 0}, {0x0001888D, 0x0000, 0}, {0x00161B85, 0x0000, 0}, {0x0019A085, 0x0000, 0},
+  {0x0024A405, 0x0000, 0}, {0x00018A0D, 0x0000, 0}, {0x00018B89, 0x0000, 0}, {0x00018C89, 0x0000, 0},
+  {0x00018D89, 0x0000, 0}, {0x00018E89, 0x0000, 0}, {0x00018F89, 0x0000, 0}, {0x00019089, 0x0000, 0},
+  {0x00019189, 0x0000, 0}, {0x00019289, 0x0000, 0}, {0x00019389, 0x0000, 0}, {0x00019489, 0x0000, 0},
+  {0x00019589, 0x0000, 0}, {0x00019689, 0x0000, 0}, {0x00019789, 0x0000, 0}, {0x00019889, 0x0000, 0},
+  {0x00019989, 0x0000, 0}, {0xFFEF5005, 0x0000, 0}, {0xFFEF5085, 0x0000, 0}, {0xFFEF5105, 0x0000, 0},
+  {0xFFEF5185, 0x0000, 0}, {0xFFEF5205, 0x0000, 0}, {0xFFEF5285, 0x0000, 0}, {0x003CC905, 0x0000, 0},
+  {0x003F1485, 0x0000, 0}, {0x00403A05, 0x0000, 0}, {0x00428585, 0x0000, 0}, {0x0043AB05, 0x0000, 0},
+  {0x0044D085, 0x0000, 0}, {0x00471C05, 0x0000, 0}, {0x00496785, 0x0000, 0}, {0x004A8D05, 0x0000, 0},
+  {0x004CD885, 0x0000, 0}, {0x004DFE05, 0x0000, 0}, {0x004F2385, 0x0000, 0}, {0x00504905, 0x0000, 0},
+  {0x00516E85, 0x0000, 0}, {0x00019A89, 0x0000, 0}, {0x00019B89, 0x0000, 0}, {0x004A1905, 0x0000, 0},
+  {0x000DC005, 0x0000, 0}, {0x000E0585, 0x0000, 0}, {0x000DC385, 0x0000, 0}, {0x00122C05, 0x0000, 0},
+  {0x000E0805, 0x0000, 0}, {0x000F7405, 0x0000, 0}, {0x000DBE85, 0x0000, 0}, {0x000F7205, 0x0000, 0},
+  {0x000DEA85, 0x0000, 0}, {0x00105C05, 0x0000, 0}, {0x001A3F05, 0x0000, 0}, {0x001EF005, 0x0000, 0},
+  {0x001CD405, 0x0000, 0}, {0x001A4D85, 0x0000, 0}, {0x002FA185, 0x0000, 0}, {0x00124805, 0x0000, 0},
+  {0x0019AA85, 0x0000, 0}, {0x001ACC85, 0x0000, 0}, {0x001A3B85, 0x0000, 0}, {0x00235585, 0x0000, 0},
+  {0x0010BC85, 0x0000, 0}, {0x001FF205, 0x0000, 0}, {0x002D0585, 0x0000, 0}, {0x00236305, 0x0000, 0},
+  {0x00100E05, 0x0000, 0}, {0x00239F85, 0x0000, 0}, {0x00214E85, 0x0000, 0}, {0x00136C05, 0x0000, 0},
+  {0x002EE685, 0x0000, 0}, {0x000F4685, 0x0000, 0}, {0x00106905, 0x0000, 0}, {0x001D2485, 0x0000, 0},
+  {0x0032B285, 0x0000, 0}, {0x000E3805, 0x0000, 0}, {0x000F7B85, 0x0000, 0}, {0x001C6005, 0x0000, 0},
+  {0x000DB305, 0x0000, 0}, {0x000DC405, 0x0000, 0}, {0x000DB285, 0x0000, 0}, {0x00159F85, 0x0000, 0},
+  {0x0010A585, 0x0000, 0}, {0x00104905, 0x0000, 0}, {0x00147685, 0x0000, 0}, {0x00145D85, 0x0000, 0},
+  {0x00221B85, 0x0000, 0}, {0x000E2A05, 0x0000, 0}, {0x002D0C85, 0x0000, 0}, {0x00105285, 0x0000, 0},
+  {0x00133605, 0x0000, 0}, {0x00019C89, 0x0000, 0}, {0x00019D89, 0x0000, 0}, {0x00019E89, 0x0000, 0},
+  {0x00019F89, 0x0000, 0}, {0x0001A089, 0x0000, 0}, {0x0001A189, 0x0000, 0}, {0x0001A289, 0x0000, 0},
+  {0x0001A389, 0x0000, 0}, {0x0001A489, 0x0000, 0}, {0x0001A589, 0x0000, 0}, {0x0001A689, 0x0000, 0},
+  {0x0001A789, 0x0000, 0}, {0x0001A889, 0x0000, 0}, {0x0001A989, 0x0000, 0}, {0x0001AA89, 0x0000, 0},
+  {0x0001AB89, 0x0000, 0}, {0x0001AC89, 0x0000, 0}, {0x0001AD89, 0x0000, 0}, {0x0001AE89, 0x0000, 0},
+  {0x0001AF89, 0x0000, 0}, {0x0001B089, 0x0000, 0}, {0x0001B189, 0x0000, 0}, {0x0001B289, 0x0000, 0},
+  {0x0001B389, 0x0000, 0}, {0x0001B48D, 0x0000, 0}, {0x0001B60D, 0x0000, 0}, {0x0001B78D, 0x0000, 0},
+  {0x0001B909, 0x0000, 0}, {0x0001BA0D, 0x0000, 0}, {0x0001BB89, 0x0000, 0}, {0x0001BC8D, 0x0000, 0},
+  {0xFFFEE905, 0x0000, 0}, {0xFFFEE985, 0x0000, 0}, {0xFFFEEA05, 0x0000, 0}, {0xFFFEEA85, 0x0000, 0},
+  {0xFFFEEB05, 0x0000, 0}, {0xFFFEEB85, 0x0000, 0}, {0xFFFEEC05, 0x0000, 0}, {0xFFFEEC85, 0x0000, 0},
+  {0xFFFEED05, 0x0000, 0}, {0xFFFEED85, 0x0000, 0}, {0xFFFEEE05, 0x0000, 0}, {0xFFFEEE85, 0x0000, 0},
+  {0xFFFEEF05, 0x0000, 0}, {0xFFFEEF85, 0x0000, 0}, {0xFFFEF005, 0x0000, 0}, {0xFFFEF085, 0x0000, 0},
+  {0xFFFEF185, 0x0000, 0}, {0xFFFEF205, 0x0000, 0}, {0xFFFEF285, 0x0000, 0}, {0xFFFEF305, 0x0000, 0},
+  {0xFFFEF405, 0x0000, 0}, {0xFFFEF505, 0x0000, 0}, {0xFFFEF605, 0x0000, 0}, {0xFFFEF705, 0x0000, 0},
+  {0xFFFEF805, 0x0000, 0}, {0xFFFEF885, 0x0000, 0}, {0xFFFEF905, 0x0000, 0}, {0xFFFEF985, 0x0000, 0},
+  {0xFFFEFA05, 0x0000, 0}, {0x0001BE09, 0x0000, 0}, {0x0001BF11, 0x0000, 0}, {0x0001C111, 0x0000, 0},
+  {0x0001C311, 0x0000, 0}, {0x0001C50D, 0x0000, 0}, {0x0001C691, 0x0000, 0}, {0x0001C88D, 0x0000, 0},
+  {0x0001CA0D, 0x0000, 0}, {0x0001CB95, 0x0000, 0}, {0x0001CE11, 0x0000, 0}, {0x0001D00D, 0x0000, 0},
+  {0x0001D18D, 0x0000, 0}, {0x0001D30D, 0x0000, 0}, {0x0001D491, 0x0000, 0}, {0x0001D691, 0x0000, 0},
+  {0x0001D88D, 0x0000, 0}, {0x0001DA0D, 0x0000, 0}, {0x0001DB89, 0x0000, 0}, {0x0001DC8D, 0x0000, 0},
+  {0x0001DE11, 0x0000, 0}, {0x0001E011, 0x0000, 0}, {0x0001E209, 0x0000, 0}, {0x0001E315, 0x0000, 0},
+  {0x0001E599, 0x0000, 0}, {0x0001E895, 0x0000, 0}, {0x0001EB0D, 0x0000, 0}, {0x0001EC95, 0x0000, 0},
+  {0x0001EF15, 0x0000, 0}, {0x0001F191, 0x0000, 0}, {0x0001F38D, 0x0000, 0}, {0x0001F50D, 0x0000, 0},
+  {0x0001F68D, 0x0000, 0}, {0x0001F811, 0x0000, 0}, {0x0001FA15, 0x0000, 0}, {0x0001FC91, 0x0000, 0},
+  {0x0001FE8D, 0x0000, 0}, {0x0002000D, 0x0000, 0}, {0x0002018D, 0x0000, 0}, {0x00020309, 0x0000, 0},
+  {0x00020409, 0x0000, 0}, {0x00020509, 0x0000, 0}, {0x00020609, 0x0000, 0}, {0x0002070D, 0x0000, 0},
+  {0x0002088D, 0x0000, 0}, {0x00020A15, 0x0000, 0}, {0x00020C8D, 0x0000, 0}, {0x00020E11, 0x0000, 0},
+  {0x00021015, 0x0000, 0}, {0x0002128D, 0x0000, 0}, {0x00021409, 0x0000, 0}, {0x00021509, 0x0000, 0},
+  {0x00021615, 0x0000, 0}, {0x00021891, 0x0000, 0}, {0x00021A95, 0x0000, 0}, {0x00021D0D, 0x0000, 0},
+  {0x00021E95, 0x0000, 0}, {0x00022109, 0x0000, 0}, {0x0002220D, 0x0000, 0}, {0x0002238D, 0x0000, 0},
+  {0x0002250D, 0x0000, 0}, {0x0002268D, 0x0000, 0}, {0x0002280D, 0x0000, 0}, {0x00022991, 0x0000, 0},
+  {0x00022B8D, 0x0000, 0}, {0x00022D09, 0x0000, 0}, {0x00022E0D, 0x0000, 0}, {0x00022F8D, 0x0000, 0},
+  {0x0002310D, 0x0000, 0}, {0x00023291, 0x0000, 0}, {0x0002348D, 0x0000, 0}, {0x0002360D, 0x0000, 0},
+  {0x0002378D, 0x0000, 0}, {0x00023915, 0x0000, 0}, {0x00023B91, 0x0000, 0}, {0x00023D89, 0x0000, 0},
+  {0x00023E95, 0x0000, 0}, {0x00024109, 0x0000, 0}, {0x00024211, 0x0000, 0}, {0x00024411, 0x0000, 0},
+  {0x0002460D, 0x0000, 0}, {0x0002478D, 0x0000, 0}, {0x0002490D, 0x0000, 0}, {0x00024A91, 0x0000, 0},
+  {0x00024C89, 0x0000, 0}, {0x00024D8D, 0x0000, 0}, {0x00024F11, 0x0000, 0}, {0x00025109, 0x0000, 0},
+  {0x00025215, 0x0000, 0}, {0x0002548D, 0x0000, 0}, {0x00025609, 0x0000, 0}, {0x00025709, 0x0000, 0},
+  {0x00025809, 0x0000, 0}, {0x00025909, 0x0000, 0}, {0x00025A09, 0x0000, 0}, {0x00025B09, 0x0000, 0},
+  {0x00025C09, 0x0000, 0}, {0x00025D09, 0x0000, 0}, {0x00025E09, 0x0000, 0}, {0x00025F09, 0x0000, 0},
+  {0x0002600D, 0x0000, 0}, {0x0002618D, 0x0000, 0}, {0x0002630D, 0x0000, 0}, {0x0002648D, 0x0000, 0},
+  {0x0002660D, 0x0000, 0}, {0x0002678D, 0x0000, 0}, {0x0002690D, 0x0000, 0}, {0x00026A8D, 0x0000, 0},
+  {0x00026C0D, 0x0000, 0}, {0x00026D8D, 0x0000, 0}, {0x00026F0D, 0x0000, 0}, {0x0002708D, 0x0000, 0},
+  {0x0002720D, 0x0000, 0}, {0x0002738D, 0x0000, 0}, {0x0002750D, 0x0000, 0}, {0x0002768D, 0x0000, 0},
+  {0x00027809, 0x0000, 0}, {0x00027909, 0x0000, 0}, {0x00027A0D, 0x0000, 0}, {0x00027B89, 0x0000, 0},
+  {0x00027C89, 0x0000, 0}, {0x00027D89, 0x0000, 0}, {0x00027E8D, 0x0000, 0}, {0x0002800D, 0x0000, 0},
+  {0x00028189, 0x0000, 0}, {0x00028289, 0x0000, 0}, {0x00028389, 0x0000, 0}, {0x00028489, 0x0000, 0},
+  {0x00028589, 0x0000, 0}, {0x00028691, 0x0000, 0}, {0x00028889, 0x0000, 0}, {0x00028989, 0x0000, 0},
+  {0x00028A89, 0x0000, 0}, {0x00028B89, 0x0000, 0}, {0x00028C89, 0x0000, 0}, {0x00028D89, 0x0000, 0},
+  {0x00028E89, 0x0000, 0}, {0x00028F89, 0x0000, 0}, {0x0002908D, 0x0000, 0}, {0x00029211, 0x0000, 0},
+  {0x00029409, 0x0000, 0}, {0x00029509, 0x0000, 0}, {0x00029609, 0x0000, 0}, {0x00029709, 0x0000, 0},
+  {0x00029809, 0x0000, 0}, {0x00029909, 0x0000, 0}, {0x00029A09, 0x0000, 0}, {0x00029B0D, 0x0000, 0},
+  {0x00029C8D, 0x0000, 0}, {0x00029E0D, 0x0000, 0}, {0x00029F8D, 0x0000, 0}, {0x0002A109, 0x0000, 0},
+  {0x0002A209, 0x0000, 0}, {0x0002A309, 0x0000, 0}, {0x0002A409, 0x0000, 0}, {0x0002A509, 0x0000, 0},
+  {0x0002A609, 0x0000, 0}, {0x0002A709, 0x0000, 0}, {0x0002A809, 0x0000, 0}, {0x0002A909, 0x0000, 0},
+  {0x0002AA09, 0x0000, 0}, {0x0002AB0D, 0x0000, 0}, {0x0002AC8D, 0x0000, 0}, {0x0002AE09, 0x0000, 0},
+  {0x0002AF0D, 0x0000, 0}, {0x0002B08D, 0x0000, 0}, {0x0002B20D, 0x0000, 0}, {0x0002B389, 0x0000, 0},
+  {0x0002B48D, 0x0000, 0}, {0x0002B60D, 0x0000, 0}, {0x0002B791, 0x0000, 0}, {0x0002B98D, 0x0000, 0},
+  {0x0002BB0D, 0x0000, 0}, {0x0002BC8D, 0x0000, 0}, {0x0002BE0D, 0x0000, 0}, {0x0002BF95, 0x0000, 0},
+  {0x0002C219, 0x0000, 0}, {0x0002C509, 0x0000, 0}, {0x0002C609, 0x0000, 0}, {0x0002C709, 0x0000, 0},
+  {0x0002C809, 0x0000, 0}, {0x0002C909, 0x0000, 0}, {0x0002CA09, 0x0000, 0}, {0x0002CB09, 0x0000, 0},
+  {0x0002CC09, 0x0000, 0}, {0x0002CD09, 0x0000, 0}, {0x0002CE09, 0x0000, 0}, {0x0002CF09, 0x0000, 0},
+  {0x0002D009, 0x0000, 0}, {0x0002D109, 0x0000, 0}, {0x0002D209, 0x0000, 0}, {0x0002D309, 0x0000, 0},
+  {0x0002D409, 0x0000, 0}, {0x0002D509, 0x0000, 0}, {0x0002D609, 0x0000, 0}, {0x0002D709, 0x0000, 0},
+  {0x0002D811, 0x0000, 0}, {0x0002DA09, 0x0000, 0}, {0x0002DB09, 0x0000, 0}, {0x0002DC09, 0x0000, 0},
+  {0x0002DD09, 0x0000, 0}, {0x0002DE09, 0x0000, 0}, {0x0002DF09, 0x0000, 0}, {0x0002E009, 0x0000, 0},
+  {0x0002E109, 0x0000, 0}, {0x0002E209, 0x0000, 0}, {0x0002E30D, 0x0000, 0}, {0x0002E489, 0x0000, 0},
+  {0x0002E58D, 0x0000, 0}, {0x0002E70D, 0x0000, 0}, {0x0002E889, 0x0000, 0}, {0x0002E98D, 0x0000, 0},
+  {0x0002EB09, 0x0000, 0}, {0x0002EC09, 0x0000, 0}, {0x0002ED09, 0x0000, 0}, {0x0002EE09, 0x0000, 0},
+  {0x0002EF0D, 0x0000, 0}, {0x0002F08D, 0x0000, 0}, {0x0002F209, 0x0000, 0}, {0x0002F309, 0x0000, 0},
+  {0x0002F409, 0x0000, 0}, {0x0002F509, 0x0000, 0}, {0x0002F609, 0x0000, 0}, {0x0002F709, 0x0000, 0},
+  {0x0002F809, 0x0000, 0}, {0x0002F909, 0x0000, 0}, {0x0002FA09, 0x0000, 0}, {0x0002FB0D, 0x0000, 0},
+  {0x0002FC8D, 0x0000, 0}, {0x0002FE0D, 0x0000, 0}, {0x0002FF8D, 0x0000, 0}, {0x0003010D, 0x0000, 0},
+  {0x0003028D, 0x0000, 0}, {0x0003040D, 0x0000, 0}, {0x0003058D, 0x0000, 0}, {0x0003070D, 0x0000, 0},
+  {0x0003088D, 0x0000, 0}, {0x00030A0D, 0x0000, 0}, {0x00030B8D, 0x0000, 0}, {0x00030D0D, 0x0000, 0},
+  {0x00030E8D, 0x0000, 0}, {0x0003100D, 0x0000, 0}, {0x0003118D, 0x0000, 0}, {0x0003130D, 0x0000, 0},
+  {0x0003148D, 0x0000, 0}, {0x0003160D, 0x0000, 0}, {0x0003178D, 0x0000, 0}, {0x0003190D, 0x0000, 0},
+  {0x00031A8D, 0x0000, 0}, {0x00031C0D, 0x0000, 0}, {0xFFAED705, 0x0000, 0}, {0xFFAED785, 0x0000, 0},
+  {0xFFBAFE05, 0x0000, 0}, {0xFFAD6C05, 0x0000, 0}, {0xFFAD5E05, 0x0000, 0}, {0xFFAD5885, 0x0000, 0},
+  {0xFFAD5A85, 0x0000, 0}, {0xFFAD5F85, 0x0000, 0}, {0xFFAD7705, 0x0000, 0}, {0xFFAD6B05, 0x0000, 0},
+  {0xFFAD7585, 0x0000, 0}, {0x0001D005, 0x0000, 0}, {0xFFAD5E85, 0x0000, 0}, {0xFFBAE405, 0x0000, 0},
+  {0xFFAC3885, 0x0000, 0}, {0xFFAC3985, 0x0000, 0}, {0xFFAC3E85, 0x0000, 0}, {0xFFAC9785, 0x0000, 0},
+  {0xFFACAD05, 0x0000, 0}, {0xFFFDE585, 0x0000, 0}, {0xFFFFED05, 0x0000, 0}, {0xFFAB8685, 0x0000, 0},
+  {0xFFAB9205, 0x0000, 0}, {0xFFB41805, 0x0000, 0}, {0xFFC9A405, 0x45D9, 0}, {0xFFB6F985, 0x45E1, 0},
+  {0xFFCAE405, 0x45E9, 0}, {0xFFC9E285, 0x45F1, 0}, {0xFFBAE685, 0x45F9, 0}, {0xFFAA9685, 0x4601, 0},
+  {0xFFAD6F85, 0x4609, 0}, {0xFFD34A85, 0x4611, 0}, {0xFFD34A05, 0x4611, 0}, {0xFFB02405, 0x4619, 0},
+  {0xFFCC6385, 0x4621, 0}, {0xFFAE3E05, 0x4629, 0}, {0xFFB01E05, 0x4631, 0}, {0xFFB47485, 0x4639, 0},
+  {0xFFBEAD85, 0x4641, 0}, {0xFFC33B05, 0x4649, 0}, {0xFFC69785, 0x4651, 0}, {0xFFC75485, 0x4659, 0},
+  {0xFFC7F305, 0x4661, 0}, {0xFFCBBE05, 0x4669, 0}, {0xFFB87705, 0x4671, 0}, {0xFFBA0305, 0x4679, 0},
+  {0xFFBBE185, 0x4681, 0}, {0xFFBD6385, 0x4689, 0}, {0xFFC59285, 0x4691, 0}, {0xFFCC2885, 0x4699, 0},
+  {0xFFD06B85, 0x46A1, 0}, {0xFFAAB385, 0x46A9, 0}, {0xFFAD2C85, 0x46B1, 0}, {0xFFB8F385, 0x46B9, 0},
+  {0xFFBC7E85, 0x46C1, 0}, {0xFFC68705, 0x46C9, 0}, {0xFFD27F05, 0x46D1, 0}, {0xFFB21785, 0x46D9, 0},
+  {0xFFBB6485, 0x46E1, 0}, {0xFFC65505, 0x46E9, 0}, {0xFFC82005, 0x46F1, 0}, {0xFFB4D205, 0x46F9, 0},
+  {0xFFC45905, 0x4701, 0}, {0xFFC77C05, 0x4709, 0}, {0xFFB2D105, 0x4711, 0}, {0xFFB6F705, 0x4719, 0},
+  {0xFFBA2005, 0x4721, 0}, {0xFFBCE885, 0x4729, 0}, {0xFFCBD105, 0x4731, 0}, {0xFFAB2C85, 0x4739, 0},
+  {0xFFAC4485, 0x4741, 0}, {0xFFACD785, 0x4749, 0}, {0xFFB5CA05, 0x4751, 0}, {0xFFB8D105, 0x4759, 0},
+  {0xFFBC6F05, 0x4761, 0}, {0xFFBEDA05, 0x4769, 0}, {0xFFC36685, 0x4771, 0}, {0xFFC66885, 0x4779, 0},
+  {0xFFC69305, 0x4781, 0}, {0xFFCA5C05, 0x4789, 0}, {0xFFCEFD05, 0x4791, 0}, {0xFFD11B05, 0x4799, 0},
+  {0xFFD26005, 0x47A1, 0}, {0xFFBFA885, 0x47A9, 0}, {0xFFC02185, 0x47B1, 0}, {0xFFC23185, 0x47B9, 0},
+  {0xFFC54585, 0x47C1, 0}, {0xFFCCE285, 0x47C9, 0}, {0xFFD29F85, 0x47D1, 0}, {0xFFC8CA85, 0x47D9, 0},
+  {0xFFAFCE85, 0x47E1, 0}, {0xFFB2E085, 0x47E9, 0}, {0xFFC18E05, 0x47F1, 0}, {0xFFC39C85, 0x47F9, 0},
+  {0xFFBC8E05, 0x4801, 0}, {0xFFBFC185, 0x4809, 0}, {0xFFC9BD05, 0x4811, 0}, {0xFFCED705, 0x4819, 0},
+  {0xFFAFC705, 0x4821, 0}, {0xFFB18B85, 0x4829, 0}, {0xFFB86385, 0x4831, 0}, {0xFFBA4685, 0x4839, 0},
+  {0xFFBAE085, 0x4841, 0}, {0xFFC1F005, 0x4849, 0}, {0xFFC27385, 0x4851, 0}, {0xFFCE7D05, 0x4859, 0},
+  {0xFFACC005, 0x4861, 0}, {0xFFC39C05, 0x4869, 0}, {0xFFAC4405, 0x4871, 0}, {0xFFAC3B85, 0x4879, 0},
+  {0xFFC06305, 0x4881, 0}, {0xFFC23385, 0x4889, 0}, {0xFFC54C85, 0x4891, 0}, {0xFFCE8E05, 0x4899, 0},
+  {0xFFC91305, 0x48A1, 0}, {0xFFB4BA05, 0x48A9, 0}, {0xFFB85305, 0x4671, 0}, {0xFFC8D085, 0x48B1, 0},
+  {0xFFAA6D85, 0x48B9, 0}, {0xFFB14405, 0x48C1, 0}, {0xFFB35905, 0x48C9, 0}, {0xFFBD1305, 0x48D1, 0},
+  {0xFFBE0705, 0x48D9, 0}, {0xFFACDA05, 0x48E1, 0}, {0xFFBFCB85, 0x48E9, 0}, {0xFFAB2D05, 0x48F1, 0},
+  {0xFFB32185, 0x48F9, 0}, {0xFFAA5305, 0x4901, 0}, {0xFFB9B205, 0x4909, 0}, {0xFFB60785, 0x4911, 0},
+  {0xFFC1DC05, 0x4919, 0}, {0xFFAD2C05, 0x4921, 0}, {0xFFAF7905, 0x4929, 0}, {0xFFBECA05, 0x4931, 0},
+  {0xFFC56D85, 0x4939, 0}, {0xFFC89D85, 0x4941, 0}, {0xFFB92505, 0x4949, 0}, {0xFFCB1F85, 0x4951, 0},
+  {0xFFB98B05, 0x4959, 0}, {0xFFB4C585, 0x4961, 0}, {0xFFC4B885, 0x4969, 0}, {0xFFB51585, 0x4971, 0},
+  {0xFFBDF785, 0x4979, 0}, {0xFFAA9B85, 0x4981, 0}, {0xFFABF885, 0x4989, 0}, {0xFFAC2805, 0x4991, 0},
+  {0xFFB78385, 0x4999, 0}, {0xFFC1B605, 0x49A1, 0}, {0xFFC47985, 0x49A9, 0}, {0xFFC8AA85, 0x49B1, 0},
+  {0xFFCC2885, 0x49B9, 0}, {0xFFACBB05, 0x49C1, 0}, {0xFFAD6105, 0x49C9, 0}, {0xFFAFF905, 0x49D1, 0},
+  {0xFFB2B505, 0x49D9, 0}, {0xFFB62105, 0x49E1, 0}, {0xFFBB3D05, 0x49E9, 0}, {0xFFBFD285, 0x49F1, 0},
+  {0xFFCE1385, 0x49F9, 0}, {0xFFD07185, 0x4A01, 0}, {0xFFD28785, 0x4A09, 0}, {0xFFD2A285, 0x4A11, 0},
+  {0xFFAC8885, 0x4A19, 0}, {0xFFB69D85, 0x4A21, 0}, {0xFFB8F585, 0x4A29, 0}, {0xFFCAEA85, 0x4A31, 0},
+  {0xFFB27305, 0x4A39, 0}, {0xFFB40085, 0x4A41, 0}, {0xFFB43805, 0x4A49, 0}, {0xFFB58485, 0x4A51, 0},
+  {0xFFBAC885, 0x4A59, 0}, {0xFFBBDB05, 0x4A61, 0}, {0xFFBD7A85, 0x4A69, 0}, {0xFFC01A85, 0x4A71, 0},
+  {0xFFC22F05, 0x4A79, 0}, {0xFFC36C05, 0x4A81, 0}, {0xFFCAC705, 0x4A89, 0}, {0xFFC5AA85, 0x4A91, 0},
+  {0xFFCB4485, 0x4A99, 0}, {0xFFCCD785, 0x4AA1, 0}, {0xFFAC3D85, 0x4AA9, 0}, {0xFFAC8305, 0x4AB1, 0},
+  {0xFFAD8F85, 0x4AB9, 0}, {0xFFBB9485, 0x4AC1, 0}, {0xFFC79105, 0x4AC9, 0}, {0xFFC88485, 0x4941, 0},
+  {0xFFB29385, 0x4AD1, 0}, {0xFFB32905, 0x4AD9, 0}, {0xFFB4EB85, 0x4AE1, 0}, {0xFFB90485, 0x4AE9, 0},
+  {0xFFC14C05, 0x4AF1, 0}, {0xFFBCE705, 0x4AF9, 0}, {0xFFAA9E05, 0x4B01, 0}, {0xFFAEA805, 0x4B09, 0},
+  {0xFFB11E85, 0x48C1, 0}, {0xFFB20785, 0x4B11, 0}, {0xFFB33805, 0x4B19, 0}, {0xFFBD0285, 0x4B21, 0},
+  {0xFFBD5D85, 0x4B29, 0}, {0xFFC2F585, 0x4B31, 0}, {0xFFC34B05, 0x4B39, 0}, {0xFFCC4185, 0x4B41, 0},
+  {0xFFCEA205, 0x4B49, 0}, {0xFFCECA85, 0x4B51, 0}, {0xFFCF3205, 0x4B59, 0}, {0xFFAAEB05, 0x4B61, 0},
+  {0xFFBFFC05, 0x4B69, 0}, {0xFFCBFE85, 0x4B71, 0}, {0xFFCE8005, 0x4B79, 0}, {0xFFB39405, 0x4B81, 0},
+  {0xFFAA6605, 0x4B89, 0}, {0xFFAB8F85, 0x4B91, 0}, {0xFFB11905, 0x4B99, 0}, {0xFFB14105, 0x4BA1, 0},
+  {0xFFB5ED85, 0x4BA9, 0}, {0xFFB82185, 0x4671, 0}, {0xFFBC0705, 0x4BB1, 0}, {0xFFBE4085, 0x4BB9, 0},
+  {0xFFC59D05, 0x4BC1, 0}, {0xFFCB5C85, 0x4BC9, 0}, {0xFFD2E485, 0x4BD1, 0}, {0xFFB66185, 0x4BD9, 0},
+  {0xFFCE3405, 0x4BE1, 0}, {0xFFAC6105, 0x4BE9, 0}, {0xFFB6D985, 0x4BF1, 0}, {0xFFB71505, 0x4BF9, 0},
+  {0xFFB9BB85, 0x4C01, 0}, {0xFFBA6885, 0x4C09, 0}, {0xFFBD1E85, 0x4C11, 0}, {0xFFBDC605, 0x4C19, 0},
+  {0xFFBF4E85, 0x4C21, 0}, {0xFFC1A085, 0x4C29, 0}, {0xFFCF4705, 0x4C31, 0}, {0xFFABCE05, 0x4C39, 0},
+  {0xFFB42E05, 0x4C41, 0}, {0xFFCE5285, 0x4C49, 0}, {0xFFAB2B85, 0x4C51, 0}, {0xFFB1A205, 0x4C59, 0},
+  {0xFFBA0A05, 0x4C61, 0}, {0xFFCAA985, 0x4C69, 0}, {0xFFB2D985, 0x4C71, 0}, {0xFFB3B585, 0x4C79, 0},
+  {0xFFB71E85, 0x4C81, 0}, {0xFFBCD605, 0x48D1, 0}, {0xFFCE5505, 0x4C89, 0}, {0xFFAC2605, 0x4C91, 0},
+  {0xFFAD1885, 0x4C99, 0}, {0xFFB14305, 0x4CA1, 0}, {0xFFB61985, 0x4CA9, 0}, {0xFFB6B685, 0x4CB1, 0},
+  {0xFFB76305, 0x4CB9, 0}, {0xFFB98105, 0x4CC1, 0}, {0xFFBD1105, 0x4CC9, 0}, {0xFFBDFE85, 0x4CD1, 0},
+  {0xFFC2C985, 0x4CD9, 0}, {0xFFC77405, 0x4CE1, 0}, {0xFFC77C85, 0x4CE9, 0}, {0xFFCBF185, 0x4CF1, 0},
+  {0xFFCE7C05, 0x4CF9, 0}, {0xFFACAA05, 0x4D01, 0}, {0xFFBA6705, 0x4D09, 0}, {0xFFAD1805, 0x4D11, 0},
+  {0xFFBBF105, 0x4D19, 0}, {0xFFBD5485, 0x4D21, 0}, {0xFFC60505, 0x4D29, 0}, {0xFFCE5905, 0x4D31, 0},
+  {0xFFD13285, 0x4D39, 0}, {0xFFD25605, 0x4D41, 0}, {0xFFB6D185, 0x4D49, 0}, {0xFFB9EB05, 0x4D51, 0},
+  {0xFFC3F905, 0x4D59, 0}, {0xFFC06A05, 0x4D61, 0}, {0xFFC09405, 0x4D69, 0}, {0xFFC14C85, 0x4D71, 0},
+  {0xFFBC6305, 0x4D79, 0}, {0xFFBB4F05, 0x4D81, 0}, {0xFFC8AE05, 0x4D89, 0}, {0xFFAA6185, 0x4D91, 0},
+  {0xFFC49C05, 0x4D99, 0}, {0xFFAC1D85, 0x4DA1, 0}, {0xFFAC0385, 0x4DA9, 0}, {0xFFB25285, 0x4DB1, 0},
+  {0xFFB46885, 0x4DB9, 0}, {0xFFC16985, 0x4DC1, 0}, {0xFFB0C085, 0x4DC9, 0}, {0xFFB98C85, 0x4DD1, 0},
+  {0xFFB65705, 0x4DD9, 0}, {0xFFCA9A05, 0x4DE1, 0}, {0xFFC72205, 0x4DE9, 0}, {0xFFCE2205, 0x4DF1, 0},
+  {0xFFC7C085, 0x4DF9, 0}, {0xFFB26405, 0x4E01, 0}, {0xFFAB9A05, 0x4E09, 0}, {0xFFADD985, 0x4E11, 0},
+  {0xFFAF2505, 0x4E19, 0}, {0xFFB63105, 0x4E21, 0}, {0xFFABE485, 0x4E29, 0}, {0xFFBC8A05, 0x4E31, 0},
+  {0xFFBE5985, 0x4E39, 0}, {0xFFBF9205, 0x4E41, 0}, {0xFFBFA285, 0x4E49, 0}, {0xFFBFA585, 0x4E51, 0},
+  {0xFFBFBA05, 0x4E59, 0}, {0xFFCE9D05, 0x4E61, 0}, {0xFFC15085, 0x4E69, 0}, {0xFFC2CF85, 0x4E71, 0},
+  {0xFFC5F905, 0x4E79, 0}, {0xFFC86B05, 0x4E81, 0}, {0xFFCB0985, 0x4E89, 0}, {0xFFCB6B85, 0x4E91, 0},
+  {0xFFCF6285, 0x4E99, 0}, {0xFFCF6885, 0x4EA1, 0}, {0xFFCF7E05, 0x4EA9, 0}, {0xFFD1C385, 0x4EB1, 0},
+  {0xFFCB5805, 0x4EB9, 0}, {0xFFCE4405, 0x4EC1, 0}, {0xFFAABF05, 0x4EC9, 0}, {0xFFAB5B05, 0x4ED1, 0},
+  {0xFFAB8D85, 0x4ED9, 0}, {0xFFAC4B05, 0x4EE1, 0}, {0xFFAC5805, 0x4EE9, 0}, {0xFFAC8E05, 0x4EF1, 0},
+  {0xFFADB385, 0x4EF9, 0}, {0xFFADE785, 0x4F01, 0}, {0xFFAE1805, 0x4F09, 0}, {0xFFAF0385, 0x4F11, 0},
+  {0xFFAF3705, 0x4F19, 0}, {0xFFB11485, 0x4F21, 0}, {0xFFB11905, 0x4F29, 0}, {0xFFB32B85, 0x4F31, 0},
+  {0xFFB39505, 0x4F39, 0}, {0xFFB3A785, 0x4F41, 0}, {0xFFB3D905, 0x4F49, 0}, {0xFFB58705, 0x4F51, 0},
+  {0xFFB5D005, 0x4F59, 0}, {0xFFB62705, 0x4F61, 0}, {0xFFB72085, 0x4F69, 0}, {0xFFB99905, 0x4F71, 0},
+  {0xFFB9EA05, 0x4F79, 0}, {0xFFBA6D85, 0x4F81, 0}, {0xFFBB9305, 0x4F89, 0}, {0xFFBBF105, 0x4F91, 0},
+  {0xFFBCEC05, 0x4F99, 0}, {0xFFBF2305, 0x4FA1, 0}, {0xFFBF7905, 0x4FA9, 0}, {0xFFBF7E05, 0x4FB1, 0},
+  {0xFFBF7D05, 0x4FB9, 0}, {0xFFBF8085, 0x4FC1, 0}, {0xFFBF8305, 0x4FC9, 0}, {0xFFBF8605, 0x4FD1, 0},
+  {0xFFBF9D85, 0x4FD9, 0}, {0xFFBF9D85, 0x4FE1, 0}, {0xFFBFF605, 0x4FE9, 0}, {0xFFC01605, 0x4FF1, 0},
+  {0xFFC0B505, 0x4FF9, 0}, {0xFFC1CE85, 0x4A79, 0}, {0xFFC1D885, 0x5001, 0}, {0xFFC1F405, 0x5009, 0},
+  {0xFFC28C05, 0x5011, 0}, {0xFFC2D505, 0x5019, 0}, {0xFFC3C885, 0x5021, 0}, {0xFFC40E05, 0x5029, 0},
+  {0xFFC40D85, 0x5029, 0}, {0xFFC4FC05, 0x5031, 0}, {0xFFC75805, 0x5039, 0}, {0xFFC79A85, 0x5041, 0},
+  {0xFFC84F85, 0x5049, 0}, {0xFFC86B05, 0x5051, 0}, {0xFFC93785, 0x5059, 0}, {0xFFC95185, 0x5061, 0},
+  {0xFFCAA805, 0x5069, 0}, {0xFFCAE885, 0x4E89, 0}, {0xFFCE3D85, 0x5071, 0}, {0xFFCECB05, 0x5079, 0},
+  {0xFFCEE885, 0x5081, 0}, {0xFFB30505, 0x5089, 0}, {0x00A44105, 0x5091, 0}, {0xFFC3D585, 0x5099, 0},
+  {0xFFA9DB05, 0x50A1, 0}, {0xFFABA205, 0x50A9, 0}, {0xFFAB7B05, 0x50B1, 0}, {0xFFAA8685, 0x50B9, 0},
+  {0xFFAB6885, 0x50C1, 0}, {0xFFAB8585, 0x50C9, 0}, {0xFFAC2885, 0x50D1, 0}, {0xFFAC4185, 0x50D9, 0},
+  {0xFFAD9285, 0x4EF9, 0}, {0xFFAD6E05, 0x50E1, 0}, {0xFFAD8F85, 0x50E9, 0}, {0xFFADB385, 0x50F1, 0},
+  {0xFFAEEF05, 0x4E19, 0}, {0xFFAF1B05, 0x50F9, 0}, {0xFFAF6305, 0x5101, 0}, {0xFFAF6A85, 0x5109, 0},
+  {0xFFAFF105, 0x5111, 0}, {0xFFB05385, 0x5119, 0}, {0xFFB22805, 0x5121, 0}, {0xFFB22B05, 0x5129, 0},
+  {0xFFB27285, 0x5131, 0}, {0xFFB29405, 0x5139, 0}, {0xFFB32905, 0x5141, 0}, {0xFFB36385, 0x5149, 0},
+  {0xFFB34005, 0x5151, 0}, {0xFFB38285, 0x4F41, 0}, {0xFFB36B05, 0x5159, 0}, {0xFFB3B385, 0x4F49, 0},
+  {0xFFB3D405, 0x5161, 0}, {0xFFB49B85, 0x5169, 0}, {0xFFB4C705, 0x5171, 0}, {0xFFB4E185, 0x5179, 0},
+  {0xFFB56305, 0x5181, 0}, {0xFFB5F185, 0x4E21, 0}, {0xFFB64285, 0x4719, 0}, {0xFFB64405, 0x5189, 0},
+  {0xFFB66105, 0x5191, 0}, {0xFFB87205, 0x5199, 0}, {0xFFB89205, 0x4949, 0}, {0xFFB95505, 0x4C01, 0},
+  {0xFFBA2185, 0x51A1, 0}, {0xFFBA1905, 0x51A9, 0}, {0xFFBA4405, 0x4F81, 0}, {0xFFBAC185, 0x51B1, 0},
+  {0xFFBB6905, 0x4F89, 0}, {0xFFBE8505, 0x51B9, 0}, {0xFFBBCB85, 0x51C1, 0}, {0xFFBC0805, 0x51C9, 0},
+  {0xFFBC4505, 0x4E31, 0}, {0xFFBCE805, 0x51D1, 0}, {0xFFBD3205, 0x51D9, 0}, {0xFFBD4C05, 0x51E1, 0},
+  {0xFFBDBC85, 0x51E9, 0}, {0xFFBDBD05, 0x51F1, 0}, {0xFFBE1205, 0x4E39, 0}, {0xFFBE1A05, 0x51F9, 0},
+  {0xFFBE2605, 0x5201, 0}, {0xFFBE5085, 0x5209, 0}, {0xFFBE4B05, 0x5211, 0}, {0xFFBF1085, 0x5219, 0},
+  {0xFFC00285, 0x5221, 0}, {0xFFC08985, 0x4FF9, 0}, {0xFFC0E685, 0x5229, 0}, {0xFFC15605, 0x5231, 0},
+  {0xFFC1A205, 0x4A79, 0}, {0xFFC24685, 0x5239, 0}, {0xFFC2A985, 0x5019, 0}, {0xFFC44F85, 0x5241, 0},
+  {0xFFC49D85, 0x5249, 0}, {0xFFC66205, 0x5251, 0}, {0xFFC74585, 0x5259, 0}, {0xFFC76785, 0x5261, 0},
+  {0xFFC76F05, 0x5041, 0}, {0xFFC80305, 0x5269, 0}, {0xFFC81F05, 0x4E81, 0}, {0xFFC80805, 0x5271, 0},
+  {0xFFC82285, 0x5049, 0}, {0xFFC82085, 0x48B1, 0}, {0xFFC81785, 0x5279, 0}, {0xFFC83D05, 0x5051, 0},
+  {0xFFC86505, 0x5281, 0}, {0xFFC92385, 0x5061, 0}, {0xFFCA3B05, 0x5289, 0}, {0xFFCAD785, 0x5291, 0},
+  {0xFFCB6A85, 0x5299, 0}, {0xFFCBD885, 0x52A1, 0}, {0xFFCDDB05, 0x52A9, 0}, {0xFFCE0E05, 0x5071, 0},
+  {0xFFCE4705, 0x4E61, 0}, {0xFFCE8905, 0x52B1, 0}, {0xFFCE9A85, 0x5079, 0}, {0xFFCEA005, 0x52B9, 0},
+  {0xFFCEB785, 0x5081, 0}, {0xFFD02285, 0x52C1, 0}, {0xFFD26705, 0x4611, 0}, {0x0096BD85, 0x52C9, 0},
+  {0x0096BA05, 0x52D1, 0}, {0x009C8205, 0x52D9, 0}, {0xFFA06585, 0x52E1, 0}, {0xFFA2A285, 0x52E9, 0},
+  {0xFFA2B285, 0x52F1, 0}, {0x00ABBA05, 0x52F9, 0}, {0x00B0FD05, 0x5301, 0}, {0x00C1FE05, 0x5309, 0},
+  {0xFFD23585, 0x5311, 0}, {0xFFD25A85, 0x5319, 0}, {0x00031D89, 0x0000, 0}, {0x00031E89, 0x0000, 0},
+  {0x00031F89, 0x0000, 0}, {0x0003208D, 0x0000, 0}, {0x0003220D, 0x0000, 0}, {0x00032389, 0x0000, 0},
+  {0x00032489, 0x0000, 0}, {0x00032589, 0x0000, 0}, {0x00032689, 0x0000, 0}, {0x00032789, 0x0000, 0},
+  {0x00032889, 0x0000, 0}, {0x00032989, 0x5322, 0}, {0x00000000, 0x0000, 26}, {0x00032A89, 0x5332, 0},
+  {0xFF856105, 0x0000, 0}, {0xFF855785, 0x0000, 0}, {0xFF855885, 0x0000, 0}, {0xFF855B85, 0x0000, 0},
+  {0xFF856085, 0x0000, 0}, {0xFF828105, 0x0000, 0}, {0x00032B89, 0x5342, 0}, {0x00032C89, 0x5352, 0},
+  {0x00032D8D, 0x5363, 0}, {0x00032F0D, 0x537B, 0}, {0x00033089, 0x5392, 0}, {0x00033189, 0x53A2, 0},
+  {0x00033289, 0x53B2, 0}, {0x00033389, 0x53C2, 0}, {0x00033489, 0x53D2, 0}, {0x00033589, 0x53E2, 0},
+  {0x00033689, 0x53F2, 0}, {0x00033789, 0x5402, 0}, {0x00033889, 0x5412, 0}, {0x00033989, 0x5422, 0},
+  {0x00033A89, 0x5432, 0}, {0x00033B89, 0x5442, 0}, {0x00033C89, 0x5452, 0}, {0x00033D89, 0x5462, 0},
+  {0x00033E89, 0x5472, 0}, {0x00033F89, 0x5482, 0}, {0x00034089, 0x5492, 0}, {0x00034189, 0x54A2, 0},
+  {0x00034289, 0x54B2, 0}, {0x00034389, 0x54C2, 0}, {0x00034489, 0x54D2, 0}, {0x00034589, 0x54E2, 0},
+  {0x00034689, 0x54F2, 0}, {0x00034789, 0x5502, 0}, {0x00034889, 0x5512, 0}, {0x00034989, 0x5522, 0},
+  {0x00034A89, 0x5532, 0}, {0x00034B89, 0x5542, 0}, {0x00034C89, 0x0000, 0}, {0xFF859085, 0x0000, 0},
+  {0xFF859005, 0x0000, 0}, {0xFF859485, 0x0000, 0}, {0xFF859405, 0x0000, 0}, {0xFF859385, 0x0000, 0},
+  {0xFF859305, 0x0000, 0}, {0xFF859285, 0x0000, 0}, {0xFF859205, 0x0000, 0}, {0xFF859185, 0x0000, 0},
+  {0xFF858E05, 0x0000, 0}, {0xFF858D85, 0x0000, 0}, {0xFF858D05, 0x0000, 0}, {0xFF858C85, 0x0000, 0},
+  {0xFF858E85, 0x0000, 0}, {0xFF858985, 0x0000, 0}, {0xFF858905, 0x0000, 0}, {0xFF858885, 0x0000, 0},
+  {0xFF858805, 0x0000, 0}, {0xFF859D05, 0x0000, 0}, {0xFF859C85, 0x0000, 0}, {0xFF859C05, 0x0000, 0},
+  {0xFF859B85, 0x0000, 0}, {0xFF859B05, 0x0000, 0}, {0xFF859A85, 0x0000, 0}, {0xFF858785, 0x0000, 0},
+  {0xFF858685, 0x0000, 0}, {0xFF858605, 0x0000, 0}, {0xFF858585, 0x0000, 0}, {0xFF858505, 0x0000, 0},
+  {0xFF858485, 0x0000, 0}, {0xFF858405, 0x0000, 0}, {0xFF858385, 0x0000, 0}, {0xFF858305, 0x0000, 0},
+  {0xFF858005, 0x0000, 0}, {0xFF857F85, 0x0000, 0}, {0xFF858705, 0x0000, 0}, {0xFF858285, 0x0000, 0},
+  {0xFF858205, 0x0000, 0}, {0xFF858C05, 0x0000, 0}, {0xFF858B85, 0x0000, 0}, {0xFF858B05, 0x0000, 0},
+  {0xFF858A85, 0x0000, 0}, {0xFF858A05, 0x0000, 0}, {0xFF859105, 0x0000, 0}, {0xFF856D05, 0x0000, 0},
+  {0xFF856C85, 0x0000, 0}, {0xFF856C05, 0x0000, 0}, {0xFF856B85, 0x0000, 0}, {0xFF857805, 0x0000, 0},
+  {0xFF857785, 0x0000, 0}, {0xFF857685, 0x0000, 0}, {0xFF857605, 0x0000, 0}, {0xFF857285, 0x0000, 0},
+  {0xFF857205, 0x0000, 0}, {0xFF857385, 0x0000, 0}, {0xFF857305, 0x0000, 0}, {0xFF857585, 0x0000, 0},
+  {0xFF857505, 0x0000, 0}, {0xFF857485, 0x0000, 0}, {0xFF853085, 0x0000, 0}, {0xFF853005, 0x0000, 0},
+  {0x00034D89, 0x0000, 0}, {0x00034E89, 0x0000, 0}, {0x00034F89, 0x0000, 0}, {0x00035089, 0x0000, 0},
+  {0x00035189, 0x0000, 0}, {0x00035289, 0x0000, 0}, {0x00035389, 0x0000, 0}, {0x00035489, 0x0000, 0},
+  {0xFF856805, 0x0000, 0}, {0xFF856785, 0x0000, 0}, {0xFF856705, 0x0000, 0}, {0xFF856685, 0x0000, 0},
+  {0x00035589, 0x0000, 0}, {0x00035689, 0x0000, 0}, {0x00035789, 0x0000, 0}, {0x00035889, 0x0000, 0},
+  {0x00035989, 0x0000, 0}, {0x00035A89, 0x0000, 0}, {0x00035B89, 0x0000, 0}, {0x00035C89, 0x0000, 0},
+  {0x00035D89, 0x0000, 0}, {0x00035E89, 0x0000, 0}, {0x00035F89, 0x0000, 0}, {0x00036089, 0x0000, 0},
+  {0x00036189, 0x0000, 0}, {0x00036289, 0x0000, 0}, {0x00036389, 0x0000, 0}, {0x00036489, 0x0000, 0},
+  {0x00036589, 0x0000, 0}, {0x00036689, 0x0000, 0}, {0x00036789, 0x0000, 0}, {0x00036889, 0x0000, 0},
+  {0x00036989, 0x0000, 0}, {0x00036A89, 0x0000, 0}, {0x00036B89, 0x0000, 0}, {0x00036C89, 0x0000, 0},
+  {0x00036D89, 0x0000, 0}, {0x00036E89, 0x0000, 0}, {0x00036F89, 0x0000, 0}, {0x00037089, 0x0000, 0},
+  {0x00037189, 0x0000, 0}, {0x00037289, 0x0000, 0}, {0x00037389, 0x0000, 0}, {0x00037489, 0x0000, 0},
+  {0x00037589, 0x0000, 0}, {0x00037689, 0x0000, 0}, {0x00037789, 0x0000, 0}, {0x00037889, 0x0000, 0},
+  {0x00037989, 0x0000, 0}, {0x00037A89, 0x0000, 0}, {0x00037B89, 0x0000, 0}, {0x00037C89, 0x0000, 0},
+  {0x00037D89, 0x0000, 0}, {0x00037E89, 0x0000, 0}, {0x00037F89, 0x0000, 0}, {0x00038089, 0x0000, 0},
+  {0x00038189, 0x0000, 0}, {0x00038289, 0x0000, 0}, {0x00038389, 0x0000, 0}, {0x00038489, 0x0000, 0},
+  {0x00038589, 0x0000, 0}, {0x00038689, 0x0000, 0}, {0x00038789, 0x0000, 0}, {0x00038889, 0x0000, 0},
+  {0x00038989, 0x0000, 0}, {0x00038A89, 0x0000, 0}, {0x00038B89, 0x0000, 0}, {0x00038C89, 0x0000, 0},
+  {0x00038D89, 0x0000, 0}, {0x00038E89, 0x0000, 0}, {0x00038F89, 0x0000, 0}, {0x00039089, 0x0000, 0},
+  {0x00039189, 0x0000, 0}, {0x00039289, 0x0000, 0}, {0x00039389, 0x0000, 0}, {0x00039489, 0x0000, 0},
+  {0x00039589, 0x0000, 0}, {0x00039689, 0x0000, 0}, {0x00039789, 0x0000, 0}, {0x00039889, 0x0000, 0},
+  {0x00039989, 0x0000, 0}, {0x00039A89, 0x0000, 0}, {0x00039B89, 0x0000, 0}, {0x00039C89, 0x0000, 0},
+  {0x00039D89, 0x0000, 0}, {0x00039E89, 0x0000, 0}, {0x00039F89, 0x0000, 0}, {0x0003A089, 0x0000, 0},
+  {0x0003A189, 0x0000, 0}, {0x0003A289, 0x0000, 0}, {0x0003A389, 0x0000, 0}, {0x0003A489, 0x0000, 0},
+  {0x0003A589, 0x0000, 0}, {0x0003A689, 0x0000, 0}, {0x0003A789, 0x0000, 0}, {0x0003A889, 0x0000, 0},
+  {0x0003A989, 0x0000, 0}, {0x0003AA89, 0x0000, 0}, {0x0003AB89, 0x0000, 0}, {0x0003AC89, 0x0000, 0},
+  {0x0003AD89, 0x0000, 0}, {0x0003AE89, 0x0000, 0}, {0x0003AF89, 0x0000, 0}, {0x0003B089, 0x0000, 0},
+  {0x0003B189, 0x0000, 0}, {0x0003B28D, 0x0000, 0}, {0x0003B40D, 0x0000, 0}, {0x0003B58D, 0x0000, 0},
+  {0x0003B70D, 0x0000, 0}, {0x0003B88D, 0x0000, 0}, {0x0003BA0D, 0x0000, 0}, {0x0003BB89, 0x0000, 0},
+  {0x0003BC89, 0x0000, 0}, {0x0003BD89, 0x0000, 0}, {0x0003BE89, 0x0000, 0}, {0x0003BF89, 0x0000, 0},
+  {0x0003C089, 0x0000, 0}, {0x0003C189, 0x0000, 0}, {0x0003C289, 0x0000, 0}, {0x0003C389, 0x0000, 0},
+  {0x0003C489, 0x0000, 0}, {0x0003C589, 0x0000, 0}, {0x0003C689, 0x0000, 0}, {0x0003C789, 0x0000, 0},
+  {0x0003C889, 0x0000, 0}, {0x0003C989, 0x0000, 0}, {0x0003CA89, 0x0000, 0}, {0x0003CB89, 0x0000, 0},
+  {0x0003CC89, 0x0000, 0}, {0x0003CD89, 0x0000, 0}, {0x0003CE89, 0x0000, 0}, {0x0003CF89, 0x0000, 0},
+  {0x0003D089, 0x0000, 0}, {0x0003D189, 0x0000, 0}, {0x0003D289, 0x0000, 0}, {0x0003D389, 0x0000, 0},
+  {0x0003D489, 0x0000, 0}, {0x0003D589, 0x0000, 0}, {0x0003D689, 0x0000, 0}, {0x0003D789, 0x0000, 0},
+  {0x0003D889, 0x0000, 0}, {0x0003D989, 0x0000, 0}, {0x0003DA89, 0x0000, 0}, {0x0003DB8D, 0x0000, 0},
+  {0x0003DD0D, 0x0000, 0}, {0x0003DE8D, 0x0000, 0}, {0x0003E009, 0x0000, 0}, {0x0003E109, 0x0000, 0},
+  {0x0003E209, 0x0000, 0}, {0x0003E309, 0x0000, 0}, {0x0003E409, 0x0000, 0}, {0x0003E509, 0x0000, 0},
+  {0x0003E609, 0x0000, 0}, {0x0003E709, 0x0000, 0}, {0x0003E809, 0x0000, 0}, {0x0003E909, 0x0000, 0},
+  {0x0003EA09, 0x0000, 0}, {0x0003EB09, 0x0000, 0}, {0x0003EC09, 0x0000, 0}, {0x0003ED09, 0x0000, 0},
+  {0x0003EE09, 0x0000, 0}, {0x0003EF09, 0x0000, 0}, {0x0003F009, 0x0000, 0}, {0x0003F109, 0x0000, 0},
+  {0x0003F209, 0x0000, 0}, {0x0003F309, 0x0000, 0}, {0x0003F409, 0x0000, 0}, {0x0003F509, 0x0000, 0},
+  {0x0003F609, 0x0000, 0}, {0x0003F709, 0x0000, 0}, {0x0003F809, 0x0000, 0}, {0x0003F909, 0x0000, 0},
+  {0x0003FA09, 0x0000, 0}, {0x0003FB09, 0x0000, 0}, {0x0003FC0D, 0x0000, 0}, {0x0003FD8D, 0x0000, 0},
+  {0x0003FF0D, 0x0000, 0}, {0x0004008D, 0x0000, 0}, {0x0004020D, 0x0000, 0}, {0x0004038D, 0x0000, 0},
+  {0x0004050D, 0x0000, 0}, {0x0004068D, 0x0000, 0}, {0x0004080D, 0x0000, 0}, {0x0004098D, 0x0000, 0},
+  {0x00040B0D, 0x0000, 0}, {0x00040C8D, 0x0000, 0}, {0x00040E0D, 0x0000, 0}, {0x00040F8D, 0x0000, 0},
+  {0x0004110D, 0x0000, 0}, {0x0004128D, 0x0000, 0}, {0x0004140D, 0x0000, 0}, {0x0004158D, 0x0000, 0},
+  {0x0004170D, 0x0000, 0}, {0x0004188D, 0x0000, 0}, {0x00041A0D, 0x0000, 0}, {0x00041B8D, 0x0000, 0},
+  {0x00041D0D, 0x0000, 0}, {0x00041E8D, 0x0000, 0}, {0x0004200D, 0x0000, 0}, {0x0004218D, 0x0000, 0},
+  {0x0004230D, 0x0000, 0}, {0x0004248D, 0x0000, 0}, {0x0004260D, 0x0000, 0}, {0x0004278D, 0x0000, 0},
+  {0x0004290D, 0x0000, 0}, {0x00042A8D, 0x0000, 0}, {0x00042C0D, 0x0000, 0}, {0x00042D8D, 0x0000, 0},
+  {0x00042F0D, 0x0000, 0}, {0x0004308D, 0x0000, 0}, {0x0004320D, 0x0000, 0}, {0x0004338D, 0x0000, 0},
+  {0x0004350D, 0x0000, 0}, {0x0004368D, 0x0000, 0}, {0x0004380D, 0x0000, 0}, {0x0004398D, 0x0000, 0},
+  {0x00043B0D, 0x0000, 0}, {0x00043C8D, 0x0000, 0}, {0x00043E0D, 0x0000, 0}, {0x00043F8D, 0x0000, 0},
+  {0x0004410D, 0x0000, 0}, {0x0004428D, 0x0000, 0}, {0x0004440D, 0x0000, 0}, {0x0004458D, 0x0000, 0},
+  {0x0004470D, 0x0000, 0}, {0x0004488D, 0x0000, 0}, {0x00044A0D, 0x0000, 0}, {0x00044B8D, 0x0000, 0},
+  {0x00044D0D, 0x0000, 0}, {0x00044E8D, 0x0000, 0}, {0x0004500D, 0x0000, 0}, {0x0004518D, 0x0000, 0},
+  {0x0004530D, 0x0000, 0}, {0x0004548D, 0x0000, 0}, {0x0004560D, 0x0000, 0}, {0x0004578D, 0x0000, 0},
+  {0x0004590D, 0x0000, 0}, {0x00045A8D, 0x0000, 0}, {0x00045C0D, 0x0000, 0}, {0x00045D8D, 0x0000, 0},
+  {0x00045F0D, 0x0000, 0}, {0x0004608D, 0x0000, 0}, {0x0004620D, 0x0000, 0}, {0x0004638D, 0x0000, 0},
+  {0x0004650D, 0x0000, 0}, {0x0004668D, 0x0000, 0}, {0x0004680D, 0x0000, 0}, {0x0004698D, 0x0000, 0},
+  {0x00046B0D, 0x0000, 0}, {0x00046C8D, 0x0000, 0}, {0x00046E0D, 0x0000, 0}, {0x00046F8D, 0x0000, 0},
+  {0x0004710D, 0x0000, 0}, {0x0004728D, 0x0000, 0}, {0x0004740D, 0x0000, 0}, {0x0004758D, 0x0000, 0},
+  {0x0004770D, 0x0000, 0}, {0x0004788D, 0x0000, 0}, {0x00047A0D, 0x0000, 0}, {0x00047B8D, 0x0000, 0},
+  {0x00047D0D, 0x0000, 0}, {0x00047E8D, 0x0000, 0}, {0x0004800D, 0x0000, 0}, {0x0004818D, 0x0000, 0},
+  {0x0004830D, 0x0000, 0}, {0x0004848D, 0x0000, 0}, {0x0004860D, 0x0000, 0}, {0x0004878D, 0x0000, 0},
+  {0x0004890D, 0x0000, 0}, {0x00048A8D, 0x0000, 0}, {0x00048C11, 0x0000, 0}, {0x00048E11, 0x0000, 0},
+  {0x00049011, 0x0000, 0}, {0x00049211, 0x0000, 0}, {0x00049411, 0x0000, 0}, {0x00049611, 0x0000, 0},
+  {0x00049811, 0x0000, 0}, {0x00049A0D, 0x0000, 0}, {0x00049BC9, 0x0000, 0}, {0x0004A4A1, 0x0000, 0},
+  {0x0004A891, 0x0000, 0}, {0xFF810E05, 0x0000, 0}, {0xFF98F805, 0x0000, 0}, {0xFF811385, 0x0000, 0},
+  {0xFF810605, 0x0000, 0}, {0xFF811485, 0x0000, 0}, {0xFF98FF85, 0x0000, 0}, {0xFF90F185, 0x0000, 0},
+  {0xFF90F085, 0x0000, 0}, {0xFF811605, 0x0000, 0}, {0xFF811585, 0x0000, 0}, {0xFF80F985, 0x0000, 0},
+  {0xFF812205, 0x0000, 0}, {0xFF812285, 0x0000, 0}, {0xFF98ED85, 0x0000, 0}, {0xFF98EA85, 0x0000, 0},
+  {0xFF98E685, 0x0000, 0}, {0xFF98E485, 0x0000, 0}, {0xFF98E585, 0x0000, 0}, {0xFF810A05, 0x0000, 0},
+  {0xFF810A85, 0x0000, 0}, {0xFF810905, 0x0000, 0}, {0xFF810885, 0x0000, 0}, {0xFF810805, 0x0000, 0},
+  {0xFF80EE05, 0x0000, 0}, {0xFF98D805, 0x0000, 0}, {0xFF80F385, 0x0000, 0}, {0xFF80F285, 0x0000, 0},
+  {0xFF80F485, 0x0000, 0}, {0xFF80E505, 0x0000, 0}, {0xFF90DE05, 0x0000, 0}, {0xFF80E785, 0x0000, 0},
+  {0xFF811005, 0x0000, 0}, {0xFF811085, 0x0000, 0}, {0xFF98DB85, 0x0000, 0}, {0xFF80E205, 0x0000, 0},
+  {0xFF80E305, 0x0000, 0}, {0xFF80E485, 0x0000, 0}, {0xFF80EC05, 0x0000, 0}, {0xFF80EC85, 0x0000, 0},
+  {0xFF80EB85, 0x0000, 0}, {0xFF80FA05, 0x0000, 0}, {0xFF80DD85, 0x0000, 0}, {0xFF80EA85, 0x0000, 0},
+  {0x0004AA89, 0x0000, 0}, {0x0004AB89, 0x0000, 0}, {0x0004AC89, 0x0000, 0}, {0x0004AD89, 0x0000, 0},
+  {0x0004AE89, 0x0000, 0}, {0x0004AF89, 0x0000, 0}, {0x0004B089, 0x0000, 0}, {0x0004B189, 0x0000, 0},
+  {0x0004B289, 0x0000, 0}, {0x0004B389, 0x0000, 0}, {0x0004B489, 0x0000, 0}, {0x0004B589, 0x0000, 0},
+  {0x0004B689, 0x0000, 0}, {0x0004B789, 0x0000, 0}, {0xFF83D085, 0x0000, 0}, {0xFF83D005, 0x0000, 0},
+  {0xFF83CF85, 0x0000, 0}, {0xFF83CF05, 0x0000, 0}, {0xFF83CE85, 0x0000, 0}, {0xFF83CE05, 0x0000, 0},
+  {0xFF83CD85, 0x0000, 0}, {0xFF83CD05, 0x0000, 0}, {0xFF83CC85, 0x0000, 0}, {0xFF83CC05, 0x0000, 0},
+  {0xFF83CB85, 0x0000, 0}, {0xFF83CB05, 0x0000, 0}, {0xFF83CA85, 0x0000, 0}, {0xFF83CA05, 0x0000, 0},
+  {0xFF83C985, 0x0000, 0}, {0xFF83C905, 0x0000, 0}, {0xFF83C885, 0x0000, 0}, {0xFF83C805, 0x0000, 0},
+  {0xFF83C785, 0x0000, 0}, {0xFF83C705, 0x0000, 0}, {0xFF83C685, 0x0000, 0}, {0xFF83C605, 0x0000, 0},
+  {0xFF83C585, 0x0000, 0}, {0xFF83C505, 0x0000, 0}, {0xFF83C485, 0x0000, 0}, {0xFF83C405, 0x0000, 0},
+  {0xFF83C385, 0x0000, 0}, {0xFF83C305, 0x0000, 0}, {0xFF83C285, 0x0000, 0}, {0xFF83C205, 0x0000, 0},
+  {0xFF83C185, 0x0000, 0}, {0xFF83C105, 0x0000, 0}, {0xFF83C085, 0x0000, 0}, {0xFF83C005, 0x0000, 0},
+  {0xFF83BF85, 0x0000, 0}, {0xFF83BF05, 0x0000, 0}, {0xFF83BE85, 0x0000, 0}, {0xFF83BE05, 0x0000, 0},
+  {0xFF83BD85, 0x0000, 0}, {0xFF83BD05, 0x0000, 0}, {0xFF83BC85, 0x0000, 0}, {0xFF83BC05, 0x0000, 0},
+  {0xFF83BB85, 0x0000, 0}, {0xFF83BB05, 0x0000, 0}, {0xFF83BA85, 0x0000, 0}, {0xFF83BA05, 0x0000, 0},
+  {0xFF83B985, 0x0000, 0}, {0xFF83B905, 0x0000, 0}, {0xFF83B885, 0x0000, 0}, {0xFF83B805, 0x0000, 0},
+  {0xFF83B785, 0x0000, 0}, {0xFF83B705, 0x0000, 0}, {0xFF83B685, 0x0000, 0}, {0xFF83B605, 0x0000, 0},
+  {0xFF83B585, 0x0000, 0}, {0xFF83B505, 0x0000, 0}, {0xFF83B485, 0x0000, 0}, {0xFF83B405, 0x0000, 0},
+  {0xFF83B385, 0x0000, 0}, {0xFF83B305, 0x0000, 0}, {0xFF83B285, 0x0000, 0}, {0xFF83B205, 0x0000, 0},
+  {0xFF83B185, 0x0000, 0}, {0xFF83B105, 0x0000, 0}, {0xFF83B085, 0x0000, 0}, {0xFF83B005, 0x0000, 0},
+  {0xFF83AF85, 0x0000, 0}, {0xFF83AF05, 0x0000, 0}, {0xFF83AE85, 0x0000, 0}, {0xFF83AE05, 0x0000, 0},
+  {0xFF83AD85, 0x0000, 0}, {0xFF83AD05, 0x0000, 0}, {0xFF83AC85, 0x0000, 0}, {0xFF83AC05, 0x0000, 0},
+  {0xFF83AB85, 0x0000, 0}, {0xFF83AB05, 0x0000, 0}, {0x0004B889, 0x0000, 0}, {0x0004B989, 0x0000, 0},
+  {0x0004BA89, 0x0000, 0}, {0x0004BB89, 0x0000, 0}, {0xFF809005, 0x0000, 0}, {0xFF80A005, 0x0000, 0},
+  {0xFF951305, 0x0000, 0}, {0xFF806685, 0x0000, 0}, {0xFF985505, 0x0000, 0}, {0xFF984E85, 0x0000, 0},
+  {0xFF98CB05, 0x0000, 0}, {0xFF98C605, 0x0000, 0}, {0xFF989D05, 0x0000, 0}, {0xFF989D85, 0x0000, 0},
+  {0xFF989E05, 0x0000, 0}, {0xFF989E85, 0x0000, 0}, {0xFF989F05, 0x0000, 0}, {0xFF98BB85, 0x0000, 0},
+  {0xFF98BC05, 0x0000, 0}, {0xFF98BC85, 0x0000, 0}, {0xFF98AA05, 0x0000, 0}, {0xFF989885, 0x0000, 0},
+  {0xFF989905, 0x0000, 0}, {0xFF989985, 0x0000, 0}, {0xFF989A05, 0x0000, 0}, {0xFF989A85, 0x0000, 0},
+  {0xFF989B05, 0x0000, 0}, {0xFF989B85, 0x0000, 0}, {0xFF989C05, 0x0000, 0}, {0xFF989C85, 0x0000, 0},
+  {0xFF989F85, 0x0000, 0}, {0xFF98A005, 0x0000, 0}, {0xFF98A105, 0x0000, 0}, {0xFF98A185, 0x0000, 0},
+  {0xFF98A205, 0x0000, 0}, {0xFF98A285, 0x0000, 0}, {0xFF98A385, 0x0000, 0}, {0xFF98A485, 0x0000, 0},
+  {0xFF98A585, 0x0000, 0}, {0xFF98A685, 0x0000, 0}, {0xFF98A785, 0x0000, 0}, {0xFF98A805, 0x0000, 0},
+  {0xFF98A885, 0x0000, 0}, {0xFF98A905, 0x0000, 0}, {0xFF98A985, 0x0000, 0}, {0xFF98AB05, 0x0000, 0},
+  {0xFF987D85, 0x0000, 0}, {0xFF88AF85, 0x0000, 0}, {0xFF890385, 0x0000, 0}, {0xFF88AF05, 0x0000, 0},
+  {0xFF88AE05, 0x0000, 0}, {0xFF890305, 0x0000, 0}, {0xFF88B505, 0x0000, 0}, {0xFF88AA85, 0x0000, 0},
+  {0xFF88B685, 0x0000, 0}, {0xFF88AA05, 0x0000, 0}, {0xFF88CF85, 0x0000, 0}, {0xFF88CE85, 0x0000, 0},
+  {0xFF88CD85, 0x0000, 0}, {0xFF88CC85, 0x0000, 0}, {0xFF806105, 0x0000, 0}, {0xFF806505, 0x0000, 0},
+  {0xFF806005, 0x0000, 0}, {0xFF906185, 0x0000, 0}, {0xFF928D05, 0x0000, 0}, {0xFF90D385, 0x0000, 0},
+  {0xFF92D985, 0x0000, 0}, {0xFF92EE85, 0x0000, 0}, {0x00001405, 0x0000, 0}, {0x00001385, 0x0000, 0},
+  {0xFF7DA785, 0x0000, 0}, {0xFF7CB185, 0x0000, 0}, {0xFF7D8A85, 0x0000, 0}, {0xFF7D6705, 0x0000, 0},
+  {0xFF7D8E05, 0x0000, 0}, {0xFFD1EF05, 0x0000, 0}, {0xFF7D8D05, 0x0000, 0}, {0xFF7D6585, 0x0000, 0},
+  {0xFF8B0205, 0x0000, 0}, {0xFF7D6505, 0x0000, 0}, {0xFF7D6785, 0x0000, 0}, {0xFF7D8C85, 0x0000, 0},
+  {0xFF7D6985, 0x0000, 0}, {0xFF7D6805, 0x0000, 0}, {0xFF7D6685, 0x0000, 0}, {0xFF7D8385, 0x0000, 0},
+  {0xFF7CC905, 0x0000, 0}, {0xFF7D8305, 0x0000, 0}, {0xFF7D7605, 0x0000, 0}, {0xFF7D8885, 0x0000, 0},
+  {0xFF7D6885, 0x0000, 0}, {0x006BB405, 0x0000, 0}, {0xFFCFF885, 0x0000, 0}, {0x006BB305, 0x0000, 0},
+  {0xFF7D7705, 0x0000, 0}, {0x006BB285, 0x0000, 0}, {0xFF7CAB05, 0x0000, 0}, {0xFF7C6605, 0x0000, 0},
+  {0xFF7D6A05, 0x0000, 0}, {0x006BB085, 0x0000, 0}, {0xFF7D6A85, 0x0000, 0}, {0xFF7D6B05, 0x0000, 0},
+  {0xFF7D7E85, 0x0000, 0}, {0xFF7D7D05, 0x0000, 0}, {0xFFD1DD05, 0x0000, 0}, {0xFF7D7C85, 0x0000, 0},
+  {0xFF7D6C85, 0x0000, 0}, {0xFF926085, 0x0000, 0}, {0xFF7D6E85, 0x0000, 0}, {0xFF7D7185, 0x0000, 0},
+  {0xFF7D0505, 0x0000, 0}, {0x006BA885, 0x0000, 0}, {0x006BB205, 0x0000, 0}, {0x00002005, 0x0000, 0},
+  {0x00000000, 0x5552, 0}, {0x00000000, 0x5562, 0}, {0x00000000, 0x5572, 0}, {0x00000000, 0x5582, 0},
+  {0x00000000, 0x5592, 0}, {0x00000000, 0x55A2, 0}, {0x00000000, 0x55B2, 0}, {0x00000000, 0x55C2, 0},
+  {0x00000000, 0x55D2, 0}, {0x00000000, 0x55E2, 0}, {0x00000000, 0x55F2, 0}, {0x00000000, 0x5602, 0},
+  {0x00000000, 0x5612, 0}, {0x00000000, 0x0000, 6}, {0x0004BC89, 0x5622, 0}, {0x0004BD89, 0x5632, 0},
+  {0x0004BE8D, 0x5643, 0}, {0x0004C00D, 0x565B, 0}, {0x0004C18D, 0x5673, 0}, {0x0004C30D, 0x568B, 0},
+  {0x0004C48D, 0x56A3, 0}, {0x00000000, 0x0000, 226}, {0x0004C609, 0x56BA, 0}, {0x0004C709, 0x56CA, 0},
+  {0x0004C80D, 0x56DB, 0}, {0x0004C98D, 0x56F3, 0}, {0x0004CB0D, 0x570B, 0}, {0x0004CC8D, 0x5723, 0},
+  {0xFF163085, 0x0000, 0}, {0xFF162385, 0x0000, 0}, {0xFF161685, 0x0000, 0}, {0xFF160985, 0x0000, 0},
+  {0xFF15FC85, 0x0000, 0}, {0xFF15EF85, 0x0000, 0}, {0xFF15E285, 0x0000, 0}, {0xFF15D585, 0x0000, 0},
+  {0xFF15C885, 0x0000, 0}, {0xFF15BB85, 0x0000, 0}, {0xFF15AE85, 0x0000, 0}, {0xFF15A185, 0x0000, 0},
+  {0xFF159485, 0x0000, 0}, {0xFF158785, 0x0000, 0}, {0xFF157A85, 0x0000, 0}, {0xFF156D85, 0x0000, 0},
+  {0xFF156085, 0x0000, 0}, {0xFF155385, 0x0000, 0}, {0xFF154685, 0x0000, 0}, {0xFF153985, 0x0000, 0},
+  {0xFF152C85, 0x0000, 0}, {0xFF151F85, 0x0000, 0}, {0xFF151285, 0x0000, 0}, {0xFF150585, 0x0000, 0},
+  {0xFF14F885, 0x0000, 0}, {0xFF14EB85, 0x0000, 0}, {0xFF15C905, 0x0000, 0}, {0xFF168485, 0x0000, 0},
+  {0xFF167F85, 0x0000, 0}, {0xFF25A305, 0x0000, 0}, {0xFF167785, 0x0000, 0}, {0xFF167805, 0x0000, 0},
+  {0xFF259385, 0x0000, 0}, {0xFF166C85, 0x0000, 0}, {0xFF166D85, 0x0000, 0}, {0xFF166E05, 0x0000, 0},
+  {0xFF167385, 0x0000, 0}, {0xFF167085, 0x0000, 0}, {0xFF166F85, 0x0000, 0}, {0xFF166785, 0x0000, 0},
+  {0xFF166285, 0x0000, 0}, {0xFF258605, 0x0000, 0}, {0xFF165A85, 0x0000, 0}, {0xFF165B05, 0x0000, 0},
+  {0xFF257685, 0x0000, 0}, {0xFF164F85, 0x0000, 0}, {0xFF165085, 0x0000, 0}, {0xFF165105, 0x0000, 0},
+  {0xFF165685, 0x0000, 0}, {0xFF165385, 0x0000, 0}, {0xFF165285, 0x0000, 0}, {0xFF164A85, 0x0000, 0},
+  {0xFF164585, 0x0000, 0}, {0xFF256905, 0x0000, 0}, {0xFF163D85, 0x0000, 0}, {0xFF163E05, 0x0000, 0},
+  {0xFF255985, 0x0000, 0}, {0xFF163285, 0x0000, 0}, {0xFF163385, 0x0000, 0}, {0xFF163405, 0x0000, 0},
+  {0xFF163985, 0x0000, 0}, {0xFF163685, 0x0000, 0}, {0xFF163585, 0x0000, 0}, {0xFF162D85, 0x0000, 0},
+  {0xFF162885, 0x0000, 0}, {0xFF254C05, 0x0000, 0}, {0xFF162085, 0x0000, 0}, {0xFF162105, 0x0000, 0},
+  {0xFF253C85, 0x0000, 0}, {0xFF161585, 0x0000, 0}, {0xFF161705, 0x0000, 0}, {0xFF161C85, 0x0000, 0},
+  {0xFF161985, 0x0000, 0}, {0xFF161885, 0x0000, 0}, {0xFF161085, 0x0000, 0}, {0xFF160B85, 0x0000, 0},
+  {0xFF252F05, 0x0000, 0}, {0xFF160385, 0x0000, 0}, {0xFF160405, 0x0000, 0}, {0xFF251F85, 0x0000, 0},
+  {0xFF15F885, 0x0000, 0}, {0xFF15F985, 0x0000, 0}, {0xFF15FA05, 0x0000, 0}, {0xFF15FF85, 0x0000, 0},
+  {0xFF15FB85, 0x0000, 0}, {0xFF160905, 0x0000, 0}, {0xFF143105, 0x0000, 0}, {0xFF142C05, 0x0000, 0},
+  {0xFF142705, 0x0000, 0}, {0xFF142205, 0x0000, 0}, {0xFF141D05, 0x0000, 0}, {0xFF120005, 0x0000, 0},
+  {0xFF120085, 0x0000, 0}, {0xFF120105, 0x0000, 0}, {0xFF120205, 0x0000, 0}, {0xFF120285, 0x0000, 0},
+  {0xFF631F85, 0x0000, 0}, {0xFF124705, 0x0000, 0}, {0xFF120505, 0x0000, 0}, {0xFF120585, 0x0000, 0},
+  {0xFF124D85, 0x0000, 0}, {0xFF123005, 0x0000, 0}, {0xFF123F85, 0x0000, 0}, {0xFF11EF85, 0x0000, 0},
+  {0xFF11F005, 0x0000, 0}, {0xFF11F105, 0x0000, 0}, {0xFF11F185, 0x0000, 0}, {0xFF11F205, 0x0000, 0},
+  {0xFF11F285, 0x0000, 0}, {0xFF121505, 0x0000, 0}, {0xFF11F705, 0x0000, 0}, {0xFF11F605, 0x0000, 0},
+  {0xFF11FA85, 0x0000, 0}, {0xFF122005, 0x0000, 0}, {0xFF62F285, 0x0000, 0}, {0xFF122205, 0x0000, 0},
+  {0x00001105, 0x0000, 0}, {0xFF0C1385, 0x0000, 0}, {0xFF0C1505, 0x0000, 0}, {0xFF0C1605, 0x0000, 0},
+  {0xFF0C2185, 0x0000, 0}, {0xFF0C1305, 0x0000, 0}, {0xFF0C1785, 0x0000, 0}, {0xFF0C2085, 0x0000, 0},
+  {0xFF0C1C85, 0x0000, 0}, {0xFF0C1285, 0x0000, 0}, {0xFF0C1885, 0x0000, 0}, {0xFF0C1205, 0x0000, 0},
+  {0xFF0C1805, 0x0000, 0}, {0xFF0C0F05, 0x0000, 0}, {0xFF0C1005, 0x0000, 0}, {0xFF0C0A85, 0x0000, 0},
+  {0xFF0C0B85, 0x0000, 0}, {0xFF0C0C05, 0x0000, 0}, {0xFF0C0E85, 0x0000, 0}, {0xFF0C0F85, 0x0000, 0},
+  {0xFF0C2905, 0x0000, 0}, {0xFF0C4E85, 0x0000, 0}, {0xFF0C4185, 0x0000, 0}, {0xFF0C2805, 0x0000, 0},
+  {0xFF0C0385, 0x0000, 0}, {0xFF0C0505, 0x0000, 0}, {0xFF0C1185, 0x0000, 0}, {0xFF0C0305, 0x0000, 0},
+  {0xFF0C1085, 0x0000, 0}, {0xFF0C0C85, 0x0000, 0}, {0xFF0C0285, 0x0000, 0}, {0xFF0C0885, 0x0000, 0},
+  {0xFF0C0205, 0x0000, 0}, {0xFF0C0805, 0x0000, 0}, {0xFF0C0005, 0x0000, 0}, {0xFF0BFA85, 0x0000, 0},
+  {0xFF0BFB85, 0x0000, 0}, {0xFF0BFE85, 0x0000, 0}, {0xFF0BFF85, 0x0000, 0}, {0xFF0BF505, 0x0000, 0},
+  {0xFF0BF305, 0x0000, 0}, {0xFF0C0085, 0x0000, 0}, {0xFF0BFC85, 0x0000, 0}, {0xFF0BF285, 0x0000, 0},
+  {0xFF0BF205, 0x0000, 0}, {0xFF0BF805, 0x0000, 0}, {0xFF0BF005, 0x0000, 0}, {0xFF0BEB85, 0x0000, 0},
+  {0xFF0BEE85, 0x0000, 0}, {0xFF0BEF85, 0x0000, 0}, {0xFF0C2E85, 0x0000, 0}, {0xFF0BE385, 0x0000, 0},
+  {0xFF0BE505, 0x0000, 0}, {0xFF0BF185, 0x0000, 0}, {0xFF0BE305, 0x0000, 0}, {0xFF0BE785, 0x0000, 0},
+  {0xFF0BF085, 0x0000, 0}, {0xFF0BEC85, 0x0000, 0}, {0xFF0BE285, 0x0000, 0}, {0xFF0BE885, 0x0000, 0},
+  {0xFF0BE205, 0x0000, 0}, {0xFF0BE805, 0x0000, 0}, {0xFF0BE005, 0x0000, 0}, {0xFF0BDA85, 0x0000, 0},
+  {0xFF0BDB85, 0x0000, 0}, {0xFF0BDE85, 0x0000, 0}, {0xFF0BDF05, 0x0000, 0}, {0xFF0BDF85, 0x0000, 0},
+  {0xFF0BF905, 0x0000, 0}, {0xFF0BD385, 0x0000, 0}, {0xFF0BD505, 0x0000, 0}, {0xFF0BD605, 0x0000, 0},
+  {0xFF0BE185, 0x0000, 0}, {0xFF0BD305, 0x0000, 0}, {0xFF0BD785, 0x0000, 0}, {0xFF0BE085, 0x0000, 0},
+  {0xFF0BDC85, 0x0000, 0}, {0xFF0BD285, 0x0000, 0}, {0xFF0BD885, 0x0000, 0}, {0xFF0BD205, 0x0000, 0},
+  {0xFF0BD805, 0x0000, 0}, {0xFF0BCF05, 0x0000, 0}, {0xFF0BD005, 0x0000, 0}, {0xFF0BCA85, 0x0000, 0},
+  {0xFF0BCB85, 0x0000, 0}, {0xFF0BCC05, 0x0000, 0}, {0xFF0BCE85, 0x0000, 0}, {0xFF0BCF85, 0x0000, 0},
+  {0xFF0BC385, 0x0000, 0}, {0xFF0BC505, 0x0000, 0}, {0xFF0BC605, 0x0000, 0}, {0xFF0BD185, 0x0000, 0},
+  {0xFF0BC305, 0x0000, 0}, {0xFF0BC785, 0x0000, 0}, {0xFF0BD085, 0x0000, 0}, {0xFF0BCC85, 0x0000, 0},
+  {0xFF0BC285, 0x0000, 0}, {0xFF0BC885, 0x0000, 0}, {0xFF0BC205, 0x0000, 0}, {0xFF0BC805, 0x0000, 0},
+  {0xFF0BBF05, 0x0000, 0}, {0xFF0BC005, 0x0000, 0}, {0xFF0BBA85, 0x0000, 0}, {0xFF0BBB85, 0x0000, 0},
+  {0xFF0BBC05, 0x0000, 0}, {0xFF0BBE85, 0x0000, 0}, {0xFF0BBF85, 0x0000, 0}, {0x0004CE09, 0x0000, 0},
+  {0x0004CF09, 0x0000, 0}, {0x0004D009, 0x0000, 0}, {0x0004D109, 0x0000, 0}, {0x0004D209, 0x0000, 0},
+  {0x0004D309, 0x0000, 0}, {0x0004D409, 0x0000, 0}, {0x0004D509, 0x0000, 0}, {0x0004D609, 0x0000, 0},
+  {0x0004D709, 0x0000, 0}, {0x0004D80D, 0x0000, 0}, {0xFF079C05, 0x0000, 0}, {0xFF07A305, 0x0000, 0},
+  {0x0004D989, 0x0000, 0}, {0xFF079885, 0x0000, 0}, {0x0004DA89, 0x0000, 0}, {0x0004DB89, 0x0000, 0},
+  {0x0004DC89, 0x0000, 0}, {0x0004DD8D, 0x0000, 0}, {0x0004DF09, 0x0000, 0}, {0x0004E009, 0x0000, 0},
+  {0x0004E109, 0x0000, 0}, {0x0004E209, 0x0000, 0}, {0x0004E309, 0x0000, 0}, {0x0004E409, 0x0000, 0},
+  {0x0004E509, 0x0000, 0}, {0xFF1F5985, 0x0000, 0}, {0xFF381D85, 0x0000, 0}, {0xFF34A305, 0x0000, 0},
+  {0xFF30DD05, 0x0000, 0}, {0xFF1F5A05, 0x0000, 0}, {0xFF2E3C05, 0x0000, 0}, {0xFF338285, 0x0000, 0},
+  {0xFF4BE685, 0x0000, 0}, {0xFF338905, 0x0000, 0}, {0xFF2E4605, 0x0000, 0}, {0xFF3A0385, 0x0000, 0},
+  {0xFF3F8385, 0x0000, 0}, {0xFF39BF05, 0x0000, 0}, {0xFF301885, 0x0000, 0}, {0xFF36B785, 0x0000, 0},
+  {0xFF2FB785, 0x0000, 0}, {0xFF39C885, 0x0000, 0}, {0xFF2FFE85, 0x0000, 0}, {0xFF459085, 0x0000, 0},
+  {0xFF417E85, 0x0000, 0}, {0xFF4D4305, 0x0000, 0}, {0xFF336605, 0x0000, 0}, {0xFF310A05, 0x0000, 0},
+  {0xFF3E7705, 0x0000, 0}, {0xFF383705, 0x0000, 0}, {0xFF389685, 0x0000, 0}, {0xFF2DEB85, 0x0000, 0},
+  {0xFF2DEF85, 0x0000, 0}, {0xFF4F0F85, 0x0000, 0}, {0xFF35DD05, 0x0000, 0}, {0xFF2E0005, 0x0000, 0},
+  {0xFF30E285, 0x0000, 0}, {0xFF386C05, 0x0000, 0}, {0xFF4DA005, 0x0000, 0}, {0xFF381105, 0x0000, 0},
+  {0xFF43A785, 0x0000, 0}, {0xFF442385, 0x0000, 0}, {0xFF30EA05, 0x0000, 0}, {0xFF3E2585, 0x0000, 0},
+  {0xFF3A6985, 0x0000, 0}, {0xFF3A6885, 0x0000, 0}, {0xFF417D85, 0x0000, 0}, {0xFF301C85, 0x0000, 0},
+  {0xFF31BE05, 0x0000, 0}, {0xFF4F8905, 0x0000, 0}, {0x0004E60D, 0x0000, 0}, {0x0004E78D, 0x0000, 0},
+  {0x0004E90D, 0x0000, 0}, {0x0004EA8D, 0x0000, 0}, {0x0004EC0D, 0x0000, 0}, {0x0004ED8D, 0x0000, 0},
+  {0x0004EF0D, 0x0000, 0}, {0x0004F08D, 0x0000, 0}, {0x0004F20D, 0x0000, 0}, {0xFF36A385, 0x0000, 0},
+  {0xFF30CF05, 0x0000, 0}, {0xFF022005, 0x0000, 0}, {0xFEAB1E85, 0x5739, 0}, {0xFEAB1B85, 0x5741, 0},
+  {0xFEAB1F85, 0x5749, 0}, {0xFF848F85, 0x5751, 0}, {0xFEABAE05, 0x5759, 0}, {0xFEABD485, 0x4EC9, 0},
+  {0xFEABDA85, 0x5761, 0}, {0xFEABFD85, 0x5769, 0}, {0xFEAC3905, 0x5771, 0}, {0xFEAC4805, 0x5779, 0},
+  {0xFEAC6E85, 0x4ED1, 0}, {0xFEAC6205, 0x5781, 0}, {0xFE9E4905, 0x5789, 0}, {0xFF871685, 0x5791, 0},
+  {0xFEAC9F85, 0x4ED9, 0}, {0xFEACA285, 0x5799, 0}, {0xFEACAA05, 0x57A1, 0}, {0xFEACB305, 0x57A9, 0},
+  {0xFF868505, 0x57B1, 0}, {0xFE9E5305, 0x57B9, 0}, {0xFEACA985, 0x57C1, 0}, {0xFEACBC05, 0x57C9, 0},
+  {0xFF869A85, 0x57D1, 0}, {0xFEACC005, 0x57D9, 0}, {0xFEACC605, 0x57E1, 0}, {0xFEAB5985, 0x57E9, 0},
+  {0xFEACC905, 0x57F1, 0}, {0xFEACCD05, 0x50A9, 0}, {0xFFCCE185, 0x57F9, 0}, {0xFEACEC05, 0x5801, 0},
+  {0xFEACF285, 0x5809, 0}, {0xFE9E6005, 0x5811, 0}, {0xFEAD0D85, 0x5819, 0}, {0xFEAD1285, 0x5821, 0},
+  {0xFEAD2805, 0x5829, 0}, {0xFEAD2A05, 0x5831, 0}, {0xFE9E7885, 0x5839, 0}, {0xFEAD5105, 0x50D1, 0},
+  {0xFEAD5185, 0x4EE1, 0}, {0xFEAD5E85, 0x4EE9, 0}, {0xFEAD6905, 0x50D9, 0}, {0xFEAD6E05, 0x5841, 0},
+  {0xFEAD6E05, 0x5849, 0}, {0xFEAD7605, 0x48E1, 0}, {0xFEAD8E85, 0x5851, 0}, {0xFEAD9205, 0x4EF1, 0},
+  {0xFEAD9605, 0x5859, 0}, {0xFEADA205, 0x5861, 0}, {0xFEADA685, 0x5869, 0}, {0xFEADA705, 0x5871, 0},
+  {0xFEADA685, 0x5871, 0}, {0xFEADA605, 0x5871, 0}, {0xFF88FC05, 0x5879, 0}, {0xFEBC1D85, 0x5881, 0},
+  {0xFEADCA05, 0x5889, 0}, {0xFEADD405, 0x5891, 0}, {0xFF899585, 0x5899, 0}, {0xFEADD905, 0x58A1, 0},
+  {0xFEADDB85, 0x58A9, 0}, {0xFEADE585, 0x58B1, 0}, {0xFEAE3105, 0x58B9, 0}, {0xFEADFD85, 0x58C1, 0},
+  {0xFEAE0505, 0x58C9, 0}, {0xFEAE1485, 0x58D1, 0}, {0xFEAE3105, 0x58D9, 0}, {0xFEAE5A85, 0x58E1, 0},
+  {0xFEAE6705, 0x58E9, 0}, {0xFEAE8805, 0x58F1, 0}, {0xFEAE8F85, 0x58F9, 0}, {0xFEAE9F85, 0x5901, 0},
+  {0xFEAE9F05, 0x5901, 0}, {0xFEAEA905, 0x50E9, 0}, {0xFEAEB185, 0x5909, 0}, {0xFEAEB505, 0x5911, 0},
+  {0xFEAEBC05, 0x5919, 0}, {0xFEAF6585, 0x5921, 0}, {0xFEAEDD05, 0x4F01, 0}, {0xFEAF6505, 0x5929, 0},
+  {0xFEAF0185, 0x5931, 0}, {0xFEAF1285, 0x5939, 0}, {0xFEACDB85, 0x4DA9, 0}, {0xFEB04E85, 0x5941, 0},
+  {0xFEAFBE05, 0x5949, 0}, {0xFEAFD085, 0x5951, 0}, {0xFEAFDC85, 0x5959, 0}, {0xFEAF9B05, 0x5961, 0},
+  {0xFEAFEE05, 0x5969, 0}, {0xFEAFED05, 0x5971, 0}, {0xFEB02A05, 0x5979, 0}, {0xFF8E4585, 0x5981, 0},
+  {0xFEB04C05, 0x5989, 0}, {0xFEB04E05, 0x5991, 0}, {0xFEB05505, 0x5999, 0}, {0xFEB05E85, 0x59A1, 0},
+  {0xFEB06205, 0x59A9, 0}, {0xFEB08185, 0x59B1, 0}, {0xFF8F2405, 0x59B9, 0}, {0xFF8F4485, 0x59C1, 0},
+  {0xFEB0C505, 0x59C9, 0}, {0xFEB0DC05, 0x59D1, 0}, {0xFEB0E185, 0x59D9, 0}, {0xFEB0B985, 0x59E1, 0},
+  {0xFEB10005, 0x59E9, 0}, {0xFE9F4385, 0x59F1, 0}, {0x00000003, 0x59F9, 0}, {0xFEB14F85, 0x5A01, 0},
+  {0xFEB16A05, 0x5A09, 0}, {0xFEB16985, 0x5A09, 0}, {0xFF90AE05, 0x5A11, 0}, {0xFEB1AB05, 0x5A19, 0},
+  {0xFEB1B505, 0x5A21, 0}, {0xFEB1BC05, 0x48C1, 0}, {0xFEB1C185, 0x5A29, 0}, {0xFF915385, 0x5A31, 0},
+  {0xFEB1C685, 0x5A39, 0}, {0xFEB1C985, 0x5A41, 0}, {0x00000003, 0x5A49, 0}, {0xFEB1D685, 0x5A51, 0},
+  {0xFE9F8585, 0x5A59, 0}, {0xFEB1F485, 0x5A61, 0}, {0xFEB1FB05, 0x4F29, 0}, {0xFEB22385, 0x5A69, 0},
+  {0xFEB20985, 0x5A71, 0}, {0xFF92B485, 0x5A79, 0}, {0xFEB26385, 0x5A81, 0}, {0xFF92B485, 0x5A89, 0},
+  {0xFEB27805, 0x5A91, 0}, {0xFEB27605, 0x5A99, 0}, {0xFEB27E05, 0x5AA1, 0}, {0xFEB2B005, 0x5AA9, 0},
+  {0xFEB2B005, 0x5AB1, 0}, {0xFE9FD605, 0x5AB9, 0}, {0xFEB2BC85, 0x5AC1, 0}, {0xFEB2D185, 0x5AC9, 0},
+  {0xFEB2DB85, 0x5AD1, 0}, {0xFEB2F105, 0x5AD9, 0}, {0xFE9FED05, 0x5AE1, 0}, {0xFF947D05, 0x5AE9, 0},
+  {0xFE9FF905, 0x5AF1, 0}, {0xFEB31285, 0x5AF9, 0}, {0xFEB31385, 0x5B01, 0}, {0xFEB31485, 0x5B09, 0},
+  {0xFEB31E05, 0x4711, 0}, {0xFFD58185, 0x5B11, 0}, {0xFEB33705, 0x5B19, 0}, {0xFF955005, 0x5B21, 0},
+  {0xFF954F85, 0x5B21, 0}, {0xFEC4B705, 0x5B29, 0}, {0xFEB34705, 0x5B31, 0}, {0xFEB34685, 0x5B31, 0},
+  {0xFEA01885, 0x5B39, 0}, {0xFF9D1085, 0x5B41, 0}, {0xFFB4A105, 0x5B49, 0}, {0xFEB36485, 0x5B51, 0},
+  {0xFEB36885, 0x5B59, 0}, {0xFEA02405, 0x5B61, 0}, {0xFEB37F05, 0x5B69, 0}, {0xFEB39805, 0x5B71, 0},
+  {0xFEB39C85, 0x5B79, 0}, {0xFEB3AD05, 0x5B81, 0}, {0xFEB3F085, 0x5B89, 0}, {0xFEA04C85, 0x5B91, 0},
+  {0xFEA03D05, 0x5B99, 0}, {0xFEB3F885, 0x4F31, 0}, {0xFF971805, 0x5BA1, 0}, {0xFEB41105, 0x5BA9, 0},
+  {0xFEB45105, 0x5BB1, 0}, {0xFEB45285, 0x5BB9, 0}, {0xFEB45305, 0x5149, 0}, {0xFEB45185, 0x5BB9, 0},
+  {0xFEB46805, 0x5BC1, 0}, {0xFEB47185, 0x4F41, 0}, {0xFEB48305, 0x5BC9, 0}, {0xFEB47B85, 0x5BD1, 0},
+  {0xFEB48085, 0x5BD9, 0}, {0xFEB49785, 0x5BE1, 0}, {0xFEB4A105, 0x4F49, 0}, {0xFEB4A285, 0x4639, 0},
+  {0xFEB4AF05, 0x5BE9, 0}, {0xFEB4B405, 0x5BF1, 0}, {0xFEB4D485, 0x5BF9, 0}, {0xFEB4FE05, 0x5C01, 0},
+  {0xFEB50F05, 0x5C09, 0}, {0xFEB54C85, 0x5C11, 0}, {0xFF992A05, 0x5C19, 0}, {0xFEB54205, 0x5C21, 0},
+  {0xFEB52105, 0x5C29, 0}, {0xFEB55685, 0x5C31, 0}, {0xFEB56385, 0x5C39, 0}, {0xFEB59385, 0x5C41, 0},
+  {0xFF999985, 0x5C49, 0}, {0xFEB5B185, 0x5C51, 0}, {0xFEB58285, 0x5C59, 0}, {0xFEB57405, 0x5C61, 0},
+  {0xFEA0B605, 0x5C69, 0}, {0xFEB5D305, 0x5C71, 0}, {0xFEB5DD05, 0x5C79, 0}, {0xFEB5EC05, 0x5C81, 0},
+  {0xFEB5D885, 0x5C89, 0}, {0xFEA0D285, 0x5C91, 0}, {0xFEB64385, 0x4F51, 0}, {0xFEB65185, 0x5C99, 0},
+  {0xFF9BA005, 0x5CA1, 0}, {0xFEB68C05, 0x5CA9, 0}, {0xFEB71605, 0x5CB1, 0}, {0xFEB6BE05, 0x5CB9, 0},
+  {0xFEA12585, 0x5CC1, 0}, {0xFEB6E105, 0x4F61, 0}, {0xFEA11C05, 0x5CC9, 0}, {0xFEA10985, 0x5CD1, 0},
+  {0xFEAC6005, 0x5CD9, 0}, {0xFEAC6105, 0x5CE1, 0}, {0xFEB71605, 0x5CE9, 0}, {0xFEB6E385, 0x5CF1, 0},
+  {0xFEC3EB85, 0x5CF9, 0}, {0xFEA58105, 0x5D01, 0}, {0xFEB71F85, 0x4719, 0}, {0xFEB72105, 0x5189, 0},
+  {0xFEB72385, 0x5D09, 0}, {0xFEB74185, 0x5D11, 0}, {0xFEB73B85, 0x5D19, 0}, {0xFF9D7305, 0x5D21, 0},
+  {0xFEA13585, 0x5D29, 0}, {0xFEB78D85, 0x5D31, 0}, {0xFEB75285, 0x5D39, 0}, {0xFEB7B885, 0x5D41, 0},
+  {0xFEB7D185, 0x4F69, 0}, {0xFF9DC505, 0x5D49, 0}, {0xFEB7D505, 0x5D51, 0}, {0xFEB79D05, 0x5D59, 0},
+  {0xFEB81705, 0x5D61, 0}, {0xFEA15B05, 0x52E1, 0}, {0xFEB82D05, 0x5D69, 0}, {0xFEB85D05, 0x5D71, 0},
+  {0xFEB88005, 0x5D79, 0}, {0xFEB8DE85, 0x5D81, 0}, {0xFF9EDB85, 0x5D89, 0}, {0xFEB8F705, 0x5D91, 0},
+  {0xFEA19505, 0x5D99, 0}, {0xFEB91905, 0x5DA1, 0}, {0xFF9FDB85, 0x5DA9, 0}, {0xFEB93185, 0x5DB1, 0},
+  {0xFEA1AE05, 0x5DB9, 0}, {0xFEB93F85, 0x5DC1, 0}, {0xFEB95585, 0x5DC9, 0}, {0xFEB96285, 0x4949, 0},
+  {0xFEB96285, 0x5DD1, 0}, {0xFFA0CB05, 0x5DD9, 0}, {0xFF920985, 0x5DE1, 0}, {0xFFA10085, 0x5DE9, 0},
+  {0xFEB9AA05, 0x5DF1, 0}, {0xFFA1E085, 0x5DF9, 0}, {0xFEB9E185, 0x5E01, 0}, {0xFEB9E805, 0x5E09, 0},
+  {0xFEB9B485, 0x5E11, 0}, {0xFEBA0B85, 0x5E19, 0}, {0xFEBA1F05, 0x5E21, 0}, {0xFEBA3B05, 0x4F71, 0},
+  {0xFEBA1F85, 0x4C01, 0}, {0xFEBA3305, 0x5E29, 0}, {0xFEBA3A05, 0x5E31, 0}, {0xFEBA4005, 0x5E39, 0},
+  {0xFFA20C05, 0x5E41, 0}, {0xFEBA1685, 0x5E49, 0}, {0xFEBA9385, 0x5E51, 0}, {0xFEBAB285, 0x5E59, 0},
+  {0xFEA21485, 0x5E61, 0}, {0xFEBAE005, 0x51A9, 0}, {0xFEBADD85, 0x5E69, 0}, {0xFFA2E205, 0x5E71, 0},
+  {0xFEBA7585, 0x5E79, 0}, {0xFEBB2F85, 0x5E81, 0}, {0xFFA32705, 0x5E89, 0}, {0xFFA33E85, 0x5E91, 0},
+  {0xFEBB5A05, 0x5E99, 0}, {0xFEBB9305, 0x5EA1, 0}, {0xFEBB8505, 0x51B1, 0}, {0xFEBB8305, 0x5EA9, 0},
+  {0xFEA24005, 0x5EB1, 0}, {0xFEBB9985, 0x5EB9, 0}, {0xFEBBB285, 0x5EC1, 0}, {0xFEBBAF05, 0x5EC9, 0},
+  {0xFEBBC985, 0x5ED1, 0}, {0xFF860505, 0x5ED9, 0}, {0xFEBC1485, 0x5EE1, 0}, {0xFFA4A305, 0x5EE9, 0},
+  {0xFEBC3F05, 0x5EF1, 0}, {0x00000003, 0x5EF9, 0}, {0xFEBC8405, 0x5F01, 0}, {0xFEBC8A05, 0x51C1, 0},
+  {0xFEBC9705, 0x5F09, 0}, {0xFFA67285, 0x5F11, 0}, {0xFEBCAE05, 0x5F19, 0}, {0xFEBCB805, 0x5F21, 0},
+  {0xFFA70785, 0x5F29, 0}, {0xFFA77685, 0x5F31, 0}, {0xFEBD2905, 0x5F39, 0}, {0xFEBD3105, 0x5F41, 0},
+  {0xFEA2C105, 0x5F49, 0}, {0xFEBD3D05, 0x5F51, 0}, {0xFEA2C605, 0x5F59, 0}, {0xFEA2C585, 0x5F59, 0},
+  {0xFEBD8C85, 0x5F61, 0}, {0xFEBD9685, 0x5F69, 0}, {0xFEBDA085, 0x51D1, 0}, {0xFEBDAA05, 0x5F71, 0},
+  {0xFEBDCC05, 0x5F79, 0}, {0xFEA2F405, 0x5F81, 0}, {0xFEBDF805, 0x5F89, 0}, {0xFFA98085, 0x5F91, 0},
+  {0xFEBE0405, 0x5F99, 0}, {0xFFA9AD85, 0x5FA1, 0}, {0xFEBE1C05, 0x48D9, 0}, {0xFF943305, 0x5FA9, 0},
+  {0xFEBE6B05, 0x5FB1, 0}, {0xFFAB3305, 0x5FB9, 0}, {0xFFAB3E05, 0x5FC1, 0}, {0xFFAB8385, 0x5FC9, 0},
+  {0xFEA35F05, 0x5FD1, 0}, {0xFEA36485, 0x5FD9, 0}, {0xFEBEDA05, 0x5201, 0}, {0xFFABD905, 0x5FE1, 0},
+  {0xFFABD805, 0x5FE9, 0}, {0xFFABEB05, 0x5FF1, 0}, {0xFFABF785, 0x5FF9, 0}, {0xFEBEEC85, 0x6001, 0},
+  {0xFEBEEC85, 0x6009, 0}, {0xFEBEEC05, 0x6009, 0}, {0xFEBF0105, 0x5209, 0}, {0xFEA37805, 0x52F1, 0},
+  {0xFEBF2085, 0x6011, 0}, {0xFEA37D85, 0x6019, 0}, {0xFEA3A505, 0x6021, 0}, {0xFFAD6805, 0x6029, 0},
+  {0xFEBF8005, 0x6031, 0}, {0xFEBF9E85, 0x47A9, 0}, {0xFEBFBE05, 0x5219, 0}, {0xFEA3C905, 0x6039, 0},
+  {0xFFAE6A05, 0x6041, 0}, {0xFEC00185, 0x4FC9, 0}, {0xFFAEA305, 0x6049, 0}, {0xFFAEB805, 0x6051, 0},
+  {0xFEC01C85, 0x4E59, 0}, {0xFEC04A05, 0x6059, 0}, {0xFEA3EB85, 0x6061, 0}, {0xFEC07385, 0x4FE9, 0},
+  {0xFEC07805, 0x6069, 0}, {0xFEC07A05, 0x6071, 0}, {0xFFB01005, 0x6079, 0}, {0xFFB0A505, 0x6081, 0},
+  {0xFFB0A485, 0x6081, 0}, {0x00000003, 0x6089, 0}, {0xFEA45105, 0x6091, 0}, {0xFFB12505, 0x6099, 0},
+  {0xFEC13205, 0x60A1, 0}, {0xFEC13305, 0x60A9, 0}, {0xFEA46185, 0x60B1, 0}, {0xFFB18D85, 0x60B9, 0},
+  {0xFEC1B605, 0x60C1, 0}, {0xFEA49C85, 0x60C9, 0}, {0xFEC1C005, 0x60D1, 0}, {0xFEC1BD05, 0x60D9, 0},
+  {0xFEC1CB05, 0x60E1, 0}, {0xFFB30D85, 0x60E9, 0}, {0xFEC1FB85, 0x60F1, 0}, {0xFEA4CA05, 0x60F9, 0},
+  {0xFEC22C85, 0x6101, 0}, {0xFEC24985, 0x6109, 0}, {0xFEC26A85, 0x6111, 0}, {0xFEA4E185, 0x6119, 0},
+  {0xFFB45B05, 0x6121, 0}, {0xFFB46A05, 0x6129, 0}, {0xFEA4F285, 0x6131, 0}, {0xFFB4B205, 0x6139, 0},
+  {0xFEC30205, 0x6141, 0}, {0xFFB4E385, 0x6149, 0}, {0xFEC30E85, 0x6151, 0}, {0xFEC34085, 0x6159, 0},
+  {0xFEC34585, 0x5019, 0}, {0xFFB5AF85, 0x6161, 0}, {0xFFB5D385, 0x6169, 0}, {0xFEC37185, 0x6171, 0},
+  {0xFFB61505, 0x6179, 0}, {0xFEC37885, 0x6181, 0}, {0xFF9CEF85, 0x6189, 0}, {0xFEA52A05, 0x6191, 0},
+  {0xFEC39805, 0x6199, 0}, {0xFEC3C005, 0x61A1, 0}, {0xFEA54385, 0x61A9, 0}, {0xFEC3DC85, 0x61B1, 0},
+  {0xFEB09785, 0x61B9, 0}, {0xFFB71005, 0x61C1, 0}, {0xFFB71685, 0x61C9, 0}, {0xFF9D0505, 0x61D1, 0},
+  {0xFF9D0905, 0x61D9, 0}, {0xFEC43B05, 0x5B29, 0}, {0xFEC43C05, 0x61E1, 0}, {0xFECB0885, 0x61E9, 0},
+  {0xFEA56E85, 0x61F1, 0}, {0xFEC48105, 0x61F9, 0}, {0xFEC47D85, 0x6201, 0}, {0xFEC48605, 0x6209, 0},
+  {0xFEAC9085, 0x6211, 0}, {0xFEC48F05, 0x6219, 0}, {0xFEC48F85, 0x6221, 0}, {0xFEC49405, 0x6229, 0},
+  {0xFEC4A805, 0x6231, 0}, {0xFFB8D285, 0x6239, 0}, {0xFEC4A685, 0x4969, 0}, {0xFEC4C205, 0x6241, 0},
+  {0xFEC4E485, 0x6249, 0}, {0xFEC50905, 0x6251, 0}, {0xFEC4C385, 0x6259, 0}, {0xFEC51005, 0x6261, 0},
+  {0xFEC52485, 0x6269, 0}, {0xFEC55C05, 0x5031, 0}, {0xFEC4D985, 0x6271, 0}, {0xFEC51485, 0x6279, 0},
+  {0xFEC51505, 0x6281, 0}, {0xFEC51C85, 0x6289, 0}, {0xFFB94905, 0x6291, 0}, {0xFFB9E305, 0x6299, 0},
+  {0xFFB99785, 0x62A1, 0}, {0xFEA5C205, 0x62A9, 0}, {0xFEC5A485, 0x62B1, 0}, {0xFEC5A505, 0x62B9, 0},
+  {0xFEC5B605, 0x62C1, 0}, {0xFFBD0F85, 0x62C9, 0}, {0xFEC5DC05, 0x62D1, 0}, {0xFFBABF85, 0x62D9, 0},
+  {0xFEA5D785, 0x62E1, 0}, {0xFEA5D905, 0x62E9, 0}, {0xFFBB0085, 0x62F1, 0}, {0xFFBB9085, 0x62F9, 0},
+  {0xFEA5DC85, 0x6301, 0}, {0xFEC64E85, 0x6309, 0}, {0xFEC65405, 0x4781, 0}, {0xFEC65905, 0x6311, 0},
+  {0xFEC65985, 0x6319, 0}, {0xFEC67905, 0x6321, 0}, {0xFEC66805, 0x6329, 0}, {0xFEC6AA85, 0x6331, 0},
+  {0xFEC69405, 0x6339, 0}, {0xFEC6DF05, 0x5251, 0}, {0xFEC6B605, 0x6341, 0}, {0xFEC6D705, 0x6349, 0},
+  {0xFEC6E405, 0x6351, 0}, {0x00000003, 0x6359, 0}, {0xFEC71085, 0x6361, 0}, {0xFEC72005, 0x6369, 0},
+  {0xFEA61B85, 0x6371, 0}, {0xFEC74E85, 0x6379, 0}, {0xFEC74F85, 0x6381, 0}, {0xFFBE5105, 0x6389, 0},
+  {0xFEC78885, 0x6391, 0}, {0xFEC78B85, 0x6399, 0}, {0xFEA63685, 0x63A1, 0}, {0xFEC79885, 0x63A9, 0},
+  {0xFE9D7885, 0x63B1, 0}, {0xFFBF7185, 0x63B9, 0}, {0xFFBFCD05, 0x63C1, 0}, {0xFEA67885, 0x63C9, 0},
+  {0xFEA67C85, 0x63D1, 0}, {0xFEC86885, 0x63D9, 0}, {0xFEC88E85, 0x5279, 0}, {0xFEC8DC85, 0x5281, 0},
+  {0xFEC94185, 0x63E1, 0}, {0xFFC16A85, 0x63E9, 0}, {0xFEC96B85, 0x63F1, 0}, {0xFEC97605, 0x63F9, 0},
+  {0xFEC9A285, 0x6401, 0}, {0xFEC9D005, 0x6409, 0}, {0xFFC2AB85, 0x6411, 0}, {0xFF871585, 0x6419, 0},
+  {0xFEC9F885, 0x6421, 0}, {0xFEC9F085, 0x6429, 0}, {0xFECA0A05, 0x6431, 0}, {0xFF878085, 0x6439, 0},
+  {0xFECA7B05, 0x6441, 0}, {0xFECAAC85, 0x5289, 0}, {0xFFC5F905, 0x6449, 0}, {0xFFC60605, 0x6451, 0},
+  {0xFECB5905, 0x6459, 0}, {0xFECB8705, 0x6461, 0}, {0xFECB9685, 0x6469, 0}, {0xFFC6A485, 0x6471, 0},
+  {0xFECB9A85, 0x6479, 0}, {0xFECC2885, 0x6481, 0}, {0xFECC7785, 0x6489, 0}, {0xFECC7785, 0x6491, 0},
+  {0xFECC4905, 0x6499, 0}, {0xFECD0705, 0x64A1, 0}, {0xFECD1485, 0x64A9, 0}, {0xFFC90685, 0x64B1, 0},
+  {0xFECDCE85, 0x64B9, 0}, {0xFEA7D305, 0x64C1, 0}, {0xFECDE385, 0x64C9, 0}, {0xFFC9C305, 0x64D1, 0},
+  {0xFEA7FA05, 0x64D9, 0}, {0xFECE6805, 0x64E1, 0}, {0xFEB1DF05, 0x64E9, 0}, {0xFECE9705, 0x64F1, 0},
+  {0xFFCBA785, 0x64F9, 0}, {0xFFCC1185, 0x6501, 0}, {0xFEA83B05, 0x6509, 0}, {0xFEA83E85, 0x6511, 0},
+  {0xFECEF305, 0x6519, 0}, {0xFFCD0785, 0x6521, 0}, {0xFEA85B05, 0x6529, 0}, {0xFFCD4C85, 0x6531, 0},
+  {0xFECF0685, 0x52B9, 0}, {0xFECF0605, 0x52B9, 0}, {0xFECF1485, 0x6539, 0}, {0xFFCDDA85, 0x6541, 0},
+  {0xFECF7005, 0x6549, 0}, {0xFEA89805, 0x6551, 0}, {0xFECF9285, 0x6559, 0}, {0xFECFD105, 0x6561, 0},
+  {0xFECFDE05, 0x6569, 0}, {0xFECFFB85, 0x6571, 0}, {0xFEA8E305, 0x6579, 0}, {0xFFD09385, 0x6581, 0},
+  {0xFED08405, 0x52C1, 0}, {0xFED11A85, 0x6589, 0}, {0xFED17885, 0x6591, 0}, {0xFEA96085, 0x6599, 0},
+  {0xFEA96F85, 0x65A1, 0}, {0xFED1AC05, 0x65A9, 0}, {0xFFD35F05, 0x65B1, 0}, {0xFEA97385, 0x65B9, 0},
+  {0xFFD37985, 0x65C1, 0}, {0xFFD3FD85, 0x65C9, 0}, {0xFFD43E85, 0x65D1, 0}, {0xFED25305, 0x65D9, 0},
+  {0xFEA9A005, 0x65E1, 0}, {0xFED27105, 0x65E9, 0}, {0xFED27305, 0x65F1, 0}, {0xFED27605, 0x65F9, 0},
+  {0xFED27A85, 0x6601, 0}, {0xFED27D85, 0x6609, 0}, {0xFED28F85, 0x6611, 0}, {0xFFD5F185, 0x6619, 0},
+};
+
+static const uint32_t uts46_mappings[2535] = {
+  0x00020, 0x00308, 0x00020, 0x00304, 0x00020, 0x00301, 0x00020, 0x00327,
+  0x00031, 0x02044, 0x00034, 0x00031, 0x02044, 0x00032, 0x00033, 0x02044,
+  0x00034, 0x00069, 0x00307, 0x00069, 0x0006A, 0x0006C, 0x000B7, 0x002BC,
+  0x0006E, 0x00064, 0x0017E, 0x0006C, 0x0006A, 0x0006E, 0x0006A, 0x00064,
+  0x0007A, 0x00020, 0x00306, 0x00020, 0x00307, 0x00020, 0x0030A, 0x00020,
+  0x00328, 0x00020, 0x00303, 0x00020, 0x0030B, 0x00308, 0x00301, 0x00020,
+  0x003B9, 0x00020, 0x00308, 0x00301, 0x00565, 0x00582, 0x00627, 0x00674,
+  0x00648, 0x00674, 0x006C7, 0x00674, 0x0064A, 0x00674, 0x00915, 0x0093C,
+  0x00916, 0x0093C, 0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921, 0x0093C,
+  0x00922, 0x0093C, 0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009A1, 0x009BC,
+  0x009A2, 0x009BC, 0x009AF, 0x009BC, 0x00A32, 0x00A3C, 0x00A38, 0x00A3C,
+  0x00A16, 0x00A3C, 0x00A17, 0x00A3C, 0x00A1C, 0x00A3C, 0x00A2B, 0x00A3C,
+  0x00B21, 0x00B3C, 0x00B22, 0x00B3C, 0x00E4D, 0x00E32, 0x00ECD, 0x00EB2,
+  0x00EAB, 0x00E99, 0x00EAB, 0x00EA1, 0x00F42, 0x00FB7, 0x00F4C, 0x00FB7,
+  0x00F51, 0x00FB7, 0x00F56, 0x00FB7, 0x00F5B, 0x00FB7, 0x00F40, 0x00FB5,
+  0x00F71, 0x00F72, 0x00F71, 0x00F74, 0x00FB2, 0x00F80, 0x00FB2, 0x00F71,
+  0x00F80, 0x00FB3, 0x00F80, 0x00FB3, 0x00F71, 0x00F80, 0x00F71, 0x00F80,
+  0x00F92, 0x00FB7, 0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7, 0x00FA6, 0x00FB7,
+  0x00FAB, 0x00FB7, 0x00F90, 0x00FB5, 0x00061, 0x002BE, 0x01F00, 0x003B9,
+  0x01F01, 0x003B9, 0x01F02, 0x003B9, 0x01F03, 0x003B9, 0x01F04, 0x003B9,
+  0x01F05, 0x003B9, 0x01F06, 0x003B9, 0x01F07, 0x003B9, 0x01F20, 0x003B9,
+  0x01F21, 0x003B9, 0x01F22, 0x003B9, 0x01F23, 0x003B9, 0x01F24, 0x003B9,
+  0x01F25, 0x003B9, 0x01F26, 0x003B9, 0x01F27, 0x003B9, 0x01F60, 0x003B9,
+  0x01F61, 0x003B9, 0x01F62, 0x003B9, 0x01F63, 0x003B9, 0x01F64, 0x003B9,
+  0x01F65, 0x003B9, 0x01F66, 0x003B9, 0x01F67, 0x003B9, 0x01F70, 0x003B9,
+  0x003B1, 0x003B9, 0x003AC, 0x003B9, 0x01FB6, 0x003B9, 0x00020, 0x00313,
+  0x00020, 0x00342, 0x00020, 0x00308, 0x00342, 0x01F74, 0x003B9, 0x003B7,
+  0x003B9, 0x003AE, 0x003B9, 0x01FC6, 0x003B9, 0x00020, 0x00313, 0x00300,
+  0x00020, 0x00313, 0x00301, 0x00020, 0x00313, 0x00342, 0x00020, 0x00314,
+  0x00300, 0x00020, 0x00314, 0x00301, 0x00020, 0x00314, 0x00342, 0x00020,
+  0x00308, 0x00300, 0x01F7C, 0x003B9, 0x003C9, 0x003B9, 0x003CE, 0x003B9,
+  0x01FF6, 0x003B9, 0x00020, 0x00314, 0x00020, 0x00333, 0x02032, 0x02032,
+  0x02032, 0x02032, 0x02032, 0x02035, 0x02035, 0x02035, 0x02035, 0x02035,
+  0x00021, 0x00021, 0x00020, 0x00305, 0x0003F, 0x0003F, 0x0003F, 0x00021,
+  0x00021, 0x0003F, 0x02032, 0x02032, 0x02032, 0x02032, 0x00072, 0x00073,
+  0x00061, 0x0002F, 0x00063, 0x00061, 0x0002F, 0x00073, 0x000B0, 0x00063,
+  0x00063, 0x0002F, 0x0006F, 0x00063, 0x0002F, 0x00075, 0x000B0, 0x00066,
+  0x0006E, 0x0006F, 0x00073, 0x0006D, 0x00074, 0x00065, 0x0006C, 0x00074,
+  0x0006D, 0x00066, 0x00061, 0x00078, 0x00031, 0x02044, 0x00037, 0x00031,
+  0x02044, 0x00039, 0x00031, 0x02044, 0x00031, 0x00030, 0x00031, 0x02044,
+  0x00033, 0x00032, 0x02044, 0x00033, 0x00031, 0x02044, 0x00035, 0x00032,
+  0x02044, 0x00035, 0x00033, 0x02044, 0x00035, 0x00034, 0x02044, 0x00035,
+  0x00031, 0x02044, 0x00036, 0x00035, 0x02044, 0x00036, 0x00031, 0x02044,
+  0x00038, 0x00033, 0x02044, 0x00038, 0x00035, 0x02044, 0x00038, 0x00037,
+  0x02044, 0x00038, 0x00031, 0x02044, 0x00069, 0x00069, 0x00069, 0x00069,
+  0x00069, 0x00069, 0x00076, 0x00076, 0x00069, 0x00076, 0x00069, 0x00069,
+  0x00076, 0x00069, 0x00069, 0x00069, 0x00069, 0x00078, 0x00078, 0x00069,
+  0x00078, 0x00069, 0x00069, 0x00030, 0x02044, 0x00033, 0x0222B, 0x0222B,
+  0x0222B, 0x0222B, 0x0222B, 0x0222E, 0x0222E, 0x0222E, 0x0222E, 0x0222E,
+  0x00031, 0x00030, 0x00031, 0x00031, 0x00031, 0x00032, 0x00031, 0x00033,
+  0x00031, 0x00034, 0x00031, 0x00035, 0x00031, 0x00036, 0x00031, 0x00037,
+  0x00031, 0x00038, 0x00031, 0x00039, 0x00032, 0x00030, 0x00028, 0x00031,
+  0x00029, 0x00028, 0x00032, 0x00029, 0x00028, 0x00033, 0x00029, 0x00028,
+  0x00034, 0x00029, 0x00028, 0x00035, 0x00029, 0x00028, 0x00036, 0x00029,
+  0x00028, 0x00037, 0x00029, 0x00028, 0x00038, 0x00029, 0x00028, 0x00039,
+  0x00029, 0x00028, 0x00031, 0x00030, 0x00029, 0x00028, 0x00031, 0x00031,
+  0x00029, 0x00028, 0x00031, 0x00032, 0x00029, 0x00028, 0x00031, 0x00033,
+  0x00029, 0x00028, 0x00031, 0x00034, 0x00029, 0x00028, 0x00031, 0x00035,
+  0x00029, 0x00028, 0x00031, 0x00036, 0x00029, 0x00028, 0x00031, 0x00037,
+  0x00029, 0x00028, 0x00031, 0x00038, 0x00029, 0x00028, 0x00031, 0x00039,
+  0x00029, 0x00028, 0x00032, 0x00030, 0x00029, 0x00028, 0x00061, 0x00029,
+  0x00028, 0x00062, 0x00029, 0x00028, 0x00063, 0x00029, 0x00028, 0x00064,
+  0x00029, 0x00028, 0x00065, 0x00029, 0x00028, 0x00066, 0x00029, 0x00028,
+  0x00067, 0x00029, 0x00028, 0x00068, 0x00029, 0x00028, 0x00069, 0x00029,
+  0x00028, 0x0006A, 0x00029, 0x00028, 0x0006B, 0x00029, 0x00028, 0x0006C,
+  0x00029, 0x00028, 0x0006D, 0x00029, 0x00028, 0x0006E, 0x00029, 0x00028,
+  0x0006F, 0x00029, 0x00028, 0x00070, 0x00029, 0x00028, 0x00071, 0x00029,
+  0x00028, 0x00072, 0x00029, 0x00028, 0x00073, 0x00029, 0x00028, 0x00074,
+  0x00029, 0x00028, 0x00075, 0x00029, 0x00028, 0x00076, 0x00029, 0x00028,
+  0x00077, 0x00029, 0x00028, 0x00078, 0x00029, 0x00028, 0x00079, 0x00029,
+  0x00028, 0x0007A, 0x00029, 0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0003A,
+  0x0003A, 0x0003D, 0x0003D, 0x0003D, 0x0003D, 0x0003D, 0x0003D, 0x02ADD,
+  0x00338, 0x00020, 0x03099, 0x00020, 0x0309A, 0x03088, 0x0308A, 0x030B3,
+  0x030C8, 0x00028, 0x01100, 0x00029, 0x00028, 0x01102, 0x00029, 0x00028,
+  0x01103, 0x00029, 0x00028, 0x01105, 0x00029, 0x00028, 0x01106, 0x00029,
+  0x00028, 0x01107, 0x00029, 0x00028, 0x01109, 0x00029, 0x00028, 0x0110B,
+  0x00029, 0x00028, 0x0110C, 0x00029, 0x00028, 0x0110E, 0x00029, 0x00028,
+  0x0110F, 0x00029, 0x00028, 0x01110, 0x00029, 0x00028, 0x01111, 0x00029,
+  0x00028, 0x01112, 0x00029, 0x00028, 0x0AC00, 0x00029, 0x00028, 0x0B098,
+  0x00029, 0x00028, 0x0B2E4, 0x00029, 0x00028, 0x0B77C, 0x00029, 0x00028,
+  0x0B9C8, 0x00029, 0x00028, 0x0BC14, 0x00029, 0x00028, 0x0C0AC, 0x00029,
+  0x00028, 0x0C544, 0x00029, 0x00028, 0x0C790, 0x00029, 0x00028, 0x0CC28,
+  0x00029, 0x00028, 0x0CE74, 0x00029, 0x00028, 0x0D0C0, 0x00029, 0x00028,
+  0x0D30C, 0x00029, 0x00028, 0x0D558, 0x00029, 0x00028, 0x0C8FC, 0x00029,
+  0x00028, 0x0C624, 0x0C804, 0x00029, 0x00028, 0x0C624, 0x0D6C4, 0x00029,
+  0x00028, 0x04E00, 0x00029, 0x00028, 0x04E8C, 0x00029, 0x00028, 0x04E09,
+  0x00029, 0x00028, 0x056DB, 0x00029, 0x00028, 0x04E94, 0x00029, 0x00028,
+  0x0516D, 0x00029, 0x00028, 0x04E03, 0x00029, 0x00028, 0x0516B, 0x00029,
+  0x00028, 0x04E5D, 0x00029, 0x00028, 0x05341, 0x00029, 0x00028, 0x06708,
+  0x00029, 0x00028, 0x0706B, 0x00029, 0x00028, 0x06C34, 0x00029, 0x00028,
+  0x06728, 0x00029, 0x00028, 0x091D1, 0x00029, 0x00028, 0x0571F, 0x00029,
+  0x00028, 0x065E5, 0x00029, 0x00028, 0x0682A, 0x00029, 0x00028, 0x06709,
+  0x00029, 0x00028, 0x0793E, 0x00029, 0x00028, 0x0540D, 0x00029, 0x00028,
+  0x07279, 0x00029, 0x00028, 0x08CA1, 0x00029, 0x00028, 0x0795D, 0x00029,
+  0x00028, 0x052B4, 0x00029, 0x00028, 0x04EE3, 0x00029, 0x00028, 0x0547C,
+  0x00029, 0x00028, 0x05B66, 0x00029, 0x00028, 0x076E3, 0x00029, 0x00028,
+  0x04F01, 0x00029, 0x00028, 0x08CC7, 0x00029, 0x00028, 0x05354, 0x00029,
+  0x00028, 0x0796D, 0x00029, 0x00028, 0x04F11, 0x00029, 0x00028, 0x081EA,
+  0x00029, 0x00028, 0x081F3, 0x00029, 0x00070, 0x00074, 0x00065, 0x00032,
+  0x00031, 0x00032, 0x00032, 0x00032, 0x00033, 0x00032, 0x00034, 0x00032,
+  0x00035, 0x00032, 0x00036, 0x00032, 0x00037, 0x00032, 0x00038, 0x00032,
+  0x00039, 0x00033, 0x00030, 0x00033, 0x00031, 0x00033, 0x00032, 0x00033,
+  0x00033, 0x00033, 0x00034, 0x00033, 0x00035, 0x0CC38, 0x0ACE0, 0x0C8FC,
+  0x0C758, 0x00033, 0x00036, 0x00033, 0x00037, 0x00033, 0x00038, 0x00033,
+  0x00039, 0x00034, 0x00030, 0x00034, 0x00031, 0x00034, 0x00032, 0x00034,
+  0x00033, 0x00034, 0x00034, 0x00034, 0x00035, 0x00034, 0x00036, 0x00034,
+  0x00037, 0x00034, 0x00038, 0x00034, 0x00039, 0x00035, 0x00030, 0x00031,
+  0x06708, 0x00032, 0x06708, 0x00033, 0x06708, 0x00034, 0x06708, 0x00035,
+  0x06708, 0x00036, 0x06708, 0x00037, 0x06708, 0x00038, 0x06708, 0x00039,
+  0x06708, 0x00031, 0x00030, 0x06708, 0x00031, 0x00031, 0x06708, 0x00031,
+  0x00032, 0x06708, 0x00068, 0x00067, 0x00065, 0x00072, 0x00067, 0x00065,
+  0x00076, 0x0006C, 0x00074, 0x00064, 0x04EE4, 0x0548C, 0x030A2, 0x030D1,
+  0x030FC, 0x030C8, 0x030A2, 0x030EB, 0x030D5, 0x030A1, 0x030A2, 0x030F3,
+  0x030DA, 0x030A2, 0x030A2, 0x030FC, 0x030EB, 0x030A4, 0x030CB, 0x030F3,
+  0x030B0, 0x030A4, 0x030F3, 0x030C1, 0x030A6, 0x030A9, 0x030F3, 0x030A8,
+  0x030B9, 0x030AF, 0x030FC, 0x030C9, 0x030A8, 0x030FC, 0x030AB, 0x030FC,
+  0x030AA, 0x030F3, 0x030B9, 0x030AA, 0x030FC, 0x030E0, 0x030AB, 0x030A4,
+  0x030EA, 0x030AB, 0x030E9, 0x030C3, 0x030C8, 0x030AB, 0x030ED, 0x030EA,
+  0x030FC, 0x030AC, 0x030ED, 0x030F3, 0x030AC, 0x030F3, 0x030DE, 0x030AE,
+  0x030AC, 0x030AE, 0x030CB, 0x030FC, 0x030AD, 0x030E5, 0x030EA, 0x030FC,
+  0x030AE, 0x030EB, 0x030C0, 0x030FC, 0x030AD, 0x030ED, 0x030AD, 0x030ED,
+  0x030B0, 0x030E9, 0x030E0, 0x030AD, 0x030ED, 0x030E1, 0x030FC, 0x030C8,
+  0x030EB, 0x030AD, 0x030ED, 0x030EF, 0x030C3, 0x030C8, 0x030B0, 0x030E9,
+  0x030E0, 0x030B0, 0x030E9, 0x030E0, 0x030C8, 0x030F3, 0x030AF, 0x030EB,
+  0x030BC, 0x030A4, 0x030ED, 0x030AF, 0x030ED, 0x030FC, 0x030CD, 0x030B1,
+  0x030FC, 0x030B9, 0x030B3, 0x030EB, 0x030CA, 0x030B3, 0x030FC, 0x030DD,
+  0x030B5, 0x030A4, 0x030AF, 0x030EB, 0x030B5, 0x030F3, 0x030C1, 0x030FC,
+  0x030E0, 0x030B7, 0x030EA, 0x030F3, 0x030B0, 0x030BB, 0x030F3, 0x030C1,
+  0x030BB, 0x030F3, 0x030C8, 0x030C0, 0x030FC, 0x030B9, 0x030C7, 0x030B7,
+  0x030C9, 0x030EB, 0x030C8, 0x030F3, 0x030CA, 0x030CE, 0x030CE, 0x030C3,
+  0x030C8, 0x030CF, 0x030A4, 0x030C4, 0x030D1, 0x030FC, 0x030BB, 0x030F3,
+  0x030C8, 0x030D1, 0x030FC, 0x030C4, 0x030D0, 0x030FC, 0x030EC, 0x030EB,
+  0x030D4, 0x030A2, 0x030B9, 0x030C8, 0x030EB, 0x030D4, 0x030AF, 0x030EB,
+  0x030D4, 0x030B3, 0x030D3, 0x030EB, 0x030D5, 0x030A1, 0x030E9, 0x030C3,
+  0x030C9, 0x030D5, 0x030A3, 0x030FC, 0x030C8, 0x030D6, 0x030C3, 0x030B7,
+  0x030A7, 0x030EB, 0x030D5, 0x030E9, 0x030F3, 0x030D8, 0x030AF, 0x030BF,
+  0x030FC, 0x030EB, 0x030DA, 0x030BD, 0x030DA, 0x030CB, 0x030D2, 0x030D8,
+  0x030EB, 0x030C4, 0x030DA, 0x030F3, 0x030B9, 0x030DA, 0x030FC, 0x030B8,
+  0x030D9, 0x030FC, 0x030BF, 0x030DD, 0x030A4, 0x030F3, 0x030C8, 0x030DC,
+  0x030EB, 0x030C8, 0x030DB, 0x030F3, 0x030DD, 0x030F3, 0x030C9, 0x030DB,
+  0x030FC, 0x030EB, 0x030DB, 0x030FC, 0x030F3, 0x030DE, 0x030A4, 0x030AF,
+  0x030ED, 0x030DE, 0x030A4, 0x030EB, 0x030DE, 0x030C3, 0x030CF, 0x030DE,
+  0x030EB, 0x030AF, 0x030DE, 0x030F3, 0x030B7, 0x030E7, 0x030F3, 0x030DF,
+  0x030AF, 0x030ED, 0x030F3, 0x030DF, 0x030EA, 0x030DF, 0x030EA, 0x030D0,
+  0x030FC, 0x030EB, 0x030E1, 0x030AC, 0x030E1, 0x030AC, 0x030C8, 0x030F3,
+  0x030E1, 0x030FC, 0x030C8, 0x030EB, 0x030E4, 0x030FC, 0x030C9, 0x030E4,
+  0x030FC, 0x030EB, 0x030E6, 0x030A2, 0x030F3, 0x030EA, 0x030C3, 0x030C8,
+  0x030EB, 0x030EA, 0x030E9, 0x030EB, 0x030D4, 0x030FC, 0x030EB, 0x030FC,
+  0x030D6, 0x030EB, 0x030EC, 0x030E0, 0x030EC, 0x030F3, 0x030C8, 0x030B2,
+  0x030F3, 0x030EF, 0x030C3, 0x030C8, 0x00030, 0x070B9, 0x00031, 0x070B9,
+  0x00032, 0x070B9, 0x00033, 0x070B9, 0x00034, 0x070B9, 0x00035, 0x070B9,
+  0x00036, 0x070B9, 0x00037, 0x070B9, 0x00038, 0x070B9, 0x00039, 0x070B9,
+  0x00031, 0x00030, 0x070B9, 0x00031, 0x00031, 0x070B9, 0x00031, 0x00032,
+  0x070B9, 0x00031, 0x00033, 0x070B9, 0x00031, 0x00034, 0x070B9, 0x00031,
+  0x00035, 0x070B9, 0x00031, 0x00036, 0x070B9, 0x00031, 0x00037, 0x070B9,
+  0x00031, 0x00038, 0x070B9, 0x00031, 0x00039, 0x070B9, 0x00032, 0x00030,
+  0x070B9, 0x00032, 0x00031, 0x070B9, 0x00032, 0x00032, 0x070B9, 0x00032,
+  0x00033, 0x070B9, 0x00032, 0x00034, 0x070B9, 0x00068, 0x00070, 0x00061,
+  0x00064, 0x00061, 0x00061, 0x00075, 0x00062, 0x00061, 0x00072, 0x0006F,
+  0x00076, 0x00070, 0x00063, 0x00064, 0x0006D, 0x00064, 0x0006D, 0x00032,
+  0x00064, 0x0006D, 0x00033, 0x00069, 0x00075, 0x05E73, 0x06210, 0x0662D,
+  0x0548C, 0x05927, 0x06B63, 0x0660E, 0x06CBB, 0x0682A, 0x05F0F, 0x04F1A,
+  0x0793E, 0x00070, 0x00061, 0x0006E, 0x00061, 0x003BC, 0x00061, 0x0006D,
+  0x00061, 0x0006B, 0x00061, 0x0006B, 0x00062, 0x0006D, 0x00062, 0x00067,
+  0x00062, 0x00063, 0x00061, 0x0006C, 0x0006B, 0x00063, 0x00061, 0x0006C,
+  0x00070, 0x00066, 0x0006E, 0x00066, 0x003BC, 0x00066, 0x003BC, 0x00067,
+  0x0006D, 0x00067, 0x0006B, 0x00067, 0x00068, 0x0007A, 0x0006B, 0x00068,
+  0x0007A, 0x0006D, 0x00068, 0x0007A, 0x00067, 0x00068, 0x0007A, 0x00074,
+  0x00068, 0x0007A, 0x003BC, 0x0006C, 0x0006D, 0x0006C, 0x00064, 0x0006C,
+  0x0006B, 0x0006C, 0x00066, 0x0006D, 0x0006E, 0x0006D, 0x003BC, 0x0006D,
+  0x0006D, 0x0006D, 0x00063, 0x0006D, 0x0006B, 0x0006D, 0x0006D, 0x0006D,
+  0x00032, 0x00063, 0x0006D, 0x00032, 0x0006D, 0x00032, 0x0006B, 0x0006D,
+  0x00032, 0x0006D, 0x0006D, 0x00033, 0x00063, 0x0006D, 0x00033, 0x0006D,
+  0x00033, 0x0006B, 0x0006D, 0x00033, 0x0006D, 0x02215, 0x00073, 0x0006D,
+  0x02215, 0x00073, 0x00032, 0x0006B, 0x00070, 0x00061, 0x0006D, 0x00070,
+  0x00061, 0x00067, 0x00070, 0x00061, 0x00072, 0x00061, 0x00064, 0x00072,
+  0x00061, 0x00064, 0x02215, 0x00073, 0x00072, 0x00061, 0x00064, 0x02215,
+  0x00073, 0x00032, 0x00070, 0x00073, 0x0006E, 0x00073, 0x003BC, 0x00073,
+  0x0006D, 0x00073, 0x00070, 0x00076, 0x0006E, 0x00076, 0x003BC, 0x00076,
+  0x0006D, 0x00076, 0x0006B, 0x00076, 0x00070, 0x00077, 0x0006E, 0x00077,
+  0x003BC, 0x00077, 0x0006D, 0x00077, 0x0006B, 0x00077, 0x0006B, 0x003C9,
+  0x0006D, 0x003C9, 0x00062, 0x00071, 0x00063, 0x00063, 0x00063, 0x00064,
+  0x00063, 0x02215, 0x0006B, 0x00067, 0x00064, 0x00062, 0x00067, 0x00079,
+  0x00068, 0x00061, 0x00068, 0x00070, 0x00069, 0x0006E, 0x0006B, 0x0006B,
+  0x0006B, 0x00074, 0x0006C, 0x0006D, 0x0006C, 0x0006E, 0x0006C, 0x0006F,
+  0x00067, 0x0006C, 0x00078, 0x0006D, 0x00069, 0x0006C, 0x0006D, 0x0006F,
+  0x0006C, 0x00070, 0x00068, 0x00070, 0x00070, 0x0006D, 0x00070, 0x00072,
+  0x00073, 0x00072, 0x00073, 0x00076, 0x00077, 0x00062, 0x00076, 0x02215,
+  0x0006D, 0x00061, 0x02215, 0x0006D, 0x00031, 0x065E5, 0x00032, 0x065E5,
+  0x00033, 0x065E5, 0x00034, 0x065E5, 0x00035, 0x065E5, 0x00036, 0x065E5,
+  0x00037, 0x065E5, 0x00038, 0x065E5, 0x00039, 0x065E5, 0x00031, 0x00030,
+  0x065E5, 0x00031, 0x00031, 0x065E5, 0x00031, 0x00032, 0x065E5, 0x00031,
+  0x00033, 0x065E5, 0x00031, 0x00034, 0x065E5, 0x00031, 0x00035, 0x065E5,
+  0x00031, 0x00036, 0x065E5, 0x00031, 0x00037, 0x065E5, 0x00031, 0x00038,
+  0x065E5, 0x00031, 0x00039, 0x065E5, 0x00032, 0x00030, 0x065E5, 0x00032,
+  0x00031, 0x065E5, 0x00032, 0x00032, 0x065E5, 0x00032, 0x00033, 0x065E5,
+  0x00032, 0x00034, 0x065E5, 0x00032, 0x00035, 0x065E5, 0x00032, 0x00036,
+  0x065E5, 0x00032, 0x00037, 0x065E5, 0x00032, 0x00038, 0x065E5, 0x00032,
+  0x00039, 0x065E5, 0x00033, 0x00030, 0x065E5, 0x00033, 0x00031, 0x065E5,
+  0x00067, 0x00061, 0x0006C, 0x00066, 0x00066, 0x00066, 0x00069, 0x00066,
+  0x0006C, 0x00066, 0x00066, 0x00069, 0x00066, 0x00066, 0x0006C, 0x00073,
+  0x00074, 0x00574, 0x00576, 0x00574, 0x00565, 0x00574, 0x0056B, 0x0057E,
+  0x00576, 0x00574, 0x0056D, 0x005D9, 0x005B4, 0x005F2, 0x005B7, 0x005E9,
+  0x005C1, 0x005E9, 0x005C2, 0x005E9, 0x005BC, 0x005C1, 0x005E9, 0x005BC,
+  0x005C2, 0x005D0, 0x005B7, 0x005D0, 0x005B8, 0x005D0, 0x005BC, 0x005D1,
+  0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC, 0x005D4, 0x005BC, 0x005D5,
+  0x005BC, 0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9, 0x005BC, 0x005DA,
+  0x005BC, 0x005DB, 0x005BC, 0x005DC, 0x005BC, 0x005DE, 0x005BC, 0x005E0,
+  0x005BC, 0x005E1, 0x005BC, 0x005E3, 0x005BC, 0x005E4, 0x005BC, 0x005E6,
+  0x005BC, 0x005E7, 0x005BC, 0x005E8, 0x005BC, 0x005E9, 0x005BC, 0x005EA,
+  0x005BC, 0x005D5, 0x005B9, 0x005D1, 0x005BF, 0x005DB, 0x005BF, 0x005E4,
+  0x005BF, 0x005D0, 0x005DC, 0x00626, 0x00627, 0x00626, 0x006D5, 0x00626,
+  0x00648, 0x00626, 0x006C7, 0x00626, 0x006C6, 0x00626, 0x006C8, 0x00626,
+  0x006D0, 0x00626, 0x00649, 0x00626, 0x0062C, 0x00626, 0x0062D, 0x00626,
+  0x00645, 0x00626, 0x0064A, 0x00628, 0x0062C, 0x00628, 0x0062D, 0x00628,
+  0x0062E, 0x00628, 0x00645, 0x00628, 0x00649, 0x00628, 0x0064A, 0x0062A,
+  0x0062C, 0x0062A, 0x0062D, 0x0062A, 0x0062E, 0x0062A, 0x00645, 0x0062A,
+  0x00649, 0x0062A, 0x0064A, 0x0062B, 0x0062C, 0x0062B, 0x00645, 0x0062B,
+  0x00649, 0x0062B, 0x0064A, 0x0062C, 0x0062D, 0x0062C, 0x00645, 0x0062D,
+  0x0062C, 0x0062D, 0x00645, 0x0062E, 0x0062C, 0x0062E, 0x0062D, 0x0062E,
+  0x00645, 0x00633, 0x0062C, 0x00633, 0x0062D, 0x00633, 0x0062E, 0x00633,
+  0x00645, 0x00635, 0x0062D, 0x00635, 0x00645, 0x00636, 0x0062C, 0x00636,
+  0x0062D, 0x00636, 0x0062E, 0x00636, 0x00645, 0x00637, 0x0062D, 0x00637,
+  0x00645, 0x00638, 0x00645, 0x00639, 0x0062C, 0x00639, 0x00645, 0x0063A,
+  0x0062C, 0x0063A, 0x00645, 0x00641, 0x0062C, 0x00641, 0x0062D, 0x00641,
+  0x0062E, 0x00641, 0x00645, 0x00641, 0x00649, 0x00641, 0x0064A, 0x00642,
+  0x0062D, 0x00642, 0x00645, 0x00642, 0x00649, 0x00642, 0x0064A, 0x00643,
+  0x00627, 0x00643, 0x0062C, 0x00643, 0x0062D, 0x00643, 0x0062E, 0x00643,
+  0x00644, 0x00643, 0x00645, 0x00643, 0x00649, 0x00643, 0x0064A, 0x00644,
+  0x0062C, 0x00644, 0x0062D, 0x00644, 0x0062E, 0x00644, 0x00645, 0x00644,
+  0x00649, 0x00644, 0x0064A, 0x00645, 0x0062C, 0x00645, 0x0062D, 0x00645,
+  0x0062E, 0x00645, 0x00645, 0x00645, 0x00649, 0x00645, 0x0064A, 0x00646,
+  0x0062C, 0x00646, 0x0062D, 0x00646, 0x0062E, 0x00646, 0x00645, 0x00646,
+  0x00649, 0x00646, 0x0064A, 0x00647, 0x0062C, 0x00647, 0x00645, 0x00647,
+  0x00649, 0x00647, 0x0064A, 0x0064A, 0x0062C, 0x0064A, 0x0062D, 0x0064A,
+  0x0062E, 0x0064A, 0x00645, 0x0064A, 0x00649, 0x0064A, 0x0064A, 0x00630,
+  0x00670, 0x00631, 0x00670, 0x00649, 0x00670, 0x00020, 0x0064C, 0x00651,
+  0x00020, 0x0064D, 0x00651, 0x00020, 0x0064E, 0x00651, 0x00020, 0x0064F,
+  0x00651, 0x00020, 0x00650, 0x00651, 0x00020, 0x00651, 0x00670, 0x00626,
+  0x00631, 0x00626, 0x00632, 0x00626, 0x00646, 0x00628, 0x00631, 0x00628,
+  0x00632, 0x00628, 0x00646, 0x0062A, 0x00631, 0x0062A, 0x00632, 0x0062A,
+  0x00646, 0x0062B, 0x00631, 0x0062B, 0x00632, 0x0062B, 0x00646, 0x00645,
+  0x00627, 0x00646, 0x00631, 0x00646, 0x00632, 0x00646, 0x00646, 0x0064A,
+  0x00631, 0x0064A, 0x00632, 0x0064A, 0x00646, 0x00626, 0x0062E, 0x00626,
+  0x00647, 0x00628, 0x00647, 0x0062A, 0x00647, 0x00635, 0x0062E, 0x00644,
+  0x00647, 0x00646, 0x00647, 0x00647, 0x00670, 0x0064A, 0x00647, 0x0062B,
+  0x00647, 0x00633, 0x00647, 0x00634, 0x00645, 0x00634, 0x00647, 0x00640,
+  0x0064E, 0x00651, 0x00640, 0x0064F, 0x00651, 0x00640, 0x00650, 0x00651,
+  0x00637, 0x00649, 0x00637, 0x0064A, 0x00639, 0x00649, 0x00639, 0x0064A,
+  0x0063A, 0x00649, 0x0063A, 0x0064A, 0x00633, 0x00649, 0x00633, 0x0064A,
+  0x00634, 0x00649, 0x00634, 0x0064A, 0x0062D, 0x00649, 0x0062D, 0x0064A,
+  0x0062C, 0x00649, 0x0062C, 0x0064A, 0x0062E, 0x00649, 0x0062E, 0x0064A,
+  0x00635, 0x00649, 0x00635, 0x0064A, 0x00636, 0x00649, 0x00636, 0x0064A,
+  0x00634, 0x0062C, 0x00634, 0x0062D, 0x00634, 0x0062E, 0x00634, 0x00631,
+  0x00633, 0x00631, 0x00635, 0x00631, 0x00636, 0x00631, 0x00627, 0x0064B,
+  0x0062A, 0x0062C, 0x00645, 0x0062A, 0x0062D, 0x0062C, 0x0062A, 0x0062D,
+  0x00645, 0x0062A, 0x0062E, 0x00645, 0x0062A, 0x00645, 0x0062C, 0x0062A,
+  0x00645, 0x0062D, 0x0062A, 0x00645, 0x0062E, 0x0062C, 0x00645, 0x0062D,
+  0x0062D, 0x00645, 0x0064A, 0x0062D, 0x00645, 0x00649, 0x00633, 0x0062D,
+  0x0062C, 0x00633, 0x0062C, 0x0062D, 0x00633, 0x0062C, 0x00649, 0x00633,
+  0x00645, 0x0062D, 0x00633, 0x00645, 0x0062C, 0x00633, 0x00645, 0x00645,
+  0x00635, 0x0062D, 0x0062D, 0x00635, 0x00645, 0x00645, 0x00634, 0x0062D,
+  0x00645, 0x00634, 0x0062C, 0x0064A, 0x00634, 0x00645, 0x0062E, 0x00634,
+  0x00645, 0x00645, 0x00636, 0x0062D, 0x00649, 0x00636, 0x0062E, 0x00645,
+  0x00637, 0x00645, 0x0062D, 0x00637, 0x00645, 0x00645, 0x00637, 0x00645,
+  0x0064A, 0x00639, 0x0062C, 0x00645, 0x00639, 0x00645, 0x00645, 0x00639,
+  0x00645, 0x00649, 0x0063A, 0x00645, 0x00645, 0x0063A, 0x00645, 0x0064A,
+  0x0063A, 0x00645, 0x00649, 0x00641, 0x0062E, 0x00645, 0x00642, 0x00645,
+  0x0062D, 0x00642, 0x00645, 0x00645, 0x00644, 0x0062D, 0x00645, 0x00644,
+  0x0062D, 0x0064A, 0x00644, 0x0062D, 0x00649, 0x00644, 0x0062C, 0x0062C,
+  0x00644, 0x0062E, 0x00645, 0x00644, 0x00645, 0x0062D, 0x00645, 0x0062D,
+  0x0062C, 0x00645, 0x0062D, 0x00645, 0x00645, 0x0062D, 0x0064A, 0x00645,
+  0x0062C, 0x0062D, 0x00645, 0x0062C, 0x00645, 0x00645, 0x0062E, 0x0062C,
+  0x00645, 0x0062E, 0x00645, 0x00645, 0x0062C, 0x0062E, 0x00647, 0x00645,
+  0x0062C, 0x00647, 0x00645, 0x00645, 0x00646, 0x0062D, 0x00645, 0x00646,
+  0x0062D, 0x00649, 0x00646, 0x0062C, 0x00645, 0x00646, 0x0062C, 0x00649,
+  0x00646, 0x00645, 0x0064A, 0x00646, 0x00645, 0x00649, 0x0064A, 0x00645,
+  0x00645, 0x00628, 0x0062E, 0x0064A, 0x0062A, 0x0062C, 0x0064A, 0x0062A,
+  0x0062C, 0x00649, 0x0062A, 0x0062E, 0x0064A, 0x0062A, 0x0062E, 0x00649,
+  0x0062A, 0x00645, 0x0064A, 0x0062A, 0x00645, 0x00649, 0x0062C, 0x00645,
+  0x0064A, 0x0062C, 0x0062D, 0x00649, 0x0062C, 0x00645, 0x00649, 0x00633,
+  0x0062E, 0x00649, 0x00635, 0x0062D, 0x0064A, 0x00634, 0x0062D, 0x0064A,
+  0x00636, 0x0062D, 0x0064A, 0x00644, 0x0062C, 0x0064A, 0x00644, 0x00645,
+  0x0064A, 0x0064A, 0x0062D, 0x0064A, 0x0064A, 0x0062C, 0x0064A, 0x0064A,
+  0x00645, 0x0064A, 0x00645, 0x00645, 0x0064A, 0x00642, 0x00645, 0x0064A,
+  0x00646, 0x0062D, 0x0064A, 0x00639, 0x00645, 0x0064A, 0x00643, 0x00645,
+  0x0064A, 0x00646, 0x0062C, 0x0062D, 0x00645, 0x0062E, 0x0064A, 0x00644,
+  0x0062C, 0x00645, 0x00643, 0x00645, 0x00645, 0x0062C, 0x0062D, 0x0064A,
+  0x0062D, 0x0062C, 0x0064A, 0x00645, 0x0062C, 0x0064A, 0x00641, 0x00645,
+  0x0064A, 0x00628, 0x0062D, 0x0064A, 0x00633, 0x0062E, 0x0064A, 0x00646,
+  0x0062C, 0x0064A, 0x00635, 0x00644, 0x006D2, 0x00642, 0x00644, 0x006D2,
+  0x00627, 0x00644, 0x00644, 0x00647, 0x00627, 0x00643, 0x00628, 0x00631,
+  0x00645, 0x0062D, 0x00645, 0x0062F, 0x00635, 0x00644, 0x00639, 0x00645,
+  0x00631, 0x00633, 0x00648, 0x00644, 0x00639, 0x00644, 0x0064A, 0x00647,
+  0x00648, 0x00633, 0x00644, 0x00645, 0x00635, 0x00644, 0x00649, 0x00635,
+  0x00644, 0x00649, 0x00020, 0x00627, 0x00644, 0x00644, 0x00647, 0x00020,
+  0x00639, 0x00644, 0x0064A, 0x00647, 0x00020, 0x00648, 0x00633, 0x00644,
+  0x00645, 0x0062C, 0x00644, 0x00020, 0x0062C, 0x00644, 0x00627, 0x00644,
+  0x00647, 0x00631, 0x006CC, 0x00627, 0x00644, 0x00020, 0x0064B, 0x00640,
+  0x0064B, 0x00020, 0x0064C, 0x00020, 0x0064D, 0x00020, 0x0064E, 0x00640,
+  0x0064E, 0x00020, 0x0064F, 0x00640, 0x0064F, 0x00020, 0x00650, 0x00640,
+  0x00650, 0x00020, 0x00651, 0x00640, 0x00651, 0x00020, 0x00652, 0x00640,
+  0x00652, 0x00644, 0x00622, 0x00644, 0x00623, 0x00644, 0x00625, 0x00644,
+  0x00627, 0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E,
+  0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165,
+  0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165,
+  0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165,
+  0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x00030, 0x0002C, 0x00031, 0x0002C,
+  0x00032, 0x0002C, 0x00033, 0x0002C, 0x00034, 0x0002C, 0x00035, 0x0002C,
+  0x00036, 0x0002C, 0x00037, 0x0002C, 0x00038, 0x0002C, 0x00039, 0x0002C,
+  0x03014, 0x00073, 0x03015, 0x00077, 0x0007A, 0x00068, 0x00076, 0x00073,
+  0x00064, 0x00073, 0x00073, 0x00070, 0x00070, 0x00076, 0x00077, 0x00063,
+  0x0006D, 0x00063, 0x0006D, 0x00064, 0x0006D, 0x00072, 0x00064, 0x0006A,
+  0x0307B, 0x0304B, 0x030B3, 0x030B3, 0x03014, 0x0672C, 0x03015, 0x03014,
+  0x04E09, 0x03015, 0x03014, 0x04E8C, 0x03015, 0x03014, 0x05B89, 0x03015,
+  0x03014, 0x070B9, 0x03015, 0x03014, 0x06253, 0x03015, 0x03014, 0x076D7,
+  0x03015, 0x03014, 0x052DD, 0x03015, 0x03014, 0x06557, 0x03015,
+};
+
+static const uint32_t uts46_decompositions[3268] = {
+  0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303,
+  0x00041, 0x00308, 0x00041, 0x0030A, 0x00043, 0x00327, 0x00045, 0x00300,
+  0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300,
+  0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308, 0x0004E, 0x00303,
+  0x0004F, 0x00300, 0x0004F, 0x00301, 0x0004F, 0x00302, 0x0004F, 0x00303,
+  0x0004F, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302,
+  0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+  0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030A,
+  0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302,
+  0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302,
+  0x00069, 0x00308, 0x0006E, 0x00303, 0x0006F, 0x00300, 0x0006F, 0x00301,
+  0x0006F, 0x00302, 0x0006F, 0x00303, 0x0006F, 0x00308, 0x00075, 0x00300,
+  0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301,
+  0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306,
+  0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+  0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307,
+  0x00063, 0x00307, 0x00043, 0x0030C, 0x00063, 0x0030C, 0x00044, 0x0030C,
+  0x00064, 0x0030C, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306,
+  0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328,
+  0x00065, 0x00328, 0x00045, 0x0030C, 0x00065, 0x0030C, 0x00047, 0x00302,
+  0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307,
+  0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+  0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304,
+  0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328,
+  0x00069, 0x00328, 0x00049, 0x00307, 0x0004A, 0x00302, 0x0006A, 0x00302,
+  0x0004B, 0x00327, 0x0006B, 0x00327, 0x0004C, 0x00301, 0x0006C, 0x00301,
+  0x0004C, 0x00327, 0x0006C, 0x00327, 0x0004C, 0x0030C, 0x0006C, 0x0030C,
+  0x0004E, 0x00301, 0x0006E, 0x00301, 0x0004E, 0x00327, 0x0006E, 0x00327,
+  0x0004E, 0x0030C, 0x0006E, 0x0030C, 0x0004F, 0x00304, 0x0006F, 0x00304,
+  0x0004F, 0x00306, 0x0006F, 0x00306, 0x0004F, 0x0030B, 0x0006F, 0x0030B,
+  0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327, 0x00072, 0x00327,
+  0x00052, 0x0030C, 0x00072, 0x0030C, 0x00053, 0x00301, 0x00073, 0x00301,
+  0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327, 0x00073, 0x00327,
+  0x00053, 0x0030C, 0x00073, 0x0030C, 0x00054, 0x00327, 0x00074, 0x00327,
+  0x00054, 0x0030C, 0x00074, 0x0030C, 0x00055, 0x00303, 0x00075, 0x00303,
+  0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306, 0x00075, 0x00306,
+  0x00055, 0x0030A, 0x00075, 0x0030A, 0x00055, 0x0030B, 0x00075, 0x0030B,
+  0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302, 0x00077, 0x00302,
+  0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308, 0x0005A, 0x00301,
+  0x0007A, 0x00301, 0x0005A, 0x00307, 0x0007A, 0x00307, 0x0005A, 0x0030C,
+  0x0007A, 0x0030C, 0x0004F, 0x0031B, 0x0006F, 0x0031B, 0x00055, 0x0031B,
+  0x00075, 0x0031B, 0x00041, 0x0030C, 0x00061, 0x0030C, 0x00049, 0x0030C,
+  0x00069, 0x0030C, 0x0004F, 0x0030C, 0x0006F, 0x0030C, 0x00055, 0x0030C,
+  0x00075, 0x0030C, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304,
+  0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+  0x0030C, 0x00075, 0x00308, 0x0030C, 0x00055, 0x00308, 0x00300, 0x00075,
+  0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061, 0x00308, 0x00304,
+  0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000C6, 0x00304,
+  0x000E6, 0x00304, 0x00047, 0x0030C, 0x00067, 0x0030C, 0x0004B, 0x0030C,
+  0x0006B, 0x0030C, 0x0004F, 0x00328, 0x0006F, 0x00328, 0x0004F, 0x00328,
+  0x00304, 0x0006F, 0x00328, 0x00304, 0x001B7, 0x0030C, 0x00292, 0x0030C,
+  0x0006A, 0x0030C, 0x00047, 0x00301, 0x00067, 0x00301, 0x0004E, 0x00300,
+  0x0006E, 0x00300, 0x00041, 0x0030A, 0x00301, 0x00061, 0x0030A, 0x00301,
+  0x000C6, 0x00301, 0x000E6, 0x00301, 0x000D8, 0x00301, 0x000F8, 0x00301,
+  0x00041, 0x0030F, 0x00061, 0x0030F, 0x00041, 0x00311, 0x00061, 0x00311,
+  0x00045, 0x0030F, 0x00065, 0x0030F, 0x00045, 0x00311, 0x00065, 0x00311,
+  0x00049, 0x0030F, 0x00069, 0x0030F, 0x00049, 0x00311, 0x00069, 0x00311,
+  0x0004F, 0x0030F, 0x0006F, 0x0030F, 0x0004F, 0x00311, 0x0006F, 0x00311,
+  0x00052, 0x0030F, 0x00072, 0x0030F, 0x00052, 0x00311, 0x00072, 0x00311,
+  0x00055, 0x0030F, 0x00075, 0x0030F, 0x00055, 0x00311, 0x00075, 0x00311,
+  0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326,
+  0x00048, 0x0030C, 0x00068, 0x0030C, 0x00041, 0x00307, 0x00061, 0x00307,
+  0x00045, 0x00327, 0x00065, 0x00327, 0x0004F, 0x00308, 0x00304, 0x0006F,
+  0x00308, 0x00304, 0x0004F, 0x00303, 0x00304, 0x0006F, 0x00303, 0x00304,
+  0x0004F, 0x00307, 0x0006F, 0x00307, 0x0004F, 0x00307, 0x00304, 0x0006F,
+  0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00300, 0x00301,
+  0x00313, 0x00308, 0x00301, 0x002B9, 0x0003B, 0x000A8, 0x00301, 0x00391,
+  0x00301, 0x000B7, 0x00395, 0x00301, 0x00397, 0x00301, 0x00399, 0x00301,
+  0x0039F, 0x00301, 0x003A5, 0x00301, 0x003A9, 0x00301, 0x003B9, 0x00308,
+  0x00301, 0x00399, 0x00308, 0x003A5, 0x00308, 0x003B1, 0x00301, 0x003B5,
+  0x00301, 0x003B7, 0x00301, 0x003B9, 0x00301, 0x003C5, 0x00308, 0x00301,
+  0x003B9, 0x00308, 0x003C5, 0x00308, 0x003BF, 0x00301, 0x003C5, 0x00301,
+  0x003C9, 0x00301, 0x003D2, 0x00301, 0x003D2, 0x00308, 0x00415, 0x00300,
+  0x00415, 0x00308, 0x00413, 0x00301, 0x00406, 0x00308, 0x0041A, 0x00301,
+  0x00418, 0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306,
+  0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308,
+  0x0043A, 0x00301, 0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030F,
+  0x00475, 0x0030F, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306,
+  0x00430, 0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x00415, 0x00306,
+  0x00435, 0x00306, 0x004D8, 0x00308, 0x004D9, 0x00308, 0x00416, 0x00308,
+  0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304,
+  0x00438, 0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041E, 0x00308,
+  0x0043E, 0x00308, 0x004E8, 0x00308, 0x004E9, 0x00308, 0x0042D, 0x00308,
+  0x0044D, 0x00308, 0x00423, 0x00304, 0x00443, 0x00304, 0x00423, 0x00308,
+  0x00443, 0x00308, 0x00423, 0x0030B, 0x00443, 0x0030B, 0x00427, 0x00308,
+  0x00447, 0x00308, 0x0042B, 0x00308, 0x0044B, 0x00308, 0x00627, 0x00653,
+  0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064A, 0x00654,
+  0x006D5, 0x00654, 0x006C1, 0x00654, 0x006D2, 0x00654, 0x00928, 0x0093C,
+  0x00930, 0x0093C, 0x00933, 0x0093C, 0x00915, 0x0093C, 0x00916, 0x0093C,
+  0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921, 0x0093C, 0x00922, 0x0093C,
+  0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009C7, 0x009BE, 0x009C7, 0x009D7,
+  0x009A1, 0x009BC, 0x009A2, 0x009BC, 0x009AF, 0x009BC, 0x00A32, 0x00A3C,
+  0x00A38, 0x00A3C, 0x00A16, 0x00A3C, 0x00A17, 0x00A3C, 0x00A1C, 0x00A3C,
+  0x00A2B, 0x00A3C, 0x00B47, 0x00B56, 0x00B47, 0x00B3E, 0x00B47, 0x00B57,
+  0x00B21, 0x00B3C, 0x00B22, 0x00B3C, 0x00B92, 0x00BD7, 0x00BC6, 0x00BBE,
+  0x00BC7, 0x00BBE, 0x00BC6, 0x00BD7, 0x00C46, 0x00C56, 0x00CBF, 0x00CD5,
+  0x00CC6, 0x00CD5, 0x00CC6, 0x00CD6, 0x00CC6, 0x00CC2, 0x00CC6, 0x00CC2,
+  0x00CD5, 0x00D46, 0x00D3E, 0x00D47, 0x00D3E, 0x00D46, 0x00D57, 0x00DD9,
+  0x00DCA, 0x00DD9, 0x00DCF, 0x00DD9, 0x00DCF, 0x00DCA, 0x00DD9, 0x00DDF,
+  0x00F42, 0x00FB7, 0x00F4C, 0x00FB7, 0x00F51, 0x00FB7, 0x00F56, 0x00FB7,
+  0x00F5B, 0x00FB7, 0x00F40, 0x00FB5, 0x00F71, 0x00F72, 0x00F71, 0x00F74,
+  0x00FB2, 0x00F80, 0x00FB3, 0x00F80, 0x00F71, 0x00F80, 0x00F92, 0x00FB7,
+  0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7, 0x00FA6, 0x00FB7, 0x00FAB, 0x00FB7,
+  0x00F90, 0x00FB5, 0x01025, 0x0102E, 0x01B05, 0x01B35, 0x01B07, 0x01B35,
+  0x01B09, 0x01B35, 0x01B0B, 0x01B35, 0x01B0D, 0x01B35, 0x01B11, 0x01B35,
+  0x01B3A, 0x01B35, 0x01B3C, 0x01B35, 0x01B3E, 0x01B35, 0x01B3F, 0x01B35,
+  0x01B42, 0x01B35, 0x00041, 0x00325, 0x00061, 0x00325, 0x00042, 0x00307,
+  0x00062, 0x00307, 0x00042, 0x00323, 0x00062, 0x00323, 0x00042, 0x00331,
+  0x00062, 0x00331, 0x00043, 0x00327, 0x00301, 0x00063, 0x00327, 0x00301,
+  0x00044, 0x00307, 0x00064, 0x00307, 0x00044, 0x00323, 0x00064, 0x00323,
+  0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327, 0x00064, 0x00327,
+  0x00044, 0x0032D, 0x00064, 0x0032D, 0x00045, 0x00304, 0x00300, 0x00065,
+  0x00304, 0x00300, 0x00045, 0x00304, 0x00301, 0x00065, 0x00304, 0x00301,
+  0x00045, 0x0032D, 0x00065, 0x0032D, 0x00045, 0x00330, 0x00065, 0x00330,
+  0x00045, 0x00327, 0x00306, 0x00065, 0x00327, 0x00306, 0x00046, 0x00307,
+  0x00066, 0x00307, 0x00047, 0x00304, 0x00067, 0x00304, 0x00048, 0x00307,
+  0x00068, 0x00307, 0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308,
+  0x00068, 0x00308, 0x00048, 0x00327, 0x00068, 0x00327, 0x00048, 0x0032E,
+  0x00068, 0x0032E, 0x00049, 0x00330, 0x00069, 0x00330, 0x00049, 0x00308,
+  0x00301, 0x00069, 0x00308, 0x00301, 0x0004B, 0x00301, 0x0006B, 0x00301,
+  0x0004B, 0x00323, 0x0006B, 0x00323, 0x0004B, 0x00331, 0x0006B, 0x00331,
+  0x0004C, 0x00323, 0x0006C, 0x00323, 0x0004C, 0x00323, 0x00304, 0x0006C,
+  0x00323, 0x00304, 0x0004C, 0x00331, 0x0006C, 0x00331, 0x0004C, 0x0032D,
+  0x0006C, 0x0032D, 0x0004D, 0x00301, 0x0006D, 0x00301, 0x0004D, 0x00307,
+  0x0006D, 0x00307, 0x0004D, 0x00323, 0x0006D, 0x00323, 0x0004E, 0x00307,
+  0x0006E, 0x00307, 0x0004E, 0x00323, 0x0006E, 0x00323, 0x0004E, 0x00331,
+  0x0006E, 0x00331, 0x0004E, 0x0032D, 0x0006E, 0x0032D, 0x0004F, 0x00303,
+  0x00301, 0x0006F, 0x00303, 0x00301, 0x0004F, 0x00303, 0x00308, 0x0006F,
+  0x00303, 0x00308, 0x0004F, 0x00304, 0x00300, 0x0006F, 0x00304, 0x00300,
+  0x0004F, 0x00304, 0x00301, 0x0006F, 0x00304, 0x00301, 0x00050, 0x00301,
+  0x00070, 0x00301, 0x00050, 0x00307, 0x00070, 0x00307, 0x00052, 0x00307,
+  0x00072, 0x00307, 0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323,
+  0x00304, 0x00072, 0x00323, 0x00304, 0x00052, 0x00331, 0x00072, 0x00331,
+  0x00053, 0x00307, 0x00073, 0x00307, 0x00053, 0x00323, 0x00073, 0x00323,
+  0x00053, 0x00301, 0x00307, 0x00073, 0x00301, 0x00307, 0x00053, 0x0030C,
+  0x00307, 0x00073, 0x0030C, 0x00307, 0x00053, 0x00323, 0x00307, 0x00073,
+  0x00323, 0x00307, 0x00054, 0x00307, 0x00074, 0x00307, 0x00054, 0x00323,
+  0x00074, 0x00323, 0x00054, 0x00331, 0x00074, 0x00331, 0x00054, 0x0032D,
+  0x00074, 0x0032D, 0x00055, 0x00324, 0x00075, 0x00324, 0x00055, 0x00330,
+  0x00075, 0x00330, 0x00055, 0x0032D, 0x00075, 0x0032D, 0x00055, 0x00303,
+  0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304, 0x00308, 0x00075,
+  0x00304, 0x00308, 0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323,
+  0x00076, 0x00323, 0x00057, 0x00300, 0x00077, 0x00300, 0x00057, 0x00301,
+  0x00077, 0x00301, 0x00057, 0x00308, 0x00077, 0x00308, 0x00057, 0x00307,
+  0x00077, 0x00307, 0x00057, 0x00323, 0x00077, 0x00323, 0x00058, 0x00307,
+  0x00078, 0x00307, 0x00058, 0x00308, 0x00078, 0x00308, 0x00059, 0x00307,
+  0x00079, 0x00307, 0x0005A, 0x00302, 0x0007A, 0x00302, 0x0005A, 0x00323,
+  0x0007A, 0x00323, 0x0005A, 0x00331, 0x0007A, 0x00331, 0x00068, 0x00331,
+  0x00074, 0x00308, 0x00077, 0x0030A, 0x00079, 0x0030A, 0x0017F, 0x00307,
+  0x00041, 0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309,
+  0x00041, 0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302,
+  0x00300, 0x00061, 0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061,
+  0x00302, 0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303,
+  0x00041, 0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306,
+  0x00301, 0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061,
+  0x00306, 0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309,
+  0x00041, 0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323,
+  0x00306, 0x00061, 0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323,
+  0x00045, 0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303,
+  0x00045, 0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302,
+  0x00300, 0x00065, 0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065,
+  0x00302, 0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303,
+  0x00045, 0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309,
+  0x00069, 0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004F, 0x00323,
+  0x0006F, 0x00323, 0x0004F, 0x00309, 0x0006F, 0x00309, 0x0004F, 0x00302,
+  0x00301, 0x0006F, 0x00302, 0x00301, 0x0004F, 0x00302, 0x00300, 0x0006F,
+  0x00302, 0x00300, 0x0004F, 0x00302, 0x00309, 0x0006F, 0x00302, 0x00309,
+  0x0004F, 0x00302, 0x00303, 0x0006F, 0x00302, 0x00303, 0x0004F, 0x00323,
+  0x00302, 0x0006F, 0x00323, 0x00302, 0x0004F, 0x0031B, 0x00301, 0x0006F,
+  0x0031B, 0x00301, 0x0004F, 0x0031B, 0x00300, 0x0006F, 0x0031B, 0x00300,
+  0x0004F, 0x0031B, 0x00309, 0x0006F, 0x0031B, 0x00309, 0x0004F, 0x0031B,
+  0x00303, 0x0006F, 0x0031B, 0x00303, 0x0004F, 0x0031B, 0x00323, 0x0006F,
+  0x0031B, 0x00323, 0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309,
+  0x00075, 0x00309, 0x00055, 0x0031B, 0x00301, 0x00075, 0x0031B, 0x00301,
+  0x00055, 0x0031B, 0x00300, 0x00075, 0x0031B, 0x00300, 0x00055, 0x0031B,
+  0x00309, 0x00075, 0x0031B, 0x00309, 0x00055, 0x0031B, 0x00303, 0x00075,
+  0x0031B, 0x00303, 0x00055, 0x0031B, 0x00323, 0x00075, 0x0031B, 0x00323,
+  0x00059, 0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323,
+  0x00059, 0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303,
+  0x003B1, 0x00313, 0x003B1, 0x00314, 0x003B1, 0x00313, 0x00300, 0x003B1,
+  0x00314, 0x00300, 0x003B1, 0x00313, 0x00301, 0x003B1, 0x00314, 0x00301,
+  0x003B1, 0x00313, 0x00342, 0x003B1, 0x00314, 0x00342, 0x00391, 0x00313,
+  0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300,
+  0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313,
+  0x00342, 0x00391, 0x00314, 0x00342, 0x003B5, 0x00313, 0x003B5, 0x00314,
+  0x003B5, 0x00313, 0x00300, 0x003B5, 0x00314, 0x00300, 0x003B5, 0x00313,
+  0x00301, 0x003B5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314,
+  0x00395, 0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395, 0x00313,
+  0x00301, 0x00395, 0x00314, 0x00301, 0x003B7, 0x00313, 0x003B7, 0x00314,
+  0x003B7, 0x00313, 0x00300, 0x003B7, 0x00314, 0x00300, 0x003B7, 0x00313,
+  0x00301, 0x003B7, 0x00314, 0x00301, 0x003B7, 0x00313, 0x00342, 0x003B7,
+  0x00314, 0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313,
+  0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397,
+  0x00314, 0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342,
+  0x003B9, 0x00313, 0x003B9, 0x00314, 0x003B9, 0x00313, 0x00300, 0x003B9,
+  0x00314, 0x00300, 0x003B9, 0x00313, 0x00301, 0x003B9, 0x00314, 0x00301,
+  0x003B9, 0x00313, 0x00342, 0x003B9, 0x00314, 0x00342, 0x00399, 0x00313,
+  0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300,
+  0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313,
+  0x00342, 0x00399, 0x00314, 0x00342, 0x003BF, 0x00313, 0x003BF, 0x00314,
+  0x003BF, 0x00313, 0x00300, 0x003BF, 0x00314, 0x00300, 0x003BF, 0x00313,
+  0x00301, 0x003BF, 0x00314, 0x00301, 0x0039F, 0x00313, 0x0039F, 0x00314,
+  0x0039F, 0x00313, 0x00300, 0x0039F, 0x00314, 0x00300, 0x0039F, 0x00313,
+  0x00301, 0x0039F, 0x00314, 0x00301, 0x003C5, 0x00313, 0x003C5, 0x00314,
+  0x003C5, 0x00313, 0x00300, 0x003C5, 0x00314, 0x00300, 0x003C5, 0x00313,
+  0x00301, 0x003C5, 0x00314, 0x00301, 0x003C5, 0x00313, 0x00342, 0x003C5,
+  0x00314, 0x00342, 0x003A5, 0x00314, 0x003A5, 0x00314, 0x00300, 0x003A5,
+  0x00314, 0x00301, 0x003A5, 0x00314, 0x00342, 0x003C9, 0x00313, 0x003C9,
+  0x00314, 0x003C9, 0x00313, 0x00300, 0x003C9, 0x00314, 0x00300, 0x003C9,
+  0x00313, 0x00301, 0x003C9, 0x00314, 0x00301, 0x003C9, 0x00313, 0x00342,
+  0x003C9, 0x00314, 0x00342, 0x003A9, 0x00313, 0x003A9, 0x00314, 0x003A9,
+  0x00313, 0x00300, 0x003A9, 0x00314, 0x00300, 0x003A9, 0x00313, 0x00301,
+  0x003A9, 0x00314, 0x00301, 0x003A9, 0x00313, 0x00342, 0x003A9, 0x00314,
+  0x00342, 0x003B1, 0x00300, 0x003B5, 0x00300, 0x003B7, 0x00300, 0x003B9,
+  0x00300, 0x003BF, 0x00300, 0x003C5, 0x00300, 0x003C9, 0x00300, 0x003B1,
+  0x00313, 0x00345, 0x003B1, 0x00314, 0x00345, 0x003B1, 0x00313, 0x00300,
+  0x00345, 0x003B1, 0x00314, 0x00300, 0x00345, 0x003B1, 0x00313, 0x00301,
+  0x00345, 0x003B1, 0x00314, 0x00301, 0x00345, 0x003B1, 0x00313, 0x00342,
+  0x00345, 0x003B1, 0x00314, 0x00342, 0x00345, 0x00391, 0x00313, 0x00345,
+  0x00391, 0x00314, 0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391,
+  0x00314, 0x00300, 0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391,
+  0x00314, 0x00301, 0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391,
+  0x00314, 0x00342, 0x00345, 0x003B7, 0x00313, 0x00345, 0x003B7, 0x00314,
+  0x00345, 0x003B7, 0x00313, 0x00300, 0x00345, 0x003B7, 0x00314, 0x00300,
+  0x00345, 0x003B7, 0x00313, 0x00301, 0x00345, 0x003B7, 0x00314, 0x00301,
+  0x00345, 0x003B7, 0x00313, 0x00342, 0x00345, 0x003B7, 0x00314, 0x00342,
+  0x00345, 0x00397, 0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397,
+  0x00313, 0x00300, 0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397,
+  0x00313, 0x00301, 0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397,
+  0x00313, 0x00342, 0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003C9,
+  0x00313, 0x00345, 0x003C9, 0x00314, 0x00345, 0x003C9, 0x00313, 0x00300,
+  0x00345, 0x003C9, 0x00314, 0x00300, 0x00345, 0x003C9, 0x00313, 0x00301,
+  0x00345, 0x003C9, 0x00314, 0x00301, 0x00345, 0x003C9, 0x00313, 0x00342,
+  0x00345, 0x003C9, 0x00314, 0x00342, 0x00345, 0x003A9, 0x00313, 0x00345,
+  0x003A9, 0x00314, 0x00345, 0x003A9, 0x00313, 0x00300, 0x00345, 0x003A9,
+  0x00314, 0x00300, 0x00345, 0x003A9, 0x00313, 0x00301, 0x00345, 0x003A9,
+  0x00314, 0x00301, 0x00345, 0x003A9, 0x00313, 0x00342, 0x00345, 0x003A9,
+  0x00314, 0x00342, 0x00345, 0x003B1, 0x00306, 0x003B1, 0x00304, 0x003B1,
+  0x00300, 0x00345, 0x003B1, 0x00345, 0x003B1, 0x00301, 0x00345, 0x003B1,
+  0x00342, 0x003B1, 0x00342, 0x00345, 0x00391, 0x00306, 0x00391, 0x00304,
+  0x00391, 0x00300, 0x00391, 0x00345, 0x003B9, 0x000A8, 0x00342, 0x003B7,
+  0x00300, 0x00345, 0x003B7, 0x00345, 0x003B7, 0x00301, 0x00345, 0x003B7,
+  0x00342, 0x003B7, 0x00342, 0x00345, 0x00395, 0x00300, 0x00397, 0x00300,
+  0x00397, 0x00345, 0x01FBF, 0x00300, 0x01FBF, 0x00301, 0x01FBF, 0x00342,
+  0x003B9, 0x00306, 0x003B9, 0x00304, 0x003B9, 0x00308, 0x00300, 0x003B9,
+  0x00342, 0x003B9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304,
+  0x00399, 0x00300, 0x01FFE, 0x00300, 0x01FFE, 0x00301, 0x01FFE, 0x00342,
+  0x003C5, 0x00306, 0x003C5, 0x00304, 0x003C5, 0x00308, 0x00300, 0x003C1,
+  0x00313, 0x003C1, 0x00314, 0x003C5, 0x00342, 0x003C5, 0x00308, 0x00342,
+  0x003A5, 0x00306, 0x003A5, 0x00304, 0x003A5, 0x00300, 0x003A1, 0x00314,
+  0x000A8, 0x00300, 0x00060, 0x003C9, 0x00300, 0x00345, 0x003C9, 0x00345,
+  0x003C9, 0x00301, 0x00345, 0x003C9, 0x00342, 0x003C9, 0x00342, 0x00345,
+  0x0039F, 0x00300, 0x003A9, 0x00300, 0x003A9, 0x00345, 0x000B4, 0x02002,
+  0x02003, 0x003A9, 0x0004B, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194,
+  0x00338, 0x021D0, 0x00338, 0x021D4, 0x00338, 0x021D2, 0x00338, 0x02203,
+  0x00338, 0x02208, 0x00338, 0x0220B, 0x00338, 0x02223, 0x00338, 0x02225,
+  0x00338, 0x0223C, 0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248,
+  0x00338, 0x0003D, 0x00338, 0x02261, 0x00338, 0x0224D, 0x00338, 0x0003C,
+  0x00338, 0x0003E, 0x00338, 0x02264, 0x00338, 0x02265, 0x00338, 0x02272,
+  0x00338, 0x02273, 0x00338, 0x02276, 0x00338, 0x02277, 0x00338, 0x0227A,
+  0x00338, 0x0227B, 0x00338, 0x02282, 0x00338, 0x02283, 0x00338, 0x02286,
+  0x00338, 0x02287, 0x00338, 0x022A2, 0x00338, 0x022A8, 0x00338, 0x022A9,
+  0x00338, 0x022AB, 0x00338, 0x0227C, 0x00338, 0x0227D, 0x00338, 0x02291,
+  0x00338, 0x02292, 0x00338, 0x022B2, 0x00338, 0x022B3, 0x00338, 0x022B4,
+  0x00338, 0x022B5, 0x00338, 0x03008, 0x03009, 0x02ADD, 0x00338, 0x0304B,
+  0x03099, 0x0304D, 0x03099, 0x0304F, 0x03099, 0x03051, 0x03099, 0x03053,
+  0x03099, 0x03055, 0x03099, 0x03057, 0x03099, 0x03059, 0x03099, 0x0305B,
+  0x03099, 0x0305D, 0x03099, 0x0305F, 0x03099, 0x03061, 0x03099, 0x03064,
+  0x03099, 0x03066, 0x03099, 0x03068, 0x03099, 0x0306F, 0x03099, 0x0306F,
+  0x0309A, 0x03072, 0x03099, 0x03072, 0x0309A, 0x03075, 0x03099, 0x03075,
+  0x0309A, 0x03078, 0x03099, 0x03078, 0x0309A, 0x0307B, 0x03099, 0x0307B,
+  0x0309A, 0x03046, 0x03099, 0x0309D, 0x03099, 0x030AB, 0x03099, 0x030AD,
+  0x03099, 0x030AF, 0x03099, 0x030B1, 0x03099, 0x030B3, 0x03099, 0x030B5,
+  0x03099, 0x030B7, 0x03099, 0x030B9, 0x03099, 0x030BB, 0x03099, 0x030BD,
+  0x03099, 0x030BF, 0x03099, 0x030C1, 0x03099, 0x030C4, 0x03099, 0x030C6,
+  0x03099, 0x030C8, 0x03099, 0x030CF, 0x03099, 0x030CF, 0x0309A, 0x030D2,
+  0x03099, 0x030D2, 0x0309A, 0x030D5, 0x03099, 0x030D5, 0x0309A, 0x030D8,
+  0x03099, 0x030D8, 0x0309A, 0x030DB, 0x03099, 0x030DB, 0x0309A, 0x030A6,
+  0x03099, 0x030EF, 0x03099, 0x030F0, 0x03099, 0x030F1, 0x03099, 0x030F2,
+  0x03099, 0x030FD, 0x03099, 0x08C48, 0x066F4, 0x08ECA, 0x08CC8, 0x06ED1,
+  0x04E32, 0x053E5, 0x09F9C, 0x05951, 0x091D1, 0x05587, 0x05948, 0x061F6,
+  0x07669, 0x07F85, 0x0863F, 0x087BA, 0x088F8, 0x0908F, 0x06A02, 0x06D1B,
+  0x070D9, 0x073DE, 0x0843D, 0x0916A, 0x099F1, 0x04E82, 0x05375, 0x06B04,
+  0x0721B, 0x0862D, 0x09E1E, 0x05D50, 0x06FEB, 0x085CD, 0x08964, 0x062C9,
+  0x081D8, 0x0881F, 0x05ECA, 0x06717, 0x06D6A, 0x072FC, 0x090CE, 0x04F86,
+  0x051B7, 0x052DE, 0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08001, 0x08606,
+  0x0865C, 0x08DEF, 0x09732, 0x09B6F, 0x09DFA, 0x0788C, 0x0797F, 0x07DA0,
+  0x083C9, 0x09304, 0x09E7F, 0x08AD6, 0x058DF, 0x05F04, 0x07C60, 0x0807E,
+  0x07262, 0x078CA, 0x08CC2, 0x096F7, 0x058D8, 0x05C62, 0x06A13, 0x06DDA,
+  0x06F0F, 0x07D2F, 0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC,
+  0x07A1C, 0x07DBE, 0x083F1, 0x09675, 0x08B80, 0x062CF, 0x08AFE, 0x04E39,
+  0x05BE7, 0x06012, 0x07387, 0x07570, 0x05317, 0x078FB, 0x04FBF, 0x05FA9,
+  0x04E0D, 0x06CCC, 0x06578, 0x07D22, 0x053C3, 0x0585E, 0x07701, 0x08449,
+  0x08AAA, 0x06BBA, 0x08FB0, 0x06C88, 0x062FE, 0x082E5, 0x063A0, 0x07565,
+  0x04EAE, 0x05169, 0x051C9, 0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF,
+  0x052F5, 0x05442, 0x05973, 0x05EEC, 0x065C5, 0x06FFE, 0x0792A, 0x095AD,
+  0x09A6A, 0x09E97, 0x09ECE, 0x0529B, 0x066C6, 0x06B77, 0x08F62, 0x05E74,
+  0x06190, 0x06200, 0x0649A, 0x06F23, 0x07149, 0x07489, 0x079CA, 0x07DF4,
+  0x0806F, 0x08F26, 0x084EE, 0x09023, 0x0934A, 0x05217, 0x052A3, 0x054BD,
+  0x070C8, 0x088C2, 0x05EC9, 0x05FF5, 0x0637B, 0x06BAE, 0x07C3E, 0x07375,
+  0x04EE4, 0x056F9, 0x05DBA, 0x0601C, 0x073B2, 0x07469, 0x07F9A, 0x08046,
+  0x09234, 0x096F6, 0x09748, 0x09818, 0x04F8B, 0x079AE, 0x091B4, 0x096B8,
+  0x060E1, 0x04E86, 0x050DA, 0x05BEE, 0x05C3F, 0x06599, 0x071CE, 0x07642,
+  0x084FC, 0x0907C, 0x09F8D, 0x06688, 0x0962E, 0x05289, 0x0677B, 0x067F3,
+  0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B, 0x07D10, 0x0985E, 0x0516D,
+  0x0622E, 0x09678, 0x0502B, 0x05D19, 0x06DEA, 0x08F2A, 0x05F8B, 0x06144,
+  0x06817, 0x09686, 0x05229, 0x0540F, 0x05C65, 0x06613, 0x0674E, 0x068A8,
+  0x06CE5, 0x07406, 0x075E2, 0x07F79, 0x088CF, 0x088E1, 0x091CC, 0x096E2,
+  0x0533F, 0x06EBA, 0x0541D, 0x071D0, 0x07498, 0x085FA, 0x096A3, 0x09C57,
+  0x09E9F, 0x06797, 0x06DCB, 0x081E8, 0x07ACB, 0x07B20, 0x07C92, 0x072C0,
+  0x07099, 0x08B58, 0x04EC0, 0x08336, 0x0523A, 0x05207, 0x05EA6, 0x062D3,
+  0x07CD6, 0x05B85, 0x06D1E, 0x066B4, 0x08F3B, 0x0884C, 0x0964D, 0x0898B,
+  0x05ED3, 0x05140, 0x055C0, 0x0585A, 0x06674, 0x051DE, 0x0732A, 0x076CA,
+  0x0793C, 0x0795E, 0x07965, 0x0798F, 0x09756, 0x07CBE, 0x07FBD, 0x08612,
+  0x08AF8, 0x09038, 0x090FD, 0x098EF, 0x098FC, 0x09928, 0x09DB4, 0x090DE,
+  0x096B7, 0x04FAE, 0x050E7, 0x0514D, 0x052C9, 0x052E4, 0x05351, 0x0559D,
+  0x05606, 0x05668, 0x05840, 0x058A8, 0x05C64, 0x05C6E, 0x06094, 0x06168,
+  0x0618E, 0x061F2, 0x0654F, 0x065E2, 0x06691, 0x06885, 0x06D77, 0x06E1A,
+  0x06F22, 0x0716E, 0x0722B, 0x07422, 0x07891, 0x0793E, 0x07949, 0x07948,
+  0x07950, 0x07956, 0x0795D, 0x0798D, 0x0798E, 0x07A40, 0x07A81, 0x07BC0,
+  0x07E09, 0x07E41, 0x07F72, 0x08005, 0x081ED, 0x08279, 0x08457, 0x08910,
+  0x08996, 0x08B01, 0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x096E3, 0x097FF,
+  0x0983B, 0x06075, 0x242EE, 0x08218, 0x04E26, 0x051B5, 0x05168, 0x04F80,
+  0x05145, 0x05180, 0x052C7, 0x052FA, 0x05555, 0x05599, 0x055E2, 0x058B3,
+  0x05944, 0x05954, 0x05A62, 0x05B28, 0x05ED2, 0x05ED9, 0x05F69, 0x05FAD,
+  0x060D8, 0x0614E, 0x06108, 0x06160, 0x06234, 0x063C4, 0x0641C, 0x06452,
+  0x06556, 0x0671B, 0x06756, 0x06B79, 0x06EDB, 0x06ECB, 0x0701E, 0x077A7,
+  0x07235, 0x072AF, 0x07471, 0x07506, 0x0753B, 0x0761D, 0x0761F, 0x076DB,
+  0x076F4, 0x0774A, 0x07740, 0x078CC, 0x07AB1, 0x07C7B, 0x07D5B, 0x07F3E,
+  0x08352, 0x083EF, 0x08779, 0x08941, 0x08986, 0x08ABF, 0x08ACB, 0x08AED,
+  0x08B8A, 0x08F38, 0x09072, 0x09199, 0x09276, 0x0967C, 0x097DB, 0x0980B,
+  0x09B12, 0x2284A, 0x22844, 0x233D5, 0x03B9D, 0x04018, 0x04039, 0x25249,
+  0x25CD0, 0x27ED3, 0x09F43, 0x09F8E, 0x005D9, 0x005B4, 0x005F2, 0x005B7,
+  0x005E9, 0x005C1, 0x005E9, 0x005C2, 0x005E9, 0x005BC, 0x005C1, 0x005E9,
+  0x005BC, 0x005C2, 0x005D0, 0x005B7, 0x005D0, 0x005B8, 0x005D0, 0x005BC,
+  0x005D1, 0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC, 0x005D4, 0x005BC,
+  0x005D5, 0x005BC, 0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9, 0x005BC,
+  0x005DA, 0x005BC, 0x005DB, 0x005BC, 0x005DC, 0x005BC, 0x005DE, 0x005BC,
+  0x005E0, 0x005BC, 0x005E1, 0x005BC, 0x005E3, 0x005BC, 0x005E4, 0x005BC,
+  0x005E6, 0x005BC, 0x005E7, 0x005BC, 0x005E8, 0x005BC, 0x005E9, 0x005BC,
+  0x005EA, 0x005BC, 0x005D5, 0x005B9, 0x005D1, 0x005BF, 0x005DB, 0x005BF,
+  0x005E4, 0x005BF, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5, 0x110BA,
+  0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347, 0x11357,
+  0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8, 0x115AF,
+  0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158, 0x1D165,
+  0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165,
+  0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9,
+  0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165,
+  0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x04E3D,
+  0x04E38, 0x04E41, 0x20122, 0x04F60, 0x04FBB, 0x05002, 0x0507A, 0x05099,
+  0x050CF, 0x0349E, 0x2063A, 0x05154, 0x05164, 0x05177, 0x2051C, 0x034B9,
+  0x05167, 0x0518D, 0x2054B, 0x05197, 0x051A4, 0x04ECC, 0x051AC, 0x291DF,
+  0x051F5, 0x05203, 0x034DF, 0x0523B, 0x05246, 0x05272, 0x05277, 0x03515,
+  0x05305, 0x05306, 0x05349, 0x0535A, 0x05373, 0x0537D, 0x0537F, 0x20A2C,
+  0x07070, 0x053CA, 0x053DF, 0x20B63, 0x053EB, 0x053F1, 0x05406, 0x0549E,
+  0x05438, 0x05448, 0x05468, 0x054A2, 0x054F6, 0x05510, 0x05553, 0x05563,
+  0x05584, 0x055AB, 0x055B3, 0x055C2, 0x05716, 0x05717, 0x05651, 0x05674,
+  0x058EE, 0x057CE, 0x057F4, 0x0580D, 0x0578B, 0x05832, 0x05831, 0x058AC,
+  0x214E4, 0x058F2, 0x058F7, 0x05906, 0x0591A, 0x05922, 0x05962, 0x216A8,
+  0x216EA, 0x059EC, 0x05A1B, 0x05A27, 0x059D8, 0x05A66, 0x036EE, 0x036FC,
+  0x05B08, 0x05B3E, 0x219C8, 0x05BC3, 0x05BD8, 0x05BF3, 0x21B18, 0x05BFF,
+  0x05C06, 0x05F53, 0x05C22, 0x03781, 0x05C60, 0x05CC0, 0x05C8D, 0x21DE4,
+  0x05D43, 0x21DE6, 0x05D6E, 0x05D6B, 0x05D7C, 0x05DE1, 0x05DE2, 0x0382F,
+  0x05DFD, 0x05E28, 0x05E3D, 0x05E69, 0x03862, 0x22183, 0x0387C, 0x05EB0,
+  0x05EB3, 0x05EB6, 0x2A392, 0x05EFE, 0x22331, 0x08201, 0x05F22, 0x038C7,
+  0x232B8, 0x261DA, 0x05F62, 0x05F6B, 0x038E3, 0x05F9A, 0x05FCD, 0x05FD7,
+  0x05FF9, 0x06081, 0x0393A, 0x0391C, 0x226D4, 0x060C7, 0x06148, 0x0614C,
+  0x0617A, 0x061B2, 0x061A4, 0x061AF, 0x061DE, 0x06210, 0x0621B, 0x0625D,
+  0x062B1, 0x062D4, 0x06350, 0x22B0C, 0x0633D, 0x062FC, 0x06368, 0x06383,
+  0x063E4, 0x22BF1, 0x06422, 0x063C5, 0x063A9, 0x03A2E, 0x06469, 0x0647E,
+  0x0649D, 0x06477, 0x03A6C, 0x0656C, 0x2300A, 0x065E3, 0x066F8, 0x06649,
+  0x03B19, 0x03B08, 0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C, 0x080AD,
+  0x043D9, 0x06721, 0x0675E, 0x06753, 0x233C3, 0x03B49, 0x067FA, 0x06785,
+  0x06852, 0x2346D, 0x0688E, 0x0681F, 0x06914, 0x06942, 0x069A3, 0x069EA,
+  0x06AA8, 0x236A3, 0x06ADB, 0x03C18, 0x06B21, 0x238A7, 0x06B54, 0x03C4E,
+  0x06B72, 0x06B9F, 0x06BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x06C4E, 0x23CBC,
+  0x06CBF, 0x06CCD, 0x06C67, 0x06D16, 0x06D3E, 0x06D69, 0x06D78, 0x06D85,
+  0x23D1E, 0x06D34, 0x06E2F, 0x06E6E, 0x03D33, 0x06EC7, 0x23ED1, 0x06DF9,
+  0x06F6E, 0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701B, 0x03D96, 0x0704A,
+  0x0707D, 0x07077, 0x070AD, 0x20525, 0x07145, 0x24263, 0x0719C, 0x243AB,
+  0x07228, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814, 0x0737A,
+  0x0738B, 0x03EAC, 0x073A5, 0x03EB8, 0x07447, 0x0745C, 0x07485, 0x074CA,
+  0x03F1B, 0x07524, 0x24C36, 0x0753E, 0x24C92, 0x2219F, 0x07610, 0x24FA1,
+  0x24FB8, 0x25044, 0x03FFC, 0x04008, 0x250F3, 0x250F2, 0x25119, 0x25133,
+  0x0771E, 0x0771F, 0x0778B, 0x04046, 0x04096, 0x2541D, 0x0784E, 0x040E3,
+  0x25626, 0x2569A, 0x256C5, 0x079EB, 0x0412F, 0x07A4A, 0x07A4F, 0x2597C,
+  0x25AA7, 0x07AEE, 0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227, 0x25C80,
+  0x07CD2, 0x042A0, 0x07CE8, 0x07CE3, 0x07D00, 0x25F86, 0x07D63, 0x04301,
+  0x07DC7, 0x07E02, 0x07E45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262D9,
+  0x07F7A, 0x2633E, 0x07F95, 0x07FFA, 0x264DA, 0x26523, 0x08060, 0x265A8,
+  0x08070, 0x2335F, 0x043D5, 0x080B2, 0x08103, 0x0440B, 0x0813E, 0x05AB5,
+  0x267A7, 0x267B5, 0x23393, 0x2339C, 0x08204, 0x08F9E, 0x0446B, 0x08291,
+  0x0828B, 0x0829D, 0x052B3, 0x082B1, 0x082B3, 0x082BD, 0x082E6, 0x26B3C,
+  0x0831D, 0x08363, 0x083AD, 0x08323, 0x083BD, 0x083E7, 0x08353, 0x083CA,
+  0x083CC, 0x083DC, 0x26C36, 0x26D6B, 0x26CD5, 0x0452B, 0x084F1, 0x084F3,
+  0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D, 0x04561, 0x26FB1, 0x270D2,
+  0x0456B, 0x08650, 0x08667, 0x08669, 0x086A9, 0x08688, 0x0870E, 0x086E2,
+  0x08728, 0x0876B, 0x08786, 0x045D7, 0x087E1, 0x08801, 0x045F9, 0x08860,
+  0x08863, 0x27667, 0x088D7, 0x088DE, 0x04635, 0x088FA, 0x034BB, 0x278AE,
+  0x27966, 0x046BE, 0x046C7, 0x08AA0, 0x08C55, 0x27CA8, 0x08CAB, 0x08CC1,
+  0x08D1B, 0x08D77, 0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0, 0x208DE,
+  0x08ED4, 0x285D2, 0x285ED, 0x09094, 0x090F1, 0x09111, 0x2872E, 0x0911B,
+  0x09238, 0x092D7, 0x092D8, 0x0927C, 0x093F9, 0x09415, 0x28BFA, 0x0958B,
+  0x04995, 0x095B7, 0x28D77, 0x049E6, 0x096C3, 0x05DB2, 0x09723, 0x29145,
+  0x2921A, 0x04A6E, 0x04A76, 0x097E0, 0x2940A, 0x04AB2, 0x29496, 0x09829,
+  0x295B6, 0x098E2, 0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE, 0x04BCE,
+  0x29B30, 0x09C40, 0x09CFD, 0x04CCE, 0x04CED, 0x09D67, 0x2A0CE, 0x04CF8,
+  0x2A105, 0x2A20E, 0x2A291, 0x09EBB, 0x04D56, 0x09EF9, 0x09EFE, 0x09F05,
+  0x09F0F, 0x09F16, 0x09F3B, 0x2A600,
+};
+
+/* Canonical compositions as {first, second, composite}, sorted by first and second */
+#define UTS46_MIN_COMPOSITION_SECOND 0x300
+
+static const uint32_t uts46_compositions[941][3] = {
+  {0x0003C, 0x00338, 0x0226E}, {0x0003D, 0x00338, 0x02260}, {0x0003E, 0x00338, 0x0226F},
+  {0x00041, 0x00300, 0x000C0}, {0x00041, 0x00301, 0x000C1}, {0x00041, 0x00302, 0x000C2},
+  {0x00041, 0x00303, 0x000C3}, {0x00041, 0x00304, 0x00100}, {0x00041, 0x00306, 0x00102},
+  {0x00041, 0x00307, 0x00226}, {0x00041, 0x00308, 0x000C4}, {0x00041, 0x00309, 0x01EA2},
+  {0x00041, 0x0030A, 0x000C5}, {0x00041, 0x0030C, 0x001CD}, {0x00041, 0x0030F, 0x00200},
+  {0x00041, 0x00311, 0x00202}, {0x00041, 0x00323, 0x01EA0}, {0x00041, 0x00325, 0x01E00},
+  {0x00041, 0x00328, 0x00104}, {0x00042, 0x00307, 0x01E02}, {0x00042, 0x00323, 0x01E04},
+  {0x00042, 0x00331, 0x01E06}, {0x00043, 0x00301, 0x00106}, {0x00043, 0x00302, 0x00108},
+  {0x00043, 0x00307, 0x0010A}, {0x00043, 0x0030C, 0x0010C}, {0x00043, 0x00327, 0x000C7},
+  {0x00044, 0x00307, 0x01E0A}, {0x00044, 0x0030C, 0x0010E}, {0x00044, 0x00323, 0x01E0C},
+  {0x00044, 0x00327, 0x01E10}, {0x00044, 0x0032D, 0x01E12}, {0x00044, 0x00331, 0x01E0E},
+  {0x00045, 0x00300, 0x000C8}, {0x00045, 0x00301, 0x000C9}, {0x00045, 0x00302, 0x000CA},
+  {0x00045, 0x00303, 0x01EBC}, {0x00045, 0x00304, 0x00112}, {0x00045, 0x00306, 0x00114},
+  {0x00045, 0x00307, 0x00116}, {0x00045, 0x00308, 0x000CB}, {0x00045, 0x00309, 0x01EBA},
+  {0x00045, 0x0030C, 0x0011A}, {0x00045, 0x0030F, 0x00204}, {0x00045, 0x00311, 0x00206},
+  {0x00045, 0x00323, 0x01EB8}, {0x00045, 0x00327, 0x00228}, {0x00045, 0x00328, 0x00118},
+  {0x00045, 0x0032D, 0x01E18}, {0x00045, 0x00330, 0x01E1A}, {0x00046, 0x00307, 0x01E1E},
+  {0x00047, 0x00301, 0x001F4}, {0x00047, 0x00302, 0x0011C}, {0x00047, 0x00304, 0x01E20},
+  {0x00047, 0x00306, 0x0011E}, {0x00047, 0x00307, 0x00120}, {0x00047, 0x0030C, 0x001E6},
+  {0x00047, 0x00327, 0x00122}, {0x00048, 0x00302, 0x00124}, {0x00048, 0x00307, 0x01E22},
+  {0x00048, 0x00308, 0x01E26}, {0x00048, 0x0030C, 0x0021E}, {0x00048, 0x00323, 0x01E24},
+  {0x00048, 0x00327, 0x01E28}, {0x00048, 0x0032E, 0x01E2A}, {0x00049, 0x00300, 0x000CC},
+  {0x00049, 0x00301, 0x000CD}, {0x00049, 0x00302, 0x000CE}, {0x00049, 0x00303, 0x00128},
+  {0x00049, 0x00304, 0x0012A}, {0x00049, 0x00306, 0x0012C}, {0x00049, 0x00307, 0x00130},
+  {0x00049, 0x00308, 0x000CF}, {0x00049, 0x00309, 0x01EC8}, {0x00049, 0x0030C, 0x001CF},
+  {0x00049, 0x0030F, 0x00208}, {0x00049, 0x00311, 0x0020A}, {0x00049, 0x00323, 0x01ECA},
+  {0x00049, 0x00328, 0x0012E}, {0x00049, 0x00330, 0x01E2C}, {0x0004A, 0x00302, 0x00134},
+  {0x0004B, 0x00301, 0x01E30}, {0x0004B, 0x0030C, 0x001E8}, {0x0004B, 0x00323, 0x01E32},
+  {0x0004B, 0x00327, 0x00136}, {0x0004B, 0x00331, 0x01E34}, {0x0004C, 0x00301, 0x00139},
+  {0x0004C, 0x0030C, 0x0013D}, {0x0004C, 0x00323, 0x01E36}, {0x0004C, 0x00327, 0x0013B},
+  {0x0004C, 0x0032D, 0x01E3C}, {0x0004C, 0x00331, 0x01E3A}, {0x0004D, 0x00301, 0x01E3E},
+  {0x0004D, 0x00307, 0x01E40}, {0x0004D, 0x00323, 0x01E42}, {0x0004E, 0x00300, 0x001F8},
+  {0x0004E, 0x00301, 0x00143}, {0x0004E, 0x00303, 0x000D1}, {0x0004E, 0x00307, 0x01E44},
+  {0x0004E, 0x0030C, 0x00147}, {0x0004E, 0x00323, 0x01E46}, {0x0004E, 0x00327, 0x00145},
+  {0x0004E, 0x0032D, 0x01E4A}, {0x0004E, 0x00331, 0x01E48}, {0x0004F, 0x00300, 0x000D2},
+  {0x0004F, 0x00301, 0x000D3}, {0x0004F, 0x00302, 0x000D4}, {0x0004F, 0x00303, 0x000D5},
+  {0x0004F, 0x00304, 0x0014C}, {0x0004F, 0x00306, 0x0014E}, {0x0004F, 0x00307, 0x0022E},
+  {0x0004F, 0x00308, 0x000D6}, {0x0004F, 0x00309, 0x01ECE}, {0x0004F, 0x0030B, 0x00150},
+  {0x0004F, 0x0030C, 0x001D1}, {0x0004F, 0x0030F, 0x0020C}, {0x0004F, 0x00311, 0x0020E},
+  {0x0004F, 0x0031B, 0x001A0}, {0x0004F, 0x00323, 0x01ECC}, {0x0004F, 0x00328, 0x001EA},
+  {0x00050, 0x00301, 0x01E54}, {0x00050, 0x00307, 0x01E56}, {0x00052, 0x00301, 0x00154},
+  {0x00052, 0x00307, 0x01E58}, {0x00052, 0x0030C, 0x00158}, {0x00052, 0x0030F, 0x00210},
+  {0x00052, 0x00311, 0x00212}, {0x00052, 0x00323, 0x01E5A}, {0x00052, 0x00327, 0x00156},
+  {0x00052, 0x00331, 0x01E5E}, {0x00053, 0x00301, 0x0015A}, {0x00053, 0x00302, 0x0015C},
+  {0x00053, 0x00307, 0x01E60}, {0x00053, 0x0030C, 0x00160}, {0x00053, 0x00323, 0x01E62},
+  {0x00053, 0x00326, 0x00218}, {0x00053, 0x00327, 0x0015E}, {0x00054, 0x00307, 0x01E6A},
+  {0x00054, 0x0030C, 0x00164}, {0x00054, 0x00323, 0x01E6C}, {0x00054, 0x00326, 0x0021A},
+  {0x00054, 0x00327, 0x00162}, {0x00054, 0x0032D, 0x01E70}, {0x00054, 0x00331, 0x01E6E},
+  {0x00055, 0x00300, 0x000D9}, {0x00055, 0x00301, 0x000DA}, {0x00055, 0x00302, 0x000DB},
+  {0x00055, 0x00303, 0x00168}, {0x00055, 0x00304, 0x0016A}, {0x00055, 0x00306, 0x0016C},
+  {0x00055, 0x00308, 0x000DC}, {0x00055, 0x00309, 0x01EE6}, {0x00055, 0x0030A, 0x0016E},
+  {0x00055, 0x0030B, 0x00170}, {0x00055, 0x0030C, 0x001D3}, {0x00055, 0x0030F, 0x00214},
+  {0x00055, 0x00311, 0x00216}, {0x00055, 0x0031B, 0x001AF}, {0x00055, 0x00323, 0x01EE4},
+  {0x00055, 0x00324, 0x01E72}, {0x00055, 0x00328, 0x00172}, {0x00055, 0x0032D, 0x01E76},
+  {0x00055, 0x00330, 0x01E74}, {0x00056, 0x00303, 0x01E7C}, {0x00056, 0x00323, 0x01E7E},
+  {0x00057, 0x00300, 0x01E80}, {0x00057, 0x00301, 0x01E82}, {0x00057, 0x00302, 0x00174},
+  {0x00057, 0x00307, 0x01E86}, {0x00057, 0x00308, 0x01E84}, {0x00057, 0x00323, 0x01E88},
+  {0x00058, 0x00307, 0x01E8A}, {0x00058, 0x00308, 0x01E8C}, {0x00059, 0x00300, 0x01EF2},
+  {0x00059, 0x00301, 0x000DD}, {0x00059, 0x00302, 0x00176}, {0x00059, 0x00303, 0x01EF8},
+  {0x00059, 0x00304, 0x00232}, {0x00059, 0x00307, 0x01E8E}, {0x00059, 0x00308, 0x00178},
+  {0x00059, 0x00309, 0x01EF6}, {0x00059, 0x00323, 0x01EF4}, {0x0005A, 0x00301, 0x00179},
+  {0x0005A, 0x00302, 0x01E90}, {0x0005A, 0x00307, 0x0017B}, {0x0005A, 0x0030C, 0x0017D},
+  {0x0005A, 0x00323, 0x01E92}, {0x0005A, 0x00331, 0x01E94}, {0x00061, 0x00300, 0x000E0},
+  {0x00061, 0x00301, 0x000E1}, {0x00061, 0x00302, 0x000E2}, {0x00061, 0x00303, 0x000E3},
+  {0x00061, 0x00304, 0x00101}, {0x00061, 0x00306, 0x00103}, {0x00061, 0x00307, 0x00227},
+  {0x00061, 0x00308, 0x000E4}, {0x00061, 0x00309, 0x01EA3}, {0x00061, 0x0030A, 0x000E5},
+  {0x00061, 0x0030C, 0x001CE}, {0x00061, 0x0030F, 0x00201}, {0x00061, 0x00311, 0x00203},
+  {0x00061, 0x00323, 0x01EA1}, {0x00061, 0x00325, 0x01E01}, {0x00061, 0x00328, 0x00105},
+  {0x00062, 0x00307, 0x01E03}, {0x00062, 0x00323, 0x01E05}, {0x00062, 0x00331, 0x01E07},
+  {0x00063, 0x00301, 0x00107}, {0x00063, 0x00302, 0x00109}, {0x00063, 0x00307, 0x0010B},
+  {0x00063, 0x0030C, 0x0010D}, {0x00063, 0x00327, 0x000E7}, {0x00064, 0x00307, 0x01E0B},
+  {0x00064, 0x0030C, 0x0010F}, {0x00064, 0x00323, 0x01E0D}, {0x00064, 0x00327, 0x01E11},
+  {0x00064, 0x0032D, 0x01E13}, {0x00064, 0x00331, 0x01E0F}, {0x00065, 0x00300, 0x000E8},
+  {0x00065, 0x00301, 0x000E9}, {0x00065, 0x00302, 0x000EA}, {0x00065, 0x00303, 0x01EBD},
+  {0x00065, 0x00304, 0x00113}, {0x00065, 0x00306, 0x00115}, {0x00065, 0x00307, 0x00117},
+  {0x00065, 0x00308, 0x000EB}, {0x00065, 0x00309, 0x01EBB}, {0x00065, 0x0030C, 0x0011B},
+  {0x00065, 0x0030F, 0x00205}, {0x00065, 0x00311, 0x00207}, {0x00065, 0x00323, 0x01EB9},
+  {0x00065, 0x00327, 0x00229}, {0x00065, 0x00328, 0x00119}, {0x00065, 0x0032D, 0x01E19},
+  {0x00065, 0x00330, 0x01E1B}, {0x00066, 0x00307, 0x01E1F}, {0x00067, 0x00301, 0x001F5},
+  {0x00067, 0x00302, 0x0011D}, {0x00067, 0x00304, 0x01E21}, {0x00067, 0x00306, 0x0011F},
+  {0x00067, 0x00307, 0x00121}, {0x00067, 0x0030C, 0x001E7}, {0x00067, 0x00327, 0x00123},
+  {0x00068, 0x00302, 0x00125}, {0x00068, 0x00307, 0x01E23}, {0x00068, 0x00308, 0x01E27},
+  {0x00068, 0x0030C, 0x0021F}, {0x00068, 0x00323, 0x01E25}, {0x00068, 0x00327, 0x01E29},
+  {0x00068, 0x0032E, 0x01E2B}, {0x00068, 0x00331, 0x01E96}, {0x00069, 0x00300, 0x000EC},
+  {0x00069, 0x00301, 0x000ED}, {0x00069, 0x00302, 0x000EE}, {0x00069, 0x00303, 0x00129},
+  {0x00069, 0x00304, 0x0012B}, {0x00069, 0x00306, 0x0012D}, {0x00069, 0x00308, 0x000EF},
+  {0x00069, 0x00309, 0x01EC9}, {0x00069, 0x0030C, 0x001D0}, {0x00069, 0x0030F, 0x00209},
+  {0x00069, 0x00311, 0x0020B}, {0x00069, 0x00323, 0x01ECB}, {0x00069, 0x00328, 0x0012F},
+  {0x00069, 0x00330, 0x01E2D}, {0x0006A, 0x00302, 0x00135}, {0x0006A, 0x0030C, 0x001F0},
+  {0x0006B, 0x00301, 0x01E31}, {0x0006B, 0x0030C, 0x001E9}, {0x0006B, 0x00323, 0x01E33},
+  {0x0006B, 0x00327, 0x00137}, {0x0006B, 0x00331, 0x01E35}, {0x0006C, 0x00301, 0x0013A},
+  {0x0006C, 0x0030C, 0x0013E}, {0x0006C, 0x00323, 0x01E37}, {0x0006C, 0x00327, 0x0013C},
+  {0x0006C, 0x0032D, 0x01E3D}, {0x0006C, 0x00331, 0x01E3B}, {0x0006D, 0x00301, 0x01E3F},
+  {0x0006D, 0x00307, 0x01E41}, {0x0006D, 0x00323, 0x01E43}, {0x0006E, 0x00300, 0x001F9},
+  {0x0006E, 0x00301, 0x00144}, {0x0006E, 0x00303, 0x000F1}, {0x0006E, 0x00307, 0x01E45},
+  {0x0006E, 0x0030C, 0x00148}, {0x0006E, 0x00323, 0x01E47}, {0x0006E, 0x00327, 0x00146},
+  {0x0006E, 0x0032D, 0x01E4B}, {0x0006E, 0x00331, 0x01E49}, {0x0006F, 0x00300, 0x000F2},
+  {0x0006F, 0x00301, 0x000F3}, {0x0006F, 0x00302, 0x000F4}, {0x0006F, 0x00303, 0x000F5},
+  {0x0006F, 0x00304, 0x0014D}, {0x0006F, 0x00306, 0x0014F}, {0x0006F, 0x00307, 0x0022F},
+  {0x0006F, 0x00308, 0x000F6}, {0x0006F, 0x00309, 0x01ECF}, {0x0006F, 0x0030B, 0x00151},
+  {0x0006F, 0x0030C, 0x001D2}, {0x0006F, 0x0030F, 0x0020D}, {0x0006F, 0x00311, 0x0020F},
+  {0x0006F, 0x0031B, 0x001A1}, {0x0006F, 0x00323, 0x01ECD}, {0x0006F, 0x00328, 0x001EB},
+  {0x00070, 0x00301, 0x01E55}, {0x00070, 0x00307, 0x01E57}, {0x00072, 0x00301, 0x00155},
+  {0x00072, 0x00307, 0x01E59}, {0x00072, 0x0030C, 0x00159}, {0x00072, 0x0030F, 0x00211},
+  {0x00072, 0x00311, 0x00213}, {0x00072, 0x00323, 0x01E5B}, {0x00072, 0x00327, 0x00157},
+  {0x00072, 0x00331, 0x01E5F}, {0x00073, 0x00301, 0x0015B}, {0x00073, 0x00302, 0x0015D},
+  {0x00073, 0x00307, 0x01E61}, {0x00073, 0x0030C, 0x00161}, {0x00073, 0x00323, 0x01E63},
+  {0x00073, 0x00326, 0x00219}, {0x00073, 0x00327, 0x0015F}, {0x00074, 0x00307, 0x01E6B},
+  {0x00074, 0x00308, 0x01E97}, {0x00074, 0x0030C, 0x00165}, {0x00074, 0x00323, 0x01E6D},
+  {0x00074, 0x00326, 0x0021B}, {0x00074, 0x00327, 0x00163}, {0x00074, 0x0032D, 0x01E71},
+  {0x00074, 0x00331, 0x01E6F}, {0x00075, 0x00300, 0x000F9}, {0x00075, 0x00301, 0x000FA},
+  {0x00075, 0x00302, 0x000FB}, {0x00075, 0x00303, 0x00169}, {0x00075, 0x00304, 0x0016B},
+  {0x00075, 0x00306, 0x0016D}, {0x00075, 0x00308, 0x000FC}, {0x00075, 0x00309, 0x01EE7},
+  {0x00075, 0x0030A, 0x0016F}, {0x00075, 0x0030B, 0x00171}, {0x00075, 0x0030C, 0x001D4},
+  {0x00075, 0x0030F, 0x00215}, {0x00075, 0x00311, 0x00217}, {0x00075, 0x0031B, 0x001B0},
+  {0x00075, 0x00323, 0x01EE5}, {0x00075, 0x00324, 0x01E73}, {0x00075, 0x00328, 0x00173},
+  {0x00075, 0x0032D, 0x01E77}, {0x00075, 0x00330, 0x01E75}, {0x00076, 0x00303, 0x01E7D},
+  {0x00076, 0x00323, 0x01E7F}, {0x00077, 0x00300, 0x01E81}, {0x00077, 0x00301, 0x01E83},
+  {0x00077, 0x00302, 0x00175}, {0x00077, 0x00307, 0x01E87}, {0x00077, 0x00308, 0x01E85},
+  {0x00077, 0x0030A, 0x01E98}, {0x00077, 0x00323, 0x01E89}, {0x00078, 0x00307, 0x01E8B},
+  {0x00078, 0x00308, 0x01E8D}, {0x00079, 0x00300, 0x01EF3}, {0x00079, 0x00301, 0x000FD},
+  {0x00079, 0x00302, 0x00177}, {0x00079, 0x00303, 0x01EF9}, {0x00079, 0x00304, 0x00233},
+  {0x00079, 0x00307, 0x01E8F}, {0x00079, 0x00308, 0x000FF}, {0x00079, 0x00309, 0x01EF7},
+  {0x00079, 0x0030A, 0x01E99}, {0x00079, 0x00323, 0x01EF5}, {0x0007A, 0x00301, 0x0017A},
+  {0x0007A, 0x00302, 0x01E91}, {0x0007A, 0x00307, 0x0017C}, {0x0007A, 0x0030C, 0x0017E},
+  {0x0007A, 0x00323, 0x01E93}, {0x0007A, 0x00331, 0x01E95}, {0x000A8, 0x00300, 0x01FED},
+  {0x000A8, 0x00301, 0x00385}, {0x000A8, 0x00342, 0x01FC1}, {0x000C2, 0x00300, 0x01EA6},
+  {0x000C2, 0x00301, 0x01EA4}, {0x000C2, 0x00303, 0x01EAA}, {0x000C2, 0x00309, 0x01EA8},
+  {0x000C4, 0x00304, 0x001DE}, {0x000C5, 0x00301, 0x001FA}, {0x000C6, 0x00301, 0x001FC},
+  {0x000C6, 0x00304, 0x001E2}, {0x000C7, 0x00301, 0x01E08}, {0x000CA, 0x00300, 0x01EC0},
+  {0x000CA, 0x00301, 0x01EBE}, {0x000CA, 0x00303, 0x01EC4}, {0x000CA, 0x00309, 0x01EC2},
+  {0x000CF, 0x00301, 0x01E2E}, {0x000D4, 0x00300, 0x01ED2}, {0x000D4, 0x00301, 0x01ED0},
+  {0x000D4, 0x00303, 0x01ED6}, {0x000D4, 0x00309, 0x01ED4}, {0x000D5, 0x00301, 0x01E4C},
+  {0x000D5, 0x00304, 0x0022C}, {0x000D5, 0x00308, 0x01E4E}, {0x000D6, 0x00304, 0x0022A},
+  {0x000D8, 0x00301, 0x001FE}, {0x000DC, 0x00300, 0x001DB}, {0x000DC, 0x00301, 0x001D7},
+  {0x000DC, 0x00304, 0x001D5}, {0x000DC, 0x0030C, 0x001D9}, {0x000E2, 0x00300, 0x01EA7},
+  {0x000E2, 0x00301, 0x01EA5}, {0x000E2, 0x00303, 0x01EAB}, {0x000E2, 0x00309, 0x01EA9},
+  {0x000E4, 0x00304, 0x001DF}, {0x000E5, 0x00301, 0x001FB}, {0x000E6, 0x00301, 0x001FD},
+  {0x000E6, 0x00304, 0x001E3}, {0x000E7, 0x00301, 0x01E09}, {0x000EA, 0x00300, 0x01EC1},
+  {0x000EA, 0x00301, 0x01EBF}, {0x000EA, 0x00303, 0x01EC5}, {0x000EA, 0x00309, 0x01EC3},
+  {0x000EF, 0x00301, 0x01E2F}, {0x000F4, 0x00300, 0x01ED3}, {0x000F4, 0x00301, 0x01ED1},
+  {0x000F4, 0x00303, 0x01ED7}, {0x000F4, 0x00309, 0x01ED5}, {0x000F5, 0x00301, 0x01E4D},
+  {0x000F5, 0x00304, 0x0022D}, {0x000F5, 0x00308, 0x01E4F}, {0x000F6, 0x00304, 0x0022B},
+  {0x000F8, 0x00301, 0x001FF}, {0x000FC, 0x00300, 0x001DC}, {0x000FC, 0x00301, 0x001D8},
+  {0x000FC, 0x00304, 0x001D6}, {0x000FC, 0x0030C, 0x001DA}, {0x00102, 0x00300, 0x01EB0},
+  {0x00102, 0x00301, 0x01EAE}, {0x00102, 0x00303, 0x01EB4}, {0x00102, 0x00309, 0x01EB2},
+  {0x00103, 0x00300, 0x01EB1}, {0x00103, 0x00301, 0x01EAF}, {0x00103, 0x00303, 0x01EB5},
+  {0x00103, 0x00309, 0x01EB3}, {0x00112, 0x00300, 0x01E14}, {0x00112, 0x00301, 0x01E16},
+  {0x00113, 0x00300, 0x01E15}, {0x00113, 0x00301, 0x01E17}, {0x0014C, 0x00300, 0x01E50},
+  {0x0014C, 0x00301, 0x01E52}, {0x0014D, 0x00300, 0x01E51}, {0x0014D, 0x00301, 0x01E53},
+  {0x0015A, 0x00307, 0x01E64}, {0x0015B, 0x00307, 0x01E65}, {0x00160, 0x00307, 0x01E66},
+  {0x00161, 0x00307, 0x01E67}, {0x00168, 0x00301, 0x01E78}, {0x00169, 0x00301, 0x01E79},
+  {0x0016A, 0x00308, 0x01E7A}, {0x0016B, 0x00308, 0x01E7B}, {0x0017F, 0x00307, 0x01E9B},
+  {0x001A0, 0x00300, 0x01EDC}, {0x001A0, 0x00301, 0x01EDA}, {0x001A0, 0x00303, 0x01EE0},
+  {0x001A0, 0x00309, 0x01EDE}, {0x001A0, 0x00323, 0x01EE2}, {0x001A1, 0x00300, 0x01EDD},
+  {0x001A1, 0x00301, 0x01EDB}, {0x001A1, 0x00303, 0x01EE1}, {0x001A1, 0x00309, 0x01EDF},
+  {0x001A1, 0x00323, 0x01EE3}, {0x001AF, 0x00300, 0x01EEA}, {0x001AF, 0x00301, 0x01EE8},
+  {0x001AF, 0x00303, 0x01EEE}, {0x001AF, 0x00309, 0x01EEC}, {0x001AF, 0x00323, 0x01EF0},
+  {0x001B0, 0x00300, 0x01EEB}, {0x001B0, 0x00301, 0x01EE9}, {0x001B0, 0x00303, 0x01EEF},
+  {0x001B0, 0x00309, 0x01EED}, {0x001B0, 0x00323, 0x01EF1}, {0x001B7, 0x0030C, 0x001EE},
+  {0x001EA, 0x00304, 0x001EC}, {0x001EB, 0x00304, 0x001ED}, {0x00226, 0x00304, 0x001E0},
+  {0x00227, 0x00304, 0x001E1}, {0x00228, 0x00306, 0x01E1C}, {0x00229, 0x00306, 0x01E1D},
+  {0x0022E, 0x00304, 0x00230}, {0x0022F, 0x00304, 0x00231}, {0x00292, 0x0030C, 0x001EF},
+  {0x00391, 0x00300, 0x01FBA}, {0x00391, 0x00301, 0x00386}, {0x00391, 0x00304, 0x01FB9},
+  {0x00391, 0x00306, 0x01FB8}, {0x00391, 0x00313, 0x01F08}, {0x00391, 0x00314, 0x01F09},
+  {0x00391, 0x00345, 0x01FBC}, {0x00395, 0x00300, 0x01FC8}, {0x00395, 0x00301, 0x00388},
+  {0x00395, 0x00313, 0x01F18}, {0x00395, 0x00314, 0x01F19}, {0x00397, 0x00300, 0x01FCA},
+  {0x00397, 0x00301, 0x00389}, {0x00397, 0x00313, 0x01F28}, {0x00397, 0x00314, 0x01F29},
+  {0x00397, 0x00345, 0x01FCC}, {0x00399, 0x00300, 0x01FDA}, {0x00399, 0x00301, 0x0038A},
+  {0x00399, 0x00304, 0x01FD9}, {0x00399, 0x00306, 0x01FD8}, {0x00399, 0x00308, 0x003AA},
+  {0x00399, 0x00313, 0x01F38}, {0x00399, 0x00314, 0x01F39}, {0x0039F, 0x00300, 0x01FF8},
+  {0x0039F, 0x00301, 0x0038C}, {0x0039F, 0x00313, 0x01F48}, {0x0039F, 0x00314, 0x01F49},
+  {0x003A1, 0x00314, 0x01FEC}, {0x003A5, 0x00300, 0x01FEA}, {0x003A5, 0x00301, 0x0038E},
+  {0x003A5, 0x00304, 0x01FE9}, {0x003A5, 0x00306, 0x01FE8}, {0x003A5, 0x00308, 0x003AB},
+  {0x003A5, 0x00314, 0x01F59}, {0x003A9, 0x00300, 0x01FFA}, {0x003A9, 0x00301, 0x0038F},
+  {0x003A9, 0x00313, 0x01F68}, {0x003A9, 0x00314, 0x01F69}, {0x003A9, 0x00345, 0x01FFC},
+  {0x003AC, 0x00345, 0x01FB4}, {0x003AE, 0x00345, 0x01FC4}, {0x003B1, 0x00300, 0x01F70},
+  {0x003B1, 0x00301, 0x003AC}, {0x003B1, 0x00304, 0x01FB1}, {0x003B1, 0x00306, 0x01FB0},
+  {0x003B1, 0x00313, 0x01F00}, {0x003B1, 0x00314, 0x01F01}, {0x003B1, 0x00342, 0x01FB6},
+  {0x003B1, 0x00345, 0x01FB3}, {0x003B5, 0x00300, 0x01F72}, {0x003B5, 0x00301, 0x003AD},
+  {0x003B5, 0x00313, 0x01F10}, {0x003B5, 0x00314, 0x01F11}, {0x003B7, 0x00300, 0x01F74},
+  {0x003B7, 0x00301, 0x003AE}, {0x003B7, 0x00313, 0x01F20}, {0x003B7, 0x00314, 0x01F21},
+  {0x003B7, 0x00342, 0x01FC6}, {0x003B7, 0x00345, 0x01FC3}, {0x003B9, 0x00300, 0x01F76},
+  {0x003B9, 0x00301, 0x003AF}, {0x003B9, 0x00304, 0x01FD1}, {0x003B9, 0x00306, 0x01FD0},
+  {0x003B9, 0x00308, 0x003CA}, {0x003B9, 0x00313, 0x01F30}, {0x003B9, 0x00314, 0x01F31},
+  {0x003B9, 0x00342, 0x01FD6}, {0x003BF, 0x00300, 0x01F78}, {0x003BF, 0x00301, 0x003CC},
+  {0x003BF, 0x00313, 0x01F40}, {0x003BF, 0x00314, 0x01F41}, {0x003C1, 0x00313, 0x01FE4},
+  {0x003C1, 0x00314, 0x01FE5}, {0x003C5, 0x00300, 0x01F7A}, {0x003C5, 0x00301, 0x003CD},
+  {0x003C5, 0x00304, 0x01FE1}, {0x003C5, 0x00306, 0x01FE0}, {0x003C5, 0x00308, 0x003CB},
+  {0x003C5, 0x00313, 0x01F50}, {0x003C5, 0x00314, 0x01F51}, {0x003C5, 0x00342, 0x01FE6},
+  {0x003C9, 0x00300, 0x01F7C}, {0x003C9, 0x00301, 0x003CE}, {0x003C9, 0x00313, 0x01F60},
+  {0x003C9, 0x00314, 0x01F61}, {0x003C9, 0x00342, 0x01FF6}, {0x003C9, 0x00345, 0x01FF3},
+  {0x003CA, 0x00300, 0x01FD2}, {0x003CA, 0x00301, 0x00390}, {0x003CA, 0x00342, 0x01FD7},
+  {0x003CB, 0x00300, 0x01FE2}, {0x003CB, 0x00301, 0x003B0}, {0x003CB, 0x00342, 0x01FE7},
+  {0x003CE, 0x00345, 0x01FF4}, {0x003D2, 0x00301, 0x003D3}, {0x003D2, 0x00308, 0x003D4},
+  {0x00406, 0x00308, 0x00407}, {0x00410, 0x00306, 0x004D0}, {0x00410, 0x00308, 0x004D2},
+  {0x00413, 0x00301, 0x00403}, {0x00415, 0x00300, 0x00400}, {0x00415, 0x00306, 0x004D6},
+  {0x00415, 0x00308, 0x00401}, {0x00416, 0x00306, 0x004C1}, {0x00416, 0x00308, 0x004DC},
+  {0x00417, 0x00308, 0x004DE}, {0x00418, 0x00300, 0x0040D}, {0x00418, 0x00304, 0x004E2},
+  {0x00418, 0x00306, 0x00419}, {0x00418, 0x00308, 0x004E4}, {0x0041A, 0x00301, 0x0040C},
+  {0x0041E, 0x00308, 0x004E6}, {0x00423, 0x00304, 0x004EE}, {0x00423, 0x00306, 0x0040E},
+  {0x00423, 0x00308, 0x004F0}, {0x00423, 0x0030B, 0x004F2}, {0x00427, 0x00308, 0x004F4},
+  {0x0042B, 0x00308, 0x004F8}, {0x0042D, 0x00308, 0x004EC}, {0x00430, 0x00306, 0x004D1},
+  {0x00430, 0x00308, 0x004D3}, {0x00433, 0x00301, 0x00453}, {0x00435, 0x00300, 0x00450},
+  {0x00435, 0x00306, 0x004D7}, {0x00435, 0x00308, 0x00451}, {0x00436, 0x00306, 0x004C2},
+  {0x00436, 0x00308, 0x004DD}, {0x00437, 0x00308, 0x004DF}, {0x00438, 0x00300, 0x0045D},
+  {0x00438, 0x00304, 0x004E3}, {0x00438, 0x00306, 0x00439}, {0x00438, 0x00308, 0x004E5},
+  {0x0043A, 0x00301, 0x0045C}, {0x0043E, 0x00308, 0x004E7}, {0x00443, 0x00304, 0x004EF},
+  {0x00443, 0x00306, 0x0045E}, {0x00443, 0x00308, 0x004F1}, {0x00443, 0x0030B, 0x004F3},
+  {0x00447, 0x00308, 0x004F5}, {0x0044B, 0x00308, 0x004F9}, {0x0044D, 0x00308, 0x004ED},
+  {0x00456, 0x00308, 0x00457}, {0x00474, 0x0030F, 0x00476}, {0x00475, 0x0030F, 0x00477},
+  {0x004D8, 0x00308, 0x004DA}, {0x004D9, 0x00308, 0x004DB}, {0x004E8, 0x00308, 0x004EA},
+  {0x004E9, 0x00308, 0x004EB}, {0x00627, 0x00653, 0x00622}, {0x00627, 0x00654, 0x00623},
+  {0x00627, 0x00655, 0x00625}, {0x00648, 0x00654, 0x00624}, {0x0064A, 0x00654, 0x00626},
+  {0x006C1, 0x00654, 0x006C2}, {0x006D2, 0x00654, 0x006D3}, {0x006D5, 0x00654, 0x006C0},
+  {0x00928, 0x0093C, 0x00929}, {0x00930, 0x0093C, 0x00931}, {0x00933, 0x0093C, 0x00934},
+  {0x009C7, 0x009BE, 0x009CB}, {0x009C7, 0x009D7, 0x009CC}, {0x00B47, 0x00B3E, 0x00B4B},
+  {0x00B47, 0x00B56, 0x00B48}, {0x00B47, 0x00B57, 0x00B4C}, {0x00B92, 0x00BD7, 0x00B94},
+  {0x00BC6, 0x00BBE, 0x00BCA}, {0x00BC6, 0x00BD7, 0x00BCC}, {0x00BC7, 0x00BBE, 0x00BCB},
+  {0x00C46, 0x00C56, 0x00C48}, {0x00CBF, 0x00CD5, 0x00CC0}, {0x00CC6, 0x00CC2, 0x00CCA},
+  {0x00CC6, 0x00CD5, 0x00CC7}, {0x00CC6, 0x00CD6, 0x00CC8}, {0x00CCA, 0x00CD5, 0x00CCB},
+  {0x00D46, 0x00D3E, 0x00D4A}, {0x00D46, 0x00D57, 0x00D4C}, {0x00D47, 0x00D3E, 0x00D4B},
+  {0x00DD9, 0x00DCA, 0x00DDA}, {0x00DD9, 0x00DCF, 0x00DDC}, {0x00DD9, 0x00DDF, 0x00DDE},
+  {0x00DDC, 0x00DCA, 0x00DDD}, {0x01025, 0x0102E, 0x01026}, {0x01B05, 0x01B35, 0x01B06},
+  {0x01B07, 0x01B35, 0x01B08}, {0x01B09, 0x01B35, 0x01B0A}, {0x01B0B, 0x01B35, 0x01B0C},
+  {0x01B0D, 0x01B35, 0x01B0E}, {0x01B11, 0x01B35, 0x01B12}, {0x01B3A, 0x01B35, 0x01B3B},
+  {0x01B3C, 0x01B35, 0x01B3D}, {0x01B3E, 0x01B35, 0x01B40}, {0x01B3F, 0x01B35, 0x01B41},
+  {0x01B42, 0x01B35, 0x01B43}, {0x01E36, 0x00304, 0x01E38}, {0x01E37, 0x00304, 0x01E39},
+  {0x01E5A, 0x00304, 0x01E5C}, {0x01E5B, 0x00304, 0x01E5D}, {0x01E62, 0x00307, 0x01E68},
+  {0x01E63, 0x00307, 0x01E69}, {0x01EA0, 0x00302, 0x01EAC}, {0x01EA0, 0x00306, 0x01EB6},
+  {0x01EA1, 0x00302, 0x01EAD}, {0x01EA1, 0x00306, 0x01EB7}, {0x01EB8, 0x00302, 0x01EC6},
+  {0x01EB9, 0x00302, 0x01EC7}, {0x01ECC, 0x00302, 0x01ED8}, {0x01ECD, 0x00302, 0x01ED9},
+  {0x01F00, 0x00300, 0x01F02}, {0x01F00, 0x00301, 0x01F04}, {0x01F00, 0x00342, 0x01F06},
+  {0x01F00, 0x00345, 0x01F80}, {0x01F01, 0x00300, 0x01F03}, {0x01F01, 0x00301, 0x01F05},
+  {0x01F01, 0x00342, 0x01F07}, {0x01F01, 0x00345, 0x01F81}, {0x01F02, 0x00345, 0x01F82},
+  {0x01F03, 0x00345, 0x01F83}, {0x01F04, 0x00345, 0x01F84}, {0x01F05, 0x00345, 0x01F85},
+  {0x01F06, 0x00345, 0x01F86}, {0x01F07, 0x00345, 0x01F87}, {0x01F08, 0x00300, 0x01F0A},
+  {0x01F08, 0x00301, 0x01F0C}, {0x01F08, 0x00342, 0x01F0E}, {0x01F08, 0x00345, 0x01F88},
+  {0x01F09, 0x00300, 0x01F0B}, {0x01F09, 0x00301, 0x01F0D}, {0x01F09, 0x00342, 0x01F0F},
+  {0x01F09, 0x00345, 0x01F89}, {0x01F0A, 0x00345, 0x01F8A}, {0x01F0B, 0x00345, 0x01F8B},
+  {0x01F0C, 0x00345, 0x01F8C}, {0x01F0D, 0x00345, 0x01F8D}, {0x01F0E, 0x00345, 0x01F8E},
+  {0x01F0F, 0x00345, 0x01F8F}, {0x01F10, 0x00300, 0x01F12}, {0x01F10, 0x00301, 0x01F14},
+  {0x01F11, 0x00300, 0x01F13}, {0x01F11, 0x00301, 0x01F15}, {0x01F18, 0x00300, 0x01F1A},
+  {0x01F18, 0x00301, 0x01F1C}, {0x01F19, 0x00300, 0x01F1B}, {0x01F19, 0x00301, 0x01F1D},
+  {0x01F20, 0x00300, 0x01F22}, {0x01F20, 0x00301, 0x01F24}, {0x01F20, 0x00342, 0x01F26},
+  {0x01F20, 0x00345, 0x01F90}, {0x01F21, 0x00300, 0x01F23}, {0x01F21, 0x00301, 0x01F25},
+  {0x01F21, 0x00342, 0x01F27}, {0x01F21, 0x00345, 0x01F91}, {0x01F22, 0x00345, 0x01F92},
+  {0x01F23, 0x00345, 0x01F93}, {0x01F24, 0x00345, 0x01F94}, {0x01F25, 0x00345, 0x01F95},
+  {0x01F26, 0x00345, 0x01F96}, {0x01F27, 0x00345, 0x01F97}, {0x01F28, 0x00300, 0x01F2A},
+  {0x01F28, 0x00301, 0x01F2C}, {0x01F28, 0x00342, 0x01F2E}, {0x01F28, 0x00345, 0x01F98},
+  {0x01F29, 0x00300, 0x01F2B}, {0x01F29, 0x00301, 0x01F2D}, {0x01F29, 0x00342, 0x01F2F},
+  {0x01F29, 0x00345, 0x01F99}, {0x01F2A, 0x00345, 0x01F9A}, {0x01F2B, 0x00345, 0x01F9B},
+  {0x01F2C, 0x00345, 0x01F9C}, {0x01F2D, 0x00345, 0x01F9D}, {0x01F2E, 0x00345, 0x01F9E},
+  {0x01F2F, 0x00345, 0x01F9F}, {0x01F30, 0x00300, 0x01F32}, {0x01F30, 0x00301, 0x01F34},
+  {0x01F30, 0x00342, 0x01F36}, {0x01F31, 0x00300, 0x01F33}, {0x01F31, 0x00301, 0x01F35},
+  {0x01F31, 0x00342, 0x01F37}, {0x01F38, 0x00300, 0x01F3A}, {0x01F38, 0x00301, 0x01F3C},
+  {0x01F38, 0x00342, 0x01F3E}, {0x01F39, 0x00300, 0x01F3B}, {0x01F39, 0x00301, 0x01F3D},
+  {0x01F39, 0x00342, 0x01F3F}, {0x01F40, 0x00300, 0x01F42}, {0x01F40, 0x00301, 0x01F44},
+  {0x01F41, 0x00300, 0x01F43}, {0x01F41, 0x00301, 0x01F45}, {0x01F48, 0x00300, 0x01F4A},
+  {0x01F48, 0x00301, 0x01F4C}, {0x01F49, 0x00300, 0x01F4B}, {0x01F49, 0x00301, 0x01F4D},
+  {0x01F50, 0x00300, 0x01F52}, {0x01F50, 0x00301, 0x01F54}, {0x01F50, 0x00342, 0x01F56},
+  {0x01F51, 0x00300, 0x01F53}, {0x01F51, 0x00301, 0x01F55}, {0x01F51, 0x00342, 0x01F57},
+  {0x01F59, 0x00300, 0x01F5B}, {0x01F59, 0x00301, 0x01F5D}, {0x01F59, 0x00342, 0x01F5F},
+  {0x01F60, 0x00300, 0x01F62}, {0x01F60, 0x00301, 0x01F64}, {0x01F60, 0x00342, 0x01F66},
+  {0x01F60, 0x00345, 0x01FA0}, {0x01F61, 0x00300, 0x01F63}, {0x01F61, 0x00301, 0x01F65},
+  {0x01F61, 0x00342, 0x01F67}, {0x01F61, 0x00345, 0x01FA1}, {0x01F62, 0x00345, 0x01FA2},
+  {0x01F63, 0x00345, 0x01FA3}, {0x01F64, 0x00345, 0x01FA4}, {0x01F65, 0x00345, 0x01FA5},
+  {0x01F66, 0x00345, 0x01FA6}, {0x01F67, 0x00345, 0x01FA7}, {0x01F68, 0x00300, 0x01F6A},
+  {0x01F68, 0x00301, 0x01F6C}, {0x01F68, 0x00342, 0x01F6E}, {0x01F68, 0x00345, 0x01FA8},
+  {0x01F69, 0x00300, 0x01F6B}, {0x01F69, 0x00301, 0x01F6D}, {0x01F69, 0x00342, 0x01F6F},
+  {0x01F69, 0x00345, 0x01FA9}, {0x01F6A, 0x00345, 0x01FAA}, {0x01F6B, 0x00345, 0x01FAB},
+  {0x01F6C, 0x00345, 0x01FAC}, {0x01F6D, 0x00345, 0x01FAD}, {0x01F6E, 0x00345, 0x01FAE},
+  {0x01F6F, 0x00345, 0x01FAF}, {0x01F70, 0x00345, 0x01FB2}, {0x01F74, 0x00345, 0x01FC2},
+  {0x01F7C, 0x00345, 0x01FF2}, {0x01FB6, 0x00345, 0x01FB7}, {0x01FBF, 0x00300, 0x01FCD},
+  {0x01FBF, 0x00301, 0x01FCE}, {0x01FBF, 0x00342, 0x01FCF}, {0x01FC6, 0x00345, 0x01FC7},
+  {0x01FF6, 0x00345, 0x01FF7}, {0x01FFE, 0x00300, 0x01FDD}, {0x01FFE, 0x00301, 0x01FDE},
+  {0x01FFE, 0x00342, 0x01FDF}, {0x02190, 0x00338, 0x0219A}, {0x02192, 0x00338, 0x0219B},
+  {0x02194, 0x00338, 0x021AE}, {0x021D0, 0x00338, 0x021CD}, {0x021D2, 0x00338, 0x021CF},
+  {0x021D4, 0x00338, 0x021CE}, {0x02203, 0x00338, 0x02204}, {0x02208, 0x00338, 0x02209},
+  {0x0220B, 0x00338, 0x0220C}, {0x02223, 0x00338, 0x02224}, {0x02225, 0x00338, 0x02226},
+  {0x0223C, 0x00338, 0x02241}, {0x02243, 0x00338, 0x02244}, {0x02245, 0x00338, 0x02247},
+  {0x02248, 0x00338, 0x02249}, {0x0224D, 0x00338, 0x0226D}, {0x02261, 0x00338, 0x02262},
+  {0x02264, 0x00338, 0x02270}, {0x02265, 0x00338, 0x02271}, {0x02272, 0x00338, 0x02274},
+  {0x02273, 0x00338, 0x02275}, {0x02276, 0x00338, 0x02278}, {0x02277, 0x00338, 0x02279},
+  {0x0227A, 0x00338, 0x02280}, {0x0227B, 0x00338, 0x02281}, {0x0227C, 0x00338, 0x022E0},
+  {0x0227D, 0x00338, 0x022E1}, {0x02282, 0x00338, 0x02284}, {0x02283, 0x00338, 0x02285},
+  {0x02286, 0x00338, 0x02288}, {0x02287, 0x00338, 0x02289}, {0x02291, 0x00338, 0x022E2},
+  {0x02292, 0x00338, 0x022E3}, {0x022A2, 0x00338, 0x022AC}, {0x022A8, 0x00338, 0x022AD},
+  {0x022A9, 0x00338, 0x022AE}, {0x022AB, 0x00338, 0x022AF}, {0x022B2, 0x00338, 0x022EA},
+  {0x022B3, 0x00338, 0x022EB}, {0x022B4, 0x00338, 0x022EC}, {0x022B5, 0x00338, 0x022ED},
+  {0x03046, 0x03099, 0x03094}, {0x0304B, 0x03099, 0x0304C}, {0x0304D, 0x03099, 0x0304E},
+  {0x0304F, 0x03099, 0x03050}, {0x03051, 0x03099, 0x03052}, {0x03053, 0x03099, 0x03054},
+  {0x03055, 0x03099, 0x03056}, {0x03057, 0x03099, 0x03058}, {0x03059, 0x03099, 0x0305A},
+  {0x0305B, 0x03099, 0x0305C}, {0x0305D, 0x03099, 0x0305E}, {0x0305F, 0x03099, 0x03060},
+  {0x03061, 0x03099, 0x03062}, {0x03064, 0x03099, 0x03065}, {0x03066, 0x03099, 0x03067},
+  {0x03068, 0x03099, 0x03069}, {0x0306F, 0x03099, 0x03070}, {0x0306F, 0x0309A, 0x03071},
+  {0x03072, 0x03099, 0x03073}, {0x03072, 0x0309A, 0x03074}, {0x03075, 0x03099, 0x03076},
+  {0x03075, 0x0309A, 0x03077}, {0x03078, 0x03099, 0x03079}, {0x03078, 0x0309A, 0x0307A},
+  {0x0307B, 0x03099, 0x0307C}, {0x0307B, 0x0309A, 0x0307D}, {0x0309D, 0x03099, 0x0309E},
+  {0x030A6, 0x03099, 0x030F4}, {0x030AB, 0x03099, 0x030AC}, {0x030AD, 0x03099, 0x030AE},
+  {0x030AF, 0x03099, 0x030B0}, {0x030B1, 0x03099, 0x030B2}, {0x030B3, 0x03099, 0x030B4},
+  {0x030B5, 0x03099, 0x030B6}, {0x030B7, 0x03099, 0x030B8}, {0x030B9, 0x03099, 0x030BA},
+  {0x030BB, 0x03099, 0x030BC}, {0x030BD, 0x03099, 0x030BE}, {0x030BF, 0x03099, 0x030C0},
+  {0x030C1, 0x03099, 0x030C2}, {0x030C4, 0x03099, 0x030C5}, {0x030C6, 0x03099, 0x030C7},
+  {0x030C8, 0x03099, 0x030C9}, {0x030CF, 0x03099, 0x030D0}, {0x030CF, 0x0309A, 0x030D1},
+  {0x030D2, 0x03099, 0x030D3}, {0x030D2, 0x0309A, 0x030D4}, {0x030D5, 0x03099, 0x030D6},
+  {0x030D5, 0x0309A, 0x030D7}, {0x030D8, 0x03099, 0x030D9}, {0x030D8, 0x0309A, 0x030DA},
+  {0x030DB, 0x03099, 0x030DC}, {0x030DB, 0x0309A, 0x030DD}, {0x030EF, 0x03099, 0x030F7},
+  {0x030F0, 0x03099, 0x030F8}, {0x030F1, 0x03099, 0x030F9}, {0x030F2, 0x03099, 0x030FA},
+  {0x030FD, 0x03099, 0x030FE}, {0x11099, 0x110BA, 0x1109A}, {0x1109B, 0x110BA, 0x1109C},
+  {0x110A5, 0x110BA, 0x110AB}, {0x11131, 0x11127, 0x1112E}, {0x11132, 0x11127, 0x1112F},
+  {0x11347, 0x1133E, 0x1134B}, {0x11347, 0x11357, 0x1134C}, {0x114B9, 0x114B0, 0x114BC},
+  {0x114B9, 0x114BA, 0x114BB}, {0x114B9, 0x114BD, 0x114BE}, {0x115B8, 0x115AF, 0x115BA},
+  {0x115B9, 0x115AF, 0x115BB}, {0x11935, 0x11930, 0x11938},
+};
+
+#endif /* uts46_tables_h */